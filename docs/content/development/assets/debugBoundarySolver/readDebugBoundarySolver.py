@@ -0,0 +1,54 @@
+import argparse
+import pathlib
+
+import h5py
+import numpy as np
+
+
+# Reads the binary output of the ablate::boundarySolver::DebugBoundarySolver (binaryOutput: true).
+# Each rank writes a stencil_rank_<rank>.h5 file with the stencil points and a source_rank_<rank>.h5 file with one timestep per rhs evaluation.
+# The rows of every dataset are the boundary cell followed by each stencil point for every face, offsets[f]:offsets[f+1] are the rows of face f.
+# -------------------------------------------------------------------------------------------------------------------------------------------------
+
+def read_stencils(directory, rank):
+    with h5py.File(pathlib.Path(directory) / f'stencil_rank_{rank}.h5', 'r') as stencilFile:
+        components = stencilFile.attrs['components']
+        components = (components.decode() if isinstance(components, bytes) else str(components)).split()
+        return {
+            'offsets': np.array(stencilFile['offsets']),
+            'points': np.array(stencilFile['points']),
+            'centroids': np.array(stencilFile['centroids']),
+            'components': components,
+        }
+
+
+def read_sources(directory, rank):
+    # the datasets are written with petsc timestepping so the first index is the rhs evaluation
+    with h5py.File(pathlib.Path(directory) / f'source_rank_{rank}.h5', 'r') as sourceFile:
+        if 'time' not in sourceFile:
+            return {'time': np.empty(0), 'values': np.empty(0), 'sources': np.empty(0)}
+        return {
+            'time': np.array(sourceFile['time']).reshape(-1),
+            'values': np.array(sourceFile['values']),
+            'sources': np.array(sourceFile['sources']),
+        }
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Summarize the binary DebugBoundarySolver output for a single rank')
+    parser.add_argument('--directory', type=str, required=True, help='the output directory of the debug boundary solver, i.e. <output>/<solverId>')
+    parser.add_argument('--rank', type=int, default=0, help='the rank to read')
+    parser.add_argument('--face', type=int, default=None, help='print the values and sources of this face at the last rhs evaluation')
+    args = parser.parse_args()
+
+    stencils = read_stencils(args.directory, args.rank)
+    sources = read_sources(args.directory, args.rank)
+    print(f"{len(stencils['offsets']) - 1} faces, {len(stencils['points'])} stencil rows, {len(sources['time'])} rhs evaluations")
+    print('components: ' + ' '.join(stencils['components']))
+
+    if args.face is not None and len(sources['time']):
+        start, end = stencils['offsets'][args.face], stencils['offsets'][args.face + 1]
+        print(f"time {sources['time'][-1]}")
+        for row in range(start, end):
+            label = 'cell' if row == start else 'stencil'
+            print(label, stencils['points'][row], stencils['centroids'][row], sources['values'][-1][row], sources['sources'][-1][row])
@@ -0,0 +1,108 @@
+#!/usr/bin/python3
+# Runs a strong or weak scaling study of an ABLATE input and aggregates the PerformanceReport output into an efficiency table.
+#
+# The input must include a !ablate::monitors::PerformanceReport monitor (with the default json output) and a !ablate::domain::BoxMesh.  Each run is
+# launched with the BoxMesh faces, the output directory, and the title replaced on the command line using the -yaml:: overrides.
+#
+#   strong: the faces are held fixed so the total number of cells is constant
+#   weak: the faces are scaled with the number of ranks so the number of cells per rank is constant
+#
+# Example:
+#   python3 scalingStudy.py --ablate $ABLATE_DIR/ablate --input input.yaml --faces 64,64 --ranks 1,2,4,8 --mode weak
+import argparse
+import csv
+import glob
+import json
+import math
+import os
+import subprocess
+
+
+def scale_faces(base_faces, base_ranks, ranks, mode):
+    """Return the faces for a run, in weak scaling the total cells grow with the number of ranks"""
+    if mode == 'strong':
+        return list(base_faces)
+    factor = (ranks / base_ranks) ** (1.0 / len(base_faces))
+    return [max(1, int(round(face * factor))) for face in base_faces]
+
+
+def run_case(args, ranks, faces, directory):
+    """Launch a single run and return the parsed performance report"""
+    faces_string = '[' + ', '.join(str(face) for face in faces) + ']'
+    command = args.launcher.format(ranks=ranks).split() + [
+        args.ablate,
+        '--input', args.input,
+        '-yaml::environment::title', os.path.basename(directory),
+        '-yaml::environment::directory', directory,
+        '-yaml::environment::tagDirectory', 'false',
+        '-yaml::timestepper::domain::faces', faces_string,
+    ] + args.extra
+    print('Running: ' + ' '.join(command), flush=True)
+    subprocess.run(command, check=True)
+
+    reports = sorted(glob.glob(os.path.join(directory, 'performanceReport*.json')))
+    if not reports:
+        raise RuntimeError('No PerformanceReport found in ' + directory + ', add a !ablate::monitors::PerformanceReport monitor to the input')
+    with open(reports[0], 'r') as report_file:
+        return json.load(report_file)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run a strong or weak scaling study of an ABLATE input.')
+    parser.add_argument('--ablate', required=True, help='the path to the ablate executable')
+    parser.add_argument('--input', required=True, help='the input yaml file with a BoxMesh and a PerformanceReport monitor')
+    parser.add_argument('--faces', required=True, help='the comma separated BoxMesh faces used for the smallest rank count')
+    parser.add_argument('--ranks', required=True, help='the comma separated list of rank counts')
+    parser.add_argument('--mode', choices=['strong', 'weak'], default='strong', help='hold the total cells (strong) or the cells per rank (weak) fixed')
+    parser.add_argument('--launcher', default='mpirun -n {ranks}', help='the mpi launch command, {ranks} is replaced with the rank count')
+    parser.add_argument('--output', default='scalingStudy', help='the directory for the run output and the efficiency table')
+    parser.add_argument('extra', nargs=argparse.REMAINDER, help='additional arguments passed to ablate')
+    args = parser.parse_args()
+
+    base_faces = [int(face) for face in args.faces.split(',')]
+    ranks_list = sorted(int(ranks) for ranks in args.ranks.split(','))
+    os.makedirs(args.output, exist_ok=True)
+
+    rows = []
+    for ranks in ranks_list:
+        faces = scale_faces(base_faces, ranks_list[0], ranks, args.mode)
+        directory = os.path.abspath(os.path.join(args.output, args.mode + '_' + str(ranks)))
+        report = run_case(args, ranks, faces, directory)
+
+        time_steps = max(report['timeSteps'], 1)
+        rows.append({
+            'ranks': ranks,
+            'faces': 'x'.join(str(face) for face in faces),
+            'cells': report['cells'],
+            'cellsPerRank': report['cells'] / ranks,
+            'timePerStep': report['steppingTime'] / time_steps,
+            'cellsPerSecond': report['cellsPerSecond'],
+            'maxMemoryPerRank': max(report['memoryHighWaterMark']) if report['memoryHighWaterMark'] else 0.0,
+        })
+
+    # the efficiency is relative to the smallest rank count
+    base = rows[0]
+    for row in rows:
+        if args.mode == 'strong':
+            ideal = base['timePerStep'] * base['ranks'] / row['ranks']
+        else:
+            ideal = base['timePerStep'] * (row['cellsPerRank'] / base['cellsPerRank'])
+        row['efficiency'] = ideal / row['timePerStep'] if row['timePerStep'] > 0 else math.nan
+
+    table_file = os.path.join(args.output, args.mode + 'Scaling.csv')
+    with open(table_file, 'w', newline='') as csv_file:
+        writer = csv.DictWriter(csv_file, fieldnames=list(rows[0].keys()))
+        writer.writeheader()
+        writer.writerows(rows)
+
+    print()
+    print('| ' + ' | '.join(rows[0].keys()) + ' |')
+    print('|' + '---|' * len(rows[0]))
+    for row in rows:
+        print('| ' + ' | '.join(f'{value:.4g}' if isinstance(value, float) else str(value) for value in row.values()) + ' |')
+    print()
+    print('Wrote ' + table_file)
+
+
+if __name__ == '__main__':
+    main()
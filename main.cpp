@@ -5,9 +5,11 @@
 #include <utilities/mpiError.hpp>
 #include "builder.hpp"
 #include "environment/download.hpp"
+#include "environment/fileBroadcast.hpp"
 #include "environment/runEnvironment.hpp"
 #include "listing.hpp"
 #include "localPath.hpp"
+#include "monitors/probes.hpp"
 #include "utilities/petscError.hpp"
 #include "utilities/petscUtilities.hpp"
 #include "yamlParser.hpp"
@@ -54,6 +56,16 @@ int main(int argc, char** args) {
         return 0;
     }
 
+    // convert a binary probe file to a csv file per probe in the same directory
+    char probeFilename[PETSC_MAX_PATH_LEN] = "";
+    PetscBool convertProbes = PETSC_FALSE;
+    PetscOptionsGetString(NULL, NULL, "--convertProbes", probeFilename, PETSC_MAX_PATH_LEN, &convertProbes) >> checkError;
+    if (convertProbes) {
+        std::filesystem::path probeFilePath(probeFilename);
+        monitors::Probes::ConvertToCsv(probeFilePath, probeFilePath.parent_path());
+        return 0;
+    }
+
     // check to see if we should print options
     char filename[PETSC_MAX_PATH_LEN] = "";
     PetscBool fileSpecified = PETSC_FALSE;
@@ -72,15 +84,20 @@ int main(int argc, char** args) {
         filePath = locator.Locate();
     }
 
-    if (!std::filesystem::exists(filePath)) {
+    // when broadcasting files (--broadcastFiles) only the root rank reads the input and any resource files from the shared file system
+    const bool broadcastFiles = environment::FileBroadcast::Enabled();
+    if (!broadcastFiles && !std::filesystem::exists(filePath)) {
         throw std::invalid_argument("unable to locate input file: " + filePath.string());
     }
     {
         // build options from the command line
         auto yamlOptions = std::make_shared<ablate::parameters::PetscPrefixOptions>(replacementInputPrefix);
 
-        // create the yaml parser
-        std::shared_ptr<cppParser::YamlParser> parser = std::make_shared<cppParser::YamlParser>(filePath, yamlOptions->GetMap());
+        // create the yaml parser, relative paths in a broadcast input are still located next to the original input file
+        std::shared_ptr<cppParser::YamlParser> parser =
+            broadcastFiles ? std::make_shared<cppParser::YamlParser>(
+                                 environment::FileBroadcast::ReadContents(filePath), std::vector<std::filesystem::path>{filePath.parent_path()}, yamlOptions->GetMap())
+                           : std::make_shared<cppParser::YamlParser>(filePath, yamlOptions->GetMap());
 
         // setup the monitor
         auto setupEnvironmentParameters = parser->GetByName<ablate::parameters::Parameters>("environment");
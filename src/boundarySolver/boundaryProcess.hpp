@@ -18,6 +18,13 @@ class BoundaryProcess {
      * @param fv
      */
     virtual void Initialize(ablate::boundarySolver::BoundarySolver& fv){};
+
+    /**
+     * Add any memory held by the process (i.e. radiation rays) to the memory usage
+     * @param memoryUsage
+     * @param prefix prepended to each entry name
+     */
+    virtual void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const {}
 };
 
 }  // namespace ablate::boundarySolver
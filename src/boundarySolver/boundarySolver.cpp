@@ -2,6 +2,7 @@
 #include <set>
 #include <utility>
 #include "boundaryProcess.hpp"
+#include "utilities/kokkosUtilities.hpp"
 #include "utilities/mathUtilities.hpp"
 #include "utilities/stringUtilities.hpp"
 
@@ -78,6 +79,12 @@ void ablate::boundarySolver::BoundarySolver::Setup() {
     PetscFVSetType(gradientCalculator, PETSCFVLEASTSQUARES) >> checkError;
     // Set any other required options
     PetscObjectSetOptions((PetscObject)gradientCalculator, petscOptions) >> checkError;
+
+    // check to see if the boundary sources should be computed concurrently
+    PetscBool threadedRHSOption = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-threadedRHS", &threadedRHSOption, nullptr) >> checkError;
+    // the threaded loop calls petsc (and the petsc stack) from the helper threads
+    threadedRHS = threadedRHSOption == PETSC_TRUE && utilities::KokkosUtilities::PetscThreadSafe();
     PetscFVSetFromOptions(gradientCalculator) >> checkError;
     PetscFVSetNumComponents(gradientCalculator, 1) >> checkError;
     PetscFVSetSpatialDimension(gradientCalculator, subDomain->GetDimensions()) >> checkError;
@@ -292,6 +299,34 @@ void ablate::boundarySolver::BoundarySolver::Setup() {
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
     VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
 }
+void ablate::boundarySolver::BoundarySolver::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) {
+    CellSolver::AccumulateMemoryUsage(memoryUsage);
+
+    const auto prefix = GetSolverId() + "::";
+    const auto stencilName = prefix + "boundaryStencil";
+    memoryUsage.Add(stencilName, gradientStencils);
+    for (const auto& stencil : gradientStencils) {
+        memoryUsage.Add(stencilName, stencil.stencil);
+        memoryUsage.Add(stencilName, stencil.gradientWeights);
+        memoryUsage.Add(stencilName, stencil.distributionWeights);
+        memoryUsage.Add(stencilName, stencil.volumes);
+    }
+    memoryUsage.Add(stencilName, packedStencils.offsets);
+    memoryUsage.Add(stencilName, packedStencils.points);
+    memoryUsage.Add(stencilName, packedStencils.gradientWeights);
+    memoryUsage.Add(stencilName, packedStencils.cellSolutionOffsets);
+    memoryUsage.Add(stencilName, packedStencils.cellAuxOffsets);
+    memoryUsage.Add(stencilName, packedStencils.cellGeometryOffsets);
+    memoryUsage.Add(stencilName, packedStencils.solutionOffsets);
+    memoryUsage.Add(stencilName, packedStencils.auxOffsets);
+    memoryUsage.Add(stencilName, packedStencils.solutionValues);
+    memoryUsage.Add(stencilName, packedStencils.auxValues);
+
+    for (const auto& process : boundaryProcesses) {
+        process->AccumulateMemoryUsage(memoryUsage, prefix);
+    }
+}
+
 void ablate::boundarySolver::BoundarySolver::Initialize() {
     if (!boundaryUpdateFunctions.empty()) {
         RegisterPreStep([this](auto ts, auto& solver) { UpdateVariablesPreStep(ts, solver); });
@@ -301,11 +336,103 @@ void ablate::boundarySolver::BoundarySolver::Initialize() {
     for (auto& process : boundaryProcesses) {
         process->Initialize(*this);
     }
+
+    // the local sections are now available to pack the stencils
+    PackGradientStencils();
+}
+
+void ablate::boundarySolver::BoundarySolver::PackGradientStencils() {
+    auto dm = subDomain->GetDM();
+    auto auxDM = subDomain->GetAuxDM();
+    auto dim = subDomain->GetDimensions();
+    DM dmCell;
+    VecGetDM(cellGeomVec, &dmCell) >> checkError;
+
+    // the local offsets are the same offsets used by DMPlexPointLocalRead
+    PetscSection section, auxSection = nullptr, cellGeomSection;
+    DMGetLocalSection(dm, &section) >> checkError;
+    if (auxDM) {
+        DMGetLocalSection(auxDM, &auxSection) >> checkError;
+    }
+    DMGetLocalSection(dmCell, &cellGeomSection) >> checkError;
+
+    // size up the packed arrays
+    std::size_t numberEntries = 0;
+    for (const auto& stencil : gradientStencils) {
+        numberEntries += stencil.stencilSize;
+    }
+    packedStencils = PackedStencils{};
+    packedStencils.offsets.reserve(gradientStencils.size() + 1);
+    packedStencils.points.reserve(numberEntries);
+    packedStencils.gradientWeights.reserve(numberEntries * dim);
+    packedStencils.solutionOffsets.reserve(numberEntries);
+    packedStencils.auxOffsets.reserve(numberEntries);
+
+    // the face sources are computed into a [face*scratchSize] array before being distributed
+    PetscInt scratchSize;
+    PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &scratchSize) >> checkError;
+    std::vector<DistributionOperator::Entry> distributionEntries;
+    distributionEntries.reserve(numberEntries);
+    std::vector<DistributionOperator::Entry> fluxEntries;
+    fluxEntries.reserve(gradientStencils.size());
+
+    packedStencils.offsets.push_back(0);
+    for (const auto& stencil : gradientStencils) {
+        const auto faceSourceOffset = (PetscInt)(packedStencils.offsets.size() - 1) * scratchSize;
+        PetscInt offset = 0;
+        PetscSectionGetOffset(section, stencil.cellId, &offset) >> checkError;
+        packedStencils.cellSolutionOffsets.push_back(offset);
+        if (auxSection) {
+            PetscSectionGetOffset(auxSection, stencil.cellId, &offset) >> checkError;
+        }
+        packedStencils.cellAuxOffsets.push_back(auxSection ? offset : 0);
+        PetscSectionGetOffset(cellGeomSection, stencil.cellId, &offset) >> checkError;
+        packedStencils.cellGeometryOffsets.push_back(offset);
+
+        for (PetscInt s = 0; s < stencil.stencilSize; ++s) {
+            packedStencils.points.push_back(stencil.stencil[s]);
+
+            PetscSectionGetOffset(section, stencil.stencil[s], &offset) >> checkError;
+            packedStencils.solutionOffsets.push_back(offset);
+            distributionEntries.push_back({.rowOffset = offset, .columnOffset = faceSourceOffset, .weight = stencil.distributionWeights[s] / stencil.volumes[s]});
+
+            // the first cell in the stencil is always the neighbor cell
+            if (s == 0) {
+                fluxEntries.push_back({.rowOffset = offset, .columnOffset = faceSourceOffset, .weight = 1.0 / stencil.volumes[s]});
+            }
+            if (auxSection) {
+                PetscSectionGetOffset(auxSection, stencil.stencil[s], &offset) >> checkError;
+            }
+            packedStencils.auxOffsets.push_back(auxSection ? offset : 0);
+        }
+        packedStencils.gradientWeights.insert(packedStencils.gradientWeights.end(), stencil.gradientWeights.begin(), stencil.gradientWeights.begin() + stencil.stencilSize * dim);
+        packedStencils.offsets.push_back((PetscInt)packedStencils.points.size());
+    }
+
+    distributionOperator = DistributionOperator(std::move(distributionEntries));
+    fluxOperator = DistributionOperator(std::move(fluxEntries));
+
+    // the pointer scratch space is reused for every rhs evaluation
+    packedStencils.solutionValues.resize(numberEntries, nullptr);
+    packedStencils.auxValues.resize(numberEntries, nullptr);
+
+    // color the faces for threaded evaluation so that no two faces of a color write to the same boundary cell, stencil point, or face
+    if (threadedRHS) {
+        std::vector<std::vector<PetscInt>> facePoints;
+        facePoints.reserve(gradientStencils.size());
+        for (const auto& stencil : gradientStencils) {
+            auto& points = facePoints.emplace_back(stencil.stencil);
+            points.push_back(stencil.cellId);
+            points.push_back(stencil.geometry.faceId);
+        }
+        faceColoring = std::make_unique<finiteVolume::FaceColoring>(facePoints);
+    }
 }
 void ablate::boundarySolver::BoundarySolver::RegisterFunction(ablate::boundarySolver::BoundarySolver::BoundarySourceFunction function, void* context, const std::vector<std::string>& sourceFields,
-                                                              const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields, BoundarySourceType type) {
+                                                              const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields, BoundarySourceType type, bool implicit,
+                                                              bool threadSafe) {
     // Create the FVMRHS Function
-    BoundarySourceFunctionDescription functionDescription{.function = function, .context = context, .type = type};
+    BoundarySourceFunctionDescription functionDescription{.function = function, .context = context, .type = type, .threadSafe = threadSafe};
 
     for (auto& inputField : inputFields) {
         auto& inputFieldId = subDomain->GetField(inputField);
@@ -318,6 +445,10 @@ void ablate::boundarySolver::BoundarySolver::RegisterFunction(ablate::boundarySo
     }
 
     if (type == BoundarySourceType::Face) {
+        if (implicit) {
+            throw std::invalid_argument("Face based boundary functions are only used for output and cannot be implicit in " + GetSolverId());
+        }
+
         // add to the outputComponents list for output later
         for (const auto& sourceField : sourceFields) {
             auto componentLoc = find(outputComponents.begin(), outputComponents.end(), sourceField);
@@ -328,7 +459,7 @@ void ablate::boundarySolver::BoundarySolver::RegisterFunction(ablate::boundarySo
                 outputComponents.push_back(sourceField);
             } else {
                 // it was found, just add component
-                functionDescription.sourceFieldsOffset.push_back((PetscInt)std::distance(componentLoc, outputComponents.begin()));
+                functionDescription.sourceFieldsOffset.push_back((PetscInt)std::distance(outputComponents.begin(), componentLoc));
             }
         }
 
@@ -340,7 +471,11 @@ void ablate::boundarySolver::BoundarySolver::RegisterFunction(ablate::boundarySo
             functionDescription.sourceFieldsOffset.push_back(fieldId.offset);
         }
 
-        boundarySourceFunctions.push_back(functionDescription);
+        if (implicit) {
+            implicitBoundarySourceFunctions.push_back(functionDescription);
+        } else {
+            boundarySourceFunctions.push_back(functionDescription);
+        }
     }
 }
 
@@ -367,10 +502,23 @@ void ablate::boundarySolver::BoundarySolver::RegisterFunction(ablate::boundarySo
  */
 void ablate::boundarySolver::BoundarySolver::RegisterPreRHSFunction(BoundaryPreRHSFunctionDefinition function, void* context) { preRhsFunctions.emplace_back(function, context); }
 
+void ablate::boundarySolver::BoundarySolver::RegisterPostRHSFunction(BoundaryPostRHSFunctionDefinition function, void* context) { postRhsFunctions.emplace_back(function, context); }
+
+PetscErrorCode ablate::boundarySolver::BoundarySolver::PostRHSFunction() {
+    PetscFunctionBeginUser;
+    for (const auto& postRhsFunction : postRhsFunctions) {
+        PetscCall(postRhsFunction.first(*this, postRhsFunction.second));
+    }
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) {
     PetscFunctionBeginUser;
     StartEvent("BoundarySolver::ComputeRHSFunction");
     PetscCall(ComputeRHSFunction(time, locXVec, locFVec, boundarySourceFunctions));
+
+    // the state cached by the pre rhs functions is only valid for this evaluation
+    PetscCall(PostRHSFunction());
     EndEvent();
     PetscFunctionReturn(0);
 }
@@ -400,10 +548,10 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
         PetscCall(PetscDSGetComponentOffsets(auxDS, &auxOffTotal));
     }
 
-    // Get the size of the field
+    // Get the size of the field, the distributed and flux sources of every face are stored before being applied with the operators
     PetscInt scratchSize;
     PetscCall(PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &scratchSize));
-    std::vector<PetscScalar> distributedSourceScratch(scratchSize);
+    std::vector<PetscScalar> faceSourceScratch;
 
     // Get the region to march over
     if (!gradientStencils.empty()) {
@@ -416,178 +564,294 @@ PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeRHSFunction(PetscR
         }
         PetscCall(VecGetArray(locFVec, &locFArray));
 
-        // Store pointers to the stencil variables
-        std::vector<const PetscScalar*> inputStencilValues(maximumStencilSize);
-        std::vector<const PetscScalar*> auxStencilValues(maximumStencilSize);
+        // Get the vec DM from the locFArray for face sources
+        DM vecDm;
+        PetscCall(VecGetDM(locFVec, &vecDm));
 
-        // March over each boundary function
-        for (const auto& function : activeBoundarySourceFunctions) {
+        // Set the pointers to every stencil value once for all functions
+        const auto& offsets = packedStencils.offsets;
+        const auto numberEntries = (PetscInt)packedStencils.points.size();
+        for (PetscInt e = 0; e < numberEntries; ++e) {
+            packedStencils.solutionValues[e] = locXArray + packedStencils.solutionOffsets[e];
+        }
+        if (auxDM) {
+            for (PetscInt e = 0; e < numberEntries; ++e) {
+                packedStencils.auxValues[e] = locAuxArray + packedStencils.auxOffsets[e];
+            }
+        }
+
+        // helper lambda to compute the source for a single face.  Only the rhs of the boundary cell and face or the face source scratch are written.
+        auto computeFaceSource = [&](const BoundarySourceFunctionDescription& function, std::size_t f) -> PetscErrorCode {
+            PetscFunctionBeginUser;
             auto sourceOffsetsPointer = function.sourceFieldsOffset.data();
             auto inputOffsetsPointer = function.inputFieldsOffset.data();
             auto auxOffsetsPointer = function.auxFieldsOffset.data();
 
-            // March over each cell in this region
-            for (const auto& stencilInfo : gradientStencils) {
-                // Get the cell geom
-                const PetscFVCellGeom* cg;
-                PetscCall(DMPlexPointLocalRead(dmCell, stencilInfo.cellId, cellGeomArray, &cg));
+            const auto& stencilInfo = gradientStencils[f];
+            const auto entry = offsets[f];
+            const auto stencilSize = offsets[f + 1] - entry;
+
+            // Get the cell geom and the pointers to the area of interest
+            const auto cg = (const PetscFVCellGeom*)(cellGeomArray + packedStencils.cellGeometryOffsets[f]);
+            const PetscScalar* solPt = locXArray + packedStencils.cellSolutionOffsets[f];
+            const PetscScalar* auxPt = auxDM ? locAuxArray + packedStencils.cellAuxOffsets[f] : nullptr;
+
+            // Get each of the stencil pts
+            const PetscScalar** inputStencilValues = packedStencils.solutionValues.data() + entry;
+            const PetscScalar** auxStencilValues = packedStencils.auxValues.data() + entry;
+            const PetscInt* stencilPoints = packedStencils.points.data() + entry;
+            const PetscScalar* gradientWeights = packedStencils.gradientWeights.data() + entry * dim;
+
+            // Get the pointer to the rhs
+            PetscScalar* source;
+            switch (function.type) {
+                case BoundarySourceType::Point:
+                    source = locFArray + packedStencils.cellSolutionOffsets[f];
+                    break;
+                case BoundarySourceType::Face:
+                    // Assume that the right hand side vector is for face information
+                    PetscCall(DMPlexPointLocalRef(vecDm, stencilInfo.geometry.faceId, locFArray, &source));
+                    break;
+                default:
+                    // the face source is distributed after all faces are computed
+                    source = faceSourceScratch.data() + f * scratchSize;
+            }
 
-                // Get pointers to the area of interest
-                const PetscScalar *solPt, *auxPt = nullptr;
-                PetscCall(DMPlexPointLocalRead(dm, stencilInfo.cellId, locXArray, &solPt));
-                if (auxDM) {
-                    PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.cellId, locAuxArray, &auxPt));
+            /*PetscErrorCode (*)(PetscInt dim, const BoundaryFVFaceGeom* fg, const PetscFVCellGeom* boundaryCell,
+                               const PetscInt uOff[], const PetscScalar* boundaryValues, const PetscScalar* stencilValues[],
+                               const PetscInt aOff[], const PetscScalar* auxValues, const PetscScalar* stencilAuxValues[],
+                               PetscInt stencilSize, const PetscInt stencil[], const PetscScalar stencilWeights[], const PetscInt sOff[], PetscScalar source[], void* ctx)*/
+            PetscCall(function.function(dim,
+                                        &stencilInfo.geometry,
+                                        cg,
+                                        inputOffsetsPointer,
+                                        solPt,
+                                        inputStencilValues,
+                                        auxOffsetsPointer,
+                                        auxPt,
+                                        auxStencilValues,
+                                        stencilSize,
+                                        stencilPoints,
+                                        gradientWeights,
+                                        sourceOffsetsPointer,
+                                        source,
+                                        function.context));
+
+            PetscFunctionReturn(0);
+        };
+
+        // March over each boundary function
+        for (const auto& function : activeBoundarySourceFunctions) {
+            const bool distributeSource = function.type == BoundarySourceType::Distributed || function.type == BoundarySourceType::Flux;
+            if (distributeSource) {
+                faceSourceScratch.assign(gradientStencils.size() * scratchSize, 0.0);
+            }
+
+            if (faceColoring && function.threadSafe) {
+                // faces with the same color do not share a boundary cell or stencil point, so they can be computed concurrently
+                try {
+                    faceColoring->ForEach([&](std::size_t f, std::size_t) { computeFaceSource(function, f) >> checkError; });
+                } catch (std::exception& exception) {
+                    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in threaded BoundarySolver::ComputeRHSFunction: %s", exception.what());
                 }
+            } else {
+                // March over each cell in this region
+                for (std::size_t f = 0; f < gradientStencils.size(); ++f) {
+                    PetscCall(computeFaceSource(function, f));
+                }
+            }
 
-                // Get each of the stencil pts
-                for (PetscInt p = 0; p < stencilInfo.stencilSize; p++) {
-                    PetscCall(DMPlexPointLocalRead(dm, stencilInfo.stencil[p], locXArray, &inputStencilValues[p]));
-                    if (auxDM) {
-                        PetscCall(DMPlexPointLocalRead(auxDM, stencilInfo.stencil[p], locAuxArray, &auxStencilValues[p]));
-                    }
+            // Now distribute the face sources to each stencil point with a single sparse product.  It might be ghost but that is ok, the values are added together later
+            if (function.type == BoundarySourceType::Distributed) {
+                distributionOperator.Apply(faceSourceScratch.data(), locFArray, scratchSize);
+            } else if (function.type == BoundarySourceType::Flux) {
+                fluxOperator.Apply(faceSourceScratch.data(), locFArray, scratchSize);
+            }
+        }
+
+        // clean up access
+        PetscCall(VecRestoreArrayRead(locXVec, &locXArray));
+        if (auto locAuxVec = subDomain->GetAuxVector()) {
+            PetscCall(VecRestoreArrayRead(locAuxVec, &locAuxArray));
+        }
+        PetscCall(VecRestoreArray(locFVec, &locFArray));
+
+        // clean up the geom
+        PetscCall(VecRestoreArrayRead(cellGeomVec, &cellGeomArray));
+    }
+
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeIFunction(PetscReal time, Vec locX, Vec locX_t, Vec locF) {
+    PetscFunctionBeginUser;
+    StartEvent("BoundarySolver::ComputeIFunction");
+
+    // the implicit function is evaluated at a different state than the last pre rhs function
+    PetscCall(PostRHSFunction());
+
+    // add X_t for every boundary cell owned by this rank
+    PetscCall(AddTimeDerivative(locX_t, locF));
+
+    // the implicit sources are computed into a separate local vector and subtracted, F = X_t - S(X)
+    if (!implicitBoundarySourceFunctions.empty()) {
+        Vec locSourceVec;
+        PetscCall(DMGetLocalVector(subDomain->GetDM(), &locSourceVec));
+        PetscCall(VecZeroEntries(locSourceVec));
+        PetscCall(ComputeRHSFunction(time, locX, locSourceVec, implicitBoundarySourceFunctions));
+        PetscCall(VecAXPY(locF, -1.0, locSourceVec));
+        PetscCall(DMRestoreLocalVector(subDomain->GetDM(), &locSourceVec));
+    }
+    EndEvent();
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::boundarySolver::BoundarySolver::ComputeIJacobian(PetscReal time, Vec locX, Vec, PetscReal X_tShift, Mat, Mat JacP) {
+    PetscFunctionBeginUser;
+    StartEvent("BoundarySolver::ComputeIJacobian");
+
+    // the cached pre rhs state does not follow the perturbed values, so the boundary functions must compute it from the values they are passed
+    PetscCall(PostRHSFunction());
+
+    // add the X_tShift to the diagonal of every boundary cell owned by this rank
+    PetscCall(AddTimeDerivativeShift(X_tShift, JacP));
+
+    if (!implicitBoundarySourceFunctions.empty() && !gradientStencils.empty()) {
+        auto auxDM = subDomain->GetAuxDM();
+        auto dim = subDomain->GetDimensions();
+        const PetscScalar* cellGeomArray;
+        PetscCall(VecGetArrayRead(cellGeomVec, &cellGeomArray));
+
+        // the rows and columns for unowned points are decoded from the global section, the values are communicated during assembly
+        PetscSection globalSection;
+        PetscCall(DMGetGlobalSection(subDomain->GetDM(), &globalSection));
+        PetscInt totDim;
+        PetscCall(PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &totDim));
+
+        const PetscScalar *locXArray, *locAuxArray = nullptr;
+        PetscCall(VecGetArrayRead(locX, &locXArray));
+        if (auto locAuxVec = subDomain->GetAuxVector()) {
+            PetscCall(VecGetArrayRead(locAuxVec, &locAuxArray));
+        }
+
+        // the boundary stencils can reach past the face neighbors used to preallocate the matrix
+        PetscCall(MatSetOption(JacP, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE));
+
+        // scratch space reused for every face
+        std::vector<PetscScalar> baseSource(totDim), perturbedSource(totDim), perturbedValues(totDim), sourceDerivative(totDim * totDim), jacobianBlock(totDim * totDim);
+        std::vector<PetscInt> rowIndices(totDim), columnIndices(totDim);
+        std::vector<const PetscScalar*> stencilValues(maximumStencilSize), stencilAuxValues(maximumStencilSize);
+        std::vector<std::pair<PetscInt, PetscScalar>> targets;
+        targets.reserve(maximumStencilSize);
+
+        // the rows and columns of a cell block are decoded from the global section
+        auto getBlockIndices = [&](PetscInt cell, std::vector<PetscInt>& indices) -> PetscErrorCode {
+            PetscFunctionBeginUser;
+            PetscInt globalOffset;
+            PetscCall(PetscSectionGetOffset(globalSection, cell, &globalOffset));
+            globalOffset = globalOffset < 0 ? -(globalOffset + 1) : globalOffset;
+            for (PetscInt i = 0; i < totDim; ++i) {
+                indices[i] = globalOffset + i;
+            }
+            PetscFunctionReturn(0);
+        };
+
+        for (const auto& function : implicitBoundarySourceFunctions) {
+            for (std::size_t f = 0; f < gradientStencils.size(); ++f) {
+                const auto& stencilInfo = gradientStencils[f];
+                const auto entry = packedStencils.offsets[f];
+                const auto stencilSize = packedStencils.offsets[f + 1] - entry;
+                if (!stencilSize) {
+                    continue;
                 }
 
-                // Get the pointer to the rhs
+                const auto cg = (const PetscFVCellGeom*)(cellGeomArray + packedStencils.cellGeometryOffsets[f]);
+                const PetscScalar* solPt = locXArray + packedStencils.cellSolutionOffsets[f];
+                const PetscScalar* auxPt = auxDM ? locAuxArray + packedStencils.cellAuxOffsets[f] : nullptr;
+                for (PetscInt s = 0; s < stencilSize; ++s) {
+                    stencilValues[s] = locXArray + packedStencils.solutionOffsets[entry + s];
+                    stencilAuxValues[s] = auxDM ? locAuxArray + packedStencils.auxOffsets[entry + s] : nullptr;
+                }
+
+                // evaluate the source for the current boundary and stencil values
+                auto evaluateSource = [&](const PetscScalar* boundaryValues, PetscScalar* source) -> PetscErrorCode {
+                    PetscFunctionBeginUser;
+                    PetscCall(PetscArrayzero(source, totDim));
+                    PetscCall(function.function(dim,
+                                                &stencilInfo.geometry,
+                                                cg,
+                                                function.inputFieldsOffset.data(),
+                                                boundaryValues,
+                                                stencilValues.data(),
+                                                function.auxFieldsOffset.data(),
+                                                auxPt,
+                                                stencilAuxValues.data(),
+                                                stencilSize,
+                                                packedStencils.points.data() + entry,
+                                                packedStencils.gradientWeights.data() + entry * dim,
+                                                function.sourceFieldsOffset.data(),
+                                                source,
+                                                function.context));
+                    PetscFunctionReturn(0);
+                };
+                PetscCall(evaluateSource(solPt, baseSource.data()));
+
+                // the source is written to the boundary cell (Point), the neighbor cell (Flux), or every stencil cell (Distributed)
+                targets.clear();
                 switch (function.type) {
                     case BoundarySourceType::Point:
-                        PetscScalar* rhs;
-                        PetscCall(DMPlexPointLocalRef(dm, stencilInfo.cellId, locFArray, &rhs));
-
-                        /*PetscErrorCode (*)(PetscInt dim, const BoundaryFVFaceGeom* fg, const PetscFVCellGeom* boundaryCell,
-                                           const PetscInt uOff[], const PetscScalar* boundaryValues, const PetscScalar* stencilValues[],
-                                           const PetscInt aOff[], const PetscScalar* auxValues, const PetscScalar* stencilAuxValues[],
-                                           PetscInt stencilSize, const PetscInt stencil[], const PetscScalar stencilWeights[], const PetscInt sOff[], PetscScalar source[], void* ctx)*/
-                        PetscCall(function.function(dim,
-                                                    &stencilInfo.geometry,
-                                                    cg,
-                                                    inputOffsetsPointer,
-                                                    solPt,
-                                                    inputStencilValues.data(),
-                                                    auxOffsetsPointer,
-                                                    auxPt,
-                                                    auxStencilValues.data(),
-                                                    stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
-                                                    sourceOffsetsPointer,
-                                                    rhs,
-                                                    function.context));
-                        break;
-                    case BoundarySourceType::Distributed:
-                        /*PetscErrorCode (*)(PetscInt dim, const BoundaryFVFaceGeom* fg, const PetscFVCellGeom* boundaryCell,
-                                                                   const PetscInt uOff[], const PetscScalar* boundaryValues, const PetscScalar* stencilValues[],
-                                                                   const PetscInt aOff[], const PetscScalar* auxValues, const PetscScalar* stencilAuxValues[],
-                                                                   PetscInt stencilSize, const PetscInt stencil[], const PetscScalar stencilWeights[], const PetscInt sOff[], PetscScalar source[],
-                           void* ctx)*/
-
-                        // zero out the distributedSourceScratch
-                        PetscCall(PetscArrayzero(distributedSourceScratch.data(), (PetscInt)distributedSourceScratch.size()));
-
-                        PetscCall(function.function(dim,
-                                                    &stencilInfo.geometry,
-                                                    cg,
-                                                    inputOffsetsPointer,
-                                                    solPt,
-                                                    inputStencilValues.data(),
-                                                    auxOffsetsPointer,
-                                                    auxPt,
-                                                    auxStencilValues.data(),
-                                                    stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
-                                                    sourceOffsetsPointer,
-                                                    distributedSourceScratch.data(),
-                                                    function.context));
-
-                        // Now distribute to each stencil point
-                        for (PetscInt s = 0; s < stencilInfo.stencilSize; ++s) {
-                            // Get the point in the rhs for this point.  It might be ghost but that is ok, the values are added together later
-                            PetscCall(DMPlexPointLocalRef(dm, stencilInfo.stencil[s], locFArray, &rhs));
-
-                            // Now over the entire rhs, the function should have added the values correctly using the sourceOffsetsPointer
-                            for (PetscInt sc = 0; sc < scratchSize; sc++) {
-                                rhs[sc] += (distributedSourceScratch[sc] * stencilInfo.distributionWeights[s]) / stencilInfo.volumes[s];
-                            }
-                        }
-
+                        targets.emplace_back(stencilInfo.cellId, 1.0);
                         break;
                     case BoundarySourceType::Flux:
-                        // zero out the distributedSourceScratch
-                        PetscCall(PetscArrayzero(distributedSourceScratch.data(), (PetscInt)distributedSourceScratch.size()));
-
-                        PetscCall(function.function(dim,
-                                                    &stencilInfo.geometry,
-                                                    cg,
-                                                    inputOffsetsPointer,
-                                                    solPt,
-                                                    inputStencilValues.data(),
-                                                    auxOffsetsPointer,
-                                                    auxPt,
-                                                    auxStencilValues.data(),
-                                                    stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
-                                                    sourceOffsetsPointer,
-                                                    distributedSourceScratch.data(),
-                                                    function.context));
-
-                        // the first cell in the stencil is always the neighbor cell
-                        // Get the point in the rhs for this point.  It might be ghost but that is ok, the values are added together later
-                        PetscCall(DMPlexPointLocalRef(dm, stencilInfo.stencil.front(), locFArray, &rhs));
-
-                        // Now over the entire rhs, the function should have added the values correctly using the sourceOffsetsPointer
-                        for (PetscInt sc = 0; sc < scratchSize; sc++) {
-                            rhs[sc] += distributedSourceScratch[sc] / stencilInfo.volumes.front();
+                        targets.emplace_back(packedStencils.points[entry], 1.0 / stencilInfo.volumes[0]);
+                        break;
+                    default:
+                        for (PetscInt s = 0; s < stencilSize; ++s) {
+                            targets.emplace_back(packedStencils.points[entry + s], stencilInfo.distributionWeights[s] / stencilInfo.volumes[s]);
                         }
+                }
 
-                        break;
+                // the source depends upon the boundary cell (input -1) and every stencil cell, so perturb each input and add the coupling to every target, dF/dX = -dS/dX
+                for (PetscInt input = -1; input < stencilSize; ++input) {
+                    const PetscScalar* values = input < 0 ? solPt : stencilValues[input];
+                    PetscCall(PetscArraycpy(perturbedValues.data(), values, totDim));
+                    if (input >= 0) {
+                        stencilValues[input] = perturbedValues.data();
+                    }
+                    for (PetscInt j = 0; j < totDim; ++j) {
+                        const PetscReal h = PETSC_SQRT_MACHINE_EPSILON * PetscMax(PetscAbsScalar(values[j]), 1.0);
+                        perturbedValues[j] = values[j] + h;
+                        PetscCall(evaluateSource(input < 0 ? perturbedValues.data() : solPt, perturbedSource.data()));
+                        for (PetscInt i = 0; i < totDim; ++i) {
+                            sourceDerivative[i * totDim + j] = (perturbedSource[i] - baseSource[i]) / h;
+                        }
+                        perturbedValues[j] = values[j];
+                    }
+                    if (input >= 0) {
+                        stencilValues[input] = values;
+                    }
 
-                    case BoundarySourceType::Face:
-                        // Get the vec DM from the locFArray
-                        DM vecDm;
-                        PetscCall(VecGetDM(locFVec, &vecDm));
-
-                        // Assume that the right hand side vector is for face information
-                        PetscScalar* faceRhs;
-                        PetscCall(DMPlexPointLocalRef(vecDm, stencilInfo.geometry.faceId, locFArray, &faceRhs));
-
-                        /*PetscErrorCode (*)(PetscInt dim, const BoundaryFVFaceGeom* fg, const PetscFVCellGeom* boundaryCell,
-                                           const PetscInt uOff[], const PetscScalar* boundaryValues, const PetscScalar* stencilValues[],
-                                           const PetscInt aOff[], const PetscScalar* auxValues, const PetscScalar* stencilAuxValues[],
-                                           PetscInt stencilSize, const PetscInt stencil[], const PetscScalar stencilWeights[], const PetscInt sOff[], PetscScalar source[], void* ctx)*/
-                        PetscCall(function.function(dim,
-                                                    &stencilInfo.geometry,
-                                                    cg,
-                                                    inputOffsetsPointer,
-                                                    solPt,
-                                                    inputStencilValues.data(),
-                                                    auxOffsetsPointer,
-                                                    auxPt,
-                                                    auxStencilValues.data(),
-                                                    stencilInfo.stencilSize,
-                                                    stencilInfo.stencil.data(),
-                                                    stencilInfo.gradientWeights.data(),
-                                                    sourceOffsetsPointer,
-                                                    faceRhs,
-                                                    function.context));
-                        break;
+                    PetscCall(getBlockIndices(input < 0 ? stencilInfo.cellId : packedStencils.points[entry + input], columnIndices));
+                    for (const auto& [cell, weight] : targets) {
+                        for (PetscInt i = 0; i < totDim * totDim; ++i) {
+                            jacobianBlock[i] = -weight * sourceDerivative[i];
+                        }
+                        PetscCall(getBlockIndices(cell, rowIndices));
+                        PetscCall(MatSetValues(JacP, totDim, rowIndices.data(), totDim, columnIndices.data(), jacobianBlock.data(), ADD_VALUES));
+                    }
                 }
             }
         }
 
-        // clean up access
-        PetscCall(VecRestoreArrayRead(locXVec, &locXArray));
+        PetscCall(VecRestoreArrayRead(locX, &locXArray));
         if (auto locAuxVec = subDomain->GetAuxVector()) {
             PetscCall(VecRestoreArrayRead(locAuxVec, &locAuxArray));
         }
-        PetscCall(VecRestoreArray(locFVec, &locFArray));
-
-        // clean up the geom
         PetscCall(VecRestoreArrayRead(cellGeomVec, &cellGeomArray));
     }
-
+    EndEvent();
     PetscFunctionReturn(0);
 }
+
 void ablate::boundarySolver::BoundarySolver::InsertFieldFunctions(const std::vector<std::shared_ptr<mathFunctions::FieldFunction>>& fieldFunctions, PetscReal time) {
     for (const auto& fieldFunction : fieldFunctions) {
         // Get the field
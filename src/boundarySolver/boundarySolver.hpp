@@ -2,7 +2,10 @@
 #define ABLATELIBRARY_BOUNDARYSOLVER_HPP
 
 #include <memory>
+#include "distributionOperator.hpp"
+#include "finiteVolume/faceColoring.hpp"
 #include "solver/cellSolver.hpp"
+#include "solver/iFunction.hpp"
 #include "solver/timeStepper.hpp"
 
 namespace ablate::boundarySolver {
@@ -10,7 +13,7 @@ namespace ablate::boundarySolver {
 // forward declare the boundaryProcess
 class BoundaryProcess;
 
-class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, private utilities::Loggable<BoundarySolver> {
+class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, public solver::IFunction, private utilities::Loggable<BoundarySolver> {
    public:
     /**
      * Boundary information.
@@ -37,6 +40,12 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      */
     using BoundaryPreRHSFunctionDefinition = PetscErrorCode (*)(BoundarySolver&, TS ts, PetscReal time, bool initialStage, Vec locX, void* ctx);
 
+    /**
+     * Called after each rhs evaluation and before each implicit function/jacobian evaluation.  Any state cached by a pre rhs function is only valid for the rhs
+     * evaluation that follows it and must be invalidated here.
+     */
+    using BoundaryPostRHSFunctionDefinition = PetscErrorCode (*)(BoundarySolver&, void* ctx);
+
     /**
      * Boundaries can be treated in two different ways, point source on the boundary or distributed in the other phase.  For the Distributed model, the source is divided by volume in each case
      */
@@ -47,6 +56,22 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
         Face         /** the face location of the rhs array is directly passed to the function, this is only useful/called for io **/
     };
 
+    /**
+     * struct to describe how to compute the source terms for boundary
+     */
+    struct BoundarySourceFunctionDescription {
+        BoundarySourceFunction function;
+        void* context;
+        BoundarySourceType type;
+
+        std::vector<PetscInt> sourceFieldsOffset;
+        std::vector<PetscInt> inputFieldsOffset;
+        std::vector<PetscInt> auxFieldsOffset;
+
+        //! true if the function and context can be called concurrently, otherwise the faces are computed serially even when threaded
+        bool threadSafe = false;
+    };
+
     /**
      * public helper function to compute the gradient
      * @param dim
@@ -90,16 +115,27 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
     };
 
     /**
-     * struct to describe how to compute the source terms for boundary
+     * The gradient stencils packed into flat compressed sparse row (CSR) arrays so the rhs evaluation can march over contiguous memory.  The stencil entries for face f are
+     * [offsets[f], offsets[f+1]).  The local array offsets are precomputed from the local sections so no point lookup is needed during the rhs evaluation.
      */
-    struct BoundarySourceFunctionDescription {
-        BoundarySourceFunction function;
-        void* context;
-        BoundarySourceType type;
-
-        std::vector<PetscInt> sourceFieldsOffset;
-        std::vector<PetscInt> inputFieldsOffset;
-        std::vector<PetscInt> auxFieldsOffset;
+    struct PackedStencils {
+        /** the start of each face in the stencil entries, size numberFaces + 1 **/
+        std::vector<PetscInt> offsets;
+        /** the stencil points **/
+        std::vector<PetscInt> points;
+        /** the gradient weights in [entry*dim + dir] order **/
+        std::vector<PetscScalar> gradientWeights;
+        /** the offset into the local solution and aux arrays for each boundary cell **/
+        std::vector<PetscInt> cellSolutionOffsets;
+        std::vector<PetscInt> cellAuxOffsets;
+        /** the offset into the cell geometry array for each boundary cell **/
+        std::vector<PetscInt> cellGeometryOffsets;
+        /** the offset into the local solution and aux arrays for each stencil entry **/
+        std::vector<PetscInt> solutionOffsets;
+        std::vector<PetscInt> auxOffsets;
+        /** scratch space for the stencil value pointers, sized to the number of stencil entries **/
+        std::vector<const PetscScalar*> solutionValues;
+        std::vector<const PetscScalar*> auxValues;
     };
 
     /**
@@ -119,6 +155,9 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
     // hold the update functions for flux and point sources
     std::vector<BoundarySourceFunctionDescription> boundarySourceFunctions;
 
+    // the sources integrated implicitly through the ts implicit function, F(t, X, X_t) = X_t - S(X)
+    std::vector<BoundarySourceFunctionDescription> implicitBoundarySourceFunctions;
+
     // boundary output functions that can be used for
     std::vector<BoundarySourceFunctionDescription> boundaryOutputFunctions;
 
@@ -134,6 +173,9 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
     // allow the use of any arbitrary pre rhs functions
     std::vector<std::pair<BoundaryPreRHSFunctionDefinition, void*>> preRhsFunctions;
 
+    // invalidate the state cached by the pre rhs functions
+    std::vector<std::pair<BoundaryPostRHSFunctionDefinition, void*>> postRhsFunctions;
+
    protected:
     // Hold a list of GradientStencils, this order corresponds to the face order
     std::vector<GradientStencil> gradientStencils;
@@ -142,6 +184,21 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
     // keep track of maximumStencilSize
     PetscInt maximumStencilSize = 0;
 
+    // the gradientStencils packed for the rhs evaluation
+    PackedStencils packedStencils;
+
+    // distributes the face sources (in [face*scratchSize] order) onto the local rhs of the stencil cells using distributionWeights/volume
+    DistributionOperator distributionOperator;
+
+    // adds the face fluxes (in [face*scratchSize] order) onto the local rhs of the neighbor cell using 1/volume
+    DistributionOperator fluxOperator;
+
+    // compute the boundary sources concurrently in the kokkos host execution space (set with -threadedRHS in the solver options).  Only functions registered as thread safe are computed concurrently.
+    bool threadedRHS = false;
+
+    // the optional coloring of the boundary faces used for threaded evaluation
+    std::unique_ptr<finiteVolume::FaceColoring> faceColoring;
+
     // The PetscFV (usually the least squares method) is used to compute the gradient weights
     PetscFV gradientCalculator = nullptr;
 
@@ -158,11 +215,21 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      */
     void CreateGradientStencil(PetscInt cellId, const BoundaryFVFaceGeom& geometry, const std::vector<PetscInt>& stencil, DM cellDM, const PetscScalar* cellGeomArray);
 
+    /**
+     * private function to pack the gradientStencils into the CSR layout once the local sections are available
+     */
+    void PackGradientStencils();
+
     /**
      * Prestep to update boundary variables
      */
     void UpdateVariablesPreStep(TS ts, ablate::solver::Solver&);
 
+    /**
+     * Call each of the post rhs functions to invalidate the state cached by the pre rhs functions
+     */
+    PetscErrorCode PostRHSFunction();
+
    public:
     /**
      *
@@ -180,13 +247,21 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
     void Setup() override;
     void Initialize() override;
 
+    /**
+     * Add the gradient stencils and the boundary process caches to the memory usage
+     * @param memoryUsage
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) override;
+
     /**
      * Register an arbitrary function.  The user is responsible for all work.  When registering face based functions the each sourceField is assumed to be a separate components in a single field
      * @param function
      * @param context
+     * @param implicit when true the source is added to the ts implicit function instead of the rhs.  The jacobian is approximated with finite differences of the boundary and stencil cell blocks.
+     * @param threadSafe true if the function and context can be called concurrently with -threadedRHS, otherwise it is always computed serially
      */
     void RegisterFunction(BoundarySourceFunction function, void* context, const std::vector<std::string>& sourceFields, const std::vector<std::string>& inputFields,
-                          const std::vector<std::string>& auxFields, BoundarySourceType type = BoundarySourceType::Point);
+                          const std::vector<std::string>& auxFields, BoundarySourceType type = BoundarySourceType::Point, bool implicit = false, bool threadSafe = false);
 
     /**
      * Register an update function.
@@ -202,6 +277,13 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      */
     void RegisterPreRHSFunction(BoundaryPreRHSFunctionDefinition function, void* context);
 
+    /**
+     * Register a post function that is called after each RHS function and before each implicit function/jacobian
+     * @param function
+     * @param context
+     */
+    void RegisterPostRHSFunction(BoundaryPostRHSFunctionDefinition function, void* context);
+
     /**
      * Function passed into PETSc to compute the FV RHS with all boundarySourceFunctions
      * @param time
@@ -211,6 +293,12 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      */
     PetscErrorCode ComputeRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) override;
 
+    /**
+     * The boundary source functions only add to the boundary cells and make no collective calls
+     * @return
+     */
+    [[nodiscard]] bool ConcurrentRHSFunction() const override { return true; }
+
     /**
      * Public function to allow arbitrary boundarySourceFunctions to be used for computation
      * @param time
@@ -221,6 +309,35 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      */
     PetscErrorCode ComputeRHSFunction(PetscReal time, Vec locXVec, Vec locFVec, const std::vector<BoundarySourceFunctionDescription>& boundarySourceFunctions);
 
+    /**
+     * Computes the implicit residual F(t, X, X_t) = X_t - S(X) for the boundary cells and the implicit boundary sources
+     * @param time
+     * @param locX
+     * @param locX_t
+     * @param locF
+     * @return
+     */
+    PetscErrorCode ComputeIFunction(PetscReal time, Vec locX, Vec locX_t, Vec locF) override;
+
+    /**
+     * Computes the jacobian X_tShift*I - dS/dX of the implicit residual.  Only the block of each written cell with respect to its own values is included, computed with finite differences of
+     * the implicit boundary sources.  Any dependence on the aux fields (e.g. temperature) is lagged at the last aux update.
+     * @param time
+     * @param locX
+     * @param locX_t
+     * @param X_tShift
+     * @param Jac
+     * @param JacP
+     * @return
+     */
+    PetscErrorCode ComputeIJacobian(PetscReal time, Vec locX, Vec locX_t, PetscReal X_tShift, Mat Jac, Mat JacP) override;
+
+    /**
+     * The implicit residual is only used when an implicit source has been registered
+     * @return
+     */
+    [[nodiscard]] bool HasIFunction() const override { return !implicitBoundarySourceFunctions.empty(); }
+
     /**
      * Helper function to project values to a cell boundary instead of the cell centroid
      */
@@ -236,6 +353,11 @@ class BoundarySolver : public solver::CellSolver, public solver::RHSFunction, pr
      */
     const std::vector<GradientStencil>& GetBoundaryGeometry() const { return gradientStencils; }
 
+    /**
+     * The operator assembled at initialization that distributes the face sources (in [face*totalDimension] order) onto the local rhs of each stencil cell
+     */
+    [[nodiscard]] const DistributionOperator& GetDistributionOperator() const { return distributionOperator; }
+
     /**
      * Get access to the output fields
      */
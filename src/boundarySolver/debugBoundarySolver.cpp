@@ -1,4 +1,5 @@
 #include "debugBoundarySolver.hpp"
+#include <petscviewerhdf5.h>
 #include <fstream>
 #include <set>
 #include "boundaryProcess.hpp"
@@ -7,8 +8,15 @@
 #include "utilities/mpiUtilities.hpp"
 
 ablate::boundarySolver::DebugBoundarySolver::DebugBoundarySolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<domain::Region> fieldBoundary,
-                                                                 std::vector<std::shared_ptr<BoundaryProcess>> boundaryProcesses, std::shared_ptr<parameters::Parameters> options, bool mergeFaces)
-    : BoundarySolver(solverId, region, fieldBoundary, boundaryProcesses, options, mergeFaces) {}
+                                                                 std::vector<std::shared_ptr<BoundaryProcess>> boundaryProcesses, std::shared_ptr<parameters::Parameters> options, bool mergeFaces,
+                                                                 bool binaryOutput)
+    : BoundarySolver(solverId, region, fieldBoundary, boundaryProcesses, options, mergeFaces), binaryOutput(binaryOutput) {}
+
+ablate::boundarySolver::DebugBoundarySolver::~DebugBoundarySolver() {
+    if (sourceViewer) {
+        PetscViewerDestroy(&sourceViewer) >> checkError;
+    }
+}
 
 void ablate::boundarySolver::DebugBoundarySolver::Setup() {
     BoundarySolver::Setup();
@@ -35,6 +43,17 @@ void ablate::boundarySolver::DebugBoundarySolver::Setup() {
     auto solverDirectory = ablate::environment::RunEnvironment::Get().GetOutputDirectory() / GetSolverId();
     ablate::utilities::MpiUtilities::Once(GetSubDomain().GetComm(), [solverDirectory] { create_directories(solverDirectory); });
 
+    // Get the rank
+    PetscMPIInt rank;
+    MPI_Comm_rank(GetSubDomain().GetComm(), &rank) >> checkError;
+
+    // the binary output writes every stencil to a single file and holds open a single file for the sources
+    if (binaryOutput) {
+        WriteBinaryStencils(solverDirectory, rank);
+        PetscViewerHDF5Open(PETSC_COMM_SELF, (solverDirectory / ("source_rank_" + std::to_string(rank) + ".h5")).c_str(), FILE_MODE_WRITE, &sourceViewer) >> checkError;
+        return;
+    }
+
     // Determine the header
     std::string header = "p";
     switch (GetSubDomain().GetDimensions()) {
@@ -49,10 +68,6 @@ void ablate::boundarySolver::DebugBoundarySolver::Setup() {
             break;
     }
 
-    // Get the rank
-    PetscMPIInt rank;
-    MPI_Comm_rank(GetSubDomain().GetComm(), &rank) >> checkError;
-
     // march over each stencil and create a separate file
     for (std::size_t s = 0; s < gradientStencils.size(); ++s) {
         const auto& stencil = gradientStencils[s];
@@ -77,6 +92,122 @@ void ablate::boundarySolver::DebugBoundarySolver::Setup() {
     }
 }
 
+void ablate::boundarySolver::DebugBoundarySolver::WriteBinaryStencils(const std::filesystem::path& solverDirectory, PetscMPIInt rank) {
+    const auto dim = GetSubDomain().GetDimensions();
+
+    // the offset of each face into the stencil rows
+    std::vector<PetscInt> offsets(1, 0);
+    stencilRows.clear();
+    for (const auto& stencil : gradientStencils) {
+        stencilRows.push_back(stencil.cellId);
+        stencilRows.insert(stencilRows.end(), stencil.stencil.begin(), stencil.stencil.begin() + stencil.stencilSize);
+        offsets.push_back((PetscInt)stencilRows.size());
+    }
+
+    // copy the centroid of each row
+    Vec centroidVec;
+    VecCreateSeq(PETSC_COMM_SELF, (PetscInt)stencilRows.size() * dim, &centroidVec) >> checkError;
+    VecSetBlockSize(centroidVec, dim) >> checkError;
+    PetscObjectSetName((PetscObject)centroidVec, "centroids") >> checkError;
+    const PetscScalar* cellGeomArray;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+    DM cellDM;
+    VecGetDM(cellGeomVec, &cellDM) >> checkError;
+    PetscScalar* centroidArray;
+    VecGetArrayWrite(centroidVec, &centroidArray) >> checkError;
+    for (std::size_t r = 0; r < stencilRows.size(); ++r) {
+        PetscFVCellGeom* cg;
+        DMPlexPointLocalRead(cellDM, stencilRows[r], cellGeomArray, &cg) >> checkError;
+        PetscArraycpy(centroidArray + r * dim, cg->centroid, dim) >> checkError;
+    }
+    VecRestoreArrayWrite(centroidVec, &centroidArray) >> checkError;
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+
+    // the point and offset indices are written directly from the vectors
+    IS rowsIs, offsetsIs;
+    ISCreateGeneral(PETSC_COMM_SELF, (PetscInt)stencilRows.size(), stencilRows.data(), PETSC_USE_POINTER, &rowsIs) >> checkError;
+    PetscObjectSetName((PetscObject)rowsIs, "points") >> checkError;
+    ISCreateGeneral(PETSC_COMM_SELF, (PetscInt)offsets.size(), offsets.data(), PETSC_USE_POINTER, &offsetsIs) >> checkError;
+    PetscObjectSetName((PetscObject)offsetsIs, "offsets") >> checkError;
+
+    // name each of the components in the values and sources
+    std::string components;
+    for (const auto& field : GetSubDomain().GetFields()) {
+        if (field.components.empty()) {
+            components += (components.empty() ? "" : " ") + field.name;
+        } else {
+            for (const auto& compName : field.components) {
+                components += (components.empty() ? "" : " ") + compName;
+            }
+        }
+    }
+
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PETSC_COMM_SELF, (solverDirectory / ("stencil_rank_" + std::to_string(rank) + ".h5")).c_str(), FILE_MODE_WRITE, &viewer) >> checkError;
+    ISView(offsetsIs, viewer) >> checkError;
+    ISView(rowsIs, viewer) >> checkError;
+    VecView(centroidVec, viewer) >> checkError;
+    PetscViewerHDF5WriteAttribute(viewer, "/", "components", PETSC_STRING, components.c_str()) >> checkError;
+    PetscViewerDestroy(&viewer) >> checkError;
+
+    ISDestroy(&rowsIs) >> checkError;
+    ISDestroy(&offsetsIs) >> checkError;
+    VecDestroy(&centroidVec) >> checkError;
+}
+
+PetscErrorCode ablate::boundarySolver::DebugBoundarySolver::WriteBinarySources(PetscReal time, Vec locXVec, Vec locFVec) {
+    PetscFunctionBeginUser;
+    PetscInt totDim;
+    PetscCall(PetscDSGetTotalDimension(GetSubDomain().GetDiscreteSystem(), &totDim));
+    const auto numberRows = (PetscInt)stencilRows.size();
+
+    // copy the values and sources for every stencil row
+    Vec valuesVec, sourcesVec;
+    PetscCall(VecCreateSeq(PETSC_COMM_SELF, numberRows * totDim, &valuesVec));
+    PetscCall(VecSetBlockSize(valuesVec, totDim));
+    PetscCall(PetscObjectSetName((PetscObject)valuesVec, "values"));
+    PetscCall(VecDuplicate(valuesVec, &sourcesVec));
+    PetscCall(PetscObjectSetName((PetscObject)sourcesVec, "sources"));
+
+    const PetscScalar *locXArray, *locFArray;
+    PetscCall(VecGetArrayRead(locXVec, &locXArray));
+    PetscCall(VecGetArrayRead(locFVec, &locFArray));
+    PetscScalar *valuesArray, *sourcesArray;
+    PetscCall(VecGetArrayWrite(valuesVec, &valuesArray));
+    PetscCall(VecGetArrayWrite(sourcesVec, &sourcesArray));
+    for (PetscInt r = 0; r < numberRows; ++r) {
+        const PetscScalar *localXValues, *localFValues;
+        PetscCall(DMPlexPointLocalRead(GetSubDomain().GetDM(), stencilRows[r], locXArray, &localXValues));
+        PetscCall(DMPlexPointLocalRead(GetSubDomain().GetDM(), stencilRows[r], locFArray, &localFValues));
+        PetscCall(PetscArraycpy(valuesArray + r * totDim, localXValues, totDim));
+        PetscCall(PetscArraycpy(sourcesArray + r * totDim, localFValues, totDim));
+    }
+    PetscCall(VecRestoreArrayWrite(valuesVec, &valuesArray));
+    PetscCall(VecRestoreArrayWrite(sourcesVec, &sourcesArray));
+    PetscCall(VecRestoreArrayRead(locXVec, &locXArray));
+    PetscCall(VecRestoreArrayRead(locFVec, &locFArray));
+
+    // store the time as its own dataset
+    Vec timeVec;
+    PetscCall(VecCreateSeq(PETSC_COMM_SELF, 1, &timeVec));
+    PetscCall(PetscObjectSetName((PetscObject)timeVec, "time"));
+    PetscCall(VecSet(timeVec, time));
+
+    // each rhs evaluation is a new timestep in the file
+    PetscCall(PetscViewerHDF5PushTimestepping(sourceViewer));
+    PetscCall(PetscViewerHDF5SetTimestep(sourceViewer, sourceTimestep++));
+    PetscCall(VecView(timeVec, sourceViewer));
+    PetscCall(VecView(valuesVec, sourceViewer));
+    PetscCall(VecView(sourcesVec, sourceViewer));
+    PetscCall(PetscViewerHDF5PopTimestepping(sourceViewer));
+    PetscCall(PetscViewerFlush(sourceViewer));
+
+    PetscCall(VecDestroy(&timeVec));
+    PetscCall(VecDestroy(&valuesVec));
+    PetscCall(VecDestroy(&sourcesVec));
+    PetscFunctionReturn(0);
+}
+
 void ablate::boundarySolver::DebugBoundarySolver::OutputStencilCellLocation(std::ostream& stream, PetscInt cell) {
     stream << cell;
 
@@ -97,6 +228,10 @@ void ablate::boundarySolver::DebugBoundarySolver::OutputStencilCellLocation(std:
 PetscErrorCode ablate::boundarySolver::DebugBoundarySolver::ComputeRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) {
     PetscFunctionBeginUser;
     PetscCall(BoundarySolver::ComputeRHSFunction(time, locXVec, locFVec));
+    if (binaryOutput) {
+        PetscCall(WriteBinarySources(time, locXVec, locFVec));
+        PetscFunctionReturn(0);
+    }
 
     // Get the rank
     PetscMPIInt rank;
@@ -206,4 +341,5 @@ REGISTER(ablate::solver::Solver, ablate::boundarySolver::DebugBoundarySolver, "A
          ARG(ablate::domain::Region, "fieldBoundary", "the region describing the faces between the boundary and field"),
          ARG(std::vector<ablate::boundarySolver::BoundaryProcess>, "processes", "a list of boundary processes"),
          OPT(ablate::parameters::Parameters, "options", "the options passed to PETSC for the flow"),
-         OPT(bool, "mergeFaces", "determine if multiple faces should be merged for a single cell, default if false"));
+         OPT(bool, "mergeFaces", "determine if multiple faces should be merged for a single cell, default if false"),
+         OPT(bool, "binaryOutput", "write the stencils and sources to a single hdf5 file per rank with one dataset per quantity instead of text, default is false"));
@@ -1,12 +1,16 @@
 #ifndef ABLATELIBRARY_DEBUGBOUNDARYSOLVER_HPP
 #define ABLATELIBRARY_DEBUGBOUNDARYSOLVER_HPP
 
+#include <filesystem>
+#include <vector>
 #include "boundarySolver.hpp"
 
 namespace ablate::boundarySolver {
 
 /**
- * this is a debug extension of the boundary solver that outputs useful information for debugging problems with the boundary solver
+ * this is a debug extension of the boundary solver that outputs useful information for debugging problems with the boundary solver.  By default a text file is written for each stencil and
+ * rhs evaluation.  In binary mode a single hdf5 file is written per rank for the stencils and a single file per rank for the sources with one dataset per quantity and one timestep per rhs
+ * evaluation, see docs/content/development/assets/debugBoundarySolver/readDebugBoundarySolver.py for a reader.
  */
 class DebugBoundarySolver : public BoundarySolver {
    public:
@@ -17,9 +21,16 @@ class DebugBoundarySolver : public BoundarySolver {
      * @param fieldBoundary the region describing the faces between the boundary and field
      * @param boundaryProcesses a list of boundary processes
      * @param options other options
+     * @param mergeFaces determine if multiple faces should be merged for a single cell
+     * @param binaryOutput write the stencils and sources to hdf5 instead of text
      */
     DebugBoundarySolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<domain::Region> fieldBoundary, std::vector<std::shared_ptr<BoundaryProcess>> boundaryProcesses,
-                        std::shared_ptr<parameters::Parameters> options, bool mergeFaces = false);
+                        std::shared_ptr<parameters::Parameters> options, bool mergeFaces = false, bool binaryOutput = false);
+
+    /**
+     * close the source viewer if open
+     */
+    ~DebugBoundarySolver() override;
 
     /**
      * override setup to allow outputting of the stencil per rank
@@ -37,7 +48,35 @@ class DebugBoundarySolver : public BoundarySolver {
      */
     PetscErrorCode ComputeRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) override;
 
+    /**
+     * The debug output is written from the rhs function so it is always run in place
+     * @return
+     */
+    [[nodiscard]] bool ConcurrentRHSFunction() const override { return false; }
+
    private:
+    //! write the stencils and sources to hdf5 instead of text
+    const bool binaryOutput;
+
+    //! the per rank hdf5 viewer for the source output, left open for the entire run
+    PetscViewer sourceViewer = nullptr;
+
+    //! the next timestep in the source viewer
+    PetscInt sourceTimestep = 0;
+
+    //! the stencil rows in the same order as the text output, the boundary cell followed by each stencil point for every face
+    std::vector<PetscInt> stencilRows;
+
+    /**
+     * Write the stencils to a per rank hdf5 file
+     */
+    void WriteBinaryStencils(const std::filesystem::path& solverDirectory, PetscMPIInt rank);
+
+    /**
+     * Write the values and sources at each stencil row to the source viewer
+     */
+    PetscErrorCode WriteBinarySources(PetscReal time, Vec locXVec, Vec locFVec);
+
     /**
      * helper function to output the cell location
      * @param stream
@@ -0,0 +1,37 @@
+#include "distributionOperator.hpp"
+#include <algorithm>
+
+ablate::boundarySolver::DistributionOperator::DistributionOperator(std::vector<Entry> entries) {
+    // group the entries by row while keeping the provided order within each row
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.rowOffset < b.rowOffset; });
+
+    rowStarts.push_back(0);
+    columnOffsets.reserve(entries.size());
+    weights.reserve(entries.size());
+    for (std::size_t e = 0; e < entries.size(); ++e) {
+        if (e > 0 && entries[e].rowOffset != entries[e - 1].rowOffset) {
+            rowStarts.push_back((PetscInt)columnOffsets.size());
+        }
+        if (rowOffsets.empty() || entries[e].rowOffset != rowOffsets.back()) {
+            rowOffsets.push_back(entries[e].rowOffset);
+        }
+        columnOffsets.push_back(entries[e].columnOffset);
+        weights.push_back(entries[e].weight);
+    }
+    if (!rowOffsets.empty()) {
+        rowStarts.push_back((PetscInt)columnOffsets.size());
+    }
+}
+
+void ablate::boundarySolver::DistributionOperator::Apply(const PetscScalar* input, PetscScalar* output, PetscInt blockSize) const {
+    for (std::size_t r = 0; r < rowOffsets.size(); ++r) {
+        PetscScalar* out = output + rowOffsets[r];
+        for (PetscInt j = rowStarts[r]; j < rowStarts[r + 1]; ++j) {
+            const PetscScalar* in = input + columnOffsets[j];
+            const PetscScalar weight = weights[j];
+            for (PetscInt c = 0; c < blockSize; ++c) {
+                out[c] += weight * in[c];
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef ABLATELIBRARY_DISTRIBUTIONOPERATOR_HPP
+#define ABLATELIBRARY_DISTRIBUTIONOPERATOR_HPP
+
+#include <petsc.h>
+#include <vector>
+
+namespace ablate::boundarySolver {
+
+/**
+ * A constant sparse operator stored in compressed sparse row (CSR) form that maps blocks of an input array to blocks of an output array, i.e. the face sources to the stencil cells.
+ * Each row is a unique offset into the output array and each column is an offset into the input array, so the operator can be applied directly to local petsc arrays.  Applying the
+ * operator is a single sparse matrix vector product over every component of the block:
+ *
+ *      output[rowOffset[r] + c] += sum_j weight[j] * input[columnOffset[j] + c]
+ *
+ * Because each output block is owned by a single row the rows may be computed in any order.
+ */
+class DistributionOperator {
+   public:
+    /**
+     * A single entry used to assemble the operator
+     */
+    struct Entry {
+        //! the offset into the output array
+        PetscInt rowOffset;
+        //! the offset into the input array
+        PetscInt columnOffset;
+        //! the weight applied to the input
+        PetscScalar weight;
+    };
+
+   private:
+    //! the offset into the output array for each row
+    std::vector<PetscInt> rowOffsets;
+
+    //! the start of each row in the columns, size numberRows + 1
+    std::vector<PetscInt> rowStarts;
+
+    //! the offset into the input array for each entry
+    std::vector<PetscInt> columnOffsets;
+
+    //! the weight of each entry
+    std::vector<PetscScalar> weights;
+
+   public:
+    DistributionOperator() = default;
+
+    /**
+     * Assemble the operator from an unordered list of entries.  Entries with the same row are combined into a single row in the order they were provided.
+     * @param entries
+     */
+    explicit DistributionOperator(std::vector<Entry> entries);
+
+    /**
+     * Add the operator applied to the input onto the output
+     * @param input the input array
+     * @param output the output array
+     * @param blockSize the number of components at each offset
+     */
+    void Apply(const PetscScalar* input, PetscScalar* output, PetscInt blockSize) const;
+
+    /**
+     * The number of unique output blocks
+     * @return
+     */
+    [[nodiscard]] inline std::size_t GetNumberRows() const { return rowOffsets.size(); }
+
+    /**
+     * The number of stored entries
+     * @return
+     */
+    [[nodiscard]] inline std::size_t GetNumberEntries() const { return weights.size(); }
+};
+
+}  // namespace ablate::boundarySolver
+#endif  // ABLATELIBRARY_DISTRIBUTIONOPERATOR_HPP
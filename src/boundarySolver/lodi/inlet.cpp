@@ -12,7 +12,8 @@ ablate::boundarySolver::lodi::Inlet::Inlet(std::shared_ptr<eos::EOS> eos, std::s
 void ablate::boundarySolver::lodi::Inlet::Setup(ablate::boundarySolver::BoundarySolver &bSolver) {
     ablate::boundarySolver::lodi::LODIBoundary::Setup(bSolver);
 
-    bSolver.RegisterFunction(InletFunction, this, fieldNames, fieldNames, {});
+    // the face state is read from the batch cache during the rhs evaluation, so the faces can be computed concurrently
+    bSolver.RegisterFunction(InletFunction, this, fieldNames, fieldNames, {}, BoundarySolver::BoundarySourceType::Point, false, true);
 
     // Register a pre function step to update velocity over this solver if specified
     if (prescribedVelocity) {
@@ -42,11 +43,9 @@ PetscErrorCode ablate::boundarySolver::lodi::Inlet::InletFunction(PetscInt dim,
 
     // Compute the pressure/values on the boundary
     PetscReal boundaryDensity;
-    PetscReal boundaryTemperature;
     PetscReal boundaryVel[3];
     PetscReal boundaryNormalVelocity = 0.0;
-    PetscReal boundarySpeedOfSound;
-    PetscReal boundaryPressure;
+    BoundaryState boundaryState;
 
     // Get the densityYi pointer if available
     const PetscScalar *boundaryDensityYi = inletBoundary->nSpecEqs > 0 ? boundaryValues + uOff[inletBoundary->speciesId] : nullptr;
@@ -58,52 +57,46 @@ PetscErrorCode ablate::boundarySolver::lodi::Inlet::InletFunction(PetscInt dim,
             boundaryVel[d] = boundaryValues[uOff[inletBoundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / boundaryDensity;
             boundaryNormalVelocity += boundaryVel[d] * fg->normal[d];
         }
-        PetscErrorCode ierr = inletBoundary->computeTemperature.function(boundaryValues, &boundaryTemperature, inletBoundary->computeTemperature.context.get());
-        CHKERRQ(ierr);
-        ierr = inletBoundary->computeSpeedOfSound.function(boundaryValues, boundaryTemperature, &boundarySpeedOfSound, inletBoundary->computeSpeedOfSound.context.get());
-        CHKERRQ(ierr);
-        ierr = inletBoundary->computePressureFromTemperature.function(boundaryValues, boundaryTemperature, &boundaryPressure, inletBoundary->computePressureFromTemperature.context.get());
-        CHKERRQ(ierr);
+        PetscCall(inletBoundary->GetBoundaryState(fg, boundaryValues, boundaryState));
     }
+    const PetscReal boundaryTemperature = boundaryState.temperature;
+    const PetscReal boundarySpeedOfSound = boundaryState.speedOfSound;
+    const PetscReal boundaryPressure = boundaryState.pressure;
 
     // Map the boundary velocity into the normal coord system
     PetscReal boundaryVelNormCord[3];
     utilities::MathUtilities::Multiply(dim, transformationMatrix, boundaryVel, boundaryVelNormCord);
 
     // Compute each stencil point
-    std::vector<PetscReal> stencilDensity(stencilSize);
-    std::vector<std::vector<PetscReal>> stencilVel(stencilSize, std::vector<PetscReal>(dim));
-    std::vector<PetscReal> stencilNormalVelocity(stencilSize);
-    std::vector<PetscReal> stencilPressure(stencilSize);
+    std::vector<PetscReal> stencilScratch(3 * stencilSize, 0.0);
+    PetscReal *stencilDensity = stencilScratch.data();
+    PetscReal *stencilNormalVelocity = stencilDensity + stencilSize;
+    PetscReal *stencilPressure = stencilNormalVelocity + stencilSize;
 
+    PetscCall(inletBoundary->GetStencilPressures(fg, stencilSize, stencilValues, stencilPressure));
     for (PetscInt s = 0; s < stencilSize; s++) {
         stencilDensity[s] = stencilValues[s][uOff[inletBoundary->eulerId] + finiteVolume::CompressibleFlowFields::RHO];
         for (PetscInt d = 0; d < dim; d++) {
-            stencilVel[s][d] = stencilValues[s][uOff[inletBoundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
-            stencilNormalVelocity[s] += stencilVel[s][d] * fg->normal[d];
+            stencilNormalVelocity[s] += stencilValues[s][uOff[inletBoundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s] * fg->normal[d];
         }
-        PetscErrorCode ierr = inletBoundary->computePressure.function(stencilValues[s], &stencilPressure[s], inletBoundary->computePressure.context.get());
-        CHKERRQ(ierr);
     }
 
     // Interpolate the normal velocity gradient to the surface
     PetscScalar dVeldNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryNormalVelocity, stencilSize, &stencilNormalVelocity[0], stencilWeights, dVeldNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryNormalVelocity, stencilSize, stencilNormalVelocity, stencilWeights, dVeldNorm);
     PetscScalar dPdNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, &stencilPressure[0], stencilWeights, dPdNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, stencilPressure, stencilWeights, dPdNorm);
 
     // Compute the cp, cv from the eos
     std::vector<PetscReal> boundaryYi(inletBoundary->nSpecEqs);
     for (PetscInt i = 0; i < inletBoundary->nSpecEqs; i++) {
         boundaryYi[i] = boundaryDensityYi[i] / boundaryDensity;
     }
-    PetscReal boundaryCp, boundaryCv;
-    inletBoundary->computeSpecificHeatConstantPressure.function(boundaryValues, boundaryTemperature, &boundaryCp, inletBoundary->computeSpecificHeatConstantPressure.context.get());
-    inletBoundary->computeSpecificHeatConstantVolume.function(boundaryValues, boundaryTemperature, &boundaryCv, inletBoundary->computeSpecificHeatConstantVolume.context.get());
+    const PetscReal boundaryCp = boundaryState.cp;
+    const PetscReal boundaryCv = boundaryState.cv;
 
-    // Compute the enthalpy
-    PetscReal boundarySensibleEnthalpy;
-    inletBoundary->computeSensibleEnthalpyFunction.function(boundaryValues, boundaryTemperature, &boundarySensibleEnthalpy, inletBoundary->computeSensibleEnthalpyFunction.context.get());
+    // the sensible enthalpy at the boundary
+    const PetscReal boundarySensibleEnthalpy = boundaryState.sensibleEnthalpy;
 
     // get_vel_and_c_prims(PGS, velwall[0], C, Cp, Cv, velnprm, Cprm);
     PetscReal velNormPrim, speedOfSoundPrim;
@@ -9,7 +9,8 @@ ablate::boundarySolver::lodi::IsothermalWall::IsothermalWall(std::shared_ptr<eos
 
 void ablate::boundarySolver::lodi::IsothermalWall::Setup(ablate::boundarySolver::BoundarySolver &bSolver) {
     ablate::boundarySolver::lodi::LODIBoundary::Setup(bSolver);
-    bSolver.RegisterFunction(IsothermalWallFunction, this, fieldNames, fieldNames, {});
+    // the face state is read from the batch cache during the rhs evaluation, so the faces can be computed concurrently
+    bSolver.RegisterFunction(IsothermalWallFunction, this, fieldNames, fieldNames, {}, BoundarySolver::BoundarySourceType::Point, false, true);
 
     if (nSpecEqs) {
         bSolver.RegisterFunction(
@@ -31,11 +32,9 @@ PetscErrorCode ablate::boundarySolver::lodi::IsothermalWall::IsothermalWallFunct
 
     // Compute the pressure/values on the boundary
     PetscReal boundaryDensity;
-    PetscReal boundaryTemperature;
     PetscReal boundaryVel[3];
     PetscReal boundaryNormalVelocity = 0.0;
-    PetscReal boundarySpeedOfSound;
-    PetscReal boundaryPressure;
+    BoundaryState boundaryState;
 
     // Get the velocity and pressure on the surface
     {
@@ -44,43 +43,41 @@ PetscErrorCode ablate::boundarySolver::lodi::IsothermalWall::IsothermalWallFunct
             boundaryVel[d] = boundaryValues[uOff[isothermalWall->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / boundaryDensity;
             boundaryNormalVelocity += boundaryVel[d] * fg->normal[d];
         }
-        PetscCall(isothermalWall->computeTemperature.function(boundaryValues, &boundaryTemperature, isothermalWall->computeTemperature.context.get()));
-        PetscCall(isothermalWall->computeSpeedOfSound.function(boundaryValues, boundaryTemperature, &boundarySpeedOfSound, isothermalWall->computeSpeedOfSound.context.get()));
-        PetscCall(isothermalWall->computePressureFromTemperature.function(boundaryValues, boundaryTemperature, &boundaryPressure, isothermalWall->computePressureFromTemperature.context.get()));
+        PetscCall(isothermalWall->GetBoundaryState(fg, boundaryValues, boundaryState));
     }
+    const PetscReal boundaryTemperature = boundaryState.temperature;
+    const PetscReal boundarySpeedOfSound = boundaryState.speedOfSound;
+    const PetscReal boundaryPressure = boundaryState.pressure;
 
     // Map the boundary velocity into the normal coord system
     PetscReal boundaryVelNormCord[3];
     utilities::MathUtilities::Multiply(dim, transformationMatrix, boundaryVel, boundaryVelNormCord);
 
     // Compute each stencil point
-    std::vector<PetscReal> stencilDensity(stencilSize);
-    std::vector<std::vector<PetscReal>> stencilVel(stencilSize, std::vector<PetscReal>(dim));
-    std::vector<PetscReal> stencilNormalVelocity(stencilSize);
-    std::vector<PetscReal> stencilPressure(stencilSize);
+    std::vector<PetscReal> stencilScratch(3 * stencilSize, 0.0);
+    PetscReal *stencilDensity = stencilScratch.data();
+    PetscReal *stencilNormalVelocity = stencilDensity + stencilSize;
+    PetscReal *stencilPressure = stencilNormalVelocity + stencilSize;
 
+    PetscCall(isothermalWall->GetStencilPressures(fg, stencilSize, stencilValues, stencilPressure));
     for (PetscInt s = 0; s < stencilSize; s++) {
         stencilDensity[s] = stencilValues[s][uOff[isothermalWall->eulerId] + finiteVolume::CompressibleFlowFields::RHO];
         for (PetscInt d = 0; d < dim; d++) {
-            stencilVel[s][d] = stencilValues[s][uOff[isothermalWall->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
-            stencilNormalVelocity[s] += stencilVel[s][d] * fg->normal[d];
+            stencilNormalVelocity[s] += stencilValues[s][uOff[isothermalWall->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s] * fg->normal[d];
         }
-        PetscCall(isothermalWall->computePressure.function(stencilValues[s], &stencilPressure[s], isothermalWall->computePressure.context.get()));
     }
 
     // Interpolate the normal velocity gradient to the surface
     PetscScalar dVeldNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryNormalVelocity, stencilSize, &stencilNormalVelocity[0], stencilWeights, dVeldNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryNormalVelocity, stencilSize, stencilNormalVelocity, stencilWeights, dVeldNorm);
     PetscScalar dPdNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, &stencilPressure[0], stencilWeights, dPdNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, stencilPressure, stencilWeights, dPdNorm);
 
-    PetscReal boundaryCp, boundaryCv;
-    isothermalWall->computeSpecificHeatConstantPressure.function(boundaryValues, boundaryTemperature, &boundaryCp, isothermalWall->computeSpecificHeatConstantPressure.context.get());
-    isothermalWall->computeSpecificHeatConstantVolume.function(boundaryValues, boundaryTemperature, &boundaryCv, isothermalWall->computeSpecificHeatConstantVolume.context.get());
+    const PetscReal boundaryCp = boundaryState.cp;
+    const PetscReal boundaryCv = boundaryState.cv;
 
-    // Compute the enthalpy
-    PetscReal boundarySensibleEnthalpy;
-    isothermalWall->computeSensibleEnthalpyFunction.function(boundaryValues, boundaryTemperature, &boundarySensibleEnthalpy, isothermalWall->computeSensibleEnthalpyFunction.context.get());
+    // the sensible enthalpy at the boundary
+    const PetscReal boundarySensibleEnthalpy = boundaryState.sensibleEnthalpy;
 
     // get_vel_and_c_prims(PGS, velwall[0], C, Cp, Cv, velnprm, Cprm);
     PetscReal velNormPrim, speedOfSoundPrim;
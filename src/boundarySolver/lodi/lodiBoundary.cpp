@@ -32,64 +32,99 @@ void ablate::boundarySolver::lodi::LODIBoundary::GetVelAndCPrims(PetscReal velNo
 }
 
 void ablate::boundarySolver::lodi::LODIBoundary::GetEigenValues(PetscReal veln, PetscReal c, PetscReal velnprm, PetscReal cprm, PetscReal *lamda) const {
+    switch (dims) {
+        case 1:
+            GetEigenValues<1>(veln, velnprm, cprm, lamda);
+            break;
+        case 2:
+            GetEigenValues<2>(veln, velnprm, cprm, lamda);
+            break;
+        case 3:
+            GetEigenValues<3>(veln, velnprm, cprm, lamda);
+            break;
+        default:
+            throw std::invalid_argument("LODIBoundary only supports 1, 2, or 3 dimensions");
+    }
+}
+
+template <PetscInt DIM>
+void ablate::boundarySolver::lodi::LODIBoundary::GetEigenValues(PetscReal veln, PetscReal velnprm, PetscReal cprm, PetscReal *lamda) const {
     lamda[0] = velnprm - cprm;
     lamda[1] = veln;
-    for (int ndim = 1; ndim < dims; ndim++) {
+    for (int ndim = 1; ndim < DIM; ndim++) {
         lamda[1 + ndim] = veln;
     }
-    lamda[1 + dims] = velnprm + cprm;
-    for (int ns = 0; ns < nSpecEqs; ns++) {
-        lamda[2 + dims + ns] = veln;
+    lamda[1 + DIM] = velnprm + cprm;
+    // the species and ev all move with the normal velocity
+    for (PetscInt n = 2 + DIM; n < 2 + DIM + nSpecEqs + nEvEqs; n++) {
+        lamda[n] = veln;
     }
-    for (int ne = 0; ne < nEvEqs; ne++) {
-        lamda[2 + dims + nSpecEqs + ne] = veln;
+}
+
+void ablate::boundarySolver::lodi::LODIBoundary::GetmdFdn(const PetscInt sOff[], const PetscReal *vel, PetscReal rho, PetscReal T, PetscReal Cp, PetscReal Cv, PetscReal C, PetscReal Enth,
+                                                          PetscReal velnprm, PetscReal Cprm, const PetscReal *conserved, const PetscInt uOff[], const PetscReal *sL,
+                                                          const PetscReal transformationMatrix[3][3], PetscReal *mdFdn) const {
+    switch (dims) {
+        case 1:
+            GetmdFdn<1>(sOff, vel, rho, T, Cp, Cv, C, Enth, velnprm, Cprm, conserved, uOff, sL, transformationMatrix, mdFdn);
+            break;
+        case 2:
+            GetmdFdn<2>(sOff, vel, rho, T, Cp, Cv, C, Enth, velnprm, Cprm, conserved, uOff, sL, transformationMatrix, mdFdn);
+            break;
+        case 3:
+            GetmdFdn<3>(sOff, vel, rho, T, Cp, Cv, C, Enth, velnprm, Cprm, conserved, uOff, sL, transformationMatrix, mdFdn);
+            break;
+        default:
+            throw std::invalid_argument("LODIBoundary only supports 1, 2, or 3 dimensions");
     }
 }
 
+template <PetscInt DIM>
 void ablate::boundarySolver::lodi::LODIBoundary::GetmdFdn(const PetscInt sOff[], const PetscReal *vel, PetscReal rho, PetscReal T, PetscReal Cp, PetscReal Cv, PetscReal C, PetscReal Enth,
                                                           PetscReal velnprm, PetscReal Cprm, const PetscReal *conserved, const PetscInt uOff[], const PetscReal *sL,
                                                           const PetscReal transformationMatrix[3][3], PetscReal *mdFdn) const {
-    std::vector<PetscScalar> d(nEqs);
+    // only the euler terms of d are needed, the species and ev terms are read directly from sL
+    PetscReal d[2 + DIM];
     PetscReal alpha2 = 1.0;
     if (pressureGradientScaling) {
         alpha2 = PetscSqr(pressureGradientScaling->GetAlpha());
     }
 
-    auto fac = 0.5e+0 * (sL[0] - sL[1 + dims]) * (velnprm - vel[0]) / Cprm;
+    auto fac = 0.5e+0 * (sL[0] - sL[1 + DIM]) * (velnprm - vel[0]) / Cprm;
     double C2 = C * C;
-    d[0] = (sL[1] + 0.5e+0 * (sL[1 + dims] + sL[0]) + fac) / C2;
-    d[1] = 0.5e+0 * (sL[1 + dims] + sL[0]) - fac;
-    d[2] = 0.5e+0 * (sL[1 + dims] - sL[0]) / rho / Cprm / alpha2;
-    for (int ndim = 1; ndim < dims; ndim++) {
+    d[0] = (sL[1] + 0.5e+0 * (sL[1 + DIM] + sL[0]) + fac) / C2;
+    d[1] = 0.5e+0 * (sL[1 + DIM] + sL[0]) - fac;
+    d[2] = 0.5e+0 * (sL[1 + DIM] - sL[0]) / rho / Cprm / alpha2;
+    for (int ndim = 1; ndim < DIM; ndim++) {
         d[2 + ndim] = sL[1 + ndim];
     }
-    for (int ns = 0; ns < nSpecEqs; ns++) {
-        d[2 + dims + ns] = sL[2 + dims + ns];
-    }
-    for (int ne = 0; ne < nEvEqs; ne++) {
-        d[2 + dims + nSpecEqs + ne] = sL[2 + dims + nSpecEqs + ne];
-    }
+    const PetscReal *dSpecies = sL + 2 + DIM;
+    const PetscReal *dEv = sL + 2 + DIM + nSpecEqs;
+
     mdFdn[sOff[eulerId] + RHO] = -d[0];
     mdFdn[sOff[eulerId] + RHOVELN] = -(vel[0] * d[0] + rho * d[2]);  // Wall normal component momentum, not really rho u
     double KE = vel[0] * vel[0];
     double dvelterm = vel[0] * d[2];
-    for (int ndim = 1; ndim < dims; ndim++) {  // Tangential components for momentum
+    for (int ndim = 1; ndim < DIM; ndim++) {  // Tangential components for momentum
         mdFdn[sOff[eulerId] + RHOVELN + ndim] = -(vel[ndim] * d[0] + rho * d[2 + ndim]);
         KE += vel[ndim] * vel[ndim];
         dvelterm = dvelterm + vel[ndim] * d[2 + ndim];
     }
     KE = 0.5e+0 * KE;
     mdFdn[sOff[eulerId] + RHOE] = -(d[0] * (KE + Enth - Cp * T) + d[1] / (Cp / Cv - 1.e+0 + 1.0E-30) + rho * dvelterm);
-    const PetscReal *rhoYi = conserved + uOff[speciesId];
-    for (int ns = 0; ns < nSpecEqs; ns++) {
-        mdFdn[sOff[speciesId] + ns] = -(rhoYi[ns] / rho * d[0] + rho * d[2 + dims + ns]);  // species
+    if (nSpecEqs > 0) {
+        const PetscReal *rhoYi = conserved + uOff[speciesId];
+        PetscReal *speciesSource = mdFdn + sOff[speciesId];
+        for (PetscInt ns = 0; ns < nSpecEqs; ns++) {
+            speciesSource[ns] = -(rhoYi[ns] / rho * d[0] + rho * dSpecies[ns]);  // species
+        }
     }
 
     int ne = 0;
     for (std::size_t ev = 0; ev < evIds.size(); ++ev) {
         const PetscReal *rhoEV = conserved + uOff[evIds[ev]];
         for (PetscInt ec = 0; ec < nEvComps[ev]; ++ec) {
-            mdFdn[sOff[evIds[ev]] + ec] = -(rhoEV[ec] / rho * d[0] + rho * d[2 + dims + nSpecEqs + ne]);  // extra
+            mdFdn[sOff[evIds[ev]] + ec] = -(rhoEV[ec] / rho * d[0] + rho * dEv[ne]);  // extra
             ne++;
         }
     }
@@ -105,9 +140,9 @@ void ablate::boundarySolver::lodi::LODIBoundary::GetmdFdn(const PetscInt sOff[],
         data structure is used which is more general but also more expensive.
      */
     PetscReal mdFdntmp[3] = {0.0, 0.0, 0.0};
-    utilities::MathUtilities::MultiplyTranspose(dims, transformationMatrix, mdFdn + sOff[eulerId] + RHOVELN, mdFdntmp);
+    utilities::MathUtilities::MultiplyTranspose(DIM, transformationMatrix, mdFdn + sOff[eulerId] + RHOVELN, mdFdntmp);
     // Over-write source components
-    for (PetscInt nc = 0; nc < dims; nc++) {
+    for (PetscInt nc = 0; nc < DIM; nc++) {
         mdFdn[sOff[eulerId] + RHOVELN + nc] = mdFdntmp[nc];
     }
 }
@@ -205,4 +240,131 @@ void ablate::boundarySolver::lodi::LODIBoundary::Setup(PetscInt dimsIn, PetscInt
     computeSpecificHeatConstantVolume = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpecificHeatConstantVolume, fields);
     computeSensibleEnthalpyFunction = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SensibleEnthalpy, fields);
     computePressure = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Pressure, fields);
+
+    // and the batch versions used to compute the state of every face at once
+    computeTemperatureBatch = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::Temperature, fields);
+    computeSpeedOfSoundBatch = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::SpeedOfSound, fields);
+    computePressureFromTemperatureBatch = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::Pressure, fields);
+    computeSpecificHeatConstantPressureBatch = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::SpecificHeatConstantPressure, fields);
+    computeSpecificHeatConstantVolumeBatch = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::SpecificHeatConstantVolume, fields);
+    computeSensibleEnthalpyBatch = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::SensibleEnthalpy, fields);
+    computePressureBatch = eos->GetThermodynamicBatchFunction(eos::ThermodynamicProperty::Pressure, fields);
+}
+
+void ablate::boundarySolver::lodi::LODIBoundary::Initialize(ablate::boundarySolver::BoundarySolver &bSolver) {
+    // store the boundary cell and stencil for each face
+    faceStateCache = FaceStateCache{};
+    faceStateCache.stencilOffsets.push_back(0);
+    for (const auto &stencil : bSolver.GetBoundaryGeometry()) {
+        faceStateCache.faceIndex[stencil.geometry.faceId] = faceStateCache.boundaryCells.size();
+        faceStateCache.boundaryCells.push_back(stencil.cellId);
+        faceStateCache.stencilCells.insert(faceStateCache.stencilCells.end(), stencil.stencil.begin(), stencil.stencil.end());
+        faceStateCache.stencilOffsets.push_back(faceStateCache.stencilCells.size());
+    }
+    bSolver.RegisterPreRHSFunction(LODIBatchPreRHS, this);
+    bSolver.RegisterPostRHSFunction(LODIPostRHS, this);
+}
+
+PetscErrorCode ablate::boundarySolver::lodi::LODIBoundary::LODIBatchPreRHS(BoundarySolver &solver, TS, PetscReal, bool, Vec locX, void *ctx) {
+    PetscFunctionBeginUser;
+    auto boundary = (LODIBoundary *)ctx;
+    auto &cache = boundary->faceStateCache;
+    const auto numberFaces = (PetscInt)cache.boundaryCells.size();
+    const auto numberStencilCells = (PetscInt)cache.stencilCells.size();
+    DM dm = solver.GetSubDomain().GetDM();
+    PetscInt totDim;
+    PetscCall(PetscDSGetTotalDimension(solver.GetSubDomain().GetDiscreteSystem(), &totDim));
+
+    // pack the conserved values for the boundary and stencil cells
+    cache.boundaryConserved.resize(numberFaces * totDim);
+    cache.stencilConserved.resize(numberStencilCells * totDim);
+    const PetscScalar *locXArray;
+    PetscCall(VecGetArrayRead(locX, &locXArray));
+    for (PetscInt i = 0; i < numberFaces; ++i) {
+        const PetscScalar *values;
+        PetscCall(DMPlexPointLocalRead(dm, cache.boundaryCells[i], locXArray, &values));
+        PetscCall(PetscArraycpy(cache.boundaryConserved.data() + i * totDim, values, totDim));
+    }
+    for (PetscInt i = 0; i < numberStencilCells; ++i) {
+        const PetscScalar *values;
+        PetscCall(DMPlexPointLocalRead(dm, cache.stencilCells[i], locXArray, &values));
+        PetscCall(PetscArraycpy(cache.stencilConserved.data() + i * totDim, values, totDim));
+    }
+    PetscCall(VecRestoreArrayRead(locX, &locXArray));
+
+    // compute each property with a single batch call
+    cache.temperature.resize(numberFaces);
+    cache.speedOfSound.resize(numberFaces);
+    cache.pressure.resize(numberFaces);
+    cache.cp.resize(numberFaces);
+    cache.cv.resize(numberFaces);
+    cache.sensibleEnthalpy.resize(numberFaces);
+    cache.stencilPressure.resize(numberStencilCells);
+    const auto conserved = cache.boundaryConserved.data();
+    const auto temperature = cache.temperature.data();
+    PetscCall(boundary->computeTemperatureBatch.function(numberFaces, conserved, totDim, temperature, 1, boundary->computeTemperatureBatch.context.get()));
+    PetscCall(boundary->computeSpeedOfSoundBatch.function(numberFaces, conserved, totDim, temperature, 1, cache.speedOfSound.data(), 1, boundary->computeSpeedOfSoundBatch.context.get()));
+    PetscCall(boundary->computePressureFromTemperatureBatch.function(
+        numberFaces, conserved, totDim, temperature, 1, cache.pressure.data(), 1, boundary->computePressureFromTemperatureBatch.context.get()));
+    PetscCall(boundary->computeSpecificHeatConstantPressureBatch.function(
+        numberFaces, conserved, totDim, temperature, 1, cache.cp.data(), 1, boundary->computeSpecificHeatConstantPressureBatch.context.get()));
+    PetscCall(boundary->computeSpecificHeatConstantVolumeBatch.function(
+        numberFaces, conserved, totDim, temperature, 1, cache.cv.data(), 1, boundary->computeSpecificHeatConstantVolumeBatch.context.get()));
+    PetscCall(boundary->computeSensibleEnthalpyBatch.function(
+        numberFaces, conserved, totDim, temperature, 1, cache.sensibleEnthalpy.data(), 1, boundary->computeSensibleEnthalpyBatch.context.get()));
+    PetscCall(boundary->computePressureBatch.function(
+        numberStencilCells, cache.stencilConserved.data(), totDim, cache.stencilPressure.data(), 1, boundary->computePressureBatch.context.get()));
+
+    cache.valid = true;
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::boundarySolver::lodi::LODIBoundary::LODIPostRHS(BoundarySolver &, void *ctx) {
+    PetscFunctionBeginUser;
+    ((LODIBoundary *)ctx)->faceStateCache.valid = false;
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::boundarySolver::lodi::LODIBoundary::GetBoundaryState(const boundarySolver::BoundarySolver::BoundaryFVFaceGeom *fg, const PetscScalar *boundaryValues,
+                                                                            BoundaryState &state) const {
+    PetscFunctionBeginUser;
+    // use the batch computed values when available
+    if (faceStateCache.valid) {
+        if (auto index = faceStateCache.faceIndex.find(fg->faceId); index != faceStateCache.faceIndex.end()) {
+            const auto i = index->second;
+            state.temperature = faceStateCache.temperature[i];
+            state.speedOfSound = faceStateCache.speedOfSound[i];
+            state.pressure = faceStateCache.pressure[i];
+            state.cp = faceStateCache.cp[i];
+            state.cv = faceStateCache.cv[i];
+            state.sensibleEnthalpy = faceStateCache.sensibleEnthalpy[i];
+            PetscFunctionReturn(0);
+        }
+    }
+
+    // otherwise compute each value with the point functions
+    PetscCall(computeTemperature.function(boundaryValues, &state.temperature, computeTemperature.context.get()));
+    PetscCall(computeSpeedOfSound.function(boundaryValues, state.temperature, &state.speedOfSound, computeSpeedOfSound.context.get()));
+    PetscCall(computePressureFromTemperature.function(boundaryValues, state.temperature, &state.pressure, computePressureFromTemperature.context.get()));
+    PetscCall(computeSpecificHeatConstantPressure.function(boundaryValues, state.temperature, &state.cp, computeSpecificHeatConstantPressure.context.get()));
+    PetscCall(computeSpecificHeatConstantVolume.function(boundaryValues, state.temperature, &state.cv, computeSpecificHeatConstantVolume.context.get()));
+    PetscCall(computeSensibleEnthalpyFunction.function(boundaryValues, state.temperature, &state.sensibleEnthalpy, computeSensibleEnthalpyFunction.context.get()));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::boundarySolver::lodi::LODIBoundary::GetStencilPressures(const boundarySolver::BoundarySolver::BoundaryFVFaceGeom *fg, PetscInt stencilSize, const PetscScalar *stencilValues[],
+                                                                               PetscReal stencilPressure[]) const {
+    PetscFunctionBeginUser;
+    // use the batch computed values when available
+    if (faceStateCache.valid) {
+        if (auto index = faceStateCache.faceIndex.find(fg->faceId); index != faceStateCache.faceIndex.end()) {
+            PetscCall(PetscArraycpy(stencilPressure, faceStateCache.stencilPressure.data() + faceStateCache.stencilOffsets[index->second], stencilSize));
+            PetscFunctionReturn(0);
+        }
+    }
+
+    for (PetscInt s = 0; s < stencilSize; s++) {
+        PetscCall(computePressure.function(stencilValues[s], &stencilPressure[s], computePressure.context.get()));
+    }
+    PetscFunctionReturn(0);
 }
\ No newline at end of file
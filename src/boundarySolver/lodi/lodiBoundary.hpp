@@ -1,6 +1,8 @@
 #ifndef ABLATELIBRARY_LODIBOUNDARY_HPP
 #define ABLATELIBRARY_LODIBOUNDARY_HPP
 
+#include <unordered_map>
+#include <vector>
 #include "boundarySolver/boundaryProcess.hpp"
 #include "eos/eos.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
@@ -29,6 +31,28 @@ class LODIBoundary : public BoundaryProcess {
     void GetmdFdn(const PetscInt sOff[], const PetscReal* velNormCord, PetscReal rho, PetscReal T, PetscReal Cp, PetscReal Cv, PetscReal C, PetscReal Enth, PetscReal velnprm, PetscReal Cprm,
                   const PetscReal* conserved, const PetscInt uOff[], const PetscReal* sL, const PetscReal transformationMatrix[3][3], PetscReal* mdFdn) const;
 
+    /**
+     * The thermodynamic state of the boundary cell needed by each LODI boundary
+     */
+    struct BoundaryState {
+        PetscReal temperature = 0.0;
+        PetscReal speedOfSound = 0.0;
+        PetscReal pressure = 0.0;
+        PetscReal cp = 0.0;
+        PetscReal cv = 0.0;
+        PetscReal sensibleEnthalpy = 0.0;
+    };
+
+    /**
+     * Get the boundary state for this face from the batch computed cache, or compute it with the point functions if the face is not cached (i.e. when called directly in tests)
+     */
+    PetscErrorCode GetBoundaryState(const boundarySolver::BoundarySolver::BoundaryFVFaceGeom* fg, const PetscScalar* boundaryValues, BoundaryState& state) const;
+
+    /**
+     * Get the pressure at each stencil point from the batch computed cache, or compute it with the point function if the face is not cached
+     */
+    PetscErrorCode GetStencilPressures(const boundarySolver::BoundarySolver::BoundaryFVFaceGeom* fg, PetscInt stencilSize, const PetscScalar* stencilValues[], PetscReal stencilPressure[]) const;
+
     // Compute known/shared values
     PetscInt dims, nEqs, nSpecEqs, nEvEqs, eulerId, speciesId;
 
@@ -51,11 +75,75 @@ class LODIBoundary : public BoundaryProcess {
     eos::ThermodynamicTemperatureFunction computeSensibleEnthalpyFunction;
     eos::ThermodynamicFunction computePressure;
 
+    // Store the batch versions of the eos decode functions
+    eos::ThermodynamicBatchFunction computeTemperatureBatch;
+    eos::ThermodynamicTemperatureBatchFunction computePressureFromTemperatureBatch;
+    eos::ThermodynamicTemperatureBatchFunction computeSpeedOfSoundBatch;
+    eos::ThermodynamicTemperatureBatchFunction computeSpecificHeatConstantPressureBatch;
+    eos::ThermodynamicTemperatureBatchFunction computeSpecificHeatConstantVolumeBatch;
+    eos::ThermodynamicTemperatureBatchFunction computeSensibleEnthalpyBatch;
+    eos::ThermodynamicBatchFunction computePressureBatch;
+
+   private:
+    /**
+     * The boundary state of every face on this rank in structure of arrays order, computed with a single batch call for each property before each rhs evaluation
+     */
+    struct FaceStateCache {
+        //! map from the face id to the index in the cache
+        std::unordered_map<PetscInt, std::size_t> faceIndex;
+        //! the boundary cell for each face
+        std::vector<PetscInt> boundaryCells;
+        //! the stencil cells of each face in CSR order
+        std::vector<std::size_t> stencilOffsets;
+        std::vector<PetscInt> stencilCells;
+        //! the packed conserved values for the boundary and stencil cells
+        std::vector<PetscReal> boundaryConserved;
+        std::vector<PetscReal> stencilConserved;
+        //! the cached state for each face
+        std::vector<PetscReal> temperature;
+        std::vector<PetscReal> speedOfSound;
+        std::vector<PetscReal> pressure;
+        std::vector<PetscReal> cp;
+        std::vector<PetscReal> cv;
+        std::vector<PetscReal> sensibleEnthalpy;
+        //! the cached pressure for each stencil cell
+        std::vector<PetscReal> stencilPressure;
+        //! true from the pre rhs function until the end of the rhs evaluation that follows it
+        bool valid = false;
+    };
+    FaceStateCache faceStateCache;
+
+    /**
+     * Pre rhs function to compute the boundary state of every face with a single batch call for each property
+     */
+    static PetscErrorCode LODIBatchPreRHS(BoundarySolver&, TS ts, PetscReal time, bool initialStage, Vec locX, void* ctx);
+
+    /**
+     * Post rhs function to invalidate the boundary state so that later evaluations at a different state compute it from the current values
+     */
+    static PetscErrorCode LODIPostRHS(BoundarySolver&, void* ctx);
+
+    /**
+     * Dimension specific versions of the characteristic functions so the loops over dimension are unrolled
+     */
+    template <PetscInt DIM>
+    void GetEigenValues(PetscReal veln, PetscReal velnprm, PetscReal cprm, PetscReal lamda[]) const;
+
+    template <PetscInt DIM>
+    void GetmdFdn(const PetscInt sOff[], const PetscReal* velNormCord, PetscReal rho, PetscReal T, PetscReal Cp, PetscReal Cv, PetscReal C, PetscReal Enth, PetscReal velnprm, PetscReal Cprm,
+                  const PetscReal* conserved, const PetscInt uOff[], const PetscReal* sL, const PetscReal transformationMatrix[3][3], PetscReal* mdFdn) const;
+
    public:
     explicit LODIBoundary(std::shared_ptr<eos::EOS> eos, std::shared_ptr<finiteVolume::processes::PressureGradientScaling> pressureGradientScaling = {});
 
     void Setup(ablate::boundarySolver::BoundarySolver& bSolver) override;
 
+    /**
+     * Store the boundary and stencil cells of each face for the batch state evaluation
+     * @param bSolver
+     */
+    void Initialize(ablate::boundarySolver::BoundarySolver& bSolver) override;
+
     /**
      * This function directly sets the known values and is useful for testing
      * @param dims
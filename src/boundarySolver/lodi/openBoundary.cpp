@@ -14,7 +14,8 @@ ablate::boundarySolver::lodi::OpenBoundary::OpenBoundary(std::shared_ptr<eos::EO
 void ablate::boundarySolver::lodi::OpenBoundary::Setup(ablate::boundarySolver::BoundarySolver &bSolver) {
     ablate::boundarySolver::lodi::LODIBoundary::Setup(bSolver);
 
-    bSolver.RegisterFunction(OpenBoundaryFunction, this, fieldNames, fieldNames, {});
+    // the face state is read from the batch cache during the rhs evaluation, so the faces can be computed concurrently
+    bSolver.RegisterFunction(OpenBoundaryFunction, this, fieldNames, fieldNames, {}, BoundarySolver::BoundarySourceType::Point, false, true);
 }
 
 PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(PetscInt dim, const ablate::boundarySolver::BoundarySolver::BoundaryFVFaceGeom *fg, const PetscFVCellGeom *boundaryCell,
@@ -30,12 +31,10 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
 
     // Compute the pressure/values on the boundary
     PetscReal boundaryDensity;
-    PetscReal boundaryTemperature;
     PetscReal boundaryVel[3];
     PetscReal boundaryNormalVelocity = 0.0;
-    PetscReal boundarySpeedOfSound;
     PetscReal boundaryMach;
-    PetscReal boundaryPressure;
+    BoundaryState boundaryState;
 
     // Get the densityYi pointer if available
     const PetscScalar *boundaryDensityYi = boundary->nSpecEqs > 0 ? boundaryValues + uOff[boundary->speciesId] : nullptr;
@@ -47,67 +46,62 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
             boundaryVel[d] = boundaryValues[uOff[boundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / boundaryDensity;
             boundaryNormalVelocity += boundaryVel[d] * fg->normal[d];
         }
-        PetscErrorCode ierr = boundary->computeTemperature.function(boundaryValues, &boundaryTemperature, boundary->computeTemperature.context.get());
-        CHKERRQ(ierr);
-        ierr = boundary->computeSpeedOfSound.function(boundaryValues, boundaryTemperature, &boundarySpeedOfSound, boundary->computeSpeedOfSound.context.get());
-        CHKERRQ(ierr);
-        ierr = boundary->computePressureFromTemperature.function(boundaryValues, boundaryTemperature, &boundaryPressure, boundary->computePressureFromTemperature.context.get());
-        CHKERRQ(ierr);
-        boundaryMach = PetscAbs(boundaryNormalVelocity / boundarySpeedOfSound);
+        PetscCall(boundary->GetBoundaryState(fg, boundaryValues, boundaryState));
+        boundaryMach = PetscAbs(boundaryNormalVelocity / boundaryState.speedOfSound);
     }
+    const PetscReal boundaryTemperature = boundaryState.temperature;
+    const PetscReal boundarySpeedOfSound = boundaryState.speedOfSound;
+    const PetscReal boundaryPressure = boundaryState.pressure;
 
     // Map the boundary velocity into the normal coord system
     PetscReal boundaryVelNormCord[3];
     utilities::MathUtilities::Multiply(dim, transformationMatrix, boundaryVel, boundaryVelNormCord);
 
-    // Compute each stencil point
-    std::vector<PetscReal> stencilDensity(stencilSize);
-    std::vector<std::vector<PetscReal>> stencilVel(stencilSize, std::vector<PetscReal>(dim));
-    std::vector<std::vector<PetscReal>> stencilNormalCoordsVel(dim, std::vector<PetscReal>(stencilSize));  // NOTE this is [dim][stencil]
-    std::vector<PetscReal> stencilNormalVelocity(stencilSize, 0.0);
-    std::vector<PetscReal> stencilPressure(stencilSize);
-    std::vector<std::vector<PetscReal>> stencilYi(boundary->nSpecEqs, std::vector<PetscReal>(stencilSize));  // NOTE this is [sp][stencil]
-    std::vector<std::vector<PetscReal>> stencilEv(boundary->nEvEqs, std::vector<PetscReal>(stencilSize));    // NOTE this is [sp][stencil]
+    // Compute each stencil point, the values are stored in a single structure of arrays buffer [density, normal coords vel[dim], pressure, yi[nSpecEqs], ev[nEvEqs]][stencil]
+    std::vector<PetscReal> stencilScratch(stencilSize * (2 + dim + boundary->nSpecEqs + boundary->nEvEqs));
+    PetscReal *stencilDensity = stencilScratch.data();
+    PetscReal *stencilNormalCoordsVel = stencilDensity + stencilSize;  // NOTE this is [dim][stencil]
+    PetscReal *stencilPressure = stencilNormalCoordsVel + dim * stencilSize;
+    PetscReal *stencilYi = stencilPressure + stencilSize;                 // NOTE this is [sp][stencil]
+    PetscReal *stencilEv = stencilYi + boundary->nSpecEqs * stencilSize;  // NOTE this is [ev][stencil]
 
+    PetscCall(boundary->GetStencilPressures(fg, stencilSize, stencilValues, stencilPressure));
     for (PetscInt s = 0; s < stencilSize; s++) {
         stencilDensity[s] = stencilValues[s][uOff[boundary->eulerId] + finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal stencilVel[3];
         for (PetscInt d = 0; d < dim; d++) {
-            stencilVel[s][d] = stencilValues[s][uOff[boundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
-            stencilNormalVelocity[s] += stencilVel[s][d] * fg->normal[d];
+            stencilVel[d] = stencilValues[s][uOff[boundary->eulerId] + finiteVolume::CompressibleFlowFields::RHOU + d] / stencilDensity[s];
         }
-        PetscErrorCode ierr = boundary->computePressure.function(stencilValues[s], &stencilPressure[s], boundary->computePressure.context.get());
-        CHKERRQ(ierr);
 
         // Map the stencil velocity to a normal velocity
         PetscReal normalCoordsVel[3];
-        utilities::MathUtilities::Multiply(dim, transformationMatrix, &stencilVel[s][0], normalCoordsVel);
+        utilities::MathUtilities::Multiply(dim, transformationMatrix, stencilVel, normalCoordsVel);
 
         for (PetscInt d = 0; d < dim; d++) {
-            stencilNormalCoordsVel[d][s] = normalCoordsVel[d];
+            stencilNormalCoordsVel[d * stencilSize + s] = normalCoordsVel[d];
         }
 
         // Compute each of the species and ev
         for (PetscInt sp = 0; sp < boundary->nSpecEqs; sp++) {
-            stencilYi[sp][s] = stencilValues[s][uOff[boundary->speciesId] + sp] / stencilDensity[s];
+            stencilYi[sp * stencilSize + s] = stencilValues[s][uOff[boundary->speciesId] + sp] / stencilDensity[s];
         }
         int ne = 0;
         for (std::size_t ev = 0; ev < boundary->evIds.size(); ++ev) {
             for (PetscInt ec = 0; ec < boundary->nEvComps[ev]; ++ec) {
-                stencilEv[ne++][s] = stencilValues[s][uOff[boundary->evIds[ev]] + ec] / stencilDensity[s];
+                stencilEv[(ne++) * stencilSize + s] = stencilValues[s][uOff[boundary->evIds[ev]] + ec] / stencilDensity[s];
             }
         }
     }
 
     // Interpolate the normal velocity gradient to the surface
     PetscScalar dVeldNorm[3];
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryVelNormCord[0], stencilSize, &stencilNormalCoordsVel[0][0], stencilWeights, dVeldNorm[0]);
-    for (PetscInt d = 1; d < dim; d++) {
-        BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryVelNormCord[d], stencilSize, &stencilNormalCoordsVel[d][0], stencilWeights, dVeldNorm[d]);
+    for (PetscInt d = 0; d < dim; d++) {
+        BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryVelNormCord[d], stencilSize, stencilNormalCoordsVel + d * stencilSize, stencilWeights, dVeldNorm[d]);
     }
     PetscScalar dRhodNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryDensity, stencilSize, &stencilDensity[0], stencilWeights, dRhodNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryDensity, stencilSize, stencilDensity, stencilWeights, dRhodNorm);
     PetscScalar dPdNorm;
-    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, &stencilPressure[0], stencilWeights, dPdNorm);
+    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryPressure, stencilSize, stencilPressure, stencilWeights, dPdNorm);
 
     // compute boundary ev, yi
     std::vector<PetscReal> boundaryYi(boundary->nSpecEqs);
@@ -124,14 +118,10 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
         }
     }
 
-    // Compute the cp, cv from the eos
-    PetscReal boundaryCp, boundaryCv;
-    boundary->computeSpecificHeatConstantPressure.function(boundaryValues, boundaryTemperature, &boundaryCp, boundary->computeSpecificHeatConstantPressure.context.get());
-    boundary->computeSpecificHeatConstantVolume.function(boundaryValues, boundaryTemperature, &boundaryCv, boundary->computeSpecificHeatConstantVolume.context.get());
-
-    // Compute the enthalpy
-    PetscReal boundarySensibleEnthalpy;
-    boundary->computeSensibleEnthalpyFunction.function(boundaryValues, boundaryTemperature, &boundarySensibleEnthalpy, boundary->computeSensibleEnthalpyFunction.context.get());
+    // the cp, cv, and enthalpy from the eos
+    const PetscReal boundaryCp = boundaryState.cp;
+    const PetscReal boundaryCv = boundaryState.cv;
+    const PetscReal boundarySensibleEnthalpy = boundaryState.sensibleEnthalpy;
 
     // get_vel_and_c_prims(PGS, velwall[0], C, Cp, Cv, velnprm, Cprm);
     PetscReal velNormPrim, speedOfSoundPrim;
@@ -170,12 +160,12 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
                 };
                 for (int ns = 0; ns < boundary->nSpecEqs; ns++) {
                     PetscScalar dYidn;
-                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryYi[ns], stencilSize, stencilYi[ns].data(), stencilWeights, dYidn);
+                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryYi[ns], stencilSize, stencilYi + ns * stencilSize, stencilWeights, dYidn);
                     scriptL[2 + dim + ns] = lambda[2 + dim + ns] * dYidn;  // Species
                 }
                 for (int ne = 0; ne < boundary->nEvEqs; ne++) {
                     PetscScalar dEvdn;
-                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryEv[ne], stencilSize, stencilEv[ne].data(), stencilWeights, dEvdn);
+                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryEv[ne], stencilSize, stencilEv + ne * stencilSize, stencilWeights, dEvdn);
 
                     scriptL[2 + dim + boundary->nSpecEqs + ne] = lambda[2 + dim + boundary->nSpecEqs + ne] * dEvdn;  // Scalars
                 }
@@ -205,13 +195,13 @@ PetscErrorCode ablate::boundarySolver::lodi::OpenBoundary::OpenBoundaryFunction(
                 scriptL[1 + dim] = lambda[1 + dim] * (dPdNorm - boundaryDensity * alpha2 * dVeldNorm[0] * (velNormPrim - boundaryNormalVelocity - speedOfSoundPrim));
                 for (int ns = 0; ns < boundary->nSpecEqs; ns++) {
                     PetscScalar dYidn;
-                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryYi[ns], stencilSize, stencilYi[ns].data(), stencilWeights, dYidn);
+                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryYi[ns], stencilSize, stencilYi + ns * stencilSize, stencilWeights, dYidn);
 
                     scriptL[2 + dim + ns] = lambda[2 + dim + ns] * dYidn;  // Species
                 }
                 for (int ne = 0; ne < boundary->nEvEqs; ne++) {
                     PetscScalar dEvdn;
-                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryEv[ne], stencilSize, stencilEv[ne].data(), stencilWeights, dEvdn);
+                    BoundarySolver::ComputeGradientAlongNormal(dim, fg, boundaryEv[ne], stencilSize, stencilEv + ne * stencilSize, stencilWeights, dEvdn);
 
                     scriptL[2 + dim + boundary->nSpecEqs + ne] = lambda[2 + dim + boundary->nSpecEqs + ne] * dEvdn;  // Scalars
                 }
@@ -1,4 +1,5 @@
 #include "arbitrarySource.hpp"
+#include <algorithm>
 #include "utilities/vectorUtilities.hpp"
 ablate::boundarySolver::physics::ArbitrarySource::ArbitrarySource(std::map<std::string, std::shared_ptr<ablate::mathFunctions::MathFunction>> functions,
                                                                   ablate::boundarySolver::BoundarySolver::BoundarySourceType boundarySourceType)
@@ -10,8 +11,10 @@ ablate::boundarySolver::physics::ArbitrarySource::ArbitrarySource(std::map<std::
 void ablate::boundarySolver::physics::ArbitrarySource::Setup(ablate::boundarySolver::BoundarySolver &bSolver) {
     // Build the list of output components
     std::vector<std::string> sourceComponents;
+    timeInvariant.clear();
     for (const auto &function : functions) {
         sourceComponents.push_back(function.first);
+        timeInvariant.push_back(function.second->IsTimeInvariant());
     }
 
     bSolver.RegisterFunction(ArbitrarySourceFunction, this, sourceComponents, std::vector<std::string>{}, std::vector<std::string>{}, boundarySourceType);
@@ -25,6 +28,27 @@ void ablate::boundarySolver::physics::ArbitrarySource::Setup(ablate::boundarySol
     });
 }
 
+void ablate::boundarySolver::physics::ArbitrarySource::Initialize(ablate::boundarySolver::BoundarySolver &bSolver) {
+    if (std::none_of(timeInvariant.begin(), timeInvariant.end(), [](bool invariant) { return invariant; })) {
+        return;
+    }
+
+    // evaluate each time invariant function once at every boundary face
+    const auto dim = bSolver.GetSubDomain().GetDimensions();
+    faceIndex.clear();
+    faceValues.clear();
+    for (const auto &stencil : bSolver.GetBoundaryGeometry()) {
+        if (faceIndex.count(stencil.geometry.faceId)) {
+            continue;
+        }
+        faceIndex[stencil.geometry.faceId] = faceValues.size() / functions.size();
+        std::size_t functionCount = 0;
+        for (const auto &function : functions) {
+            faceValues.push_back(timeInvariant[functionCount++] ? function.second->Eval(stencil.geometry.centroid, (int)dim, 0.0) : 0.0);
+        }
+    }
+}
+
 PetscErrorCode ablate::boundarySolver::physics::ArbitrarySource::ArbitrarySourceFunction(PetscInt dim, const ablate::boundarySolver::BoundarySolver::BoundaryFVFaceGeom *fg,
                                                                                          const PetscFVCellGeom *boundaryCell, const PetscInt *uOff, const PetscScalar *boundaryValues,
                                                                                          const PetscScalar **stencilValues, const PetscInt *aOff, const PetscScalar *auxValues,
@@ -33,10 +57,19 @@ PetscErrorCode ablate::boundarySolver::physics::ArbitrarySource::ArbitrarySource
     PetscFunctionBeginUser;
     auto arbitrarySource = (ablate::boundarySolver::physics::ArbitrarySource *)ctx;
 
+    // use the cached values for the time invariant functions
+    const auto index = arbitrarySource->faceIndex.find(fg->faceId);
+    const PetscReal *faceValues = index != arbitrarySource->faceIndex.end() ? arbitrarySource->faceValues.data() + index->second * arbitrarySource->functions.size() : nullptr;
+
     // Keep track of the offset
     PetscInt functionCount = 0;
     for (const auto &function : arbitrarySource->functions) {
-        source[sOff[functionCount++]] = function.second->Eval(fg->centroid, dim, arbitrarySource->currentTime);
+        if (faceValues && arbitrarySource->timeInvariant[functionCount]) {
+            source[sOff[functionCount]] = faceValues[functionCount];
+        } else {
+            source[sOff[functionCount]] = function.second->Eval(fg->centroid, dim, arbitrarySource->currentTime);
+        }
+        functionCount++;
     }
 
     PetscFunctionReturn(0);
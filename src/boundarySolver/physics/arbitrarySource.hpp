@@ -1,6 +1,7 @@
 #ifndef ABLATELIBRARY_BOUNDARYARBITRARYSOURCE_HPP
 #define ABLATELIBRARY_BOUNDARYARBITRARYSOURCE_HPP
 
+#include <unordered_map>
 #include "boundarySolver/boundaryProcess.hpp"
 #include "eos/transport/transportModel.hpp"
 #include "finiteVolume/processes/navierStokesTransport.hpp"
@@ -27,6 +28,15 @@ class ArbitrarySource : public BoundaryProcess {
     //! current simulation time
     PetscReal currentTime = 0.0;
 
+    //! true for each function that does not depend upon time
+    std::vector<bool> timeInvariant;
+
+    //! the index of each boundary face in the cached values
+    std::unordered_map<PetscInt, std::size_t> faceIndex;
+
+    //! the time invariant function values at each face in [index*numberFunctions + function] order
+    std::vector<PetscReal> faceValues;
+
    public:
     explicit ArbitrarySource(std::map<std::string, std::shared_ptr<ablate::mathFunctions::MathFunction>> functions, BoundarySolver::BoundarySourceType boundarySourceType);
 
@@ -35,6 +45,12 @@ class ArbitrarySource : public BoundaryProcess {
      * @param bSolver
      */
     void Setup(ablate::boundarySolver::BoundarySolver &bSolver) override;
+
+    /**
+     * Compute the time invariant functions once at each face
+     * @param bSolver
+     */
+    void Initialize(ablate::boundarySolver::BoundarySolver &bSolver) override;
 };
 
 }  // namespace ablate::boundarySolver::physics
@@ -10,7 +10,8 @@ using fp = ablate::finiteVolume::CompressibleFlowFields;
 ablate::boundarySolver::physics::Sublimation::Sublimation(PetscReal latentHeatOfFusion, std::shared_ptr<ablate::eos::transport::TransportModel> transportModel, std::shared_ptr<ablate::eos::EOS> eos,
                                                           const std::shared_ptr<ablate::mathFunctions::FieldFunction> &massFractions, std::shared_ptr<mathFunctions::MathFunction> additionalHeatFlux,
                                                           std::shared_ptr<finiteVolume::processes::PressureGradientScaling> pressureGradientScaling, bool diffusionFlame,
-                                                          std::shared_ptr<ablate::radiation::Radiation> radiationIn, const std::shared_ptr<io::interval::Interval> &intervalIn)
+                                                          std::shared_ptr<ablate::radiation::Radiation> radiationIn, const std::shared_ptr<io::interval::Interval> &intervalIn,
+                                                          std::shared_ptr<monitors::logs::Log> log, bool implicit)
     : latentHeatOfFusion(latentHeatOfFusion),
       transportModel(std::move(transportModel)),
       eos(std::move(eos)),
@@ -21,7 +22,9 @@ ablate::boundarySolver::physics::Sublimation::Sublimation(PetscReal latentHeatOf
       diffusionFlame(diffusionFlame),
       pressureGradientScaling(std::move(pressureGradientScaling)),
       radiation(std::move(radiationIn)),
-      radiationInterval((intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>())) {}
+      radiationInterval((intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>())),
+      log(std::move(log)),
+      implicit(implicit) {}
 
 void ablate::boundarySolver::physics::Sublimation::Setup(ablate::boundarySolver::BoundarySolver &bSolver) {
     // check for species
@@ -31,8 +34,10 @@ void ablate::boundarySolver::physics::Sublimation::Setup(ablate::boundarySolver:
         inputFields.push_back(finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD);
     }
 
-    // register the required sublimantion function
-    bSolver.RegisterFunction(SublimationFunction, this, inputFields, inputFields, {finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD}, BoundarySolver::BoundarySourceType::Flux);
+    // register the required sublimantion function, optionally integrated implicitly so it does not limit the explicit time step.  The face properties are read from the
+    // batch cache during the rhs evaluation, so the faces can be computed concurrently
+    bSolver.RegisterFunction(
+        SublimationFunction, this, inputFields, inputFields, {finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD}, BoundarySolver::BoundarySourceType::Flux, implicit, true);
 
     // Register an optional output function
     bSolver.RegisterFunction(SublimationOutputFunction,
@@ -48,6 +53,8 @@ void ablate::boundarySolver::physics::Sublimation::Setup(ablate::boundarySolver:
     if (transportModel) {
         effectiveConductivity = transportModel->GetTransportTemperatureFunction(eos::transport::TransportProperty::Conductivity, bSolver.GetSubDomain().GetFields());
         viscosityFunction = transportModel->GetTransportTemperatureFunction(eos::transport::TransportProperty::Viscosity, bSolver.GetSubDomain().GetFields());
+        effectiveConductivityBatch = transportModel->GetTransportTemperatureBatchFunction(eos::transport::TransportProperty::Conductivity, bSolver.GetSubDomain().GetFields());
+        viscosityBatch = transportModel->GetTransportTemperatureBatchFunction(eos::transport::TransportProperty::Viscosity, bSolver.GetSubDomain().GetFields());
     }
 
     // If there is a additionalHeatFlux function, we need to update time
@@ -71,6 +78,8 @@ void ablate::boundarySolver::physics::Sublimation::Setup(ablate::boundarySolver:
 
     computeSensibleEnthalpy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SensibleEnthalpy, bSolver.GetSubDomain().GetFields());
     computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, bSolver.GetSubDomain().GetFields());
+    computeSensibleEnthalpyBatch = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::SensibleEnthalpy, bSolver.GetSubDomain().GetFields());
+    computePressureBatch = eos->GetThermodynamicTemperatureBatchFunction(eos::ThermodynamicProperty::Pressure, bSolver.GetSubDomain().GetFields());
 
     if (bSolver.GetSubDomain().ContainsField(finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD)) {
         bSolver.RegisterPreStep([this](auto ts, auto &solver) { UpdateSpecies(ts, solver); });
@@ -80,6 +89,12 @@ void ablate::boundarySolver::physics::Sublimation::Setup(ablate::boundarySolver:
     }
 }
 
+void ablate::boundarySolver::physics::Sublimation::AccumulateMemoryUsage(utilities::MemoryUsage &memoryUsage, const std::string &prefix) const {
+    if (radiation) {
+        radiation->AccumulateMemoryUsage(memoryUsage, prefix);
+    }
+}
+
 void ablate::boundarySolver::physics::Sublimation::Initialize(ablate::boundarySolver::BoundarySolver &bSolver) {
     /** Initialize the radiation solver with the face geometry of the boundary solver in order to solve for surface flux */
     if (radiation) {
@@ -97,8 +112,178 @@ void ablate::boundarySolver::physics::Sublimation::Initialize(ablate::boundarySo
         radiation->Setup(faceRange.GetRange(), bSolver.GetSubDomain());
         radiation->Initialize(faceRange.GetRange(), bSolver.GetSubDomain());  //!< Pass the non-dynamic range into the radiation solver
 
-        bSolver.RegisterPreRHSFunction(SublimationPreRHS, this);
+        // the radiation is solved on its own interval before the step so the rhs never waits on a radiation solve
+        bSolver.RegisterPreStep([this](auto ts, auto &solver) { UpdateRadiation(ts, solver); });
+        if (log) {
+            log->Initialize(bSolver.GetSubDomain().GetComm());
+        }
     }
+
+    // store the cells and centroid for each boundary face so the face properties can be computed in a single batch
+    const auto dim = bSolver.GetSubDomain().GetDimensions();
+    faceCache = FaceCache{};
+    for (const auto &stencil : bSolver.GetBoundaryGeometry()) {
+        if (stencil.stencil.empty()) {
+            continue;
+        }
+        faceCache.faceIndex[stencil.geometry.faceId] = faceCache.boundaryCells.size();
+        faceCache.boundaryCells.push_back(stencil.cellId);
+        faceCache.neighborCells.push_back(stencil.stencil.front());
+        faceCache.centroids.insert(faceCache.centroids.end(), stencil.geometry.centroid, stencil.geometry.centroid + dim);
+    }
+    bSolver.RegisterPreRHSFunction(SublimationBatchPreRHS, this);
+    bSolver.RegisterPostRHSFunction(SublimationPostRHS, this);
+
+    // size the surface intensity buffers
+    for (auto &buffer : surfaceIntensity) {
+        buffer.assign(faceCache.boundaryCells.size(), 0.0);
+    }
+    frontIntensity = 0;
+    intensityStep = -1;
+}
+
+PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationBatchPreRHS(BoundarySolver &solver, TS, PetscReal, bool, Vec locX, void *ctx) {
+    PetscFunctionBeginUser;
+    auto sublimation = (Sublimation *)ctx;
+    auto &cache = sublimation->faceCache;
+    const auto numberFaces = (PetscInt)cache.boundaryCells.size();
+    const auto &subDomain = solver.GetSubDomain();
+    const auto dim = subDomain.GetDimensions();
+    DM dm = subDomain.GetDM();
+    DM auxDm = subDomain.GetAuxDM();
+    const auto &temperatureField = subDomain.GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD);
+    PetscInt totDim;
+    PetscCall(PetscDSGetTotalDimension(subDomain.GetDiscreteSystem(), &totDim));
+
+    // pack the conserved values and temperature for the boundary and neighbor cells
+    cache.boundaryConserved.resize(numberFaces * totDim);
+    cache.neighborConserved.resize(numberFaces * totDim);
+    cache.boundaryTemperature.resize(numberFaces);
+    cache.neighborTemperature.resize(numberFaces);
+    const PetscScalar *locXArray, *auxArray;
+    PetscCall(VecGetArrayRead(locX, &locXArray));
+    PetscCall(VecGetArrayRead(subDomain.GetAuxVector(), &auxArray));
+    for (PetscInt i = 0; i < numberFaces; ++i) {
+        const PetscScalar *values, *temperature;
+        PetscCall(DMPlexPointLocalRead(dm, cache.boundaryCells[i], locXArray, &values));
+        PetscCall(PetscArraycpy(cache.boundaryConserved.data() + i * totDim, values, totDim));
+        PetscCall(DMPlexPointLocalFieldRead(auxDm, cache.boundaryCells[i], temperatureField.id, auxArray, &temperature));
+        cache.boundaryTemperature[i] = temperature[0];
+
+        PetscCall(DMPlexPointLocalRead(dm, cache.neighborCells[i], locXArray, &values));
+        PetscCall(PetscArraycpy(cache.neighborConserved.data() + i * totDim, values, totDim));
+        PetscCall(DMPlexPointLocalFieldRead(auxDm, cache.neighborCells[i], temperatureField.id, auxArray, &temperature));
+        cache.neighborTemperature[i] = temperature[0];
+    }
+    PetscCall(VecRestoreArrayRead(subDomain.GetAuxVector(), &auxArray));
+    PetscCall(VecRestoreArrayRead(locX, &locXArray));
+
+    // compute each property with a single batch call
+    cache.effectiveConductivity.assign(numberFaces, 0.0);
+    cache.viscosity.assign(numberFaces, 0.0);
+    cache.sensibleEnthalpy.assign(numberFaces, 0.0);
+    cache.pressure.assign(numberFaces, 0.0);
+    if (sublimation->effectiveConductivityBatch.function) {
+        PetscCall(sublimation->effectiveConductivityBatch.function(numberFaces,
+                                                                   cache.boundaryConserved.data(),
+                                                                   totDim,
+                                                                   cache.boundaryTemperature.data(),
+                                                                   1,
+                                                                   cache.effectiveConductivity.data(),
+                                                                   1,
+                                                                   sublimation->effectiveConductivityBatch.context.get()));
+    }
+    if (sublimation->viscosityBatch.function) {
+        PetscCall(sublimation->viscosityBatch.function(
+            numberFaces, cache.boundaryConserved.data(), totDim, cache.boundaryTemperature.data(), 1, cache.viscosity.data(), 1, sublimation->viscosityBatch.context.get()));
+    }
+    PetscCall(sublimation->computeSensibleEnthalpyBatch.function(numberFaces,
+                                                                 cache.boundaryConserved.data(),
+                                                                 totDim,
+                                                                 cache.boundaryTemperature.data(),
+                                                                 1,
+                                                                 cache.sensibleEnthalpy.data(),
+                                                                 1,
+                                                                 sublimation->computeSensibleEnthalpyBatch.context.get()));
+
+    // the first pressure in the stencil is always the node pressure on the face
+    if (!sublimation->diffusionFlame) {
+        PetscCall(sublimation->computePressureBatch.function(
+            numberFaces, cache.neighborConserved.data(), totDim, cache.neighborTemperature.data(), 1, cache.pressure.data(), 1, sublimation->computePressureBatch.context.get()));
+        if (sublimation->pressureGradientScaling) {
+            const auto alphaSquared = PetscSqr(sublimation->pressureGradientScaling->GetAlpha());
+            for (auto &pressure : cache.pressure) {
+                pressure /= alphaSquared;
+            }
+        }
+    }
+
+    // evaluate the additional heat flux and mass fractions at every face centroid as a single batch
+    cache.additionalHeatFlux.assign(numberFaces, 0.0);
+    try {
+        if (sublimation->additionalHeatFlux) {
+            sublimation->additionalHeatFlux->EvalBatch(cache.centroids.data(), numberFaces, (int)dim, sublimation->currentTime, cache.additionalHeatFlux.data(), 1, 1);
+        }
+        if (sublimation->massFractionsContext) {
+            cache.massFractions.resize(numberFaces * sublimation->numberSpecies);
+            sublimation->massFractions->GetFieldFunction()->EvalBatch(cache.centroids.data(),
+                                                                      numberFaces,
+                                                                      (int)dim,
+                                                                      sublimation->currentTime,
+                                                                      cache.massFractions.data(),
+                                                                      sublimation->numberSpecies,
+                                                                      sublimation->numberSpecies);
+        }
+    } catch (std::exception &exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+    }
+
+    cache.valid = true;
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationPostRHS(BoundarySolver &, void *ctx) {
+    PetscFunctionBeginUser;
+    ((Sublimation *)ctx)->faceCache.valid = false;
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::boundarySolver::physics::Sublimation::GetFaceProperties(PetscInt dim, const ablate::boundarySolver::BoundarySolver::BoundaryFVFaceGeom *fg, const PetscScalar *boundaryValues,
+                                                                               PetscReal boundaryTemperature, const PetscScalar *neighborValues, PetscReal neighborTemperature,
+                                                                               FaceProperties &properties) const {
+    PetscFunctionBeginUser;
+    // use the batch computed values when available
+    if (faceCache.valid) {
+        if (auto index = faceCache.faceIndex.find(fg->faceId); index != faceCache.faceIndex.end()) {
+            const auto i = index->second;
+            properties.effectiveConductivity = faceCache.effectiveConductivity[i];
+            properties.viscosity = faceCache.viscosity[i];
+            properties.sensibleEnthalpy = faceCache.sensibleEnthalpy[i];
+            properties.boundaryPressure = faceCache.pressure[i];
+            properties.additionalHeatFlux = faceCache.additionalHeatFlux[i];
+            properties.massFractions = massFractionsContext ? faceCache.massFractions.data() + i * numberSpecies : nullptr;
+            PetscFunctionReturn(0);
+        }
+    }
+
+    // otherwise compute each value with the point functions
+    if (effectiveConductivity.function) {
+        PetscCall(effectiveConductivity.function(boundaryValues, boundaryTemperature, &properties.effectiveConductivity, effectiveConductivity.context.get()));
+    }
+    if (viscosityFunction.function) {
+        PetscCall(viscosityFunction.function(boundaryValues, boundaryTemperature, &properties.viscosity, viscosityFunction.context.get()));
+    }
+    PetscCall(computeSensibleEnthalpy.function(boundaryValues, boundaryTemperature, &properties.sensibleEnthalpy, computeSensibleEnthalpy.context.get()));
+    if (!diffusionFlame) {
+        PetscCall(computePressure.function(neighborValues, neighborTemperature, &properties.boundaryPressure, computePressure.context.get()));
+        if (pressureGradientScaling) {
+            properties.boundaryPressure /= PetscSqr(pressureGradientScaling->GetAlpha());
+        }
+    }
+    if (additionalHeatFlux) {
+        properties.additionalHeatFlux = additionalHeatFlux->Eval(fg->centroid, (int)dim, currentTime);
+    }
+    PetscFunctionReturn(0);
 }
 
 PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationFunction(PetscInt dim, const ablate::boundarySolver::BoundarySolver::BoundaryFVFaceGeom *fg,
@@ -123,25 +308,18 @@ PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationFunction
     PetscReal dTdn;
     BoundarySolver::ComputeGradientAlongNormal(dim, fg, auxValues[aOff[TEMPERATURE_LOC]], stencilSize, stencilTemperature.data(), stencilWeights, dTdn);
 
-    // compute the effectiveConductivity
-    PetscReal effectiveConductivity = 0.0;
-    if (sublimation->effectiveConductivity.function) {
-        PetscCall(sublimation->effectiveConductivity.function(boundaryValues, auxValues[aOff[TEMPERATURE_LOC]], &effectiveConductivity, sublimation->effectiveConductivity.context.get()));
-    }
+    // get the transport, eos, and heat flux properties for this face
+    FaceProperties properties;
+    PetscCall(sublimation->GetFaceProperties(dim, fg, boundaryValues, auxValues[aOff[TEMPERATURE_LOC]], stencilValues[0], stencilAuxValues[0][aOff[TEMPERATURE_LOC]], properties));
 
     // Use the solution from the radiation solve.
-    PetscReal radIntensity = 0;
-    if (sublimation->radiation) {
-        radIntensity = sublimation->radiation->GetIntensity(fg->faceId);
-    }
+    PetscReal radIntensity = sublimation->GetSurfaceIntensity(fg->faceId);
 
     // compute the heat flux. Add the radiation heat flux for this face intensity if the radiation solver exists
-    PetscReal conductionIntoSolid = -dTdn * effectiveConductivity;
+    PetscReal conductionIntoSolid = -dTdn * properties.effectiveConductivity;
     PetscReal sublimationHeatFlux = PetscMax(0.0, conductionIntoSolid + radIntensity);  // note that q = -dTdn as dTdN faces into the solid
-    // If there is an additional heat flux compute and add value
-    if (sublimation->additionalHeatFlux) {
-        sublimationHeatFlux += sublimation->additionalHeatFlux->Eval(fg->centroid, (int)dim, sublimation->currentTime);
-    }
+    // If there is an additional heat flux add value
+    sublimationHeatFlux += properties.additionalHeatFlux;
 
     // Compute the massFlux (we can only remove mass)
     PetscReal massFlux = sublimationHeatFlux / sublimation->latentHeatOfFusion;
@@ -177,15 +355,9 @@ PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationFunction
         }
     }
 
-    // compute the effectiveConductivity
-    PetscReal viscosity = 0.0;
-    if (sublimation->viscosityFunction.function) {
-        PetscCall(sublimation->viscosityFunction.function(boundaryValues, auxValues[aOff[TEMPERATURE_LOC]], &viscosity, sublimation->viscosityFunction.context.get()));
-    }
-
     // Compute the stress tensor tau
     PetscReal tau[9];  // Maximum size without symmetry
-    PetscCall(ablate::finiteVolume::processes::NavierStokesTransport::CompressibleFlowComputeStressTensor(dim, viscosity, gradBoundaryVelocity, tau));
+    PetscCall(ablate::finiteVolume::processes::NavierStokesTransport::CompressibleFlowComputeStressTensor(dim, properties.viscosity, gradBoundaryVelocity, tau));
 
     // Add the source term, kg/s for rho
     source[sOff[EULER_LOC] + fp::RHO] = massFlux * area;
@@ -193,14 +365,10 @@ PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationFunction
     // Add each momentum flux
     PetscReal momentumFlux = 0.0;
 
-    // compute the pressure on the face.  The first pressure in the stencil is always the node pressure on the face
-    PetscReal boundaryPressure = 0.0;
+    // the pressure on the face.  The first pressure in the stencil is always the node pressure on the face
+    const PetscReal boundaryPressure = properties.boundaryPressure;
     if (!sublimation->diffusionFlame) {
-        PetscCall(sublimation->computePressure.function(stencilValues[0], stencilAuxValues[0][aOff[TEMPERATURE_LOC]], &boundaryPressure, sublimation->computePressure.context.get()));
         momentumFlux = massFlux * massFlux / boundaryDensity;
-        if (sublimation->pressureGradientScaling) {
-            boundaryPressure /= PetscSqr(sublimation->pressureGradientScaling->GetAlpha());
-        }
 
         // And the mom flux for each dir by g
         for (PetscInt dir = 0; dir < dim; dir++) {
@@ -213,19 +381,19 @@ PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationFunction
         }
     }
 
-    // compute the sensible enthalpy
-    PetscReal sensibleEnthalpy;
-    PetscCall(sublimation->computeSensibleEnthalpy.function(boundaryValues, auxValues[aOff[TEMPERATURE_LOC]], &sensibleEnthalpy, sublimation->computeSensibleEnthalpy.context.get()));
-
     // Energy term
-    source[sOff[EULER_LOC] + fp::RHOE] = (massFlux * sensibleEnthalpy - conductionIntoSolid) * area;
+    source[sOff[EULER_LOC] + fp::RHOE] = (massFlux * properties.sensibleEnthalpy - conductionIntoSolid) * area;
 
     // Add in species
     if (sublimation->massFractionsContext) {
         // Fill the source with the mass fractions
-        PetscErrorCode ierr =
-            sublimation->massFractionsFunction(dim, sublimation->currentTime, fg->centroid, sublimation->numberSpecies, source + sOff[DENSITY_YI_LOC], sublimation->massFractionsContext);
-        CHKERRQ(ierr);
+        if (properties.massFractions) {
+            PetscCall(PetscArraycpy(source + sOff[DENSITY_YI_LOC], properties.massFractions, sublimation->numberSpecies));
+        } else {
+            PetscErrorCode ierr =
+                sublimation->massFractionsFunction(dim, sublimation->currentTime, fg->centroid, sublimation->numberSpecies, source + sOff[DENSITY_YI_LOC], sublimation->massFractionsContext);
+            CHKERRQ(ierr);
+        }
 
         // Scale the mass fractions by massFlux*area
         for (PetscInt sp = 0; sp < sublimation->numberSpecies; sp++) {
@@ -262,29 +430,20 @@ PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationOutputFu
     PetscReal dTdn;
     BoundarySolver::ComputeGradientAlongNormal(dim, fg, auxValues[aOff[TEMPERATURE_LOC]], stencilSize, stencilTemperature.data(), stencilWeights, dTdn);
 
-    // compute the effectiveConductivity
-    PetscReal effectiveConductivity = 0.0;
-    if (sublimation->effectiveConductivity.function) {
-        PetscCall(sublimation->effectiveConductivity.function(boundaryValues, auxValues[aOff[TEMPERATURE_LOC]], &effectiveConductivity, sublimation->effectiveConductivity.context.get()));
-    }
+    // get the transport, eos, and heat flux properties for this face
+    FaceProperties properties;
+    PetscCall(sublimation->GetFaceProperties(dim, fg, boundaryValues, auxValues[aOff[TEMPERATURE_LOC]], stencilValues[0], stencilAuxValues[0][aOff[TEMPERATURE_LOC]], properties));
 
-    PetscReal radIntensity = 0;
-    if (sublimation->radiation) {
-        radIntensity = sublimation->radiation->GetIntensity(fg->faceId);
-    }
+    PetscReal radIntensity = sublimation->GetSurfaceIntensity(fg->faceId);
 
     // compute the heat flux
-    PetscReal heatFluxIntoSolid = -dTdn * effectiveConductivity;
+    PetscReal heatFluxIntoSolid = -dTdn * properties.effectiveConductivity;
     source[sOff[RAD_LOC]] = radIntensity;
     source[sOff[CONDUCTION_LOC]] = heatFluxIntoSolid;
     PetscReal sublimationHeatFlux = PetscMax(0.0, heatFluxIntoSolid + radIntensity);  // note that q = -dTdn as dTdN faces into the solid
-    // If there is an additional heat flux compute and add value
-    PetscReal additionalHeatFlux = 0.0;
-    if (sublimation->additionalHeatFlux) {
-        additionalHeatFlux = sublimation->additionalHeatFlux->Eval(fg->centroid, (int)dim, sublimation->currentTime);
-        sublimationHeatFlux += additionalHeatFlux;
-    }
-    source[sOff[EXTRA_RAD_LOC]] = additionalHeatFlux;
+    // If there is an additional heat flux add value
+    sublimationHeatFlux += properties.additionalHeatFlux;
+    source[sOff[EXTRA_RAD_LOC]] = properties.additionalHeatFlux;
 
     // Compute the massFlux (we can only remove mass)
     source[sOff[REGRESSION_MASS_FLUX_LOC]] = sublimationHeatFlux / sublimation->latentHeatOfFusion;
@@ -301,17 +460,33 @@ void ablate::boundarySolver::physics::Sublimation::Setup(PetscInt numberSpeciesI
     computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, {});
 }
 
-PetscErrorCode ablate::boundarySolver::physics::Sublimation::SublimationPreRHS(BoundarySolver &solver, TS ts, PetscReal time, bool initialStage, Vec locX, void *ctx) {
-    PetscFunctionBegin;
-    auto sublimation = (Sublimation *)ctx;
+void ablate::boundarySolver::physics::Sublimation::UpdateRadiation(TS ts, ablate::solver::Solver &solver) {
     PetscInt step;
+    PetscReal time;
     TSGetStepNumber(ts, &step) >> checkError;
     TSGetTime(ts, &time) >> checkError;
-    if (initialStage && sublimation->radiationInterval->Check(PetscObjectComm((PetscObject)ts), step, time)) {
-        sublimation->radiation->EvaluateGains(solver.GetSubDomain().GetSolutionVector(), solver.GetSubDomain().GetField("temperature"), solver.GetSubDomain().GetAuxVector());
+
+    // always solve if the intensity has never been computed
+    if (intensityStep < 0 || radiationInterval->Check(PetscObjectComm((PetscObject)ts), step, time)) {
+        const auto &subDomain = solver.GetSubDomain();
+        radiation->EvaluateGains(subDomain.GetSolutionVector(), subDomain.GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD), subDomain.GetAuxVector());
+        radiation->Solve(subDomain.GetSolutionVector(), subDomain.GetField(finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD), subDomain.GetAuxVector());
+
+        // fill the back buffer and swap once it is complete
+        auto &backBuffer = surfaceIntensity[1 - frontIntensity];
+        for (const auto &[faceId, index] : faceCache.faceIndex) {
+            backBuffer[index] = radiation->GetIntensity(faceId);
+        }
+        frontIntensity = 1 - frontIntensity;
+        intensityStep = step;
+    }
+
+    if (log) {
+        log->Printf("Sublimation surface radiation intensity at step %" PetscInt_FMT " was computed at step %" PetscInt_FMT " (%" PetscInt_FMT " steps old)\n",
+                    step,
+                    intensityStep,
+                    step - intensityStep);
     }
-    sublimation->radiation->Solve(solver.GetSubDomain().GetSolutionVector(), solver.GetSubDomain().GetField("temperature"), solver.GetSubDomain().GetAuxVector());
-    PetscFunctionReturn(0);
 }
 
 void ablate::boundarySolver::physics::Sublimation::UpdateSpecies(TS ts, ablate::solver::Solver &solver) {
@@ -393,4 +568,8 @@ REGISTER(ablate::boundarySolver::BoundaryProcess, ablate::boundarySolver::physic
          OPT(ablate::finiteVolume::processes::PressureGradientScaling, "pgs", "Pressure gradient scaling is used to scale the acoustic propagation speed and increase time step for low speed flows"),
          OPT(bool, "diffusionFlame", "disables contribution to the momentum equation. Should be true when advection is not solved. (Default is false)"),
          OPT(ablate::radiation::Radiation, "radiation", "radiation instance for the sublimation solver to calculate heat flux"),
-         OPT(ablate::io::interval::Interval, "radiationInterval", "number of time steps between the radiation solves"));
+         OPT(ablate::io::interval::Interval, "radiationInterval", "number of time steps between the radiation solves, the surface intensity is held between solves"),
+         OPT(ablate::monitors::logs::Log, "log", "optional log to report the staleness of the surface radiation intensity"),
+         OPT(bool, "implicit",
+             "when true the sublimation source and its cell block jacobian are added to the ts implicit function so it can be integrated with an imex ts. The aux temperature is lagged "
+             "(Default is false)"));
@@ -1,12 +1,16 @@
 #ifndef ABLATELIBRARY_SUBLIMATION_HPP
 #define ABLATELIBRARY_SUBLIMATION_HPP
 
+#include <array>
+#include <unordered_map>
+#include <vector>
 #include "boundarySolver/boundaryProcess.hpp"
 #include "eos/radiationProperties/zimmer.hpp"
 #include "eos/transport/transportModel.hpp"
 #include "finiteVolume/processes/navierStokesTransport.hpp"
 #include "finiteVolume/processes/pressureGradientScaling.hpp"
 #include "io/interval/interval.hpp"
+#include "monitors/logs/log.hpp"
 #include "radiation/radiation.hpp"
 namespace ablate::boundarySolver::physics {
 
@@ -73,20 +77,113 @@ class Sublimation : public BoundaryProcess {
      */
     const std::shared_ptr<io::interval::Interval> radiationInterval;
 
+    /**
+     * Double buffered surface radiation intensity for each cached face.  The rhs only reads the front buffer, the back buffer is filled by the radiation solve and swapped when complete.
+     */
+    std::array<std::vector<PetscReal>, 2> surfaceIntensity;
+    std::size_t frontIntensity = 0;
+
+    //! the step of the last radiation update used to report the staleness of the surface intensity
+    PetscInt intensityStep = -1;
+
+    //! optional log to report the radiation update cadence
+    const std::shared_ptr<monitors::logs::Log> log;
+
+    //! integrate the sublimation source through the ts implicit function
+    const bool implicit;
+
+    /**
+     * the batch versions of the transport and eos functions used to compute the properties of every boundary face at once
+     */
+    eos::ThermodynamicTemperatureBatchFunction effectiveConductivityBatch;
+    eos::ThermodynamicTemperatureBatchFunction viscosityBatch;
+    eos::ThermodynamicTemperatureBatchFunction computeSensibleEnthalpyBatch;
+    eos::ThermodynamicTemperatureBatchFunction computePressureBatch;
+
+    /**
+     * The face properties computed for every boundary face of this rank before each rhs evaluation.  The packed inputs are reused between evaluations.
+     */
+    struct FaceCache {
+        //! map from the face id to the index in the cache
+        std::unordered_map<PetscInt, std::size_t> faceIndex;
+        //! the boundary cell, the neighbor (first stencil) cell, and the centroid of each face
+        std::vector<PetscInt> boundaryCells;
+        std::vector<PetscInt> neighborCells;
+        std::vector<PetscReal> centroids;
+        //! the packed conserved values and temperature for the boundary and neighbor cells
+        std::vector<PetscReal> boundaryConserved;
+        std::vector<PetscReal> boundaryTemperature;
+        std::vector<PetscReal> neighborConserved;
+        std::vector<PetscReal> neighborTemperature;
+        //! the cached properties for each face
+        std::vector<PetscReal> effectiveConductivity;
+        std::vector<PetscReal> viscosity;
+        std::vector<PetscReal> sensibleEnthalpy;
+        std::vector<PetscReal> pressure;
+        std::vector<PetscReal> additionalHeatFlux;
+        std::vector<PetscReal> massFractions;
+        //! true from the pre rhs function until the end of the rhs evaluation that follows it
+        bool valid = false;
+    };
+    FaceCache faceCache;
+
+    /**
+     * the properties used by the SublimationFunction and SublimationOutputFunction for a single face
+     */
+    struct FaceProperties {
+        PetscReal effectiveConductivity = 0.0;
+        PetscReal viscosity = 0.0;
+        PetscReal sensibleEnthalpy = 0.0;
+        PetscReal boundaryPressure = 0.0;
+        PetscReal additionalHeatFlux = 0.0;
+        //! the cached mass fractions or nullptr if they must be computed
+        const PetscReal *massFractions = nullptr;
+    };
+
+    /**
+     * Get the face properties from the cache, or compute them with the point functions if the face is not cached (i.e. when called directly in tests)
+     */
+    PetscErrorCode GetFaceProperties(PetscInt dim, const ablate::boundarySolver::BoundarySolver::BoundaryFVFaceGeom *fg, const PetscScalar *boundaryValues, PetscReal boundaryTemperature,
+                                     const PetscScalar *neighborValues, PetscReal neighborTemperature, FaceProperties &properties) const;
+
     /**
      * Set the species densityYi based upon the blowing rate.  Update the energy if needed to maintain temperature
      */
     void UpdateSpecies(TS ts, ablate::solver::Solver &);
 
+    /**
+     * Prestep to solve the radiation on the radiationInterval and swap the surface intensity buffers.  The radiation is not solved during the rhs evaluation.
+     */
+    void UpdateRadiation(TS ts, ablate::solver::Solver &);
+
+    /**
+     * Get the surface radiation intensity from the front buffer, falling back to the radiation solver for faces that are not cached
+     */
+    inline PetscReal GetSurfaceIntensity(PetscInt faceId) const {
+        if (!radiation) {
+            return 0.0;
+        }
+        if (auto index = faceCache.faceIndex.find(faceId); index != faceCache.faceIndex.end() && intensityStep >= 0) {
+            return surfaceIntensity[frontIntensity][index->second];
+        }
+        return radiation->GetIntensity(faceId);
+    }
+
    public:
     explicit Sublimation(PetscReal latentHeatOfFusion, std::shared_ptr<ablate::eos::transport::TransportModel> transportModel, std::shared_ptr<ablate::eos::EOS> eos,
                          const std::shared_ptr<ablate::mathFunctions::FieldFunction> & = {}, std::shared_ptr<mathFunctions::MathFunction> additionalHeatFlux = {},
                          std::shared_ptr<finiteVolume::processes::PressureGradientScaling> pressureGradientScaling = {}, bool diffusionFlame = false,
-                         std::shared_ptr<ablate::radiation::Radiation> radiationIn = {}, const std::shared_ptr<io::interval::Interval> &intervalIn = {});
+                         std::shared_ptr<ablate::radiation::Radiation> radiationIn = {}, const std::shared_ptr<io::interval::Interval> &intervalIn = {},
+                         std::shared_ptr<monitors::logs::Log> log = {}, bool implicit = false);
 
     void Setup(ablate::boundarySolver::BoundarySolver &bSolver) override;
     void Initialize(ablate::boundarySolver::BoundarySolver &bSolver) override;
 
+    /**
+     * Add the radiation rays to the memory usage
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage &memoryUsage, const std::string &prefix) const override;
+
     /**
      * manual Setup used for testing
      * @param numberSpecies
@@ -94,12 +191,23 @@ class Sublimation : public BoundaryProcess {
     void Setup(PetscInt numberSpecies);
 
     /**
-     * Prestep to update the radiation solver
+     * Pre rhs function to compute the transport, eos, heat flux, and mass fraction properties of every boundary face with a single batch call for each property
      * @param ts
-     * @param solver
+     * @param time
+     * @param initialStage
+     * @param locX
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode SublimationBatchPreRHS(BoundarySolver &, TS ts, PetscReal time, bool initialStage, Vec locX, void *ctx);
+
+    /**
+     * Post rhs function to invalidate the face properties so that later evaluations at a different state (i.e. the implicit function and jacobian) compute them from the
+     * current values
+     * @param ctx
      * @return
      */
-    static PetscErrorCode SublimationPreRHS(BoundarySolver &, TS ts, PetscReal time, bool initialStage, Vec locX, void *ctx);
+    static PetscErrorCode SublimationPostRHS(BoundarySolver &, void *ctx);
 
     /**
      * Support function to compute and insert source terms for this boundary condition
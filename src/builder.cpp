@@ -1,4 +1,5 @@
 #include "builder.hpp"
+#include "monitors/ignitionDelayStudy.hpp"
 #include "monitors/monitor.hpp"
 #include "solver/solver.hpp"
 #include "solver/timeStepper.hpp"
@@ -11,6 +12,14 @@ void ablate::Builder::Run(std::shared_ptr<cppParser::Factory> parser) {
         globalArguments->Fill(nullptr);
     }
 
+    // an optional batched ignition delay study runs before, or in place of, the time stepper
+    if (parser->Contains("ignitionDelayStudy")) {
+        parser->GetByName<monitors::IgnitionDelayStudy>("ignitionDelayStudy")->Run();
+        if (!parser->Contains("timestepper")) {
+            return;
+        }
+    }
+
     // create a time stepper
     auto timeStepper = parser->Get(cppParser::ArgumentIdentifier<solver::TimeStepper>{.inputName = "timestepper"});
 
@@ -1,11 +1,17 @@
 #include "cadFile.hpp"
+#include <petscviewerhdf5.h>
+#include <set>
+#include <sstream>
+#include "environment/fileBroadcast.hpp"
+#include "utilities/mpiError.hpp"
 #include "utilities/petscError.hpp"
 #include "utilities/petscOptions.hpp"
+#include "utilities/stringUtilities.hpp"
 
 ablate::domain::CadFile::CadFile(const std::string& nameIn, const std::filesystem::path& pathIn, std::vector<std::shared_ptr<FieldDescriptor>> fieldDescriptors, std::string generator,
                                  std::vector<std::shared_ptr<modifiers::Modifier>> modifiers, const std::shared_ptr<parameters::Parameters>& options,
-                                 const std::shared_ptr<parameters::Parameters>& surfaceOptions)
-    : Domain(ReadDMFromCadFile(nameIn, pathIn, surfaceOptions, generator, surfacePetscOptions, surfaceDm), nameIn, std::move(fieldDescriptors), std::move(modifiers), options) {
+                                 const std::shared_ptr<parameters::Parameters>& surfaceOptions, const std::filesystem::path& meshCacheDirectory)
+    : Domain(ReadDMFromCadFile(nameIn, pathIn, surfaceOptions, generator, surfacePetscOptions, surfaceDm, meshCacheDirectory), nameIn, std::move(fieldDescriptors), std::move(modifiers), options) {
     // make sure that dm_refine was not set
     if (surfaceOptions) {
         if (surfaceOptions->Get("dm_refine", 0) != 0) {
@@ -27,11 +33,41 @@ ablate::domain::CadFile::~CadFile() {
     }
 }
 
-DM ablate::domain::CadFile::ReadDMFromCadFile(const std::string& name, const std::filesystem::path& path, const std::shared_ptr<parameters::Parameters>& surfaceOptions, const std::string& generator,
-                                              PetscOptions& surfacePetscOptions, DM& surfaceDm) {
+DM ablate::domain::CadFile::ReadDMFromCadFile(const std::string& name, const std::filesystem::path& cadPath, const std::shared_ptr<parameters::Parameters>& surfaceOptions,
+                                              const std::string& generator, PetscOptions& surfacePetscOptions, DM& surfaceDm, const std::filesystem::path& meshCacheDirectory) {
     surfacePetscOptions = nullptr;
     surfaceDm = nullptr;
 
+    // each rank loads a chunk of the cached volumetric mesh, it is then partitioned when distributed
+    DM dm;
+    std::filesystem::path meshCache;
+    if (!meshCacheDirectory.empty()) {
+        meshCache = GetMeshCachePath(name, cadPath, surfaceOptions, generator, meshCacheDirectory);
+
+        // the load and generate paths are both collective, so the root rank decides which one every rank takes
+        PetscMPIInt rank;
+        MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> checkMpiError;
+        int cacheExists = rank == 0 ? (int)std::filesystem::exists(meshCache) : 0;
+        MPI_Bcast(&cacheExists, 1, MPI_INT, 0, PETSC_COMM_WORLD) >> checkMpiError;
+        if (cacheExists) {
+            DMCreate(PETSC_COMM_WORLD, &dm) >> checkError;
+            DMSetType(dm, DMPLEX) >> checkError;
+            PetscObjectSetName((PetscObject)dm, name.c_str()) >> checkError;
+
+            PetscViewer viewer;
+            PetscViewerHDF5Open(PETSC_COMM_WORLD, meshCache.c_str(), FILE_MODE_READ, &viewer) >> checkError;
+            PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC) >> checkError;
+            DMLoad(dm, viewer) >> checkError;
+            PetscViewerPopFormat(viewer) >> checkError;
+            PetscViewerDestroy(&viewer) >> checkError;
+            DMPlexSetRefinementUniform(dm, PETSC_TRUE) >> checkError;
+            return dm;
+        }
+    }
+
+    // when broadcasting files only the root rank reads the cad file from the shared file system
+    const auto path = environment::FileBroadcast::Localize(cadPath);
+
     // check the path to make sure it is there
     if (!exists(path)) {
         throw std::invalid_argument("Cannot locate CAD file " + path.string());
@@ -55,19 +91,49 @@ DM ablate::domain::CadFile::ReadDMFromCadFile(const std::string& name, const std
     DMViewFromOptions(surfaceDm, nullptr, surfaceDmViewString.c_str());
 
     // with the surface mesh created, compute the volumetric dm
-    DM dm;
     DMPlexGenerate(surfaceDm, generator.empty() ? "tetgen" : generator.c_str(), PETSC_TRUE, &dm) >> checkError;
     PetscObjectSetName((PetscObject)dm, name.c_str()) >> checkError;
     DMPlexSetRefinementUniform(dm, PETSC_TRUE) >> checkError;
 
     // inflate the mesh
     DMPlexInflateToGeomModel(dm) >> checkError;
+
+    // save the inflated mesh in the petsc hdf5 format so it can be read in parallel next time
+    if (!meshCache.empty()) {
+        std::filesystem::create_directories(meshCacheDirectory);
+        PetscViewer viewer;
+        PetscViewerHDF5Open(PETSC_COMM_WORLD, meshCache.c_str(), FILE_MODE_WRITE, &viewer) >> checkError;
+        PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC) >> checkError;
+        DMView(dm, viewer) >> checkError;
+        PetscViewerPopFormat(viewer) >> checkError;
+        PetscViewerDestroy(&viewer) >> checkError;
+    }
     return dm;
 }
 
+std::filesystem::path ablate::domain::CadFile::GetMeshCachePath(const std::string& name, const std::filesystem::path& path, const std::shared_ptr<parameters::Parameters>& surfaceOptions,
+                                                                const std::string& generator, const std::filesystem::path& meshCacheDirectory) {
+    // the contents of the cad file, so an edited geometry with the same name is regenerated
+    std::stringstream description;
+    description << environment::FileBroadcast::ReadContents(path) << "|" << (generator.empty() ? "tetgen" : generator);
+
+    // the surface options in a repeatable order
+    if (surfaceOptions) {
+        auto keys = surfaceOptions->GetKeys();
+        for (const auto& key : std::set<std::string>(keys.begin(), keys.end())) {
+            description << "|" << key << "=" << surfaceOptions->GetString(key).value_or("");
+        }
+    }
+
+    return meshCacheDirectory / (name + "." + utilities::StringUtilities::Hash(description.str()) + ".h5");
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::domain::Domain, ablate::domain::CadFile, "read a cad from a file", ARG(std::string, "name", "the name of the domain/mesh object"),
          ARG(std::filesystem::path, "path", "the path to the cad file"), OPT(std::vector<ablate::domain::FieldDescriptor>, "fields", "a list of fields/field descriptors"),
          OPT(std::string, "generator", "the mesh generation package name (default is 'tetgen')"), OPT(std::vector<ablate::domain::modifiers::Modifier>, "modifiers", "a list of domain modifier"),
          OPT(ablate::parameters::Parameters, "options", "PETSc options specific to this dm.  Default value allows the dm to access global options."),
-         OPT(ablate::parameters::Parameters, "surfaceOptions", "PETSc options specific to the temporary surface dm.  Default value allows the dm to access global options."));
+         OPT(ablate::parameters::Parameters, "surfaceOptions", "PETSc options specific to the temporary surface dm.  Default value allows the dm to access global options."),
+         OPT(std::filesystem::path, "meshCache",
+             "optional directory holding hdf5 copies of the generated volumetric mesh keyed by the cad file contents, generator, and surface options.  A cached mesh is read in parallel "
+             "instead of regenerating it."));
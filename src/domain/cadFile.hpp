@@ -9,20 +9,27 @@ namespace ablate::domain {
 
 class CadFile : public Domain {
    private:
-    //! read in the cad file and expand to volumetric mesh
+    //! read in the cad file and expand to volumetric mesh, or load the volumetric mesh from the cache directory if it was already generated
     static DM ReadDMFromCadFile(const std::string& name, const std::filesystem::path& path, const std::shared_ptr<parameters::Parameters>& surfaceOptions, const std::string& generator,
-                                PetscOptions& surfacePetscOptions, DM& surfaceDm);
+                                PetscOptions& surfacePetscOptions, DM& surfaceDm, const std::filesystem::path& meshCacheDirectory);
+
+    /**
+     * Compute the cache file name for the generated mesh.  The key hashes the cad file contents, generator, and surface options so any change
+     * regenerates the mesh.  The cad file is read through the FileBroadcast so it is only read once with --broadcastFiles.  Must be called by every rank.
+     */
+    static std::filesystem::path GetMeshCachePath(const std::string& name, const std::filesystem::path& path, const std::shared_ptr<parameters::Parameters>& surfaceOptions,
+                                                  const std::string& generator, const std::filesystem::path& meshCacheDirectory);
 
     // the options must be kept while the dm is in use
     PetscOptions surfacePetscOptions;
 
-    // the surface dm must be kept while the dm is in use
+    // the surface dm must be kept while the dm is in use, it is null when the mesh is loaded from the cache
     DM surfaceDm;
 
    public:
     explicit CadFile(const std::string& nameIn, const std::filesystem::path& path, std::vector<std::shared_ptr<FieldDescriptor>> fieldDescriptors, std::string generator,
                      std::vector<std::shared_ptr<modifiers::Modifier>> modifiers = {}, const std::shared_ptr<parameters::Parameters>& options = {},
-                     const std::shared_ptr<parameters::Parameters>& surfaceOptions = {});
+                     const std::shared_ptr<parameters::Parameters>& surfaceOptions = {}, const std::filesystem::path& meshCacheDirectory = {});
 
     ~CadFile() override;
 };
@@ -1,4 +1,6 @@
 #include "domain.hpp"
+#include <iterator>
+#include <numeric>
 #include <set>
 #include <typeinfo>
 #include <utilities/mpiError.hpp>
@@ -9,6 +11,7 @@
 #include "utilities/demangler.hpp"
 #include "utilities/petscError.hpp"
 #include "utilities/petscOptions.hpp"
+#include "utilities/petscUtilities.hpp"
 
 ablate::domain::Domain::Domain(DM dmIn, std::string name, std::vector<std::shared_ptr<FieldDescriptor>> fieldDescriptorsIn, std::vector<std::shared_ptr<modifiers::Modifier>> modifiersIn,
                                const std::shared_ptr<parameters::Parameters>& options, bool setFromOptions)
@@ -24,6 +27,17 @@ ablate::domain::Domain::Domain(DM dmIn, std::string name, std::vector<std::share
     if (setFromOptions) {
         DMSetFromOptions(dm) >> checkError;
     }
+
+    // device resident vectors must be set before any vector is created, the aux and sub dms inherit the vec type
+    PetscBool deviceVectors = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-deviceVectors", &deviceVectors, nullptr) >> checkError;
+    if (deviceVectors) {
+#if defined(PETSC_HAVE_KOKKOS)
+        DMSetVecType(dm, VECKOKKOS) >> checkError;
+#else
+        throw std::invalid_argument("The -deviceVectors option for the domain " + this->name + " requires PETSc to be built with Kokkos");
+#endif
+    }
     // update the dm with the modifiers
     for (auto& modifier : modifiers) {
         modifier->Modify(dm);
@@ -95,6 +109,7 @@ void ablate::domain::Domain::RegisterField(const ablate::domain::FieldDescriptio
     PetscObjectDestroy(&petscField);
 
     // Record the field
+    fieldIdsByName.try_emplace(fieldDescription.name, (PetscInt)fields.size());
     fields.push_back(Field::FromFieldDescription(fieldDescription, (PetscInt)fields.size()));
 }
 
@@ -108,6 +123,7 @@ void ablate::domain::Domain::CreateStructures() {
     // Setup the solve with the ts
     DMPlexCreateClosureIndex(dm, nullptr) >> checkError;
     DMCreateGlobalVector(dm, &(solGlobalField)) >> checkError;
+    utilities::PetscUtilities::FirstTouch(solGlobalField) >> checkError;
     PetscObjectSetName((PetscObject)solGlobalField, "solution") >> checkError;
 
     // add the names to each of the components in the dm section
@@ -227,6 +243,11 @@ void ablate::domain::Domain::ProjectFieldFunctions(const std::vector<std::shared
             }
         }
 
+        // finite volume fields are evaluated as a single batch over every cell
+        if (ProjectFiniteVolumeFunction(dm, fieldId.id, fieldFunction->GetSolutionField(), fieldLabel, fieldValue, time, locVec)) {
+            continue;
+        }
+
         // Note the global DMProjectFunctionLabel can't be used because it overwrites unwritten values.
         // Project this field
         if (fieldLabel) {
@@ -248,6 +269,135 @@ void ablate::domain::Domain::ProjectFieldFunctions(const std::vector<std::shared
     DMRestoreLocalVector(dm, &locVec) >> checkError;
 }
 
+const ablate::domain::Domain::FiniteVolumeProjectionPlan& ablate::domain::Domain::GetFiniteVolumeProjectionPlan(DM dm, PetscInt fieldId, DMLabel label, PetscInt labelValue) {
+    // the plan is cached on the dm so it is destroyed with the dm, it is rebuilt if the label changes
+    PetscObjectState labelState = 0;
+    std::string planName = "ablateFiniteVolumeProjectionPlan_" + std::to_string(fieldId);
+    if (label) {
+        const char* labelName;
+        PetscObjectGetName((PetscObject)label, &labelName) >> checkError;
+        PetscObjectStateGet((PetscObject)label, &labelState) >> checkError;
+        planName += "_" + std::string(labelName) + "_" + std::to_string(labelValue);
+    }
+
+    PetscContainer container;
+    PetscObjectQuery((PetscObject)dm, planName.c_str(), (PetscObject*)&container) >> checkError;
+    if (container) {
+        FiniteVolumeProjectionPlan* plan;
+        PetscContainerGetPointer(container, (void**)&plan) >> checkError;
+        if (plan->labelState == labelState) {
+            return *plan;
+        }
+    }
+
+    auto plan = new FiniteVolumeProjectionPlan{.labelState = labelState};
+    PetscContainerCreate(PETSC_COMM_SELF, &container) >> checkError;
+    PetscContainerSetPointer(container, plan) >> checkError;
+    PetscContainerSetUserDestroy(container, DestroyFiniteVolumeProjectionPlan) >> checkError;
+    PetscObjectCompose((PetscObject)dm, planName.c_str(), (PetscObject)container) >> checkError;
+    PetscContainerDestroy(&container) >> checkError;
+
+    // only finite volume fields store a single value per cell
+    PetscObject discretization;
+    PetscClassId classId;
+    DMGetField(dm, fieldId, nullptr, &discretization) >> checkError;
+    PetscObjectGetClassId(discretization, &classId) >> checkError;
+    if (classId != PETSCFV_CLASSID) {
+        return *plan;
+    }
+    auto fv = (PetscFV)discretization;
+
+    // DMProjectFunction evaluates the single point dual space functional mapped into each cell
+    PetscDualSpace dualSpace;
+    PetscQuadrature functional;
+    PetscInt numberQuadraturePoints;
+    PetscFVGetDualSpace(fv, &dualSpace) >> checkError;
+    PetscDualSpaceGetFunctional(dualSpace, 0, &functional) >> checkError;
+    PetscQuadratureGetData(functional, nullptr, nullptr, &numberQuadraturePoints, nullptr, nullptr) >> checkError;
+    if (numberQuadraturePoints != 1) {
+        return *plan;
+    }
+
+    // determine the cells to project
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+    auto& cells = plan->cells;
+    if (label) {
+        IS labelIS;
+        DMLabelGetStratumIS(label, labelValue, &labelIS) >> checkError;
+        if (labelIS) {
+            PetscInt numberPoints;
+            const PetscInt* points;
+            ISGetLocalSize(labelIS, &numberPoints) >> checkError;
+            ISGetIndices(labelIS, &points) >> checkError;
+            std::copy_if(points, points + numberPoints, std::back_inserter(cells), [cStart, cEnd](auto point) { return point >= cStart && point < cEnd; });
+            ISRestoreIndices(labelIS, &points) >> checkError;
+            ISDestroy(&labelIS) >> checkError;
+
+            // labels without cells (i.e. boundary labels) are left to petsc
+            if (cells.empty() && numberPoints > 0) {
+                return *plan;
+            }
+        }
+    } else {
+        cells.resize(cEnd - cStart);
+        std::iota(cells.begin(), cells.end(), cStart);
+    }
+
+    // the finite volume ghost cells and cells without the field are not projected
+    PetscSection section;
+    DMGetLocalSection(dm, &section) >> checkError;
+    cells.erase(std::remove_if(cells.begin(),
+                               cells.end(),
+                               [dm, section, fieldId](auto cell) {
+                                   DMPolytopeType cellType;
+                                   PetscInt dof;
+                                   DMPlexGetCellType(dm, cell, &cellType) >> checkError;
+                                   PetscSectionGetFieldDof(section, cell, fieldId, &dof) >> checkError;
+                                   return cellType == DM_POLYTOPE_FV_GHOST || dof == 0;
+                               }),
+                cells.end());
+
+    // compute the projection point in each cell
+    DMGetCoordinateDim(dm, &plan->coordinateDim) >> checkError;
+    PetscFVGetNumComponents(fv, &plan->numberComponents) >> checkError;
+    plan->points.resize(cells.size() * plan->coordinateDim);
+    PetscReal jacobian[9], inverseJacobian[9], determinant;
+    for (std::size_t c = 0; c < cells.size(); ++c) {
+        DMPlexComputeCellGeometryFEM(dm, cells[c], functional, plan->points.data() + c * plan->coordinateDim, jacobian, inverseJacobian, &determinant) >> checkError;
+    }
+    plan->supported = true;
+    return *plan;
+}
+
+PetscErrorCode ablate::domain::Domain::DestroyFiniteVolumeProjectionPlan(void* ctx) {
+    PetscFunctionBeginUser;
+    delete (FiniteVolumeProjectionPlan*)ctx;
+    PetscFunctionReturn(0);
+}
+
+bool ablate::domain::Domain::ProjectFiniteVolumeFunction(DM dm, PetscInt fieldId, mathFunctions::MathFunction& function, DMLabel label, PetscInt labelValue, PetscReal time, Vec locVec) {
+    const auto& plan = GetFiniteVolumeProjectionPlan(dm, fieldId, label, labelValue);
+    if (!plan.supported) {
+        return false;
+    }
+
+    // evaluate every cell at once and insert the values
+    const auto numberCells = plan.cells.size();
+    std::vector<PetscScalar> values(numberCells * plan.numberComponents);
+    function.EvalBatch(plan.points.data(), numberCells, (int)plan.coordinateDim, time, values.data(), plan.numberComponents, plan.numberComponents);
+
+    PetscScalar* locArray;
+    VecGetArray(locVec, &locArray) >> checkError;
+    for (std::size_t c = 0; c < numberCells; ++c) {
+        PetscScalar* cellValues;
+        DMPlexPointLocalFieldRef(dm, plan.cells[c], fieldId, locArray, &cellValues) >> checkError;
+        PetscArraycpy(cellValues, values.data() + c * plan.numberComponents, plan.numberComponents) >> checkError;
+    }
+    VecRestoreArray(locVec, &locArray) >> checkError;
+    return true;
+}
+
 bool ablate::domain::Domain::CheckFieldValues(Vec globSourceVector) {
     // create a set of points that have failed
     std::set<PetscInt> failedPoints;
@@ -46,6 +46,9 @@ class Domain : private utilities::Loggable<Domain> {
     // Keep track of all solution fields
     std::vector<Field> fields;
 
+    //! the index of each field by name so fields can be found without a linear search
+    std::map<std::string, PetscInt, std::less<>> fieldIdsByName;
+
     // This domain can be partitions into multiple subdomains
     std::vector<std::shared_ptr<SubDomain>> subDomains;
 
@@ -60,6 +63,40 @@ class Domain : private utilities::Loggable<Domain> {
     //! the petsc options object to be applied to the main dm.
     PetscOptions petscOptions = nullptr;
 
+    /**
+     * The cells and projection points used to project a finite volume field, cached on the dm for each (field, label, label value)
+     */
+    struct FiniteVolumeProjectionPlan {
+        //! the state of the label when the plan was built
+        PetscObjectState labelState = 0;
+
+        //! true if the field can be projected with the plan
+        bool supported = false;
+
+        //! the cells to project and the projection point in each cell
+        std::vector<PetscInt> cells;
+        std::vector<PetscReal> points;
+
+        //! the size of each point and the number of field components
+        PetscInt coordinateDim = 0;
+        PetscInt numberComponents = 0;
+    };
+
+    /**
+     * Get or build the projection plan for this field and label
+     * @param dm
+     * @param fieldId
+     * @param label
+     * @param labelValue
+     * @return
+     */
+    static const FiniteVolumeProjectionPlan& GetFiniteVolumeProjectionPlan(DM dm, PetscInt fieldId, DMLabel label, PetscInt labelValue);
+
+    /**
+     * Free a projection plan when the dm is destroyed
+     */
+    static PetscErrorCode DestroyFiniteVolumeProjectionPlan(void* ctx);
+
    public:
     [[nodiscard]] const std::string& GetName() const { return name; }
 
@@ -94,6 +131,21 @@ class Domain : private utilities::Loggable<Domain> {
      */
     void ProjectFieldFunctions(const std::vector<std::shared_ptr<mathFunctions::FieldFunction>>& fieldFunctions, Vec globVec, PetscReal time = 0.0);
 
+    /**
+     * Project a function into a finite volume field by evaluating the function as a single batch at the projection point of every cell.  The projection
+     * points are the same as used by DMProjectFunction.  This is only possible if the field is a PetscFV, only the cells in the label (if provided) are projected.
+     * The cells and projection points are cached on the dm so repeated projections (i.e. exact solutions) only evaluate the function.
+     * @param dm the dm holding the field
+     * @param fieldId the id of the field in the dm
+     * @param function the function to project
+     * @param label optional label limiting the projected cells
+     * @param labelValue the label value
+     * @param time
+     * @param locVec the local vector for the dm
+     * @return false if the field cannot be projected this way
+     */
+    static bool ProjectFiniteVolumeFunction(DM dm, PetscInt fieldId, mathFunctions::MathFunction& function, DMLabel label, PetscInt labelValue, PetscReal time, Vec locVec);
+
     std::shared_ptr<SubDomain> GetSubDomain(const std::shared_ptr<Region>& name);
 
     /**
@@ -116,9 +168,9 @@ class Domain : private utilities::Loggable<Domain> {
     [[nodiscard]] inline const Field& GetField(int fieldId) const { return fields[fieldId]; }
 
     [[nodiscard]] inline const Field& GetField(const std::string_view& fieldName) const {
-        auto field = std::find_if(fields.begin(), fields.end(), [&fieldName](auto field) { return field.name == fieldName; });
-        if (field != fields.end()) {
-            return *field;
+        auto fieldId = fieldIdsByName.find(fieldName);
+        if (fieldId != fieldIdsByName.end()) {
+            return fields[fieldId->second];
         } else {
             throw std::invalid_argument("Cannot locate field with name " + std::string(fieldName) + " in domain " + name);
         }
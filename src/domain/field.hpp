@@ -15,6 +15,9 @@ enum class FieldType { FVM, FEM };
 struct FieldDescription;
 
 struct Field {
+    //! tag for aux fields that are recomputed from the solution, so they are not needed to restart
+    inline const static std::string DERIVED_TAG = "derived";
+
     const std::string name;
     const PetscInt numberComponents;
     const std::vector<std::string> components;
@@ -46,6 +49,21 @@ struct Field {
     }
 };
 
+/**
+ * A stable handle to a field in a subDomain.  The handle is resolved once at setup (SubDomain::GetFieldHandle) so per step code can look up the field
+ * from an array without searching by name or id.
+ */
+struct FieldHandle {
+    //! the location of the field
+    enum FieldLocation location = FieldLocation::SOL;
+
+    //! the index of the field in SubDomain::GetFields(location), -1 if the handle was not resolved
+    PetscInt index = -1;
+
+    //! true if the handle was resolved to a field
+    [[nodiscard]] inline bool Valid() const { return index >= 0; }
+};
+
 std::istream& operator>>(std::istream& is, FieldLocation& v);
 std::istream& operator>>(std::istream& is, FieldType& v);
 
@@ -0,0 +1,41 @@
+#ifndef ABLATELIBRARY_FIELDVIEW_HPP
+#define ABLATELIBRARY_FIELDVIEW_HPP
+
+#include <petsc.h>
+
+namespace ablate::domain {
+
+/**
+ * A read only, zero copy view of a single field over the cells of a local vector.  The values of cell c start at values + (c - cStart) * stride and hold
+ * components scalars.
+ */
+struct FieldView {
+    //! the values of the field in the first cell
+    const PetscScalar* values = nullptr;
+
+    //! the range of cells in the view
+    PetscInt cStart = 0;
+    PetscInt cEnd = 0;
+
+    //! the number of scalars between consecutive cells
+    PetscInt stride = 0;
+
+    //! the number of components in the field
+    PetscInt components = 0;
+
+    //! the offset of the field from the start of the vec array
+    PetscInt offset = 0;
+
+    //! the vec array, kept so it can be restored
+    const PetscScalar* vecArray = nullptr;
+
+    /**
+     * The field values in the cell
+     * @param cell
+     * @return
+     */
+    inline const PetscScalar* operator[](PetscInt cell) const { return values + (cell - cStart) * stride; }
+};
+
+}  // namespace ablate::domain
+#endif  // ABLATELIBRARY_FIELDVIEW_HPP
@@ -1,11 +1,18 @@
 #include "meshFile.hpp"
+#include <petscviewerhdf5.h>
+#include <utilities/mpiError.hpp>
 #include <utilities/petscError.hpp>
 #include <utilities/petscOptions.hpp>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
 #include <utility>
+#include <vector>
 
 ablate::domain::MeshFile::MeshFile(const std::string& nameIn, const std::filesystem::path& pathIn, std::vector<std::shared_ptr<FieldDescriptor>> fieldDescriptors,
-                                   std::vector<std::shared_ptr<modifiers::Modifier>> modifiers, const std::shared_ptr<parameters::Parameters>& options)
-    : Domain(ReadDMFromFile(nameIn, pathIn), nameIn, std::move(fieldDescriptors), std::move(modifiers), options) {}
+                                   std::vector<std::shared_ptr<modifiers::Modifier>> modifiers, const std::shared_ptr<parameters::Parameters>& options,
+                                   const std::filesystem::path& meshCache)
+    : Domain(ReadDMFromFile(nameIn, pathIn, meshCache), nameIn, std::move(fieldDescriptors), std::move(modifiers), options) {}
 
 ablate::domain::MeshFile::~MeshFile() {
     if (dm) {
@@ -13,19 +20,102 @@ ablate::domain::MeshFile::~MeshFile() {
     }
 }
 
-DM ablate::domain::MeshFile::ReadDMFromFile(const std::string& name, const std::filesystem::path& path) {
+DM ablate::domain::MeshFile::ReadDMFromFile(const std::string& name, const std::filesystem::path& path, const std::filesystem::path& meshCache) {
+    DM dm;
+
+    // each rank loads a chunk of the cached mesh, it is then partitioned when distributed
+    const std::string sourceHash = meshCache.empty() ? std::string() : HashMeshFile(path);
+
+    // the load and read paths are both collective, so the root rank decides which one every rank takes
+    int cacheExists = 0;
+    if (!meshCache.empty()) {
+        PetscMPIInt rank;
+        MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> checkMpiError;
+        cacheExists = rank == 0 ? (int)std::filesystem::exists(meshCache) : 0;
+        MPI_Bcast(&cacheExists, 1, MPI_INT, 0, PETSC_COMM_WORLD) >> checkMpiError;
+    }
+    if (cacheExists) {
+        PetscViewer viewer;
+        PetscViewerHDF5Open(PETSC_COMM_WORLD, meshCache.c_str(), FILE_MODE_READ, &viewer) >> checkError;
+
+        // the cache is only used if it was written from the current mesh file (or the mesh file is no longer available)
+        bool cacheValid = sourceHash.empty();
+        PetscBool hasSourceHash;
+        PetscViewerHDF5HasAttribute(viewer, "/ablate", "sourceHash", &hasSourceHash) >> checkError;
+        if (hasSourceHash && !cacheValid) {
+            char* cachedSourceHash = nullptr;
+            PetscViewerHDF5ReadAttribute(viewer, "/ablate", "sourceHash", PETSC_STRING, nullptr, &cachedSourceHash) >> checkError;
+            cacheValid = sourceHash == cachedSourceHash;
+            PetscFree(cachedSourceHash) >> checkError;
+        }
+
+        if (cacheValid) {
+            DMCreate(PETSC_COMM_WORLD, &dm) >> checkError;
+            DMSetType(dm, DMPLEX) >> checkError;
+            PetscObjectSetName((PetscObject)dm, name.c_str()) >> checkError;
+
+            PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC) >> checkError;
+            DMLoad(dm, viewer) >> checkError;
+            PetscViewerPopFormat(viewer) >> checkError;
+            PetscViewerDestroy(&viewer) >> checkError;
+            return dm;
+        }
+        PetscViewerDestroy(&viewer) >> checkError;
+        PetscPrintf(PETSC_COMM_WORLD, "The mesh cache %s does not match %s and is regenerated\n", meshCache.c_str(), path.c_str()) >> checkError;
+    }
+
     if (!std::filesystem::exists(path)) {
         throw std::invalid_argument("Unable to locate file " + path.string());
     }
 
-    DM dm;
     DMPlexCreateFromFile(PETSC_COMM_WORLD, path.c_str(), name.c_str(), PETSC_TRUE, &dm) >> checkError;
     PetscObjectSetName((PetscObject)dm, name.c_str()) >> checkError;
+
+    // save the mesh in the petsc hdf5 format so it can be read in parallel next time
+    if (!meshCache.empty()) {
+        PetscViewer viewer;
+        PetscViewerHDF5Open(PETSC_COMM_WORLD, meshCache.c_str(), FILE_MODE_WRITE, &viewer) >> checkError;
+        PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC) >> checkError;
+        DMView(dm, viewer) >> checkError;
+        PetscViewerPopFormat(viewer) >> checkError;
+        PetscViewerHDF5WriteAttribute(viewer, "/ablate", "sourceHash", PETSC_STRING, sourceHash.c_str()) >> checkError;
+        PetscViewerDestroy(&viewer) >> checkError;
+    }
     return dm;
 }
 
+std::string ablate::domain::MeshFile::HashMeshFile(const std::filesystem::path& path) {
+    PetscMPIInt rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> checkMpiError;
+
+    // FNV-1a hash of the file contents and size
+    std::string hash;
+    if (rank == 0 && std::filesystem::exists(path)) {
+        std::uint64_t value = 1469598103934665603ULL;
+        std::ifstream file(path, std::ios::binary);
+        std::vector<char> buffer(1 << 20);
+        while (file) {
+            file.read(buffer.data(), (std::streamsize)buffer.size());
+            for (std::streamsize b = 0; b < file.gcount(); ++b) {
+                value = (value ^ (unsigned char)buffer[b]) * 1099511628211ULL;
+            }
+        }
+        std::stringstream hashStream;
+        hashStream << std::hex << value << "-" << std::filesystem::file_size(path);
+        hash = hashStream.str();
+    }
+
+    // share the hash with every rank
+    int hashSize = (int)hash.size();
+    MPI_Bcast(&hashSize, 1, MPI_INT, 0, PETSC_COMM_WORLD) >> checkMpiError;
+    hash.resize(hashSize);
+    MPI_Bcast(hash.data(), hashSize, MPI_CHAR, 0, PETSC_COMM_WORLD) >> checkMpiError;
+    return hash;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::domain::Domain, ablate::domain::MeshFile, "read a DMPlex from a file", ARG(std::string, "name", "the name of the domain/mesh object"),
          ARG(std::filesystem::path, "path", "the path to the mesh file"), OPT(std::vector<ablate::domain::FieldDescriptor>, "fields", "a list of fields/field descriptors"),
          OPT(std::vector<ablate::domain::modifiers::Modifier>, "modifiers", "a list of domain modifier"),
-         OPT(ablate::parameters::Parameters, "options", "PETSc options specific to this dm.  Default value allows the dm to access global options."));
\ No newline at end of file
+         OPT(ablate::parameters::Parameters, "options", "PETSc options specific to this dm.  Default value allows the dm to access global options."),
+         OPT(std::filesystem::path, "meshCache", "optional path to a hdf5 copy of the mesh.  If it exists and matches the mesh file contents the mesh is read from it in parallel, otherwise it is written after reading the mesh file."));
\ No newline at end of file
@@ -9,11 +9,35 @@ namespace ablate::domain {
 
 class MeshFile : public Domain {
    private:
-    static DM ReadDMFromFile(const std::string& name, const std::filesystem::path& path);
+    /**
+     * Read the dm from the mesh file.  If a mesh cache is provided and exists, and was written from the current contents of the mesh file, the mesh is loaded in
+     * parallel from the cache, otherwise the mesh file is read and written to the cache for the next run.
+     * @param name
+     * @param path
+     * @param meshCache
+     * @return
+     */
+    static DM ReadDMFromFile(const std::string& name, const std::filesystem::path& path, const std::filesystem::path& meshCache);
+
+    /**
+     * Hash the contents of the mesh file on the first rank and share it with every rank
+     * @param path
+     * @return the hash, or empty if the file does not exist
+     */
+    static std::string HashMeshFile(const std::filesystem::path& path);
 
    public:
+    /**
+     * @param nameIn the name of the domain/mesh object
+     * @param path the path to the mesh file
+     * @param fieldDescriptors
+     * @param modifiers
+     * @param options
+     * @param meshCache optional path to a hdf5 copy of the mesh that is read in parallel on repeat runs
+     */
     explicit MeshFile(const std::string& nameIn, const std::filesystem::path& path, std::vector<std::shared_ptr<FieldDescriptor>> fieldDescriptors,
-                      std::vector<std::shared_ptr<modifiers::Modifier>> modifiers = {}, const std::shared_ptr<parameters::Parameters>& options = {});
+                      std::vector<std::shared_ptr<modifiers::Modifier>> modifiers = {}, const std::shared_ptr<parameters::Parameters>& options = {},
+                      const std::filesystem::path& meshCache = {});
     ~MeshFile() override;
 };
 };      // namespace ablate::domain
@@ -0,0 +1,277 @@
+#include "cachedModifiers.hpp"
+#include <petscviewerhdf5.h>
+#include <yaml-cpp/yaml.h>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+#include "environment/runEnvironment.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+/**
+ * FNV-1a hash of the bytes, this is stable between runs so it can be used for the cache file name
+ */
+static std::uint64_t HashBytes(const void* bytes, std::size_t size, std::uint64_t hash = 1469598103934665603ULL) {
+    auto byteArray = (const unsigned char*)bytes;
+    for (std::size_t b = 0; b < size; ++b) {
+        hash = (hash ^ byteArray[b]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+ablate::domain::modifiers::CachedModifiers::CachedModifiers(std::filesystem::path cacheDirectory, std::vector<std::shared_ptr<Modifier>> modifiers, std::string version)
+    : cacheDirectory(std::move(cacheDirectory)), modifiers(std::move(modifiers)), version(std::move(version)) {}
+
+void ablate::domain::modifiers::CachedModifiers::Modify(DM& dm) {
+    auto comm = PetscObjectComm((PetscObject)dm);
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    // only the first rank checks for the file so every rank takes the same path
+    const auto cacheFile = cacheDirectory / ("modifiedMesh." + ComputeKey(dm) + ".h5");
+    int cacheExists = rank == 0 ? (int)std::filesystem::exists(cacheFile) : 0;
+    MPI_Bcast(&cacheExists, 1, MPI_INT, 0, comm) >> checkMpiError;
+    if (cacheExists) {
+        Load(dm, cacheFile);
+        return;
+    }
+
+    for (auto& modifier : modifiers) {
+        modifier->Modify(dm);
+    }
+
+    // the natural sf is built from the distribution and cannot be restored from the file
+    PetscBool useNatural;
+    DMGetUseNatural(dm, &useNatural) >> checkError;
+    if (useNatural) {
+        if (rank == 0) {
+            std::cout << ToString() << " does not cache meshes using the natural ordering" << std::endl;
+        }
+        return;
+    }
+
+    if (rank == 0) {
+        std::filesystem::create_directories(cacheDirectory);
+    }
+    MPI_Barrier(comm) >> checkMpiError;
+    Save(dm, cacheFile);
+}
+
+std::string ablate::domain::modifiers::CachedModifiers::ComputeKey(DM dm) const {
+    auto comm = PetscObjectComm((PetscObject)dm);
+    PetscMPIInt size;
+    MPI_Comm_size(comm, &size) >> checkMpiError;
+
+    // describe the input mesh by the hash of its contents on each rank, in rank order
+    std::uint64_t localMeshHash = HashLocalMesh(dm);
+    std::vector<std::uint64_t> meshHashes(size);
+    MPI_Allgather(&localMeshHash, 1, MPI_UINT64_T, meshHashes.data(), 1, MPI_UINT64_T, comm) >> checkMpiError;
+
+    const char* name;
+    PetscObjectGetName((PetscObject)dm, &name) >> checkError;
+
+    std::stringstream description;
+    description << version << "|" << name << "|" << size << "|" << std::hex;
+    for (const auto meshHash : meshHashes) {
+        description << meshHash << ",";
+    }
+    description << "|" << DescribeModifiers();
+
+    const auto descriptionString = description.str();
+    std::stringstream key;
+    key << std::hex << HashBytes(descriptionString.data(), descriptionString.size());
+    return key.str();
+}
+
+std::string ablate::domain::modifiers::CachedModifiers::DescribeModifiers() const {
+    // the modifier arguments are not available from the modifiers, so use every CachedModifiers node in the input file
+    static const std::string cachedModifiersTag = "!ablate::domain::modifiers::CachedModifiers";
+    std::stringstream description;
+    const auto& inputPath = environment::RunEnvironment::Get().GetInputPath();
+    if (!inputPath.empty() && std::filesystem::exists(inputPath)) {
+        std::function<void(const YAML::Node&)> describeNode = [&](const YAML::Node& node) {
+            if (node.Tag() == cachedModifiersTag && node.IsMap()) {
+                YAML::Emitter out;
+                out << node;
+                description << out.c_str() << "|";
+                return;
+            }
+            if (node.IsMap()) {
+                for (const auto& child : node) {
+                    describeNode(child.second);
+                }
+            } else if (node.IsSequence()) {
+                for (const auto& child : node) {
+                    describeNode(child);
+                }
+            }
+        };
+        describeNode(YAML::LoadFile(inputPath.string()));
+    }
+
+    // fall back to the modifier names
+    if (description.str().empty()) {
+        for (const auto& modifier : modifiers) {
+            description << "|" << modifier->ToString();
+        }
+    }
+    return description.str();
+}
+
+std::uint64_t ablate::domain::modifiers::CachedModifiers::HashLocalMesh(DM dm) {
+    std::uint64_t hash = HashBytes(nullptr, 0);
+    auto hashValues = [&hash](const auto* values, std::size_t count) { hash = HashBytes(values, count * sizeof(*values), hash); };
+
+    // the topology
+    PetscInt pStart, pEnd;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> checkError;
+    hashValues(&pStart, 1);
+    hashValues(&pEnd, 1);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        PetscInt coneSize;
+        const PetscInt *cone, *orientation;
+        DMPlexGetConeSize(dm, p, &coneSize) >> checkError;
+        DMPlexGetCone(dm, p, &cone) >> checkError;
+        DMPlexGetConeOrientation(dm, p, &orientation) >> checkError;
+        hashValues(&coneSize, 1);
+        hashValues(cone, coneSize);
+        hashValues(orientation, coneSize);
+    }
+
+    // the coordinates
+    Vec coordinates;
+    DMGetCoordinatesLocal(dm, &coordinates) >> checkError;
+    if (coordinates) {
+        PetscInt coordinateSize;
+        const PetscScalar* coordinateArray;
+        VecGetLocalSize(coordinates, &coordinateSize) >> checkError;
+        VecGetArrayRead(coordinates, &coordinateArray) >> checkError;
+        hashValues(coordinateArray, coordinateSize);
+        VecRestoreArrayRead(coordinates, &coordinateArray) >> checkError;
+    }
+
+    // the labels
+    PetscInt numberLabels;
+    DMGetNumLabels(dm, &numberLabels) >> checkError;
+    for (PetscInt l = 0; l < numberLabels; ++l) {
+        const char* labelName;
+        DMLabel label;
+        DMGetLabelName(dm, l, &labelName) >> checkError;
+        DMGetLabelByNum(dm, l, &label) >> checkError;
+        hashValues(labelName, std::strlen(labelName));
+
+        IS valueIS;
+        DMLabelGetValueIS(label, &valueIS) >> checkError;
+        PetscInt numberValues;
+        const PetscInt* values;
+        ISGetLocalSize(valueIS, &numberValues) >> checkError;
+        ISGetIndices(valueIS, &values) >> checkError;
+        for (PetscInt v = 0; v < numberValues; ++v) {
+            IS pointIS;
+            DMLabelGetStratumIS(label, values[v], &pointIS) >> checkError;
+            hashValues(&values[v], 1);
+            if (pointIS) {
+                PetscInt numberPoints;
+                const PetscInt* points;
+                ISGetLocalSize(pointIS, &numberPoints) >> checkError;
+                ISGetIndices(pointIS, &points) >> checkError;
+                hashValues(points, numberPoints);
+                ISRestoreIndices(pointIS, &points) >> checkError;
+                ISDestroy(&pointIS) >> checkError;
+            }
+        }
+        ISRestoreIndices(valueIS, &values) >> checkError;
+        ISDestroy(&valueIS) >> checkError;
+    }
+    return hash;
+}
+
+void ablate::domain::modifiers::CachedModifiers::Save(DM dm, const std::filesystem::path& path) {
+    // mark the finite volume ghost cells so their cell type can be restored
+    DMLabel ghostCellLabel;
+    DMCreateLabel(dm, ghostCellLabelName.c_str()) >> checkError;
+    DMGetLabel(dm, ghostCellLabelName.c_str(), &ghostCellLabel) >> checkError;
+    PetscInt gStart, gEnd;
+    DMPlexGetCellTypeStratum(dm, DM_POLYTOPE_FV_GHOST, &gStart, &gEnd) >> checkError;
+    for (PetscInt c = gStart; c < gEnd; ++c) {
+        DMLabelSetValue(ghostCellLabel, c, 1) >> checkError;
+    }
+
+    // store the distribution so the same partition is loaded on each rank
+    DMPlexDistributionSetName(dm, distributionName.c_str()) >> checkError;
+
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PetscObjectComm((PetscObject)dm), path.c_str(), FILE_MODE_WRITE, &viewer) >> checkError;
+    PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC) >> checkError;
+    DMView(dm, viewer) >> checkError;
+    PetscViewerPopFormat(viewer) >> checkError;
+
+    // the adjacency is not part of the dm file
+    PetscBool useCone, useClosure;
+    DMGetBasicAdjacency(dm, &useCone, &useClosure) >> checkError;
+    PetscViewerHDF5WriteAttribute(viewer, "/ablate", "useCone", PETSC_BOOL, &useCone) >> checkError;
+    PetscViewerHDF5WriteAttribute(viewer, "/ablate", "useClosure", PETSC_BOOL, &useClosure) >> checkError;
+    PetscViewerDestroy(&viewer) >> checkError;
+
+    DMRemoveLabel(dm, ghostCellLabelName.c_str(), nullptr) >> checkError;
+}
+
+void ablate::domain::modifiers::CachedModifiers::Load(DM& dm, const std::filesystem::path& path) {
+    const char* name;
+    PetscObjectGetName((PetscObject)dm, &name) >> checkError;
+
+    DM cachedDm;
+    DMCreate(PetscObjectComm((PetscObject)dm), &cachedDm) >> checkError;
+    DMSetType(cachedDm, DMPLEX) >> checkError;
+    PetscObjectSetName((PetscObject)cachedDm, name) >> checkError;
+    DMPlexDistributionSetName(cachedDm, distributionName.c_str()) >> checkError;
+
+    PetscViewer viewer;
+    PetscViewerHDF5Open(PetscObjectComm((PetscObject)dm), path.c_str(), FILE_MODE_READ, &viewer) >> checkError;
+    PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC) >> checkError;
+    DMLoad(cachedDm, viewer) >> checkError;
+    PetscViewerPopFormat(viewer) >> checkError;
+    PetscBool useCone, useClosure, defaultValue = PETSC_FALSE;
+    PetscViewerHDF5ReadAttribute(viewer, "/ablate", "useCone", PETSC_BOOL, &defaultValue, &useCone) >> checkError;
+    PetscViewerHDF5ReadAttribute(viewer, "/ablate", "useClosure", PETSC_BOOL, &defaultValue, &useClosure) >> checkError;
+    PetscViewerDestroy(&viewer) >> checkError;
+    DMSetBasicAdjacency(cachedDm, useCone, useClosure) >> checkError;
+
+    // restore the finite volume ghost cell types
+    DMLabel ghostCellLabel;
+    DMGetLabel(cachedDm, ghostCellLabelName.c_str(), &ghostCellLabel) >> checkError;
+    if (ghostCellLabel) {
+        IS ghostCellIS;
+        DMLabelGetStratumIS(ghostCellLabel, 1, &ghostCellIS) >> checkError;
+        if (ghostCellIS) {
+            PetscInt numberGhostCells;
+            const PetscInt* ghostCells;
+            ISGetLocalSize(ghostCellIS, &numberGhostCells) >> checkError;
+            ISGetIndices(ghostCellIS, &ghostCells) >> checkError;
+            for (PetscInt g = 0; g < numberGhostCells; ++g) {
+                DMPlexSetCellType(cachedDm, ghostCells[g], DM_POLYTOPE_FV_GHOST) >> checkError;
+            }
+            ISRestoreIndices(ghostCellIS, &ghostCells) >> checkError;
+            ISDestroy(&ghostCellIS) >> checkError;
+        }
+        DMRemoveLabel(cachedDm, ghostCellLabelName.c_str(), nullptr) >> checkError;
+    }
+
+    ReplaceDm(dm, cachedDm);
+}
+
+std::string ablate::domain::modifiers::CachedModifiers::ToString() const {
+    std::string description = "ablate::domain::modifiers::CachedModifiers:";
+    for (const auto& modifier : modifiers) {
+        description += " " + modifier->ToString();
+    }
+    return description;
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::CachedModifiers,
+         "Applies a list of modifiers and stores the modified and distributed mesh in a parallel hdf5 file that is loaded directly on the next run with the same input",
+         ARG(std::filesystem::path, "directory", "the directory holding the cached meshes"), ARG(std::vector<ablate::domain::modifiers::Modifier>, "modifiers", "the modifiers that are cached"),
+         OPT(std::string, "version", "an optional version string included in the cache key"));
@@ -0,0 +1,85 @@
+#ifndef ABLATELIBRARY_CACHEDMODIFIERS_HPP
+#define ABLATELIBRARY_CACHEDMODIFIERS_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+#include "modifier.hpp"
+
+namespace ablate::domain::modifiers {
+
+/**
+ * Applies a list of modifiers (labels, ghost cells, distribution, etc.) and stores the resulting dm, including its labels and parallel distribution, in a
+ * parallel hdf5 file.  On the next run with the same input mesh, modifiers, version and number of ranks the modified dm is loaded directly from the file and
+ * the modifiers are skipped.  The key is a hash of the version string, the number of ranks, the modifiers as written in the input file (class types and every
+ * argument), and the contents of the input mesh (topology, coordinates and labels on every rank).  When the run was not set up from an input file only the
+ * modifier names are available, so the version should be changed when the modifier parameters change.
+ */
+class CachedModifiers : public Modifier {
+   private:
+    //! the directory holding the cached meshes
+    const std::filesystem::path cacheDirectory;
+
+    //! the modifiers that are cached
+    const std::vector<std::shared_ptr<Modifier>> modifiers;
+
+    //! an optional version string included in the key
+    const std::string version;
+
+    //! the label used to store the finite volume ghost cells, the cell types are not saved with the dm
+    inline const static std::string ghostCellLabelName = "ablateCachedFvGhostCells";
+
+    //! the name of the parallel distribution stored in the file
+    inline const static std::string distributionName = "ablateCachedModifiers";
+
+    /**
+     * Compute the key for the input dm, this is the same on every rank
+     * @param dm
+     * @return
+     */
+    std::string ComputeKey(DM dm) const;
+
+    /**
+     * Describe the cached modifiers using the input file, falling back to the modifier names
+     * @return
+     */
+    std::string DescribeModifiers() const;
+
+    /**
+     * Hash the local topology, coordinates and labels of the dm
+     * @param dm
+     * @return
+     */
+    static std::uint64_t HashLocalMesh(DM dm);
+
+    /**
+     * Save the modified dm
+     * @param dm
+     * @param path
+     */
+    static void Save(DM dm, const std::filesystem::path& path);
+
+    /**
+     * Replace the dm with the cached dm
+     * @param dm
+     * @param path
+     */
+    static void Load(DM& dm, const std::filesystem::path& path);
+
+   public:
+    /**
+     * @param cacheDirectory the directory holding the cached meshes
+     * @param modifiers the modifiers that are cached
+     * @param version an optional version string included in the key
+     */
+    CachedModifiers(std::filesystem::path cacheDirectory, std::vector<std::shared_ptr<Modifier>> modifiers, std::string version = {});
+
+    void Modify(DM&) override;
+
+    std::string ToString() const override;
+};
+
+}  // namespace ablate::domain::modifiers
+#endif  // ABLATELIBRARY_CACHEDMODIFIERS_HPP
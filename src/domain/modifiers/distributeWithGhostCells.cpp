@@ -1,13 +1,52 @@
 #include "distributeWithGhostCells.hpp"
+#include <stdexcept>
+#include <utility>
 #include <utilities/petscError.hpp>
 
-ablate::domain::modifiers::DistributeWithGhostCells::DistributeWithGhostCells(int ghostCellDepthIn) : ghostCellDepth(ghostCellDepthIn < 1 ? 2 : ghostCellDepthIn) {}
+ablate::domain::modifiers::DistributeWithGhostCells::DistributeWithGhostCells(int ghostCellDepthIn, std::shared_ptr<mathFunctions::MathFunction> particleDensity, double particleCost,
+                                                                              bool naturalOrdering)
+    : ghostCellDepth(ghostCellDepthIn < 1 ? 2 : ghostCellDepthIn), particleDensity(std::move(particleDensity)), particleCost(particleCost), naturalOrdering(naturalOrdering) {
+    // the natural sf is built from the section present when distributing, which would be the partition weights
+    if (this->particleDensity && naturalOrdering) {
+        throw std::invalid_argument("The DistributeWithGhostCells naturalOrdering cannot be used with a particleDensity weighted partition");
+    }
+}
+
 void ablate::domain::modifiers::DistributeWithGhostCells::Modify(DM &dm) {
     // Make sure that the flow is set up distributed
     DM dmDist;
 
+    // weight the partition by the expected cost of each cell
+    PetscPartitioner partitioner = nullptr;
+    PetscOptions partitionerOptions = nullptr;
+    if (particleDensity) {
+        SetCellWeights(dm);
+
+        // the partitioner only uses the vertex weights when requested through the options
+        DMPlexGetPartitioner(dm, &partitioner) >> checkError;
+        PetscOptionsCreate(&partitionerOptions) >> checkError;
+        PetscOptionsSetValue(partitionerOptions, "-petscpartitioner_use_vertex_weights", "true") >> checkError;
+        PetscObjectSetOptions((PetscObject)partitioner, partitionerOptions) >> checkError;
+        PetscPartitionerSetFromOptions(partitioner) >> checkError;
+    }
+
+    // keep the migration sf so that vectors are viewed/loaded in the natural ordering, this allows a restart on any number of ranks
+    if (naturalOrdering) {
+        DMSetUseNatural(dm, PETSC_TRUE) >> checkError;
+    }
+
     // create any ghost cells that are needed
     DMPlexDistribute(dm, ghostCellDepth, NULL, &dmDist) >> checkError;
+
+    // the weights are only used for the partition, the fields are set up later
+    if (particleDensity) {
+        PetscObjectSetOptions((PetscObject)partitioner, nullptr) >> checkError;
+        PetscOptionsDestroy(&partitionerOptions) >> checkError;
+        DMSetLocalSection(dm, nullptr) >> checkError;
+        if (dmDist) {
+            DMSetLocalSection(dmDist, nullptr) >> checkError;
+        }
+    }
     ReplaceDm(dm, dmDist);
 
     // if we are using ghost cells, set the adjacency for fvm
@@ -16,6 +55,29 @@ void ablate::domain::modifiers::DistributeWithGhostCells::Modify(DM &dm) {
     TagMpiGhostCells(dm) >> checkError;
 }
 
+void ablate::domain::modifiers::DistributeWithGhostCells::SetCellWeights(DM dm) const {
+    PetscInt dim;
+    DMGetDimension(dm, &dim) >> checkError;
+    PetscInt pStart, pEnd, cStart, cEnd;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> checkError;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+
+    // the cost of each cell is one for the flow plus the cost of the expected particles in the cell
+    PetscSection section;
+    PetscSectionCreate(PetscObjectComm((PetscObject)dm), &section) >> checkError;
+    PetscSectionSetChart(section, pStart, pEnd) >> checkError;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal volume;
+        PetscReal centroid[3] = {0.0, 0.0, 0.0};
+        DMPlexComputeCellGeometryFVM(dm, c, &volume, centroid, nullptr) >> checkError;
+        const PetscReal expectedParticles = PetscMax(particleDensity->Eval(centroid, (int)dim, 0.0), 0.0) * volume;
+        PetscSectionSetDof(section, c, 1 + (PetscInt)PetscRoundReal(particleCost * expectedParticles)) >> checkError;
+    }
+    PetscSectionSetUp(section) >> checkError;
+    DMSetLocalSection(dm, section) >> checkError;
+    PetscSectionDestroy(&section) >> checkError;
+}
+
 PetscErrorCode ablate::domain::modifiers::DistributeWithGhostCells::TagMpiGhostCells(DM dmNew) {
     PetscSF sfPoint;
     DMLabel ghostLabel = NULL;
@@ -82,4 +144,7 @@ PetscErrorCode ablate::domain::modifiers::DistributeWithGhostCells::TagMpiGhostC
 
 #include "registrar.hpp"
 REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::DistributeWithGhostCells, "Distribute DMPlex with ghost cells",
-         OPT(int, "ghostCellDepth", "the number of ghost cells to share on the boundary.  Default is 1."));
\ No newline at end of file
+         OPT(int, "ghostCellDepth", "the number of ghost cells to share on the boundary.  Default is 1."),
+         OPT(ablate::mathFunctions::MathFunction, "particleDensity", "the optional expected particle number density (particles/m^3) used to weight the partition by the particle cost"),
+         OPT(double, "particleCost", "the cost of a particle relative to the flow cost of a cell (default is 1)"),
+         OPT(bool, "naturalOrdering", "write and read fields in the natural (original mesh) ordering so that a checkpoint can be restarted on a different number of ranks (default is false)"));
\ No newline at end of file
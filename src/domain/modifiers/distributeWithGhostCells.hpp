@@ -1,14 +1,35 @@
 #ifndef ABLATELIBRARY_DISTRIBUTEWITHGHOSTCELLS_HPP
 #define ABLATELIBRARY_DISTRIBUTEWITHGHOSTCELLS_HPP
 
+#include <memory>
+#include "mathFunctions/mathFunction.hpp"
 #include "modifier.hpp"
 
 namespace ablate::domain::modifiers {
 
+/**
+ * Distribute the DMPlex with ghost cells.  If an expected particle number density is provided the partition is weighted by the cost of each cell, one for the flow plus the particleCost
+ * times the expected number of particles in the cell, so that ranks owning cells with many particles (e.g. near an injector) are given fewer cells.
+ */
 class DistributeWithGhostCells : public Modifier {
    private:
     const int ghostCellDepth;
 
+    //! the optional expected particle number density (particles/m^3) used to weight the partition
+    const std::shared_ptr<mathFunctions::MathFunction> particleDensity;
+
+    //! the cost of a particle relative to the flow cost of a cell
+    const double particleCost;
+
+    //! keep the natural (original mesh) ordering so that fields can be written and read independent of the number of ranks
+    const bool naturalOrdering;
+
+    /**
+     * Set the local section of the dm so that each cell has a dof count equal to its cost, this is used by the partitioner as the vertex weight
+     * @param dm
+     */
+    void SetCellWeights(DM dm) const;
+
     /***
      * Tags the mpi ghost cells. This is a duplicate of the DMPlexCreateVTKLabel_Internal call in PETSc but works without calling DMPlexConstructGhostCells
      * @param dm
@@ -18,7 +39,13 @@ class DistributeWithGhostCells : public Modifier {
     PetscErrorCode TagMpiGhostCells(DM dmNew);
 
    public:
-    explicit DistributeWithGhostCells(int ghostCellDepth = {});
+    /**
+     * @param ghostCellDepth the number of ghost cells to share on the boundary
+     * @param particleDensity the optional expected particle number density used to weight the partition
+     * @param particleCost the cost of a particle relative to the flow cost of a cell
+     * @param naturalOrdering keep the natural ordering so that checkpoints can be restarted on a different number of ranks
+     */
+    explicit DistributeWithGhostCells(int ghostCellDepth = {}, std::shared_ptr<mathFunctions::MathFunction> particleDensity = {}, double particleCost = 1.0, bool naturalOrdering = false);
 
     void Modify(DM&) override;
 
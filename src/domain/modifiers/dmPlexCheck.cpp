@@ -1,9 +1,19 @@
 #include "dmPlexCheck.hpp"
 #include <utilities/petscError.hpp>
 
-void ablate::domain::modifiers::DMPlexCheck::Modify(DM &dm) { ::DMPlexCheck(dm) >> checkError; }
+ablate::domain::modifiers::DMPlexCheck::DMPlexCheck(bool partitionBoundaryOnly) : partitionBoundaryOnly(partitionBoundaryOnly) {}
+
+void ablate::domain::modifiers::DMPlexCheck::Modify(DM &dm) {
+    if (partitionBoundaryOnly) {
+        // the full check includes the symmetry, skeleton, face and geometry checks over every cell, so only check the parts that depend upon the distribution
+        DMPlexCheckPointSF(dm, nullptr, PETSC_FALSE) >> checkError;
+        DMPlexCheckInterfaceCones(dm) >> checkError;
+    } else {
+        ::DMPlexCheck(dm) >> checkError;
+    }
+}
 std::string ablate::domain::modifiers::DMPlexCheck::ToString() const { return "ablate::domain::modifiers::DMPlexCheck"; }
 
 #include "registrar.hpp"
-REGISTER_WITHOUT_ARGUMENTS(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::DMPlexCheck,
-                           "Calls the [DMPlexCheck](https://petsc.org/main/docs/manualpages/DMPLEX/DMPlexCheck/) petsc function");
\ No newline at end of file
+REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::DMPlexCheck, "Calls the [DMPlexCheck](https://petsc.org/main/docs/manualpages/DMPLEX/DMPlexCheck/) petsc function",
+         OPT(bool, "partitionBoundaryOnly", "only check the point sf and interface cones at the partition boundary, skipping the checks over every cell (default is false)"));
@@ -12,7 +12,16 @@ namespace ablate::domain::modifiers {
  * Call the DMPlexCheck petsc function
  */
 class DMPlexCheck : public Modifier {
+   private:
+    //! only run the checks of the partition boundary (point sf and interface cones), these are local to each rank and scale with the partition surface
+    const bool partitionBoundaryOnly;
+
    public:
+    /**
+     * @param partitionBoundaryOnly only run the checks of the partition boundary
+     */
+    explicit DMPlexCheck(bool partitionBoundaryOnly = false);
+
     void Modify(DM&) override;
 
     std::string ToString() const override;
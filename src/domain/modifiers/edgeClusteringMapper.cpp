@@ -21,17 +21,25 @@ PetscErrorCode ablate::domain::modifiers::EdgeClusteringMapper::MappingFunction(
     for (PetscInt d = 0; d < dim; d++) {
         u[d] = x[d];
     }
+    map->MapCoordinates(dim, 1, u);
+    PetscFunctionReturn(0);
+}
 
-    u[map->direction] -= map->start;
-    PetscReal eta = u[map->direction] / map->size;
-    PetscReal term1 = (map->beta + 1) - (map->beta - 1) * PetscPowReal((map->beta + 1) / (map->beta - 1), 1 - eta);
-    PetscReal term2 = PetscPowReal((map->beta + 1) / (map->beta - 1), 1 - eta) + 1.;
-    PetscReal newLocation = map->size * term1 / term2;
-    if (!PetscIsInfOrNanReal(u[map->direction])) {
-        u[map->direction] = newLocation;
+void ablate::domain::modifiers::EdgeClusteringMapper::MapCoordinates(PetscInt dim, PetscInt numberPoints, PetscScalar *coordinates) const {
+    // (beta + 1)/(beta - 1)^(1 - eta) is evaluated as exp((1 - eta) * log((beta + 1)/(beta - 1)))
+    const PetscReal logRatio = PetscLogReal((beta + 1) / (beta - 1));
+
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        PetscScalar &u = coordinates[p * dim + direction];
+        const PetscReal eta = (u - start) / size;
+        const PetscReal ratio = PetscExpReal((1 - eta) * logRatio);
+        const PetscReal term1 = (beta + 1) - (beta - 1) * ratio;
+        const PetscReal term2 = ratio + 1.;
+        const PetscReal newLocation = size * term1 / term2;
+        if (!PetscIsInfOrNanReal(u)) {
+            u = newLocation + start;
+        }
     }
-    u[map->direction] += map->start;
-    PetscFunctionReturn(0);
 }
 
 #include "registrar.hpp"
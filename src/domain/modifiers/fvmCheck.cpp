@@ -1,20 +1,25 @@
 #include "fvmCheck.hpp"
 #include <petsc/private/sectionimpl.h>
-#include <array>
 #include <iomanip>
-#include <map>
 #include <set>
 #include <utility>
+#include <vector>
 #include "utilities/mathUtilities.hpp"
+#include "utilities/mpiError.hpp"
 #include "utilities/mpiUtilities.hpp"
 #include "utilities/petscError.hpp"
 
-ablate::domain::modifiers::FvmCheck::FvmCheck(std::shared_ptr<domain::Region> fvmRegion, int expectedFaceCount, int expectedNodeCount)
-    : region(std::move(fvmRegion)), expectedFaceCount(expectedFaceCount), expectedNodeCount(expectedNodeCount) {}
+ablate::domain::modifiers::FvmCheck::FvmCheck(std::shared_ptr<domain::Region> fvmRegion, int expectedFaceCount, int expectedNodeCount, int sampleStride, bool partitionBoundaryOnly)
+    : region(std::move(fvmRegion)),
+      expectedFaceCount(expectedFaceCount),
+      expectedNodeCount(expectedNodeCount),
+      sampleStride(sampleStride < 1 ? 1 : sampleStride),
+      partitionBoundaryOnly(partitionBoundaryOnly) {}
 
 void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
     PetscInt depth;
     DMPlexGetDepth(dm, &depth) >> checkError;
+    auto comm = PetscObjectComm((PetscObject)dm);
 
     // Get the faces in this range
     ablate::solver::Range faceRange;
@@ -48,12 +53,6 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
     VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
     VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
 
-    // store a map of summed area
-    std::map<PetscInt, std::array<PetscReal, 3>> cellAreas;
-
-    // Store a count for the number of faces on each cell
-    std::map<PetscInt, PetscInt> faceCount;
-
     // check if it is an exterior boundary cell ghost
     PetscInt boundaryCellStart;
     DMPlexGetGhostCellStratum(dm, &boundaryCellStart, nullptr) >> checkError;
@@ -63,6 +62,16 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
             "The FVM check cannot be used over the entire mesh if there are no boundary ghost cells. Add boundary ghost cells with ablate::domain::modifiers::GhostBoundaryCells");
     }
 
+    // Determine which cells are checked once, so the labels are not queried for every face
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+    std::vector<bool> checkCell = SelectCells(dm, regionLabel, regionValue, ghostLabel, boundaryCellStart);
+
+    // store the summed area and the number of faces for each cell
+    std::vector<PetscReal> areas(3 * (cEnd - cStart), 0.0);
+    std::vector<PetscInt> faceCounts(cEnd - cStart, 0);
+    PetscInt wrongNormals = 0;
+
     // March over each face in this region
     for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
         const PetscInt face = faceRange.points ? faceRange.points[f] : f;
@@ -76,22 +85,20 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
         DMPlexGetTreeChildren(dm, face, &nchild, nullptr) >> checkError;
         if (ghost >= 0 || nsupp != 2 || nchild > 0) continue;
 
-        // Get the face geometry
+        // only faces of a checked cell contribute
         const PetscInt* faceCells;
+        DMPlexGetSupport(dm, face, &faceCells) >> checkError;
+        const bool checkLeft = checkCell[faceCells[0] - cStart];
+        const bool checkRight = checkCell[faceCells[1] - cStart];
+        if (!checkLeft && !checkRight) continue;
+
+        // Get the face geometry
         PetscFVFaceGeom* fg;
         PetscFVCellGeom *cgL, *cgR;
         DMPlexPointLocalRead(faceDM, face, faceGeomArray, &fg) >> checkError;
-        DMPlexGetSupport(dm, face, &faceCells) >> checkError;
         DMPlexPointLocalRead(cellDM, faceCells[0], cellGeomArray, &cgL) >> checkError;
         DMPlexPointLocalRead(cellDM, faceCells[1], cellGeomArray, &cgR) >> checkError;
 
-        PetscInt leftFlowLabelValue = regionValue;
-        PetscInt rightFlowLabelValue = regionValue;
-        if (regionLabel) {
-            DMLabelGetValue(regionLabel, faceCells[0], &leftFlowLabelValue);
-            DMLabelGetValue(regionLabel, faceCells[1], &rightFlowLabelValue);
-        }
-
         // Check the normal direction, it should go from left[0] to right[1]
         PetscScalar lToR[3] = {0.0, 0.0, 0.0};
         ablate::utilities::MathUtilities::Subtract(dim, cgR->centroid, cgL->centroid, lToR);
@@ -99,112 +106,116 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
         // Check the normal direction
         auto direction = ablate::utilities::MathUtilities::DotVector(dim, lToR, fg->normal);
         if (direction <= 0) {
+            wrongNormals++;
             std::cout << "Normal in wrong direction for face: " << face << " with norm [" << fg->normal[0] << ", " << fg->normal[1] << ", " << fg->normal[2] << "]" << std::endl;
             std::cout << "\t leftCell " << faceCells[0] << ": [" << cgL->centroid[0] << ", " << cgL->centroid[1] << ", " << cgL->centroid[2] << "]" << std::endl;
             std::cout << "\t rightCell " << faceCells[1] << ": [" << cgR->centroid[0] << ", " << cgR->centroid[1] << ", " << cgR->centroid[2] << "]" << std::endl;
         }
 
-        // check value
-        PetscInt cellLabelValue = regionValue;
-        ghost = -1;
-        if (ghostLabel) {
-            DMLabelGetValue(ghostLabel, faceCells[0], &ghost) >> checkError;
-        }
-        if (regionLabel) {
-            DMLabelGetValue(regionLabel, faceCells[0], &cellLabelValue) >> checkError;
-        }
-        if (ghost <= 0 && regionValue == cellLabelValue && (boundaryCellStart < 0 || faceCells[0] < boundaryCellStart)) {
-            if (!cellAreas.count(faceCells[0])) {
-                cellAreas[faceCells[0]] = {0, 0, 0};
-                faceCount[faceCells[0]] = 0;
+        if (checkLeft) {
+            for (PetscInt d = 0; d < 3; ++d) {
+                areas[3 * (faceCells[0] - cStart) + d] -= fg->normal[d];
             }
-
-            cellAreas[faceCells[0]][0] -= fg->normal[0];
-            cellAreas[faceCells[0]][1] -= fg->normal[1];
-            cellAreas[faceCells[0]][2] -= fg->normal[2];
-            faceCount[faceCells[0]]++;
-        }
-
-        cellLabelValue = regionValue;
-        ghost = -1;
-        if (ghostLabel) {
-            DMLabelGetValue(ghostLabel, faceCells[1], &ghost) >> checkError;
-        }
-        if (regionLabel) {
-            DMLabelGetValue(regionLabel, faceCells[1], &cellLabelValue) >> checkError;
+            faceCounts[faceCells[0] - cStart]++;
         }
-        if (ghost <= 0 && regionValue == cellLabelValue && (boundaryCellStart < 0 || faceCells[1] < boundaryCellStart)) {
-            if (!cellAreas.count(faceCells[1])) {
-                cellAreas[faceCells[1]] = {0, 0, 0};
-                faceCount[faceCells[1]] = 0;
+        if (checkRight) {
+            for (PetscInt d = 0; d < 3; ++d) {
+                areas[3 * (faceCells[1] - cStart) + d] += fg->normal[d];
             }
-
-            cellAreas[faceCells[1]][0] += fg->normal[0];
-            cellAreas[faceCells[1]][1] += fg->normal[1];
-            cellAreas[faceCells[1]][2] += fg->normal[2];
-            faceCount[faceCells[1]]++;
+            faceCounts[faceCells[1] - cStart]++;
         }
     }
 
-    utilities::MpiUtilities::RoundRobin(PetscObjectComm((PetscObject)dm), [&](int rank) {
-        // Check over each cell that was contributed to
-        for (const auto& cellInfo : cellAreas) {
-            bool nonZeroArea = false;
-            for (PetscInt d = 0; d < dim; d++) {
-                // Make sure each area contribution is zero
-                if (cellInfo.second[d] > 1E-12 || cellInfo.second[d] < -1E-12) {
-                    nonZeroArea = true;
-                }
+    // Check over each cell that was contributed to
+    struct CellIssue {
+        PetscInt cell;
+        bool nonZeroArea;
+        bool wrongFaceCount;
+        bool wrongNodeCount;
+        std::size_t nodeCount;
+    };
+    std::vector<CellIssue> cellIssues;
+    PetscInt checkedCells = 0;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        if (faceCounts[c - cStart] == 0) {
+            continue;
+        }
+        checkedCells++;
+
+        bool nonZeroArea = false;
+        for (PetscInt d = 0; d < dim; d++) {
+            // Make sure each area contribution is zero
+            if (PetscAbsReal(areas[3 * (c - cStart) + d]) > 1E-12) {
+                nonZeroArea = true;
             }
+        }
 
-            // check the expected faces
-            bool wrongFaceCount = expectedFaceCount && (faceCount[cellInfo.first] != expectedFaceCount);
+        // check the expected faces
+        bool wrongFaceCount = expectedFaceCount && (faceCounts[c - cStart] != expectedFaceCount);
 
-            bool wrongNodeCount = false;
-            std::set<PetscInt> nodesInCell;
-            if (expectedNodeCount) {
-                // Count the number of nodes in this cell
-                PetscInt* points = nullptr;
-                PetscInt numPoints;
-                DMPlexGetTransitiveClosure(dm, cellInfo.first, PETSC_TRUE, &numPoints, &points) >> checkError;
+        bool wrongNodeCount = false;
+        std::set<PetscInt> nodesInCell;
+        if (expectedNodeCount) {
+            // Count the number of nodes in this cell
+            PetscInt* points = nullptr;
+            PetscInt numPoints;
+            DMPlexGetTransitiveClosure(dm, c, PETSC_TRUE, &numPoints, &points) >> checkError;
 
-                for (PetscInt p = 0; p < numPoints; p++) {
-                    PetscInt point = points[p * 2];
+            for (PetscInt p = 0; p < numPoints; p++) {
+                PetscInt point = points[p * 2];
 
-                    // Check the depth
-                    PetscInt pointDepth = 0;
-                    DMPlexGetPointDepth(dm, point, &pointDepth) >> checkError;
+                // Check the depth
+                PetscInt pointDepth = 0;
+                DMPlexGetPointDepth(dm, point, &pointDepth) >> checkError;
 
-                    // check if node
-                    if (pointDepth == 0) {
-                        nodesInCell.insert(point);
-                    }
+                // check if node
+                if (pointDepth == 0) {
+                    nodesInCell.insert(point);
                 }
-
-                wrongNodeCount = (expectedNodeCount != (PetscInt)nodesInCell.size());
             }
+            DMPlexRestoreTransitiveClosure(dm, c, PETSC_TRUE, &numPoints, &points) >> checkError;
+
+            wrongNodeCount = (expectedNodeCount != (PetscInt)nodesInCell.size());
+        }
+
+        if (nonZeroArea || wrongFaceCount || wrongNodeCount) {
+            cellIssues.push_back(CellIssue{.cell = c, .nonZeroArea = nonZeroArea, .wrongFaceCount = wrongFaceCount, .wrongNodeCount = wrongNodeCount, .nodeCount = nodesInCell.size()});
+        }
+    }
 
-            if (nonZeroArea || wrongFaceCount || wrongNodeCount) {
+    // Combine the counts from every rank in a single reduction, the details are only printed (one rank at a time) if there are issues
+    PetscInt localCounts[3] = {checkedCells, (PetscInt)cellIssues.size(), wrongNormals};
+    PetscInt globalCounts[3];
+    MPI_Allreduce(localCounts, globalCounts, 3, MPIU_INT, MPI_SUM, comm) >> checkMpiError;
+    PetscMPIInt commRank;
+    MPI_Comm_rank(comm, &commRank) >> checkMpiError;
+    if (commRank == 0) {
+        std::cout << ToString() << " checked " << globalCounts[0] << " cells, found " << globalCounts[1] << " cells with issues and " << globalCounts[2]
+                  << " faces with a normal in the wrong direction" << std::endl;
+    }
+    if (globalCounts[1] > 0) {
+        utilities::MpiUtilities::RoundRobin(comm, [&](int rank) {
+            for (const auto& issue : cellIssues) {
                 PetscFVCellGeom* cg;
-                DMPlexPointLocalRead(cellDM, cellInfo.first, cellGeomArray, &cg) >> checkError;
+                DMPlexPointLocalRead(cellDM, issue.cell, cellGeomArray, &cg) >> checkError;
 
-                std::cout << "Issues with Cell: " << cellInfo.first << " at [" << cg->centroid[0] << ", " << cg->centroid[1] << ", " << cg->centroid[2] << "]" << std::endl;
+                std::cout << "Issues with Cell: " << issue.cell << " at [" << cg->centroid[0] << ", " << cg->centroid[1] << ", " << cg->centroid[2] << "]" << std::endl;
                 if (expectedFaceCount) {
-                    std::cout << "wrongFaceCount: " << wrongFaceCount << std::endl;
-                    std::cout << "\tfaceCount: " << faceCount[cellInfo.first] << std::endl;
+                    std::cout << "wrongFaceCount: " << issue.wrongFaceCount << std::endl;
+                    std::cout << "\tfaceCount: " << faceCounts[issue.cell - cStart] << std::endl;
                 }
                 if (expectedNodeCount) {
-                    std::cout << "wrongNodeCount: " << wrongNodeCount << std::endl;
-                    std::cout << "\tnodeCount: " << nodesInCell.size() << std::endl;
+                    std::cout << "wrongNodeCount: " << issue.wrongNodeCount << std::endl;
+                    std::cout << "\tnodeCount: " << issue.nodeCount << std::endl;
                 }
-                std::cout << "nonZeroArea: " << nonZeroArea << std::endl;
+                std::cout << "nonZeroArea: " << issue.nonZeroArea << std::endl;
                 for (PetscInt d = 0; d < dim; d++) {
-                    std::cout << "\tarea[" << d << "]: " << std::setprecision(16) << cellInfo.second[d] << std::endl;
+                    std::cout << "\tarea[" << d << "]: " << std::setprecision(16) << areas[3 * (issue.cell - cStart) + d] << std::endl;
                 }
 
                 // DM dm, PetscInt cell, PetscReal *vol, PetscReal centroid[], PetscReal normal[]
                 PetscReal volume;
-                DMPlexComputeCellGeometryFVM(dm, cellInfo.first, &volume, nullptr, nullptr) >> checkError;
+                DMPlexComputeCellGeometryFVM(dm, issue.cell, &volume, nullptr, nullptr) >> checkError;
                 std::cout << "volume: " << std::setprecision(16) << volume << std::endl;
 
                 // Print all labels at this cell
@@ -218,7 +229,7 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
                     const char* labelName;
                     DMGetLabelName(dm, l, &labelName) >> checkError;
                     PetscInt labelCheckValue;
-                    DMLabelGetValue(labelCheck, cellInfo.first, &labelCheckValue) >> checkError;
+                    DMLabelGetValue(labelCheck, issue.cell, &labelCheckValue) >> checkError;
                     PetscInt labelDefaultValue;
                     DMLabelGetDefaultValue(labelCheck, &labelDefaultValue) >> checkError;
                     if (labelDefaultValue != labelCheckValue) {
@@ -230,8 +241,8 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
                 // March over each face connected to this cell
                 const PetscInt* faces;
                 PetscInt numberFaces;
-                DMPlexGetConeSize(dm, cellInfo.first, &numberFaces) >> checkError;
-                DMPlexGetCone(dm, cellInfo.first, &faces) >> checkError;
+                DMPlexGetConeSize(dm, issue.cell, &numberFaces) >> checkError;
+                DMPlexGetCone(dm, issue.cell, &faces) >> checkError;
                 std::cout << "faces: " << std::endl;
 
                 for (PetscInt f = 0; f < numberFaces; f++) {
@@ -275,7 +286,7 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
                     ablate::utilities::MathUtilities::Subtract(dim, rightCellCentroid, leftCellCentroid, lToR);
 
                     // Check if left or right
-                    PetscInt leftOrRight = leftCell == cellInfo.first ? -1 : 1;
+                    PetscInt leftOrRight = leftCell == issue.cell ? -1 : 1;
 
                     // Check the normal direction
                     auto direction = PetscSignReal(ablate::utilities::MathUtilities::DotVector(dim, lToR, normal));
@@ -321,13 +332,12 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
                             PetscScalar nodeLocation[3];
                             DMPlexComputeCellGeometryFVM(dm, point, nullptr, nodeLocation, nullptr) >> checkError;
                             std::cout << "\t\t\t" << point << ": [" << nodeLocation[0] << ", " << nodeLocation[1] << ", " << nodeLocation[2] << "]" << std::endl;
-                            nodesInCell.insert(point);
                         }
                     }
                 }
             }
-        }
-    });
+        });
+    }
 
     // cleanup
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
@@ -340,6 +350,71 @@ void ablate::domain::modifiers::FvmCheck::Modify(DM& dm) {
 
 std::string ablate::domain::modifiers::FvmCheck::ToString() const { return "ablate::domain::modifiers::FvmCheck: " + (region ? region->ToString() : ""); }
 
+std::vector<bool> ablate::domain::modifiers::FvmCheck::SelectCells(DM dm, DMLabel regionLabel, PetscInt regionValue, DMLabel ghostLabel, PetscInt boundaryCellStart) const {
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+
+    // the cells that are shared from another rank, their neighbors are on the partition boundary
+    std::vector<bool> leafCell(cEnd - cStart, false);
+    if (partitionBoundaryOnly) {
+        PetscSF pointSF;
+        PetscInt numberLeaves;
+        const PetscInt* leaves;
+        DMGetPointSF(dm, &pointSF) >> checkError;
+        PetscSFGetGraph(pointSF, nullptr, &numberLeaves, &leaves, nullptr) >> checkError;
+        for (PetscInt l = 0; l < PetscMax(numberLeaves, 0); ++l) {
+            const PetscInt leaf = leaves ? leaves[l] : l;
+            if (leaf >= cStart && leaf < cEnd) {
+                leafCell[leaf - cStart] = true;
+            }
+        }
+    }
+
+    std::vector<bool> checkCell(cEnd - cStart, false);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        // only check a sample of the cells
+        if ((c - cStart) % sampleStride != 0) {
+            continue;
+        }
+
+        // skip the ghost cells and cells outside of the region
+        PetscInt ghost = -1;
+        if (ghostLabel) {
+            DMLabelGetValue(ghostLabel, c, &ghost) >> checkError;
+        }
+        PetscInt cellLabelValue = regionValue;
+        if (regionLabel) {
+            DMLabelGetValue(regionLabel, c, &cellLabelValue) >> checkError;
+        }
+        if (ghost > 0 || cellLabelValue != regionValue || (boundaryCellStart >= 0 && c >= boundaryCellStart)) {
+            continue;
+        }
+
+        // only check cells next to a cell from another rank
+        if (partitionBoundaryOnly) {
+            bool partitionBoundary = false;
+            const PetscInt* faces;
+            PetscInt numberFaces;
+            DMPlexGetConeSize(dm, c, &numberFaces) >> checkError;
+            DMPlexGetCone(dm, c, &faces) >> checkError;
+            for (PetscInt f = 0; f < numberFaces && !partitionBoundary; ++f) {
+                const PetscInt* cells;
+                PetscInt numberCells;
+                DMPlexGetSupportSize(dm, faces[f], &numberCells) >> checkError;
+                DMPlexGetSupport(dm, faces[f], &cells) >> checkError;
+                for (PetscInt n = 0; n < numberCells; ++n) {
+                    partitionBoundary = partitionBoundary || (cells[n] >= cStart && cells[n] < cEnd && leafCell[cells[n] - cStart]);
+                }
+            }
+            if (!partitionBoundary) {
+                continue;
+            }
+        }
+        checkCell[c - cStart] = true;
+    }
+    return checkCell;
+}
+
 void ablate::domain::modifiers::FvmCheck::GetRange(DM dm, PetscInt depth, ablate::solver::Range& range) const {
     // Start out getting all the points
     IS allPointIS;
@@ -388,4 +463,6 @@ REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::FvmChec
          "The FVM check marches over each face in a mesh region, sums the contributions for each cell in the region to ensure they sum to 0.0",
          OPT(ablate::domain::Region, "region", "the region describing the boundary cells, default is everywhere"),
          OPT(int, "expectedFaceCount", "if specified, the fvmCheck each cell for the correct number of faces"),
-         OPT(int, "expectedNodeCount", "if specified, the fvmCheck each cell for the correct number of nodes"));
\ No newline at end of file
+         OPT(int, "expectedNodeCount", "if specified, the fvmCheck each cell for the correct number of nodes"),
+         OPT(int, "sampleStride", "only check every sampleStride cell so the check can be left on for large meshes (default is 1)"),
+         OPT(bool, "partitionBoundaryOnly", "only check the cells next to a cell from another rank (default is false)"));
\ No newline at end of file
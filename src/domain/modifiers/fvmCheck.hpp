@@ -3,6 +3,7 @@
 
 #include <domain/region.hpp>
 #include <memory>
+#include <vector>
 #include "mathFunctions/mathFunction.hpp"
 #include "modifier.hpp"
 #include "solver/range.hpp"
@@ -23,6 +24,12 @@ class FvmCheck : public Modifier {
     //! The number of expected nodes for each cell
     const PetscInt expectedNodeCount;
 
+    //! only every sampleStride cell is checked
+    const PetscInt sampleStride;
+
+    //! only check the cells next to a cell from another rank
+    const bool partitionBoundaryOnly;
+
    private:
     /**
      * modified version of the get range call
@@ -37,12 +44,27 @@ class FvmCheck : public Modifier {
      */
     static void RestoreRange(DM dm, ablate::solver::Range &range);
 
+    /**
+     * Determine the cells in the region that should be checked, using the sample stride and partition boundary options
+     * @param dm
+     * @param regionLabel
+     * @param regionValue
+     * @param ghostLabel
+     * @param boundaryCellStart
+     * @return a flag for each cell in the height 0 stratum
+     */
+    std::vector<bool> SelectCells(DM dm, DMLabel regionLabel, PetscInt regionValue, DMLabel ghostLabel, PetscInt boundaryCellStart) const;
+
    public:
     /**
      * The region to check over the boundary cells
      * @param regions
+     * @param expectedFaceCount
+     * @param expectedNodeCount
+     * @param sampleStride only check every sampleStride cell
+     * @param partitionBoundaryOnly only check the cells next to a cell from another rank
      */
-    explicit FvmCheck(std::shared_ptr<domain::Region> fvmRegion, int expectedFaceCount = {}, int expectedNodeCount = {});
+    explicit FvmCheck(std::shared_ptr<domain::Region> fvmRegion, int expectedFaceCount = {}, int expectedNodeCount = {}, int sampleStride = 1, bool partitionBoundaryOnly = false);
 
     /**
      * Check the supplied dm
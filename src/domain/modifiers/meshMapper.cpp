@@ -28,26 +28,22 @@ void ablate::domain::modifiers::MeshMapper::Modify(DM& dm) {
         PetscScalar* coordsArray;
 
         // get the vertex information
-        PetscInt vStart, vEnd;
+        PetscInt vStart, vEnd, localSize;
         DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd) >> checkError;
         DMGetCoordinateSection(dm, &coordsSection) >> checkError;
         DMGetCoordinatesLocal(dm, &localCoordsVector) >> checkError;
+        VecGetLocalSize(localCoordsVector, &localSize) >> checkError;
         VecGetArray(localCoordsVector, &coordsArray) >> checkError;
 
-        // store the initial copy of xyz
-        PetscReal xyz[3];
-
-        for (PetscInt v = vStart; v < vEnd; ++v) {
-            PetscInt off;
-            PetscSectionGetOffset(coordsSection, v, &off);
-
-            // extract the initial x, y, z values
-            for (PetscInt d = 0; d < coordinateDim; ++d) {
-                xyz[d] = coordsArray[off + d];
+        if (localSize == (vEnd - vStart) * coordinateDim) {
+            // the array only holds vertex coordinates, so it can be mapped in place as one batch regardless of the vertex order
+            MapCoordinates(coordinateDim, vEnd - vStart, coordsArray);
+        } else {
+            for (PetscInt v = vStart; v < vEnd; ++v) {
+                PetscInt off;
+                PetscSectionGetOffset(coordsSection, v, &off) >> checkError;
+                MapCoordinates(coordinateDim, 1, coordsArray + off);
             }
-
-            // call the mapping function
-            petscFunction(coordinateDim, 0.0, xyz, coordinateDim, coordsArray + off, petscCtx) >> checkError;
         }
         VecRestoreArray(localCoordsVector, &coordsArray) >> checkError;
         DMSetCoordinatesLocal(dm, localCoordsVector) >> checkError;
@@ -80,6 +76,23 @@ void ablate::domain::modifiers::MeshMapper::Modify(DM& dm) {
         DMSetCoordinatesLocal(dm, lCoords);
     }
 }
+void ablate::domain::modifiers::MeshMapper::MapCoordinates(PetscInt dim, PetscInt numberPoints, PetscScalar* coordinates) const {
+    auto petscFunction = mappingFunction->GetPetscFunction();
+    auto petscCtx = mappingFunction->GetContext();
+
+    // store the initial copy of xyz
+    PetscReal xyz[3];
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        PetscScalar* point = coordinates + p * dim;
+        for (PetscInt d = 0; d < dim; ++d) {
+            xyz[d] = point[d];
+        }
+
+        // call the mapping function
+        petscFunction(dim, 0.0, xyz, dim, point, petscCtx) >> checkError;
+    }
+}
+
 void ablate::domain::modifiers::MeshMapper::Modify(const std::vector<double>& in, std::vector<double>& out) const {
     out.resize(in.size());
     mappingFunction->Eval(in.data(), (int)in.size(), 0.0, out);
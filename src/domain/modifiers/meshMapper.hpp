@@ -11,6 +11,16 @@ class MeshMapper : public Modifier {
    private:
     const std::shared_ptr<ablate::mathFunctions::MathFunction> mappingFunction;
 
+   protected:
+    /**
+     * Map a contiguous array of points in place, stored in [point*dim + d] order.  The default evaluates the mapping function one point at a time, derived
+     * mappers override it with a batched implementation.
+     * @param dim the coordinate dimension
+     * @param numberPoints the number of points in the array
+     * @param coordinates the coordinates to map
+     */
+    virtual void MapCoordinates(PetscInt dim, PetscInt numberPoints, PetscScalar* coordinates) const;
+
    public:
     /**
      * General constructor for all mesh mappers
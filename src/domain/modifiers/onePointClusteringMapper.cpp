@@ -26,19 +26,25 @@ PetscErrorCode ablate::domain::modifiers::OnePointClusteringMapper::MappingFunct
     for (PetscInt d = 0; d < dim; d++) {
         u[d] = x[d];
     }
+    map->MapCoordinates(dim, 1, u);
+    PetscFunctionReturn(0);
+}
 
+void ablate::domain::modifiers::OnePointClusteringMapper::MapCoordinates(PetscInt dim, PetscInt numberPoints, PetscScalar *coordinates) const {
     // Get the org location
-    PetscReal term1 = 1 + (PetscExpReal(map->beta) - 1.0) * map->location / map->size;
-    PetscReal term2 = 1 + (PetscExpReal(-map->beta) - 1.0) * map->location / map->size;
-    PetscReal A = (1.0 / (2.0 * map->beta)) * PetscLogReal(term1 / term2);
-    u[map->direction] -= map->start;
-    PetscReal eta = u[map->direction] / map->size;
-    PetscReal newLocation = map->location * (1.0 + (PetscSinhReal(map->beta * (eta - A))) / PetscSinhReal(map->beta * A));
-    if (!PetscIsInfOrNanReal(u[map->direction])) {
-        u[map->direction] = newLocation;
+    const PetscReal term1 = 1 + (PetscExpReal(beta) - 1.0) * location / size;
+    const PetscReal term2 = 1 + (PetscExpReal(-beta) - 1.0) * location / size;
+    const PetscReal A = (1.0 / (2.0 * beta)) * PetscLogReal(term1 / term2);
+    const PetscReal inverseSinhBetaA = 1.0 / PetscSinhReal(beta * A);
+
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        PetscScalar &u = coordinates[p * dim + direction];
+        const PetscReal eta = (u - start) / size;
+        const PetscReal newLocation = location * (1.0 + PetscSinhReal(beta * (eta - A)) * inverseSinhBetaA);
+        if (!PetscIsInfOrNanReal(u)) {
+            u = newLocation + start;
+        }
     }
-    u[map->direction] += map->start;
-    PetscFunctionReturn(0);
 }
 
 #include "registrar.hpp"
@@ -0,0 +1,75 @@
+#include "refineByGradient.hpp"
+#include <utility>
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::domain::modifiers::RefineByGradient::RefineByGradient(std::shared_ptr<mathFunctions::MathFunction> sensor, double threshold, int levels)
+    : sensor(std::move(sensor)), threshold(threshold), levels(levels < 1 ? 1 : levels) {}
+
+void ablate::domain::modifiers::RefineByGradient::Modify(DM& dm) {
+    for (int level = 0; level < levels; ++level) {
+        DMLabel adaptLabel;
+        DMLabelCreate(PETSC_COMM_SELF, "adapt", &adaptLabel) >> checkError;
+
+        // stop early once the front is resolved
+        PetscInt localMarked = MarkCells(dm, adaptLabel), globalMarked;
+        MPI_Allreduce(&localMarked, &globalMarked, 1, MPIU_INT, MPI_SUM, PetscObjectComm((PetscObject)dm)) >> checkMpiError;
+        if (globalMarked == 0) {
+            DMLabelDestroy(&adaptLabel) >> checkError;
+            break;
+        }
+
+        DM adaptedDm = nullptr;
+        DMAdaptLabel(dm, adaptLabel, &adaptedDm) >> checkError;
+        DMLabelDestroy(&adaptLabel) >> checkError;
+        ReplaceDm(dm, adaptedDm);
+    }
+}
+
+PetscInt ablate::domain::modifiers::RefineByGradient::MarkCells(DM dm, DMLabel label) const {
+    PetscInt dim, coordinateDim, cStart, cEnd;
+    DMGetDimension(dm, &dim) >> checkError;
+    DMGetCoordinateDim(dm, &coordinateDim) >> checkError;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+
+    DM coordinateDm;
+    Vec coordinates;
+    DMGetCoordinateDM(dm, &coordinateDm) >> checkError;
+    DMGetCoordinatesLocal(dm, &coordinates) >> checkError;
+
+    PetscInt marked = 0;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        // the size of the cell
+        PetscReal volume;
+        DMPlexComputeCellGeometryFVM(dm, c, &volume, nullptr, nullptr) >> checkError;
+        const PetscReal h = PetscPowReal(volume, 1.0 / (PetscReal)dim);
+
+        // the range of the sensor over the cell vertices
+        PetscInt closureSize;
+        PetscScalar* closureCoordinates = nullptr;
+        DMPlexVecGetClosure(coordinateDm, nullptr, coordinates, c, &closureSize, &closureCoordinates) >> checkError;
+        PetscReal minValue = PETSC_MAX_REAL, maxValue = PETSC_MIN_REAL;
+        for (PetscInt v = 0; v < closureSize / coordinateDim; ++v) {
+            double xyz[3] = {0.0, 0.0, 0.0};
+            for (PetscInt d = 0; d < coordinateDim; ++d) {
+                xyz[d] = PetscRealPart(closureCoordinates[v * coordinateDim + d]);
+            }
+            const auto value = (PetscReal)sensor->Eval(xyz, (int)coordinateDim, 0.0);
+            minValue = PetscMin(minValue, value);
+            maxValue = PetscMax(maxValue, value);
+        }
+        DMPlexVecRestoreClosure(coordinateDm, nullptr, coordinates, c, &closureSize, &closureCoordinates) >> checkError;
+
+        if (h > 0.0 && (maxValue - minValue) / h > threshold) {
+            DMLabelSetValue(label, c, DM_ADAPT_REFINE) >> checkError;
+            marked++;
+        }
+    }
+    return marked;
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::RefineByGradient, "Locally refines the cells where the gradient of a sensor function is above a threshold",
+         ARG(ablate::mathFunctions::MathFunction, "sensor", "the sensor function, usually the initial profile of the field that should be resolved"),
+         ARG(double, "threshold", "cells with an estimated gradient magnitude larger than the threshold are refined"),
+         OPT(int, "levels", "the number of refinement levels (default is 1)"));
@@ -0,0 +1,48 @@
+#ifndef ABLATELIBRARY_REFINEBYGRADIENT_HPP
+#define ABLATELIBRARY_REFINEBYGRADIENT_HPP
+
+#include <memory>
+#include "mathFunctions/mathFunction.hpp"
+#include "modifier.hpp"
+
+namespace ablate::domain::modifiers {
+
+/**
+ * Locally refine the cells where the gradient of a sensor function is large, such as the initial profile of a flame or regression front.  The gradient in each
+ * cell is estimated from the range of the function over the cell vertices divided by the cell size, and the marked cells are refined with DMAdaptLabel.  This
+ * is repeated for each level, so only the cells near the front are refined instead of the whole region.  It should be applied before distribution.
+ */
+class RefineByGradient : public Modifier {
+   private:
+    //! the sensor function, usually the initial condition of the field that should be resolved
+    const std::shared_ptr<mathFunctions::MathFunction> sensor;
+
+    //! cells with an estimated gradient magnitude larger than the threshold are refined
+    const double threshold;
+
+    //! the number of times the marked cells are refined
+    const int levels;
+
+    /**
+     * Create the adapt label marking every cell with a gradient above the threshold
+     * @param dm
+     * @param label
+     * @return the number of marked cells
+     */
+    PetscInt MarkCells(DM dm, DMLabel label) const;
+
+   public:
+    /**
+     * @param sensor the sensor function
+     * @param threshold cells with an estimated gradient magnitude larger than the threshold are refined
+     * @param levels the number of refinement levels (default is 1)
+     */
+    RefineByGradient(std::shared_ptr<mathFunctions::MathFunction> sensor, double threshold, int levels = 1);
+
+    void Modify(DM&) override;
+
+    std::string ToString() const override { return "ablate::domain::modifiers::RefineByGradient"; }
+};
+
+}  // namespace ablate::domain::modifiers
+#endif  // ABLATELIBRARY_REFINEBYGRADIENT_HPP
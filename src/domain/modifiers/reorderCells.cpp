@@ -0,0 +1,249 @@
+#include "reorderCells.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include "utilities/petscError.hpp"
+
+ablate::domain::modifiers::ReorderCells::ReorderCells(Ordering ordering) : ordering(ordering) {}
+
+void ablate::domain::modifiers::ReorderCells::Modify(DM& dm) {
+    // the natural sf maps to the unpermuted points
+    PetscBool useNatural;
+    DMGetUseNatural(dm, &useNatural) >> checkError;
+    if (useNatural) {
+        throw std::invalid_argument("The ReorderCells modifier cannot be used with the natural ordering");
+    }
+
+    // the permutation does not keep the finite volume ghost cells at the end of the cell range
+    PetscInt ghostStart, ghostEnd;
+    DMPlexGetCellTypeStratum(dm, DM_POLYTOPE_FV_GHOST, &ghostStart, &ghostEnd) >> checkError;
+    if (ghostEnd > ghostStart) {
+        throw std::invalid_argument("The ReorderCells modifier must be applied before any ghost boundary cells are added");
+    }
+
+    IS perm;
+    switch (ordering) {
+        case Ordering::RCM:
+            // the plex ordering numbers the cells by rcm and every other point by its first appearance in the cell closures
+            DMPlexGetOrdering(dm, MATORDERINGRCM, nullptr, &perm) >> checkError;
+            break;
+        case Ordering::HILBERT:
+            CreateClosurePermutation(dm, ComputeHilbertCellOrder(dm), &perm);
+            break;
+        default:
+            throw std::invalid_argument("Unknown ordering for ReorderCells");
+    }
+
+    DM permutedDm;
+    DMPlexPermute(dm, perm, &permutedDm) >> checkError;
+    PermutePointSF(dm, perm, permutedDm);
+    ISDestroy(&perm) >> checkError;
+
+    // keep the adjacency used by the fvm
+    PetscBool useCone, useClosure;
+    DMGetBasicAdjacency(dm, &useCone, &useClosure) >> checkError;
+    DMSetBasicAdjacency(permutedDm, useCone, useClosure) >> checkError;
+
+    ReplaceDm(dm, permutedDm);
+}
+
+/**
+ * Compute the Hilbert curve index of integer coordinates using Skilling's transpose algorithm
+ * @param x the coordinates, each with bits bits
+ * @param dim
+ * @param bits
+ * @return
+ */
+static uint64_t HilbertIndex(std::array<uint32_t, 3> x, PetscInt dim, int bits) {
+    // inverse undo of the excess work
+    const uint32_t m = 1u << (bits - 1);
+    for (uint32_t q = m; q > 1; q >>= 1) {
+        const uint32_t p = q - 1;
+        for (PetscInt i = 0; i < dim; ++i) {
+            if (x[i] & q) {
+                x[0] ^= p;
+            } else {
+                const uint32_t t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // gray encode
+    for (PetscInt i = 1; i < dim; ++i) {
+        x[i] ^= x[i - 1];
+    }
+    uint32_t t = 0;
+    for (uint32_t q = m; q > 1; q >>= 1) {
+        if (x[dim - 1] & q) {
+            t ^= q - 1;
+        }
+    }
+    for (PetscInt i = 0; i < dim; ++i) {
+        x[i] ^= t;
+    }
+
+    // interleave the transposed bits, most significant first
+    uint64_t index = 0;
+    for (int b = bits - 1; b >= 0; --b) {
+        for (PetscInt i = 0; i < dim; ++i) {
+            index = (index << 1) | ((x[i] >> b) & 1u);
+        }
+    }
+    return index;
+}
+
+std::vector<PetscInt> ablate::domain::modifiers::ReorderCells::ComputeHilbertCellOrder(DM dm) {
+    PetscInt dim, cStart, cEnd;
+    DMGetCoordinateDim(dm, &dim) >> checkError;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+
+    // compute the centroid of each cell and the bounding box of the centroids
+    std::vector<PetscReal> centroids((cEnd - cStart) * dim);
+    std::array<PetscReal, 3> lower = {PETSC_MAX_REAL, PETSC_MAX_REAL, PETSC_MAX_REAL};
+    std::array<PetscReal, 3> upper = {PETSC_MIN_REAL, PETSC_MIN_REAL, PETSC_MIN_REAL};
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal volume;
+        PetscReal* centroid = centroids.data() + (c - cStart) * dim;
+        DMPlexComputeCellGeometryFVM(dm, c, &volume, centroid, nullptr) >> checkError;
+        for (PetscInt d = 0; d < dim; ++d) {
+            lower[d] = PetscMin(lower[d], centroid[d]);
+            upper[d] = PetscMax(upper[d], centroid[d]);
+        }
+    }
+
+    // quantize each centroid so the index fits in 64 bits
+    const int bits = 21;
+    const auto maxCoordinate = (PetscReal)((1u << bits) - 1);
+    std::vector<uint64_t> indices(cEnd - cStart);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        std::array<uint32_t, 3> x = {0, 0, 0};
+        for (PetscInt d = 0; d < dim; ++d) {
+            const PetscReal range = upper[d] - lower[d];
+            x[d] = range > 0.0 ? (uint32_t)((centroids[(c - cStart) * dim + d] - lower[d]) / range * maxCoordinate) : 0;
+        }
+        indices[c - cStart] = HilbertIndex(x, dim, bits);
+    }
+
+    std::vector<PetscInt> cellOrder(cEnd - cStart);
+    std::iota(cellOrder.begin(), cellOrder.end(), cStart);
+    std::stable_sort(cellOrder.begin(), cellOrder.end(), [&indices, cStart](auto a, auto b) { return indices[a - cStart] < indices[b - cStart]; });
+    return cellOrder;
+}
+
+void ablate::domain::modifiers::ReorderCells::CreateClosurePermutation(DM dm, const std::vector<PetscInt>& cellOrder, IS* perm) {
+    PetscInt pStart, pEnd, depth;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> checkError;
+    DMPlexGetDepth(dm, &depth) >> checkError;
+
+    // the next new point number in each depth stratum
+    std::vector<PetscInt> nextPoint(depth + 1);
+    for (PetscInt d = 0; d <= depth; ++d) {
+        DMPlexGetDepthStratum(dm, d, &nextPoint[d], nullptr) >> checkError;
+    }
+
+    PetscInt* newPoints;
+    PetscMalloc1(pEnd - pStart, &newPoints) >> checkError;
+    std::fill(newPoints, newPoints + (pEnd - pStart), -1);
+    auto numberPoint = [dm, pStart, newPoints, &nextPoint](PetscInt p) {
+        if (newPoints[p - pStart] < 0) {
+            PetscInt pointDepth;
+            DMPlexGetPointDepth(dm, p, &pointDepth) >> checkError;
+            newPoints[p - pStart] = nextPoint[pointDepth]++;
+        }
+    };
+
+    // number the points in the order they appear in the closure of the ordered cells
+    for (const auto& cell : cellOrder) {
+        PetscInt closureSize;
+        PetscInt* closure = nullptr;
+        DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure) >> checkError;
+        for (PetscInt i = 0; i < closureSize; ++i) {
+            numberPoint(closure[2 * i]);
+        }
+        DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure) >> checkError;
+    }
+
+    // any point not in a cell closure keeps its relative order
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        numberPoint(p);
+    }
+
+    ISCreateGeneral(PETSC_COMM_SELF, pEnd - pStart, newPoints, PETSC_OWN_POINTER, perm) >> checkError;
+}
+
+void ablate::domain::modifiers::ReorderCells::PermutePointSF(DM dm, IS perm, DM permutedDm) {
+    PetscSF pointSF;
+    DMGetPointSF(dm, &pointSF) >> checkError;
+    PetscInt numberRoots, numberLeaves;
+    const PetscInt* leaves;
+    const PetscSFNode* remotes;
+    PetscSFGetGraph(pointSF, &numberRoots, &numberLeaves, &leaves, &remotes) >> checkError;
+    if (numberRoots < 0) {
+        return;
+    }
+
+    // send the new number of each root to the leaves that reference it
+    const PetscInt* newPoints;
+    ISGetIndices(perm, &newPoints) >> checkError;
+    std::vector<PetscInt> newRemotePoints(numberRoots, -1);
+    PetscSFBcastBegin(pointSF, MPIU_INT, newPoints, newRemotePoints.data(), MPI_REPLACE) >> checkError;
+    PetscSFBcastEnd(pointSF, MPIU_INT, newPoints, newRemotePoints.data(), MPI_REPLACE) >> checkError;
+
+    // renumber each leaf, keeping the leaves sorted
+    std::vector<std::pair<PetscInt, PetscSFNode>> graph(numberLeaves);
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        const PetscInt leaf = leaves ? leaves[l] : l;
+        graph[l] = std::make_pair(newPoints[leaf], PetscSFNode{.rank = remotes[l].rank, .index = newRemotePoints[leaf]});
+    }
+    ISRestoreIndices(perm, &newPoints) >> checkError;
+    std::sort(graph.begin(), graph.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    PetscInt* newLeaves;
+    PetscSFNode* newRemotes;
+    PetscMalloc1(numberLeaves, &newLeaves) >> checkError;
+    PetscMalloc1(numberLeaves, &newRemotes) >> checkError;
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        newLeaves[l] = graph[l].first;
+        newRemotes[l] = graph[l].second;
+    }
+
+    PetscSF permutedSF;
+    PetscSFCreate(PetscObjectComm((PetscObject)dm), &permutedSF) >> checkError;
+    PetscSFSetGraph(permutedSF, numberRoots, numberLeaves, newLeaves, PETSC_OWN_POINTER, newRemotes, PETSC_OWN_POINTER) >> checkError;
+    DMSetPointSF(permutedDm, permutedSF) >> checkError;
+    PetscSFDestroy(&permutedSF) >> checkError;
+}
+
+std::ostream& ablate::domain::modifiers::operator<<(std::ostream& os, const ablate::domain::modifiers::ReorderCells::Ordering& v) {
+    switch (v) {
+        case ReorderCells::Ordering::RCM:
+            return os << "rcm";
+        case ReorderCells::Ordering::HILBERT:
+            return os << "hilbert";
+        default:
+            return os;
+    }
+}
+
+std::istream& ablate::domain::modifiers::operator>>(std::istream& is, ablate::domain::modifiers::ReorderCells::Ordering& v) {
+    std::string enumString;
+    is >> enumString;
+
+    if (enumString.empty() || enumString == "rcm") {
+        v = ReorderCells::Ordering::RCM;
+    } else if (enumString == "hilbert") {
+        v = ReorderCells::Ordering::HILBERT;
+    } else {
+        throw std::invalid_argument("Unknown ordering " + enumString);
+    }
+    return is;
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::ReorderCells, "Renumbers the local mesh points for memory locality, should be applied after distribution",
+         ENUM(ablate::domain::modifiers::ReorderCells::Ordering, "ordering", "the cell ordering, 'rcm' (reverse Cuthill-McKee) or 'hilbert' (Hilbert curve of the cell centroids) (default is rcm)"));
@@ -0,0 +1,76 @@
+#ifndef ABLATELIBRARY_REORDERCELLS_HPP
+#define ABLATELIBRARY_REORDERCELLS_HPP
+
+#include <istream>
+#include <ostream>
+#include <vector>
+#include "modifier.hpp"
+
+namespace ablate::domain::modifiers {
+
+/**
+ * Renumber the local DMPlex points for memory locality using DMPlexPermute.  The cells are ordered by a reverse Cuthill-McKee ordering of the cell adjacency
+ * or by the Hilbert curve index of the cell centroids, and every other depth stratum (faces, edges, vertices) follows the same order as it first appears in the
+ * closure of the ordered cells.  This should be applied after distribution and must be applied before any ghost boundary cells are added (an exception is
+ * thrown if the mesh has finite volume ghost cells).  The point sf is renumbered on every rank, so it may be used in parallel.
+ */
+class ReorderCells : public Modifier {
+   public:
+    enum class Ordering { RCM, HILBERT };
+
+   private:
+    const Ordering ordering;
+
+    /**
+     * Compute the new cell order by the Hilbert index of each cell centroid
+     * @param dm
+     * @return the cells in the new order
+     */
+    static std::vector<PetscInt> ComputeHilbertCellOrder(DM dm);
+
+    /**
+     * Build the point permutation (perm[old point] = new point) from the cell order.  Each depth stratum keeps its range and the points are numbered
+     * in the order they first appear in the closure of the ordered cells.
+     * @param dm
+     * @param cellOrder
+     * @param perm
+     */
+    static void CreateClosurePermutation(DM dm, const std::vector<PetscInt>& cellOrder, IS* perm);
+
+    /**
+     * Renumber the point sf of the original dm with the permutation and set it on the permuted dm.  The new root numbers are sent to the leaves over the sf.
+     * @param dm
+     * @param perm
+     * @param permutedDm
+     */
+    static void PermutePointSF(DM dm, IS perm, DM permutedDm);
+
+   public:
+    /**
+     * @param ordering the cell ordering (default is rcm)
+     */
+    explicit ReorderCells(Ordering ordering = Ordering::RCM);
+
+    void Modify(DM&) override;
+
+    std::string ToString() const override { return "ablate::domain::modifiers::ReorderCells"; }
+};
+
+/**
+ * Support function for the Ordering Enum
+ * @param os
+ * @param v
+ * @return
+ */
+std::ostream& operator<<(std::ostream& os, const ReorderCells::Ordering& v);
+
+/**
+ * Support function for the Ordering Enum
+ * @param is
+ * @param v
+ * @return
+ */
+std::istream& operator>>(std::istream& is, ReorderCells::Ordering& v);
+
+}  // namespace ablate::domain::modifiers
+#endif  // ABLATELIBRARY_REORDERCELLS_HPP
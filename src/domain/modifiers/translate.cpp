@@ -18,5 +18,13 @@ PetscErrorCode ablate::domain::modifiers::Translate::TranslateFunction(PetscInt
     PetscFunctionReturn(0);
 }
 
+void ablate::domain::modifiers::Translate::MapCoordinates(PetscInt dim, PetscInt numberPoints, PetscScalar *coordinates) const {
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        for (PetscInt d = 0; d < dim; d++) {
+            coordinates[p * dim + d] += translate[d];
+        }
+    }
+}
+
 #include "registrar.hpp"
 REGISTER_PASS_THROUGH(ablate::domain::modifiers::Modifier, ablate::domain::modifiers::Translate, "Translate the x,y,z coordinate of the domain mesh by the values.", std::vector<double>);
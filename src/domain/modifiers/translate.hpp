@@ -23,6 +23,12 @@ class Translate : public MeshMapper {
      */
     std::string ToString() const override;
 
+   protected:
+    /**
+     * Translate every point in the batch
+     */
+    void MapCoordinates(PetscInt dim, PetscInt numberPoints, PetscScalar* coordinates) const override;
+
    private:
     static PetscErrorCode TranslateFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
 };
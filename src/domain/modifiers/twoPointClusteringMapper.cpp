@@ -28,28 +28,33 @@ PetscErrorCode ablate::domain::modifiers::TwoPointClusteringMapper::MappingFunct
     for (PetscInt d = 0; d < dim; d++) {
         u[d] = x[d];
     }
+    map->MapCoordinates(dim, 1, u);
+    PetscFunctionReturn(0);
+}
 
-    // Find the size of the reduced domain
-    PetscReal xScalar = x[map->direction] - map->location;
-
-    // Determine if left or right clustering
-    PetscReal sizeTmp;
-    if (u[map->direction] > map->location) {
-        sizeTmp = 2.0 * PetscAbsReal(map->start + map->size - map->location);
-    } else {
-        sizeTmp = 2.0 * PetscAbsReal(map->start - map->location);
+void ablate::domain::modifiers::TwoPointClusteringMapper::MapCoordinates(PetscInt dim, PetscInt numberPoints, PetscScalar *coordinates) const {
+    // the size of the reduced domain and clustering constants for the right (0) and left (1) of the location
+    PetscReal sizeTmp[2] = {2.0 * PetscAbsReal(start + size - location), 2.0 * PetscAbsReal(start - location)};
+    PetscReal A[2], inverseSinhBetaA[2];
+    for (std::size_t s = 0; s < 2; ++s) {
+        PetscReal term1 = 1 + (PetscExpReal(beta) - 1) * offset * 2. / sizeTmp[s];
+        PetscReal term2 = 1 + (PetscExpReal(-beta) - 1) * offset * 2. / sizeTmp[s];
+        A[s] = (1.0 / (2.0 * beta)) * PetscLogReal(term1 / term2);
+        inverseSinhBetaA[s] = 1.0 / PetscSinhReal(beta * A[s]);
     }
 
-    // normalize to -1 -> 1
-    PetscReal xtmp = PetscAbsReal(xScalar / (.5 * sizeTmp)) * PetscSignReal(xScalar);
-    PetscReal term1 = 1 + (PetscExpReal(map->beta) - 1) * map->offset * 2. / sizeTmp;   // size[dir];
-    PetscReal term2 = 1 + (PetscExpReal(-map->beta) - 1) * map->offset * 2. / sizeTmp;  // size[dir];
-    PetscReal A = (1.0 / (2.0 * map->beta)) * PetscLogReal(term1 / term2);
-    u[map->direction] = (2 * map->offset) * (1 + PetscSinhReal(map->beta * (PetscAbsReal(xtmp) - A)) / PetscSinhReal(map->beta * A)) * xtmp / (PetscAbsReal(xtmp) + ablate::utilities::Constants::tiny);
-    u[map->direction] /= 2.;
-    u[map->direction] += map->location;
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        PetscScalar &u = coordinates[p * dim + direction];
 
-    PetscFunctionReturn(0);
+        // Determine if left or right clustering
+        const std::size_t s = u > location ? 0 : 1;
+        const PetscReal xScalar = u - location;
+
+        // normalize to -1 -> 1
+        const PetscReal xtmp = PetscAbsReal(xScalar / (.5 * sizeTmp[s])) * PetscSignReal(xScalar);
+        u = offset * (1 + PetscSinhReal(beta * (PetscAbsReal(xtmp) - A[s])) * inverseSinhBetaA[s]) * xtmp / (PetscAbsReal(xtmp) + ablate::utilities::Constants::tiny);
+        u += location;
+    }
 }
 
 #include "registrar.hpp"
@@ -42,6 +42,12 @@ class TwoPointClusteringMapper : public MeshMapper {
      */
     std::string ToString() const override;
 
+   protected:
+    /**
+     * Apply the clustering to the direction component of every point, the constants are computed once per batch
+     */
+    void MapCoordinates(PetscInt dim, PetscInt numberPoints, PetscScalar* coordinates) const override;
+
    private:
     static PetscErrorCode MappingFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
 };
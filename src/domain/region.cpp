@@ -56,6 +56,66 @@ bool ablate::domain::Region::InRegion(const std::shared_ptr<Region>& region, DM
     return ptValue == region->value;
 }
 
+ablate::domain::RegionMask ablate::domain::Region::GetMask(const std::shared_ptr<Region>& region, DM dm) {
+    if (!region) {
+        return {};
+    }
+    DMLabel label = nullptr;
+    DMGetLabel(dm, region->name.c_str(), &label) >> checkError;
+    return GetMask(label, dm, region->value);
+}
+
+ablate::domain::RegionMask ablate::domain::Region::GetMask(DMLabel label, DM dm, PetscInt value) {
+    PetscInt pStart, pEnd;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> checkError;
+    RegionMask mask(pStart, pEnd);
+    if (!label) {
+        return mask;
+    }
+
+    if (value != PETSC_DETERMINE) {
+        IS pointIs;
+        DMLabelGetStratumIS(label, value, &pointIs) >> checkError;
+        mask.Add(pointIs);
+        ISDestroy(&pointIs) >> checkError;
+        return mask;
+    }
+
+    // add each stratum in the label
+    IS valueIs;
+    DMLabelGetValueIS(label, &valueIs) >> checkError;
+    PetscInt numberValues;
+    const PetscInt* values;
+    ISGetLocalSize(valueIs, &numberValues) >> checkError;
+    ISGetIndices(valueIs, &values) >> checkError;
+    for (PetscInt v = 0; v < numberValues; ++v) {
+        IS pointIs;
+        DMLabelGetStratumIS(label, values[v], &pointIs) >> checkError;
+        mask.Add(pointIs);
+        ISDestroy(&pointIs) >> checkError;
+    }
+    ISRestoreIndices(valueIs, &values) >> checkError;
+    ISDestroy(&valueIs) >> checkError;
+    return mask;
+}
+
+void ablate::domain::RegionMask::Add(IS pointIs) {
+    if (!pointIs || entireDomain) {
+        return;
+    }
+    PetscInt numberPoints;
+    const PetscInt* points;
+    ISGetLocalSize(pointIs, &numberPoints) >> checkError;
+    ISGetIndices(pointIs, &points) >> checkError;
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        const auto index = points[p] - pStart;
+        if (index >= 0 && index < (PetscInt)members.size()) {
+            members[index] = true;
+        }
+    }
+    ISRestoreIndices(pointIs, &points) >> checkError;
+}
+
 std::ostream& ablate::domain::operator<<(std::ostream& os, const ablate::domain::Region& region) {
     os << region.ToString();
     return os;
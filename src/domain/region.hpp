@@ -7,6 +7,46 @@
 #include <vector>
 namespace ablate::domain {
 
+/**
+ * A dense membership mask over the local chart so hot loops can test if a point is in a region (or labeled) without a label lookup.  The default mask
+ * contains every point (the entire domain).
+ */
+class RegionMask {
+   private:
+    //! the start of the masked range, points outside of [pStart, pStart + members.size()) are not members
+    PetscInt pStart = 0;
+
+    //! the membership flag for each point in the range
+    std::vector<bool> members;
+
+    //! true if every point is a member
+    bool entireDomain = true;
+
+   public:
+    RegionMask() = default;
+
+    /**
+     * Create an empty mask over the point range [pStart, pEnd)
+     */
+    RegionMask(PetscInt pStart, PetscInt pEnd) : pStart(pStart), members(pEnd - pStart, false), entireDomain(false) {}
+
+    /**
+     * Add every point in the is to the mask
+     */
+    void Add(IS pointIs);
+
+    /**
+     * O(1) membership test
+     */
+    [[nodiscard]] inline bool Contains(PetscInt point) const {
+        if (entireDomain) {
+            return true;
+        }
+        const auto index = point - pStart;
+        return index >= 0 && index < (PetscInt)members.size() && members[index];
+    }
+};
+
 class Region {
    public:
     inline const static std::shared_ptr<Region> ENTIREDOMAIN = {};
@@ -40,6 +80,23 @@ class Region {
 
     static bool InRegion(const std::shared_ptr<Region>& region, DM dm, PetscInt point);
 
+    /**
+     * Builds the membership mask of the region over the local chart of the dm.  Use this instead of InRegion when testing many points.
+     * @param region the region, nullptr for the entire domain
+     * @param dm
+     * @return
+     */
+    static RegionMask GetMask(const std::shared_ptr<Region>& region, DM dm);
+
+    /**
+     * Builds the mask of the points with a value in the label over the local chart of the dm
+     * @param label the label, if null no point is a member
+     * @param dm
+     * @param value the label value, PETSC_DETERMINE for a point with any value
+     * @return
+     */
+    static RegionMask GetMask(DMLabel label, DM dm, PetscInt value = PETSC_DETERMINE);
+
     /**
      * throws exception if the label is not in the dm
      * @param region
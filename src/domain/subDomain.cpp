@@ -3,6 +3,7 @@
 #include <sstream>
 #include <utilities/petscError.hpp>
 #include "utilities/mpiError.hpp"
+#include "utilities/petscUtilities.hpp"
 
 ablate::domain::SubDomain::SubDomain(Domain& domainIn, PetscInt dsNumber, const std::vector<std::shared_ptr<FieldDescription>>& allAuxFields)
     : domain(domainIn),
@@ -106,9 +107,35 @@ ablate::domain::SubDomain::SubDomain(Domain& domainIn, PetscInt dsNumber, const
             offset += newAuxField.numberComponents;
         }
     }
+
+    IndexFields();
+}
+
+void ablate::domain::SubDomain::IndexFields() {
+    for (const auto& [location, fields] : fieldsByType) {
+        auto& indices = fieldIndexById[(std::size_t)location];
+        indices.clear();
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            if (fields[i].id >= (PetscInt)indices.size()) {
+                indices.resize(fields[i].id + 1, -1);
+            }
+            indices[fields[i].id] = (PetscInt)i;
+        }
+    }
 }
 
 ablate::domain::SubDomain::~SubDomain() {
+    for (auto& [key, copyIndices] : copyIndicesCache) {
+        VecScatterDestroy(&copyIndices.scatter) >> checkError;
+        VecDestroy(&copyIndices.subLocalVec) >> checkError;
+        VecDestroy(&copyIndices.globalLocalVec) >> checkError;
+    }
+
+    for (auto& [key, isDm] : fieldSubDMCache) {
+        ISDestroy(&isDm.first) >> checkError;
+        DMDestroy(&isDm.second) >> checkError;
+    }
+
     if (auxDM) {
         DMDestroy(&auxDM) >> checkError;
     }
@@ -125,6 +152,10 @@ ablate::domain::SubDomain::~SubDomain() {
         DMDestroy(&subDM) >> checkError;
     }
 
+    for (auto& [key, filteredDm] : filteredDmCache) {
+        DMDestroy(&filteredDm) >> checkError;
+    }
+
     if (subSolutionVec) {
         VecDestroy(&subSolutionVec) >> checkError;
     }
@@ -143,6 +174,8 @@ void ablate::domain::SubDomain::CreateSubDomainStructures() {
         DMCreateDS(auxDM) >> checkError;
         DMCreateLocalVector(auxDM, &(auxLocalVec)) >> checkError;
         DMCreateGlobalVector(auxDM, &(auxGlobalVec)) >> checkError;
+        utilities::PetscUtilities::FirstTouch(auxLocalVec) >> checkError;
+        utilities::PetscUtilities::FirstTouch(auxGlobalVec) >> checkError;
 
         DMGetRegionDS(auxDM, label, nullptr, &auxDiscreteSystem) >> checkError;
 
@@ -187,14 +220,23 @@ void ablate::domain::SubDomain::ProjectFieldFunctionsToSubDM(const std::vector<s
     std::vector<mathFunctions::PetscFunction> fieldFunctions(numberFields, nullptr);
     std::vector<void*> fieldContexts(numberFields, nullptr);
 
+    bool projectRemaining = false;
     for (auto& fieldInitialization : initialization) {
         auto fieldId = GetField(fieldInitialization->GetName());
 
+        // finite volume fields are evaluated as a single batch over every cell
+        if (Domain::ProjectFiniteVolumeFunction(subDM, fieldId.subId, fieldInitialization->GetSolutionField(), nullptr, 0, time, locVec)) {
+            continue;
+        }
+
         fieldContexts[fieldId.subId] = fieldInitialization->GetSolutionField().GetContext();
         fieldFunctions[fieldId.subId] = fieldInitialization->GetSolutionField().GetPetscFunction();
+        projectRemaining = true;
     }
 
-    DMProjectFunctionLocal(subDM, time, &fieldFunctions[0], &fieldContexts[0], INSERT_VALUES, locVec) >> checkError;
+    if (projectRemaining) {
+        DMProjectFunctionLocal(subDM, time, &fieldFunctions[0], &fieldContexts[0], INSERT_VALUES, locVec) >> checkError;
+    }
 
     // push the results back to the global vector
     DMLocalToGlobal(dm, locVec, INSERT_VALUES, globVec) >> checkError;
@@ -220,6 +262,11 @@ DM ablate::domain::SubDomain::GetSubDM() {
         // filter by label
         DMPlexFilter(GetDM(), label, labelValue, &subDM) >> checkError;
 
+        // the filtered dm does not inherit the vec type
+        VecType vecType;
+        DMGetVecType(GetDM(), &vecType) >> checkError;
+        DMSetVecType(subDM, vecType) >> checkError;
+
         // copy over all fields that were in the main dm
         for (auto& fieldInfo : GetFields()) {
             auto petscField = GetPetscFieldObject(fieldInfo);
@@ -346,18 +393,33 @@ Vec ablate::domain::SubDomain::GetSubAuxVector() {
     return subAuxVec;
 }
 
-void ablate::domain::SubDomain::CopyGlobalToSubVector(DM sDM, DM gDM, Vec subVec, Vec globVec, const std::vector<Field>& subFields, const std::vector<Field>& gFields, bool localVector) const {
+ablate::domain::SubDomain::CopyIndices& ablate::domain::SubDomain::GetCopyIndices(DM sDM, DM gDM, Vec subVec, Vec globVec, const std::vector<Field>& subFields,
+                                                                                     const std::vector<Field>& gFields, bool localVector) const {
+    // Determine the fields being copied
+    std::vector<PetscInt> subFieldIds, globFieldIds;
+    for (std::size_t i = 0; i < subFields.size(); i++) {
+        subFieldIds.push_back(subFields[i].id);
+        globFieldIds.push_back(gFields.empty() ? GetField(subFields[i].name).id : gFields[i].id);
+    }
+    PetscObjectId subDMId, gDMId;
+    PetscObjectGetId((PetscObject)sDM, &subDMId) >> checkError;
+    PetscObjectGetId((PetscObject)gDM, &gDMId) >> checkError;
+    auto key = std::make_tuple(subDMId, gDMId, localVector, subFieldIds, globFieldIds);
+    if (auto cached = copyIndicesCache.find(key); cached != copyIndicesCache.end()) {
+        return cached->second;
+    }
+
     /* Get the map from the subVec to global */
     IS subpointIS;
     const PetscInt* subpointIndices = nullptr;
     DMPlexGetSubpointIS(sDM, &subpointIS) >> checkError;
     ISGetIndices(subpointIS, &subpointIndices) >> checkError;
 
-    // Get array access to the vec
+    // Get array access to the vec, the index of each value is determined from its offset in the array
     const PetscScalar* globalVecArray;
-    PetscScalar* subVecArray;
+    const PetscScalar* subVecArray;
     VecGetArrayRead(globVec, &globalVecArray) >> checkError;
-    VecGetArray(subVec, &subVecArray) >> checkError;
+    VecGetArrayRead(subVec, &subVecArray) >> checkError;
 
     // March over the global section
     PetscSection section;
@@ -367,13 +429,11 @@ void ablate::domain::SubDomain::CopyGlobalToSubVector(DM sDM, DM gDM, Vec subVec
     PetscSectionGetChart(section, &pStart, &pEnd) >> checkError;
 
     // For each field in the subDM
-    for (std::size_t i = 0; i < subFields.size(); i++) {
-        const auto& subFieldInfo = subFields[i];
-        const auto& globFieldInfo = gFields.empty() ? GetField(subFieldInfo.name) : gFields[i];
-
+    CopyIndices copyIndices;
+    for (std::size_t i = 0; i < subFieldIds.size(); i++) {
         // Get the size of the data
         PetscInt numberComponents;
-        PetscSectionGetFieldComponents(section, subFieldInfo.id, &numberComponents) >> checkError;
+        PetscSectionGetFieldComponents(section, subFieldIds[i], &numberComponents) >> checkError;
 
         // March over each of the points
         for (PetscInt p = pStart; p < pEnd; p++) {
@@ -381,33 +441,62 @@ void ablate::domain::SubDomain::CopyGlobalToSubVector(DM sDM, DM gDM, Vec subVec
             PetscInt gP = subpointIndices ? subpointIndices[p] : p;
 
             // Hold a ref to the values
-            PetscScalar* subRef = nullptr;
+            const PetscScalar* subRef = nullptr;
             const PetscScalar* ref = nullptr;
 
-            DMPlexPointGlobalFieldRef(sDM, p, subFieldInfo.id, subVecArray, &subRef) >> checkError;
+            DMPlexPointGlobalFieldRead(sDM, p, subFieldIds[i], subVecArray, &subRef) >> checkError;
             if (localVector) {
-                DMPlexPointLocalFieldRead(gDM, gP, globFieldInfo.id, globalVecArray, &ref) >> checkError;
+                DMPlexPointLocalFieldRead(gDM, gP, globFieldIds[i], globalVecArray, &ref) >> checkError;
             } else {
-                DMPlexPointGlobalFieldRead(gDM, gP, globFieldInfo.id, globalVecArray, &ref) >> checkError;
+                DMPlexPointGlobalFieldRead(gDM, gP, globFieldIds[i], globalVecArray, &ref) >> checkError;
             }
 
             if (subRef && ref) {
-                // Copy the point
-                PetscArraycpy(subRef, ref, numberComponents) >> checkError;
+                for (PetscInt c = 0; c < numberComponents; c++) {
+                    copyIndices.subIndices.push_back((PetscInt)(subRef - subVecArray) + c);
+                    copyIndices.globalIndices.push_back((PetscInt)(ref - globalVecArray) + c);
+                }
             }
         }
     }
     VecRestoreArrayRead(globVec, &globalVecArray) >> checkError;
-    VecRestoreArray(subVec, &subVecArray) >> checkError;
+    VecRestoreArrayRead(subVec, &subVecArray) >> checkError;
     ISRestoreIndices(subpointIS, &subpointIndices) >> checkError;
+
+    return copyIndicesCache[key] = std::move(copyIndices);
+}
+
+void ablate::domain::SubDomain::CopyGlobalToSubVector(DM sDM, DM gDM, Vec subVec, Vec globVec, const std::vector<Field>& subFields, const std::vector<Field>& gFields, bool localVector) const {
+    auto& copyIndices = GetCopyIndices(sDM, gDM, subVec, globVec, subFields, gFields, localVector);
+    if (!utilities::PetscUtilities::IsHostVec(subVec) || !utilities::PetscUtilities::IsHostVec(globVec)) {
+        ScatterCopyIndices(copyIndices, subVec, globVec, SCATTER_FORWARD);
+        return;
+    }
+
+    // Get array access to the vec
+    const PetscScalar* globalVecArray;
+    PetscScalar* subVecArray;
+    VecGetArrayRead(globVec, &globalVecArray) >> checkError;
+    VecGetArray(subVec, &subVecArray) >> checkError;
+
+    // Copy each value
+    const std::size_t numberValues = copyIndices.subIndices.size();
+    const PetscInt* subIndices = copyIndices.subIndices.data();
+    const PetscInt* globalIndices = copyIndices.globalIndices.data();
+    for (std::size_t i = 0; i < numberValues; i++) {
+        subVecArray[subIndices[i]] = globalVecArray[globalIndices[i]];
+    }
+
+    VecRestoreArrayRead(globVec, &globalVecArray) >> checkError;
+    VecRestoreArray(subVec, &subVecArray) >> checkError;
 }
 
 void ablate::domain::SubDomain::CopySubVectorToGlobal(DM sDM, DM gDM, Vec subVec, Vec globVec, const std::vector<Field>& subFields, const std::vector<Field>& gFields, bool localVector) const {
-    /* Get the map from the subVec to global */
-    IS subpointIS;
-    const PetscInt* subpointIndices = nullptr;
-    DMPlexGetSubpointIS(sDM, &subpointIS) >> checkError;
-    ISGetIndices(subpointIS, &subpointIndices) >> checkError;
+    auto& copyIndices = GetCopyIndices(sDM, gDM, subVec, globVec, subFields, gFields, localVector);
+    if (!utilities::PetscUtilities::IsHostVec(subVec) || !utilities::PetscUtilities::IsHostVec(globVec)) {
+        ScatterCopyIndices(copyIndices, subVec, globVec, SCATTER_REVERSE);
+        return;
+    }
 
     // Get array access to the vec
     PetscScalar* globalVecArray;
@@ -415,47 +504,46 @@ void ablate::domain::SubDomain::CopySubVectorToGlobal(DM sDM, DM gDM, Vec subVec
     VecGetArray(globVec, &globalVecArray) >> checkError;
     VecGetArrayRead(subVec, &subVecArray) >> checkError;
 
-    // March over the global section
-    PetscSection section;
-    DMGetGlobalSection(sDM, &section) >> checkError;
-
-    PetscInt pStart, pEnd;
-    PetscSectionGetChart(section, &pStart, &pEnd) >> checkError;
-
-    // For each field in the subDM
-    for (std::size_t i = 0; i < subFields.size(); i++) {
-        const auto& subFieldInfo = subFields[i];
-        const auto& globFieldInfo = gFields.empty() ? GetField(subFieldInfo.name) : gFields[i];
-
-        // Get the size of the data
-        PetscInt numberComponents;
-        PetscSectionGetFieldComponents(section, subFieldInfo.id, &numberComponents) >> checkError;
-
-        // March over each of the points
-        for (PetscInt p = pStart; p < pEnd; p++) {
-            // Get the global cell number
-            PetscInt gP = subpointIndices ? subpointIndices[p] : p;
+    // Copy each value
+    const std::size_t numberValues = copyIndices.subIndices.size();
+    const PetscInt* subIndices = copyIndices.subIndices.data();
+    const PetscInt* globalIndices = copyIndices.globalIndices.data();
+    for (std::size_t i = 0; i < numberValues; i++) {
+        globalVecArray[globalIndices[i]] = subVecArray[subIndices[i]];
+    }
 
-            // Hold a ref to the values
-            const PetscScalar* subRef = nullptr;
-            PetscScalar* ref = nullptr;
+    VecRestoreArray(globVec, &globalVecArray) >> checkError;
+    VecRestoreArrayRead(subVec, &subVecArray) >> checkError;
+}
 
-            DMPlexPointGlobalFieldRead(sDM, p, subFieldInfo.id, subVecArray, &subRef) >> checkError;
-            if (localVector) {
-                DMPlexPointLocalFieldRef(gDM, gP, globFieldInfo.id, globalVecArray, &ref) >> checkError;
-            } else {
-                DMPlexPointGlobalFieldRef(gDM, gP, globFieldInfo.id, globalVecArray, &ref) >> checkError;
-            }
+void ablate::domain::SubDomain::ScatterCopyIndices(CopyIndices& copyIndices, Vec subVec, Vec globVec, ScatterMode mode) const {
+    // the copy indices never cross ranks, so the scatter is between the local parts of the vecs
+    if (!copyIndices.scatter) {
+        VecCreateLocalVector(subVec, &copyIndices.subLocalVec) >> checkError;
+        VecCreateLocalVector(globVec, &copyIndices.globalLocalVec) >> checkError;
+        IS subIS, globalIS;
+        ISCreateGeneral(PETSC_COMM_SELF, (PetscInt)copyIndices.subIndices.size(), copyIndices.subIndices.data(), PETSC_USE_POINTER, &subIS) >> checkError;
+        ISCreateGeneral(PETSC_COMM_SELF, (PetscInt)copyIndices.globalIndices.size(), copyIndices.globalIndices.data(), PETSC_USE_POINTER, &globalIS) >> checkError;
+        VecScatterCreate(copyIndices.globalLocalVec, globalIS, copyIndices.subLocalVec, subIS, &copyIndices.scatter) >> checkError;
+        ISDestroy(&subIS) >> checkError;
+        ISDestroy(&globalIS) >> checkError;
+    }
 
-            if (subRef && ref) {
-                // Copy the point
-                PetscArraycpy(ref, subRef, numberComponents) >> checkError;
-            }
-        }
+    if (mode == SCATTER_FORWARD) {
+        VecGetLocalVectorRead(globVec, copyIndices.globalLocalVec) >> checkError;
+        VecGetLocalVector(subVec, copyIndices.subLocalVec) >> checkError;
+        VecScatterBegin(copyIndices.scatter, copyIndices.globalLocalVec, copyIndices.subLocalVec, INSERT_VALUES, SCATTER_FORWARD) >> checkError;
+        VecScatterEnd(copyIndices.scatter, copyIndices.globalLocalVec, copyIndices.subLocalVec, INSERT_VALUES, SCATTER_FORWARD) >> checkError;
+        VecRestoreLocalVectorRead(globVec, copyIndices.globalLocalVec) >> checkError;
+        VecRestoreLocalVector(subVec, copyIndices.subLocalVec) >> checkError;
+    } else {
+        VecGetLocalVector(globVec, copyIndices.globalLocalVec) >> checkError;
+        VecGetLocalVectorRead(subVec, copyIndices.subLocalVec) >> checkError;
+        VecScatterBegin(copyIndices.scatter, copyIndices.subLocalVec, copyIndices.globalLocalVec, INSERT_VALUES, SCATTER_REVERSE) >> checkError;
+        VecScatterEnd(copyIndices.scatter, copyIndices.subLocalVec, copyIndices.globalLocalVec, INSERT_VALUES, SCATTER_REVERSE) >> checkError;
+        VecRestoreLocalVector(globVec, copyIndices.globalLocalVec) >> checkError;
+        VecRestoreLocalVectorRead(subVec, copyIndices.subLocalVec) >> checkError;
     }
-    VecRestoreArray(globVec, &globalVecArray) >> checkError;
-    VecRestoreArrayRead(subVec, &subVecArray) >> checkError;
-    ISRestoreIndices(subpointIS, &subpointIndices) >> checkError;
 }
 
 bool ablate::domain::SubDomain::InRegion(const domain::Region& region) const {
@@ -519,14 +607,37 @@ PetscObject ablate::domain::SubDomain::GetPetscFieldObject(const ablate::domain:
     }
 }
 
-PetscErrorCode ablate::domain::SubDomain::GetFieldGlobalVector(const Field& field, IS* vecIs, Vec* vec, DM* subdm) {
+PetscErrorCode ablate::domain::SubDomain::GetFieldSubDM(const Field& field, IS* vecIs, DM* subdm) {
     PetscFunctionBeginUser;
-    // Get the correct dm
     auto entireDm = GetFieldDM(field);
+    PetscObjectId dmId;
+    PetscCall(PetscObjectGetId((PetscObject)entireDm, &dmId));
+
+    // The sub dm only depends upon the field layout so it is created once and shared
+    auto key = std::make_pair(dmId, field.id);
+    auto cached = fieldSubDMCache.find(key);
+    if (cached == fieldSubDMCache.end()) {
+        IS newIs;
+        DM newDm;
+        PetscCall(DMCreateSubDM(entireDm, 1, &field.id, &newIs, &newDm));
+        cached = fieldSubDMCache.emplace(key, std::make_pair(newIs, newDm)).first;
+    }
+
+    // Add a reference for the caller, so the restore calls only release it
+    PetscCall(PetscObjectReference((PetscObject)cached->second.first));
+    PetscCall(PetscObjectReference((PetscObject)cached->second.second));
+    *vecIs = cached->second.first;
+    *subdm = cached->second.second;
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::domain::SubDomain::GetFieldGlobalVector(const Field& field, IS* vecIs, Vec* vec, DM* subdm) {
+    PetscFunctionBeginUser;
+    // Get the correct vec
     auto entireVec = GetGlobalVec(field);
 
     PetscErrorCode ierr;
-    ierr = DMCreateSubDM(entireDm, 1, &field.id, vecIs, subdm);
+    ierr = GetFieldSubDM(field, vecIs, subdm);
     CHKERRQ(ierr);
 
     // Get the sub vector
@@ -553,12 +664,10 @@ PetscErrorCode ablate::domain::SubDomain::GetFieldLocalVector(const ablate::doma
     PetscFunctionBeginUser;
     PetscErrorCode ierr;
     if (field.location == FieldLocation::SOL) {
-        // Get the correct dm
-        auto entireDm = GetDM();
         auto entireVec = GetSolutionVector();
 
-        // Create a subDM
-        ierr = DMCreateSubDM(entireDm, 1, &field.id, vecIs, subdm);
+        // Get the cached subDM
+        ierr = GetFieldSubDM(field, vecIs, subdm);
         CHKERRQ(ierr);
 
         // Use a global vector to get the results
@@ -583,10 +692,9 @@ PetscErrorCode ablate::domain::SubDomain::GetFieldLocalVector(const ablate::doma
         *vecIs = nullptr;
         CHKERRQ(ierr);
     } else if (field.location == FieldLocation::AUX) {
-        auto entireDm = GetAuxDM();
         auto entireVec = GetAuxVector();
 
-        ierr = DMCreateSubDM(entireDm, 1, &field.id, vecIs, subdm);
+        ierr = GetFieldSubDM(field, vecIs, subdm);
         CHKERRQ(ierr);
 
         // Get the sub vector
@@ -622,6 +730,60 @@ PetscErrorCode ablate::domain::SubDomain::RestoreFieldLocalVector(const ablate::
     PetscFunctionReturn(0);
 }
 
+ablate::domain::FieldView ablate::domain::SubDomain::GetFieldView(const Field& field, Vec localVec) {
+    auto dm = GetFieldDM(field);
+    if (!localVec) {
+        if (field.location != FieldLocation::AUX) {
+            throw std::invalid_argument("A local vector is required to view the solution field " + field.name);
+        }
+        localVec = GetAuxVector();
+    }
+
+    PetscObjectId dmId;
+    PetscObjectGetId((PetscObject)dm, &dmId) >> checkError;
+    auto key = std::make_pair(dmId, field.id);
+    auto cached = fieldViewLayoutCache.find(key);
+    if (cached == fieldViewLayoutCache.end()) {
+        // Check that every cell has the same layout, so the field can be described by a single offset and stride
+        PetscSection section;
+        DMGetLocalSection(dm, &section) >> checkError;
+        FieldView layout;
+        DMPlexGetHeightStratum(dm, 0, &layout.cStart, &layout.cEnd) >> checkError;
+        layout.components = field.numberComponents;
+        PetscInt firstOffset = 0;
+        for (PetscInt c = layout.cStart; c < layout.cEnd; ++c) {
+            PetscInt dof, offset, fieldDof, fieldOffset;
+            PetscSectionGetDof(section, c, &dof) >> checkError;
+            PetscSectionGetOffset(section, c, &offset) >> checkError;
+            PetscSectionGetFieldDof(section, c, field.id, &fieldDof) >> checkError;
+            PetscSectionGetFieldOffset(section, c, field.id, &fieldOffset) >> checkError;
+            if (c == layout.cStart) {
+                firstOffset = offset;
+                layout.stride = dof;
+                layout.offset = fieldOffset;
+            }
+            if (fieldDof != field.numberComponents || dof != layout.stride || offset != firstOffset + (c - layout.cStart) * layout.stride ||
+                fieldOffset != layout.offset + (c - layout.cStart) * layout.stride) {
+                throw std::invalid_argument("The field " + field.name + " does not have a uniform cell layout and cannot be viewed");
+            }
+        }
+        cached = fieldViewLayoutCache.emplace(key, layout).first;
+    }
+
+    FieldView view = cached->second;
+    VecGetArrayRead(localVec, &view.vecArray) >> checkError;
+    view.values = view.vecArray + view.offset;
+    return view;
+}
+
+void ablate::domain::SubDomain::RestoreFieldView(const Field& field, FieldView& view, Vec localVec) {
+    if (!localVec) {
+        localVec = GetAuxVector();
+    }
+    VecRestoreArrayRead(localVec, &view.vecArray) >> checkError;
+    view.values = nullptr;
+}
+
 void ablate::domain::SubDomain::SetsExactSolutions(const std::vector<std::shared_ptr<mathFunctions::FieldFunction>>& exactSolutionsIn) {
     // if an exact solution has been provided register it
     for (const auto& exactSolution : exactSolutionsIn) {
@@ -645,13 +807,27 @@ void ablate::domain::SubDomain::SetsExactSolutions(const std::vector<std::shared
 }
 void ablate::domain::SubDomain::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    auto locSubDm = GetSubDM();
-    auto locAuxDM = GetSubAuxDM();
     // If this is the first output, save the mesh
     if (sequenceNumber == 0) {
         // Print the initial mesh
-        DMView(locSubDm, viewer) >> checkError;
+        SaveMesh(viewer);
     }
+    SaveFields(viewer, sequenceNumber, time);
+    PetscFunctionReturnVoid();
+}
+
+PetscObjectId ablate::domain::SubDomain::GetMeshId() {
+    PetscObjectId id;
+    PetscObjectGetId((PetscObject)GetSubDM(), &id) >> checkError;
+    return id;
+}
+
+void ablate::domain::SubDomain::SaveMesh(PetscViewer viewer) { DMView(GetSubDM(), viewer) >> checkError; }
+
+void ablate::domain::SubDomain::SaveFields(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
+    PetscFunctionBeginUser;
+    auto locSubDm = GetSubDM();
+    auto locAuxDM = GetSubAuxDM();
 
     // set the dm sequence number, because we may be skipping outputs
     DMSetOutputSequenceNumber(locSubDm, sequenceNumber, time) >> checkError;
@@ -663,9 +839,8 @@ void ablate::domain::SubDomain::Save(PetscViewer viewer, PetscInt sequenceNumber
     VecView(GetSubSolutionVector(), viewer) >> checkError;
 
     // If there is aux data output
-    PetscBool outputAuxVector = PETSC_TRUE;
-    PetscOptionsGetBool(nullptr, nullptr, "-outputAuxVector", &outputAuxVector, nullptr) >> checkError;
-    if (outputAuxVector) {
+    auto outputAuxFields = GetOutputAuxFields();
+    if (!outputAuxFields.empty()) {
         if (auto subAuxVector = GetSubAuxVector()) {
             // copy over the sequence data from the main dm
             PetscReal dmTime;
@@ -673,7 +848,7 @@ void ablate::domain::SubDomain::Save(PetscViewer viewer, PetscInt sequenceNumber
             DMGetOutputSequenceNumber(locSubDm, &dmSequence, &dmTime) >> checkError;
             DMSetOutputSequenceNumber(locAuxDM, dmSequence, dmTime) >> checkError;
 
-            VecView(subAuxVector, viewer) >> checkError;
+            ViewAuxFields(subAuxVector, outputAuxFields, viewer);
         }
     }
 
@@ -690,6 +865,92 @@ void ablate::domain::SubDomain::Save(PetscViewer viewer, PetscInt sequenceNumber
     }
     PetscFunctionReturnVoid();
 }
+
+std::vector<ablate::domain::Field> ablate::domain::SubDomain::GetOutputAuxFields() {
+    PetscBool outputAuxVector = PETSC_TRUE;
+    PetscOptionsGetBool(nullptr, nullptr, "-outputAuxVector", &outputAuxVector, nullptr) >> checkError;
+    if (!outputAuxVector) {
+        return {};
+    }
+    PetscBool outputDerivedAuxFields = PETSC_TRUE;
+    PetscOptionsGetBool(nullptr, nullptr, "-outputDerivedAuxFields", &outputDerivedAuxFields, nullptr) >> checkError;
+
+    // read the optional include/exclude lists of field names
+    const auto& auxFields = GetFields(FieldLocation::AUX);
+    auto getFieldNames = [&auxFields](const char* name, std::set<std::string>& fieldNames) {
+        std::vector<char*> values(auxFields.size() + 1, nullptr);
+        auto numberValues = (PetscInt)values.size();
+        PetscBool set = PETSC_FALSE;
+        PetscOptionsGetStringArray(nullptr, nullptr, name, values.data(), &numberValues, &set) >> checkError;
+        for (PetscInt v = 0; v < numberValues; v++) {
+            fieldNames.insert(values[v]);
+            PetscFree(values[v]) >> checkError;
+        }
+        return (bool)set;
+    };
+    std::set<std::string> includeFields;
+    std::set<std::string> excludeFields;
+    const bool includeSet = getFieldNames("-outputAuxFields", includeFields);
+    getFieldNames("-excludeAuxFields", excludeFields);
+
+    std::vector<Field> outputAuxFields;
+    for (const auto& field : auxFields) {
+        if (includeSet) {
+            // an explicit include list overrides the derived tag
+            if (!includeFields.count(field.name)) {
+                continue;
+            }
+        } else if (!outputDerivedAuxFields && field.Tagged(Field::DERIVED_TAG)) {
+            continue;
+        }
+        if (excludeFields.count(field.name)) {
+            continue;
+        }
+        outputAuxFields.push_back(field);
+    }
+    return outputAuxFields;
+}
+
+void ablate::domain::SubDomain::ViewAuxFields(Vec subAuxVector, const std::vector<Field>& outputAuxFields, PetscViewer viewer) {
+    // if every field is output, view the entire vector
+    if (outputAuxFields.size() == GetFields(FieldLocation::AUX).size()) {
+        VecView(subAuxVector, viewer) >> checkError;
+        return;
+    }
+
+    // create a dm with only the output fields
+    DM auxDm;
+    VecGetDM(subAuxVector, &auxDm) >> checkError;
+    std::vector<PetscInt> fieldIds;
+    for (const auto& field : outputAuxFields) {
+        fieldIds.push_back(field.id);
+    }
+    IS outputIs;
+    DM outputDm;
+    DMCreateSubDM(auxDm, (PetscInt)fieldIds.size(), fieldIds.data(), &outputIs, &outputDm) >> checkError;
+
+    // copy over the values, keeping the same name so the output layout is unchanged
+    Vec outputVec, auxSubVec;
+    DMGetGlobalVector(outputDm, &outputVec) >> checkError;
+    VecGetSubVector(subAuxVector, outputIs, &auxSubVec) >> checkError;
+    VecCopy(auxSubVec, outputVec) >> checkError;
+    VecRestoreSubVector(subAuxVector, outputIs, &auxSubVec) >> checkError;
+    const char* vecName;
+    PetscObjectGetName((PetscObject)subAuxVector, &vecName) >> checkError;
+    PetscObjectSetName((PetscObject)outputVec, vecName) >> checkError;
+
+    // copy over the sequence data from the aux dm
+    PetscReal dmTime;
+    PetscInt dmSequence;
+    DMGetOutputSequenceNumber(auxDm, &dmSequence, &dmTime) >> checkError;
+    DMSetOutputSequenceNumber(outputDm, dmSequence, dmTime) >> checkError;
+    VecView(outputVec, viewer) >> checkError;
+
+    DMRestoreGlobalVector(outputDm, &outputVec) >> checkError;
+    ISDestroy(&outputIs) >> checkError;
+    DMDestroy(&outputDm) >> checkError;
+}
+
 void ablate::domain::SubDomain::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     // The only item that needs to be explicitly restored is the flowField
     DMSetOutputSequenceNumber(GetDM(), sequenceNumber, time) >> checkError;
@@ -732,6 +993,11 @@ void ablate::domain::SubDomain::ProjectFieldFunctionsToLocalVector(const std::ve
             }
         }
 
+        // finite volume fields are evaluated as a single batch over every cell
+        if (Domain::ProjectFiniteVolumeFunction(dm, fieldId.id, fieldFunction->GetSolutionField(), fieldLabel, fieldValue, time, locVec)) {
+            continue;
+        }
+
         // Note the global DMProjectFunctionLabel can't be used because it overwrites unwritten values.
         // Project this field
         if (fieldLabel) {
@@ -754,7 +1020,18 @@ void ablate::domain::SubDomain::CreateEmptySubDM(DM* inDM, std::shared_ptr<domai
         subDmValue = labelValue;
     }
     if (subDmLabel) {
-        DMPlexFilter(GetDM(), subDmLabel, subDmValue, inDM);
+        PetscObjectId labelId;
+        PetscObjectGetId((PetscObject)subDmLabel, &labelId) >> checkError;
+        auto& filteredDm = filteredDmCache[std::make_pair(labelId, subDmValue)];
+        if (!filteredDm) {
+            DMPlexFilter(GetDM(), subDmLabel, subDmValue, &filteredDm) >> checkError;
+
+            // the filtered dm does not inherit the vec type
+            VecType vecType;
+            DMGetVecType(GetDM(), &vecType) >> checkError;
+            DMSetVecType(filteredDm, vecType) >> checkError;
+        }
+        DMClone(filteredDm, inDM) >> checkError;
     } else {
         DMClone(GetDM(), inDM);
     }
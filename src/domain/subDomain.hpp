@@ -2,13 +2,17 @@
 #define ABLATELIBRARY_SUBDOMAIN_HPP
 #include <petsc.h>
 #include <algorithm>
+#include <array>
 #include <map>
 #include <mathFunctions/fieldFunction.hpp>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utilities/petscError.hpp>
+#include <vector>
 #include "domain.hpp"
 #include "fieldDescription.hpp"
+#include "fieldView.hpp"
 #include "io/serializable.hpp"
 
 namespace ablate::domain {
@@ -39,6 +43,14 @@ class SubDomain : public io::Serializable {
     //! also keep the fields by type for faster iteration
     std::map<FieldLocation, std::vector<Field>> fieldsByType;
 
+    //! the index into fieldsByType for each field id (the global id for sol fields and the aux id for aux fields), -1 if the field is not in this subDomain
+    std::array<std::vector<PetscInt>, 2> fieldIndexById;
+
+    /**
+     * Build the id to index lookup for every field once the fields are known
+     */
+    void IndexFields();
+
     //! Each subDomain will operate over a ds
     PetscDS discreteSystem;
     PetscDS auxDiscreteSystem{};
@@ -61,6 +73,69 @@ class SubDomain : public io::Serializable {
     //! store any exact solutions for io
     std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions;
 
+    /**
+     * Determine the aux fields to output.  The aux vector is never restored, so only the solution is needed to restart.  The aux output can be reduced with the
+     * -outputAuxVector, -outputAuxFields, -excludeAuxFields, and -outputDerivedAuxFields options.
+     * @return the aux fields to output
+     */
+    std::vector<Field> GetOutputAuxFields();
+
+    /**
+     * View the output aux fields from the sub aux vector, only creating a reduced vector when a subset of the fields is output
+     * @param subAuxVector
+     * @param outputAuxFields
+     * @param viewer
+     */
+    void ViewAuxFields(Vec subAuxVector, const std::vector<Field>& outputAuxFields, PetscViewer viewer);
+
+    /**
+     * The flattened indices copied between a sub vec and global vec, each index is a single scalar in the vec array
+     */
+    struct CopyIndices {
+        std::vector<PetscInt> subIndices;
+        std::vector<PetscInt> globalIndices;
+
+        //! the scatter between the local parts of device resident vecs and the local vecs it was created with, created on first use
+        VecScatter scatter = nullptr;
+        Vec subLocalVec = nullptr;
+        Vec globalLocalVec = nullptr;
+    };
+
+    //! the copy indices for each (subDM, gDM, localVector, sub field ids, global field ids), the dm ids are used to avoid reusing a destroyed dm address
+    mutable std::map<std::tuple<PetscObjectId, PetscObjectId, bool, std::vector<PetscInt>, std::vector<PetscInt>>, CopyIndices> copyIndicesCache;
+
+    //! the filtered topology for each (label, value) used by CreateEmptySubDM, every empty sub dm is a clone sharing this topology and subpoint map
+    std::map<std::pair<PetscObjectId, PetscInt>, DM> filteredDmCache;
+
+    /**
+     * Get (computing on the first call) the indices used to copy between the sub vec and global vec.  The indices do not depend upon the direction.
+     */
+    CopyIndices& GetCopyIndices(DM subDM, DM gDM, Vec subVec, Vec globVec, const std::vector<Field>& subFields, const std::vector<Field>& gFields, bool localVector) const;
+
+    /**
+     * Copy between device resident vecs with a scatter built from the copy indices so the values do not pass through the host
+     * @param copyIndices
+     * @param subVec
+     * @param globVec
+     * @param mode SCATTER_FORWARD copies from the global to the sub vec, SCATTER_REVERSE from the sub to the global vec
+     */
+    void ScatterCopyIndices(CopyIndices& copyIndices, Vec subVec, Vec globVec, ScatterMode mode) const;
+
+    //! the single field index set and sub dm for each (dm id, field id), created on first use and shared by every Get/RestoreField*Vector call
+    std::map<std::pair<PetscObjectId, PetscInt>, std::pair<IS, DM>> fieldSubDMCache;
+
+    //! the cell layout of each (dm id, field id) used to build a FieldView
+    std::map<std::pair<PetscObjectId, PetscInt>, FieldView> fieldViewLayoutCache;
+
+    /**
+     * Get (creating on the first call) the index set and sub dm for a single field.  A reference is added to each so the caller may destroy them.
+     * @param field
+     * @param vecIs
+     * @param subdm
+     * @return
+     */
+    PetscErrorCode GetFieldSubDM(const Field& field, IS* vecIs, DM* subdm);
+
     /**
      * support call to copy from global to sub vec
      * @param subDM
@@ -114,14 +189,32 @@ class SubDomain : public io::Serializable {
      * @return
      */
     [[nodiscard]] inline const Field& GetField(PetscInt id, FieldLocation location = FieldLocation::SOL) const {
-        auto field = std::find_if(fieldsByName.begin(), fieldsByName.end(), [location, id](auto pair) { return pair.second.location == location && pair.second.id == id; });
-        if (field != fieldsByName.end()) {
-            return field->second;
+        const auto& indices = fieldIndexById[(std::size_t)location];
+        if (id >= 0 && id < (PetscInt)indices.size() && indices[id] >= 0) {
+            return fieldsByType.at(location)[indices[id]];
         } else {
             throw std::invalid_argument("Cannot locate field with id " + std::to_string(id) + " in subDomain " + name);
         }
     }
 
+    /**
+     * returns a stable handle to the field (sol/aux) for a given field name.  This should be resolved once during setup and used with GetField(FieldHandle)
+     * in per step code.
+     * @param fieldName the string name of the field
+     * @return the handle, throws if the field is not in the subDomain
+     */
+    [[nodiscard]] inline FieldHandle GetFieldHandle(const std::string& fieldName) const {
+        const auto& field = GetField(fieldName);
+        return FieldHandle{.location = field.location, .index = fieldIndexById[(std::size_t)field.location][field.id]};
+    }
+
+    /**
+     * returns a references to the field for a resolved handle without a search
+     * @param handle
+     * @return
+     */
+    [[nodiscard]] inline const Field& GetField(const FieldHandle& handle) const { return fieldsByType.at(handle.location)[handle.index]; }
+
     /**
      * returns all fields of a certain type
      * @param type (defaults to SOL)
@@ -372,6 +465,23 @@ class SubDomain : public io::Serializable {
      */
     PetscErrorCode RestoreFieldLocalVector(const Field&, IS* vecIs, Vec* vec, DM* subdm);
 
+    /**
+     * Get a read only, zero copy view of a single field over the cells of a local vector.  The cell layout of the local section must be uniform (a constant number
+     * of dofs per cell), as it is for finite volume fields, otherwise an exception is thrown.
+     * @param field
+     * @param localVec the local vector to view, defaults to the aux local vector for aux fields
+     * @return
+     */
+    FieldView GetFieldView(const Field& field, Vec localVec = nullptr);
+
+    /**
+     * Restore the field view
+     * @param field
+     * @param view
+     * @param localVec the same local vector used to get the view
+     */
+    void RestoreFieldView(const Field& field, FieldView& view, Vec localVec = nullptr);
+
     /**
      * Serialization save
      * @param viewer
@@ -380,6 +490,26 @@ class SubDomain : public io::Serializable {
      */
     void Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
 
+    /**
+     * The id of the sub dm, which changes if the mesh is changed
+     * @return
+     */
+    PetscObjectId GetMeshId() override;
+
+    /**
+     * Save only the sub dm
+     * @param viewer
+     */
+    void SaveMesh(PetscViewer viewer) override;
+
+    /**
+     * Save the solution, aux, and exact fields without the sub dm
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    void SaveFields(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
     /**
      * Serialization restore
      * @param viewer
@@ -390,6 +520,8 @@ class SubDomain : public io::Serializable {
 
     /**
      * This checks for whether the label describing the subdomain exists. If it does, use DMPlexFilter. If not, use DMClone to return new DM.
+     * The filtered topology is computed once for each label/value and each returned dm is a clone sharing it, so monitors over the same region
+     * (and monitors rebuilt when restoring) do not repeat the filter.
      * @param inDM
      */
     void CreateEmptySubDM(DM* inDM, std::shared_ptr<domain::Region> region = {});
@@ -1,36 +1,136 @@
 #include "download.hpp"
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdlib>
+#include <thread>
 #include <utility>
 #include "environment/runEnvironment.hpp"
 #include "utilities/mpiError.hpp"
 #include "utilities/petscError.hpp"
+#include "utilities/stringUtilities.hpp"
 #include "utilities/temporaryWorkingDirectory.hpp"
 
 ablate::environment::Download::Download(std::string url) : url(std::move(url)) {}
 
+std::filesystem::path ablate::environment::Download::GetCacheDirectory() {
+    if (const char* cacheDirectory = std::getenv("ABLATE_DOWNLOAD_CACHE")) {
+        return cacheDirectory;
+    }
+    return std::filesystem::temp_directory_path() / "ablateDownloadCache";
+}
+
+std::filesystem::path ablate::environment::Download::GetCachePath(const std::string& url) {
+    // keep the file name from the url so consumers that check the extension are not affected
+    auto fileName = std::filesystem::path(url.substr(0, url.find_first_of("?#"))).filename();
+    if (fileName.empty()) {
+        fileName = "download";
+    }
+    return GetCacheDirectory() / utilities::StringUtilities::Hash(url) / fileName;
+}
+
+void ablate::environment::Download::FillCache(const std::filesystem::path& cachePath) const {
+    const auto cacheDirectory = cachePath.parent_path();
+    std::filesystem::create_directories(cacheDirectory);
+    const auto lockPath = cacheDirectory / ".lock";
+
+    while (!std::filesystem::exists(cachePath)) {
+        // the lock file is created exclusively so only a single process downloads the url
+        int lockFile = open(lockPath.c_str(), O_CREAT | O_EXCL | O_WRONLY, 0644);
+        if (lockFile < 0) {
+            if (errno != EEXIST) {
+                throw std::runtime_error("unable to create the download cache lock " + lockPath.string());
+            }
+
+            // remove the lock if the process holding it appears to have failed
+            std::error_code errorCode;
+            auto lockTime = std::filesystem::last_write_time(lockPath, errorCode);
+            if (!errorCode && std::filesystem::file_time_type::clock::now() - lockTime > lockTimeout) {
+                std::filesystem::remove(lockPath, errorCode);
+            }
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+            continue;
+        }
+        close(lockFile);
+
+        // download into a uniquely named directory and move into place so other processes never see a partial file.  The pid alone is not unique
+        // across hosts sharing the cache, so mkdtemp picks the name.
+        std::string downloadDirectoryTemplate = (cacheDirectory / "download.XXXXXX").string();
+        if (!mkdtemp(downloadDirectoryTemplate.data())) {
+            std::error_code errorCode;
+            std::filesystem::remove(lockPath, errorCode);
+            throw std::runtime_error("unable to create a download directory in " + cacheDirectory.string());
+        }
+        const std::filesystem::path downloadDirectory = downloadDirectoryTemplate;
+        std::string error;
+        try {
+            if (!std::filesystem::exists(cachePath)) {
+                ablate::utilities::TemporaryWorkingDirectory temporaryWorkingDirectory(downloadDirectory);
+
+                char localPath[PETSC_MAX_PATH_LEN];
+                PetscBool found;
+                PetscFileRetrieve(PETSC_COMM_SELF, url.c_str(), localPath, PETSC_MAX_PATH_LEN, &found) >> checkError;
+                if (!found) {
+                    throw std::runtime_error("unable to locate file at " + url);
+                }
+
+                const auto partialPath = downloadDirectory / (cachePath.filename().string() + ".partial");
+                std::filesystem::copy_file(downloadDirectory / localPath, partialPath, std::filesystem::copy_options::overwrite_existing);
+                std::filesystem::rename(partialPath, cachePath);
+            }
+        } catch (std::exception& exception) {
+            error = exception.what();
+        }
+
+        std::error_code errorCode;
+        std::filesystem::remove_all(downloadDirectory, errorCode);
+        std::filesystem::remove(lockPath, errorCode);
+        if (!error.empty()) {
+            throw std::runtime_error(error);
+        }
+    }
+}
+
 std::filesystem::path ablate::environment::Download::Locate(const std::vector<std::filesystem::path>& searchPaths) {
-    // determine where to download the file
+    if (!IsUrl(url)) {
+        throw std::invalid_argument("Unknown url scheme " + url);
+    }
+
+    // determine where to relocate the file
     auto downloadDirectory =
         ablate::environment::RunEnvironment::Get().GetOutputDirectory().empty() ? std::filesystem::current_path() : ablate::environment::RunEnvironment::Get().GetOutputDirectory();
+    const auto cachePath = GetCachePath(url);
+    const auto localPath = downloadDirectory / cachePath.filename();
 
-    // Store the current working directory
-    ablate::utilities::TemporaryWorkingDirectory temporaryWorkingDirectory(downloadDirectory);
-
-    // check to see if the file specified is really a url
-    for (const auto& prefix : urlPrefixes) {
-        if (url.rfind(prefix, 0) == 0) {
-            char localPath[PETSC_MAX_PATH_LEN];
-            PetscBool found;
-            PetscFileRetrieve(PETSC_COMM_WORLD, url.c_str(), localPath, PETSC_MAX_PATH_LEN, &found) >> checkError;
-            if (!found) {
-                throw std::runtime_error("unable to locate file at" + url);
-            }
+    // only the first rank on each node fills the cache and copies the file, any error is shared with every rank on the node
+    PetscMPIInt rank, nodeRank;
+    MPI_Comm nodeComm;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> checkMpiError;
+    MPI_Comm_split_type(PETSC_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm) >> checkMpiError;
+    MPI_Comm_rank(nodeComm, &nodeRank) >> checkMpiError;
+
+    std::string error;
+    if (nodeRank == 0) {
+        try {
+            FillCache(cachePath);
 
-            // If we should relocate the file
-            return downloadDirectory / localPath;
+            // copy through a rank specific name so nodes sharing the output directory do not collide
+            const auto partialPath = downloadDirectory / (cachePath.filename().string() + "." + std::to_string(rank) + ".partial");
+            std::filesystem::copy_file(cachePath, partialPath, std::filesystem::copy_options::overwrite_existing);
+            std::filesystem::rename(partialPath, localPath);
+        } catch (std::exception& exception) {
+            error = exception.what();
         }
     }
-    throw std::invalid_argument("Unknown url scheme " + url);
+    int failed = !error.empty();
+    MPI_Allreduce(MPI_IN_PLACE, &failed, 1, MPI_INT, MPI_MAX, PETSC_COMM_WORLD) >> checkMpiError;
+    MPI_Comm_free(&nodeComm) >> checkMpiError;
+    if (failed) {
+        throw std::runtime_error(error.empty() ? "unable to locate file at " + url : error);
+    }
+    return localPath;
 }
 
 #include "registrar.hpp"
-REGISTER_PASS_THROUGH(cppParser::PathLocator, ablate::environment::Download, "Downloads and relocates file at given url", std::string);
+REGISTER_PASS_THROUGH(cppParser::PathLocator, ablate::environment::Download, "Downloads and relocates file at given url, downloads are cached in $ABLATE_DOWNLOAD_CACHE",
+                      std::string);
@@ -3,6 +3,8 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
+#include <filesystem>
 #include "pathLocator.hpp"
 
 namespace ablate::environment {
@@ -18,6 +20,18 @@ class Download : public cppParser::PathLocator {
      */
     constexpr static std::array<std::string_view, 4> urlPrefixes = {"https://", "http://", "file://", "ftp://"};
 
+    /**
+     * how long to wait for another process holding the cache lock before assuming that it failed
+     */
+    constexpr static std::chrono::seconds lockTimeout = std::chrono::minutes(10);
+
+    /**
+     * Download the url into the cache if it is not already there.  The download is guarded by a lock file so only a single process (across ranks, nodes,
+     * and runs sharing the cache) downloads each url.
+     * @param cachePath
+     */
+    void FillCache(const std::filesystem::path& cachePath) const;
+
    public:
     /**
      * downloads the specified file.  Relocates if temporaryFile if false
@@ -27,12 +41,26 @@ class Download : public cppParser::PathLocator {
     explicit Download(std::string url);
 
     /**
-     * Downloads and relocates the file
+     * Copies the file from the download cache to the output directory, the file is only downloaded if it is not already cached
      * @param searchPaths
      * @return
      */
     std::filesystem::path Locate(const std::vector<std::filesystem::path>& searchPaths = {}) override;
 
+    /**
+     * The shared download cache directory, $ABLATE_DOWNLOAD_CACHE if set or ablateDownloadCache in the system temporary directory
+     * @return
+     */
+    static std::filesystem::path GetCacheDirectory();
+
+    /**
+     * The location of a url in the download cache.  Each url is stored in a directory named by the hash of the full url so files with the same name from
+     * different urls do not collide.
+     * @param url
+     * @return
+     */
+    static std::filesystem::path GetCachePath(const std::string& url);
+
     /**
      * simple helper function to determine if the provided string is a url
      * @return
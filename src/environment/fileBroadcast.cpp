@@ -0,0 +1,145 @@
+#include "fileBroadcast.hpp"
+#include <unistd.h>
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include "environment/runEnvironment.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+bool ablate::environment::FileBroadcast::Enabled() {
+    int mpiInitialized;
+    MPI_Initialized(&mpiInitialized) >> checkMpiError;
+    if (!mpiInitialized) {
+        return false;
+    }
+    PetscBool broadcastFiles = PETSC_FALSE;
+    PetscOptionsGetBool(nullptr, nullptr, "--broadcastFiles", &broadcastFiles, nullptr) >> checkError;
+    return broadcastFiles;
+}
+
+void ablate::environment::FileBroadcast::BroadcastString(std::string& value, MPI_Comm comm) {
+    unsigned long long size = value.size();
+    MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG_LONG, 0, comm) >> checkMpiError;
+    value.resize(size);
+
+    // the mpi count is limited to an int so large files are sent in chunks
+    for (unsigned long long offset = 0; offset < size; offset += INT_MAX) {
+        const auto count = (int)std::min<unsigned long long>(INT_MAX, size - offset);
+        MPI_Bcast(value.data() + offset, count, MPI_CHAR, 0, comm) >> checkMpiError;
+    }
+}
+
+std::vector<ablate::environment::FileBroadcast::File> ablate::environment::FileBroadcast::BroadcastFiles(const std::filesystem::path& path, MPI_Comm comm) {
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    // read every file on the root rank, an error is shared with every rank so they can all throw
+    std::vector<File> files;
+    std::string error;
+    if (rank == 0) {
+        auto readFile = [](const std::filesystem::path& filePath) {
+            std::ifstream stream(filePath, std::ios::binary);
+            std::stringstream contents;
+            contents << stream.rdbuf();
+            return contents.str();
+        };
+        if (std::filesystem::is_directory(path)) {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(path)) {
+                if (entry.is_regular_file()) {
+                    files.push_back(File{.relativePath = std::filesystem::relative(entry.path(), path).string(), .contents = readFile(entry.path())});
+                }
+            }
+        } else if (std::filesystem::exists(path)) {
+            files.push_back(File{.relativePath = {}, .contents = readFile(path)});
+        } else {
+            error = "unable to locate file " + path.string();
+        }
+    }
+    BroadcastString(error, comm);
+    if (!error.empty()) {
+        throw std::invalid_argument(error);
+    }
+
+    unsigned long long numberFiles = files.size();
+    MPI_Bcast(&numberFiles, 1, MPI_UNSIGNED_LONG_LONG, 0, comm) >> checkMpiError;
+    files.resize(numberFiles);
+    for (auto& file : files) {
+        BroadcastString(file.relativePath, comm);
+        BroadcastString(file.contents, comm);
+    }
+    return files;
+}
+
+std::filesystem::path ablate::environment::FileBroadcast::GetScratchDirectory() {
+    if (const char* localScratch = std::getenv("ABLATE_LOCAL_SCRATCH")) {
+        return localScratch;
+    }
+    return std::filesystem::temp_directory_path();
+}
+
+std::string ablate::environment::FileBroadcast::ReadContents(const std::filesystem::path& path, MPI_Comm comm) {
+    if (!Enabled()) {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream) {
+            throw std::invalid_argument("unable to locate file " + path.string());
+        }
+        std::stringstream contents;
+        contents << stream.rdbuf();
+        return contents.str();
+    }
+
+    auto files = BroadcastFiles(path, comm);
+    if (files.size() != 1 || !files.front().relativePath.empty()) {
+        throw std::invalid_argument("ablate::environment::FileBroadcast::ReadContents requires a single file, not " + path.string());
+    }
+    return std::move(files.front().contents);
+}
+
+std::filesystem::path ablate::environment::FileBroadcast::Localize(const std::filesystem::path& path, MPI_Comm comm) {
+    if (!Enabled()) {
+        return path;
+    }
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    auto files = BroadcastFiles(path, comm);
+
+    // the root pid is shared so every node uses the same scratch directory name for this run
+    long rootPid = (long)getpid();
+    MPI_Bcast(&rootPid, 1, MPI_LONG, 0, comm) >> checkMpiError;
+    const auto localDirectory = GetScratchDirectory() / ("ablate." + std::to_string(rootPid)) / std::to_string(localizedCount++);
+    const auto localPath = localDirectory / path.filename();
+
+    // only the first rank on each node writes the copy
+    MPI_Comm nodeComm;
+    PetscMPIInt nodeRank;
+    MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm) >> checkMpiError;
+    MPI_Comm_rank(nodeComm, &nodeRank) >> checkMpiError;
+    if (nodeRank == 0) {
+        for (const auto& file : files) {
+            const auto filePath = file.relativePath.empty() ? localPath : localPath / file.relativePath;
+            std::filesystem::create_directories(filePath.parent_path());
+            std::ofstream stream(filePath, std::ios::binary);
+            stream.write(file.contents.data(), (std::streamsize)file.contents.size());
+        }
+
+        // remove the copies when the run is finished
+        if (scratchDirectories.empty()) {
+            RunEnvironment::RegisterCleanUpFunction("ablate::environment::FileBroadcast::Localize", []() {
+                for (const auto& directory : scratchDirectories) {
+                    std::error_code errorCode;
+                    std::filesystem::remove_all(directory, errorCode);
+                }
+            });
+        }
+        scratchDirectories.push_back(localDirectory);
+    }
+    MPI_Barrier(nodeComm) >> checkMpiError;
+    MPI_Comm_free(&nodeComm) >> checkMpiError;
+
+    // the root rank already read the original file
+    return rank == 0 ? path : localPath;
+}
@@ -0,0 +1,71 @@
+#ifndef ABLATELIBRARY_FILEBROADCAST_HPP
+#define ABLATELIBRARY_FILEBROADCAST_HPP
+
+#include <petsc.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace ablate::environment {
+/**
+ * Reads input and resource files (mechanisms, tables, ChemTab models, cad files) on the root rank and broadcasts the contents so only a single rank
+ * touches the shared file system during startup.  Consumers that can parse from memory use ReadContents, consumers that require a path (i.e. TChem) use
+ * Localize to get a copy written once per node to node local scratch.  The broadcast is enabled with the --broadcastFiles command line option, otherwise
+ * every rank reads the original file.
+ */
+class FileBroadcast {
+   private:
+    //! a single broadcast file, the relative path is empty for a single file
+    struct File {
+        std::string relativePath;
+        std::string contents;
+    };
+
+    //! the node local scratch directories created by this rank, removed at finalize
+    inline static std::vector<std::filesystem::path> scratchDirectories;
+
+    //! the number of files/directories localized so far, used to give each a unique scratch directory
+    inline static std::size_t localizedCount = 0;
+
+    /**
+     * Broadcast a string from the root rank in chunks so files larger than the mpi count limit can be sent
+     */
+    static void BroadcastString(std::string& value, MPI_Comm comm);
+
+    /**
+     * Read the file or every file under a directory on the root rank and broadcast them to every rank
+     */
+    static std::vector<File> BroadcastFiles(const std::filesystem::path& path, MPI_Comm comm);
+
+    /**
+     * @return the node local scratch directory ($ABLATE_LOCAL_SCRATCH or the system temporary directory)
+     */
+    static std::filesystem::path GetScratchDirectory();
+
+   public:
+    /**
+     * @return true if the --broadcastFiles option was set and mpi is initialized
+     */
+    static bool Enabled();
+
+    /**
+     * Read the contents of a file.  When enabled the file is only read on the root rank and broadcast.
+     * @param path
+     * @param comm the comm to broadcast over, must be called by every rank in the comm
+     * @return the file contents
+     */
+    static std::string ReadContents(const std::filesystem::path& path, MPI_Comm comm = PETSC_COMM_WORLD);
+
+    /**
+     * Returns a path to the file or directory that this rank can read.  When enabled the root rank reads the file (or every file in the directory) and
+     * the first rank on each node writes a copy to node local scratch, every other rank returns the path to that copy.  The file name is preserved so
+     * consumers that check the extension are not affected.
+     * @param path
+     * @param comm the comm to broadcast over, must be called by every rank in the comm
+     * @return the path to read on this rank
+     */
+    static std::filesystem::path Localize(const std::filesystem::path& path, MPI_Comm comm = PETSC_COMM_WORLD);
+};
+}  // namespace ablate::environment
+
+#endif  // ABLATELIBRARY_FILEBROADCAST_HPP
@@ -1,13 +1,24 @@
 #include "runEnvironment.hpp"
 #include <mpi.h>
+#include <petsc.h>
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <regex>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
 #include "version.h"
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
-ablate::environment::RunEnvironment::RunEnvironment() : outputDirectory(), title("") {}
+ablate::environment::RunEnvironment::RunEnvironment() : outputDirectory(), title(""), inputPath() {}
 
-ablate::environment::RunEnvironment::RunEnvironment(const parameters::Parameters& parameters, std::filesystem::path inputPath) : title(parameters.GetExpect<std::string>("title")) {
+ablate::environment::RunEnvironment::RunEnvironment(const parameters::Parameters& parameters, std::filesystem::path inputPath) : title(parameters.GetExpect<std::string>("title")), inputPath(inputPath) {
     // check to see if the output directory is set
     auto specifiedOutputDirectory = parameters.Get<std::filesystem::path>("directory");
     outputDirectory = specifiedOutputDirectory.value_or((inputPath.empty() ? std::filesystem::current_path() : inputPath.parent_path()) / title);
@@ -80,6 +91,123 @@ void ablate::environment::RunEnvironment::Finalize() {
     }
 }
 
+std::optional<std::string> ablate::environment::RunEnvironment::GetCommandLineOption(const std::string& name) {
+    if (!GlobalArgc || !GlobalArgs) {
+        return {};
+    }
+    for (int a = 1; a < *GlobalArgc; ++a) {
+        if (name == (*GlobalArgs)[a]) {
+            // an option without a value (or followed by another option) is returned as empty
+            if (a + 1 < *GlobalArgc && (*GlobalArgs)[a + 1][0] != '-') {
+                return std::string((*GlobalArgs)[a + 1]);
+            }
+            return std::string();
+        }
+    }
+    return {};
+}
+
+const ablate::environment::RunEnvironment::ThreadConfiguration& ablate::environment::RunEnvironment::ConfigureThreads() {
+    if (threadConfiguration) {
+        return *threadConfiguration;
+    }
+    threadConfiguration = std::make_unique<ThreadConfiguration>();
+
+    // the options are read from the command line because the environment must be set before petsc is initialized
+    const auto threadsPerRankOption = GetCommandLineOption("--threadsPerRank");
+    if (!threadsPerRankOption) {
+        return *threadConfiguration;
+    }
+    int threadsPerRank = threadsPerRankOption->empty() ? 0 : std::stoi(*threadsPerRankOption);
+    const auto bindThreadsOption = GetCommandLineOption("--bindThreads");
+    const bool bindThreads = bindThreadsOption && (bindThreadsOption->empty() || *bindThreadsOption == "1" || *bindThreadsOption == "true" || *bindThreadsOption == "yes");
+
+    // mpi is needed to find this rank's position on the node, petsc uses the existing mpi when it is initialized
+    int mpiInitialized = 0;
+    MPI_Initialized(&mpiInitialized) >> checkMpiError;
+    if (!mpiInitialized) {
+        int provided;
+#if defined(PETSC_HAVE_THREADSAFETY)
+        MPI_Init_thread(GlobalArgc, GlobalArgs, MPI_THREAD_MULTIPLE, &provided) >> checkMpiError;
+#else
+        MPI_Init_thread(GlobalArgc, GlobalArgs, MPI_THREAD_FUNNELED, &provided) >> checkMpiError;
+#endif
+        // petsc does not finalize mpi that it did not initialize, this is registered first so it runs after PetscFinalize
+        RegisterCleanUpFunction("ablate::environment::RunEnvironment::ConfigureThreads", []() { MPI_Finalize(); });
+    }
+
+    // determine this rank's position on the node
+    PetscMPIInt nodeRank = 0, nodeSize = 1;
+    MPI_Comm nodeComm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm) >> checkMpiError;
+    MPI_Comm_rank(nodeComm, &nodeRank) >> checkMpiError;
+    MPI_Comm_size(nodeComm, &nodeSize) >> checkMpiError;
+
+    // the cores this rank may run on, which are not always contiguous (e.g. when the scheduler reserves cores)
+    std::vector<int> cores;
+#if defined(__linux__)
+    cpu_set_t rankCpuSet, nodeCpuSet;
+    CPU_ZERO(&rankCpuSet);
+    if (sched_getaffinity(0, sizeof(rankCpuSet), &rankCpuSet) != 0) {
+        throw std::runtime_error("Unable to get the cores available to rank " + std::to_string(nodeRank));
+    }
+
+    // if the launcher already gave each rank its own cores they are used as is, otherwise the cores shared by the node are split between the ranks
+    MPI_Allreduce(&rankCpuSet, &nodeCpuSet, (int)sizeof(cpu_set_t), MPI_BYTE, MPI_BOR, nodeComm) >> checkMpiError;
+    int sharedCores = CPU_EQUAL(&rankCpuSet, &nodeCpuSet);
+    MPI_Allreduce(MPI_IN_PLACE, &sharedCores, 1, MPI_INT, MPI_MIN, nodeComm) >> checkMpiError;
+    for (int c = 0; c < CPU_SETSIZE; ++c) {
+        if (CPU_ISSET(c, &rankCpuSet)) {
+            cores.push_back(c);
+        }
+    }
+#else
+    const int sharedCores = 1;
+    for (int c = 0; c < (int)std::thread::hardware_concurrency(); ++c) {
+        cores.push_back(c);
+    }
+#endif
+    MPI_Comm_free(&nodeComm) >> checkMpiError;
+    if (cores.empty()) {
+        cores.push_back(0);
+    }
+    const int numberCores = (int)cores.size();
+    const int coreRanks = sharedCores ? nodeSize : 1;
+    const int coreRank = sharedCores ? nodeRank : 0;
+
+    // split the cores between the ranks sharing them
+    if (threadsPerRank <= 0) {
+        threadsPerRank = std::max(numberCores / coreRanks, 1);
+    }
+    threadConfiguration->threadsPerRank = threadsPerRank;
+
+    // the shared Kokkos pool is the only pool that should use the cores, so the OpenMP and BLAS pools that read the environment are limited
+    const auto threads = std::to_string(threadsPerRank);
+    setenv("OMP_NUM_THREADS", threads.c_str(), 1);
+    setenv("OPENBLAS_NUM_THREADS", "1", 1);
+    setenv("MKL_NUM_THREADS", "1", 1);
+    setenv("BLIS_NUM_THREADS", "1", 1);
+
+    // restrict this rank (and every thread it starts) to its own block of the available cores
+    if (bindThreads) {
+        const int firstIndex = (coreRank * threadsPerRank) % numberCores;
+        threadConfiguration->firstCore = cores[firstIndex];
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (int t = 0; t < threadsPerRank; ++t) {
+            CPU_SET(cores[(firstIndex + t) % numberCores], &cpuSet);
+        }
+        if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+            throw std::runtime_error("Unable to bind rank " + std::to_string(nodeRank) + " to its cores");
+        }
+        setenv("OMP_PROC_BIND", "close", 1);
+        setenv("OMP_PLACES", "cores", 1);
+#endif
+    }
+    return *threadConfiguration;
+}
+
 void ablate::environment::RunEnvironment::Setup() { environment::RunEnvironment::runEnvironment = std::unique_ptr<environment::RunEnvironment>(new environment::RunEnvironment()); }
 
 void ablate::environment::RunEnvironment::ExpandVariables(std::string& value) const { value = std::regex_replace(value, OutputDirectoryVariable, GetOutputDirectory().string()); }
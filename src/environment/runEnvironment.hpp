@@ -3,6 +3,7 @@
 #include <filesystem>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include "parameters/parameters.hpp"
@@ -28,6 +29,9 @@ class RunEnvironment {
     //! the title of the simulation
     const std::string title;
 
+    //! the input file used to set up the run environment, if any
+    const std::filesystem::path inputPath;
+
     // default empty funEnvironment
     explicit RunEnvironment();
 
@@ -47,6 +51,28 @@ class RunEnvironment {
      */
     inline static std::vector<FinalizeFunction> finalizeFunctions;
 
+   public:
+    /**
+     * The threads available to this rank, shared by Kokkos (and the TChem team policies and ParallelForChunks loops that run on it)
+     */
+    struct ThreadConfiguration {
+        //! the number of threads in the shared pool, zero if not configured
+        int threadsPerRank = 0;
+        //! the first core on the node used by this rank, -1 if not bound
+        int firstCore = -1;
+    };
+
+   private:
+    //! the thread configuration, computed once
+    inline static std::unique_ptr<ThreadConfiguration> threadConfiguration;
+
+    /**
+     * Find an option in the command line arguments before petsc has parsed them
+     * @param name
+     * @return the value following the option (empty if there is none), or nullopt if the option was not provided
+     */
+    static std::optional<std::string> GetCommandLineOption(const std::string& name);
+
    public:
     explicit RunEnvironment(const parameters::Parameters&, std::filesystem::path inputPath = {});
     ~RunEnvironment() = default;
@@ -69,6 +95,8 @@ class RunEnvironment {
 
     inline const std::filesystem::path& GetOutputDirectory() const { return outputDirectory; }
 
+    inline const std::filesystem::path& GetInputPath() const { return inputPath; }
+
     /**
      * replaces any known runtime variables with known values
      *  supported values:
@@ -94,6 +122,16 @@ class RunEnvironment {
      */
     static void Finalize();
 
+    /**
+     * Partition the cores on each node between the ranks so hybrid mpi+threads runs do not oversubscribe the node.  Set with the --threadsPerRank
+     * command line option (zero divides the cores on the node evenly between its ranks) and --bindThreads to bind each rank to its cores.  Competing
+     * OpenMP/BLAS pools are limited so only the shared Kokkos pool uses the rank's cores.  The cores are taken from the affinity mask of each rank.
+     * Must be called by every rank before PetscInitialize so the limits are in the environment when petsc reads them.  If the threads are configured
+     * and mpi is not yet initialized, it is initialized here.
+     * @return the thread configuration
+     */
+    static const ThreadConfiguration& ConfigureThreads();
+
     static inline int* GetArgCount() { return GlobalArgc; }
 
     static inline char*** GetArgs() { return GlobalArgs; }
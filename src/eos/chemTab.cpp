@@ -5,16 +5,19 @@
 #include <fstream>
 #include <iostream>
 #include <string>
+#include "environment/fileBroadcast.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 
 #ifdef WITH_TENSORFLOW
-
-void NoOpDeallocator(void *data, size_t a, void *b) {}
+#include <petscblaslapack.h>
 
 ablate::eos::ChemTab::ChemTab(std::filesystem::path path) : ChemistryModel("ablate::chemistry::ChemTab") {
     const char *tags = "serve";  // default model serving tag; can change in future
     int ntags = 1;
 
+    // when broadcasting files only the root rank reads the model directory from the shared file system
+    path = environment::FileBroadcast::Localize(path);
+
     // check to make sure the file
     if (!exists(path)) {
         throw std::runtime_error("Cannot locate ChemTab Folder " + path.string());
@@ -53,26 +56,25 @@ ablate::eos::ChemTab::ChemTab(std::filesystem::path path) : ChemistryModel("abla
     runOpts = NULL;
     session = TF_LoadSessionFromSavedModel(sessionOpts, runOpts, rpath.c_str(), &tags, ntags, graph, NULL, status);
 
+    // locate the model input and outputs
+    inputOperation = {TF_GraphOperationByName(graph, "serving_default_input_1"), 0};
+    if (inputOperation.oper == NULL) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName serving_default_input_1");
+    outputOperations[0] = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 0};
+    outputOperations[1] = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 1};
+    if (outputOperations[0].oper == NULL) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:0");
+    if (outputOperations[1].oper == NULL) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:1");
+
     std::fstream inputFileStream;
     // load the meta data from the weights.csv file
     inputFileStream.open(wpath.c_str(), std::ios::in);
     ExtractMetaData(inputFileStream);
     inputFileStream.close();
-    // load the basis vectors from the weights.csv and weights_inv.csv files
-    // first allocate memory for both weight matrices
-    Wmat = (PetscReal **)malloc(speciesNames.size() * sizeof(PetscReal *));
-    iWmat = (PetscReal **)malloc(progressVariablesNames.size() * sizeof(PetscReal *));
-    for (std::size_t i = 0; i < speciesNames.size(); i++) {
-        Wmat[i] = (PetscReal *)malloc(progressVariablesNames.size() * sizeof(PetscReal));
-    }
-    for (std::size_t i = 0; i < progressVariablesNames.size(); i++) {
-        iWmat[i] = (PetscReal *)malloc(speciesNames.size() * sizeof(PetscReal));
-    }
+    // load the basis vectors from the weights.csv and weights_inv.csv files into contiguous row major matrices
     inputFileStream.open(wpath.c_str(), std::ios::in);
-    LoadBasisVectors(inputFileStream, progressVariablesNames.size() - 1, Wmat);
+    LoadBasisVectors(inputFileStream, speciesNames.size(), progressVariablesNames.size() - 1, Wmat);
     inputFileStream.close();
     inputFileStream.open(ipath.c_str(), std::ios::in);
-    LoadBasisVectors(inputFileStream, speciesNames.size(), iWmat);
+    LoadBasisVectors(inputFileStream, progressVariablesNames.size() - 1, speciesNames.size(), iWmat);
     inputFileStream.close();
 
     // create a reference equation of state given the mechanism provided in the metedata file
@@ -97,11 +99,6 @@ ablate::eos::ChemTab::~ChemTab() {
     TF_DeleteSessionOptions(sessionOpts);
     TF_DeleteStatus(status);
     free(sourceEnergyScaler);
-    for (std::size_t i = 0; i < speciesNames.size(); i++) free(Wmat[i]);
-    for (std::size_t i = 0; i < progressVariablesNames.size(); i++) free(iWmat[i]);
-
-    free(Wmat);
-    free(iWmat);
 }
 
 // trim from both ends (in place)
@@ -139,21 +136,25 @@ void ablate::eos::ChemTab::ExtractMetaData(std::istream &inputStream) {
     }
 }
 
-void ablate::eos::ChemTab::LoadBasisVectors(std::istream &inputStream, std::size_t cols, double **W) {
+void ablate::eos::ChemTab::LoadBasisVectors(std::istream &inputStream, std::size_t rows, std::size_t cols, std::vector<PetscReal> &W) {
+    W.assign(rows * cols, 0.0);
     std::string line, sName;
     // skip first row
     std::getline(inputStream, line);
     // parse each line after header, first entry in each line is the name of the
     // corresponding species, followed by the values
-    int i = 0;
+    std::size_t i = 0;
     while (std::getline(inputStream, line)) {
+        if (i >= rows) {
+            throw std::invalid_argument("The ChemTab basis vectors file has more than the expected " + std::to_string(rows) + " rows");
+        }
         std::istringstream lineStream(line);
         // skip the first entry
         getline(lineStream, sName, ',');
         for (std::size_t j = 0; j < cols; j++) {
             std::string val;
             getline(lineStream, val, ',');  // delimited by comma
-            W[i][j] = std::stod(val);
+            W[i * cols + j] = std::stod(val);
         }
         i++;
     }
@@ -177,87 +178,83 @@ void ablate::eos::ChemTab::ComputeMassFractions(const PetscReal *progressVariabl
             "The massFractions size does not match the "
             "supported number of species");
     }
-    ComputeMassFractions(speciesNames.size(), progressVariablesNames.size(), iWmat, progressVariables, massFractions, density);
+    ComputeMassFractions(speciesNames.size(), progressVariablesNames.size(), iWmat.data(), progressVariables, massFractions, density);
 }
 
-void ablate::eos::ChemTab::ComputeMassFractions(std::size_t numSpecies, std::size_t numProgressVariables, PetscReal **iWmat, const PetscReal *progressVariables, PetscReal *massFractions,
+void ablate::eos::ChemTab::ComputeMassFractions(std::size_t numSpecies, std::size_t numProgressVariables, const PetscReal *iWmat, const PetscReal *progressVariables, PetscReal *massFractions,
                                                 PetscReal density) {
     for (size_t i = 0; i < numSpecies; i++) {
-        PetscReal v = 0;
-        // j starts from 1 because the first entry in progressVariables is assumed
-        // to be zMix
-        for (size_t j = 1; j < numProgressVariables; j++) {
-            v += iWmat[j - 1][i] * progressVariables[j] / density;
+        massFractions[i] = 0.0;
+    }
+    // j starts from 1 because the first entry in progressVariables is assumed
+    // to be zMix.  March over the rows of iWmat so that the inner loop is contiguous
+    for (size_t j = 1; j < numProgressVariables; j++) {
+        const PetscReal progressVariable = progressVariables[j] / density;
+        const PetscReal *iWmatRow = iWmat + (j - 1) * numSpecies;
+        for (size_t i = 0; i < numSpecies; i++) {
+            massFractions[i] += iWmatRow[i] * progressVariable;
         }
-        massFractions[i] = v;
     }
 }
 
-void ablate::eos::ChemTab::ChemistrySource(PetscReal density, const PetscReal densityProgressVariable[], PetscReal *densityEnergySource, PetscReal *progressVariableSource) const {
-    //********* Get Input tensor
-    int numInputs = 1;
-    TF_Output *input = (TF_Output *)malloc(sizeof(TF_Output) * numInputs);
-    TF_Output t0 = {TF_GraphOperationByName(graph, "serving_default_input_1"), 0};
-
-    if (t0.oper == NULL) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName serving_default_input_1");
-    input[0] = t0;
-    //********* Get Output tensor
-    int numOutputs = 2;
-    TF_Output *output = (TF_Output *)malloc(sizeof(TF_Output) * numOutputs);
-
-    TF_Output t_sourceterms = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 0};
-    TF_Output t_sourceenergy = {TF_GraphOperationByName(graph, "StatefulPartitionedCall"), 1};
-
-    if (t_sourceterms.oper == NULL) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:0");
-    if (t_sourceenergy.oper == NULL) throw std::runtime_error("ERROR: Failed TF_GraphOperationByName StatefulPartitionedCall:1");
-    output[0] = t_sourceterms;
-    output[1] = t_sourceenergy;
-    //********* Allocate data for inputs & outputs
-    TF_Tensor **inputValues = (TF_Tensor **)malloc(sizeof(TF_Tensor *) * numInputs);
-    TF_Tensor **outputValues = (TF_Tensor **)malloc(sizeof(TF_Tensor *) * numOutputs);
-
-    int ndims = 2;
-
-    /*int ninputs = (int)ctModel->progressVariablesNames.size() - 1;
-    int64_t dims[] = {1, ninputs};
-    float data[ninputs];
-    // Ignoring the zmix variable for predicting the source terms
-    for (int i = 0; i < ninputs; i++) {
-        data[i] = progressVariables[i + 1];
-    }*/
+void ablate::eos::ChemTab::ComputeMassFractions(std::size_t numberPoints, const PetscReal *progressVariables, PetscReal *massFractions, const PetscReal density[]) const {
+    if (numberPoints == 0) {
+        return;
+    }
+    // Y = C*inv(W) where the row major matrices are treated as transposed column major matrices, the first (zMix) column of C is skipped
+    const char trans = 'N';
+    const PetscBLASInt m = (PetscBLASInt)speciesNames.size();
+    const PetscBLASInt n = (PetscBLASInt)numberPoints;
+    const PetscBLASInt k = (PetscBLASInt)(progressVariablesNames.size() - 1);
+    const PetscBLASInt ldc = (PetscBLASInt)progressVariablesNames.size();
+    const PetscScalar one = 1.0;
+    const PetscScalar zero = 0.0;
+    BLASgemm_(&trans, &trans, &m, &n, &k, &one, iWmat.data(), &m, progressVariables + 1, &ldc, &zero, massFractions, &m);
+
+    // scale by the density if provided
+    if (density) {
+        for (std::size_t p = 0; p < numberPoints; p++) {
+            const PetscReal densityInverse = 1.0 / density[p];
+            for (std::size_t i = 0; i < speciesNames.size(); i++) {
+                massFractions[p * speciesNames.size() + i] *= densityInverse;
+            }
+        }
+    }
+}
 
-    // according to Varun this should work for including Zmix
-    int ninputs = (int)progressVariablesNames.size();
-    int64_t dims[] = {1, ninputs};
-    float data[ninputs];
+void ablate::eos::ChemTab::RunModel(TF_Tensor *inputTensor, TF_Tensor *outputTensors[2]) const {
+    TF_SessionRun(session, NULL, &inputOperation, &inputTensor, 1, outputOperations, outputTensors, 2, NULL, 0, NULL, status);
+    if (TF_GetCode(status) != TF_OK) throw std::runtime_error(TF_Message(status));
+}
 
-    for (int i = 0; i < ninputs; i++) {
-        data[i] = densityProgressVariable[i] / density;
+void ablate::eos::ChemTab::ChemistrySource(PetscReal density, const PetscReal densityProgressVariable[], PetscReal *densityEnergySource, PetscReal *progressVariableSource) const {
+    // according to Varun this should work for including Zmix
+    const std::size_t ninputs = progressVariablesNames.size();
+    int64_t dims[] = {1, (int64_t)ninputs};
+    TF_Tensor *inputTensor = TF_AllocateTensor(TF_FLOAT, dims, 2, ninputs * sizeof(float));
+    if (inputTensor == NULL) throw std::runtime_error("ERROR: Failed TF_AllocateTensor");
+
+    auto data = (float *)TF_TensorData(inputTensor);
+    for (std::size_t i = 0; i < ninputs; i++) {
+        data[i] = (float)(densityProgressVariable[i] / density);
     }
 
-    int ndata = ninputs * sizeof(float);
-    TF_Tensor *int_tensor = TF_NewTensor(TF_FLOAT, dims, ndims, data, ndata, &NoOpDeallocator, 0);
-    if (int_tensor == NULL) throw std::runtime_error("ERROR: Failed TF_NewTensor");
-
-    inputValues[0] = int_tensor;
+    TF_Tensor *outputTensors[2] = {NULL, NULL};
+    RunModel(inputTensor, outputTensors);
 
-    TF_SessionRun(session, NULL, input, inputValues, numInputs, output, outputValues, numOutputs, NULL, 0, NULL, status);
-    if (TF_GetCode(status) != TF_OK) throw std::runtime_error(TF_Message(status));
     //********** Extract source predictions
-    float *outputArray;
-    outputArray = (float *)TF_TensorData(outputValues[1]);
-    PetscReal p = (PetscReal)outputArray[0];
-    *densityEnergySource += p;
+    auto outputArray = (const float *)TF_TensorData(outputTensors[1]);
+    *densityEnergySource += (PetscReal)outputArray[0];
 
-    outputArray = (float *)TF_TensorData(outputValues[0]);
+    outputArray = (const float *)TF_TensorData(outputTensors[0]);
     for (size_t i = 1; i < progressVariablesNames.size(); i++) {  // skip the first index for zMix, but the progressVariableSource also includes zMix
         progressVariableSource[i] += (PetscReal)outputArray[i - 1];
     }
-    // free allocated vectors
-    free(inputValues);
-    free(outputValues);
-    free(input);
-    free(output);
+
+    // free the tensors
+    TF_DeleteTensor(inputTensor);
+    TF_DeleteTensor(outputTensors[0]);
+    TF_DeleteTensor(outputTensors[1]);
 }
 
 void ablate::eos::ChemTab::ComputeProgressVariables(const PetscReal *massFractions, std::size_t massFractionsSize, PetscReal *progressVariables, std::size_t progressVariablesSize) const {
@@ -276,13 +273,36 @@ void ablate::eos::ChemTab::ComputeProgressVariables(const PetscReal *massFractio
             "supported number of species");
     }
     // the first entry in progressVariables corresponds to zMix and is fixed to 0
-    progressVariables[0] = 0;
-    for (size_t i = 1; i < progressVariablesNames.size(); i++) {
-        PetscReal v = 0;
-        for (size_t j = 0; j < speciesNames.size(); j++) {
-            v += Wmat[j][i - 1] * massFractions[j];
+    const std::size_t numberColumns = progressVariablesNames.size() - 1;
+    for (size_t i = 0; i < progressVariablesNames.size(); i++) {
+        progressVariables[i] = 0;
+    }
+    // March over the rows of Wmat so that the inner loop is contiguous
+    for (size_t j = 0; j < speciesNames.size(); j++) {
+        const PetscReal *wmatRow = Wmat.data() + j * numberColumns;
+        for (size_t i = 0; i < numberColumns; i++) {
+            progressVariables[i + 1] += wmatRow[i] * massFractions[j];
         }
-        progressVariables[i] = v;
+    }
+}
+
+void ablate::eos::ChemTab::ComputeProgressVariables(std::size_t numberPoints, const PetscReal *massFractions, PetscReal *progressVariables) const {
+    if (numberPoints == 0) {
+        return;
+    }
+    // C = Y*W where the row major matrices are treated as transposed column major matrices, the first (zMix) column of C is skipped
+    const char trans = 'N';
+    const PetscBLASInt m = (PetscBLASInt)(progressVariablesNames.size() - 1);
+    const PetscBLASInt n = (PetscBLASInt)numberPoints;
+    const PetscBLASInt k = (PetscBLASInt)speciesNames.size();
+    const PetscBLASInt ldc = (PetscBLASInt)progressVariablesNames.size();
+    const PetscScalar one = 1.0;
+    const PetscScalar zero = 0.0;
+    BLASgemm_(&trans, &trans, &m, &n, &k, &one, Wmat.data(), &m, massFractions, &k, &zero, progressVariables + 1, &ldc);
+
+    // the first entry in progressVariables corresponds to zMix and is fixed to 0
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        progressVariables[p * progressVariablesNames.size()] = 0;
     }
 }
 
@@ -360,7 +380,7 @@ ablate::eos::ThermodynamicFunction ablate::eos::ChemTab::GetThermodynamicFunctio
                                                                                                .progressOffset = (std::size_t)densityProgressField->offset,
                                                                                                .yiScratch = std::vector<PetscReal>(speciesNames.size()),
                                                                                                .tChemFunction = referenceEOS->GetThermodynamicMassFractionFunction(property, fields),
-                                                                                               .iWmat = iWmat})};
+                                                                                               .iWmat = iWmat.data()})};
 }
 
 ablate::eos::FieldFunction ablate::eos::ChemTab::GetFieldFunctionFunction(const std::string &field, eos::ThermodynamicProperty property1, eos::ThermodynamicProperty property2) const {
@@ -408,14 +428,37 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::ChemTab::GetThermodyn
                                                                                         .progressOffset = (std::size_t)densityProgressField->offset,
                                                                                         .yiScratch = std::vector<PetscReal>(speciesNames.size()),
                                                                                         .tChemFunction = referenceEOS->GetThermodynamicTemperatureMassFractionFunction(property, fields),
-                                                                                        .iWmat = iWmat})};
+                                                                                        .iWmat = iWmat.data()})};
 }
 
 ablate::eos::ChemTab::ChemTabSourceCalculator::ChemTabSourceCalculator(PetscInt densityOffset, PetscInt densityEnergyOffset, PetscInt densityProgressVariableOffset,
                                                                        std::shared_ptr<ChemTab> chemTabModel)
     : densityOffset(densityOffset), densityEnergyOffset(densityEnergyOffset), densityProgressVariableOffset(densityProgressVariableOffset), chemTabModel(chemTabModel) {}
 
+ablate::eos::ChemTab::ChemTabSourceCalculator::~ChemTabSourceCalculator() {
+    if (inputTensor) {
+        TF_DeleteTensor(inputTensor);
+    }
+}
+
 void ablate::eos::ChemTab::ChemTabSourceCalculator::AddSource(const ablate::solver::Range &cellRange, Vec locX, Vec locFVec) {
+    const auto numberCells = (std::size_t)(cellRange.end - cellRange.start);
+    if (numberCells == 0) {
+        return;
+    }
+    const std::size_t numberProgressVariables = chemTabModel->progressVariablesNames.size();
+
+    // size up the input tensor for all cells, it is reused while the number of cells is unchanged
+    if (inputTensorSize != numberCells) {
+        if (inputTensor) {
+            TF_DeleteTensor(inputTensor);
+        }
+        int64_t dims[] = {(int64_t)numberCells, (int64_t)numberProgressVariables};
+        inputTensor = TF_AllocateTensor(TF_FLOAT, dims, 2, numberCells * numberProgressVariables * sizeof(float));
+        if (inputTensor == NULL) throw std::runtime_error("ERROR: Failed TF_AllocateTensor");
+        inputTensorSize = numberCells;
+    }
+
     // get access to the xArray, fArray
     PetscScalar *fArray;
     VecGetArray(locFVec, &fArray) >> checkError;
@@ -426,21 +469,46 @@ void ablate::eos::ChemTab::ChemTabSourceCalculator::AddSource(const ablate::solv
     DM dm;
     VecGetDM(locFVec, &dm) >> checkError;
 
-    // March over each cell in the range
+    // pack the progress variables of every cell into the input tensor
+    auto inputData = (float *)TF_TensorData(inputTensor);
     for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
         const PetscInt iCell = cellRange.points ? cellRange.points[c] : c;
 
-        // Get the current state variables for this cell
-        PetscScalar *sourceAtCell = nullptr;
-        DMPlexPointLocalRef(dm, iCell, fArray, &sourceAtCell) >> checkError;
-
         // Get the current state variables for this cell
         const PetscScalar *solutionAtCell = nullptr;
         DMPlexPointLocalRead(dm, iCell, xArray, &solutionAtCell) >> checkError;
 
-        chemTabModel->ChemistrySource(solutionAtCell[densityOffset], solutionAtCell + densityProgressVariableOffset, sourceAtCell + densityEnergyOffset, sourceAtCell + densityProgressVariableOffset);
+        const PetscReal density = solutionAtCell[densityOffset];
+        auto inputAtCell = inputData + (c - cellRange.start) * numberProgressVariables;
+        for (std::size_t p = 0; p < numberProgressVariables; p++) {
+            inputAtCell[p] = (float)(solutionAtCell[densityProgressVariableOffset + p] / density);
+        }
     }
+
+    // run the model once for all cells
+    TF_Tensor *outputTensors[2] = {NULL, NULL};
+    chemTabModel->RunModel(inputTensor, outputTensors);
+    auto sourceTerms = (const float *)TF_TensorData(outputTensors[0]);
+    auto sourceEnergy = (const float *)TF_TensorData(outputTensors[1]);
+
+    // March over each cell in the range and add the source
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt iCell = cellRange.points ? cellRange.points[c] : c;
+        const std::size_t index = c - cellRange.start;
+
+        PetscScalar *sourceAtCell = nullptr;
+        DMPlexPointLocalRef(dm, iCell, fArray, &sourceAtCell) >> checkError;
+
+        sourceAtCell[densityEnergyOffset] += (PetscReal)sourceEnergy[index];
+        // skip the first index for zMix, but the progressVariableSource also includes zMix
+        for (std::size_t p = 1; p < numberProgressVariables; p++) {
+            sourceAtCell[densityProgressVariableOffset + p] += (PetscReal)sourceTerms[index * (numberProgressVariables - 1) + p - 1];
+        }
+    }
+
     // cleanup
+    TF_DeleteTensor(outputTensors[0]);
+    TF_DeleteTensor(outputTensors[1]);
     VecRestoreArray(locFVec, &fArray) >> checkError;
     VecRestoreArrayRead(locX, &xArray) >> checkError;
 }
@@ -25,22 +25,37 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
     TF_SessionOptions* sessionOpts = nullptr;
     TF_Buffer* runOpts = nullptr;
     TF_Session* session = nullptr;
+
+    //! the model input and outputs (source terms, source energy) are located once
+    TF_Output inputOperation{};
+    TF_Output outputOperations[2]{};
+
     std::vector<std::string> speciesNames = std::vector<std::string>(0);
     std::vector<std::string> progressVariablesNames = std::vector<std::string>(0);
 
-    PetscReal** Wmat = nullptr;
-    PetscReal** iWmat = nullptr;
+    //! the basis vectors stored row major (numberSpecies x numberProgressVariables - 1)
+    std::vector<PetscReal> Wmat;
+    //! the inverse basis vectors stored row major (numberProgressVariables - 1 x numberSpecies)
+    std::vector<PetscReal> iWmat;
     PetscReal* sourceEnergyScaler = nullptr;
 
     /**
      * private implementations of support functions
      */
     void ExtractMetaData(std::istream& inputStream);
-    void LoadBasisVectors(std::istream& inputStream, std::size_t columns, PetscReal** W);
+    void LoadBasisVectors(std::istream& inputStream, std::size_t rows, std::size_t columns, std::vector<PetscReal>& W);
+
+    /**
+     * Run the model for every point in the input tensor (numberPoints x numberProgressVariables).  The caller is responsible for deleting the output tensors
+     * (source terms (numberPoints x numberProgressVariables - 1), source energy (numberPoints x 1))
+     * @param inputTensor
+     * @param outputTensors
+     */
+    void RunModel(TF_Tensor* inputTensor, TF_Tensor* outputTensors[2]) const;
 
     /**
-     * The source calculator is used to do batch processing for chemistry model.  This is a bad implementation
-     * that calls each node one at a time.
+     * The source calculator is used to do batch processing for chemistry model.  All cells in the range are packed into a single input tensor that is reused
+     * between calls, so the model is run once per AddSource.
      */
     class ChemTabSourceCalculator : public ChemistryModel::SourceCalculator {
        private:
@@ -51,8 +66,13 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
         //! hold a pointer to the chemTabModel to compute the source terms
         const std::shared_ptr<ChemTab> chemTabModel;
 
+        //! the input tensor for all cells in the range, this is reallocated only if the number of cells changes
+        TF_Tensor* inputTensor = nullptr;
+        std::size_t inputTensorSize = 0;
+
        public:
         ChemTabSourceCalculator(PetscInt densityOffset, PetscInt densityEnergyOffset, PetscInt densityProgressVariableOffset, std::shared_ptr<ChemTab> chemTabModel);
+        ~ChemTabSourceCalculator() override;
         /**
          * There is no need to precompute source for the chemtab model
          */
@@ -81,7 +101,7 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
         ablate::eos::TChem::ThermodynamicMassFractionFunction tChemFunction;
 
         // inverse function/  This does not hold the pointer, but it is held by chemTab;
-        PetscReal** iWmat;
+        const PetscReal* iWmat;
     };
 
     /**
@@ -101,7 +121,7 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
         ablate::eos::TChem::ThermodynamicTemperatureMassFractionFunction tChemFunction;
 
         // inverse function/  This does not hold the pointer, but it is held by chemTab;
-        PetscReal** iWmat;
+        const PetscReal* iWmat;
     };
 
     /**
@@ -130,7 +150,7 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
      * @param progressVariablesSize
      * @param density allows for this function to be used with density*progress variables
      */
-    static void ComputeMassFractions(std::size_t numSpecies, std::size_t numProgressVariables, PetscReal** iWmat, const PetscReal* progressVariables, PetscReal* massFractions,
+    static void ComputeMassFractions(std::size_t numSpecies, std::size_t numProgressVariables, const PetscReal* iWmat, const PetscReal* progressVariables, PetscReal* massFractions,
                                      PetscReal density = 1.0);
 
    public:
@@ -192,6 +212,23 @@ class ChemTab : public ChemistryModel, public std::enable_shared_from_this<ChemT
      */
     void ComputeMassFractions(const PetscReal* progressVariables, std::size_t progressVariablesSize, PetscReal* massFractions, std::size_t massFractionsSize, PetscReal density = 1.0) const;
 
+    /**
+     * batch helper function to compute the progress variables from the mass fractions for numberPoints using a single matrix-matrix product
+     * @param numberPoints
+     * @param massFractions the mass fractions stored point major (numberPoints x numberSpecies)
+     * @param progressVariables the progress variables stored point major (numberPoints x numberProgressVariables)
+     */
+    void ComputeProgressVariables(std::size_t numberPoints, const PetscReal* massFractions, PetscReal* progressVariables) const;
+
+    /**
+     * batch helper function to compute the mass fractions from the progress variables for numberPoints using a single matrix-matrix product
+     * @param numberPoints
+     * @param progressVariables the progress variables stored point major (numberPoints x numberProgressVariables)
+     * @param massFractions the mass fractions stored point major (numberPoints x numberSpecies)
+     * @param density optional density for each point, allows for this function to be used with density*progress variables
+     */
+    void ComputeMassFractions(std::size_t numberPoints, const PetscReal* progressVariables, PetscReal* massFractions, const PetscReal density[] = nullptr) const;
+
     /**
      * Print the details of this eos
      * @param stream
@@ -262,6 +299,12 @@ class ChemTab : public ChemistryModel {
     void ComputeMassFractions(const PetscReal* progressVariables, std::size_t progressVariablesSize, PetscReal* massFractions, std::size_t massFractionsSize, PetscReal density = 1.0) {
         throw std::runtime_error(errorMessage);
     }
+
+    void ComputeProgressVariables(std::size_t numberPoints, const PetscReal* massFractions, PetscReal* progressVariables) const { throw std::runtime_error(errorMessage); }
+
+    void ComputeMassFractions(std::size_t numberPoints, const PetscReal* progressVariables, PetscReal* massFractions, const PetscReal density[] = nullptr) const {
+        throw std::runtime_error(errorMessage);
+    }
 };
 #endif
 }  // namespace ablate::eos
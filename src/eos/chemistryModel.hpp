@@ -3,10 +3,12 @@
 
 #include <petsc.h>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include "eos/eos.hpp"
 #include "solver/solver.hpp"
+#include "utilities/memoryUsage.hpp"
 
 namespace ablate::eos {
 
@@ -27,16 +29,58 @@ class ChemistryModel : public eos::EOS {
      */
     class SourceCalculator {
        public:
+        //! the per cell cost of the last ComputeSource is stored as (wall time, substeps, integration failures)
+        static constexpr std::size_t CELL_COST_WALL_TIME = 0;
+        static constexpr std::size_t CELL_COST_SUBSTEPS = 1;
+        static constexpr std::size_t CELL_COST_FAILURES = 2;
+        static constexpr std::size_t CELL_COST_SIZE = 3;
+
         virtual ~SourceCalculator(){};
         /**
          * The compute source can be used as a prestep allowing the add source to be used at each stage without reevaluating
          */
         virtual void ComputeSource(const solver::Range& cellRange, PetscReal time, PetscReal dt, Vec solution) = 0;
 
+        /**
+         * Compute the source for a subset of the cells used to create the calculator, where rows[i] is the index in the original cell range of the ith subset cell.  This allows
+         * per cell information (such as a warm start) to follow the cell.  The default ignores the rows.
+         */
+        virtual void ComputeSubsetSource(const solver::Range& subsetRange, const std::vector<std::size_t>& rows, PetscReal time, PetscReal dt, Vec solution) {
+            ComputeSource(subsetRange, time, dt, solution);
+        }
+
         /**
          * Adds the source that was computed in the presetp to the supplied vector
          */
         virtual void AddSource(const solver::Range& cellRange, Vec solution, Vec source) = 0;
+
+        /**
+         * Adds scale times the instantaneous source S(X) at the local solution to the local source vector.  This is used when the chemistry is integrated implicitly by the
+         * time stepper and is not supported by every chemistry model.
+         */
+        virtual void AddImplicitSource(const solver::Range& cellRange, Vec localSolution, PetscReal scale, Vec localSource) {
+            throw std::runtime_error("The chemistry model does not support implicit source terms");
+        }
+
+        /**
+         * Adds scale times the cell block diagonal jacobian dS/dX of the instantaneous source at the local solution to the global jacobian
+         */
+        virtual void AddImplicitJacobian(const solver::Range& cellRange, Vec localSolution, PetscReal scale, Mat jacobian) {
+            throw std::runtime_error("The chemistry model does not support implicit source terms");
+        }
+
+        /**
+         * Copy the cost of each cell in the last ComputeSource into cost (CELL_COST_SIZE values per cell)
+         * @return false if the chemistry model does not record the cost
+         */
+        virtual bool GetCellCost(const solver::Range& cellRange, PetscReal cost[]) const { return false; }
+
+        /**
+         * Add the host and device memory held by the calculator to the memory usage
+         * @param memoryUsage
+         * @param prefix prepended to each entry name
+         */
+        virtual void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const {}
     };
 
     /**
@@ -39,6 +39,25 @@ struct ThermodynamicTemperatureFunction {
     std::shared_ptr<void> context = nullptr;
 };
 
+/**
+ * Simple struct representing the context and function for computing any thermodynamic value for a batch of points when temperature is not available.  The conserved values for point i start at
+ * conserved[i*conservedStride] and the property is written to property[i*propertyStride].
+ */
+struct ThermodynamicBatchFunction {
+    PetscErrorCode (*function)(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, PetscReal property[], PetscInt propertyStride, void* ctx) = nullptr;
+    std::shared_ptr<void> context = nullptr;
+};
+
+/**
+ * Simple struct representing the context and function for computing any thermodynamic value for a batch of points when temperature is available.  The conserved values for point i start at
+ * conserved[i*conservedStride], the temperature is temperature[i*temperatureStride], and the property is written to property[i*propertyStride].
+ */
+struct ThermodynamicTemperatureBatchFunction {
+    PetscErrorCode (*function)(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, const PetscReal temperature[], PetscInt temperatureStride, PetscReal property[],
+                               PetscInt propertyStride, void* ctx) = nullptr;
+    std::shared_ptr<void> context = nullptr;
+};
+
 /**
  * Simple function representing the context and function for computing a field from two specified properties, velocity, and Yi
  */
@@ -52,6 +71,32 @@ class EOS {
    protected:
     const std::string type;
 
+   private:
+    /**
+     * Default batch implementation that calls the single point ThermodynamicFunction for each point
+     */
+    static PetscErrorCode ThermodynamicBatchFromPointFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, PetscReal property[], PetscInt propertyStride, void* ctx) {
+        PetscFunctionBeginUser;
+        auto pointFunction = (ThermodynamicFunction*)ctx;
+        for (PetscInt i = 0; i < n; i++) {
+            PetscCall(pointFunction->function(conserved + i * conservedStride, property + i * propertyStride, pointFunction->context.get()));
+        }
+        PetscFunctionReturn(0);
+    }
+
+    /**
+     * Default batch implementation that calls the single point ThermodynamicTemperatureFunction for each point
+     */
+    static PetscErrorCode ThermodynamicTemperatureBatchFromPointFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, const PetscReal temperature[], PetscInt temperatureStride,
+                                                                         PetscReal property[], PetscInt propertyStride, void* ctx) {
+        PetscFunctionBeginUser;
+        auto pointFunction = (ThermodynamicTemperatureFunction*)ctx;
+        for (PetscInt i = 0; i < n; i++) {
+            PetscCall(pointFunction->function(conserved + i * conservedStride, temperature[i * temperatureStride], property + i * propertyStride, pointFunction->context.get()));
+        }
+        PetscFunctionReturn(0);
+    }
+
    public:
     explicit EOS(std::string typeIn) : type(std::move(typeIn)){};
     virtual ~EOS() = default;
@@ -78,6 +123,28 @@ class EOS {
      */
     [[nodiscard]] virtual ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const = 0;
 
+    /**
+     * Single function to produce a batch thermodynamic function for any property based upon the available fields.  The default implementation calls the ThermodynamicFunction for each point.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] virtual ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const {
+        return ThermodynamicBatchFunction{.function = ThermodynamicBatchFromPointFunction, .context = std::make_shared<ThermodynamicFunction>(GetThermodynamicFunction(property, fields))};
+    }
+
+    /**
+     * Single function to produce a batch thermodynamic function for any property based upon the available fields and temperature.  The default implementation calls the
+     * ThermodynamicTemperatureFunction for each point.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] virtual ThermodynamicTemperatureBatchFunction GetThermodynamicTemperatureBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const {
+        return ThermodynamicTemperatureBatchFunction{.function = ThermodynamicTemperatureBatchFromPointFunction,
+                                                     .context = std::make_shared<ThermodynamicTemperatureFunction>(GetThermodynamicTemperatureFunction(property, fields))};
+    }
+
     /**
      * Single function to produce fieldFunction function for any two properties, velocity, and species mass fractions.  These calls can be slower and should be used for init/output only
      * @param field
@@ -106,6 +173,12 @@ class EOS {
      */
     [[nodiscard]] virtual const std::vector<std::string>& GetSpecies() const { return GetSpeciesVariables(); }
 
+    /**
+     * True if the functions produced by this eos can be called concurrently, i.e. they do not write to any scratch space in their context
+     * @return
+     */
+    [[nodiscard]] virtual bool ThreadSafe() const { return false; }
+
     /**
      * Support function for printing any eos
      * @param out
@@ -0,0 +1,414 @@
+#include "isat.hpp"
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <utility>
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "solver/dynamicRange.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+void ablate::eos::ISAT::Options::Set(const std::shared_ptr<ablate::parameters::Parameters>& parameters) {
+    if (parameters) {
+        errorTolerance = parameters->Get("errorTolerance", errorTolerance);
+        absoluteTolerance = parameters->Get("absoluteTolerance", absoluteTolerance);
+        densityScale = parameters->Get("densityScale", densityScale);
+        energyScale = parameters->Get("energyScale", energyScale);
+        maxRecords = parameters->Get("maxRecords", maxRecords);
+        shareRecords = parameters->Get("shareRecords", shareRecords);
+        dtTolerance = parameters->Get("dtTolerance", dtTolerance);
+        maxTables = parameters->Get("maxTables", maxTables);
+    }
+}
+
+ablate::eos::ISAT::Table::Table(std::size_t stateSize, std::size_t sourceSize, const Options& options) : stateSize(stateSize), sourceSize(sourceSize), options(options) {}
+
+PetscInt ablate::eos::ISAT::Table::FindLeaf(const std::vector<PetscReal>& state) const {
+    if (nodes.empty()) {
+        return -1;
+    }
+
+    // march down the tree using the cutting planes
+    PetscInt n = 0;
+    while (nodes[n].record < 0) {
+        const auto& node = nodes[n];
+        PetscReal projection = 0.0;
+        for (std::size_t s = 0; s < stateSize; s++) {
+            projection += node.normal[s] * state[s];
+        }
+        n = projection < node.offset ? node.left : node.right;
+    }
+    return n;
+}
+
+PetscReal ablate::eos::ISAT::Table::Distance(const std::vector<PetscReal>& a, const std::vector<PetscReal>& b) {
+    PetscReal distance = 0.0;
+    for (std::size_t s = 0; s < a.size(); s++) {
+        distance += PetscSqr(a[s] - b[s]);
+    }
+    return PetscSqrtReal(distance);
+}
+
+void ablate::eos::ISAT::Table::Approximate(const Record& record, const std::vector<PetscReal>& state, std::vector<PetscReal>& source) const {
+    source = record.source;
+    for (std::size_t f = 0; f < sourceSize; f++) {
+        for (std::size_t s = 0; s < stateSize; s++) {
+            source[f] += record.sensitivity[f * stateSize + s] * (state[s] - record.state[s]);
+        }
+    }
+}
+
+PetscReal ablate::eos::ISAT::Table::Error(const std::vector<PetscReal>& approximate, const std::vector<PetscReal>& exact) const {
+    // the energy (index 0) and species sources have different scales, so use the relative error of each
+    const PetscReal energyError = PetscAbs(approximate[0] - exact[0]) / (PetscAbs(exact[0]) + options.absoluteTolerance);
+    PetscReal speciesError = 0.0;
+    PetscReal speciesNorm = 0.0;
+    for (std::size_t f = 1; f < sourceSize; f++) {
+        speciesError += PetscSqr(approximate[f] - exact[f]);
+        speciesNorm += PetscSqr(exact[f]);
+    }
+    return PetscMax(energyError, PetscSqrtReal(speciesError) / (PetscSqrtReal(speciesNorm) + options.absoluteTolerance));
+}
+
+void ablate::eos::ISAT::Table::Insert(Record record, PetscInt leaf) {
+    const auto recordIndex = (PetscInt)records.size();
+    records.push_back(std::move(record));
+    if (options.shareRecords) {
+        newRecords.push_back(recordIndex);
+    }
+
+    // the first record is the root
+    if (leaf < 0) {
+        nodes.push_back(Node{.record = recordIndex});
+        return;
+    }
+
+    // split the leaf with the plane bisecting the existing and new records
+    const auto& existingState = records[nodes[leaf].record].state;
+    const auto& newState = records[recordIndex].state;
+    std::vector<PetscReal> normal(stateSize);
+    PetscReal offset = 0.0;
+    for (std::size_t s = 0; s < stateSize; s++) {
+        normal[s] = newState[s] - existingState[s];
+        offset += 0.5 * normal[s] * (newState[s] + existingState[s]);
+    }
+
+    const auto left = (PetscInt)nodes.size();
+    nodes.push_back(Node{.record = nodes[leaf].record});
+    nodes.push_back(Node{.record = recordIndex});
+    auto& node = nodes[leaf];
+    node.left = left;
+    node.right = left + 1;
+    node.record = -1;
+    node.normal = std::move(normal);
+    node.offset = offset;
+}
+
+bool ablate::eos::ISAT::Table::Retrieve(const std::vector<PetscReal>& state, std::vector<PetscReal>& source) const {
+    const auto leaf = FindLeaf(state);
+    if (leaf < 0) {
+        return false;
+    }
+    const auto& record = records[nodes[leaf].record];
+    if (Distance(state, record.state) > record.radius) {
+        return false;
+    }
+    Approximate(record, state, source);
+    return true;
+}
+
+void ablate::eos::ISAT::Table::Add(const std::vector<PetscReal>& state, const std::vector<PetscReal>& source) {
+    const auto leaf = FindLeaf(state);
+    if (leaf < 0) {
+        Insert(Record{.state = state, .source = source, .sensitivity = std::vector<PetscReal>(stateSize * sourceSize, 0.0)}, -1);
+        return;
+    }
+
+    // check the linear approximation from the nearest record
+    auto& record = records[nodes[leaf].record];
+    std::vector<PetscReal> approximate;
+    Approximate(record, state, approximate);
+    const PetscReal distance = Distance(state, record.state);
+
+    if (Error(approximate, source) <= options.errorTolerance) {
+        // the record is accurate at this state, so grow its region of accuracy
+        record.radius = PetscMax(record.radius, distance);
+    } else if (distance == 0.0) {
+        record.source = source;
+    } else if (records.size() < (std::size_t)options.maxRecords) {
+        // the new record uses a secant (Broyden) update of the nearest record's sensitivity so that it reproduces both states
+        std::vector<PetscReal> sensitivity = record.sensitivity;
+        const PetscReal distanceSquared = distance * distance;
+        for (std::size_t f = 0; f < sourceSize; f++) {
+            const PetscReal residual = source[f] - approximate[f];
+            for (std::size_t s = 0; s < stateSize; s++) {
+                sensitivity[f * stateSize + s] += residual * (state[s] - record.state[s]) / distanceSquared;
+            }
+        }
+        Insert(Record{.state = state, .source = source, .sensitivity = std::move(sensitivity)}, leaf);
+    }
+}
+
+void ablate::eos::ISAT::Table::ShareNewRecords(MPI_Comm comm) {
+    PetscMPIInt rank, size;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+    MPI_Comm_size(comm, &size) >> checkMpiError;
+    if (size == 1) {
+        newRecords.clear();
+        return;
+    }
+
+    // pack each record as the state, source, sensitivity, and radius
+    const std::size_t recordSize = stateSize + sourceSize + stateSize * sourceSize + 1;
+    std::vector<PetscReal> sendBuffer;
+    sendBuffer.reserve(newRecords.size() * recordSize);
+    for (const auto& r : newRecords) {
+        const auto& record = records[r];
+        sendBuffer.insert(sendBuffer.end(), record.state.begin(), record.state.end());
+        sendBuffer.insert(sendBuffer.end(), record.source.begin(), record.source.end());
+        sendBuffer.insert(sendBuffer.end(), record.sensitivity.begin(), record.sensitivity.end());
+        sendBuffer.push_back(record.radius);
+    }
+    newRecords.clear();
+
+    // gather all new records
+    PetscMPIInt sendCount = (PetscMPIInt)sendBuffer.size();
+    std::vector<PetscMPIInt> receiveCounts(size);
+    MPI_Allgather(&sendCount, 1, MPI_INT, receiveCounts.data(), 1, MPI_INT, comm) >> checkMpiError;
+    std::vector<PetscMPIInt> displacements(size, 0);
+    for (PetscMPIInt r = 1; r < size; r++) {
+        displacements[r] = displacements[r - 1] + receiveCounts[r - 1];
+    }
+    std::vector<PetscReal> receiveBuffer(displacements.back() + receiveCounts.back());
+    MPI_Allgatherv(sendBuffer.data(), sendCount, MPIU_REAL, receiveBuffer.data(), receiveCounts.data(), displacements.data(), MPIU_REAL, comm) >> checkMpiError;
+
+    // insert the records from the other ranks
+    for (PetscMPIInt r = 0; r < size; r++) {
+        if (r == rank) {
+            continue;
+        }
+        for (PetscMPIInt offset = displacements[r]; offset < displacements[r] + receiveCounts[r] && records.size() < (std::size_t)options.maxRecords; offset += (PetscMPIInt)recordSize) {
+            auto begin = receiveBuffer.begin() + offset;
+            Record record{.state = std::vector<PetscReal>(begin, begin + stateSize),
+                          .source = std::vector<PetscReal>(begin + stateSize, begin + stateSize + sourceSize),
+                          .sensitivity = std::vector<PetscReal>(begin + stateSize + sourceSize, begin + recordSize - 1),
+                          .radius = *(begin + recordSize - 1)};
+            const auto leaf = FindLeaf(record.state);
+            Insert(std::move(record), leaf);
+        }
+    }
+
+    // the shared records do not need to be shared again
+    newRecords.clear();
+}
+
+ablate::eos::ISAT::ISATSourceCalculator::ISATSourceCalculator(const std::vector<domain::Field>& fields, std::shared_ptr<ChemistryModel::SourceCalculator> sourceCalculatorIn,
+                                                             const Options& options, const solver::Range& cellRange, std::shared_ptr<ablate::monitors::logs::Log> log)
+    : sourceCalculator(std::move(sourceCalculatorIn)),
+      options(options),
+      eulerId(FindField(fields, ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD).id),
+      densityYiId(FindField(fields, ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD).id),
+      numberVelocityComponents(FindField(fields, ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD).numberComponents - ablate::finiteVolume::CompressibleFlowFields::RHOU),
+      numberSpecies(FindField(fields, ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD).numberComponents),
+      log(std::move(log)) {
+    // size up the source for each cell
+    sourceTerms.resize((cellRange.end - cellRange.start) * (numberSpecies + 1), 0.0);
+}
+
+const ablate::domain::Field& ablate::eos::ISAT::ISATSourceCalculator::FindField(const std::vector<domain::Field>& fields, const std::string& name) {
+    auto field = std::find_if(fields.begin(), fields.end(), [&name](const auto& field) { return field.name == name; });
+    if (field == fields.end()) {
+        throw std::invalid_argument("ablate::eos::ISAT requires the " + name + " Field");
+    }
+    return *field;
+}
+
+ablate::eos::ISAT::Table& ablate::eos::ISAT::ISATSourceCalculator::GetTable(PetscReal dt) {
+    // the records are only valid for the dt used to create them, so reuse the table created with the same dt
+    auto match = std::find_if(tables.begin(), tables.end(), [this, dt](const auto& table) { return PetscAbs(dt - table.first) <= options.dtTolerance * PetscAbs(table.first); });
+    if (match != tables.end()) {
+        tables.splice(tables.begin(), tables, match);
+    } else {
+        tables.emplace_front(std::piecewise_construct, std::forward_as_tuple(dt), std::forward_as_tuple(numberSpecies + 2, numberSpecies + 1, options));
+        while (tables.size() > (std::size_t)PetscMax(options.maxTables, 1)) {
+            tables.pop_back();
+        }
+    }
+    return tables.front().second;
+}
+
+std::size_t ablate::eos::ISAT::ISATSourceCalculator::GetNumberRecords() const {
+    std::size_t numberRecords = 0;
+    for (const auto& table : tables) {
+        numberRecords += table.second.Size();
+    }
+    return numberRecords;
+}
+
+void ablate::eos::ISAT::ISATSourceCalculator::ComputeSource(const solver::Range& cellRange, PetscReal time, PetscReal dt, Vec globalSolution) {
+    StartEvent("ISAT::ComputeSource");
+    const std::size_t sourceSize = numberSpecies + 1;
+    auto& table = GetTable(dt);
+
+    // Get the solution dm
+    DM solutionDm;
+    VecGetDM(globalSolution, &solutionDm) >> checkError;
+    MPI_Comm comm = PetscObjectComm((PetscObject)solutionDm);
+
+    // try to retrieve each cell from the table
+    solver::DynamicRange missRange;
+    std::vector<std::size_t> missIndex;
+    std::vector<std::vector<PetscReal>> missState;
+    std::vector<PetscReal> missDensity;
+    std::vector<PetscReal> state(numberSpecies + 2);
+    std::vector<PetscReal> source(sourceSize);
+
+    const PetscScalar* solutionArray;
+    VecGetArrayRead(globalSolution, &solutionArray) >> checkError;
+    for (PetscInt i = cellRange.start; i < cellRange.end; i++) {
+        const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
+        const std::size_t chemIndex = i - cellRange.start;
+
+        const PetscScalar* eulerField = nullptr;
+        DMPlexPointLocalFieldRead(solutionDm, cell, eulerId, solutionArray, &eulerField) >> checkError;
+        const PetscScalar* densityYiField = nullptr;
+        DMPlexPointLocalFieldRead(solutionDm, cell, densityYiId, solutionArray, &densityYiField) >> checkError;
+
+        // build the scaled state from the density, internal energy, and mass fractions
+        const PetscReal density = eulerField[ablate::finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal speedSquare = 0.0;
+        for (PetscInt d = 0; d < numberVelocityComponents; d++) {
+            speedSquare += PetscSqr(eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+        }
+        state[0] = density / options.densityScale;
+        state[1] = (eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare) / options.energyScale;
+        for (PetscInt s = 0; s < numberSpecies; s++) {
+            state[s + 2] = densityYiField[s] / density;
+        }
+
+        if (table.Retrieve(state, source)) {
+            for (std::size_t f = 0; f < sourceSize; f++) {
+                sourceTerms[chemIndex * sourceSize + f] = source[f] * density;
+            }
+        } else {
+            missRange.Add(cell);
+            missIndex.push_back(chemIndex);
+            missState.push_back(state);
+            missDensity.push_back(density);
+        }
+    }
+    VecRestoreArrayRead(globalSolution, &solutionArray) >> checkError;
+
+    // compute the cells that could not be retrieved.  This is called on every rank because the wrapped calculator may be collective.  The miss index maps each missed cell
+    // back to its row in the cell range so the wrapped calculator's per cell information follows the cell
+    const auto& range = missRange.GetRange();
+    sourceCalculator->ComputeSubsetSource(range, missIndex, time, dt, globalSolution);
+
+    Vec locX, locF;
+    DMGetLocalVector(solutionDm, &locX) >> checkError;
+    DMGlobalToLocal(solutionDm, globalSolution, INSERT_VALUES, locX) >> checkError;
+    DMGetLocalVector(solutionDm, &locF) >> checkError;
+    VecZeroEntries(locF) >> checkError;
+    sourceCalculator->AddSource(range, locX, locF);
+
+    // store the computed source and add it to the table
+    const PetscScalar* fArray;
+    VecGetArrayRead(locF, &fArray) >> checkError;
+    for (std::size_t m = 0; m < missIndex.size(); m++) {
+        const PetscScalar* eulerSource = nullptr;
+        DMPlexPointLocalFieldRead(solutionDm, range.points[m], eulerId, fArray, &eulerSource) >> checkError;
+        const PetscScalar* densityYiSource = nullptr;
+        DMPlexPointLocalFieldRead(solutionDm, range.points[m], densityYiId, fArray, &densityYiSource) >> checkError;
+
+        auto cellSource = sourceTerms.begin() + (PetscInt)(missIndex[m] * sourceSize);
+        cellSource[0] = eulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOE];
+        for (PetscInt s = 0; s < numberSpecies; s++) {
+            cellSource[s + 1] = densityYiSource[s];
+        }
+
+        // the table stores the source per unit mass
+        for (std::size_t f = 0; f < sourceSize; f++) {
+            source[f] = cellSource[f] / missDensity[m];
+        }
+        table.Add(missState[m], source);
+    }
+    VecRestoreArrayRead(locF, &fArray) >> checkError;
+    DMRestoreLocalVector(solutionDm, &locF) >> checkError;
+    DMRestoreLocalVector(solutionDm, &locX) >> checkError;
+
+    // optionally share the new records with all ranks
+    if (options.shareRecords) {
+        table.ShareNewRecords(comm);
+    }
+
+    // record and report the hit rate for this step
+    PetscInt64 stepCounts[2] = {(PetscInt64)(cellRange.end - cellRange.start), (PetscInt64)(cellRange.end - cellRange.start) - (PetscInt64)missIndex.size()};
+    numberQueries += stepCounts[0];
+    numberHits += stepCounts[1];
+    if (log) {
+        PetscInt64 globalStepCounts[2];
+        MPI_Allreduce(stepCounts, globalStepCounts, 2, MPIU_INT64, MPI_SUM, comm) >> checkMpiError;
+        if (!log->Initialized()) {
+            log->Initialize(comm);
+        }
+        log->Printf("ISAT: retrieved %" PetscInt64_FMT " of %" PetscInt64_FMT " cells (%.2f%%) with %zu local records for this dt\n",
+                    globalStepCounts[1],
+                    globalStepCounts[0],
+                    globalStepCounts[0] ? 100.0 * (double)globalStepCounts[1] / (double)globalStepCounts[0] : 0.0,
+                    table.Size());
+    }
+    EndEvent();
+}
+
+void ablate::eos::ISAT::ISATSourceCalculator::AddSource(const solver::Range& cellRange, Vec, Vec locFVec) {
+    const std::size_t sourceSize = numberSpecies + 1;
+
+    // get access to the fArray
+    PetscScalar* fArray;
+    VecGetArray(locFVec, &fArray) >> checkError;
+
+    // Get the solution dm
+    DM dm;
+    VecGetDM(locFVec, &dm) >> checkError;
+
+    for (PetscInt i = cellRange.start; i < cellRange.end; i++) {
+        const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
+        const std::size_t chemIndex = i - cellRange.start;
+
+        PetscScalar* eulerSource = nullptr;
+        DMPlexPointLocalFieldRef(dm, cell, eulerId, fArray, &eulerSource) >> checkError;
+        PetscScalar* densityYiSource = nullptr;
+        DMPlexPointLocalFieldRef(dm, cell, densityYiId, fArray, &densityYiSource) >> checkError;
+
+        eulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOE] += sourceTerms[chemIndex * sourceSize];
+        for (PetscInt s = 0; s < numberSpecies; s++) {
+            densityYiSource[s] += sourceTerms[chemIndex * sourceSize + s + 1];
+        }
+    }
+
+    // cleanup
+    VecRestoreArray(locFVec, &fArray) >> checkError;
+}
+
+ablate::eos::ISAT::ISAT(std::shared_ptr<ChemistryModel> chemistryModelIn, const std::shared_ptr<ablate::parameters::Parameters>& parameters, std::shared_ptr<ablate::monitors::logs::Log> log)
+    : ChemistryModel("ISAT"), chemistryModel(std::move(chemistryModelIn)), log(std::move(log)) {
+    options.Set(parameters);
+}
+
+void ablate::eos::ISAT::View(std::ostream& stream) const {
+    stream << "EOS: " << type << std::endl;
+    stream << "\terrorTolerance: " << options.errorTolerance << std::endl;
+    stream << "\tmaxRecords: " << options.maxRecords << std::endl;
+    chemistryModel->View(stream);
+}
+
+std::shared_ptr<ablate::eos::ChemistryModel::SourceCalculator> ablate::eos::ISAT::CreateSourceCalculator(const std::vector<domain::Field>& fields, const solver::Range& cellRange) {
+    return std::make_shared<ISATSourceCalculator>(fields, chemistryModel->CreateSourceCalculator(fields, cellRange), options, cellRange, log);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::eos::ChemistryModel, ablate::eos::ISAT, "In situ adaptive tabulation (ISAT) of the chemistry source terms computed by another chemistry model",
+         ARG(ablate::eos::ChemistryModel, "chemistryModel", "the chemistry model used to compute the source terms on a table miss and the thermodynamic properties"),
+         OPT(ablate::parameters::Parameters, "options",
+             "tabulation options (errorTolerance, absoluteTolerance, densityScale, energyScale, maxRecords, shareRecords (0 or 1), dtTolerance, maxTables)"),
+         OPT(ablate::monitors::logs::Log, "log", "an optional log to report the hit rate for each step"));
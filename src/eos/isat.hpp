@@ -0,0 +1,276 @@
+#ifndef ABLATELIBRARY_ISAT_HPP
+#define ABLATELIBRARY_ISAT_HPP
+
+#include <list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "chemistryModel.hpp"
+#include "monitors/logs/log.hpp"
+#include "parameters/parameters.hpp"
+#include "utilities/loggable.hpp"
+
+namespace ablate::eos {
+
+/**
+ * In situ adaptive tabulation (ISAT) of the chemistry source terms computed by another chemistry model.  Each record maps the scaled thermochemical state
+ * x = (density/densityScale, internalEnergy/energyScale, Yi) to the source per unit mass f = (densityEnergySource, densityYiSource)/density and a linear sensitivity df/dx.  The
+ * records are stored in a binary tree with cutting planes; a query within the region of accuracy of the leaf record is answered by linear extrapolation, otherwise the wrapped
+ * chemistry model is used and the table is grown.  The thermodynamic properties are delegated to the wrapped chemistry model.
+ */
+class ISAT : public ChemistryModel {
+   public:
+    //! the tabulation options
+    struct Options {
+        //! the allowed relative error in the source before a record is added
+        double errorTolerance = 1.0E-3;
+        //! the absolute error added to the relative error scale of the source
+        double absoluteTolerance = 1.0E-8;
+        //! the density scale (kg/m^3) used to compute the distance between states
+        double densityScale = 1.0;
+        //! the internal energy scale (J/kg) used to compute the distance between states
+        double energyScale = 1.0E5;
+        //! the maximum number of records stored per table
+        int maxRecords = 5000;
+        //! share new records with all ranks after each ComputeSource (0 or 1)
+        int shareRecords = 0;
+        //! the records of a table are reused for any dt within the relative dtTolerance of the table dt
+        double dtTolerance = 1.0E-8;
+        //! the maximum number of tables (one per dt) kept, the least recently used table is removed first
+        int maxTables = 4;
+
+        void Set(const std::shared_ptr<ablate::parameters::Parameters>&);
+    };
+
+    /**
+     * The binary tree of records used to retrieve and store the source terms
+     */
+    class Table {
+       private:
+        //! the size of the state and source vectors
+        const std::size_t stateSize;
+        const std::size_t sourceSize;
+
+        //! the tabulation options
+        const Options options;
+
+        //! a single record (x, f, df/dx, radius of accuracy)
+        struct Record {
+            std::vector<PetscReal> state;
+            std::vector<PetscReal> source;
+            std::vector<PetscReal> sensitivity;
+            PetscReal radius = 0.0;
+        };
+
+        //! a node in the binary tree, leaves point to a record while internal nodes store a cutting plane
+        struct Node {
+            PetscInt left = -1;
+            PetscInt right = -1;
+            PetscInt record = -1;
+            std::vector<PetscReal> normal;
+            PetscReal offset = 0.0;
+        };
+
+        std::vector<Record> records;
+        std::vector<Node> nodes;
+
+        //! the records added since the last ClearNewRecords
+        std::vector<PetscInt> newRecords;
+
+        /**
+         * find the leaf node for the state, returns -1 if the table is empty
+         */
+        [[nodiscard]] PetscInt FindLeaf(const std::vector<PetscReal>& state) const;
+
+        /**
+         * the scaled distance between two states
+         */
+        static PetscReal Distance(const std::vector<PetscReal>& a, const std::vector<PetscReal>& b);
+
+        /**
+         * compute the linear approximation of record at the state
+         */
+        void Approximate(const Record& record, const std::vector<PetscReal>& state, std::vector<PetscReal>& source) const;
+
+        /**
+         * the relative error between the approximate and exact source
+         */
+        [[nodiscard]] PetscReal Error(const std::vector<PetscReal>& approximate, const std::vector<PetscReal>& exact) const;
+
+        /**
+         * insert a record into the tree below the leaf node
+         */
+        void Insert(Record record, PetscInt leaf);
+
+       public:
+        Table(std::size_t stateSize, std::size_t sourceSize, const Options& options);
+
+        /**
+         * Try to compute the source from the table
+         * @param state
+         * @param source
+         * @return true if the state was retrieved from the table
+         */
+        bool Retrieve(const std::vector<PetscReal>& state, std::vector<PetscReal>& source) const;
+
+        /**
+         * Add the directly computed source to the table, either by growing the region of accuracy of the nearest record or adding a new record
+         * @param state
+         * @param source
+         */
+        void Add(const std::vector<PetscReal>& state, const std::vector<PetscReal>& source);
+
+        /**
+         * Share the records added since the last call with all ranks in the comm.  Must be called by all ranks.
+         * @param comm
+         */
+        void ShareNewRecords(MPI_Comm comm);
+
+        /**
+         * The number of records in the table
+         */
+        [[nodiscard]] inline std::size_t Size() const { return records.size(); }
+    };
+
+    /**
+     * The source calculator wraps the chemistry model's calculator and only computes the cells that cannot be retrieved from the table
+     */
+    class ISATSourceCalculator : public ChemistryModel::SourceCalculator, private utilities::Loggable<ISATSourceCalculator> {
+       private:
+        //! the wrapped source calculator
+        const std::shared_ptr<ChemistryModel::SourceCalculator> sourceCalculator;
+
+        //! the tabulation options
+        const Options options;
+
+        //! the field ids and sizes
+        const PetscInt eulerId;
+        const PetscInt densityYiId;
+        const PetscInt numberVelocityComponents;
+        const PetscInt numberSpecies;
+
+        //! the tables of records for each dt, ordered from the most to least recently used
+        std::list<std::pair<PetscReal, Table>> tables;
+
+        //! the source computed in ComputeSource for each cell (density*energy + density*species)
+        std::vector<PetscReal> sourceTerms;
+
+        //! an optional log for the hit rate
+        const std::shared_ptr<ablate::monitors::logs::Log> log;
+
+        //! the number of queries and hits over all calls
+        PetscInt64 numberQueries = 0;
+        PetscInt64 numberHits = 0;
+
+        /**
+         * find the required field
+         */
+        static const domain::Field& FindField(const std::vector<domain::Field>& fields, const std::string& name);
+
+        /**
+         * get the table for dt, creating it (and removing the least recently used table) if needed
+         */
+        Table& GetTable(PetscReal dt);
+
+       public:
+        ISATSourceCalculator(const std::vector<domain::Field>& fields, std::shared_ptr<ChemistryModel::SourceCalculator> sourceCalculator, const Options& options, const solver::Range& cellRange,
+                             std::shared_ptr<ablate::monitors::logs::Log> log);
+
+        /**
+         * retrieve the source from the table and compute the missing cells with the wrapped source calculator.  This must be called by every rank.
+         */
+        void ComputeSource(const solver::Range& cellRange, PetscReal time, PetscReal dt, Vec solution) override;
+
+        /**
+         * Adds the source that was computed in ComputeSource to the supplied vector
+         */
+        void AddSource(const solver::Range& cellRange, Vec solution, Vec source) override;
+
+        /**
+         * The instantaneous source and jacobian are not tabulated and are computed by the wrapped source calculator
+         * @{
+         */
+        void AddImplicitSource(const solver::Range& cellRange, Vec localSolution, PetscReal scale, Vec localSource) override {
+            sourceCalculator->AddImplicitSource(cellRange, localSolution, scale, localSource);
+        }
+        void AddImplicitJacobian(const solver::Range& cellRange, Vec localSolution, PetscReal scale, Mat jacobian) override {
+            sourceCalculator->AddImplicitJacobian(cellRange, localSolution, scale, jacobian);
+        }
+        /** @} */
+
+        /**
+         * The total number of table queries and retrievals
+         * @{
+         */
+        [[nodiscard]] inline PetscInt64 GetNumberQueries() const { return numberQueries; }
+        [[nodiscard]] inline PetscInt64 GetNumberHits() const { return numberHits; }
+        /** @} */
+
+        /**
+         * The number of records in all tables
+         */
+        [[nodiscard]] std::size_t GetNumberRecords() const;
+    };
+
+   private:
+    //! the chemistry model used to compute the sources on a miss and the thermodynamic properties
+    const std::shared_ptr<ChemistryModel> chemistryModel;
+
+    //! the tabulation options
+    Options options;
+
+    //! an optional log for the hit rate
+    const std::shared_ptr<ablate::monitors::logs::Log> log;
+
+   public:
+    /**
+     * Create the ISAT decorator for the chemistry model
+     * @param chemistryModel
+     * @param options
+     * @param log
+     */
+    explicit ISAT(std::shared_ptr<ChemistryModel> chemistryModel, const std::shared_ptr<ablate::parameters::Parameters>& options = {}, std::shared_ptr<ablate::monitors::logs::Log> log = {});
+
+    /**
+     * Print the details of this eos
+     * @param stream
+     */
+    void View(std::ostream& stream) const override;
+
+    /**
+     * The thermodynamic properties are delegated to the chemistry model
+     * @{
+     */
+    [[nodiscard]] ThermodynamicFunction GetThermodynamicFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override {
+        return chemistryModel->GetThermodynamicFunction(property, fields);
+    }
+    [[nodiscard]] ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override {
+        return chemistryModel->GetThermodynamicTemperatureFunction(property, fields);
+    }
+    [[nodiscard]] ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override {
+        return chemistryModel->GetThermodynamicBatchFunction(property, fields);
+    }
+    [[nodiscard]] ThermodynamicTemperatureBatchFunction GetThermodynamicTemperatureBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override {
+        return chemistryModel->GetThermodynamicTemperatureBatchFunction(property, fields);
+    }
+    [[nodiscard]] FieldFunction GetFieldFunctionFunction(const std::string& field, ThermodynamicProperty property1, ThermodynamicProperty property2) const override {
+        return chemistryModel->GetFieldFunctionFunction(field, property1, property2);
+    }
+    [[nodiscard]] const std::vector<std::string>& GetSpeciesVariables() const override { return chemistryModel->GetSpeciesVariables(); }
+    [[nodiscard]] const std::vector<std::string>& GetProgressVariables() const override { return chemistryModel->GetProgressVariables(); }
+    [[nodiscard]] const std::vector<std::string>& GetSpecies() const override { return chemistryModel->GetSpecies(); }
+    /** @} */
+
+    /**
+     * Create the tabulated source calculator wrapping the chemistry model's calculator
+     * @param fields
+     * @param cellRange
+     * @return
+     */
+    std::shared_ptr<SourceCalculator> CreateSourceCalculator(const std::vector<domain::Field>& fields, const solver::Range& cellRange) override;
+};
+
+}  // namespace ablate::eos
+
+#endif  // ABLATELIBRARY_ISAT_HPP
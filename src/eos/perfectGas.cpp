@@ -1,4 +1,5 @@
 #include "perfectGas.hpp"
+#include <type_traits>
 #include "finiteVolume/compressibleFlowFields.hpp"
 
 ablate::eos::PerfectGas::PerfectGas(const std::shared_ptr<ablate::parameters::Parameters> &parametersIn, std::vector<std::string> species)
@@ -43,6 +44,97 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::PerfectGas::GetThermo
         .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters})};
 }
 
+ablate::eos::ThermodynamicBatchFunction ablate::eos::PerfectGas::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    // Look for the euler field
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::PerfectGas requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+
+    // select the batch function for this property and dimension
+    auto selectBatchFunction = [property](auto dimConstant) -> decltype(ThermodynamicBatchFunction::function) {
+        constexpr PetscInt dim = decltype(dimConstant)::value;
+        switch (property) {
+            case ThermodynamicProperty::Density:
+                return BatchFunction<ThermodynamicProperty::Density, dim>;
+            case ThermodynamicProperty::Pressure:
+                return BatchFunction<ThermodynamicProperty::Pressure, dim>;
+            case ThermodynamicProperty::Temperature:
+                return BatchFunction<ThermodynamicProperty::Temperature, dim>;
+            case ThermodynamicProperty::InternalSensibleEnergy:
+                return BatchFunction<ThermodynamicProperty::InternalSensibleEnergy, dim>;
+            case ThermodynamicProperty::SensibleEnthalpy:
+                return BatchFunction<ThermodynamicProperty::SensibleEnthalpy, dim>;
+            case ThermodynamicProperty::SpeedOfSound:
+                return BatchFunction<ThermodynamicProperty::SpeedOfSound, dim>;
+            default:
+                return nullptr;
+        }
+    };
+
+    decltype(ThermodynamicBatchFunction::function) batchFunction = nullptr;
+    switch (eulerField->numberComponents - 2) {
+        case 1:
+            batchFunction = selectBatchFunction(std::integral_constant<PetscInt, 1>{});
+            break;
+        case 2:
+            batchFunction = selectBatchFunction(std::integral_constant<PetscInt, 2>{});
+            break;
+        case 3:
+            batchFunction = selectBatchFunction(std::integral_constant<PetscInt, 3>{});
+            break;
+    }
+
+    // fall back to calling the point function for everything else
+    if (!batchFunction) {
+        return EOS::GetThermodynamicBatchFunction(property, fields);
+    }
+    return ThermodynamicBatchFunction{.function = batchFunction,
+                                      .context = std::make_shared<FunctionContext>(FunctionContext{.dim = eulerField->numberComponents - 2, .eulerOffset = eulerField->offset, .parameters = parameters})};
+}
+
+template <ablate::eos::ThermodynamicProperty batchProperty, PetscInt dim>
+PetscErrorCode ablate::eos::PerfectGas::BatchFunction(PetscInt n, const PetscReal *conserved, PetscInt conservedStride, PetscReal *property, PetscInt propertyStride, void *ctx) {
+    PetscFunctionBeginUser;
+    const auto &parameters = ((FunctionContext *)ctx)->parameters;
+    const PetscReal gamma = parameters.gamma;
+    const PetscReal cv = parameters.rGas / (gamma - 1.0);
+    const PetscReal cp = gamma * parameters.rGas / (gamma - 1.0);
+    const PetscReal *euler = conserved + ((FunctionContext *)ctx)->eulerOffset;
+
+    for (PetscInt i = 0; i < n; i++) {
+        const PetscReal *eulerI = euler + i * conservedStride;
+
+        // Get the velocity in this direction
+        const PetscReal density = eulerI[ablate::finiteVolume::CompressibleFlowFields::RHO];
+        PetscReal ke = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            ke += PetscSqr(eulerI[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+        }
+        ke *= 0.5;
+        const PetscReal internalEnergy = eulerI[ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - ke;
+
+        // assumed eos
+        PetscReal value;
+        if constexpr (batchProperty == ThermodynamicProperty::Density) {
+            value = density;
+        } else if constexpr (batchProperty == ThermodynamicProperty::Pressure) {
+            value = (gamma - 1.0) * density * internalEnergy;
+        } else if constexpr (batchProperty == ThermodynamicProperty::Temperature) {
+            value = internalEnergy / cv;
+        } else if constexpr (batchProperty == ThermodynamicProperty::InternalSensibleEnergy) {
+            value = internalEnergy;
+        } else if constexpr (batchProperty == ThermodynamicProperty::SensibleEnthalpy) {
+            value = internalEnergy / cv * cp;
+        } else if constexpr (batchProperty == ThermodynamicProperty::SpeedOfSound) {
+            const PetscReal p = (gamma - 1.0) * density * internalEnergy;
+            value = PetscSqrtReal(gamma * p / density);
+        }
+        property[i * propertyStride] = value;
+    }
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::eos::PerfectGas::PressureFunction(const PetscReal *conserved, PetscReal *pressure, void *ctx) {
     PetscFunctionBeginUser;
     auto functionContext = (FunctionContext *)ctx;
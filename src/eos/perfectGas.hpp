@@ -64,6 +64,19 @@ class PerfectGas : public EOS {
     static PetscErrorCode SpeciesSensibleEnthalpyTemperatureFunction(const PetscReal conserved[], PetscReal T, PetscReal* property, void* ctx);
     /** @} */
 
+    /**
+     * Batch version of the direct thermodynamic functions, templated on the property and dimension so the loop over points contains no indirect calls
+     * @param n
+     * @param conserved
+     * @param conservedStride
+     * @param property
+     * @param propertyStride
+     * @param ctx
+     * @return
+     */
+    template <ThermodynamicProperty batchProperty, PetscInt dim>
+    static PetscErrorCode BatchFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, PetscReal property[], PetscInt propertyStride, void* ctx);
+
     /**
      * Store a map of functions functions for quick lookup
      */
@@ -111,6 +124,14 @@ class PerfectGas : public EOS {
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
+    /**
+     * Single function to produce a batch thermodynamic function for any property based upon the available fields
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
     /**
      * Single function to produce fieldFunction function for any two properties, velocity, and species mass fractions.  These calls can be slower and should be used for init/output only
      * @param field
@@ -130,6 +151,12 @@ class PerfectGas : public EOS {
      * @return
      */
     [[nodiscard]] virtual const std::vector<std::string>& GetProgressVariables() const override { return ablate::utilities::VectorUtilities::Empty<std::string>; }
+
+    /**
+     * The perfect gas functions only read the parameters in their context
+     * @return
+     */
+    [[nodiscard]] bool ThreadSafe() const override { return true; }
 };
 
 }  // namespace ablate::eos
@@ -12,6 +12,15 @@ PetscErrorCode ablate::eos::radiationProperties::Constant::ConstantTemperatureFu
     *property = *((double *)ctx);
     PetscFunctionReturn(0);
 }
+PetscErrorCode ablate::eos::radiationProperties::Constant::ConstantTemperatureBatchFunction(PetscInt n, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *temperature,
+                                                                                           PetscInt temperatureStride, PetscReal *property, PetscInt propertyStride, void *ctx) {
+    PetscFunctionBeginUser;
+    const double value = *((double *)ctx);
+    for (PetscInt i = 0; i < n; i++) {
+        property[i * propertyStride] = value;
+    }
+    PetscFunctionReturn(0);
+}
 
 ablate::eos::ThermodynamicFunction ablate::eos::radiationProperties::Constant::GetRadiationPropertiesFunction(RadiationProperty property, const std::vector<domain::Field> &fields) const {
     switch (property) {
@@ -32,6 +41,16 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::radiationProperties::
     }
 }
 
+ablate::eos::ThermodynamicTemperatureBatchFunction ablate::eos::radiationProperties::Constant::GetRadiationPropertiesTemperatureBatchFunction(RadiationProperty property,
+                                                                                                                                              const std::vector<domain::Field> &fields) const {
+    switch (property) {
+        case RadiationProperty::Absorptivity:
+            return ThermodynamicTemperatureBatchFunction{.function = ConstantTemperatureBatchFunction, .context = std::make_shared<double>(absorptivity)};
+        default:
+            throw std::invalid_argument("Unknown radiationProperties property in ablate::eos::radiationProperties::Constant");
+    }
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::eos::radiationProperties::RadiationModel, ablate::eos::radiationProperties::Constant, "constant value transport model (often used for testing)",
          ARG(double, "absorptivity", "radiative absorptivity"));
\ No newline at end of file
@@ -25,6 +25,12 @@ class Constant : public RadiationModel {
      */
     static PetscErrorCode ConstantTemperatureFunction(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
 
+    /**
+     * private static function for evaluating constant properties for a batch of points
+     */
+    static PetscErrorCode ConstantTemperatureBatchFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, const PetscReal temperature[], PetscInt temperatureStride,
+                                                           PetscReal property[], PetscInt propertyStride, void* ctx);
+
    public:
     explicit Constant(double absorptivity);
     explicit Constant(const Constant&) = delete;
@@ -45,6 +51,14 @@ class Constant : public RadiationModel {
      * @return
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetRadiationPropertiesTemperatureFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
+
+    /**
+     * Batch version of the temperature function that fills the constant value
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicTemperatureBatchFunction GetRadiationPropertiesTemperatureBatchFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
 };
 
 }  // namespace ablate::eos::radiationProperties
@@ -9,6 +9,20 @@ namespace ablate::eos::radiationProperties {
 enum class RadiationProperty { Absorptivity };
 
 class RadiationModel {
+   private:
+    /**
+     * Default batch implementation that calls the single point ThermodynamicTemperatureFunction for each point
+     */
+    static PetscErrorCode RadiationPropertiesTemperatureBatchFromPointFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, const PetscReal temperature[],
+                                                                               PetscInt temperatureStride, PetscReal property[], PetscInt propertyStride, void* ctx) {
+        PetscFunctionBeginUser;
+        auto pointFunction = (ThermodynamicTemperatureFunction*)ctx;
+        for (PetscInt i = 0; i < n; i++) {
+            PetscCall(pointFunction->function(conserved + i * conservedStride, temperature[i * temperatureStride], property + i * propertyStride, pointFunction->context.get()));
+        }
+        PetscFunctionReturn(0);
+    }
+
    public:
     virtual ~RadiationModel() = default;
 
@@ -27,6 +41,18 @@ class RadiationModel {
      * @return
      */
     [[nodiscard]] virtual ThermodynamicTemperatureFunction GetRadiationPropertiesTemperatureFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const = 0;
+
+    /**
+     * Single function to produce a batch radiation properties function based upon the available fields and temperature.  The default implementation calls the
+     * ThermodynamicTemperatureFunction for each point.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] virtual ThermodynamicTemperatureBatchFunction GetRadiationPropertiesTemperatureBatchFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const {
+        return ThermodynamicTemperatureBatchFunction{.function = RadiationPropertiesTemperatureBatchFromPointFunction,
+                                                     .context = std::make_shared<ThermodynamicTemperatureFunction>(GetRadiationPropertiesTemperatureFunction(property, fields))};
+    }
 };
 
 /**
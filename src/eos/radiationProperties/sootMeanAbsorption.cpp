@@ -7,18 +7,11 @@ PetscErrorCode ablate::eos::radiationProperties::SootMeanAbsorption::SootFunctio
     /** This model depends on mass fraction, temperature, and density in order to predict the absorption properties of the medium. */
     auto functionContext = (FunctionContext *)ctx;
     double temperature, density;  //!< Variables to hold information gathered from the fields
-    PetscErrorCode ierr;          //!< Standard PETSc error code returned by PETSc functions
 
-    ierr = functionContext->temperatureFunction.function(conserved, &temperature, functionContext->temperatureFunction.context.get());  //!< Get the temperature value at this location
-    CHKERRQ(ierr);
-    ierr = functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get());  //!< Get the density value at this location
-    CHKERRQ(ierr);
+    PetscCall(functionContext->temperatureFunction.function(conserved, &temperature, functionContext->temperatureFunction.context.get()));  //!< Get the temperature value at this location
+    PetscCall(functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get()));  //!< Get the density value at this location
 
-    PetscReal YinC = (functionContext->densityEVCOffset == -1) ? 0 : conserved[functionContext->densityEVCOffset] / density;  //!< Get the mass fraction of carbon here
-
-    PetscReal fv = density * YinC / rhoC;
-
-    *kappa = (3.72 * fv * C_0 * temperature) / C_2;
+    *kappa = SootAbsorptivity(*functionContext, conserved, temperature, density);
 
     PetscFunctionReturn(0);
 }
@@ -27,18 +20,29 @@ PetscErrorCode ablate::eos::radiationProperties::SootMeanAbsorption::SootTempera
     PetscFunctionBeginUser;
     /** This model depends on mass fraction, temperature, and density in order to predict the absorption properties of the medium. */
     auto functionContext = (FunctionContext *)ctx;
-    double density;       //!< Variables to hold information gathered from the fields
-    PetscErrorCode ierr;  //!< Standard PETSc error code returned by PETSc functions
-
-    ierr = functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get());  //!< Get the density value at this location
-    CHKERRQ(ierr);
+    double density;  //!< Variables to hold information gathered from the fields
 
-    PetscReal YinC = (functionContext->densityEVCOffset == -1) ? 0 : conserved[functionContext->densityEVCOffset] / density;  //!< Get the mass fraction of carbon here
+    PetscCall(functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get()));  //!< Get the density value at this location
 
-    PetscReal fv = density * YinC / rhoC;
+    *kappa = SootAbsorptivity(*functionContext, conserved, temperature, density);
 
-    *kappa = (3.72 * fv * C_0 * temperature) / C_2;
+    PetscFunctionReturn(0);
+}
 
+PetscErrorCode ablate::eos::radiationProperties::SootMeanAbsorption::SootTemperatureBatchFunction(PetscInt n, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *temperature,
+                                                                                                 PetscInt temperatureStride, PetscReal *kappa, PetscInt kappaStride, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const auto densityFunction = functionContext->densityFunction.function;
+    void *densityContext = functionContext->densityFunction.context.get();
+
+    for (PetscInt i = 0; i < n; i++) {
+        const PetscReal *pointConserved = conserved + i * conservedStride;
+        const PetscReal pointTemperature = temperature[i * temperatureStride];
+        PetscReal density;
+        PetscCall(densityFunction(pointConserved, pointTemperature, &density, densityContext));
+        kappa[i * kappaStride] = SootAbsorptivity(*functionContext, pointConserved, pointTemperature, density);
+    }
     PetscFunctionReturn(0);
 }
 
@@ -104,6 +108,13 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::radiationProperties::
     }
 }
 
+ablate::eos::ThermodynamicTemperatureBatchFunction ablate::eos::radiationProperties::SootMeanAbsorption::GetRadiationPropertiesTemperatureBatchFunction(
+    RadiationProperty property, const std::vector<domain::Field> &fields) const {
+    // the batch function shares the context with the temperature function
+    auto temperatureFunction = GetRadiationPropertiesTemperatureFunction(property, fields);
+    return ThermodynamicTemperatureBatchFunction{.function = SootTemperatureBatchFunction, .context = temperatureFunction.context};
+}
+
 PetscInt ablate::eos::radiationProperties::SootMeanAbsorption::GetFieldComponentOffset(const std::string &str, const domain::Field &field) const {
     /** Returns the index where a certain field component can be found.
      * The index will be set to -1 if the component does not exist in the field.
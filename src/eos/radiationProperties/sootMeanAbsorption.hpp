@@ -18,12 +18,25 @@ class SootMeanAbsorption : public RadiationModel {
     constexpr static PetscReal C_2 = (utilities::Constants::h * utilities::Constants::c) / (utilities::Constants::k);
     constexpr static PetscReal C_0 = 7.0;
     constexpr static PetscReal rhoC = 2000;  // kg/m^3
+
+    /**
+     * The absorptivity at a single point shared by the point and batch functions
+     */
+    static inline PetscReal SootAbsorptivity(const FunctionContext& functionContext, const PetscReal* conserved, PetscReal temperature, PetscReal density) {
+        PetscReal YinC = (functionContext.densityEVCOffset == -1) ? 0 : conserved[functionContext.densityEVCOffset] / density;  //!< Get the mass fraction of carbon here
+        PetscReal fv = density * YinC / rhoC;
+        return (3.72 * fv * C_0 * temperature) / C_2;
+    }
+
    public:
     SootMeanAbsorption(std::shared_ptr<EOS> eosIn);
-    ThermodynamicFunction GetRadiationPropertiesFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const;
-    ThermodynamicTemperatureFunction GetRadiationPropertiesTemperatureFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const;
+    ThermodynamicFunction GetRadiationPropertiesFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
+    ThermodynamicTemperatureFunction GetRadiationPropertiesTemperatureFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
+    ThermodynamicTemperatureBatchFunction GetRadiationPropertiesTemperatureBatchFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
     static PetscErrorCode SootFunction(const PetscReal* conserved, PetscReal* kappa, void* ctx);
     static PetscErrorCode SootTemperatureFunction(const PetscReal* conserved, PetscReal temperature, PetscReal* kappa, void* ctx);
+    static PetscErrorCode SootTemperatureBatchFunction(PetscInt n, const PetscReal* conserved, PetscInt conservedStride, const PetscReal* temperature, PetscInt temperatureStride, PetscReal* kappa,
+                                                       PetscInt kappaStride, void* ctx);
 
     PetscInt GetFieldComponentOffset(const std::string& str, const domain::Field& field) const;
 };
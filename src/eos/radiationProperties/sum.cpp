@@ -33,6 +33,26 @@ PetscErrorCode ablate::eos::radiationProperties::Sum::SumTemperatureFunction(con
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::eos::radiationProperties::Sum::SumTemperatureBatchFunction(PetscInt n, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *temperature,
+                                                                                 PetscInt temperatureStride, PetscReal *property, PetscInt propertyStride, void *ctx) {
+    PetscFunctionBeginUser;
+    auto vector = (std::vector<ThermodynamicTemperatureBatchFunction> *)ctx;
+
+    // each child computes the entire batch before it is added to the property
+    std::vector<PetscReal> propertyTmp(n);
+    for (PetscInt i = 0; i < n; i++) {
+        property[i * propertyStride] = 0.0;
+    }
+    for (const auto &[subFunction, subCtx] : *vector) {
+        PetscCall(subFunction(n, conserved, conservedStride, temperature, temperatureStride, propertyTmp.data(), 1, subCtx.get()));
+        for (PetscInt i = 0; i < n; i++) {
+            property[i * propertyStride] += propertyTmp[i];
+        }
+    }
+
+    PetscFunctionReturn(0);
+}
+
 ablate::eos::ThermodynamicFunction ablate::eos::radiationProperties::Sum::GetRadiationPropertiesFunction(ablate::eos::radiationProperties::RadiationProperty property,
                                                                                                          const std::vector<domain::Field> &fields) const {
     // Create the function
@@ -59,6 +79,19 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::radiationProperties::
 
     return function;
 }
+ablate::eos::ThermodynamicTemperatureBatchFunction ablate::eos::radiationProperties::Sum::GetRadiationPropertiesTemperatureBatchFunction(
+    ablate::eos::radiationProperties::RadiationProperty property, const std::vector<domain::Field> &fields) const {
+    // Create the function
+    auto contextVector = std::make_shared<std::vector<ThermodynamicTemperatureBatchFunction>>();
+    auto function = ThermodynamicTemperatureBatchFunction{.function = SumTemperatureBatchFunction, .context = contextVector};
+
+    // add each contribution using the batch function of each model
+    for (auto &model : models) {
+        contextVector->push_back(model->GetRadiationPropertiesTemperatureBatchFunction(property, fields));
+    }
+
+    return function;
+}
 
 #include "registrar.hpp"
 REGISTER_PASS_THROUGH(ablate::eos::radiationProperties::RadiationModel, ablate::eos::radiationProperties::Sum, "sums the properties of the provided models",
@@ -33,6 +33,12 @@ class Sum : public RadiationModel {
      */
     static PetscErrorCode SumTemperatureFunction(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
 
+    /**
+     * private static function for summing the batch properties of each model
+     */
+    static PetscErrorCode SumTemperatureBatchFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, const PetscReal temperature[], PetscInt temperatureStride,
+                                                      PetscReal property[], PetscInt propertyStride, void* ctx);
+
    public:
     explicit Sum(std::vector<std::shared_ptr<ablate::eos::radiationProperties::RadiationModel>> models);
     explicit Sum(const Sum&) = delete;
@@ -53,6 +59,14 @@ class Sum : public RadiationModel {
      * @return
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetRadiationPropertiesTemperatureFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
+
+    /**
+     * Batch version of the temperature function that sums the batch functions of each model
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicTemperatureBatchFunction GetRadiationPropertiesTemperatureBatchFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
 };
 
 }  // namespace ablate::eos::radiationProperties
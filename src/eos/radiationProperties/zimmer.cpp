@@ -3,6 +3,48 @@
 
 ablate::eos::radiationProperties::Zimmer::Zimmer(std::shared_ptr<eos::EOS> eosIn) : eos(std::move(eosIn)) {}
 
+PetscReal ablate::eos::radiationProperties::Zimmer::ZimmerAbsorptivity(const FunctionContext &functionContext, const PetscReal *conserved, PetscReal temperature, PetscReal density) {
+    if (density == 0) {
+        return 0;
+    }
+
+    /** The Zimmer model uses a fit approximation of the absorptivity. This depends on the presence of four species which are present in combustion and shown below.
+     * The polynomials are evaluated with Horner's method so only the two exponentials are computed for each cell.
+     * */
+    double kappaH2O = 0;
+    double kappaCO2 = 0;
+    const double thetaSurf = temperature / Tsurf;
+    for (int j = 6; j >= 0; j--) {
+        kappaH2O = kappaH2O * thetaSurf + H2O_coeff[j];
+        kappaCO2 = kappaCO2 * thetaSurf + CO2_coeff[j];
+    }
+    kappaH2O = kapparef * PetscPowReal(10, kappaH2O);
+    kappaCO2 = kapparef * PetscPowReal(10, kappaCO2);
+
+    /** Computing the Planck mean absorption coefficient for CH4 and CO
+     * The relationship is different with enough significance to use different models above or below 750 K.
+     * */
+    const auto &CO_coeff = temperature <= 750 ? CO_1_coeff : CO_2_coeff;
+    double kappaCH4 = 0;
+    double kappaCO = 0;
+    for (int j = 4; j >= 0; j--) {
+        kappaCH4 = kappaCH4 * temperature + CH4_coeff[j];
+        kappaCO = kappaCO * temperature + CO_coeff[j];
+    }
+
+    /** The partial pressure of each species is computed from the density mass fraction, the density cancels out of rho*Yi*R*T/MW.
+     * The conditional statement serves to set the partial pressure to zero if the component does not exist in the field.
+     * */
+    const double pressureScale = UGC * temperature / 101325.;
+    const double pCO2 = (functionContext.densityYiCO2Offset == -1) ? 0 : conserved[functionContext.densityYiCO2Offset] * pressureScale / MWCO2;
+    const double pH2O = (functionContext.densityYiH2OOffset == -1) ? 0 : conserved[functionContext.densityYiH2OOffset] * pressureScale / MWH2O;
+    const double pCH4 = (functionContext.densityYiCH4Offset == -1) ? 0 : conserved[functionContext.densityYiCH4Offset] * pressureScale / MWCH4;
+    const double pCO = (functionContext.densityYiCOOffset == -1) ? 0 : conserved[functionContext.densityYiCOOffset] * pressureScale / MWCO;
+
+    /** The resulting absorptivity is an average of species absorptivity weighted by partial pressure. */
+    return pCO2 * kappaCO2 + pH2O * kappaH2O + pCH4 * kappaCH4 + pCO * kappaCO;
+}
+
 PetscErrorCode ablate::eos::radiationProperties::Zimmer::ZimmerFunction(const PetscReal *conserved, PetscReal *kappa, void *ctx) {
     PetscFunctionBeginUser;
 
@@ -10,123 +52,44 @@ PetscErrorCode ablate::eos::radiationProperties::Zimmer::ZimmerFunction(const Pe
     auto functionContext = (FunctionContext *)ctx;
     PetscReal temperature = 0;
     PetscReal density = 0;  //!< Variables to hold information gathered from the fields
-    PetscErrorCode ierr;    //!< Standard PETSc error code returned by PETSc functions
 
-    ierr = functionContext->temperatureFunction.function(conserved, &temperature, functionContext->temperatureFunction.context.get());  //!< Get the temperature value at this location
-    CHKERRQ(ierr);
+    PetscCall(functionContext->temperatureFunction.function(conserved, &temperature, functionContext->temperatureFunction.context.get()));  //!< Get the temperature value at this location
     if (temperature != 0) {
-        ierr = functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get());  //!< Get the density value at this location
-        CHKERRQ(ierr);
-    }
-
-    if (density == 0) {
-        *kappa = 0;
-    } else {
-        /** The Zimmer model uses a fit approximation of the absorptivity. This depends on the presence of four species which are present in combustion and shown below. */
-        double kappaH2O = 0;
-        double kappaCO2 = 0;
-        double kappaCH4 = 0;
-        double kappaCO = 0;
-        double pCO2, pH2O, pCH4, pCO;
-
-        /** Computing the Planck mean absorption coefficient for CO2 and H2O*/
-        for (int j = 0; j < 7; j++) {  // std::array use
-            kappaH2O += H2O_coeff.at(j) * pow(temperature / Tsurf, j);
-            kappaCO2 += CO2_coeff.at(j) * pow(temperature / Tsurf, j);
-        }
-        kappaH2O = kapparef * pow(10, kappaH2O);
-        kappaCO2 = kapparef * pow(10, kappaCO2);
-
-        /** Computing the Planck mean absorption coefficient for CH4 and CO
-         * The relationship is different with enough significance to use different models above or below 750 K.
-         * */
-        for (int j = 0; j < 5; j++) {
-            kappaCH4 += CH4_coeff.at(j) * pow(temperature, j);
-            if (temperature <= 750) {
-                kappaCO += CO_1_coeff.at(j) * pow(temperature, j);
-            } else {
-                kappaCO += CO_2_coeff.at(j) * pow(temperature, j);
-            }
-        }
-
-        /** Get the density mass fractions of the relevant species in order to compute their partial pressures
-         * The conditional statement serves to set the mass fraction value to zero of the component does not exist in the field.
-         * */
-        PetscReal YinH2O = (functionContext->densityYiH2OOffset == -1) ? 0 : conserved[functionContext->densityYiH2OOffset] / density;
-        PetscReal YinCO2 = (functionContext->densityYiCO2Offset == -1) ? 0 : conserved[functionContext->densityYiCO2Offset] / density;
-        PetscReal YinCH4 = (functionContext->densityYiCH4Offset == -1) ? 0 : conserved[functionContext->densityYiCH4Offset] / density;
-        PetscReal YinCO = (functionContext->densityYiCOOffset == -1) ? 0 : conserved[functionContext->densityYiCOOffset] / density;
-
-        /** Computing the partial pressure of each species*/
-        pCO2 = (density * UGC * YinCO2 * temperature) / (MWCO2 * 101325.);
-        pH2O = (density * UGC * YinH2O * temperature) / (MWH2O * 101325.);
-        pCH4 = (density * UGC * YinCH4 * temperature) / (MWCH4 * 101325.);
-        pCO = (density * UGC * YinCO * temperature) / (MWCO * 101325.);
-
-        /** The resulting absorptivity is an average of species absorptivity weighted by partial pressure. */
-        *kappa = pCO2 * kappaCO2 + pH2O * kappaH2O + pCH4 * kappaCH4 + pCO * kappaCO;
+        PetscCall(functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get()));  //!< Get the density value at this location
     }
+    *kappa = ZimmerAbsorptivity(*functionContext, conserved, temperature, density);
     PetscFunctionReturn(0);
 }
+
 PetscErrorCode ablate::eos::radiationProperties::Zimmer::ZimmerTemperatureFunction(const PetscReal *conserved, PetscReal temperature, PetscReal *kappa, void *ctx) {
     PetscFunctionBeginUser;
 
     /** This model depends on mass fraction, temperature, and density in order to predict the absorption properties of the medium. */
     auto functionContext = (FunctionContext *)ctx;
     PetscReal density = 0;  //!< Variables to hold information gathered from the fields
-    PetscErrorCode ierr;    //!< Standard PETSc error code returned by PETSc functions
 
     if (temperature != 0) {
-        ierr = functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get());  //!< Get the density value at this location
-        CHKERRQ(ierr);
+        PetscCall(functionContext->densityFunction.function(conserved, temperature, &density, functionContext->densityFunction.context.get()));  //!< Get the density value at this location
     }
+    *kappa = ZimmerAbsorptivity(*functionContext, conserved, temperature, density);
+    PetscFunctionReturn(0);
+}
 
-    if (density == 0) {
-        *kappa = 0;
-    } else {
-        /** The Zimmer model uses a fit approximation of the absorptivity. This depends on the presence of four species which are present in combustion and shown below. */
-        double kappaH2O = 0;
-        double kappaCO2 = 0;
-        double kappaCH4 = 0;
-        double kappaCO = 0;
-        double pCO2, pH2O, pCH4, pCO;
-
-        /** Computing the Planck mean absorption coefficient for CO2 and H2O*/
-        for (int j = 0; j < 7; j++) {  // std::array use
-            kappaH2O += H2O_coeff.at(j) * pow(temperature / Tsurf, j);
-            kappaCO2 += CO2_coeff.at(j) * pow(temperature / Tsurf, j);
-        }
-        kappaH2O = kapparef * pow(10, kappaH2O);
-        kappaCO2 = kapparef * pow(10, kappaCO2);
-
-        /** Computing the Planck mean absorption coefficient for CH4 and CO
-         * The relationship is different with enough significance to use different models above or below 750 K.
-         * */
-        for (int j = 0; j < 5; j++) {
-            kappaCH4 += CH4_coeff.at(j) * pow(temperature, j);
-            if (temperature <= 750) {
-                kappaCO += CO_1_coeff.at(j) * pow(temperature, j);
-            } else {
-                kappaCO += CO_2_coeff.at(j) * pow(temperature, j);
-            }
+PetscErrorCode ablate::eos::radiationProperties::Zimmer::ZimmerTemperatureBatchFunction(PetscInt n, const PetscReal *conserved, PetscInt conservedStride, const PetscReal *temperature,
+                                                                                       PetscInt temperatureStride, PetscReal *kappa, PetscInt kappaStride, void *ctx) {
+    PetscFunctionBeginUser;
+    auto functionContext = (FunctionContext *)ctx;
+    const auto densityFunction = functionContext->densityFunction.function;
+    void *densityContext = functionContext->densityFunction.context.get();
+
+    for (PetscInt i = 0; i < n; i++) {
+        const PetscReal *pointConserved = conserved + i * conservedStride;
+        const PetscReal pointTemperature = temperature[i * temperatureStride];
+        PetscReal density = 0;
+        if (pointTemperature != 0) {
+            PetscCall(densityFunction(pointConserved, pointTemperature, &density, densityContext));
         }
-
-        /** Get the density mass fractions of the relevant species in order to compute their partial pressures
-         * The conditional statement serves to set the mass fraction value to zero of the component does not exist in the field.
-         * */
-        PetscReal YinH2O = (functionContext->densityYiH2OOffset == -1) ? 0 : conserved[functionContext->densityYiH2OOffset] / density;
-        PetscReal YinCO2 = (functionContext->densityYiCO2Offset == -1) ? 0 : conserved[functionContext->densityYiCO2Offset] / density;
-        PetscReal YinCH4 = (functionContext->densityYiCH4Offset == -1) ? 0 : conserved[functionContext->densityYiCH4Offset] / density;
-        PetscReal YinCO = (functionContext->densityYiCOOffset == -1) ? 0 : conserved[functionContext->densityYiCOOffset] / density;
-
-        /** Computing the partial pressure of each species*/
-        pCO2 = (density * UGC * YinCO2 * temperature) / (MWCO2 * 101325.);
-        pH2O = (density * UGC * YinH2O * temperature) / (MWH2O * 101325.);
-        pCH4 = (density * UGC * YinCH4 * temperature) / (MWCH4 * 101325.);
-        pCO = (density * UGC * YinCO * temperature) / (MWCO * 101325.);
-
-        /** The resulting absorptivity is an average of species absorptivity weighted by partial pressure. */
-        *kappa = pCO2 * kappaCO2 + pH2O * kappaH2O + pCH4 * kappaCH4 + pCO * kappaCO;
+        kappa[i * kappaStride] = ZimmerAbsorptivity(*functionContext, pointConserved, pointTemperature, density);
     }
     PetscFunctionReturn(0);
 }
@@ -207,6 +170,13 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::radiationProperties::
     }
 }
 
+ablate::eos::ThermodynamicTemperatureBatchFunction ablate::eos::radiationProperties::Zimmer::GetRadiationPropertiesTemperatureBatchFunction(RadiationProperty property,
+                                                                                                                                            const std::vector<domain::Field> &fields) const {
+    // the batch function shares the context with the temperature function
+    auto temperatureFunction = GetRadiationPropertiesTemperatureFunction(property, fields);
+    return ThermodynamicTemperatureBatchFunction{.function = ZimmerTemperatureBatchFunction, .context = temperatureFunction.context};
+}
+
 PetscInt ablate::eos::radiationProperties::Zimmer::GetFieldComponentOffset(const std::string &str, const domain::Field &field) const {
     /** Returns the index where a certain field component can be found.
      * The index will be set to -1 if the component does not exist in the field.
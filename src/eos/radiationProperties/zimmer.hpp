@@ -62,6 +62,22 @@ class Zimmer : public RadiationModel {
      */
     static PetscErrorCode ZimmerTemperatureFunction(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
 
+    /**
+     * private static function for evaluating the absorptivity for a batch of points with the temperature
+     */
+    static PetscErrorCode ZimmerTemperatureBatchFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, const PetscReal temperature[], PetscInt temperatureStride,
+                                                         PetscReal property[], PetscInt propertyStride, void* ctx);
+
+    /**
+     * The absorptivity at a single point shared by the point and batch functions.  It only reads the conserved values and does not allocate or throw so that it can be called for every cell
+     * @param functionContext
+     * @param conserved
+     * @param temperature
+     * @param density
+     * @return the absorptivity
+     */
+    static PetscReal ZimmerAbsorptivity(const FunctionContext& functionContext, const PetscReal conserved[], PetscReal temperature, PetscReal density);
+
    public:
     explicit Zimmer(std::shared_ptr<eos::EOS> eosIn);
     explicit Zimmer(const Zimmer&) = delete;
@@ -83,6 +99,14 @@ class Zimmer : public RadiationModel {
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetRadiationPropertiesTemperatureFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
 
+    /**
+     * Batch version of the temperature function that evaluates the absorptivity for a range of cells
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicTemperatureBatchFunction GetRadiationPropertiesTemperatureBatchFunction(RadiationProperty property, const std::vector<domain::Field>& fields) const override;
+
     PetscInt GetFieldComponentOffset(const std::string& str, const domain::Field& field) const;
 };
 
@@ -1,14 +1,18 @@
 #include "tChem.hpp"
 #include <TChem_EnthalpyMass.hpp>
+#include <iomanip>
+#include <sstream>
 #include <utility>
 #include "TChem_SpecificHeatCapacityConsVolumePerMass.hpp"
 #include "TChem_SpecificHeatCapacityPerMass.hpp"
+#include "eos/tChem/mechanismCache.hpp"
 #include "eos/tChem/sensibleInternalEnergy.hpp"
 #include "eos/tChem/sensibleInternalEnergyFcn.hpp"
 #include "eos/tChem/speedOfSound.hpp"
 #include "eos/tChem/temperature.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "monitors/logs/nullLog.hpp"
+#include "environment/fileBroadcast.hpp"
 #include "utilities/kokkosUtilities.hpp"
 #include "utilities/mpiUtilities.hpp"
 
@@ -18,13 +22,17 @@ ablate::eos::TChem::TChem(std::filesystem::path mechanismFileIn, std::filesystem
     // setup/use Kokkos
     ablate::utilities::KokkosUtilities::Initialize();
 
+    // when broadcasting files only the root rank reads the mechanism from the shared file system
+    const auto localMechanismFile = environment::FileBroadcast::Localize(mechanismFile);
+    const auto localThermoFile = thermoFile.empty() ? thermoFile : environment::FileBroadcast::Localize(thermoFile);
+
     // create/parse the kinetic data
-    if (thermoFile.empty()) {
+    if (localThermoFile.empty()) {
         // Create a file to record the output
-        kineticsModel = tChemLib::KineticModelData(mechanismFile.string(), log->GetStream(), log->GetStream());
+        kineticsModel = tChemLib::KineticModelData(localMechanismFile.string(), log->GetStream(), log->GetStream());
     } else {
         // TChem init reads/writes file it can only be done one at a time
-        ablate::utilities::MpiUtilities::RoundRobin(PETSC_COMM_WORLD, [&](int rank) { kineticsModel = tChemLib::KineticModelData(mechanismFile.string(), thermoFile.string()); });
+        ablate::utilities::MpiUtilities::RoundRobin(PETSC_COMM_WORLD, [&](int rank) { kineticsModel = tChemLib::KineticModelData(localMechanismFile.string(), localThermoFile.string()); });
     }
 
     // get the device KineticsModelData
@@ -47,7 +55,32 @@ ablate::eos::TChem::TChem(std::filesystem::path mechanismFileIn, std::filesystem
     // compute the reference enthalpy
     enthalpyReference = real_type_1d_view("reference enthalpy", kineticsModelDataDevice->nSpec);
 
-    {  // manually compute reference enthalpy on the device
+    // the reference enthalpy and optional thermo table are cached by the hash of the mechanism so later runs skip the computation
+    const bool useThermoTable = options && options->Get("thermoTableDeltaTemperature", 0.0) > 0.0;
+    std::unique_ptr<tChem::MechanismCache> mechanismCache;
+    tChem::MechanismCache::Data cachedData;
+    bool cacheHit = false;
+    if (!options || options->Get("mechanismCache", 1)) {
+        std::stringstream cacheOptions;
+        if (useThermoTable) {
+            cacheOptions << std::setprecision(17) << options->Get("thermoTableTemperatureMinimum", 200.0) << ' ' << options->Get("thermoTableTemperatureMaximum", 4000.0) << ' '
+                         << options->Get("thermoTableDeltaTemperature", 0.0) << ' ' << options->Get("thermoTableOrder", 3) << ' ' << options->Get("thermoTableTolerance", 1E-6);
+        }
+        mechanismCache = std::make_unique<tChem::MechanismCache>(mechanismFile, thermoFile, cacheOptions.str());
+        cacheHit = mechanismCache->Load(cachedData) && (ordinal_type)cachedData.enthalpyReference.size() == kineticsModelDataDevice->nSpec && useThermoTable == !cachedData.hi.empty();
+    }
+
+    if (cacheHit) {
+        auto enthalpyReferenceHost = Kokkos::create_mirror_view(enthalpyReference);
+        for (ordinal_type i = 0; i < kineticsModelDataDevice->nSpec; ++i) {
+            enthalpyReferenceHost(i) = cachedData.enthalpyReference[i];
+        }
+        Kokkos::deep_copy(enthalpyReference, enthalpyReferenceHost);
+        if (useThermoTable) {
+            thermoTable = tChem::MechanismCache::CreateThermoTable(cachedData);
+        }
+    } else {
+        // manually compute reference enthalpy on the device
         const auto per_team_extent_h = tChemLib::EnthalpyMass::getWorkSpaceSize(*kineticsModelDataDevice);
         const auto per_team_scratch_h = Scratch<real_type_1d_view>::shmem_size(per_team_extent_h);
         typename tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type policy_enthalpy(1, Kokkos::AUTO());
@@ -70,6 +103,26 @@ ablate::eos::TChem::TChem(std::filesystem::path mechanismFileIn, std::filesystem
 
         // copy to enthalpyReference
         Kokkos::deep_copy(enthalpyReference, Kokkos::subview(perSpeciesDevice, 0, Kokkos::ALL()));
+
+        // optionally tabulate the species enthalpy/cp for the temperature solve
+        if (useThermoTable) {
+            thermoTable = tChem::CreateThermoTable(kineticsModel,
+                                                   options->Get("thermoTableTemperatureMinimum", 200.0),
+                                                   options->Get("thermoTableTemperatureMaximum", 4000.0),
+                                                   options->Get("thermoTableDeltaTemperature", 0.0),
+                                                   options->Get("thermoTableOrder", 3) == 3,
+                                                   options->Get("thermoTableTolerance", 1E-6));
+        }
+
+        if (mechanismCache) {
+            const auto enthalpyReferenceHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), enthalpyReference);
+            cachedData = {};
+            cachedData.enthalpyReference.assign(enthalpyReferenceHost.data(), enthalpyReferenceHost.data() + enthalpyReferenceHost.size());
+            if (useThermoTable) {
+                tChem::MechanismCache::CopyThermoTable(thermoTable, cachedData);
+            }
+            mechanismCache->Store(cachedData);
+        }
     }
 
     // set the chemistry constraints
@@ -128,6 +181,9 @@ std::shared_ptr<ablate::eos::TChem::FunctionContext> ablate::eos::TChem::BuildFu
                                                              // policy
                                                              .policy = policy,
 
+                                                             // optional species enthalpy table
+                                                             .thermoTable = thermoTable,
+
                                                              // kinetics data
                                                              .kineticsModelDataDevice = kineticsModelDataDevice});
 }
@@ -140,6 +196,125 @@ ablate::eos::ThermodynamicTemperatureFunction ablate::eos::TChem::GetThermodynam
     return ThermodynamicTemperatureFunction{.function = std::get<1>(thermodynamicFunctions.at(property)), .context = BuildFunctionContext(property, fields)};
 }
 
+ablate::eos::ThermodynamicBatchFunction ablate::eos::TChem::GetThermodynamicBatchFunction(ablate::eos::ThermodynamicProperty property, const std::vector<domain::Field> &fields) const {
+    // only the properties that require a temperature solve are batched
+    if (property != ThermodynamicProperty::Temperature && property != ThermodynamicProperty::Pressure && property != ThermodynamicProperty::SpeedOfSound &&
+        property != ThermodynamicProperty::SensibleEnthalpy) {
+        return EOS::GetThermodynamicBatchFunction(property, fields);
+    }
+
+    // Look for the euler and densityYi field
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    if (eulerField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::TChem requires the ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD Field");
+    }
+    auto densityYiField = std::find_if(fields.begin(), fields.end(), [](const auto &field) { return field.name == ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD; });
+    if (densityYiField == fields.end()) {
+        throw std::invalid_argument("The ablate::eos::TChem requires the ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD Field");
+    }
+
+    // the same policy is used for the temperature and property kernel so size the scratch for both
+    const auto workSpaceSize = PetscMax(ablate::eos::tChem::Temperature::getWorkSpaceSize(kineticsModelDataDevice->nSpec), std::get<2>(thermodynamicFunctions.at(property))(kineticsModelDataDevice->nSpec));
+
+    return ThermodynamicBatchFunction{.function = BatchFunction,
+                                      .context = std::make_shared<BatchFunctionContext>(BatchFunctionContext{.dim = eulerField->numberComponents - 2,
+                                                                                                             .eulerOffset = eulerField->offset,
+                                                                                                             .densityYiOffset = densityYiField->offset,
+                                                                                                             .property = property,
+                                                                                                             .perTeamScratch = (ordinal_type)tChemLib::Scratch<real_type_1d_view>::shmem_size(workSpaceSize),
+                                                                                                             .enthalpyReference = enthalpyReference,
+                                                                                                             .thermoTable = thermoTable,
+                                                                                                             .kineticsModelDataDevice = kineticsModelDataDevice})};
+}
+
+PetscErrorCode ablate::eos::TChem::BatchFunction(PetscInt n, const PetscReal *conserved, PetscInt conservedStride, PetscReal *property, PetscInt propertyStride, void *ctx) {
+    PetscFunctionBeginUser;
+    auto batchContext = (BatchFunctionContext *)ctx;
+    if (n <= 0) {
+        PetscFunctionReturn(0);
+    }
+    const auto nSpec = batchContext->kineticsModelDataDevice->nSpec;
+
+    // size the views for this batch, the batch size is normally the same cell range for every call
+    if (n != batchContext->capacity) {
+        auto propertyName = std::string(eos::to_string(batchContext->property));
+        batchContext->stateDevice = real_type_2d_view(propertyName + " batch state device", n, tChemLib::Impl::getStateVectorSize(nSpec));
+        batchContext->perSpeciesDevice = real_type_2d_view(propertyName + " batch perSpecies device", n, nSpec);
+        batchContext->mixtureDevice = real_type_1d_view(propertyName + " batch mixture device", n);
+        batchContext->stateHost = Kokkos::create_mirror_view(batchContext->stateDevice);
+        batchContext->mixtureHost = Kokkos::create_mirror_view(batchContext->mixtureDevice);
+        batchContext->capacity = n;
+    }
+    const auto &stateDevice = batchContext->stateDevice;
+    const auto &perSpeciesDevice = batchContext->perSpeciesDevice;
+    const auto &mixtureDevice = batchContext->mixtureDevice;
+    const auto &stateHost = batchContext->stateHost;
+    const auto &mixtureHost = batchContext->mixtureHost;
+
+    // fill the state and internal energy for every point on the host
+    const auto dim = batchContext->dim;
+    const auto eulerOffset = batchContext->eulerOffset;
+    const auto densityYiOffset = batchContext->densityYiOffset;
+    Kokkos::parallel_for(
+        "TChem::BatchFunction::fill", Kokkos::RangePolicy<typename tChemLib::host_exec_space>(0, n), KOKKOS_LAMBDA(const auto i) {
+            const PetscReal *conservedI = conserved + i * conservedStride;
+            PetscReal density = conservedI[eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHO];
+            PetscReal speedSquare = 0.0;
+            for (PetscInt d = 0; d < dim; d++) {
+                speedSquare += PetscSqr(conservedI[eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+            }
+            mixtureHost(i) = conservedI[eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare;
+
+            auto stateVector = Impl::StateVector<real_type_1d_view_host>(nSpec, Kokkos::subview(stateHost, i, Kokkos::ALL()));
+            FillWorkingVectorFromDensityMassFractions(density, 300, conservedI + densityYiOffset, stateVector);
+        });
+    Kokkos::fence();
+    Kokkos::deep_copy(mixtureDevice, mixtureHost);
+    Kokkos::deep_copy(stateDevice, stateHost);
+
+    // compute the temperature for the batch, and then the property
+    auto policy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(n, Kokkos::AUTO());
+    policy.set_scratch_size(1, Kokkos::PerTeam((int)batchContext->perTeamScratch));
+    ablate::eos::tChem::Temperature::runDeviceBatch(policy,
+                                                    stateDevice,
+                                                    mixtureDevice,
+                                                    perSpeciesDevice,
+                                                    batchContext->enthalpyReference,
+                                                    *batchContext->kineticsModelDataDevice,
+                                                    ablate::eos::tChem::Temperature::ordinal_type_1d_view_type(),
+                                                    batchContext->thermoTable);
+
+    switch (batchContext->property) {
+        case ThermodynamicProperty::Pressure:
+            ablate::eos::tChem::Pressure::runDeviceBatch(policy, stateDevice, *batchContext->kineticsModelDataDevice);
+            break;
+        case ThermodynamicProperty::SpeedOfSound:
+            ablate::eos::tChem::SpeedOfSound::runDeviceBatch(policy, stateDevice, mixtureDevice, *batchContext->kineticsModelDataDevice);
+            break;
+        case ThermodynamicProperty::SensibleEnthalpy:
+            ablate::eos::tChem::SensibleEnthalpy::runDeviceBatch(policy, stateDevice, mixtureDevice, perSpeciesDevice, batchContext->enthalpyReference, *batchContext->kineticsModelDataDevice);
+            break;
+        default:
+            break;
+    }
+
+    // copy back the results
+    if (batchContext->property == ThermodynamicProperty::SpeedOfSound || batchContext->property == ThermodynamicProperty::SensibleEnthalpy) {
+        Kokkos::deep_copy(mixtureHost, mixtureDevice);
+        for (PetscInt i = 0; i < n; i++) {
+            property[i * propertyStride] = mixtureHost(i);
+        }
+    } else {
+        Kokkos::deep_copy(stateHost, stateDevice);
+        for (PetscInt i = 0; i < n; i++) {
+            auto stateVector = Impl::StateVector<real_type_1d_view_host>(nSpec, Kokkos::subview(stateHost, i, Kokkos::ALL()));
+            property[i * propertyStride] = batchContext->property == ThermodynamicProperty::Pressure ? stateVector.Pressure() : stateVector.Temperature();
+        }
+    }
+
+    PetscFunctionReturn(0);
+}
+
 ablate::eos::TChem::ThermodynamicMassFractionFunction ablate::eos::TChem::GetThermodynamicMassFractionFunction(ablate::eos::ThermodynamicProperty property,
                                                                                                                const std::vector<domain::Field> &fields) const {
     return ThermodynamicMassFractionFunction{.function = std::get<0>(thermodynamicMassFractionFunctions.at(property)), .context = BuildFunctionContext(property, fields, false)};
@@ -213,7 +388,9 @@ PetscErrorCode ablate::eos::TChem::TemperatureTemperatureFunction(const PetscRea
                                                     functionContext->mixtureDevice,
                                                     functionContext->perSpeciesDevice,
                                                     functionContext->enthalpyReference,
-                                                    *functionContext->kineticsModelDataDevice);
+                                                    *functionContext->kineticsModelDataDevice,
+                                                    ablate::eos::tChem::Temperature::ordinal_type_1d_view_type(),
+                                                    functionContext->thermoTable);
 
     // copy back the results
     Kokkos::deep_copy(functionContext->stateHost, functionContext->stateDevice);
@@ -250,7 +427,9 @@ PetscErrorCode ablate::eos::TChem::TemperatureTemperatureMassFractionFunction(co
                                                     functionContext->mixtureDevice,
                                                     functionContext->perSpeciesDevice,
                                                     functionContext->enthalpyReference,
-                                                    *functionContext->kineticsModelDataDevice);
+                                                    *functionContext->kineticsModelDataDevice,
+                                                    ablate::eos::tChem::Temperature::ordinal_type_1d_view_type(),
+                                                    functionContext->thermoTable);
 
     // copy back the results
     Kokkos::deep_copy(functionContext->stateHost, functionContext->stateDevice);
@@ -1059,4 +1238,9 @@ REGISTER(ablate::eos::ChemistryModel, ablate::eos::TChem, "[TChemV2](https://git
          OPT(ablate::monitors::logs::Log, "log", "An optional log for TChem echo output (only used with yaml input)"),
          OPT(ablate::parameters::Parameters, "options",
              "time stepping options (dtMin, dtMax, dtDefault, dtEstimateFactor, relToleranceTime, relToleranceTime, absToleranceTime, relToleranceNewton, absToleranceNewton, maxNumNewtonIterations, "
-             "numTimeIterationsPerInterval, jacobianInterval, maxAttempts, thresholdTemperature)"));
+             "numTimeIterationsPerInterval, jacobianInterval, maxAttempts, thresholdTemperature), cell skipping options (frozenTolerance, fuelSpecies, oxidizerSpecies, minimumReactantMassFraction), "
+             "chemistry load balancing options (loadBalance (0 or 1), loadBalanceTolerance), dynamic adaptive chemistry options for yaml mechanisms (dacTolerance, dacTargetSpecies, "
+             "dacTemperatureBin, dacLogBin, dacMaxModels, dacCacheSize) and optional species enthalpy table options (thermoTableDeltaTemperature, "
+             "thermoTableTemperatureMinimum, thermoTableTemperatureMaximum, thermoTableOrder (1 or 3), thermoTableTolerance), mechanismCache (0 or 1, default 1) to cache the reference "
+             "enthalpy and thermo table in $ABLATE_MECHANISM_CACHE, and ratePlugin, a shared library with generated net production rate kernels used for the implicit "
+             "chemistry source and jacobian"));
@@ -13,6 +13,7 @@
 #include "eos/tChem/sourceCalculator.hpp"
 #include "eos/tChem/speedOfSound.hpp"
 #include "eos/tChem/temperature.hpp"
+#include "eos/tChem/thermoTable.hpp"
 #include "monitors/logs/log.hpp"
 #include "parameters/parameters.hpp"
 #include "utilities/intErrorChecker.hpp"
@@ -73,6 +74,11 @@ class TChem : public ChemistryModel, public std::enable_shared_from_this<ablate:
      */
     real_type_1d_view enthalpyReference;
 
+    /**
+     * The optional table of species enthalpy/cp used in place of the NASA polynomials for the temperature solve
+     */
+    tChem::ThermoTable<typename Tines::UseThisDevice<exec_space>::type> thermoTable;
+
    public:
     /**
      * The tChem EOS can utzlie either a mechanical & thermo file using the Chemkin file format for a modern yaml file.
@@ -98,6 +104,15 @@ class TChem : public ChemistryModel, public std::enable_shared_from_this<ablate:
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetThermodynamicTemperatureFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
 
+    /**
+     * Single function to produce a batch thermodynamic function for any property based upon the available fields.  Temperature, pressure, speed of sound and sensible enthalpy fill the
+     * state for every point and launch a single kernel over the batch, all other properties call the single point function.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicBatchFunction GetThermodynamicBatchFunction(ThermodynamicProperty property, const std::vector<domain::Field>& fields) const override;
+
     /**
      * Single function to produce thermodynamic function for any property based upon the available fields and yi
      * @param property
@@ -153,6 +168,12 @@ class TChem : public ChemistryModel, public std::enable_shared_from_this<ablate:
      */
     [[nodiscard]] std::map<std::string, double> GetSpeciesMolecularMass() const;
 
+    /**
+     * the mechanism file used to create this eos
+     * @return
+     */
+    [[nodiscard]] const std::filesystem::path& GetMechanismFile() const { return mechanismFile; }
+
     /**
      * Print the details of this eos
      * @param stream
@@ -169,6 +190,11 @@ class TChem : public ChemistryModel, public std::enable_shared_from_this<ablate:
      */
     real_type_1d_view GetEnthalpyOfFormation() { return enthalpyReference; };
 
+    /**
+     * Get the optional species enthalpy table, the table is empty if not enabled
+     */
+    [[nodiscard]] const tChem::ThermoTable<typename Tines::UseThisDevice<exec_space>::type>& GetThermoTable() const { return thermoTable; }
+
     /**
      * Function to create the batch source specific to the provided cell range
      * @param fields
@@ -204,10 +230,65 @@ class TChem : public ChemistryModel, public std::enable_shared_from_this<ablate:
         //! the kokkos team policy for this function
         tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type policy;
 
+        //! the optional species enthalpy table
+        tChem::ThermoTable<typename Tines::UseThisDevice<exec_space>::type> thermoTable;
+
         //! the kinetics data
         std::shared_ptr<tChemLib::KineticModelGasConstData<typename Tines::UseThisDevice<exec_space>::type>> kineticsModelDataDevice;
     };
 
+    /**
+     * The context for the batch functions, the device/host views are resized when the batch size changes
+     */
+    struct BatchFunctionContext {
+        // memory access locations for fields
+        PetscInt dim;
+        PetscInt eulerOffset;
+        PetscInt densityYiOffset;
+
+        //! the property computed by this batch
+        ThermodynamicProperty property;
+
+        //! the scratch size needed per team
+        ordinal_type perTeamScratch;
+
+        //! the number of points the views are sized for
+        PetscInt capacity = 0;
+
+        //! per point state
+        real_type_2d_view stateDevice;
+        //! per point/species array
+        real_type_2d_view perSpeciesDevice;
+        //! per point mixture value
+        real_type_1d_view mixtureDevice;
+
+        //! per point state
+        real_type_2d_view stateHost;
+        //! per point mixture value
+        real_type_1d_view mixtureHost;
+
+        //! store the enthalpyReferencePerSpecies
+        real_type_1d_view enthalpyReference;
+
+        //! the optional species enthalpy table
+        tChem::ThermoTable<typename Tines::UseThisDevice<exec_space>::type> thermoTable;
+
+        //! the kinetics data
+        std::shared_ptr<tChemLib::KineticModelGasConstData<typename Tines::UseThisDevice<exec_space>::type>> kineticsModelDataDevice;
+    };
+
+    /**
+     * Compute temperature and then the requested property for every point in the batch
+     * @param n
+     * @param conserved
+     * @param conservedStride
+     * @param property
+     * @param propertyStride
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode BatchFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, PetscReal property[], PetscInt propertyStride, void* ctx);
+
     /**
      * helper function to build the function context needed regardless of function type
      * @tparam Function
@@ -0,0 +1,233 @@
+#include "dynamicAdaptiveChemistry.hpp"
+#include <TChem_RateOfProgress.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include "eos/tChem.hpp"
+#include "utilities/mpiError.hpp"
+
+ablate::eos::tChem::DynamicAdaptiveChemistry::DynamicAdaptiveChemistry(const std::shared_ptr<eos::TChem>& eos, Options optionsIn) : options(std::move(optionsIn)) {
+    // the reduced models are created by dropping reactions from the yaml mechanism
+    const auto& mechanismFile = eos->GetMechanismFile();
+    if (mechanismFile.extension() != ".yaml" && mechanismFile.extension() != ".yml") {
+        throw std::invalid_argument("ablate::eos::tChem::DynamicAdaptiveChemistry requires a yaml mechanism file, " + mechanismFile.string() + " was provided");
+    }
+    mechanism = YAML::LoadFile(mechanismFile.string());
+    if (!mechanism["reactions"] || !mechanism["reactions"].IsSequence()) {
+        throw std::invalid_argument("ablate::eos::tChem::DynamicAdaptiveChemistry requires a reactions list in " + mechanismFile.string());
+    }
+
+    // get the full kinetic model on the host and device
+    kineticModelDevice = tChemLib::createGasKineticModelConstData<device_type>(eos->GetKineticModelData());
+    auto kineticModelHost = tChemLib::createGasKineticModelConstData<typename Tines::UseThisDevice<host_exec_space>::type>(eos->GetKineticModelData());
+    numberSpecies = kineticModelHost.nSpec;
+    numberReactions = kineticModelHost.nReac;
+    if ((std::size_t)numberReactions != mechanism["reactions"].size()) {
+        throw std::invalid_argument("ablate::eos::tChem::DynamicAdaptiveChemistry expects the reactions in " + mechanismFile.string() + " to match the kinetic model");
+    }
+
+    // map the target species to their index
+    const auto& species = eos->GetSpeciesVariables();
+    for (const auto& name : options.targetSpecies) {
+        auto speciesIt = std::find(species.begin(), species.end(), name);
+        if (speciesIt == species.end()) {
+            throw std::invalid_argument("ablate::eos::tChem::DynamicAdaptiveChemistry cannot locate the target species " + name);
+        }
+        targetSpeciesIndices.push_back((ordinal_type)std::distance(species.begin(), speciesIt));
+    }
+    if (targetSpeciesIndices.empty()) {
+        throw std::invalid_argument("ablate::eos::tChem::DynamicAdaptiveChemistry requires at least one target species");
+    }
+
+    // build the species/reaction graph from the stoichiometry, the products are stored in the second half of reacSidx
+    reactionSpecies.resize(numberReactions);
+    speciesReactions.resize(numberSpecies);
+    const ordinal_type productOffset = (ordinal_type)kineticModelHost.reacSidx.extent(1) / 2;
+    for (ordinal_type r = 0; r < numberReactions; ++r) {
+        std::map<ordinal_type, real_type> netCoefficients;
+        for (ordinal_type j = 0; j < kineticModelHost.reacNreac(r); ++j) {
+            netCoefficients[kineticModelHost.reacSidx(r, j)] -= PetscAbs(kineticModelHost.reacNuki(r, j));
+        }
+        for (ordinal_type j = 0; j < kineticModelHost.reacNprod(r); ++j) {
+            netCoefficients[kineticModelHost.reacSidx(r, j + productOffset)] += PetscAbs(kineticModelHost.reacNuki(r, j + productOffset));
+        }
+        for (const auto& [s, coefficient] : netCoefficients) {
+            reactionSpecies[r].emplace_back(s, coefficient);
+            speciesReactions[s].push_back(r);
+        }
+    }
+}
+
+std::vector<int> ablate::eos::tChem::DynamicAdaptiveChemistry::ClusterKey(const real_type_1d_view_host& state) const {
+    Impl::StateVector<real_type_1d_view_host> stateVector(numberSpecies, state);
+    const auto ys = stateVector.MassFractions();
+
+    std::vector<int> key;
+    key.reserve(2 + targetSpeciesIndices.size());
+    key.push_back((int)PetscFloorReal(stateVector.Temperature() / options.temperatureBin));
+    key.push_back((int)PetscFloorReal(PetscLog10Real(PetscMax(stateVector.Pressure(), PETSC_SMALL)) / options.logBin));
+    for (const auto& t : targetSpeciesIndices) {
+        key.push_back((int)PetscFloorReal(PetscLog10Real(PetscMax(ys(t), 1.0E-20)) / options.logBin));
+    }
+    return key;
+}
+
+std::vector<char> ablate::eos::tChem::DynamicAdaptiveChemistry::ReactionMask(const real_type_1d_view_host& ropForward, const real_type_1d_view_host& ropReverse) const {
+    // start the search from the target species
+    std::vector<char> keepSpecies(numberSpecies, 0);
+    std::vector<ordinal_type> searchSpecies(targetSpeciesIndices.begin(), targetSpeciesIndices.end());
+    for (const auto& t : targetSpeciesIndices) {
+        keepSpecies[t] = 1;
+    }
+
+    // keep every species B with r_AB > tolerance for a kept species A
+    std::vector<real_type> interaction(numberSpecies);
+    while (!searchSpecies.empty()) {
+        const ordinal_type a = searchSpecies.back();
+        searchSpecies.pop_back();
+
+        std::fill(interaction.begin(), interaction.end(), 0.0);
+        real_type total = 0.0;
+        for (const auto& r : speciesReactions[a]) {
+            const auto& speciesInReaction = reactionSpecies[r];
+            const auto coefficient = std::find_if(speciesInReaction.begin(), speciesInReaction.end(), [a](const auto& pair) { return pair.first == a; })->second;
+            const real_type contribution = PetscAbs(coefficient * (ropForward(r) - ropReverse(r)));
+            total += contribution;
+            for (const auto& [b, unused] : speciesInReaction) {
+                interaction[b] += contribution;
+            }
+        }
+        if (total <= 0.0) {
+            continue;
+        }
+        for (const auto& r : speciesReactions[a]) {
+            for (const auto& [b, unused] : reactionSpecies[r]) {
+                if (!keepSpecies[b] && interaction[b] / total > options.tolerance) {
+                    keepSpecies[b] = 1;
+                    searchSpecies.push_back(b);
+                }
+            }
+        }
+    }
+
+    // only keep the reactions where every species is kept
+    std::vector<char> mask(numberReactions, 1);
+    for (ordinal_type r = 0; r < numberReactions; ++r) {
+        for (const auto& [s, unused] : reactionSpecies[r]) {
+            if (!keepSpecies[s]) {
+                mask[r] = 0;
+                break;
+            }
+        }
+    }
+    return mask;
+}
+
+int ablate::eos::tChem::DynamicAdaptiveChemistry::GetReducedModel(const std::vector<char>& mask) {
+    // use the full model if nothing or everything is removed
+    const auto numberKept = (ordinal_type)std::count(mask.begin(), mask.end(), 1);
+    if (numberKept == 0 || numberKept == numberReactions) {
+        return -1;
+    }
+
+    // check for an existing model
+    if (auto modelIt = reducedModelIndex.find(mask); modelIt != reducedModelIndex.end()) {
+        return modelIt->second;
+    }
+    if ((int)reducedModels.size() >= options.maxModels) {
+        return -1;
+    }
+
+    // copy the mechanism with only the kept reactions
+    YAML::Node reducedMechanism = YAML::Clone(mechanism);
+    YAML::Node reactions(YAML::NodeType::Sequence);
+    for (ordinal_type r = 0; r < numberReactions; ++r) {
+        if (mask[r]) {
+            reactions.push_back(YAML::Clone(mechanism["reactions"][r]));
+        }
+    }
+    reducedMechanism["reactions"] = reactions;
+
+    // tChem can only parse the mechanism from a file
+    PetscMPIInt rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> checkMpiError;
+    const auto reducedMechanismFile = std::filesystem::temp_directory_path() / ("ablateDynamicAdaptiveChemistry." + std::to_string(rank) + "." +
+                                                                                std::to_string(reinterpret_cast<std::uintptr_t>(this)) + "." + std::to_string(reducedModels.size()) + ".yaml");
+    {
+        std::ofstream reducedMechanismStream(reducedMechanismFile);
+        reducedMechanismStream << reducedMechanism;
+    }
+
+    ReducedModel reducedModel;
+    std::stringstream tChemLog;
+    reducedModel.kineticModelData = tChemLib::KineticModelData(reducedMechanismFile.string(), tChemLog, tChemLog);
+    reducedModel.kineticModelDevice = tChemLib::createGasKineticModelConstData<device_type>(reducedModel.kineticModelData);
+    std::filesystem::remove(reducedMechanismFile);
+
+    reducedModels.push_back(std::move(reducedModel));
+    const int index = (int)reducedModels.size() - 1;
+    reducedModelIndex[mask] = index;
+    return index;
+}
+
+void ablate::eos::tChem::DynamicAdaptiveChemistry::SelectKineticModels(const real_type_2d_view& state, std::size_t numberRows, kinetic_model_view& kineticModels) {
+    numberCacheHits = 0;
+    averageNumberReactions = 0.0;
+    if (kineticModels.extent(0) < numberRows) {
+        kineticModels = kinetic_model_view("dynamicAdaptiveChemistryKineticModels", numberRows);
+    }
+    if (numberRows == 0) {
+        return;
+    }
+
+    // look up the cluster of each row
+    auto stateHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), state);
+    std::vector<int> rowModel(numberRows, -1);
+    std::vector<std::size_t> missedRows;
+    std::vector<std::vector<int>> missedKeys;
+    for (std::size_t row = 0; row < numberRows; ++row) {
+        auto key = ClusterKey(Kokkos::subview(stateHost, row, Kokkos::ALL()));
+        if (auto clusterIt = clusterCache.find(key); clusterIt != clusterCache.end()) {
+            rowModel[row] = clusterIt->second;
+            numberCacheHits++;
+        } else {
+            missedRows.push_back(row);
+            missedKeys.push_back(std::move(key));
+        }
+    }
+
+    // compute the reduction for the rows that are not in the cache
+    if (!missedRows.empty()) {
+        if (ropForwardDevice.extent(0) < numberRows) {
+            ropForwardDevice = real_type_2d_view("ropForwardDevice", numberRows, numberReactions);
+            ropReverseDevice = real_type_2d_view("ropReverseDevice", numberRows, numberReactions);
+        }
+        auto ropPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberRows, Kokkos::AUTO());
+        ropPolicy.set_scratch_size(1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::RateOfProgress::getWorkSpaceSize(kineticModelDevice))));
+        ::tChemLib::RateOfProgress::runDeviceBatch(ropPolicy, state, ropForwardDevice, ropReverseDevice, kineticModelDevice);
+        auto ropForwardHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ropForwardDevice);
+        auto ropReverseHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), ropReverseDevice);
+
+        if (clusterCache.size() + missedRows.size() > (std::size_t)options.cacheSize) {
+            clusterCache.clear();
+        }
+        for (std::size_t m = 0; m < missedRows.size(); ++m) {
+            const auto row = missedRows[m];
+            const auto mask = ReactionMask(Kokkos::subview(ropForwardHost, row, Kokkos::ALL()), Kokkos::subview(ropReverseHost, row, Kokkos::ALL()));
+            rowModel[row] = GetReducedModel(mask);
+            clusterCache[missedKeys[m]] = rowModel[row];
+        }
+    }
+
+    // copy the selected model for each row to the device
+    auto kineticModelsHost = Kokkos::create_mirror_view(kineticModels);
+    for (std::size_t row = 0; row < numberRows; ++row) {
+        const auto& kineticModel = rowModel[row] < 0 ? kineticModelDevice : reducedModels[rowModel[row]].kineticModelDevice;
+        kineticModelsHost(row) = kineticModel;
+        averageNumberReactions += kineticModel.nReac;
+    }
+    Kokkos::deep_copy(kineticModels, kineticModelsHost);
+    averageNumberReactions /= (real_type)numberRows;
+}
@@ -0,0 +1,142 @@
+#ifndef ABLATELIBRARY_TCHEM_DYNAMICADAPTIVECHEMISTRY_HPP
+#define ABLATELIBRARY_TCHEM_DYNAMICADAPTIVECHEMISTRY_HPP
+
+#include <yaml-cpp/yaml.h>
+#include <TChem_KineticModelGasConstData.hpp>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "TChem_KineticModelData.hpp"
+#include "TChem_Util.hpp"
+
+namespace tChemLib = TChem;
+
+namespace ablate::eos {
+class TChem;
+}
+
+namespace ablate::eos::tChem {
+
+/**
+ * Dynamic adaptive chemistry using the directed relation graph (DRG).  For each state the direct interaction coefficient
+ *      r_AB = sum_i |nu_Ai w_i delta_Bi| / sum_i |nu_Ai w_i|
+ * is computed from the net rates of progress w_i and the species reachable from the target species through r_AB > tolerance are kept.  Only the reactions between kept species
+ * are integrated.  States are clustered by the binned temperature, pressure, and target species mass fractions and each cluster reuses the reduction.  Identical reductions share a
+ * single reduced kinetic model that is built from the yaml mechanism file with the removed reactions dropped, so the species (and state vector) are not changed.
+ */
+class DynamicAdaptiveChemistry {
+   public:
+    using device_type = typename Tines::UseThisDevice<exec_space>::type;
+    using kinetic_model_view = Kokkos::View<tChemLib::KineticModelConstData<device_type>*, device_type>;
+
+    //! the reduction options
+    struct Options {
+        //! the DRG tolerance used to keep species
+        double tolerance = 1.0E-2;
+        //! the species that must be accurately predicted
+        std::vector<std::string> targetSpecies;
+        //! the temperature bin size (K) used to cluster states
+        double temperatureBin = 25.0;
+        //! the log10 bin size used to cluster the pressure and target species mass fractions
+        double logBin = 0.25;
+        //! the maximum number of reduced kinetic models, once reached new reductions use the full model
+        int maxModels = 64;
+        //! the maximum number of clusters stored before the cluster cache is cleared
+        int cacheSize = 10000;
+    };
+
+   private:
+    //! the reduction options
+    const Options options;
+
+    //! the full kinetic model on the device used for the rates of progress and rows that cannot be reduced
+    tChemLib::KineticModelConstData<device_type> kineticModelDevice;
+
+    //! the number of species and reactions in the full mechanism
+    ordinal_type numberSpecies;
+    ordinal_type numberReactions;
+
+    //! the index of each target species
+    std::vector<ordinal_type> targetSpeciesIndices;
+
+    //! the species (index, net stoichiometric coefficient) in each reaction
+    std::vector<std::vector<std::pair<ordinal_type, real_type>>> reactionSpecies;
+
+    //! the reactions each species participates in
+    std::vector<std::vector<ordinal_type>> speciesReactions;
+
+    //! the yaml mechanism used to create the reduced models
+    YAML::Node mechanism;
+
+    //! a reduced kinetic model, the kinetic model data must be held because the const data does not own its memory
+    struct ReducedModel {
+        tChemLib::KineticModelData kineticModelData;
+        tChemLib::KineticModelConstData<device_type> kineticModelDevice;
+    };
+    std::vector<ReducedModel> reducedModels;
+
+    //! map from the reaction mask to the reduced model index (-1 is the full model)
+    std::map<std::vector<char>, int> reducedModelIndex;
+
+    //! map from the cluster key to the reduced model index
+    std::map<std::vector<int>, int> clusterCache;
+
+    //! the rates of progress scratch for each row
+    real_type_2d_view ropForwardDevice;
+    real_type_2d_view ropReverseDevice;
+
+    //! statistics from the last call to SelectKineticModels
+    std::size_t numberCacheHits = 0;
+    real_type averageNumberReactions = 0.0;
+
+    /**
+     * compute the cluster key for a state
+     */
+    [[nodiscard]] std::vector<int> ClusterKey(const real_type_1d_view_host& state) const;
+
+    /**
+     * compute the DRG reaction mask from the rates of progress at a state
+     */
+    [[nodiscard]] std::vector<char> ReactionMask(const real_type_1d_view_host& ropForward, const real_type_1d_view_host& ropReverse) const;
+
+    /**
+     * get or create the reduced model for the reaction mask, returns -1 for the full model
+     */
+    int GetReducedModel(const std::vector<char>& mask);
+
+   public:
+    /**
+     * Create the reduction for the yaml based tChem mechanism
+     * @param eos
+     * @param options
+     */
+    DynamicAdaptiveChemistry(const std::shared_ptr<eos::TChem>& eos, Options options);
+
+    /**
+     * Select the (reduced) kinetic model used to integrate each row of the state
+     * @param state the state (temperature, pressure, density, and mass fractions must be computed) for each row
+     * @param numberRows the number of rows in the state to reduce
+     * @param kineticModels the kinetic model for each row, resized to hold numberRows
+     */
+    void SelectKineticModels(const real_type_2d_view& state, std::size_t numberRows, kinetic_model_view& kineticModels);
+
+    /**
+     * The number of reduced models that have been created
+     */
+    [[nodiscard]] inline std::size_t GetNumberReducedModels() const { return reducedModels.size(); }
+
+    /**
+     * The number of rows in the last call to SelectKineticModels that were found in the cluster cache
+     */
+    [[nodiscard]] inline std::size_t GetNumberCacheHits() const { return numberCacheHits; }
+
+    /**
+     * The average number of reactions integrated per row in the last call to SelectKineticModels
+     */
+    [[nodiscard]] inline real_type GetAverageNumberReactions() const { return averageNumberReactions; }
+};
+
+}  // namespace ablate::eos::tChem
+#endif  // ABLATELIBRARY_TCHEM_DYNAMICADAPTIVECHEMISTRY_HPP
@@ -45,7 +45,7 @@ struct IgnitionZeroDTemperatureThreshold {
         const Tines::value_type_1d_view<real_type, DeviceType>& t_out, const Tines::value_type_1d_view<real_type, DeviceType>& dt_out,
         const Tines::value_type_2d_view<real_type, DeviceType>& state_out,
         /// const data from kinetic model
-        const Tines::value_type_1d_view<KineticModelConstData<DeviceType>, DeviceType>& kmcds, double thresholdTemperature) {
+        const Tines::value_type_1d_view<KineticModelConstData<DeviceType>, DeviceType>& kmcds, double thresholdTemperature, ordinal_type workSpaceSize) {
         Kokkos::Profiling::pushRegion(profile_name);
         using policy_type = PolicyType;
 
@@ -55,7 +55,8 @@ struct IgnitionZeroDTemperatureThreshold {
         auto kmcd_host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Kokkos::subview(kmcds, 0));
 
         const ordinal_type level = 1;
-        const ordinal_type per_team_extent = IgnitionZeroD::getWorkSpaceSize(kmcd_host());
+        // the work space size can be provided when the kinetic models differ between samples
+        const ordinal_type per_team_extent = workSpaceSize > 0 ? workSpaceSize : IgnitionZeroD::getWorkSpaceSize(kmcd_host());
 
         Kokkos::parallel_for(
             profile_name, policy, KOKKOS_LAMBDA(const typename policy_type::member_type& member) {
@@ -159,6 +160,7 @@ struct IgnitionZeroDTemperatureThreshold {
     /// t_out - time when this code exits
     /// state_out - final condition of the state vector (the same input state can
     /// be overwritten) kmcd - const data for kinetic model
+    /// workSpaceSize - optional work space size, required if the kinetic models are not the same size (i.e. reduced models)
     static void runDeviceBatch(  /// thread block size
         typename UseThisTeamPolicy<exec_space>::type& policy,
         /// global tolerence parameters that governs all samples
@@ -168,11 +170,11 @@ struct IgnitionZeroDTemperatureThreshold {
         /// output
         const real_type_1d_view& t_out, const real_type_1d_view& dt_out, const real_type_2d_view& state_out,
         /// const data from kinetic model
-        const Tines::value_type_1d_view<KineticModelConstData<interf_device_type>, interf_device_type>& kmcds, double thresholdTemperature) {
+        const Tines::value_type_1d_view<KineticModelConstData<interf_device_type>, interf_device_type>& kmcds, double thresholdTemperature, ordinal_type workSpaceSize = 0) {
         const std::string profile_name = "ablate::eos::tChem::IgnitionZeroDTemperatureThreshold::runDeviceBatch::kmcd array";
         using value_type = real_type;
 
-        IgnitionZeroDTemperatureThreshold_TemplateRun(profile_name, value_type(), policy, tol_newton, tol_time, fac, tadv, state, t_out, dt_out, state_out, kmcds, thresholdTemperature);
+        IgnitionZeroDTemperatureThreshold_TemplateRun(profile_name, value_type(), policy, tol_newton, tol_time, fac, tadv, state, t_out, dt_out, state_out, kmcds, thresholdTemperature, workSpaceSize);
     }
 };
 
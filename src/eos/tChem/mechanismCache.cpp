@@ -0,0 +1,186 @@
+#include "mechanismCache.hpp"
+#include <unistd.h>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "utilities/mpiError.hpp"
+#include "utilities/stringUtilities.hpp"
+
+namespace {
+//! identifies the cache file format
+constexpr char cacheMagic[] = "ablateTChemMechanismCache";
+
+/**
+ * append the raw bytes of a value or array to the buffer
+ */
+template <typename T>
+void Write(std::string& buffer, const T* values, std::size_t count) {
+    buffer.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+}
+
+/**
+ * read the raw bytes of an array from the buffer, returns false if the buffer is too short
+ */
+template <typename T>
+bool Read(const std::string& buffer, std::size_t& offset, T* values, std::size_t count) {
+    if (offset + count * sizeof(T) > buffer.size()) {
+        return false;
+    }
+    std::memcpy(values, buffer.data() + offset, count * sizeof(T));
+    offset += count * sizeof(T);
+    return true;
+}
+
+std::string ReadFile(const std::filesystem::path& path) {
+    std::ifstream stream(path, std::ios::binary);
+    std::stringstream contents;
+    contents << stream.rdbuf();
+    return contents.str();
+}
+}  // namespace
+
+ablate::eos::tChem::MechanismCache::MechanismCache(const std::filesystem::path& mechanismFile, const std::filesystem::path& thermoFile, const std::string& options, MPI_Comm comm)
+    : comm(comm) {
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    // only the root rank reads the mechanism to compute the key
+    if (rank == 0) {
+        std::string keySource = ReadFile(mechanismFile);
+        keySource += '\0';
+        if (!thermoFile.empty()) {
+            keySource += ReadFile(thermoFile);
+        }
+        keySource += '\0' + options + '\0' + std::to_string(version) + '\0' + std::to_string(sizeof(real_type));
+
+        cachePath = GetCacheDirectory() / (mechanismFile.stem().string() + "." + ablate::utilities::StringUtilities::Hash(keySource) + ".bin");
+    }
+}
+
+std::filesystem::path ablate::eos::tChem::MechanismCache::GetCacheDirectory() {
+    if (const char* cacheDirectory = std::getenv("ABLATE_MECHANISM_CACHE")) {
+        return cacheDirectory;
+    }
+    return std::filesystem::temp_directory_path() / "ablateMechanismCache";
+}
+
+bool ablate::eos::tChem::MechanismCache::Load(Data& data) const {
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    // read the complete file on the root rank and share it
+    std::string buffer;
+    if (rank == 0 && std::filesystem::exists(cachePath)) {
+        buffer = ReadFile(cachePath);
+    }
+    unsigned long long size = buffer.size();
+    MPI_Bcast(&size, 1, MPI_UNSIGNED_LONG_LONG, 0, comm) >> checkMpiError;
+    if (size == 0 || size > INT_MAX) {
+        return false;
+    }
+    buffer.resize(size);
+    MPI_Bcast(buffer.data(), (int)size, MPI_CHAR, 0, comm) >> checkMpiError;
+
+    // every rank parses the same buffer so they all agree on the result
+    std::size_t offset = 0;
+    char magic[sizeof(cacheMagic)];
+    int fileVersion;
+    unsigned long long numberSpecies, tableSize;
+    if (!Read(buffer, offset, magic, sizeof(magic)) || std::memcmp(magic, cacheMagic, sizeof(magic)) != 0 || !Read(buffer, offset, &fileVersion, 1) || fileVersion != version ||
+        !Read(buffer, offset, &numberSpecies, 1)) {
+        return false;
+    }
+    data.enthalpyReference.resize(numberSpecies);
+    if (!Read(buffer, offset, data.enthalpyReference.data(), numberSpecies) || !Read(buffer, offset, &data.temperatureMinimum, 1) || !Read(buffer, offset, &data.temperatureMaximum, 1) ||
+        !Read(buffer, offset, &data.deltaTemperature, 1) || !Read(buffer, offset, &data.cubic, 1) || !Read(buffer, offset, &tableSize, 1)) {
+        return false;
+    }
+    data.hi.resize(tableSize);
+    data.cpi.resize(tableSize);
+    return Read(buffer, offset, data.hi.data(), tableSize) && Read(buffer, offset, data.cpi.data(), tableSize) && offset == buffer.size();
+}
+
+void ablate::eos::tChem::MechanismCache::Store(const Data& data) const {
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+    if (rank != 0) {
+        return;
+    }
+
+    std::string buffer;
+    const unsigned long long numberSpecies = data.enthalpyReference.size();
+    const unsigned long long tableSize = data.hi.size();
+    Write(buffer, cacheMagic, sizeof(cacheMagic));
+    Write(buffer, &version, 1);
+    Write(buffer, &numberSpecies, 1);
+    Write(buffer, data.enthalpyReference.data(), numberSpecies);
+    Write(buffer, &data.temperatureMinimum, 1);
+    Write(buffer, &data.temperatureMaximum, 1);
+    Write(buffer, &data.deltaTemperature, 1);
+    Write(buffer, &data.cubic, 1);
+    Write(buffer, &tableSize, 1);
+    Write(buffer, data.hi.data(), tableSize);
+    Write(buffer, data.cpi.data(), tableSize);
+
+    // write to a process specific file and move it into place so concurrent runs never read a partial cache
+    std::error_code errorCode;
+    std::filesystem::create_directories(cachePath.parent_path(), errorCode);
+    const auto partialPath = cachePath.string() + "." + std::to_string(getpid()) + ".partial";
+    {
+        std::ofstream stream(partialPath, std::ios::binary);
+        stream.write(buffer.data(), (std::streamsize)buffer.size());
+        if (!stream) {
+            std::filesystem::remove(partialPath, errorCode);
+            return;
+        }
+    }
+    std::filesystem::rename(partialPath, cachePath, errorCode);
+    if (errorCode) {
+        std::filesystem::remove(partialPath, errorCode);
+    }
+}
+
+void ablate::eos::tChem::MechanismCache::CopyThermoTable(const ThermoTable<typename Tines::UseThisDevice<exec_space>::type>& thermoTable, Data& data) {
+    data.temperatureMinimum = thermoTable.temperatureMinimum;
+    data.temperatureMaximum = thermoTable.temperatureMaximum;
+    data.deltaTemperature = thermoTable.deltaTemperature;
+    data.cubic = thermoTable.cubic;
+
+    const auto hiHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), thermoTable.hi);
+    const auto cpiHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), thermoTable.cpi);
+    data.hi.resize(hiHost.size());
+    data.cpi.resize(cpiHost.size());
+    for (std::size_t j = 0; j < hiHost.extent(0); ++j) {
+        for (std::size_t k = 0; k < hiHost.extent(1); ++k) {
+            data.hi[j * hiHost.extent(1) + k] = hiHost(j, k);
+            data.cpi[j * hiHost.extent(1) + k] = cpiHost(j, k);
+        }
+    }
+}
+
+ablate::eos::tChem::ThermoTable<typename Tines::UseThisDevice<exec_space>::type> ablate::eos::tChem::MechanismCache::CreateThermoTable(const Data& data) {
+    using device_type = typename Tines::UseThisDevice<exec_space>::type;
+    const auto nSpec = (ordinal_type)data.enthalpyReference.size();
+    const auto numberTemperatures = nSpec ? (ordinal_type)(data.hi.size() / nSpec) : 0;
+
+    ThermoTable<device_type> deviceTable{.temperatureMinimum = data.temperatureMinimum,
+                                         .temperatureMaximum = data.temperatureMaximum,
+                                         .deltaTemperature = data.deltaTemperature,
+                                         .inverseDeltaTemperature = 1.0 / data.deltaTemperature,
+                                         .cubic = data.cubic,
+                                         .hi = ThermoTable<device_type>::real_type_2d_view_type("thermoTable hi", numberTemperatures, nSpec),
+                                         .cpi = ThermoTable<device_type>::real_type_2d_view_type("thermoTable cpi", numberTemperatures, nSpec)};
+    auto hiHost = Kokkos::create_mirror_view(deviceTable.hi);
+    auto cpiHost = Kokkos::create_mirror_view(deviceTable.cpi);
+    for (ordinal_type j = 0; j < numberTemperatures; ++j) {
+        for (ordinal_type k = 0; k < nSpec; ++k) {
+            hiHost(j, k) = data.hi[j * nSpec + k];
+            cpiHost(j, k) = data.cpi[j * nSpec + k];
+        }
+    }
+    Kokkos::deep_copy(deviceTable.hi, hiHost);
+    Kokkos::deep_copy(deviceTable.cpi, cpiHost);
+    return deviceTable;
+}
@@ -0,0 +1,84 @@
+#ifndef ABLATELIBRARY_TCHEM_MECHANISMCACHE_HPP
+#define ABLATELIBRARY_TCHEM_MECHANISMCACHE_HPP
+
+#include <petsc.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "TChem_Util.hpp"
+#include "eos/tChem/thermoTable.hpp"
+
+namespace ablate::eos::tChem {
+
+/**
+ * Stores the quantities that TChem computes from the processed mechanism at startup (the reference enthalpy and the optional thermo table) in a binary file
+ * keyed by the hash of the mechanism/thermo file contents and the table options.  The root rank reads the files, computes the key, and reads the cache with
+ * a single read that is broadcast to every rank.  The cache is stored in $ABLATE_MECHANISM_CACHE or ablateMechanismCache in the system temporary directory.
+ */
+class MechanismCache {
+   public:
+    /**
+     * The cached data, the thermo table is empty when it was not requested
+     */
+    struct Data {
+        std::vector<real_type> enthalpyReference;
+
+        real_type temperatureMinimum = 0.0;
+        real_type temperatureMaximum = -1.0;
+        real_type deltaTemperature = 0.0;
+        bool cubic = true;
+        //! the thermo table hi and cpi stored (nT x nSpec)
+        std::vector<real_type> hi;
+        std::vector<real_type> cpi;
+    };
+
+   private:
+    //! increment when the stored format changes so old caches are ignored
+    constexpr static int version = 1;
+
+    //! the mpi comm used to share the cache
+    const MPI_Comm comm;
+
+    //! the path to the cache file, only set on the root rank
+    std::filesystem::path cachePath;
+
+   public:
+    /**
+     * @param mechanismFile the mechanism file
+     * @param thermoFile the optional thermo file
+     * @param options any options that change the cached values (i.e. the thermo table settings)
+     * @param comm the comm to share the cache over, must be called by every rank in the comm
+     */
+    MechanismCache(const std::filesystem::path& mechanismFile, const std::filesystem::path& thermoFile, const std::string& options, MPI_Comm comm = PETSC_COMM_WORLD);
+
+    /**
+     * Read the cache on the root rank and broadcast it
+     * @param data the cached data
+     * @return true if the cache exists on every rank
+     */
+    bool Load(Data& data) const;
+
+    /**
+     * Write the cache from the root rank, a failure to write is ignored so a read only cache directory does not stop the run
+     * @param data
+     */
+    void Store(const Data& data) const;
+
+    /**
+     * Copy the thermo table into the cache data
+     */
+    static void CopyThermoTable(const ThermoTable<typename Tines::UseThisDevice<exec_space>::type>& thermoTable, Data& data);
+
+    /**
+     * Create a device thermo table from the cache data
+     */
+    static ThermoTable<typename Tines::UseThisDevice<exec_space>::type> CreateThermoTable(const Data& data);
+
+    /**
+     * @return the cache directory ($ABLATE_MECHANISM_CACHE or ablateMechanismCache in the system temporary directory)
+     */
+    static std::filesystem::path GetCacheDirectory();
+};
+
+}  // namespace ablate::eos::tChem
+#endif  // ABLATELIBRARY_TCHEM_MECHANISMCACHE_HPP
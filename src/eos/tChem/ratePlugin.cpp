@@ -0,0 +1,49 @@
+#include "ratePlugin.hpp"
+#include <dlfcn.h>
+#include <stdexcept>
+#include <utility>
+
+ablate::eos::tChem::RatePlugin::RatePlugin(std::filesystem::path pathIn, const std::vector<std::string>& species) : path(std::move(pathIn)) {
+    handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        throw std::invalid_argument("Unable to load the chemistry rate plugin " + path.string() + ": " + dlerror());
+    }
+
+    // the generated kernels must use the same species order as the eos
+    auto numberSpecies = ((NumberSpeciesFunction)GetSymbol("ablateMechanismNumberSpecies"))();
+    auto speciesName = (SpeciesNameFunction)GetSymbol("ablateMechanismSpeciesName");
+    if (numberSpecies != (int)species.size()) {
+        throw std::invalid_argument("The chemistry rate plugin " + path.string() + " has " + std::to_string(numberSpecies) + " species but the eos has " + std::to_string(species.size()));
+    }
+    for (int s = 0; s < numberSpecies; ++s) {
+        const char* name = speciesName(s);
+        if (!name || species[s] != name) {
+            throw std::invalid_argument("The chemistry rate plugin " + path.string() + " species " + std::to_string(s) + " (" + (name ? name : "") + ") does not match the eos species " +
+                                        species[s]);
+        }
+    }
+    netProductionRatesFunction = (NetProductionRatesFunction)GetSymbol("ablateMechanismNetProductionRates");
+}
+
+ablate::eos::tChem::RatePlugin::~RatePlugin() {
+    if (handle) {
+        dlclose(handle);
+    }
+}
+
+void* ablate::eos::tChem::RatePlugin::GetSymbol(const std::string& name) const {
+    auto symbol = dlsym(handle, name.c_str());
+    if (!symbol) {
+        throw std::invalid_argument("The chemistry rate plugin " + path.string() + " does not export " + name);
+    }
+    return symbol;
+}
+
+void ablate::eos::tChem::RatePlugin::ComputeNetProductionRates(std::size_t numberRows, const double* state, std::size_t stateStride, double* rates, std::size_t ratesStride) const {
+    if (numberRows == 0) {
+        return;
+    }
+    if (netProductionRatesFunction((int)numberRows, state, (int)stateStride, rates, (int)ratesStride)) {
+        throw std::runtime_error("The chemistry rate plugin " + path.string() + " failed to compute the net production rates");
+    }
+}
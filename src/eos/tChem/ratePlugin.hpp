@@ -0,0 +1,66 @@
+#ifndef ABLATELIBRARY_TCHEM_RATEPLUGIN_HPP
+#define ABLATELIBRARY_TCHEM_RATEPLUGIN_HPP
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace ablate::eos::tChem {
+
+/**
+ * Loads mechanism specific net production rate kernels from a shared library so generated code (i.e. from pyJac) can be used in place of the generic TChem
+ * rate evaluation.  The library is loaded at run time and must export the C functions
+ *
+ *      int ablateMechanismNumberSpecies(void);
+ *      const char* ablateMechanismSpeciesName(int species);
+ *      int ablateMechanismNetProductionRates(int numberRows, const double* state, int stateStride, double* rates, int ratesStride);
+ *
+ * where each state row is the TChem state vector (density, pressure, temperature, mass fractions) and each rates row receives the net production rate of
+ * every species in the same units as TChem::NetProductionRatePerMass.  A non zero return is treated as an error.  The species names must match the eos in
+ * the same order.
+ */
+class RatePlugin {
+   private:
+    using NumberSpeciesFunction = int (*)();
+    using SpeciesNameFunction = const char* (*)(int);
+    using NetProductionRatesFunction = int (*)(int, const double*, int, double*, int);
+
+    //! the path used to open the library, used for error messages
+    const std::filesystem::path path;
+
+    //! the dlopen handle
+    void* handle = nullptr;
+
+    //! the rate kernel in the library
+    NetProductionRatesFunction netProductionRatesFunction = nullptr;
+
+    /**
+     * Look up a required symbol in the library
+     */
+    void* GetSymbol(const std::string& name) const;
+
+   public:
+    /**
+     * Opens the library and checks that the species match
+     * @param path the shared library
+     * @param species the eos species in order
+     */
+    RatePlugin(std::filesystem::path path, const std::vector<std::string>& species);
+    ~RatePlugin();
+
+    RatePlugin(const RatePlugin&) = delete;
+    RatePlugin& operator=(const RatePlugin&) = delete;
+
+    /**
+     * Compute the net production rates for each row of a host state
+     * @param numberRows
+     * @param state the TChem state for each row
+     * @param stateStride the distance between rows in state
+     * @param rates the net production rates for each row
+     * @param ratesStride the distance between rows in rates
+     */
+    void ComputeNetProductionRates(std::size_t numberRows, const double* state, std::size_t stateStride, double* rates, std::size_t ratesStride) const;
+};
+
+}  // namespace ablate::eos::tChem
+#endif  // ABLATELIBRARY_TCHEM_RATEPLUGIN_HPP
@@ -4,6 +4,7 @@
 #include <TChem_Impl_EnthalpySpecMl.hpp>
 #include "TChem_KineticModelData.hpp"
 #include "TChem_Util.hpp"
+#include "eos/tChem/thermoTable.hpp"
 #include "eos/tChem.hpp"
 
 namespace ablate::eos::tChem::impl {
@@ -29,8 +30,22 @@ struct SensibleEnthalpyFcn {
                                                          const value_type_1d_view_type& hi, const value_type_1d_view_type& cpks,
                                                          /// const input from kinetic model
                                                          const value_type_1d_view_type& hi_ref, const KineticModelConstDataType& kmcd) {
+        return team_invoke(member, temperature, ys, hi, cpks, hi_ref, kmcd, ThermoTable<device_type>());
+    }
+
+    template <typename MemberType, typename KineticModelConstDataType>
+    KOKKOS_INLINE_FUNCTION static value_type team_invoke(const MemberType& member,
+                                                         /// input
+                                                         const value_type& temperature,  /// temperature
+                                                         const value_type_1d_view_type& ys,
+                                                         /// work space
+                                                         const value_type_1d_view_type& hi, const value_type_1d_view_type& cpks,
+                                                         /// const input from kinetic model
+                                                         const value_type_1d_view_type& hi_ref, const KineticModelConstDataType& kmcd,
+                                                         /// optional table of the species enthalpy
+                                                         const ThermoTable<device_type>& thermoTable) {
         // compute the enthalpy of each species at temperature
-        tChemLib::Impl::EnthalpySpecMlFcn<value_type, device_type>::team_invoke(member, temperature, hi, cpks, kmcd);
+        ablate::eos::tChem::EnthalpySpecMl<value_type, device_type>(member, temperature, hi, cpks, kmcd, thermoTable);
 
         Kokkos::parallel_for(Tines::RangeFactory<value_type>::TeamVectorRange(member, kmcd.nSpec), [&](const ordinal_type& i) {
             hi(i) /= kmcd.sMass(i);
@@ -4,6 +4,7 @@
 #include <TChem_Impl_EnthalpySpecMl.hpp>
 #include "TChem_KineticModelData.hpp"
 #include "TChem_Util.hpp"
+#include "eos/tChem/thermoTable.hpp"
 
 namespace tChemLib = TChem;
 
@@ -30,8 +31,22 @@ struct SensibleInternalEnergyFcn {
                                                          const value_type_1d_view_type& hi, const value_type_1d_view_type& cpks,
                                                          /// const input from kinetic model
                                                          const value_type_1d_view_type& hi_ref, const KineticModelConstDataType& kmcd) {
+        return team_invoke(member, temperature, ys, hi, cpks, hi_ref, kmcd, ThermoTable<device_type>());
+    }
+
+    template <typename MemberType, typename KineticModelConstDataType>
+    KOKKOS_INLINE_FUNCTION static value_type team_invoke(const MemberType& member,
+                                                         /// input
+                                                         const value_type& temperature,  /// temperature
+                                                         const value_type_1d_view_type& ys,
+                                                         /// work space
+                                                         const value_type_1d_view_type& hi, const value_type_1d_view_type& cpks,
+                                                         /// const input from kinetic model
+                                                         const value_type_1d_view_type& hi_ref, const KineticModelConstDataType& kmcd,
+                                                         /// optional table of the species enthalpy
+                                                         const ThermoTable<device_type>& thermoTable) {
         // compute the enthalpy of each species at temperature
-        tChemLib::Impl::EnthalpySpecMlFcn<value_type, device_type>::team_invoke(member, temperature, hi, cpks, kmcd);
+        ablate::eos::tChem::EnthalpySpecMl<value_type, device_type>(member, temperature, hi, cpks, kmcd, thermoTable);
         member.team_barrier();
 
         // compute the sensibleInternalEnergy
@@ -1,6 +1,8 @@
 #include "sourceCalculator.hpp"
 #include <TChem_Impl_IgnitionZeroD_Problem.hpp>
+#include <TChem_NetProductionRatePerMass.hpp>
 #include <algorithm>
+#include <numeric>
 #include "eos/tChem.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "ignitionZeroDTemperatureThreshold.hpp"
@@ -21,12 +23,25 @@ void ablate::eos::tChem::SourceCalculator::ChemistryConstraints::Set(const std::
         jacobianInterval = options->Get("jacobianInterval", jacobianInterval);
         maxAttempts = options->Get("maxAttempts", maxAttempts);
         thresholdTemperature = options->Get("thresholdTemperature", thresholdTemperature);
+        frozenTolerance = options->Get("frozenTolerance", frozenTolerance);
+        fuelSpecies = options->Get("fuelSpecies", fuelSpecies);
+        oxidizerSpecies = options->Get("oxidizerSpecies", oxidizerSpecies);
+        minimumReactantMassFraction = options->Get("minimumReactantMassFraction", minimumReactantMassFraction);
+        loadBalance = options->Get("loadBalance", loadBalance);
+        loadBalanceTolerance = options->Get("loadBalanceTolerance", loadBalanceTolerance);
+        dacTolerance = options->Get("dacTolerance", dacTolerance);
+        dacTargetSpecies = options->Get("dacTargetSpecies", dacTargetSpecies);
+        dacTemperatureBin = options->Get("dacTemperatureBin", dacTemperatureBin);
+        dacLogBin = options->Get("dacLogBin", dacLogBin);
+        dacMaxModels = options->Get("dacMaxModels", dacMaxModels);
+        dacCacheSize = options->Get("dacCacheSize", dacCacheSize);
+        ratePlugin = options->Get("ratePlugin", ratePlugin);
     }
 }
 
 ablate::eos::tChem::SourceCalculator::SourceCalculator(const std::vector<domain::Field>& fields, const std::shared_ptr<TChem> eosIn,
                                                        ablate::eos::tChem::SourceCalculator::ChemistryConstraints constraints, const solver::Range& cellRange)
-    : chemistryConstraints(constraints), eos(eosIn), numberSpecies(eosIn->GetSpecies().size()) {
+    : chemistryConstraints(constraints), eos(eosIn), numberSpecies(eosIn->GetSpecies().size()), batchCapacity(cellRange.end - cellRange.start) {
     // determine the number of required cells
     std::size_t numberCells = cellRange.end - cellRange.start;
 
@@ -40,11 +55,24 @@ ablate::eos::tChem::SourceCalculator::SourceCalculator(const std::vector<domain:
     endStateDevice = real_type_2d_view("stateVectorDevicesEnd", numberCells, stateVecDim);
     internalEnergyRefHost = real_type_1d_view_host("internalEnergyRefHost", numberCells);
     internalEnergyRefDevice = Kokkos::create_mirror(internalEnergyRefHost);
-    sourceTermsHost = real_type_2d_view_host("sourceTermsHost", numberCells, kineticModelGasConstData.nSpec + 1);
-    sourceTermsDevice = Kokkos::create_mirror(sourceTermsHost);
+    sourceTermsHost = real_type_2d_view_pinned("sourceTermsHost", numberCells, kineticModelGasConstData.nSpec + 1);
+    sourceTermsDevice = real_type_2d_view("sourceTermsDevice", numberCells, kineticModelGasConstData.nSpec + 1);
     perSpeciesScratchDevice = real_type_2d_view("perSpeciesScratchDevice", numberCells, kineticModelGasConstData.nSpec);
     timeViewDevice = real_type_1d_view("time", numberCells);
-    dtViewDevice = real_type_1d_view("delta time", numberCells);
+    dtViewHost = real_type_1d_view_host("delta time host", numberCells);
+    dtViewDevice = Kokkos::create_mirror(dtViewHost);
+    temperatureGuessHost = real_type_1d_view_host("temperatureGuessHost", numberCells);
+    temperatureGuessDevice = Kokkos::create_mirror(temperatureGuessHost);
+    temperatureIterationsDevice = ordinal_type_1d_view_device("temperatureIterationsDevice", numberCells);
+    Kokkos::deep_copy(temperatureGuessHost, 300.0);
+    activeMaskDevice = ordinal_type_1d_view_device("activeMaskDevice", numberCells);
+    activeOffsetDevice = ordinal_type_1d_view_device("activeOffsetDevice", numberCells);
+    activeIndexDevice = ordinal_type_1d_view_device("activeIndexDevice", numberCells);
+    activeStateDevice = real_type_2d_view("activeStateDevice", numberCells, stateVecDim);
+    activeDtViewDevice = real_type_1d_view("activeDtViewDevice", numberCells);
+    cellCostDevice = real_type_2d_view("cellCostDevice", numberCells, CELL_COST_SIZE);
+    cellCostHost = real_type_2d_view_host("cellCostHost", numberCells, CELL_COST_SIZE);
+    integrateEvent = RegisterEvent("tChem::SourceCalculator::Integrate");
 
     // Create the default timeAdvanceObject
     timeAdvanceDefault._tbeg = 0.0;
@@ -61,6 +89,7 @@ ablate::eos::tChem::SourceCalculator::SourceCalculator(const std::vector<domain:
     timeAdvanceDevice = time_advance_type_1d_view("timeAdvanceDevice", numberCells);
     Kokkos::deep_copy(timeAdvanceDevice, timeAdvanceDefault);
     Kokkos::deep_copy(dtViewDevice, 1E-4);
+    Kokkos::deep_copy(dtViewHost, 1E-4);
 
     // determine the number of equations
     auto numberOfEquations = ::tChemLib::Impl::IgnitionZeroD_Problem<real_type, Tines::UseThisDevice<exec_space>::type>::getNumberOfTimeODEs(kineticModelGasConstData);
@@ -103,6 +132,44 @@ ablate::eos::tChem::SourceCalculator::SourceCalculator(const std::vector<domain:
         throw std::invalid_argument("ablate::eos::tChem::BatchSource requires the ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD Field");
     }
     densityYiId = densityYiField->id;
+
+    // map the fuel and oxidizer species to their index in the state
+    const auto& species = eos->GetSpeciesVariables();
+    auto createSpeciesIndexView = [&species](const std::vector<std::string>& names, const std::string& label) {
+        ordinal_type_1d_view_device indexDevice(label, names.size());
+        auto indexHost = Kokkos::create_mirror_view(indexDevice);
+        for (std::size_t n = 0; n < names.size(); n++) {
+            auto speciesIt = std::find(species.begin(), species.end(), names[n]);
+            if (speciesIt == species.end()) {
+                throw std::invalid_argument("ablate::eos::tChem::SourceCalculator cannot locate the " + label + " " + names[n]);
+            }
+            indexHost(n) = (ordinal_type)std::distance(species.begin(), speciesIt);
+        }
+        Kokkos::deep_copy(indexDevice, indexHost);
+        return indexDevice;
+    };
+    fuelSpeciesDevice = createSpeciesIndexView(constraints.fuelSpecies, "fuelSpecies");
+    oxidizerSpeciesDevice = createSpeciesIndexView(constraints.oxidizerSpecies, "oxidizerSpecies");
+
+    // setup the optional dynamic adaptive chemistry
+    if (constraints.dacTolerance > 0.0) {
+        DynamicAdaptiveChemistry::Options dacOptions{.tolerance = constraints.dacTolerance,
+                                                     .targetSpecies = constraints.dacTargetSpecies,
+                                                     .temperatureBin = constraints.dacTemperatureBin,
+                                                     .logBin = constraints.dacLogBin,
+                                                     .maxModels = constraints.dacMaxModels,
+                                                     .cacheSize = constraints.dacCacheSize};
+        if (dacOptions.targetSpecies.empty()) {
+            dacOptions.targetSpecies = constraints.fuelSpecies;
+            dacOptions.targetSpecies.insert(dacOptions.targetSpecies.end(), constraints.oxidizerSpecies.begin(), constraints.oxidizerSpecies.end());
+        }
+        dynamicAdaptiveChemistry = std::make_shared<DynamicAdaptiveChemistry>(eos, dacOptions);
+    }
+
+    // load the optional generated rate kernels
+    if (!constraints.ratePlugin.empty()) {
+        ratePlugin = std::make_shared<RatePlugin>(constraints.ratePlugin, eos->GetSpecies());
+    }
 }
 
 void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::solver::Range& cellRange, PetscReal time, PetscReal dt, Vec globFlowVec) {
@@ -125,112 +192,135 @@ void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::solver::R
     PetscInt dim;
     DMGetDimension(solutionDm, &dim) >> checkError;
 
-    // Use a parallel for loop to load up the tChem state
-    Kokkos::parallel_for(
-        "stateLoadHost", Kokkos::RangePolicy<typename tChemLib::host_exec_space>(cellRange.start, cellRange.end), KOKKOS_LAMBDA(const auto i) {
-            // get the host data from the petsc field
-            const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
-            const std::size_t chemIndex = i - cellRange.start;
-
-            // Get the current state variables for this cell
-            const PetscScalar* eulerField = nullptr;
-            DMPlexPointLocalFieldRead(solutionDm, cell, eulerId, flowArray, &eulerField) >> checkError;
-            const PetscScalar* flowDensityField = nullptr;
-            DMPlexPointLocalFieldRead(solutionDm, cell, densityYiId, flowArray, &flowDensityField) >> checkError;
-
-            // cast the state at i to a state vector
-            const auto state_at_i = Kokkos::subview(stateHost, chemIndex, Kokkos::ALL());
-            Impl::StateVector<real_type_1d_view_host> stateVector(kineticModelGasConstDataDevice.nSpec, state_at_i);
-
-            // get the current state at I
-            auto density = eulerField[ablate::finiteVolume::CompressibleFlowFields::RHO];
-            stateVector.Density() = density;
-            stateVector.Temperature() = 300.0;
-            auto ys = stateVector.MassFractions();
-            real_type yiSum = 0.0;
-            for (ordinal_type s = 0; s < stateVector.NumSpecies() - 1; s++) {
-                ys[s] = PetscMax(0.0, flowDensityField[s] / density);
-                ys[s] = PetscMin(1.0, ys[s]);
-                yiSum += ys[s];
-            }
-            if (yiSum > 1.0) {
-                for (PetscInt s = 0; s < stateVector.NumSpecies() - 1; s++) {
-                    // Limit the bounds
-                    ys[s] /= yiSum;
-                }
-                ys[stateVector.NumSpecies() - 1] = 0.0;
-            } else {
-                ys[stateVector.NumSpecies() - 1] = 1.0 - yiSum;
-            }
-
-            // Compute the internal energy from total ener
-            PetscReal speedSquare = 0.0;
-            for (PetscInt d = 0; d < dim; d++) {
-                speedSquare += PetscSqr(eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
-            }
+    // load up the tChem state on the host
+    LoadState(cellRange, solutionDm, flowArray);
+    VecRestoreArrayRead(globFlowVec, &flowArray) >> checkError;
 
-            // compute the internal energy needed to compute temperature
-            internalEnergyRefHost[chemIndex] = eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare;
-        });
+    // optionally ship the state of expensive cells to ranks with less chemistry work
+    std::size_t batchSize = numberCells;
+    if (chemistryConstraints.loadBalance) {
+        Kokkos::deep_copy(dtViewHost, dtViewDevice);
+        batchSize = DistributeCells(PetscObjectComm((PetscObject)solutionDm), numberCells, dt);
+        Kokkos::deep_copy(dtViewDevice, dtViewHost);
+    }
+    const std::size_t numberKept = exportedCells.empty() ? numberCells : exportedCells.back().start;
 
     // copy from host to device
     Kokkos::deep_copy(internalEnergyRefDevice, internalEnergyRefHost);
     Kokkos::deep_copy(stateDevice, stateHost);
 
     // setup the enthalpy, temperature, pressure, chemistry function policies
-    auto temperatureFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberCells, Kokkos::AUTO());
+    auto temperatureFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), batchSize, Kokkos::AUTO());
     temperatureFunctionPolicy.set_scratch_size(
         1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(ablate::eos::tChem::Temperature::getWorkSpaceSize(kineticModelGasConstDataDevice.nSpec))));
-    auto pressureFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberCells, Kokkos::AUTO());
+    auto pressureFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), batchSize, Kokkos::AUTO());
     pressureFunctionPolicy.set_scratch_size(1,
                                             Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(ablate::eos::tChem::Pressure::getWorkSpaceSize(kineticModelGasConstDataDevice.nSpec))));
 
     // Compute temperature into the state field in the device
-    ablate::eos::tChem::Temperature::runDeviceBatch(
-        temperatureFunctionPolicy, stateDevice, internalEnergyRefDevice, perSpeciesScratchDevice, eos->GetEnthalpyOfFormation(), kineticModelGasConstDataDevice);
+    ablate::eos::tChem::Temperature::runDeviceBatch(temperatureFunctionPolicy,
+                                                    stateDevice,
+                                                    internalEnergyRefDevice,
+                                                    perSpeciesScratchDevice,
+                                                    eos->GetEnthalpyOfFormation(),
+                                                    kineticModelGasConstDataDevice,
+                                                    temperatureIterationsDevice,
+                                                    eos->GetThermoTable());
+
+    // store the computed temperature as the initial guess for the next call and record the number of iterations needed
+    Kokkos::parallel_for(
+        "temperatureGuessUpdate", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, batchSize), KOKKOS_LAMBDA(const auto chemIndex) {
+            const auto stateAtI = Kokkos::subview(stateDevice, chemIndex, Kokkos::ALL());
+            Impl::StateVector<real_type_1d_view> stateVector(kineticModelGasConstDataDevice.nSpec, stateAtI);
+            temperatureGuessDevice(chemIndex) = stateVector.Temperature();
+        });
+    Kokkos::deep_copy(temperatureGuessHost, temperatureGuessDevice);
+    ordinal_type iterations = 0;
+    Kokkos::parallel_reduce(
+        "temperatureIterationCount",
+        Kokkos::RangePolicy<typename tChemLib::exec_space>(0, batchSize),
+        KOKKOS_LAMBDA(const int& chemIndex, ordinal_type& iterationSum) { iterationSum += temperatureIterationsDevice(chemIndex); },
+        iterations);
+    temperatureIterations += iterations;
 
     // Compute the pressure into the state field in the device
     ablate::eos::tChem::Pressure::runDeviceBatch(pressureFunctionPolicy, stateDevice, kineticModelGasConstDataDevice);
 
-    double minimumPressure = 0;
+    // only integrate the active cells in a compacted batch
+    const std::size_t numberActive = ComputeActiveCells(batchSize, dt);
+    numberActiveCells = numberActive;
+
+    // select the reduced kinetic model for each active cell
+    if (dynamicAdaptiveChemistry) {
+        dynamicAdaptiveChemistry->SelectKineticModels(activeStateDevice, numberActive, reducedKineticModelsDevice);
+    }
+
+    // reset the cost of each row and time the integration of the batch
+    Kokkos::deep_copy(cellCostDevice, 0.0);
+    PetscLogEventBegin(integrateEvent, 0, 0, 0, 0) >> checkError;
+    Kokkos::Timer integrationTimer;
+
+    double minimumPressure = numberActive ? 0 : 1;
     for (int attempt = 0; (attempt < chemistryConstraints.maxAttempts) && minimumPressure == 0; ++attempt) {
         // Use a parallel for updating timeAdvanceDevice dt
         Kokkos::parallel_for(
-            "timeAdvanceUpdate", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberCells), KOKKOS_LAMBDA(const auto i) {
+            "timeAdvanceUpdate", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberActive), KOKKOS_LAMBDA(const auto i) {
                 auto& tAdvAtI = timeAdvanceDevice(i);
                 tAdvAtI._tbeg = time;
                 tAdvAtI._tend = time + dt;
-                tAdvAtI._dt = PetscMax(PetscMin(PetscMin(dtViewDevice(i) * chemistryConstraints.dtEstimateFactor, dt), tAdvAtI._dtmax) / (PetscPowInt(2, attempt)), tAdvAtI._dtmin);
+                tAdvAtI._dt = PetscMax(PetscMin(PetscMin(activeDtViewDevice(i) * chemistryConstraints.dtEstimateFactor, dt), tAdvAtI._dtmax) / (PetscPowInt(2, attempt)), tAdvAtI._dtmin);
                 // set the default time information
                 timeViewDevice(i) = time;
             });
 
-        auto chemistryFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberCells, Kokkos::AUTO());
+        auto chemistryFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberActive, Kokkos::AUTO());
         chemistryFunctionPolicy.set_scratch_size(1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::IgnitionZeroD::getWorkSpaceSize(kineticModelGasConstDataDevice))));
 
         // assume a constant pressure zero D reaction for each cell
-        if (chemistryConstraints.thresholdTemperature != 0.0) {
+        if (dynamicAdaptiveChemistry) {
+            // the reduced models have fewer reactions so the work space is sized using the full model
+            ablate::eos::tChem::IgnitionZeroDTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
+                                                                                  tolNewtonDevice,
+                                                                                  tolTimeDevice,
+                                                                                  facDevice,
+                                                                                  timeAdvanceDevice,
+                                                                                  activeStateDevice,
+                                                                                  timeViewDevice,
+                                                                                  activeDtViewDevice,
+                                                                                  endStateDevice,
+                                                                                  reducedKineticModelsDevice,
+                                                                                  chemistryConstraints.thresholdTemperature,
+                                                                                  ::tChemLib::IgnitionZeroD::getWorkSpaceSize(kineticModelGasConstDataDevice));
+        } else if (chemistryConstraints.thresholdTemperature != 0.0) {
             // If there is a thresholdTemperature, use the modified version of IgnitionZeroDTemperatureThreshold
             ablate::eos::tChem::IgnitionZeroDTemperatureThreshold::runDeviceBatch(chemistryFunctionPolicy,
                                                                                   tolNewtonDevice,
                                                                                   tolTimeDevice,
                                                                                   facDevice,
                                                                                   timeAdvanceDevice,
-                                                                                  stateDevice,
+                                                                                  activeStateDevice,
                                                                                   timeViewDevice,
-                                                                                  dtViewDevice,
+                                                                                  activeDtViewDevice,
                                                                                   endStateDevice,
                                                                                   kineticModelGasConstDataDevices,
                                                                                   chemistryConstraints.thresholdTemperature);
         } else {
             // else fall back to the default tChem version
-            tChemLib::IgnitionZeroD::runDeviceBatch(
-                chemistryFunctionPolicy, tolNewtonDevice, tolTimeDevice, facDevice, timeAdvanceDevice, stateDevice, timeViewDevice, dtViewDevice, endStateDevice, kineticModelGasConstDataDevices);
+            tChemLib::IgnitionZeroD::runDeviceBatch(chemistryFunctionPolicy,
+                                                    tolNewtonDevice,
+                                                    tolTimeDevice,
+                                                    facDevice,
+                                                    timeAdvanceDevice,
+                                                    activeStateDevice,
+                                                    timeViewDevice,
+                                                    activeDtViewDevice,
+                                                    endStateDevice,
+                                                    kineticModelGasConstDataDevices);
         }
         // check the output pressure, if it is zero the integration failed
         Kokkos::parallel_reduce(
             "pressureCheck",
-            Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberCells),
+            Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberActive),
             KOKKOS_LAMBDA(const int& chemIndex, double& pressureMin) {
                 // cast the state at i to a state vector
                 const auto stateAtI = Kokkos::subview(endStateDevice, chemIndex, Kokkos::ALL());
@@ -241,28 +331,81 @@ void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::solver::R
                 }
             },
             Kokkos::Min<double>(minimumPressure));
+
+        // record the cells that failed this attempt
+        Kokkos::parallel_for(
+            "integrationFailureCount", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberActive), KOKKOS_LAMBDA(const auto j) {
+                const auto stateAtJ = Kokkos::subview(endStateDevice, j, Kokkos::ALL());
+                Impl::StateVector<real_type_1d_view> stateVector(kineticModelGasConstDataDevice.nSpec, stateAtJ);
+                if (stateVector.Pressure() <= 0) {
+                    cellCostDevice(activeIndexDevice(j), CELL_COST_FAILURES) += 1.0;
+                }
+            });
+    }
+    Kokkos::fence();
+    const real_type integrationTime = integrationTimer.seconds();
+    PetscLogEventEnd(integrateEvent, 0, 0, 0, 0) >> checkError;
+
+    // store the integration dt of the active cells for the next estimate
+    Kokkos::parallel_for(
+        "activeCellScatter", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberActive), KOKKOS_LAMBDA(const auto j) { dtViewDevice(activeIndexDevice(j)) = activeDtViewDevice(j); });
+
+    // the batch is integrated concurrently, so the substeps are estimated from the final internal dt and the wall time is split between the cells by the substeps
+    real_type batchSubsteps = 0.0;
+    Kokkos::parallel_reduce(
+        "substepEstimate",
+        Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberActive),
+        KOKKOS_LAMBDA(const int& j, real_type& substepSum) {
+            const real_type substeps = activeDtViewDevice(j) > 0.0 ? PetscCeilReal(dt / activeDtViewDevice(j)) : 0.0;
+            cellCostDevice(activeIndexDevice(j), CELL_COST_SUBSTEPS) = substeps;
+            substepSum += substeps;
+        },
+        batchSubsteps);
+    if (batchSubsteps > 0.0) {
+        Kokkos::parallel_for(
+            "wallTimeEstimate", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberActive), KOKKOS_LAMBDA(const auto j) {
+                const auto row = activeIndexDevice(j);
+                cellCostDevice(row, CELL_COST_WALL_TIME) = integrationTime * cellCostDevice(row, CELL_COST_SUBSTEPS) / batchSubsteps;
+            });
+    }
+    Kokkos::deep_copy(cellCostHost, cellCostDevice);
+
+    // update the totals over all calls
+    totalIntegrationTime += integrationTime;
+    totalSubsteps += batchSubsteps;
+    for (std::size_t row = 0; row < batchSize; ++row) {
+        totalFailures += (PetscInt64)cellCostHost(row, CELL_COST_FAILURES);
     }
 
     // Use a parallel for computing the source term
     auto enthalpyOfFormation = eos->GetEnthalpyOfFormation();
     Kokkos::parallel_for(
-        "sourceTermCompute", Kokkos::RangePolicy<typename tChemLib::exec_space>(cellRange.start, cellRange.end), KOKKOS_LAMBDA(const auto i) {
-            // get the host data from the petsc field
-            const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
-            const std::size_t chemIndex = i - cellRange.start;
+        "sourceTermCompute", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, batchSize), KOKKOS_LAMBDA(const std::size_t chemIndex) {
+            // only the kept rows are local cells, the remaining rows were imported from other ranks
+            const PetscInt i = cellRange.start + (PetscInt)chemIndex;
+            const PetscInt cell = chemIndex < numberKept ? (cellRange.points ? cellRange.points[i] : i) : -1;
 
             // cast the state at i to a state vector
             const auto stateAtI = Kokkos::subview(stateDevice, chemIndex, Kokkos::ALL());
             Impl::StateVector<real_type_1d_view> stateVector(kineticModelGasConstDataDevice.nSpec, stateAtI);
             const auto ys = stateVector.MassFractions();
 
-            const auto endStateAtI = Kokkos::subview(endStateDevice, chemIndex, Kokkos::ALL());
-            Impl::StateVector<real_type_1d_view> endStateVector(kineticModelGasConstDataDevice.nSpec, endStateAtI);
-            const auto ye = endStateVector.MassFractions();
-
             // get the source term at this chemIndex
             const auto sourceTermAtI = Kokkos::subview(sourceTermsDevice, chemIndex, Kokkos::ALL());
 
+            // inactive cells do not react over this interval
+            if (!activeMaskDevice(chemIndex)) {
+                for (std::size_t j = 0; j < sourceTermAtI.extent(0); ++j) {
+                    sourceTermAtI(j) = 0.0;
+                }
+                return;
+            }
+
+            // the end state is stored in the compacted batch
+            const auto endStateAtI = Kokkos::subview(endStateDevice, activeOffsetDevice(chemIndex), Kokkos::ALL());
+            Impl::StateVector<real_type_1d_view> endStateVector(kineticModelGasConstDataDevice.nSpec, endStateAtI);
+            const auto ye = endStateVector.MassFractions();
+
             // the IgnitionZeroD::runDeviceBatch sets the pressure to zero if it does not converge
             if (endStateVector.Pressure() > 0) {
                 // compute the source term from the change in the heat of formation
@@ -288,13 +431,17 @@ void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::solver::R
                     sourceTermAtI(s + 1) = 0.0;
                 }
 
-                // compute the cell centroid
-                PetscReal centroid[3];
-                DMPlexComputeCellGeometryFVM(solutionDm, cell, nullptr, centroid, nullptr) >> checkError;
-
                 // Output error information
                 std::stringstream warningMessage;
-                warningMessage << "Warning: Could not integrate chemistry at cell " << cell << " on rank " << rank << " at location " << utilities::VectorUtilities::Concatenate(centroid, dim) << "\n";
+                if (cell >= 0) {
+                    // compute the cell centroid
+                    PetscReal centroid[3];
+                    DMPlexComputeCellGeometryFVM(solutionDm, cell, nullptr, centroid, nullptr) >> checkError;
+                    warningMessage << "Warning: Could not integrate chemistry at cell " << cell << " on rank " << rank << " at location " << utilities::VectorUtilities::Concatenate(centroid, dim)
+                                   << "\n";
+                } else {
+                    warningMessage << "Warning: Could not integrate chemistry for a load balanced cell (batch row " << chemIndex << ") on rank " << rank << "\n";
+                }
                 warningMessage << "dt: " << std::setprecision(16) << dt << "\n";
                 warningMessage << "state: "
                                << "\n";
@@ -306,12 +453,58 @@ void ablate::eos::tChem::SourceCalculator::ComputeSource(const ablate::solver::R
             }
         });
 
-    // copy the updated state back to host
-    Kokkos::deep_copy(sourceTermsHost, sourceTermsDevice);
+    // start the copy of the source back to the host, AddSource waits for the copy so it can overlap with the rhs flux assembly
+    Kokkos::deep_copy(tChemLib::exec_space(), sourceTermsHost, sourceTermsDevice);
+    sourceTermsCopyPending = true;
+
+    // return the results of the imported cells and restore the warm start information of the exported cells
+    if (chemistryConstraints.loadBalance) {
+        WaitForSourceTerms();
+        Kokkos::deep_copy(dtViewHost, dtViewDevice);
+        ReturnSources(PetscObjectComm((PetscObject)solutionDm));
+        Kokkos::deep_copy(dtViewDevice, dtViewHost);
+        Kokkos::deep_copy(temperatureGuessDevice, temperatureGuessHost);
+    }
     EndEvent();
 }
+void ablate::eos::tChem::SourceCalculator::ComputeSubsetSource(const solver::Range& subsetRange, const std::vector<std::size_t>& rows, PetscReal time, PetscReal dt, Vec globalSolution) {
+    // keep a copy of the warm start information for every row so the rows outside of the subset are not changed
+    Kokkos::deep_copy(dtViewHost, dtViewDevice);
+    std::vector<real_type> rowDt(dtViewHost.extent(0));
+    std::vector<real_type> rowTemperatureGuess(temperatureGuessHost.extent(0));
+    for (std::size_t r = 0; r < rowDt.size(); r++) {
+        rowDt[r] = dtViewHost(r);
+        rowTemperatureGuess[r] = temperatureGuessHost(r);
+    }
+
+    // move the warm start information of each subset cell to its batch row
+    for (std::size_t i = 0; i < rows.size(); i++) {
+        dtViewHost(i) = rowDt[rows[i]];
+        temperatureGuessHost(i) = rowTemperatureGuess[rows[i]];
+    }
+    Kokkos::deep_copy(dtViewDevice, dtViewHost);
+    Kokkos::deep_copy(temperatureGuessDevice, temperatureGuessHost);
+
+    ComputeSource(subsetRange, time, dt, globalSolution);
+
+    // return the updated warm start information to the original rows
+    Kokkos::deep_copy(dtViewHost, dtViewDevice);
+    for (std::size_t i = 0; i < rows.size(); i++) {
+        rowDt[rows[i]] = dtViewHost(i);
+        rowTemperatureGuess[rows[i]] = temperatureGuessHost(i);
+    }
+    for (std::size_t r = 0; r < rowDt.size(); r++) {
+        dtViewHost(r) = rowDt[r];
+        temperatureGuessHost(r) = rowTemperatureGuess[r];
+    }
+    Kokkos::deep_copy(dtViewDevice, dtViewHost);
+    Kokkos::deep_copy(temperatureGuessDevice, temperatureGuessHost);
+}
+
 void ablate::eos::tChem::SourceCalculator::AddSource(const ablate::solver::Range& cellRange, Vec, Vec locFVec) {
     StartEvent("tChem::SourceCalculator::AddSource");
+    WaitForSourceTerms();
+
     // get access to the fArray
     PetscScalar* fArray;
     VecGetArray(locFVec, &fArray) >> checkError;
@@ -346,3 +539,608 @@ void ablate::eos::tChem::SourceCalculator::AddSource(const ablate::solver::Range
     VecRestoreArray(locFVec, &fArray) >> checkError;
     EndEvent();
 }
+
+void ablate::eos::tChem::SourceCalculator::AddImplicitSource(const ablate::solver::Range& cellRange, Vec localXVec, PetscReal scale, Vec localFVec) {
+    StartEvent("tChem::SourceCalculator::AddImplicitSource");
+    ComputeNetProductionRates(cellRange, localXVec);
+    Kokkos::deep_copy(rateHost, rateDevice);
+
+    // get access to the fArray
+    PetscScalar* fArray;
+    VecGetArray(localFVec, &fArray) >> checkError;
+    DM dm;
+    VecGetDM(localFVec, &dm) >> checkError;
+
+    for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
+        const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
+        const std::size_t chemIndex = i - cellRange.start;
+
+        PetscScalar* eulerSource = nullptr;
+        DMPlexPointLocalFieldRef(dm, cell, eulerId, fArray, &eulerSource) >> checkError;
+        PetscScalar* densityYiSource = nullptr;
+        DMPlexPointLocalFieldRef(dm, cell, densityYiId, fArray, &densityYiSource) >> checkError;
+
+        // the energy source is the change in the heat of formation
+        PetscReal energySource = 0.0;
+        for (std::size_t sp = 0; sp < numberSpecies; sp++) {
+            densityYiSource[sp] += scale * rateHost(chemIndex, sp);
+            energySource -= rateHost(chemIndex, sp) * enthalpyOfFormationHost(sp);
+        }
+        eulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOE] += scale * energySource;
+    }
+
+    // cleanup
+    VecRestoreArray(localFVec, &fArray) >> checkError;
+    EndEvent();
+}
+
+void ablate::eos::tChem::SourceCalculator::AddImplicitJacobian(const ablate::solver::Range& cellRange, Vec localXVec, PetscReal scale, Mat jacobian) {
+    StartEvent("tChem::SourceCalculator::AddImplicitJacobian");
+    const std::size_t numberCells = cellRange.end - cellRange.start;
+    const ordinal_type nSpec = kineticModelGasConstDataDevice.nSpec;
+    const ordinal_type blockSize = nSpec + 1;
+
+    // compute the rates at the current state
+    ComputeNetProductionRates(cellRange, localXVec);
+    if (perturbedStateDevice.extent(0) < numberCells) {
+        perturbedStateDevice = real_type_2d_view("perturbedStateDevice", numberCells, stateDevice.extent(1));
+        perturbedInternalEnergyRefDevice = real_type_1d_view("perturbedInternalEnergyRefDevice", numberCells);
+        perturbedRateDevice = real_type_2d_view("perturbedRateDevice", numberCells, nSpec);
+        perturbationDevice = real_type_1d_view("perturbationDevice", numberCells);
+        jacobianColumnDevice = real_type_2d_view("jacobianColumnDevice", numberCells, blockSize);
+        jacobianColumnHost = real_type_2d_view_host("jacobianColumnHost", numberCells, blockSize);
+    }
+
+    // determine the global row of density*energy and each density*Yi for the cells owned by this rank.  Negative rows are ignored by the matrix.
+    DM dm;
+    VecGetDM(localXVec, &dm) >> checkError;
+    PetscSection globalSection;
+    DMGetGlobalSection(dm, &globalSection) >> checkError;
+    std::vector<PetscInt> rows(numberCells * blockSize, -1);
+    for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
+        const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
+        const std::size_t chemIndex = i - cellRange.start;
+        PetscInt globalDof;
+        PetscSectionGetDof(globalSection, cell, &globalDof) >> checkError;
+        if (globalDof <= 0) {
+            continue;
+        }
+        PetscInt eulerOffset, densityYiOffset;
+        PetscSectionGetFieldOffset(globalSection, cell, eulerId, &eulerOffset) >> checkError;
+        PetscSectionGetFieldOffset(globalSection, cell, densityYiId, &densityYiOffset) >> checkError;
+        rows[chemIndex * blockSize] = eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE;
+        for (ordinal_type s = 0; s < nSpec; ++s) {
+            rows[chemIndex * blockSize + s + 1] = densityYiOffset + s;
+        }
+    }
+
+    // compute one column of each cell block at a time: column 0 is density*energy and column s+1 is density*Yi
+    const real_type perturbationFactor = PetscSqrtReal(PETSC_MACHINE_EPSILON);
+    auto enthalpyOfFormation = eos->GetEnthalpyOfFormation();
+    std::vector<PetscScalar> values(blockSize);
+    for (ordinal_type column = 0; column < nSpec; ++column) {
+        Kokkos::parallel_for(
+            "jacobianPerturbState", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberCells), KOKKOS_LAMBDA(const std::size_t chemIndex) {
+                for (std::size_t j = 0; j < stateDevice.extent(1); ++j) {
+                    perturbedStateDevice(chemIndex, j) = stateDevice(chemIndex, j);
+                }
+                const auto stateAtI = Kokkos::subview(perturbedStateDevice, chemIndex, Kokkos::ALL());
+                Impl::StateVector<real_type_1d_view> stateVector(nSpec, stateAtI);
+                const auto density = stateVector.Density();
+                perturbedInternalEnergyRefDevice(chemIndex) = internalEnergyRefDevice(chemIndex);
+
+                real_type perturbation;
+                if (column == 0) {
+                    // density*energy only changes the internal energy
+                    perturbation = perturbationFactor * density * PetscMax(PetscAbs(internalEnergyRefDevice(chemIndex)), 1.0E3);
+                    perturbedInternalEnergyRefDevice(chemIndex) += perturbation / density;
+                } else {
+                    // density*Yi changes Yi and the last species, which is one minus the sum of the others
+                    auto ys = stateVector.MassFractions();
+                    perturbation = perturbationFactor * density * PetscMax(ys(column - 1), 1.0E-8);
+                    ys(column - 1) += perturbation / density;
+                    ys(nSpec - 1) -= perturbation / density;
+                }
+                perturbationDevice(chemIndex) = perturbation;
+            });
+
+        ComputeNetProductionRates(perturbedStateDevice, perturbedInternalEnergyRefDevice, perturbedRateDevice, numberCells);
+
+        Kokkos::parallel_for(
+            "jacobianColumnCompute", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberCells), KOKKOS_LAMBDA(const std::size_t chemIndex) {
+                jacobianColumnDevice(chemIndex, 0) = 0.0;
+                for (ordinal_type s = 0; s < nSpec; ++s) {
+                    const real_type rateDerivative = (perturbedRateDevice(chemIndex, s) - rateDevice(chemIndex, s)) / perturbationDevice(chemIndex);
+                    jacobianColumnDevice(chemIndex, s + 1) = rateDerivative;
+                    jacobianColumnDevice(chemIndex, 0) -= rateDerivative * enthalpyOfFormation(s);
+                }
+            });
+        Kokkos::deep_copy(jacobianColumnHost, jacobianColumnDevice);
+
+        // add the column of each cell block to the matrix
+        for (std::size_t chemIndex = 0; chemIndex < numberCells; ++chemIndex) {
+            const PetscInt* blockRows = rows.data() + chemIndex * blockSize;
+            if (blockRows[0] < 0) {
+                continue;
+            }
+            for (ordinal_type j = 0; j < blockSize; ++j) {
+                values[j] = scale * jacobianColumnHost(chemIndex, j);
+            }
+            MatSetValues(jacobian, blockSize, blockRows, 1, blockRows + column, values.data(), ADD_VALUES) >> checkError;
+        }
+    }
+    EndEvent();
+}
+
+void ablate::eos::tChem::SourceCalculator::ComputeNetProductionRates(const real_type_2d_view& state, const real_type_1d_view& internalEnergyRef, const real_type_2d_view& rates,
+                                                                     std::size_t numberRows) {
+    // the temperature in the state is used as the initial guess
+    auto temperatureFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberRows, Kokkos::AUTO());
+    temperatureFunctionPolicy.set_scratch_size(
+        1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(ablate::eos::tChem::Temperature::getWorkSpaceSize(kineticModelGasConstDataDevice.nSpec))));
+    ablate::eos::tChem::Temperature::runDeviceBatch(temperatureFunctionPolicy,
+                                                    state,
+                                                    internalEnergyRef,
+                                                    perSpeciesScratchDevice,
+                                                    eos->GetEnthalpyOfFormation(),
+                                                    kineticModelGasConstDataDevice,
+                                                    temperatureIterationsDevice,
+                                                    eos->GetThermoTable());
+
+    auto pressureFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberRows, Kokkos::AUTO());
+    pressureFunctionPolicy.set_scratch_size(1,
+                                            Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(ablate::eos::tChem::Pressure::getWorkSpaceSize(kineticModelGasConstDataDevice.nSpec))));
+    ablate::eos::tChem::Pressure::runDeviceBatch(pressureFunctionPolicy, state, kineticModelGasConstDataDevice);
+
+    // the generated rate kernels run on the host
+    if (ratePlugin) {
+        auto stateMirror = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), state);
+        auto ratesMirror = Kokkos::create_mirror_view(rates);
+        ratePlugin->ComputeNetProductionRates(numberRows, stateMirror.data(), stateMirror.stride(0), ratesMirror.data(), ratesMirror.stride(0));
+        Kokkos::deep_copy(rates, ratesMirror);
+        return;
+    }
+
+    auto rateFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), numberRows, Kokkos::AUTO());
+    rateFunctionPolicy.set_scratch_size(
+        1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::NetProductionRatePerMass::getWorkSpaceSize(kineticModelGasConstDataDevice))));
+    ::tChemLib::NetProductionRatePerMass::runDeviceBatch(rateFunctionPolicy, state, rates, kineticModelGasConstDataDevice);
+}
+
+void ablate::eos::tChem::SourceCalculator::ComputeNetProductionRates(const solver::Range& cellRange, Vec localXVec) {
+    const std::size_t numberCells = cellRange.end - cellRange.start;
+
+    // size up the rates the first time they are needed
+    if (rateDevice.extent(0) < numberCells) {
+        rateDevice = real_type_2d_view("rateDevice", numberCells, kineticModelGasConstDataDevice.nSpec);
+        rateHost = real_type_2d_view_host("rateHost", numberCells, kineticModelGasConstDataDevice.nSpec);
+        enthalpyOfFormationHost = real_type_1d_view_host("enthalpyOfFormationHost", kineticModelGasConstDataDevice.nSpec);
+        Kokkos::deep_copy(enthalpyOfFormationHost, eos->GetEnthalpyOfFormation());
+    }
+
+    // load the local solution into the state
+    DM dm;
+    VecGetDM(localXVec, &dm) >> checkError;
+    const PetscScalar* xArray;
+    VecGetArrayRead(localXVec, &xArray) >> checkError;
+    LoadState(cellRange, dm, xArray);
+    VecRestoreArrayRead(localXVec, &xArray) >> checkError;
+    Kokkos::deep_copy(internalEnergyRefDevice, internalEnergyRefHost);
+    Kokkos::deep_copy(stateDevice, stateHost);
+
+    ComputeNetProductionRates(stateDevice, internalEnergyRefDevice, rateDevice, numberCells);
+}
+
+void ablate::eos::tChem::SourceCalculator::LoadState(const solver::Range& cellRange, DM solutionDm, const PetscScalar* flowArray) {
+    PetscInt dim;
+    DMGetDimension(solutionDm, &dim) >> checkError;
+
+    // Use a parallel for loop to load up the tChem state
+    Kokkos::parallel_for(
+        "stateLoadHost", Kokkos::RangePolicy<typename tChemLib::host_exec_space>(cellRange.start, cellRange.end), KOKKOS_LAMBDA(const auto i) {
+            // get the host data from the petsc field
+            const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
+            const std::size_t chemIndex = i - cellRange.start;
+
+            // Get the current state variables for this cell
+            const PetscScalar* eulerField = nullptr;
+            DMPlexPointLocalFieldRead(solutionDm, cell, eulerId, flowArray, &eulerField) >> checkError;
+            const PetscScalar* flowDensityField = nullptr;
+            DMPlexPointLocalFieldRead(solutionDm, cell, densityYiId, flowArray, &flowDensityField) >> checkError;
+
+            // cast the state at i to a state vector
+            const auto state_at_i = Kokkos::subview(stateHost, chemIndex, Kokkos::ALL());
+            Impl::StateVector<real_type_1d_view_host> stateVector(kineticModelGasConstDataDevice.nSpec, state_at_i);
+
+            // get the current state at I
+            auto density = eulerField[ablate::finiteVolume::CompressibleFlowFields::RHO];
+            stateVector.Density() = density;
+            stateVector.Temperature() = temperatureGuessHost(chemIndex);
+            auto ys = stateVector.MassFractions();
+            real_type yiSum = 0.0;
+            for (ordinal_type s = 0; s < stateVector.NumSpecies() - 1; s++) {
+                ys[s] = PetscMax(0.0, flowDensityField[s] / density);
+                ys[s] = PetscMin(1.0, ys[s]);
+                yiSum += ys[s];
+            }
+            if (yiSum > 1.0) {
+                for (PetscInt s = 0; s < stateVector.NumSpecies() - 1; s++) {
+                    // Limit the bounds
+                    ys[s] /= yiSum;
+                }
+                ys[stateVector.NumSpecies() - 1] = 0.0;
+            } else {
+                ys[stateVector.NumSpecies() - 1] = 1.0 - yiSum;
+            }
+
+            // Compute the internal energy from total ener
+            PetscReal speedSquare = 0.0;
+            for (PetscInt d = 0; d < dim; d++) {
+                speedSquare += PetscSqr(eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOU + d] / density);
+            }
+
+            // compute the internal energy needed to compute temperature
+            internalEnergyRefHost[chemIndex] = eulerField[ablate::finiteVolume::CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare;
+        });
+}
+
+bool ablate::eos::tChem::SourceCalculator::GetCellCost(const solver::Range& cellRange, PetscReal cost[]) const {
+    for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
+        const std::size_t chemIndex = i - cellRange.start;
+        for (std::size_t k = 0; k < CELL_COST_SIZE; k++) {
+            cost[chemIndex * CELL_COST_SIZE + k] = cellCostHost(chemIndex, k);
+        }
+    }
+    return true;
+}
+
+void ablate::eos::tChem::SourceCalculator::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const {
+    // the views in the exec space (the device when built with a gpu)
+    const auto deviceName = prefix + "tChem::device";
+    memoryUsage.AddView(deviceName, stateDevice);
+    memoryUsage.AddView(deviceName, endStateDevice);
+    memoryUsage.AddView(deviceName, timeAdvanceDevice);
+    memoryUsage.AddView(deviceName, internalEnergyRefDevice);
+    memoryUsage.AddView(deviceName, perSpeciesScratchDevice);
+    memoryUsage.AddView(deviceName, sourceTermsDevice);
+    memoryUsage.AddView(deviceName, tolTimeDevice);
+    memoryUsage.AddView(deviceName, tolNewtonDevice);
+    memoryUsage.AddView(deviceName, facDevice);
+    memoryUsage.AddView(deviceName, timeViewDevice);
+    memoryUsage.AddView(deviceName, dtViewDevice);
+    memoryUsage.AddView(deviceName, temperatureGuessDevice);
+    memoryUsage.AddView(deviceName, temperatureIterationsDevice);
+    memoryUsage.AddView(deviceName, activeMaskDevice);
+    memoryUsage.AddView(deviceName, activeOffsetDevice);
+    memoryUsage.AddView(deviceName, activeIndexDevice);
+    memoryUsage.AddView(deviceName, activeStateDevice);
+    memoryUsage.AddView(deviceName, activeDtViewDevice);
+    memoryUsage.AddView(deviceName, cellCostDevice);
+    memoryUsage.AddView(deviceName, rateDevice);
+    memoryUsage.AddView(deviceName, perturbedStateDevice);
+    memoryUsage.AddView(deviceName, perturbedInternalEnergyRefDevice);
+    memoryUsage.AddView(deviceName, perturbedRateDevice);
+    memoryUsage.AddView(deviceName, perturbationDevice);
+    memoryUsage.AddView(deviceName, jacobianColumnDevice);
+
+    // the host mirrors
+    const auto hostName = prefix + "tChem::host";
+    memoryUsage.AddView(hostName, stateHost);
+    memoryUsage.AddView(hostName, internalEnergyRefHost);
+    memoryUsage.AddView(hostName, sourceTermsHost);
+    memoryUsage.AddView(hostName, dtViewHost);
+    memoryUsage.AddView(hostName, temperatureGuessHost);
+    memoryUsage.AddView(hostName, cellCostHost);
+    memoryUsage.AddView(hostName, rateHost);
+    memoryUsage.AddView(hostName, jacobianColumnHost);
+    memoryUsage.AddView(hostName, enthalpyOfFormationHost);
+}
+
+void ablate::eos::tChem::SourceCalculator::WaitForSourceTerms() {
+    if (sourceTermsCopyPending) {
+        tChemLib::exec_space().fence();
+        sourceTermsCopyPending = false;
+    }
+}
+
+void ablate::eos::tChem::SourceCalculator::ResizeBatch(std::size_t capacity) {
+    if (capacity <= batchCapacity) {
+        return;
+    }
+    WaitForSourceTerms();
+
+    // resize preserves the existing rows
+    Kokkos::resize(stateHost, capacity, stateHost.extent(1));
+    Kokkos::resize(stateDevice, capacity, stateDevice.extent(1));
+    Kokkos::resize(endStateDevice, capacity, endStateDevice.extent(1));
+    Kokkos::resize(internalEnergyRefHost, capacity);
+    Kokkos::resize(internalEnergyRefDevice, capacity);
+    Kokkos::resize(sourceTermsHost, capacity, sourceTermsHost.extent(1));
+    Kokkos::resize(sourceTermsDevice, capacity, sourceTermsDevice.extent(1));
+    Kokkos::resize(perSpeciesScratchDevice, capacity, perSpeciesScratchDevice.extent(1));
+    Kokkos::resize(facDevice, capacity, facDevice.extent(1));
+    Kokkos::resize(timeViewDevice, capacity);
+    Kokkos::resize(dtViewHost, capacity);
+    Kokkos::resize(dtViewDevice, capacity);
+    Kokkos::resize(temperatureGuessHost, capacity);
+    Kokkos::resize(temperatureGuessDevice, capacity);
+    Kokkos::resize(temperatureIterationsDevice, capacity);
+    Kokkos::resize(activeMaskDevice, capacity);
+    Kokkos::resize(activeOffsetDevice, capacity);
+    Kokkos::resize(activeIndexDevice, capacity);
+    Kokkos::resize(activeStateDevice, capacity, activeStateDevice.extent(1));
+    Kokkos::resize(activeDtViewDevice, capacity);
+    Kokkos::resize(cellCostDevice, capacity, CELL_COST_SIZE);
+    Kokkos::resize(cellCostHost, capacity, CELL_COST_SIZE);
+
+    // the new rows need the default time advance information
+    Kokkos::resize(timeAdvanceDevice, capacity);
+    Kokkos::deep_copy(Kokkos::subview(timeAdvanceDevice, std::make_pair(batchCapacity, capacity)), timeAdvanceDefault);
+
+    // each row requires its own copy of the kinetic model
+    kineticModelDataClone = eos->GetKineticModelData().clone(capacity);
+    kineticModelGasConstDataDevices = ::tChemLib::createGasKineticModelConstData<typename Tines::UseThisDevice<exec_space>::type>(kineticModelDataClone);
+
+    batchCapacity = capacity;
+}
+
+std::size_t ablate::eos::tChem::SourceCalculator::ComputeActiveCells(std::size_t batchSize, PetscReal dt) {
+    const ordinal_type nSpec = kineticModelGasConstDataDevice.nSpec;
+    const ordinal_type stateSize = (ordinal_type)stateDevice.extent(1);
+
+    // copy the constraints used on the device
+    const real_type thresholdTemperature = chemistryConstraints.thresholdTemperature;
+    const real_type frozenTolerance = chemistryConstraints.frozenTolerance;
+    const real_type minimumReactantMassFraction = chemistryConstraints.minimumReactantMassFraction;
+
+    // estimate the reaction rates with a single explicit evaluation at the current state
+    if (frozenTolerance > 0.0) {
+        auto rateFunctionPolicy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(::tChemLib::exec_space(), batchSize, Kokkos::AUTO());
+        rateFunctionPolicy.set_scratch_size(
+            1, Kokkos::PerTeam(::tChemLib::Scratch<real_type_1d_view>::shmem_size(::tChemLib::NetProductionRatePerMass::getWorkSpaceSize(kineticModelGasConstDataDevice))));
+        ::tChemLib::NetProductionRatePerMass::runDeviceBatch(rateFunctionPolicy, stateDevice, perSpeciesScratchDevice, kineticModelGasConstDataDevice);
+    }
+
+    Kokkos::parallel_for(
+        "activeCellMask", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, batchSize), KOKKOS_LAMBDA(const auto chemIndex) {
+            const auto stateAtI = Kokkos::subview(stateDevice, chemIndex, Kokkos::ALL());
+            Impl::StateVector<real_type_1d_view> stateVector(nSpec, stateAtI);
+            const auto ys = stateVector.MassFractions();
+            ordinal_type active = 1;
+
+            // cells below the threshold temperature
+            if (thresholdTemperature != 0.0 && stateVector.Temperature() < thresholdTemperature) {
+                active = 0;
+            }
+
+            // cells without fuel or oxidizer
+            if (active && fuelSpeciesDevice.extent(0)) {
+                real_type fuelMassFraction = 0.0;
+                for (std::size_t f = 0; f < fuelSpeciesDevice.extent(0); f++) {
+                    fuelMassFraction += ys(fuelSpeciesDevice(f));
+                }
+                active = fuelMassFraction >= minimumReactantMassFraction;
+            }
+            if (active && oxidizerSpeciesDevice.extent(0)) {
+                real_type oxidizerMassFraction = 0.0;
+                for (std::size_t o = 0; o < oxidizerSpeciesDevice.extent(0); o++) {
+                    oxidizerMassFraction += ys(oxidizerSpeciesDevice(o));
+                }
+                active = oxidizerMassFraction >= minimumReactantMassFraction;
+            }
+
+            // cells where the composition would not change significantly over dt
+            if (active && frozenTolerance > 0.0) {
+                real_type maximumRate = 0.0;
+                for (ordinal_type s = 0; s < nSpec; s++) {
+                    maximumRate = PetscMax(maximumRate, PetscAbs(perSpeciesScratchDevice(chemIndex, s)));
+                }
+                active = maximumRate * dt / stateVector.Density() >= frozenTolerance;
+            }
+
+            activeMaskDevice(chemIndex) = active;
+        });
+
+    // compute the offset of each active cell in the compacted batch
+    ordinal_type numberActive = 0;
+    Kokkos::parallel_scan(
+        "activeCellOffset",
+        Kokkos::RangePolicy<typename tChemLib::exec_space>(0, batchSize),
+        KOKKOS_LAMBDA(const int chemIndex, ordinal_type& offset, const bool final) {
+            if (final) {
+                activeOffsetDevice(chemIndex) = offset;
+                if (activeMaskDevice(chemIndex)) {
+                    activeIndexDevice(offset) = chemIndex;
+                }
+            }
+            offset += activeMaskDevice(chemIndex);
+        },
+        numberActive);
+
+    // gather the active cells
+    Kokkos::parallel_for(
+        "activeCellGather", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberActive), KOKKOS_LAMBDA(const auto j) {
+            const auto chemIndex = activeIndexDevice(j);
+            for (ordinal_type s = 0; s < stateSize; s++) {
+                activeStateDevice(j, s) = stateDevice(chemIndex, s);
+            }
+            activeDtViewDevice(j) = dtViewDevice(chemIndex);
+        });
+
+    return (std::size_t)numberActive;
+}
+
+std::size_t ablate::eos::tChem::SourceCalculator::DistributeCells(MPI_Comm comm, std::size_t numberCells, PetscReal dt) {
+    exportedCells.clear();
+    importedCells.clear();
+
+    PetscMPIInt rank, size;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+    MPI_Comm_size(comm, &size) >> checkMpiError;
+    if (size == 1) {
+        return numberCells;
+    }
+
+    // estimate the cost of each cell as the number of ode steps needed over the last interval
+    std::vector<PetscReal> cellCost(numberCells);
+    PetscReal localCost = 0.0;
+    for (std::size_t c = 0; c < numberCells; c++) {
+        cellCost[c] = PetscMin((PetscReal)chemistryConstraints.numTimeIterationsPerInterval, PetscMax(1.0, dt / dtViewHost(c)));
+        localCost += cellCost[c];
+    }
+    std::vector<PetscReal> rankCost(size);
+    MPI_Allgather(&localCost, 1, MPIU_REAL, rankCost.data(), 1, MPIU_REAL, comm) >> checkMpiError;
+
+    // only redistribute if the most expensive rank is sufficiently above the average
+    const PetscReal averageCost = std::accumulate(rankCost.begin(), rankCost.end(), 0.0) / size;
+    if (*std::max_element(rankCost.begin(), rankCost.end()) <= averageCost * (1.0 + chemistryConstraints.loadBalanceTolerance)) {
+        return numberCells;
+    }
+
+    // pair the ranks above the average with the ranks below it.  Every rank computes the same plan, so only the cell counts need to be communicated
+    std::vector<PetscReal> surplus(size);
+    for (PetscMPIInt r = 0; r < size; r++) {
+        surplus[r] = rankCost[r] - averageCost;
+    }
+    std::size_t numberKept = numberCells;
+    for (PetscMPIInt sender = 0, receiver = 0;;) {
+        while (sender < size && surplus[sender] <= 0.0) {
+            sender++;
+        }
+        while (receiver < size && surplus[receiver] >= 0.0) {
+            receiver++;
+        }
+        if (sender == size || receiver == size) {
+            break;
+        }
+        const PetscReal transferCost = PetscMin(surplus[sender], -surplus[receiver]);
+        surplus[sender] -= transferCost;
+        surplus[receiver] += transferCost;
+
+        if (sender == rank) {
+            // ship cells from the end of the local rows until the transfer cost is met
+            PetscReal shippedCost = 0.0;
+            std::size_t count = 0;
+            while (numberKept > 0 && shippedCost + 0.5 * cellCost[numberKept - 1] < transferCost) {
+                shippedCost += cellCost[--numberKept];
+                count++;
+            }
+            exportedCells.push_back(CellExchange{.rank = receiver, .start = numberKept, .count = count});
+        } else if (receiver == rank) {
+            importedCells.push_back(CellExchange{.rank = sender, .start = 0, .count = 0});
+        }
+    }
+
+    // share the number of cells in each transfer
+    const int countTag = 0;
+    std::vector<MPI_Request> requests;
+    std::vector<PetscInt> exportCounts(exportedCells.size());
+    std::vector<PetscInt> importCounts(importedCells.size());
+    for (std::size_t e = 0; e < exportedCells.size(); e++) {
+        exportCounts[e] = (PetscInt)exportedCells[e].count;
+        MPI_Isend(&exportCounts[e], 1, MPIU_INT, exportedCells[e].rank, countTag, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    for (std::size_t i = 0; i < importedCells.size(); i++) {
+        MPI_Irecv(&importCounts[i], 1, MPIU_INT, importedCells[i].rank, countTag, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    MPI_Waitall((PetscMPIInt)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> checkMpiError;
+    requests.clear();
+
+    // the imported cells are appended after the kept rows
+    std::size_t batchSize = numberKept;
+    for (std::size_t i = 0; i < importedCells.size(); i++) {
+        importedCells[i].start = batchSize;
+        importedCells[i].count = (std::size_t)importCounts[i];
+        batchSize += importedCells[i].count;
+    }
+    ResizeBatch(batchSize);
+
+    // each cell is shipped as the state vector, reference internal energy, and last integration dt
+    const std::size_t stateSize = stateHost.extent(1);
+    const std::size_t cellSize = stateSize + 2;
+    const int stateTag = 1;
+    std::vector<std::vector<real_type>> exportBuffers(exportedCells.size());
+    std::vector<std::vector<real_type>> importBuffers(importedCells.size());
+    for (std::size_t e = 0; e < exportedCells.size(); e++) {
+        auto& buffer = exportBuffers[e];
+        buffer.resize(exportedCells[e].count * cellSize);
+        for (std::size_t c = 0; c < exportedCells[e].count; c++) {
+            const std::size_t row = exportedCells[e].start + c;
+            for (std::size_t s = 0; s < stateSize; s++) {
+                buffer[c * cellSize + s] = stateHost(row, s);
+            }
+            buffer[c * cellSize + stateSize] = internalEnergyRefHost(row);
+            buffer[c * cellSize + stateSize + 1] = dtViewHost(row);
+        }
+        MPI_Isend(buffer.data(), (PetscMPIInt)buffer.size(), MPI_DOUBLE, exportedCells[e].rank, stateTag, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    for (std::size_t i = 0; i < importedCells.size(); i++) {
+        auto& buffer = importBuffers[i];
+        buffer.resize(importedCells[i].count * cellSize);
+        MPI_Irecv(buffer.data(), (PetscMPIInt)buffer.size(), MPI_DOUBLE, importedCells[i].rank, stateTag, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    MPI_Waitall((PetscMPIInt)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> checkMpiError;
+
+    // unpack the imported cells into the batch
+    for (std::size_t i = 0; i < importedCells.size(); i++) {
+        const auto& buffer = importBuffers[i];
+        for (std::size_t c = 0; c < importedCells[i].count; c++) {
+            const std::size_t row = importedCells[i].start + c;
+            for (std::size_t s = 0; s < stateSize; s++) {
+                stateHost(row, s) = buffer[c * cellSize + s];
+            }
+            internalEnergyRefHost(row) = buffer[c * cellSize + stateSize];
+            dtViewHost(row) = buffer[c * cellSize + stateSize + 1];
+        }
+    }
+
+    return batchSize;
+}
+
+void ablate::eos::tChem::SourceCalculator::ReturnSources(MPI_Comm comm) {
+    // each cell is returned as the source terms, integration dt, computed temperature, and cost
+    const std::size_t sourceSize = sourceTermsHost.extent(1);
+    const std::size_t cellSize = sourceSize + 2 + CELL_COST_SIZE;
+    const int sourceTag = 2;
+    std::vector<MPI_Request> requests;
+    std::vector<std::vector<real_type>> importBuffers(importedCells.size());
+    std::vector<std::vector<real_type>> exportBuffers(exportedCells.size());
+    for (std::size_t i = 0; i < importedCells.size(); i++) {
+        auto& buffer = importBuffers[i];
+        buffer.resize(importedCells[i].count * cellSize);
+        for (std::size_t c = 0; c < importedCells[i].count; c++) {
+            const std::size_t row = importedCells[i].start + c;
+            for (std::size_t s = 0; s < sourceSize; s++) {
+                buffer[c * cellSize + s] = sourceTermsHost(row, s);
+            }
+            buffer[c * cellSize + sourceSize] = dtViewHost(row);
+            buffer[c * cellSize + sourceSize + 1] = temperatureGuessHost(row);
+            for (std::size_t k = 0; k < CELL_COST_SIZE; k++) {
+                buffer[c * cellSize + sourceSize + 2 + k] = cellCostHost(row, k);
+            }
+        }
+        MPI_Isend(buffer.data(), (PetscMPIInt)buffer.size(), MPI_DOUBLE, importedCells[i].rank, sourceTag, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    for (std::size_t e = 0; e < exportedCells.size(); e++) {
+        auto& buffer = exportBuffers[e];
+        buffer.resize(exportedCells[e].count * cellSize);
+        MPI_Irecv(buffer.data(), (PetscMPIInt)buffer.size(), MPI_DOUBLE, exportedCells[e].rank, sourceTag, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    MPI_Waitall((PetscMPIInt)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> checkMpiError;
+
+    // the exported rows are local cells again
+    for (std::size_t e = 0; e < exportedCells.size(); e++) {
+        const auto& buffer = exportBuffers[e];
+        for (std::size_t c = 0; c < exportedCells[e].count; c++) {
+            const std::size_t row = exportedCells[e].start + c;
+            for (std::size_t s = 0; s < sourceSize; s++) {
+                sourceTermsHost(row, s) = buffer[c * cellSize + s];
+            }
+            dtViewHost(row) = buffer[c * cellSize + sourceSize];
+            temperatureGuessHost(row) = buffer[c * cellSize + sourceSize + 1];
+            for (std::size_t k = 0; k < CELL_COST_SIZE; k++) {
+                cellCostHost(row, k) = buffer[c * cellSize + sourceSize + 2 + k];
+            }
+        }
+    }
+}
@@ -2,6 +2,11 @@
 #define ABLATELIBRARY_TCHEM_SOURCECALCULATOR_HPP
 
 #include <TChem_KineticModelGasConstData.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "dynamicAdaptiveChemistry.hpp"
+#include "ratePlugin.hpp"
 #include "eos/chemistryModel.hpp"
 
 namespace tChemLib = TChem;
@@ -36,6 +41,31 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
         // store an optional threshold temperature.  Only compute the reactions if the temperature is above thresholdTemperature
         double thresholdTemperature = 0.0;
 
+        // optionally skip cells with a frozen composition, i.e. the explicit estimate of max(|omega_k|)*dt/rho is below frozenTolerance.  Zero disables the check
+        double frozenTolerance = 0.0;
+
+        // optionally skip cells where the sum of the fuel or oxidizer species mass fractions is below the minimumReactantMassFraction
+        std::vector<std::string> fuelSpecies;
+        std::vector<std::string> oxidizerSpecies;
+        double minimumReactantMassFraction = 1.0E-10;
+
+        // optionally redistribute the chemistry integration between ranks based upon the estimated cost of each cell (0 or 1)
+        int loadBalance = 0;
+        // the allowed cost imbalance (maximum/average - 1) before cells are redistributed
+        double loadBalanceTolerance = 0.1;
+
+        // optionally integrate each cell with a reduced mechanism from the directed relation graph.  Zero disables the reduction.  The target species default to the fuel and
+        // oxidizer species
+        double dacTolerance = 0.0;
+        std::vector<std::string> dacTargetSpecies;
+        double dacTemperatureBin = 25.0;
+        double dacLogBin = 0.25;
+        int dacMaxModels = 64;
+        int dacCacheSize = 10000;
+
+        // optional shared library with mechanism specific net production rate kernels used for the implicit source and jacobian
+        std::string ratePlugin;
+
         void Set(const std::shared_ptr<ablate::parameters::Parameters>&);
     };
 
@@ -48,16 +78,89 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
     SourceCalculator(const std::vector<domain::Field>& fields, std::shared_ptr<TChem> tChemEos, ChemistryConstraints constraints, const solver::Range& cellRange);
 
     /**
-     * The compute source can be used as a prestep allowing the add source to be used at each stage without reevaluating
+     * The compute source can be used as a prestep allowing the add source to be used at each stage without reevaluating.  When loadBalance is enabled this must be called by
+     * every rank in the solution comm.
      */
     void ComputeSource(const solver::Range& cellRange, PetscReal time, PetscReal dt, Vec globalSolution) override;
 
+    /**
+     * Computes the source for a subset of the cells using the temperature guess and internal dt of the original rows
+     */
+    void ComputeSubsetSource(const solver::Range& subsetRange, const std::vector<std::size_t>& rows, PetscReal time, PetscReal dt, Vec globalSolution) override;
+
     /**
      * Adds the source that was computed in the ComputeSource to the supplied vector
      */
     void AddSource(const solver::Range& cellRange, Vec localXVec, Vec localFVec) override;
 
+    /**
+     * Adds scale times the instantaneous source computed from the tChem net production rates at the local solution
+     */
+    void AddImplicitSource(const solver::Range& cellRange, Vec localXVec, PetscReal scale, Vec localFVec) override;
+
+    /**
+     * Adds scale times the cell block diagonal jacobian of the instantaneous source with respect to density*energy and density*Yi.  The tChem jacobians are computed for the
+     * constant pressure (temperature, Yi) ignition system, so each column is computed by perturbing the conserved variable, recomputing the temperature, and differencing the tChem
+     * net production rates.  The last species is computed from the others so it has no column.
+     */
+    void AddImplicitJacobian(const solver::Range& cellRange, Vec localXVec, PetscReal scale, Mat jacobian) override;
+
+    /**
+     * The total number of secant iterations used to compute the cell temperatures in all calls to ComputeSource
+     * @return
+     */
+    [[nodiscard]] inline PetscInt64 GetTemperatureIterations() const { return temperatureIterations; }
+
+    /**
+     * The number of cells that required the chemistry integration in the last call to ComputeSource
+     * @return
+     */
+    [[nodiscard]] inline std::size_t GetNumberActiveCells() const { return numberActiveCells; }
+
+    /**
+     * Copy the cost of each cell in the last ComputeSource.  The cells are integrated concurrently so the substeps are estimated from the final internal time step and the
+     * integration wall time of the batch is split between the cells proportional to the substeps.
+     */
+    bool GetCellCost(const solver::Range& cellRange, PetscReal cost[]) const override;
+
+    /**
+     * Add the tchem batch views on the device and host to the memory usage
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const override;
+
+    /**
+     * The total integration wall time, estimated substeps, and integration failures over all calls to ComputeSource
+     * @{
+     */
+    [[nodiscard]] inline real_type GetTotalIntegrationTime() const { return totalIntegrationTime; }
+    [[nodiscard]] inline real_type GetTotalSubsteps() const { return totalSubsteps; }
+    [[nodiscard]] inline PetscInt64 GetTotalFailures() const { return totalFailures; }
+    /** @} */
+
+    /**
+     * The optional dynamic adaptive chemistry used to reduce the mechanism for each cell, null if not enabled
+     * @return
+     */
+    [[nodiscard]] inline const std::shared_ptr<DynamicAdaptiveChemistry>& GetDynamicAdaptiveChemistry() const { return dynamicAdaptiveChemistry; }
+
    private:
+    using ordinal_type_1d_view_device = Tines::value_type_1d_view<ordinal_type, typename Tines::UseThisDevice<exec_space>::type>;
+
+    //! the source terms are copied back to pinned host memory when running on a gpu so the copy can be overlapped with the flux assembly
+#if defined(KOKKOS_ENABLE_CUDA)
+    using pinned_host_memory_space = Kokkos::CudaHostPinnedSpace;
+#else
+    using pinned_host_memory_space = Kokkos::HostSpace;
+#endif
+    using real_type_2d_view_pinned = Kokkos::View<real_type**, Kokkos::LayoutRight, pinned_host_memory_space>;
+
+    //! a contiguous block of batch rows exchanged with another rank
+    struct CellExchange {
+        PetscMPIInt rank;
+        std::size_t start;
+        std::size_t count;
+    };
+
     //! copy of constraints
     ChemistryConstraints chemistryConstraints;
 
@@ -89,10 +192,13 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
     real_type_1d_view_host internalEnergyRefHost;
     real_type_2d_view perSpeciesScratchDevice;
 
-    // store the source terms (density* energy + density*species)
-    real_type_2d_view_host sourceTermsHost;
+    // store the source terms (density* energy + density*species).  The host copy is filled asynchronously at the end of ComputeSource
+    real_type_2d_view_pinned sourceTermsHost;
     real_type_2d_view sourceTermsDevice;
 
+    //! true while the asynchronous copy of the source terms to the host has not been waited on
+    bool sourceTermsCopyPending = false;
+
     // tolerance constraints
     real_type_2d_view tolTimeDevice;
     real_type_1d_view tolNewtonDevice;
@@ -101,11 +207,135 @@ class SourceCalculator : public ChemistryModel::SourceCalculator, private utilit
     // store the time and delta for the ode solver
     real_type_1d_view timeViewDevice;
     real_type_1d_view dtViewDevice;
+    real_type_1d_view_host dtViewHost;
+
+    // the temperature from the previous call is used as the initial guess for the temperature solve
+    real_type_1d_view_host temperatureGuessHost;
+    real_type_1d_view temperatureGuessDevice;
+
+    // instrumentation for the number of temperature iterations
+    ordinal_type_1d_view_device temperatureIterationsDevice;
+    PetscInt64 temperatureIterations = 0;
+
+    // the activity mask, the offset of each active cell in the compacted batch, and the batch row of each active cell
+    ordinal_type_1d_view_device activeMaskDevice;
+    ordinal_type_1d_view_device activeOffsetDevice;
+    ordinal_type_1d_view_device activeIndexDevice;
+
+    // the compacted state and integration dt of the active cells
+    real_type_2d_view activeStateDevice;
+    real_type_1d_view activeDtViewDevice;
+
+    // the species indices used to check for the fuel and oxidizer
+    ordinal_type_1d_view_device fuelSpeciesDevice;
+    ordinal_type_1d_view_device oxidizerSpeciesDevice;
+
+    // the number of active cells in the last call to ComputeSource
+    std::size_t numberActiveCells = 0;
+
+    // the cost of each batch row in the last call to ComputeSource
+    real_type_2d_view cellCostDevice;
+    real_type_2d_view_host cellCostHost;
+
+    // the cost over all calls to ComputeSource
+    real_type totalIntegrationTime = 0.0;
+    real_type totalSubsteps = 0.0;
+    PetscInt64 totalFailures = 0;
+
+    //! the event used to log the chemistry integration
+    PetscLogEvent integrateEvent;
 
     // store device specific kineticModelGasConstants
     tChemLib::KineticModelConstData<typename Tines::UseThisDevice<exec_space>::type> kineticModelGasConstDataDevice;
     kmd_type_1d_view_host kineticModelDataClone;
     Kokkos::View<KineticModelGasConstData<typename Tines::UseThisDevice<exec_space>::type>*, typename Tines::UseThisDevice<exec_space>::type> kineticModelGasConstDataDevices;
+
+    // the optional dynamic adaptive chemistry and the (reduced) kinetic model selected for each active cell
+    std::shared_ptr<DynamicAdaptiveChemistry> dynamicAdaptiveChemistry;
+    DynamicAdaptiveChemistry::kinetic_model_view reducedKineticModelsDevice;
+
+    // the net production rates at the state and the perturbed state used for the implicit source and jacobian.  These are only allocated when needed
+    real_type_2d_view rateDevice;
+    real_type_2d_view_host rateHost;
+    real_type_2d_view perturbedStateDevice;
+    real_type_1d_view perturbedInternalEnergyRefDevice;
+    real_type_2d_view perturbedRateDevice;
+    real_type_1d_view perturbationDevice;
+    real_type_2d_view jacobianColumnDevice;
+    real_type_2d_view_host jacobianColumnHost;
+    real_type_1d_view_host enthalpyOfFormationHost;
+
+    //! the optional generated rate kernels used in place of the TChem net production rates
+    std::shared_ptr<RatePlugin> ratePlugin;
+
+    //! the number of rows the batch views can hold, this can be larger than the local number of cells when cells are imported from other ranks
+    std::size_t batchCapacity;
+
+    //! local rows (at the end of the batch) whose chemistry is integrated by other ranks
+    std::vector<CellExchange> exportedCells;
+
+    //! rows in the batch that were received from other ranks
+    std::vector<CellExchange> importedCells;
+
+    /**
+     * Load the host state (density, mass fractions, and temperature guess) and internal energy from the solution for each cell in the range
+     * @param cellRange
+     * @param solutionDm
+     * @param flowArray
+     */
+    void LoadState(const solver::Range& cellRange, DM solutionDm, const PetscScalar* flowArray);
+
+    /**
+     * Compute the temperature, pressure, and then the net production rates (kg/m^3/s) for the first numberRows of the state
+     * @param state
+     * @param internalEnergyRef
+     * @param rates
+     * @param numberRows
+     */
+    void ComputeNetProductionRates(const real_type_2d_view& state, const real_type_1d_view& internalEnergyRef, const real_type_2d_view& rates, std::size_t numberRows);
+
+    /**
+     * Load the local solution and compute the net production rates into the rateDevice for each cell in the range
+     * @param cellRange
+     * @param localXVec
+     */
+    void ComputeNetProductionRates(const solver::Range& cellRange, Vec localXVec);
+
+    /**
+     * Wait for the asynchronous copy of the source terms to the host to complete
+     */
+    void WaitForSourceTerms();
+
+    /**
+     * Grow the batch views (preserving the current values) so that they can hold capacity rows
+     * @param capacity
+     */
+    void ResizeBatch(std::size_t capacity);
+
+    /**
+     * Compute the activity mask for the batch using the threshold temperature, the fuel/oxidizer mass fractions, and an explicit estimate of the reaction rate.  The state and
+     * integration dt of the active cells are compacted into the active views.  The temperature and pressure must already be computed in the stateDevice.
+     * @param batchSize the number of rows in the batch
+     * @param dt the chemistry integration interval
+     * @return the number of active cells
+     */
+    std::size_t ComputeActiveCells(std::size_t batchSize, PetscReal dt);
+
+    /**
+     * Estimate the cost of each local cell from the last integration dt and ship cells from ranks above the average cost to ranks below it.  The exported cells are taken from the
+     * end of the local rows and the imported cells are appended after the kept rows.  This must be called by every rank in the comm.
+     * @param comm
+     * @param numberCells the number of local cells packed into the batch
+     * @param dt the chemistry integration interval
+     * @return the number of rows in the batch to integrate
+     */
+    std::size_t DistributeCells(MPI_Comm comm, std::size_t numberCells, PetscReal dt);
+
+    /**
+     * Return the source terms, integration dt, and temperature of the imported cells to their owning ranks
+     * @param comm
+     */
+    void ReturnSources(MPI_Comm comm);
 };
 
 }  // namespace ablate::eos::tChem
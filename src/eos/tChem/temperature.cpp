@@ -7,7 +7,8 @@ void Temperature_TemplateRun(const std::string& profile_name,
                              /// team size setting
                              const PolicyType& policy, const Tines::value_type_2d_view<real_type, DeviceType>& state, const Tines::value_type_1d_view<real_type, DeviceType>& internalEnergyRef,
                              const Tines::value_type_2d_view<real_type, DeviceType>& enthalpyMass, const Tines::value_type_1d_view<real_type, DeviceType>& enthalpyReference,
-                             const KineticModelConstData<DeviceType>& kmcd) {
+                             const KineticModelConstData<DeviceType>& kmcd, const Tines::value_type_1d_view<ordinal_type, DeviceType>& iterations,
+                             const ThermoTable<DeviceType>& thermoTable) {
     Kokkos::Profiling::pushRegion(profile_name);
     using policy_type = PolicyType;
     using device_type = DeviceType;
@@ -39,8 +40,9 @@ void Temperature_TemplateRun(const std::string& profile_name,
                 const auto EPS_T_RHO_E = 1E-8;
                 const auto ITERMAX_T = 100;
 
-                // compute the first error
-                double e2 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd);
+                // compute the first error, the temperature already in the state is used as the initial guess
+                ordinal_type iterationCount = 0;
+                double e2 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd, thermoTable);
                 double f2 = internalEnergyRef_at_i() - e2;
                 if (Tines::ats<real_type>::abs(f2) > EPS_T_RHO_E) {
                     double t0 = t2;
@@ -48,18 +50,18 @@ void Temperature_TemplateRun(const std::string& profile_name,
                     double t1 = t0 + 1;
 
                     t = t1;
-                    double e1 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd);
+                    double e1 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd, thermoTable);
                     double f1 = internalEnergyRef_at_i() - e1;
 
                     for (int it = 0; it < ITERMAX_T; it++) {
+                        iterationCount++;
                         t2 = t1 - f1 * (t1 - t0) / (f1 - f0 + 1E-30);
                         t2 = std::max(1.0, t2);
                         t = t2;
-                        e2 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd);
+                        e2 = ablate::eos::tChem::impl::SensibleInternalEnergyFcn<real_type, device_type>::team_invoke(member, t, ys, hi_at_i, cpks, enthalpyReference, kmcd, thermoTable);
                         f2 = internalEnergyRef_at_i() - e2;
                         if (Tines::ats<real_type>::abs(f2) <= EPS_T_RHO_E) {
-                            t = t2;
-                            return;
+                            break;
                         }
                         t0 = t1;
                         t1 = t2;
@@ -68,6 +70,11 @@ void Temperature_TemplateRun(const std::string& profile_name,
                     }
                     t = t2;
                 }
+
+                // optionally record the number of secant iterations needed for this state
+                if ((ordinal_type)iterations.extent(0) > i) {
+                    iterations(i) = iterationCount;
+                }
             }
         });
     Kokkos::Profiling::popRegion();
@@ -78,7 +85,23 @@ void Temperature_TemplateRun(const std::string& profile_name,
 [[maybe_unused]] void ablate::eos::tChem::Temperature::runDeviceBatch(typename UseThisTeamPolicy<exec_space>::type& policy, const Temperature::real_type_2d_view_type& state,
                                                                       const Temperature::real_type_1d_view_type& internalEnergyRef, const Temperature::real_type_2d_view_type& enthalpyMass,
                                                                       const Temperature::real_type_1d_view_type& enthalpyReference, const Temperature::kinetic_model_type& kmcd) {
-    ablate::eos::tChem::impl::Temperature_TemplateRun("ablate::eos::tChem::Temperature::runDeviceBatch", policy, state, internalEnergyRef, enthalpyMass, enthalpyReference, kmcd);
+    ablate::eos::tChem::impl::Temperature_TemplateRun("ablate::eos::tChem::Temperature::runDeviceBatch",
+                                                      policy,
+                                                      state,
+                                                      internalEnergyRef,
+                                                      enthalpyMass,
+                                                      enthalpyReference,
+                                                      kmcd,
+                                                      Temperature::ordinal_type_1d_view_type(),
+                                                      ThermoTable<device_type>());
+}
+
+[[maybe_unused]] void ablate::eos::tChem::Temperature::runDeviceBatch(typename UseThisTeamPolicy<exec_space>::type& policy, const Temperature::real_type_2d_view_type& state,
+                                                                      const Temperature::real_type_1d_view_type& internalEnergyRef, const Temperature::real_type_2d_view_type& enthalpyMass,
+                                                                      const Temperature::real_type_1d_view_type& enthalpyReference, const Temperature::kinetic_model_type& kmcd,
+                                                                      const Temperature::ordinal_type_1d_view_type& iterations, const ThermoTable<device_type>& thermoTable) {
+    ablate::eos::tChem::impl::Temperature_TemplateRun(
+        "ablate::eos::tChem::Temperature::runDeviceBatch", policy, state, internalEnergyRef, enthalpyMass, enthalpyReference, kmcd, iterations, thermoTable);
 }
 
 [[maybe_unused]] void ablate::eos::tChem::Temperature::runHostBatch(const typename UseThisTeamPolicy<host_exec_space>::type& policy,
@@ -86,5 +109,13 @@ void Temperature_TemplateRun(const std::string& profile_name,
                                                                     const ablate::eos::tChem::Temperature::real_type_1d_view_host_type& internalEnergyRef,
                                                                     const Temperature::real_type_2d_view_host_type& enthalpyMass, const Temperature::real_type_1d_view_host_type& enthalpyReference,
                                                                     const ablate::eos::tChem::Temperature::kinetic_model_host_type& kmcd) {
-    ablate::eos::tChem::impl::Temperature_TemplateRun("ablate::eos::tChem::Temperature::runHostBatch", policy, state, internalEnergyRef, enthalpyMass, enthalpyReference, kmcd);
+    ablate::eos::tChem::impl::Temperature_TemplateRun("ablate::eos::tChem::Temperature::runHostBatch",
+                                                      policy,
+                                                      state,
+                                                      internalEnergyRef,
+                                                      enthalpyMass,
+                                                      enthalpyReference,
+                                                      kmcd,
+                                                      Temperature::ordinal_type_1d_view_host_type(),
+                                                      ThermoTable<host_device_type>());
 }
@@ -3,6 +3,7 @@
 
 #include "TChem_KineticModelData.hpp"
 #include "TChem_Util.hpp"
+#include "eos/tChem/thermoTable.hpp"
 
 namespace ablate::eos::tChem {
 
@@ -16,6 +17,9 @@ struct Temperature {
     using real_type_1d_view_host_type = Tines::value_type_1d_view<real_type, host_device_type>;
     using real_type_2d_view_host_type = Tines::value_type_2d_view<real_type, host_device_type>;
 
+    using ordinal_type_1d_view_type = Tines::value_type_1d_view<ordinal_type, device_type>;
+    using ordinal_type_1d_view_host_type = Tines::value_type_1d_view<ordinal_type, host_device_type>;
+
     using kinetic_model_type = KineticModelConstData<device_type>;
     using kinetic_model_host_type = KineticModelConstData<host_device_type>;
 
@@ -39,6 +43,31 @@ struct Temperature {
         /// const data from kinetic model
         const real_type_1d_view_type& enthalpyReference, const kinetic_model_type& kmcd);
 
+    /**
+     * tchem like function to compute temperature on device that also records the number of secant iterations used for each state.  The
+     * temperature in the state is used as the initial guess.
+     * @param policy
+     * @param state
+     * @param internalEnergyRef
+     * @param enthalpyMass
+     * @param enthalpyReference
+     * @param kmcd
+     * @param iterations the number of iterations needed for each state
+     * @param thermoTable optional table used for the species enthalpy
+     */
+    [[maybe_unused]] static void runDeviceBatch(  /// thread block size
+        typename UseThisTeamPolicy<exec_space>::type& policy,
+        /// the output is the updated temperature in the state
+        const real_type_2d_view_type& state, const real_type_1d_view_type& internalEnergyRef,
+        /// useful scratch
+        const real_type_2d_view_type& enthalpyMass,
+        /// const data from kinetic model
+        const real_type_1d_view_type& enthalpyReference, const kinetic_model_type& kmcd,
+        /// the output number of iterations per state
+        const ordinal_type_1d_view_type& iterations,
+        /// optional species enthalpy table
+        const ThermoTable<device_type>& thermoTable = {});
+
     /**
      * tchem like function to compute temperature on host
      * @param policy
@@ -0,0 +1,93 @@
+#include "thermoTable.hpp"
+#include <stdexcept>
+#include <string>
+
+ablate::eos::tChem::ThermoTable<typename Tines::UseThisDevice<exec_space>::type> ablate::eos::tChem::CreateThermoTable(tChemLib::KineticModelData& kineticsModel, real_type temperatureMinimum,
+                                                                                                                       real_type temperatureMaximum, real_type deltaTemperature, bool cubic,
+                                                                                                                       real_type tolerance) {
+    using host_device_type = typename Tines::UseThisDevice<host_exec_space>::type;
+    using device_type = typename Tines::UseThisDevice<exec_space>::type;
+    using host_policy_type = typename tChemLib::UseThisTeamPolicy<tChemLib::host_exec_space>::type;
+    using real_type_1d_view_host_type = Tines::value_type_1d_view<real_type, host_device_type>;
+
+    if (deltaTemperature <= 0.0 || temperatureMaximum <= temperatureMinimum) {
+        throw std::invalid_argument("The ablate::eos::tChem::ThermoTable requires a positive deltaTemperature and temperatureMaximum > temperatureMinimum");
+    }
+
+    // determine the size of the table
+    const auto kmcd = tChemLib::createGasKineticModelConstData<host_device_type>(kineticsModel);
+    const auto nSpec = kmcd.nSpec;
+    const auto numberTemperatures = (ordinal_type)((temperatureMaximum - temperatureMinimum) / deltaTemperature) + 1;
+    if (numberTemperatures < 2) {
+        throw std::invalid_argument("The ablate::eos::tChem::ThermoTable requires at least two temperatures");
+    }
+
+    // build the table on the host
+    ThermoTable<host_device_type> hostTable{.temperatureMinimum = temperatureMinimum,
+                                            .temperatureMaximum = temperatureMinimum + (numberTemperatures - 1) * deltaTemperature,
+                                            .deltaTemperature = deltaTemperature,
+                                            .inverseDeltaTemperature = 1.0 / deltaTemperature,
+                                            .cubic = cubic,
+                                            .hi = ThermoTable<host_device_type>::real_type_2d_view_type("thermoTable hi host", numberTemperatures, nSpec),
+                                            .cpi = ThermoTable<host_device_type>::real_type_2d_view_type("thermoTable cpi host", numberTemperatures, nSpec)};
+
+    Kokkos::parallel_for(
+        "thermoTableBuild", host_policy_type(numberTemperatures, Kokkos::AUTO()), KOKKOS_LAMBDA(const typename host_policy_type::member_type& member) {
+            const ordinal_type j = member.league_rank();
+            const real_type temperature = temperatureMinimum + j * deltaTemperature;
+            const real_type_1d_view_host_type hiAtJ = Kokkos::subview(hostTable.hi, j, Kokkos::ALL());
+            const real_type_1d_view_host_type cpiAtJ = Kokkos::subview(hostTable.cpi, j, Kokkos::ALL());
+            tChemLib::Impl::EnthalpySpecMlFcn<real_type, host_device_type>::team_invoke(member, temperature, hiAtJ, cpiAtJ, kmcd);
+        });
+
+    // check the interpolation error at the midpoint of every interval against the polynomials
+    const ordinal_type numberIntervals = numberTemperatures - 1;
+    real_type_2d_view_host hiPolynomial("thermoTable hi polynomial", numberIntervals, nSpec);
+    real_type_2d_view_host cpiPolynomial("thermoTable cpi polynomial", numberIntervals, nSpec);
+    real_type_2d_view_host hiTable("thermoTable hi table", numberIntervals, nSpec);
+    real_type_2d_view_host cpiTable("thermoTable cpi table", numberIntervals, nSpec);
+    Kokkos::parallel_for(
+        "thermoTableCheck", host_policy_type(numberIntervals, Kokkos::AUTO()), KOKKOS_LAMBDA(const typename host_policy_type::member_type& member) {
+            const ordinal_type j = member.league_rank();
+            const real_type temperature = temperatureMinimum + (j + 0.5) * deltaTemperature;
+            const real_type_1d_view_host_type hiPolynomialAtJ = Kokkos::subview(hiPolynomial, j, Kokkos::ALL());
+            const real_type_1d_view_host_type cpiPolynomialAtJ = Kokkos::subview(cpiPolynomial, j, Kokkos::ALL());
+            const real_type_1d_view_host_type hiTableAtJ = Kokkos::subview(hiTable, j, Kokkos::ALL());
+            const real_type_1d_view_host_type cpiTableAtJ = Kokkos::subview(cpiTable, j, Kokkos::ALL());
+            tChemLib::Impl::EnthalpySpecMlFcn<real_type, host_device_type>::team_invoke(member, temperature, hiPolynomialAtJ, cpiPolynomialAtJ, kmcd);
+            hostTable.team_invoke(member, temperature, hiTableAtJ, cpiTableAtJ);
+        });
+    Kokkos::fence();
+
+    real_type maximumError = 0.0;
+    real_type maximumErrorTemperature = temperatureMinimum;
+    for (ordinal_type j = 0; j < numberIntervals; j++) {
+        const real_type temperature = temperatureMinimum + (j + 0.5) * deltaTemperature;
+        for (ordinal_type k = 0; k < nSpec; k++) {
+            // scale the enthalpy error by cp*T so that species with near zero enthalpy do not dominate
+            const real_type hScale = PetscMax(PetscAbs(hiPolynomial(j, k)), PetscAbs(cpiPolynomial(j, k)) * temperature);
+            const real_type hError = PetscAbs(hiTable(j, k) - hiPolynomial(j, k)) / (hScale + 1E-30);
+            const real_type cpError = PetscAbs(cpiTable(j, k) - cpiPolynomial(j, k)) / (PetscAbs(cpiPolynomial(j, k)) + 1E-30);
+            if (PetscMax(hError, cpError) > maximumError) {
+                maximumError = PetscMax(hError, cpError);
+                maximumErrorTemperature = temperature;
+            }
+        }
+    }
+    if (maximumError > tolerance) {
+        throw std::invalid_argument("The ablate::eos::tChem::ThermoTable relative error (" + std::to_string(maximumError) + " at T=" + std::to_string(maximumErrorTemperature) +
+                                    ") is larger than the tolerance (" + std::to_string(tolerance) + "). Decrease the deltaTemperature or use cubic interpolation.");
+    }
+
+    // copy the table to the device
+    ThermoTable<device_type> deviceTable{.temperatureMinimum = hostTable.temperatureMinimum,
+                                         .temperatureMaximum = hostTable.temperatureMaximum,
+                                         .deltaTemperature = hostTable.deltaTemperature,
+                                         .inverseDeltaTemperature = hostTable.inverseDeltaTemperature,
+                                         .cubic = hostTable.cubic,
+                                         .hi = ThermoTable<device_type>::real_type_2d_view_type("thermoTable hi", numberTemperatures, nSpec),
+                                         .cpi = ThermoTable<device_type>::real_type_2d_view_type("thermoTable cpi", numberTemperatures, nSpec)};
+    Kokkos::deep_copy(deviceTable.hi, hostTable.hi);
+    Kokkos::deep_copy(deviceTable.cpi, hostTable.cpi);
+    return deviceTable;
+}
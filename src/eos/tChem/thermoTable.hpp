@@ -0,0 +1,101 @@
+#ifndef ABLATELIBRARY_TCHEM_THERMOTABLE_HPP
+#define ABLATELIBRARY_TCHEM_THERMOTABLE_HPP
+
+#include <TChem_Impl_EnthalpySpecMl.hpp>
+#include "TChem_KineticModelData.hpp"
+#include "TChem_Util.hpp"
+
+namespace tChemLib = TChem;
+
+namespace ablate::eos::tChem {
+
+/**
+ * Optional uniformly spaced temperature table of the per species molar enthalpy and specific heat.  The table is stored species-contiguous (temperature major) so that the
+ * lookup for all species at a single temperature is a contiguous, vectorizable read.  The enthalpy uses cubic hermite interpolation (with cp as the exact derivative) or linear
+ * interpolation, temperatures outside of the table fall back to the NASA polynomials.
+ */
+template <typename DeviceType>
+struct ThermoTable {
+    using device_type = DeviceType;
+    using real_type_2d_view_type = Tines::value_type_2d_view<real_type, device_type>;
+
+    //! the first temperature in the table
+    real_type temperatureMinimum = 0.0;
+    //! the last temperature in the table
+    real_type temperatureMaximum = -1.0;
+    //! the temperature spacing and inverse spacing
+    real_type deltaTemperature = 0.0;
+    real_type inverseDeltaTemperature = 0.0;
+    //! use cubic hermite interpolation for the enthalpy
+    bool cubic = true;
+    //! the molar enthalpy (nT x nSpec)
+    real_type_2d_view_type hi;
+    //! the molar specific heat (nT x nSpec)
+    real_type_2d_view_type cpi;
+
+    /**
+     * the table is only used when it was created and the temperature is inside the table
+     */
+    KOKKOS_INLINE_FUNCTION bool Contains(const real_type temperature) const { return temperature >= temperatureMinimum && temperature < temperatureMaximum; }
+
+    /**
+     * compute the molar enthalpy and specific heat of all species at temperature, the result matches tChemLib::Impl::EnthalpySpecMlFcn
+     */
+    template <typename MemberType, typename ValueType>
+    KOKKOS_INLINE_FUNCTION void team_invoke(const MemberType& member, const ValueType& temperature, const Tines::value_type_1d_view<ValueType, device_type>& hiOut,
+                                            const Tines::value_type_1d_view<ValueType, device_type>& cpOut) const {
+        const real_type position = (temperature - temperatureMinimum) * inverseDeltaTemperature;
+        const ordinal_type j = (ordinal_type)position;
+        const real_type s = position - j;
+        const ordinal_type nSpec = (ordinal_type)hi.extent(1);
+
+        if (cubic) {
+            const real_type s2 = s * s;
+            const real_type s3 = s2 * s;
+            const real_type h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+            const real_type h10 = (s3 - 2.0 * s2 + s) * deltaTemperature;
+            const real_type h01 = -2.0 * s3 + 3.0 * s2;
+            const real_type h11 = (s3 - s2) * deltaTemperature;
+            const real_type d00 = (6.0 * s2 - 6.0 * s) * inverseDeltaTemperature;
+            const real_type d10 = 3.0 * s2 - 4.0 * s + 1.0;
+            const real_type d11 = 3.0 * s2 - 2.0 * s;
+            Kokkos::parallel_for(Tines::RangeFactory<ValueType>::TeamVectorRange(member, nSpec), [&](const ordinal_type& k) {
+                hiOut(k) = h00 * hi(j, k) + h10 * cpi(j, k) + h01 * hi(j + 1, k) + h11 * cpi(j + 1, k);
+                cpOut(k) = d00 * (hi(j, k) - hi(j + 1, k)) + d10 * cpi(j, k) + d11 * cpi(j + 1, k);
+            });
+        } else {
+            Kokkos::parallel_for(Tines::RangeFactory<ValueType>::TeamVectorRange(member, nSpec), [&](const ordinal_type& k) {
+                hiOut(k) = hi(j, k) + s * (hi(j + 1, k) - hi(j, k));
+                cpOut(k) = cpi(j, k) + s * (cpi(j + 1, k) - cpi(j, k));
+            });
+        }
+    }
+};
+
+/**
+ * Compute the per species molar enthalpy and specific heat using the thermo table when it contains the temperature, otherwise the NASA polynomials
+ */
+template <typename ValueType, typename DeviceType, typename MemberType, typename KineticModelConstDataType>
+KOKKOS_INLINE_FUNCTION void EnthalpySpecMl(const MemberType& member, const ValueType& temperature, const Tines::value_type_1d_view<ValueType, DeviceType>& hi,
+                                           const Tines::value_type_1d_view<ValueType, DeviceType>& cpks, const KineticModelConstDataType& kmcd, const ThermoTable<DeviceType>& thermoTable) {
+    if (thermoTable.Contains(temperature)) {
+        thermoTable.team_invoke(member, temperature, hi, cpks);
+    } else {
+        tChemLib::Impl::EnthalpySpecMlFcn<ValueType, DeviceType>::team_invoke(member, temperature, hi, cpks, kmcd);
+    }
+}
+
+/**
+ * Build the thermo table on the host, check the interpolation error against the NASA polynomials at the midpoints of every interval, and copy it to the device.
+ * @param kineticsModel the kinetics model to tabulate
+ * @param temperatureMinimum the first temperature in the table
+ * @param temperatureMaximum the maximum temperature in the table
+ * @param deltaTemperature the uniform spacing of the table
+ * @param cubic use cubic hermite interpolation of the enthalpy
+ * @param tolerance the maximum relative error of h and cp allowed for the table
+ */
+ThermoTable<typename Tines::UseThisDevice<exec_space>::type> CreateThermoTable(tChemLib::KineticModelData& kineticsModel, real_type temperatureMinimum, real_type temperatureMaximum,
+                                                                              real_type deltaTemperature, bool cubic, real_type tolerance);
+
+}  // namespace ablate::eos::tChem
+#endif
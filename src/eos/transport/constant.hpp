@@ -46,6 +46,11 @@ class Constant : public TransportModel {
      * @return
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetTransportTemperatureFunction(TransportProperty property, const std::vector<domain::Field>& fields) const override;
+    /**
+     * The constant functions only read the value in their context
+     * @return
+     */
+    [[nodiscard]] bool ThreadSafe() const override { return true; }
 };
 }  // namespace ablate::eos::transport
 #endif  // ABLATELIBRARY_CONSTANT_HPP
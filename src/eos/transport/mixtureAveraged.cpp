@@ -0,0 +1,458 @@
+#include "mixtureAveraged.hpp"
+#include <yaml-cpp/yaml.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include "environment/fileBroadcast.hpp"
+#include "eos/tChem.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "utilities/petscError.hpp"
+
+namespace {
+//! physical constants in SI (kmol based) units
+constexpr PetscReal boltzmann = 1.380649E-23;
+constexpr PetscReal avogadro = 6.02214076E26;
+constexpr PetscReal universalGasConstant = boltzmann * avogadro;
+constexpr PetscReal vacuumPermittivity = 8.8541878128E-12;
+constexpr PetscReal debye = 3.33564E-30;
+constexpr PetscReal angstrom = 1E-10;
+
+//! the number of temperatures used for each fit
+constexpr std::size_t numberFitTemperatures = 50;
+}  // namespace
+
+ablate::eos::transport::MixtureAveraged::MixtureAveraged(std::shared_ptr<eos::EOS> eosIn, const std::filesystem::path& transportFile, PetscReal temperatureMinimum, PetscReal temperatureMaximum)
+    : MixtureAveraged(
+          eosIn,
+          [&eosIn, &transportFile]() {
+              if (!transportFile.empty()) {
+                  return ReadTransportParameters(transportFile);
+              }
+              auto tChem = std::dynamic_pointer_cast<eos::TChem>(eosIn);
+              if (!tChem) {
+                  throw std::invalid_argument("ablate::eos::transport::MixtureAveraged requires a transportFile when not using ablate::eos::TChem");
+              }
+              return ReadTransportParameters(tChem->GetMechanismFile());
+          }(),
+          [&eosIn]() {
+              auto tChem = std::dynamic_pointer_cast<eos::TChem>(eosIn);
+              if (!tChem) {
+                  throw std::invalid_argument("ablate::eos::transport::MixtureAveraged requires the species molecular weight from ablate::eos::TChem");
+              }
+              return tChem->GetSpeciesMolecularMass();
+          }(),
+          temperatureMinimum > 0.0 ? temperatureMinimum : 200.0, temperatureMaximum > 0.0 ? temperatureMaximum : 3500.0) {}
+
+ablate::eos::transport::MixtureAveraged::MixtureAveraged(std::shared_ptr<eos::EOS> eosIn, const std::map<std::string, SpeciesTransportParameters>& parameters,
+                                                         const std::map<std::string, double>& molecularWeights, PetscReal temperatureMinimum, PetscReal temperatureMaximum)
+    : eos(std::move(eosIn)), speciesData(std::make_shared<SpeciesData>()) {
+    if (temperatureMaximum <= temperatureMinimum) {
+        throw std::invalid_argument("ablate::eos::transport::MixtureAveraged requires temperatureMaximum > temperatureMinimum");
+    }
+
+    // gather the per species information in the eos order
+    const auto& species = eos->GetSpeciesVariables();
+    const auto nSpec = (PetscInt)species.size();
+    std::vector<SpeciesTransportParameters> speciesParameters;
+    speciesData->numberSpecies = nSpec;
+    for (const auto& name : species) {
+        auto parameter = parameters.find(name);
+        if (parameter == parameters.end()) {
+            throw std::invalid_argument("ablate::eos::transport::MixtureAveraged cannot find transport parameters for species " + name);
+        }
+        speciesParameters.push_back(parameter->second);
+        auto molecularWeight = molecularWeights.find(name);
+        if (molecularWeight == molecularWeights.end()) {
+            throw std::invalid_argument("ablate::eos::transport::MixtureAveraged cannot find the molecular weight for species " + name);
+        }
+        speciesData->molecularWeight.push_back(molecularWeight->second);
+    }
+
+    // set up the fit temperatures equally spaced in ln(T)
+    speciesData->logTemperatureMinimum = PetscLogReal(temperatureMinimum);
+    speciesData->logTemperatureMaximum = PetscLogReal(temperatureMaximum);
+    speciesData->logTemperatureReference = 0.5 * (speciesData->logTemperatureMinimum + speciesData->logTemperatureMaximum);
+    std::vector<PetscReal> fitTemperature(numberFitTemperatures);
+    std::vector<PetscReal> fitX(numberFitTemperatures);
+    for (std::size_t t = 0; t < numberFitTemperatures; t++) {
+        const PetscReal logT = speciesData->logTemperatureMinimum + (speciesData->logTemperatureMaximum - speciesData->logTemperatureMinimum) * (PetscReal)t / (numberFitTemperatures - 1);
+        fitTemperature[t] = PetscExpReal(logT);
+        fitX[t] = logT - speciesData->logTemperatureReference;
+    }
+
+    // compute the species cp at every fit temperature from the species sensible enthalpy using a fake state
+    std::vector<domain::Field> fakeFields = {domain::Field{.name = finiteVolume::CompressibleFlowFields::EULER_FIELD, .numberComponents = 3, .offset = 0},
+                                             domain::Field{.name = finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD, .numberComponents = nSpec, .offset = 3}};
+    auto speciesEnthalpyFunction = eos->GetThermodynamicTemperatureFunction(ThermodynamicProperty::SpeciesSensibleEnthalpy, fakeFields);
+    std::vector<PetscReal> fakeConserved(3 + nSpec, 0.0);
+    fakeConserved[finiteVolume::CompressibleFlowFields::RHO] = 1.0;
+    fakeConserved[3] = 1.0;
+    std::vector<std::vector<PetscReal>> speciesCp(numberFitTemperatures, std::vector<PetscReal>(nSpec));
+    {
+        std::vector<PetscReal> hiPlus(nSpec), hiMinus(nSpec);
+        const PetscReal deltaT = 0.5;
+        for (std::size_t t = 0; t < numberFitTemperatures; t++) {
+            speciesEnthalpyFunction.function(fakeConserved.data(), fitTemperature[t] + deltaT, hiPlus.data(), speciesEnthalpyFunction.context.get()) >> checkError;
+            speciesEnthalpyFunction.function(fakeConserved.data(), fitTemperature[t] - deltaT, hiMinus.data(), speciesEnthalpyFunction.context.get()) >> checkError;
+            for (PetscInt k = 0; k < nSpec; k++) {
+                speciesCp[t][k] = (hiPlus[k] - hiMinus[k]) / (2.0 * deltaT);
+            }
+        }
+    }
+
+    // compute the reduced dipole moment for each species
+    std::vector<PetscReal> reducedDipole(nSpec);
+    for (PetscInt k = 0; k < nSpec; k++) {
+        const auto& p = speciesParameters[k];
+        const PetscReal sigma = p.diameter * angstrom;
+        reducedDipole[k] = 0.5 * PetscSqr(p.dipole * debye) / (4.0 * PETSC_PI * vacuumPermittivity * p.wellDepth * boltzmann * sigma * sigma * sigma);
+    }
+
+    // fit the species viscosity (Chapman-Enskog) and conductivity (modified Eucken)
+    speciesData->viscosityFit.resize(nSpec * fitOrder);
+    speciesData->conductivityFit.resize(nSpec * fitOrder);
+    std::vector<PetscReal> logViscosity(numberFitTemperatures), logConductivity(numberFitTemperatures);
+    for (PetscInt k = 0; k < nSpec; k++) {
+        const auto& p = speciesParameters[k];
+        const PetscReal mass = speciesData->molecularWeight[k] / avogadro;
+        const PetscReal sigma = p.diameter * angstrom;
+        for (std::size_t t = 0; t < numberFitTemperatures; t++) {
+            const PetscReal temperature = fitTemperature[t];
+            const PetscReal mu = 5.0 / 16.0 * PetscSqrtReal(PETSC_PI * mass * boltzmann * temperature) / (PETSC_PI * sigma * sigma * CollisionIntegral22(temperature / p.wellDepth, reducedDipole[k]));
+            logViscosity[t] = PetscLogReal(mu);
+            logConductivity[t] = PetscLogReal(mu * (speciesCp[t][k] + 1.25 * universalGasConstant / speciesData->molecularWeight[k]));
+        }
+        auto viscosityFit = Fit(fitX, logViscosity);
+        auto conductivityFit = Fit(fitX, logConductivity);
+        std::copy(viscosityFit.begin(), viscosityFit.end(), speciesData->viscosityFit.begin() + k * fitOrder);
+        std::copy(conductivityFit.begin(), conductivityFit.end(), speciesData->conductivityFit.begin() + k * fitOrder);
+    }
+
+    // fit the pressure scaled binary diffusion coefficients for every pair
+    speciesData->diffusivityFit.resize(nSpec * nSpec * fitOrder);
+    std::vector<PetscReal> logDiffusivity(numberFitTemperatures);
+    for (PetscInt k = 0; k < nSpec; k++) {
+        for (PetscInt j = k; j < nSpec; j++) {
+            const PetscReal reducedMass = speciesData->molecularWeight[k] * speciesData->molecularWeight[j] / (speciesData->molecularWeight[k] + speciesData->molecularWeight[j]) / avogadro;
+            const PetscReal sigma = 0.5 * (speciesParameters[k].diameter + speciesParameters[j].diameter) * angstrom;
+            const PetscReal wellDepth = PetscSqrtReal(speciesParameters[k].wellDepth * speciesParameters[j].wellDepth);
+            const PetscReal dipole = PetscSqrtReal(reducedDipole[k] * reducedDipole[j]);
+            for (std::size_t t = 0; t < numberFitTemperatures; t++) {
+                const PetscReal temperature = fitTemperature[t];
+                const PetscReal pressureDiffusivity = 3.0 / 16.0 * PetscSqrtReal(2.0 * PETSC_PI * PetscPowReal(boltzmann * temperature, 3) / reducedMass) /
+                                                      (PETSC_PI * sigma * sigma * CollisionIntegral11(temperature / wellDepth, dipole));
+                logDiffusivity[t] = PetscLogReal(pressureDiffusivity);
+            }
+            auto diffusivityFit = Fit(fitX, logDiffusivity);
+            std::copy(diffusivityFit.begin(), diffusivityFit.end(), speciesData->diffusivityFit.begin() + (k * nSpec + j) * fitOrder);
+            std::copy(diffusivityFit.begin(), diffusivityFit.end(), speciesData->diffusivityFit.begin() + (j * nSpec + k) * fitOrder);
+        }
+    }
+
+    // precompute the molecular weight only parts of the Wilke mixing rule
+    speciesData->wilkeA.resize(nSpec * nSpec);
+    speciesData->wilkeB.resize(nSpec * nSpec);
+    for (PetscInt k = 0; k < nSpec; k++) {
+        for (PetscInt j = 0; j < nSpec; j++) {
+            speciesData->wilkeA[k * nSpec + j] = 1.0 / PetscSqrtReal(8.0 * (1.0 + speciesData->molecularWeight[k] / speciesData->molecularWeight[j]));
+            speciesData->wilkeB[k * nSpec + j] = PetscPowReal(speciesData->molecularWeight[j] / speciesData->molecularWeight[k], 0.25);
+        }
+    }
+}
+
+std::map<std::string, ablate::eos::transport::MixtureAveraged::SpeciesTransportParameters> ablate::eos::transport::MixtureAveraged::ReadTransportParameters(
+    const std::filesystem::path& transportFile) {
+    std::map<std::string, SpeciesTransportParameters> parameters;
+
+    // when broadcasting files only the root rank reads the transport file from the shared file system
+    std::istringstream file(environment::FileBroadcast::ReadContents(transportFile));
+    if (transportFile.extension() == ".yaml" || transportFile.extension() == ".yml") {
+        // Cantera yaml species transport
+        auto yaml = YAML::Load(file);
+        for (const auto& species : yaml["species"]) {
+            const auto& transport = species["transport"];
+            if (!transport) {
+                continue;
+            }
+            parameters[species["name"].as<std::string>()] = SpeciesTransportParameters{.wellDepth = transport["well-depth"].as<PetscReal>(),
+                                                                                        .diameter = transport["diameter"].as<PetscReal>(),
+                                                                                        .dipole = transport["dipole"] ? transport["dipole"].as<PetscReal>() : 0.0};
+        }
+    } else {
+        // CHEMKIN transport format: name geometry wellDepth diameter dipole polarizability rotationalRelaxation
+        std::string line;
+        while (std::getline(file, line)) {
+            line = line.substr(0, line.find('!'));
+            std::istringstream lineStream(line);
+            std::string name;
+            int geometry;
+            SpeciesTransportParameters parameter{};
+            if (lineStream >> name >> geometry >> parameter.wellDepth >> parameter.diameter >> parameter.dipole) {
+                parameters[name] = parameter;
+            }
+        }
+    }
+    return parameters;
+}
+
+std::array<PetscReal, ablate::eos::transport::MixtureAveraged::fitOrder> ablate::eos::transport::MixtureAveraged::Fit(const std::vector<PetscReal>& x, const std::vector<PetscReal>& values) {
+    // build the normal equations
+    PetscReal a[fitOrder][fitOrder + 1] = {};
+    for (std::size_t i = 0; i < x.size(); i++) {
+        PetscReal powers[fitOrder];
+        powers[0] = 1.0;
+        for (std::size_t n = 1; n < fitOrder; n++) {
+            powers[n] = powers[n - 1] * x[i];
+        }
+        for (std::size_t r = 0; r < fitOrder; r++) {
+            for (std::size_t c = 0; c < fitOrder; c++) {
+                a[r][c] += powers[r] * powers[c];
+            }
+            a[r][fitOrder] += powers[r] * values[i];
+        }
+    }
+
+    // solve with gaussian elimination and partial pivoting
+    for (std::size_t c = 0; c < fitOrder; c++) {
+        std::size_t pivot = c;
+        for (std::size_t r = c + 1; r < fitOrder; r++) {
+            if (PetscAbs(a[r][c]) > PetscAbs(a[pivot][c])) {
+                pivot = r;
+            }
+        }
+        std::swap(a[c], a[pivot]);
+        for (std::size_t r = c + 1; r < fitOrder; r++) {
+            const PetscReal factor = a[r][c] / a[c][c];
+            for (std::size_t k = c; k <= fitOrder; k++) {
+                a[r][k] -= factor * a[c][k];
+            }
+        }
+    }
+    std::array<PetscReal, fitOrder> coefficients{};
+    for (std::size_t r = fitOrder; r-- > 0;) {
+        PetscReal sum = a[r][fitOrder];
+        for (std::size_t c = r + 1; c < fitOrder; c++) {
+            sum -= a[r][c] * coefficients[c];
+        }
+        coefficients[r] = sum / a[r][r];
+    }
+    return coefficients;
+}
+
+PetscReal ablate::eos::transport::MixtureAveraged::CollisionIntegral11(PetscReal reducedTemperature, PetscReal reducedDipole) {
+    return 1.06036 / PetscPowReal(reducedTemperature, 0.15610) + 0.19300 * PetscExpReal(-0.47635 * reducedTemperature) + 1.03587 * PetscExpReal(-1.52996 * reducedTemperature) +
+           1.76474 * PetscExpReal(-3.89411 * reducedTemperature) + 0.19 * reducedDipole * reducedDipole / reducedTemperature;
+}
+
+PetscReal ablate::eos::transport::MixtureAveraged::CollisionIntegral22(PetscReal reducedTemperature, PetscReal reducedDipole) {
+    return 1.16145 * PetscPowReal(reducedTemperature, -0.14874) + 0.52487 * PetscExpReal(-0.77320 * reducedTemperature) + 2.16178 * PetscExpReal(-2.43787 * reducedTemperature) +
+           0.2 * reducedDipole * reducedDipole / reducedTemperature;
+}
+
+PetscErrorCode ablate::eos::transport::MixtureAveraged::Evaluator::Evaluate(const PetscReal* conserved, PetscReal temperature) {
+    PetscFunctionBeginUser;
+    const auto nSpec = data->numberSpecies;
+    const PetscReal density = conserved[eulerOffset + finiteVolume::CompressibleFlowFields::RHO];
+
+    // check to see if this state has already been computed
+    if (cachedState[0] == temperature && cachedState[1] == density && std::equal(cachedState.begin() + 2, cachedState.end(), conserved + densityYiOffset)) {
+        PetscFunctionReturn(0);
+    }
+    cachedState[0] = temperature;
+    cachedState[1] = density;
+    std::copy(conserved + densityYiOffset, conserved + densityYiOffset + nSpec, cachedState.begin() + 2);
+
+    // compute the mass and mole fractions
+    PetscReal inverseMolecularWeight = 0.0;
+    for (PetscInt k = 0; k < nSpec; k++) {
+        yi[k] = PetscMin(PetscMax(conserved[densityYiOffset + k] / density, 0.0), 1.0);
+        inverseMolecularWeight += yi[k] / data->molecularWeight[k];
+    }
+    for (PetscInt k = 0; k < nSpec; k++) {
+        xi[k] = yi[k] / data->molecularWeight[k] / inverseMolecularWeight;
+    }
+
+    // the polynomial powers of ln(T) limited to the fit range
+    const PetscReal x = PetscMin(PetscMax(PetscLogReal(temperature), data->logTemperatureMinimum), data->logTemperatureMaximum) - data->logTemperatureReference;
+    PetscReal powers[fitOrder];
+    powers[0] = 1.0;
+    for (std::size_t n = 1; n < fitOrder; n++) {
+        powers[n] = powers[n - 1] * x;
+    }
+    auto evaluateFit = [&powers](const PetscReal* coefficients) {
+        PetscReal value = 0.0;
+        for (std::size_t n = 0; n < fitOrder; n++) {
+            value += coefficients[n] * powers[n];
+        }
+        return PetscExpReal(value);
+    };
+
+    // species viscosity and conductivity
+    for (PetscInt k = 0; k < nSpec; k++) {
+        speciesViscosity[k] = evaluateFit(&data->viscosityFit[k * fitOrder]);
+        speciesConductivity[k] = evaluateFit(&data->conductivityFit[k * fitOrder]);
+    }
+
+    // Wilke viscosity and Mathur conductivity mixing rules
+    viscosity = 0.0;
+    PetscReal conductivitySum = 0.0;
+    PetscReal inverseConductivitySum = 0.0;
+    for (PetscInt k = 0; k < nSpec; k++) {
+        if (xi[k] <= 0.0) {
+            continue;
+        }
+        PetscReal phiSum = 0.0;
+        for (PetscInt j = 0; j < nSpec; j++) {
+            const PetscReal phi = data->wilkeA[k * nSpec + j] * PetscSqr(1.0 + PetscSqrtReal(speciesViscosity[k] / speciesViscosity[j]) * data->wilkeB[k * nSpec + j]);
+            phiSum += xi[j] * phi;
+        }
+        viscosity += xi[k] * speciesViscosity[k] / phiSum;
+        conductivitySum += xi[k] * speciesConductivity[k];
+        inverseConductivitySum += xi[k] / speciesConductivity[k];
+    }
+    conductivity = 0.5 * (conductivitySum + 1.0 / inverseConductivitySum);
+
+    // mixture averaged species diffusivity
+    PetscReal pressure;
+    PetscCall(pressureFunction.function(conserved, temperature, &pressure, pressureFunction.context.get()));
+    diffusivity = 0.0;
+    for (PetscInt k = 0; k < nSpec; k++) {
+        PetscReal sum = 0.0;
+        for (PetscInt j = 0; j < nSpec; j++) {
+            if (j != k) {
+                sum += xi[j] / evaluateFit(&data->diffusivityFit[(k * nSpec + j) * fitOrder]);
+            }
+        }
+        // a pure species uses the self diffusion coefficient
+        speciesDiffusivity[k] = (sum > 0.0 ? (1.0 - yi[k]) / sum : evaluateFit(&data->diffusivityFit[(k * nSpec + k) * fitOrder])) / pressure;
+        diffusivity += yi[k] * speciesDiffusivity[k];
+    }
+
+    PetscFunctionReturn(0);
+}
+
+std::shared_ptr<ablate::eos::transport::MixtureAveraged::Evaluator> ablate::eos::transport::MixtureAveraged::GetEvaluator(const std::vector<domain::Field>& fields) const {
+    auto eulerField = std::find_if(fields.begin(), fields.end(), [](const auto& field) { return field.name == finiteVolume::CompressibleFlowFields::EULER_FIELD; });
+    auto densityYiField = std::find_if(fields.begin(), fields.end(), [](const auto& field) { return field.name == finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD; });
+    if (eulerField == fields.end() || densityYiField == fields.end()) {
+        throw std::invalid_argument("ablate::eos::transport::MixtureAveraged requires the " + finiteVolume::CompressibleFlowFields::EULER_FIELD + " and " +
+                                    finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD + " fields");
+    }
+
+    // reuse the evaluator for this layout so the properties are computed in a single pass
+    for (const auto& evaluator : evaluators) {
+        if (evaluator->eulerOffset == eulerField->offset && evaluator->densityYiOffset == densityYiField->offset) {
+            return evaluator;
+        }
+    }
+
+    const auto nSpec = speciesData->numberSpecies;
+    auto evaluator = std::make_shared<Evaluator>();
+    evaluator->data = speciesData;
+    evaluator->eulerOffset = eulerField->offset;
+    evaluator->densityYiOffset = densityYiField->offset;
+    evaluator->temperatureFunction = eos->GetThermodynamicFunction(ThermodynamicProperty::Temperature, fields);
+    evaluator->pressureFunction = eos->GetThermodynamicTemperatureFunction(ThermodynamicProperty::Pressure, fields);
+    evaluator->cachedState = std::vector<PetscReal>(nSpec + 2, NAN);
+    evaluator->speciesDiffusivity.resize(nSpec);
+    evaluator->yi.resize(nSpec);
+    evaluator->xi.resize(nSpec);
+    evaluator->speciesViscosity.resize(nSpec);
+    evaluator->speciesConductivity.resize(nSpec);
+    evaluators.push_back(evaluator);
+    return evaluator;
+}
+
+PetscErrorCode ablate::eos::transport::MixtureAveraged::ConductivityFunction(const PetscReal* conserved, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto evaluator = (Evaluator*)ctx;
+    PetscReal temperature;
+    PetscCall(evaluator->temperatureFunction.function(conserved, &temperature, evaluator->temperatureFunction.context.get()));
+    PetscCall(ConductivityTemperatureFunction(conserved, temperature, property, ctx));
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::transport::MixtureAveraged::ConductivityTemperatureFunction(const PetscReal* conserved, PetscReal temperature, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto evaluator = (Evaluator*)ctx;
+    PetscCall(evaluator->Evaluate(conserved, temperature));
+    *property = evaluator->conductivity;
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::transport::MixtureAveraged::ViscosityFunction(const PetscReal* conserved, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto evaluator = (Evaluator*)ctx;
+    PetscReal temperature;
+    PetscCall(evaluator->temperatureFunction.function(conserved, &temperature, evaluator->temperatureFunction.context.get()));
+    PetscCall(ViscosityTemperatureFunction(conserved, temperature, property, ctx));
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::transport::MixtureAveraged::ViscosityTemperatureFunction(const PetscReal* conserved, PetscReal temperature, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto evaluator = (Evaluator*)ctx;
+    PetscCall(evaluator->Evaluate(conserved, temperature));
+    *property = evaluator->viscosity;
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::transport::MixtureAveraged::DiffusivityFunction(const PetscReal* conserved, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto evaluator = (Evaluator*)ctx;
+    PetscReal temperature;
+    PetscCall(evaluator->temperatureFunction.function(conserved, &temperature, evaluator->temperatureFunction.context.get()));
+    PetscCall(DiffusivityTemperatureFunction(conserved, temperature, property, ctx));
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::transport::MixtureAveraged::DiffusivityTemperatureFunction(const PetscReal* conserved, PetscReal temperature, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto evaluator = (Evaluator*)ctx;
+    PetscCall(evaluator->Evaluate(conserved, temperature));
+    *property = evaluator->diffusivity;
+    PetscFunctionReturn(0);
+}
+PetscErrorCode ablate::eos::transport::MixtureAveraged::SpeciesDiffusivityTemperatureFunction(const PetscReal* conserved, PetscReal temperature, PetscReal* property, void* ctx) {
+    PetscFunctionBeginUser;
+    auto evaluator = (Evaluator*)ctx;
+    PetscCall(evaluator->Evaluate(conserved, temperature));
+    std::copy(evaluator->speciesDiffusivity.begin(), evaluator->speciesDiffusivity.end(), property);
+    PetscFunctionReturn(0);
+}
+
+ablate::eos::ThermodynamicFunction ablate::eos::transport::MixtureAveraged::GetTransportFunction(ablate::eos::transport::TransportProperty property,
+                                                                                                 const std::vector<domain::Field>& fields) const {
+    switch (property) {
+        case TransportProperty::Conductivity:
+            return ThermodynamicFunction{.function = ConductivityFunction, .context = GetEvaluator(fields)};
+        case TransportProperty::Viscosity:
+            return ThermodynamicFunction{.function = ViscosityFunction, .context = GetEvaluator(fields)};
+        case TransportProperty::Diffusivity:
+            return ThermodynamicFunction{.function = DiffusivityFunction, .context = GetEvaluator(fields)};
+        default:
+            throw std::invalid_argument("Unknown transport property ablate::eos::transport::MixtureAveraged");
+    }
+}
+
+ablate::eos::ThermodynamicTemperatureFunction ablate::eos::transport::MixtureAveraged::GetTransportTemperatureFunction(ablate::eos::transport::TransportProperty property,
+                                                                                                                       const std::vector<domain::Field>& fields) const {
+    switch (property) {
+        case TransportProperty::Conductivity:
+            return ThermodynamicTemperatureFunction{.function = ConductivityTemperatureFunction, .context = GetEvaluator(fields)};
+        case TransportProperty::Viscosity:
+            return ThermodynamicTemperatureFunction{.function = ViscosityTemperatureFunction, .context = GetEvaluator(fields)};
+        case TransportProperty::Diffusivity:
+            return ThermodynamicTemperatureFunction{.function = DiffusivityTemperatureFunction, .context = GetEvaluator(fields)};
+        default:
+            throw std::invalid_argument("Unknown transport property ablate::eos::transport::MixtureAveraged");
+    }
+}
+
+ablate::eos::ThermodynamicTemperatureFunction ablate::eos::transport::MixtureAveraged::GetSpeciesDiffusivityTemperatureFunction(const std::vector<domain::Field>& fields) const {
+    return ThermodynamicTemperatureFunction{.function = SpeciesDiffusivityTemperatureFunction, .context = GetEvaluator(fields)};
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::eos::transport::TransportModel, ablate::eos::transport::MixtureAveraged, "Mixture averaged transport model using the species Lennard-Jones parameters",
+         ARG(ablate::eos::EOS, "eos", "The EOS used to compute the temperature, pressure, and species cp.  The species molecular weight is provided by the TChem eos"),
+         OPT(std::filesystem::path, "transportFile", "optional Cantera yaml or CHEMKIN transport file (defaults to the TChem mechanism file)"),
+         OPT(double, "temperatureMinimum", "the minimum temperature used for the property fits (default is 200K)"),
+         OPT(double, "temperatureMaximum", "the maximum temperature used for the property fits (default is 3500K)"));
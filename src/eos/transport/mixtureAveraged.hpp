@@ -0,0 +1,184 @@
+#ifndef ABLATELIBRARY_MIXTUREAVERAGED_HPP
+#define ABLATELIBRARY_MIXTUREAVERAGED_HPP
+
+#include <array>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include "eos/eos.hpp"
+#include "transportModel.hpp"
+
+namespace ablate::eos::transport {
+
+/**
+ * Mixture averaged transport model using the species Lennard-Jones parameters.  The species viscosity/conductivity and the binary diffusion coefficients are fit as polynomials in
+ * ln(T) during setup and stored in contiguous arrays.  Viscosity (Wilke), conductivity (Mathur) and the mixture averaged species diffusivity are computed in a single pass that is
+ * cached and shared between all properties computed for the same state.
+ */
+class MixtureAveraged : public TransportModel {
+   public:
+    //! the number of coefficients used for each temperature fit
+    inline static constexpr std::size_t fitOrder = 5;
+
+    //! the Lennard-Jones transport parameters for each species
+    struct SpeciesTransportParameters {
+        //! the well depth (K)
+        PetscReal wellDepth;
+        //! the collision diameter (A)
+        PetscReal diameter;
+        //! the dipole moment (Debye)
+        PetscReal dipole = 0.0;
+    };
+
+   private:
+    /**
+     * The precomputed species/pair data shared by all evaluations
+     */
+    struct SpeciesData {
+        //! the number of species
+        PetscInt numberSpecies;
+        //! the molecular weight of each species
+        std::vector<PetscReal> molecularWeight;
+        //! the fit temperature range and the reference ln(T) used for the fit
+        PetscReal logTemperatureMinimum;
+        PetscReal logTemperatureMaximum;
+        PetscReal logTemperatureReference;
+        //! ln(mu_k) fit for each species (nSpec x fitOrder)
+        std::vector<PetscReal> viscosityFit;
+        //! ln(lambda_k) fit for each species (nSpec x fitOrder)
+        std::vector<PetscReal> conductivityFit;
+        //! ln(p*D_kj) fit for each species pair (nSpec x nSpec x fitOrder)
+        std::vector<PetscReal> diffusivityFit;
+        //! the constant parts of the Wilke mixing rule (nSpec x nSpec)
+        std::vector<PetscReal> wilkeA;
+        std::vector<PetscReal> wilkeB;
+    };
+
+    /**
+     * The evaluator shared by every function created for a specific field layout, it caches the last state so that the viscosity, conductivity, and diffusivity are computed once
+     */
+    struct Evaluator {
+        std::shared_ptr<const SpeciesData> data;
+        PetscInt eulerOffset;
+        PetscInt densityYiOffset;
+
+        //! eos functions used to compute the temperature and pressure
+        ThermodynamicFunction temperatureFunction;
+        ThermodynamicTemperatureFunction pressureFunction;
+
+        //! the cached state (temperature, density, densityYi) and the resulting properties
+        std::vector<PetscReal> cachedState;
+        PetscReal viscosity = 0.0;
+        PetscReal conductivity = 0.0;
+        PetscReal diffusivity = 0.0;
+        std::vector<PetscReal> speciesDiffusivity;
+
+        //! scratch space
+        std::vector<PetscReal> yi;
+        std::vector<PetscReal> xi;
+        std::vector<PetscReal> speciesViscosity;
+        std::vector<PetscReal> speciesConductivity;
+
+        /**
+         * Compute all properties for this state if they are not already cached
+         */
+        PetscErrorCode Evaluate(const PetscReal conserved[], PetscReal temperature);
+    };
+
+    //! the eos used for the pressure, temperature, and species enthalpy
+    const std::shared_ptr<eos::EOS> eos;
+
+    //! precomputed fits
+    std::shared_ptr<SpeciesData> speciesData;
+
+    //! evaluators are shared between all functions with the same field layout
+    mutable std::vector<std::shared_ptr<Evaluator>> evaluators;
+
+    /**
+     * get or create the evaluator for the field layout
+     */
+    std::shared_ptr<Evaluator> GetEvaluator(const std::vector<domain::Field>& fields) const;
+
+    /**
+     * read the species transport parameters from a Cantera yaml or CHEMKIN transport file
+     */
+    static std::map<std::string, SpeciesTransportParameters> ReadTransportParameters(const std::filesystem::path& transportFile);
+
+    /**
+     * least squares fit of the values as polynomial in x
+     */
+    static std::array<PetscReal, fitOrder> Fit(const std::vector<PetscReal>& x, const std::vector<PetscReal>& values);
+
+    /**
+     * The reduced collision integrals (Neufeld et al. with a Brokaw polar correction)
+     * @{
+     */
+    static PetscReal CollisionIntegral11(PetscReal reducedTemperature, PetscReal reducedDipole);
+    static PetscReal CollisionIntegral22(PetscReal reducedTemperature, PetscReal reducedDipole);
+    /** @} */
+
+    /** @name Direct and Temperature Based Transport Properties Functions
+     * These functions are used to compute the transport properties.
+     * @param conserved
+     * @param property
+     * @param ctx
+     * @return
+     * @{
+     */
+    static PetscErrorCode ConductivityFunction(const PetscReal conserved[], PetscReal* property, void* ctx);
+    static PetscErrorCode ConductivityTemperatureFunction(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
+    static PetscErrorCode ViscosityFunction(const PetscReal conserved[], PetscReal* property, void* ctx);
+    static PetscErrorCode ViscosityTemperatureFunction(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
+    static PetscErrorCode DiffusivityFunction(const PetscReal conserved[], PetscReal* property, void* ctx);
+    static PetscErrorCode DiffusivityTemperatureFunction(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
+    static PetscErrorCode SpeciesDiffusivityTemperatureFunction(const PetscReal conserved[], PetscReal temperature, PetscReal* property, void* ctx);
+    /** @} */
+
+   public:
+    /**
+     * Create the mixture averaged model from the species transport parameters
+     * @param eos the eos used for pressure, temperature, and species enthalpy.  The eos must provide the species molecular weight (TChem)
+     * @param transportFile Cantera yaml or CHEMKIN transport file.  If empty, the TChem mechanism file is used
+     * @param temperatureMinimum the minimum temperature of the fits
+     * @param temperatureMaximum the maximum temperature of the fits
+     */
+    explicit MixtureAveraged(std::shared_ptr<eos::EOS> eos, const std::filesystem::path& transportFile = {}, PetscReal temperatureMinimum = 200, PetscReal temperatureMaximum = 3500);
+
+    /**
+     * Create the mixture averaged model from the species transport parameters and molecular weights
+     * @param eos the eos used for pressure, temperature, and species enthalpy
+     * @param parameters the species transport parameters
+     * @param molecularWeights the species molecular weight
+     * @param temperatureMinimum the minimum temperature of the fits
+     * @param temperatureMaximum the maximum temperature of the fits
+     */
+    MixtureAveraged(std::shared_ptr<eos::EOS> eos, const std::map<std::string, SpeciesTransportParameters>& parameters, const std::map<std::string, double>& molecularWeights,
+                    PetscReal temperatureMinimum, PetscReal temperatureMaximum);
+
+    /**
+     * Single function to produce transport function for any property based upon the available fields
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicFunction GetTransportFunction(TransportProperty property, const std::vector<domain::Field>& fields) const override;
+
+    /**
+     * Single function to produce thermodynamic function for any property based upon the available fields and temperature.  The diffusivity is the mass fraction weighted species
+     * diffusivity.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicTemperatureFunction GetTransportTemperatureFunction(TransportProperty property, const std::vector<domain::Field>& fields) const override;
+
+    /**
+     * Computes the mixture averaged diffusivity of every species
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] ThermodynamicTemperatureFunction GetSpeciesDiffusivityTemperatureFunction(const std::vector<domain::Field>& fields) const override;
+};
+}  // namespace ablate::eos::transport
+
+#endif  // ABLATELIBRARY_MIXTUREAVERAGED_HPP
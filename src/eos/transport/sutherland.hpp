@@ -63,6 +63,11 @@ class Sutherland : public TransportModel {
      * @return
      */
     [[nodiscard]] ThermodynamicTemperatureFunction GetTransportTemperatureFunction(TransportProperty property, const std::vector<domain::Field>& fields) const override;
+    /**
+     * The sutherland functions are thread safe when the eos functions they call are
+     * @return
+     */
+    [[nodiscard]] bool ThreadSafe() const override { return eos->ThreadSafe(); }
 };
 }  // namespace ablate::eos::transport
 
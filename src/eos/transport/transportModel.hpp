@@ -8,6 +8,20 @@ namespace ablate::eos::transport {
 enum class TransportProperty { Conductivity, Viscosity, Diffusivity };
 
 class TransportModel {
+   private:
+    /**
+     * Default batch implementation that calls the single point ThermodynamicTemperatureFunction for each point
+     */
+    static PetscErrorCode TransportTemperatureBatchFromPointFunction(PetscInt n, const PetscReal conserved[], PetscInt conservedStride, const PetscReal temperature[], PetscInt temperatureStride,
+                                                                     PetscReal property[], PetscInt propertyStride, void* ctx) {
+        PetscFunctionBeginUser;
+        auto pointFunction = (ThermodynamicTemperatureFunction*)ctx;
+        for (PetscInt i = 0; i < n; i++) {
+            PetscCall(pointFunction->function(conserved + i * conservedStride, temperature[i * temperatureStride], property + i * propertyStride, pointFunction->context.get()));
+        }
+        PetscFunctionReturn(0);
+    }
+
    public:
     virtual ~TransportModel() = default;
 
@@ -26,6 +40,34 @@ class TransportModel {
      * @return
      */
     [[nodiscard]] virtual ThermodynamicTemperatureFunction GetTransportTemperatureFunction(TransportProperty property, const std::vector<domain::Field>& fields) const = 0;
+
+    /**
+     * Single function to produce a batch transport function for any property based upon the available fields and temperature.  The default implementation calls the
+     * ThermodynamicTemperatureFunction for each point, an empty function is returned if the model does not provide the property.
+     * @param property
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] virtual ThermodynamicTemperatureBatchFunction GetTransportTemperatureBatchFunction(TransportProperty property, const std::vector<domain::Field>& fields) const {
+        auto pointFunction = GetTransportTemperatureFunction(property, fields);
+        if (!pointFunction.function) {
+            return {};
+        }
+        return ThermodynamicTemperatureBatchFunction{.function = TransportTemperatureBatchFromPointFunction, .context = std::make_shared<ThermodynamicTemperatureFunction>(std::move(pointFunction))};
+    }
+
+    /**
+     * Optional function to compute the diffusivity of every species (one value per species).  Models with a single species independent diffusivity return an empty function.
+     * @param fields
+     * @return
+     */
+    [[nodiscard]] virtual ThermodynamicTemperatureFunction GetSpeciesDiffusivityTemperatureFunction(const std::vector<domain::Field>& fields) const { return {}; }
+
+    /**
+     * True if the functions produced by this model can be called concurrently, i.e. they do not write to any scratch space in their context
+     * @return
+     */
+    [[nodiscard]] virtual bool ThreadSafe() const { return false; }
 };
 
 /**
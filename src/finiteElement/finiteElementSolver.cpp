@@ -21,6 +21,35 @@ void ablate::finiteElement::FiniteElementSolver::Setup() {
         DMGetCoarseDM(cdm, &cdm) >> checkError;
     }
 
+    // check to see if the jacobian should be applied matrix-free
+    PetscBool matrixFreeJacobianOption = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-matrixFreeJacobian", &matrixFreeJacobianOption, nullptr) >> checkError;
+    matrixFreeJacobian = matrixFreeJacobianOption == PETSC_TRUE;
+    PetscOptionsGetInt(petscOptions, nullptr, "-preconditionerLag", &preconditionerLag, nullptr) >> checkError;
+    char presetName[PETSC_MAX_PATH_LEN] = "";
+    PetscOptionsGetString(petscOptions, nullptr, "-preconditionerPreset", presetName, PETSC_MAX_PATH_LEN, nullptr) >> checkError;
+    preconditionerPreset = presetName;
+    if (!preconditionerPreset.empty()) {
+        // check the preset name before the solve
+        GetPreconditionerPresetOptions(preconditionerPreset);
+    }
+    if (matrixFreeJacobian || !preconditionerPreset.empty()) {
+        RegisterPreStep([&](TS ts, Solver &) { ConfigureNonlinearSolver(ts); });
+    }
+
+    // check to see if the vectors and matrices should be device resident, this must be set before the domain creates the global vectors
+    PetscBool deviceVectorsOption = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-deviceVectors", &deviceVectorsOption, nullptr) >> checkError;
+    deviceVectors = deviceVectorsOption == PETSC_TRUE;
+    if (deviceVectors) {
+#if defined(PETSC_HAVE_KOKKOS_KERNELS)
+        DMSetVecType(subDomain->GetDM(), VECKOKKOS) >> checkError;
+        DMSetMatType(subDomain->GetDM(), MATAIJKOKKOS) >> checkError;
+#else
+        throw std::invalid_argument("The -deviceVectors option for the solver " + GetSolverId() + " requires PETSc to be built with Kokkos Kernels");
+#endif
+    }
+
     // Register the aux fields updater if specified
     if (!auxiliaryFieldsUpdaters.empty()) {
         RegisterPreStep([&](TS ts, Solver &) { UpdateAuxFields(ts, *this); });
@@ -40,6 +69,78 @@ void ablate::finiteElement::FiniteElementSolver::Initialize() {
     this->CompleteFlowInitialization(subDomain->GetDM(), subDomain->GetSolutionVector());
 }
 
+void ablate::finiteElement::FiniteElementSolver::ConfigureNonlinearSolver(TS ts) {
+    if (nonlinearSolverConfigured) {
+        return;
+    }
+    nonlinearSolverConfigured = true;
+
+    SNES snes;
+    TSGetSNES(ts, &snes) >> checkError;
+
+    // the jacobian is applied by differencing the residual and the assembled matrix is only used for the preconditioner.  Because the matrix-free operator
+    // always sees the current state, the assembled matrix can be kept for several newton iterations and time steps.
+    if (matrixFreeJacobian) {
+        SNESSetUseMatrixFree(snes, PETSC_TRUE, PETSC_FALSE) >> checkError;
+        if (preconditionerLag > 1) {
+            SNESSetLagJacobian(snes, preconditionerLag) >> checkError;
+            SNESSetLagJacobianPersists(snes, PETSC_TRUE) >> checkError;
+            SNESSetLagPreconditioner(snes, preconditionerLag) >> checkError;
+            SNESSetLagPreconditionerPersists(snes, PETSC_TRUE) >> checkError;
+        }
+    }
+
+    // add the preset options to the ksp options, any option already set by the user takes precedence
+    if (!preconditionerPreset.empty()) {
+        KSP ksp;
+        SNESGetKSP(snes, &ksp) >> checkError;
+        PetscOptions kspOptions;
+        PetscObjectGetOptions((PetscObject)ksp, &kspOptions) >> checkError;
+        const char *kspPrefix;
+        KSPGetOptionsPrefix(ksp, &kspPrefix) >> checkError;
+
+        for (const auto &[name, value] : GetPreconditionerPresetOptions(preconditionerPreset)) {
+            const auto optionName = "-" + std::string(kspPrefix ? kspPrefix : "") + name;
+            PetscBool optionSet;
+            PetscOptionsHasName(kspOptions, nullptr, optionName.c_str(), &optionSet) >> checkError;
+            if (!optionSet) {
+                PetscOptionsSetValue(kspOptions, optionName.c_str(), value.c_str()) >> checkError;
+            }
+        }
+        KSPSetFromOptions(ksp) >> checkError;
+    }
+}
+
+std::map<std::string, std::string> ablate::finiteElement::FiniteElementSolver::GetPreconditionerPresetOptions(const std::string &preset) const {
+    throw std::invalid_argument("The preconditioner preset " + preset + " is not supported by the solver " + GetSolverId());
+}
+
+std::map<std::string, std::string> ablate::finiteElement::FiniteElementSolver::SchurComplementPresetOptions(const std::string &preset, const std::string &primaryFields,
+                                                                                                           const std::string &schurField) {
+    std::map<std::string, std::string> options{{"pc_type", "fieldsplit"},
+                                               {"pc_fieldsplit_type", "schur"},
+                                               {"pc_fieldsplit_0_fields", primaryFields},
+                                               {"pc_fieldsplit_1_fields", schurField},
+                                               {"pc_fieldsplit_schur_precondition", "selfp"}};
+    if (preset == "schurDirect") {
+        options["pc_fieldsplit_schur_factorization_type"] = "full";
+        options["fieldsplit_0_pc_type"] = "lu";
+        options["fieldsplit_1_ksp_rtol"] = "1E-10";
+        options["fieldsplit_1_pc_type"] = "jacobi";
+    } else if (preset == "schurMultigrid") {
+        // the inexact block solves require a flexible outer krylov method
+        options["ksp_type"] = "fgmres";
+        options["pc_fieldsplit_schur_factorization_type"] = "upper";
+        options["fieldsplit_0_ksp_type"] = "preonly";
+        options["fieldsplit_0_pc_type"] = "gamg";
+        options["fieldsplit_1_ksp_type"] = "preonly";
+        options["fieldsplit_1_pc_type"] = "gamg";
+    } else {
+        throw std::invalid_argument("Unknown preconditioner preset " + preset + ". Valid presets are schurDirect and schurMultigrid");
+    }
+    return options;
+}
+
 void ablate::finiteElement::FiniteElementSolver::UpdateAuxFields(TS ts, ablate::finiteElement::FiniteElementSolver &fe) {
     PetscInt numberAuxFields;
     DMGetNumFields(fe.subDomain->GetAuxDM(), &numberAuxFields) >> checkError;
@@ -148,7 +249,14 @@ PetscErrorCode ablate::finiteElement::FiniteElementSolver::ComputeIJacobian(Pets
     CHKERRQ(ierr);
     ierr = PetscDSHasJacobianPreconditioner(ds, &hasPrec);
     CHKERRQ(ierr);
-    if (hasJac && hasPrec) {
+
+    // a matrix-free jacobian is applied by differencing the residual, so only the preconditioner is assembled
+    PetscBool matrixFree;
+    ierr = PetscObjectTypeCompare((PetscObject)Jac, MATMFFD, &matrixFree);
+    CHKERRQ(ierr);
+    if (matrixFree) {
+        Jac = JacP;
+    } else if (hasJac && hasPrec) {
         ierr = MatZeroEntries(Jac);
         CHKERRQ(ierr);
     }
@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_FINITEELEMENTSOLVER_HPP
 
 #include <solver/timeStepper.hpp>
+#include <map>
 #include <string>
 #include <vector>
 #include "boundaryConditions/boundaryCondition.hpp"
@@ -16,6 +17,46 @@ class FiniteElementSolver : public solver::Solver, public solver::IFunction, pub
     const std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>> boundaryConditions;
     const std::vector<std::shared_ptr<mathFunctions::FieldFunction>> auxiliaryFieldsUpdaters;
 
+    //! apply the jacobian matrix-free and only assemble the preconditioner (set with -matrixFreeJacobian in the solver options)
+    bool matrixFreeJacobian = false;
+
+    //! the number of newton iterations between assembling the preconditioner in matrix-free mode (set with -preconditionerLag in the solver options)
+    PetscInt preconditionerLag = 1;
+
+    //! keep the solution vectors and jacobian on the device so the linear and nonlinear solves run there (set with -deviceVectors in the solver options)
+    bool deviceVectors = false;
+
+    //! the name of the built in preconditioner configuration applied to the ksp (set with -preconditionerPreset in the solver options)
+    std::string preconditionerPreset;
+
+    //! true once the snes and ksp have been configured
+    bool nonlinearSolverConfigured = false;
+
+    /**
+     * Set the snes/ksp used by the ts to apply the jacobian matrix-free with a lagged assembled preconditioner and/or to use the preconditioner preset
+     * @param ts
+     */
+    void ConfigureNonlinearSolver(TS ts);
+
+   protected:
+    /**
+     * Returns the ksp options (without the prefix) for the named preconditioner preset.  By default, no presets are supported.
+     * @param preset
+     * @return
+     */
+    virtual std::map<std::string, std::string> GetPreconditionerPresetOptions(const std::string& preset) const;
+
+    /**
+     * The Schur complement field-split presets for a saddle point system with a pressure field that does not appear in its own equation
+     *  - schurDirect: full Schur factorization with a direct solve of the primary fields and jacobi on the pressure Schur complement
+     *  - schurMultigrid: upper Schur factorization with algebraic multigrid on the primary fields and on the selfp approximation of the Schur complement
+     * @param preset
+     * @param primaryFields the comma separated list of primary (i.e. velocity and temperature) fields
+     * @param schurField the pressure field
+     * @return
+     */
+    static std::map<std::string, std::string> SchurComplementPresetOptions(const std::string& preset, const std::string& primaryFields, const std::string& schurField);
+
    public:
     FiniteElementSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options,
                         std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>> boundaryConditions, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> auxiliaryFields);
@@ -25,6 +25,10 @@ class IncompressibleFlowSolver : public FiniteElementSolver {
 
     void CompleteFlowInitialization(DM, Vec) override;
 
+   protected:
+    /** the velocity and temperature are preconditioned together with the pressure Schur complement **/
+    std::map<std::string, std::string> GetPreconditionerPresetOptions(const std::string& preset) const override;
+
    private:
     inline static std::map<std::string, PetscReal> defaultParameters{{"strouhal", 1.0}, {"reynolds", 1.0}, {"peclet", 1.0}, {"mu", 1.0}, {"k", 1.0}, {"cp", 1.0}};
 };
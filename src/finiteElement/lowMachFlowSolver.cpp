@@ -140,6 +140,10 @@ void ablate::finiteElement::LowMachFlowSolver::CompleteFlowInitialization(DM dm,
     MatNullSpaceDestroy(&nullsp) >> checkError;
 }
 
+std::map<std::string, std::string> ablate::finiteElement::LowMachFlowSolver::GetPreconditionerPresetOptions(const std::string &preset) const {
+    return SchurComplementPresetOptions(preset, std::to_string(VEL) + "," + std::to_string(TEMP), std::to_string(PRES));
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::solver::Solver, ablate::finiteElement::LowMachFlowSolver, "incompressible FE flow", ARG(std::string, "id", "the name of the flow field"),
          OPT(ablate::domain::Region, "region", "the region to apply this solver.  Default is entire domain"),
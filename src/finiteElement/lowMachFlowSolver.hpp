@@ -26,6 +26,10 @@ class LowMachFlowSolver : public FiniteElementSolver {
     /** A finite element complete function **/
     void CompleteFlowInitialization(DM, Vec) override;
 
+   protected:
+    /** the velocity and temperature are preconditioned together with the pressure Schur complement **/
+    std::map<std::string, std::string> GetPreconditionerPresetOptions(const std::string& preset) const override;
+
    private:
     inline static std::map<std::string, PetscReal> defaultParameters{{"strouhal", 1.0},
                                                                      {"reynolds", 1.0},
@@ -22,6 +22,48 @@ PetscErrorCode ablate::finiteVolume::boundaryConditions::EssentialGhost::Essenti
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::boundaryConditions::EssentialGhost::ApplyBoundary(PetscReal time, PetscScalar *xArray) {
+    PetscFunctionBeginUser;
+    const auto numberFaces = boundaryFaceGeometry.size();
+    auto &solutionField = boundaryFunction->GetSolutionField();
+
+    // the face list may be rebuilt, so check that the packed centroids still match
+    if (faceCentroids.size() != numberFaces * dim) {
+        faceCentroids.resize(numberFaces * dim);
+        for (std::size_t f = 0; f < numberFaces; ++f) {
+            for (PetscInt d = 0; d < dim; ++d) {
+                faceCentroids[f * dim + d] = boundaryFaceGeometry[f].centroid[d];
+            }
+        }
+        boundaryValuesComputed = false;
+    }
+
+    if (!boundaryValuesComputed || !solutionField.IsTimeInvariant()) {
+        boundaryValues.resize(numberFaces * fieldSize);
+        try {
+            solutionField.EvalBatch(faceCentroids.data(), numberFaces, (int)dim, time, boundaryValues.data(), fieldSize, fieldSize);
+        } catch (std::exception &exception) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+        }
+        boundaryValuesComputed = true;
+    }
+
+    for (std::size_t f = 0; f < numberFaces; ++f) {
+        PetscScalar *xG = xArray + ghostOffsets[f];
+        const PetscScalar *value = boundaryValues.data() + f * fieldSize;
+        if (enforceAtFace) {
+            // use linear interpolation to enforce at face
+            const PetscScalar *xI = xArray + interiorOffsets[f] + fieldOffset;
+            for (PetscInt c = 0; c < fieldSize; c++) {
+                xG[c] = 2.0 * value[c] - xI[c];
+            }
+        } else {
+            PetscCall(PetscArraycpy(xG, value, fieldSize));
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::finiteVolume::boundaryConditions::BoundaryCondition, ablate::finiteVolume::boundaryConditions::EssentialGhost, "essential (Dirichlet condition) for ghost cell based boundaries",
          ARG(std::string, "boundaryName", "the name for this boundary condition"), ARG(std::vector<int>, "labelIds", "the ids on the mesh to apply the boundary condition"),
@@ -17,8 +17,22 @@ class EssentialGhost : public Ghost {
      */
     const bool enforceAtFace;
 
+    //! the face centroids packed for a batched evaluation of the boundary function
+    std::vector<PetscReal> faceCentroids;
+
+    //! the boundary function values at each face, reused every call when the function is time invariant
+    std::vector<PetscScalar> boundaryValues;
+    bool boundaryValuesComputed = false;
+
    public:
     EssentialGhost(std::string boundaryName, std::vector<int> labelId, std::shared_ptr<ablate::mathFunctions::FieldFunction> boundaryFunction, std::string labelName = {}, bool enforceAtFace = false);
+
+    /**
+     * Evaluate the boundary function for every face in a single batch, the values are only computed once if the function is time invariant
+     * @param time
+     * @param xArray
+     */
+    PetscErrorCode ApplyBoundary(PetscReal time, PetscScalar* xArray) override;
 };
 }  // namespace ablate::finiteVolume::boundaryConditions
 #endif  // ABLATELIBRARY_ESSENTIALGHOST_HPP
@@ -26,3 +26,70 @@ void ablate::finiteVolume::boundaryConditions::Ghost::SetupBoundary(DM dm, Petsc
     PetscDSGetCoordinateDimension(problem, &dim) >> checkError;
     PetscDSGetFieldOffset(problem, fieldId, &fieldOffset) >> checkError;
 }
+
+void ablate::finiteVolume::boundaryConditions::Ghost::BuildBoundaryFaces(DM dm, PetscInt fieldId, Vec faceGeomVec) {
+    boundaryFaceGeometry.clear();
+    interiorOffsets.clear();
+    ghostOffsets.clear();
+
+    DMLabel label;
+    DMGetLabel(dm, labelName.c_str(), &label) >> checkError;
+    if (!label) {
+        return;
+    }
+    PetscSection section;
+    DMGetLocalSection(dm, &section) >> checkError;
+    PetscInt fStart, fEnd;
+    DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> checkError;
+
+    DM dmFace;
+    const PetscScalar *faceGeomArray;
+    VecGetDM(faceGeomVec, &dmFace) >> checkError;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+
+    for (const auto labelId : labelIds) {
+        IS faceIS;
+        DMLabelGetStratumIS(label, labelId, &faceIS) >> checkError;
+        if (!faceIS) {
+            continue;
+        }
+        PetscInt numberFaces;
+        const PetscInt *faces;
+        ISGetLocalSize(faceIS, &numberFaces) >> checkError;
+        ISGetIndices(faceIS, &faces) >> checkError;
+        for (PetscInt f = 0; f < numberFaces; ++f) {
+            const PetscInt face = faces[f];
+            // refinement can add non faces to the label and only faces between an interior and ghost cell are updated
+            PetscInt supportSize;
+            if (face < fStart || face >= fEnd) {
+                continue;
+            }
+            DMPlexGetSupportSize(dm, face, &supportSize) >> checkError;
+            if (supportSize != 2) {
+                continue;
+            }
+            const PetscInt *cells;
+            PetscFVFaceGeom *faceGeom;
+            PetscInt interiorOffset, ghostOffset;
+            DMPlexGetSupport(dm, face, &cells) >> checkError;
+            DMPlexPointLocalRead(dmFace, face, faceGeomArray, &faceGeom) >> checkError;
+            PetscSectionGetOffset(section, cells[0], &interiorOffset) >> checkError;
+            PetscSectionGetFieldOffset(section, cells[1], fieldId, &ghostOffset) >> checkError;
+
+            boundaryFaceGeometry.push_back(*faceGeom);
+            interiorOffsets.push_back(interiorOffset);
+            ghostOffsets.push_back(ghostOffset);
+        }
+        ISRestoreIndices(faceIS, &faces) >> checkError;
+        ISDestroy(&faceIS) >> checkError;
+    }
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+}
+
+PetscErrorCode ablate::finiteVolume::boundaryConditions::Ghost::ApplyBoundary(PetscReal time, PetscScalar *xArray) {
+    PetscFunctionBeginUser;
+    for (std::size_t f = 0; f < boundaryFaceGeometry.size(); ++f) {
+        PetscCall(updateFunction(time, boundaryFaceGeometry[f].centroid, boundaryFaceGeometry[f].normal, xArray + interiorOffsets[f], xArray + ghostOffsets[f], (void *)updateContext));
+    }
+    PetscFunctionReturn(0);
+}
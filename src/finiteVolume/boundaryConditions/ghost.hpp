@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_GHOST_HPP
 
 #include <domain/subDomain.hpp>
+#include <vector>
 #include "boundaryCondition.hpp"
 
 namespace ablate::finiteVolume::boundaryConditions {
@@ -22,6 +23,13 @@ class Ghost : public BoundaryCondition {
     // the field offset for the a_xI values;
     PetscInt fieldOffset;
 
+    //! the geometry of each boundary face, precomputed by BuildBoundaryFaces
+    std::vector<PetscFVFaceGeom> boundaryFaceGeometry;
+    //! the offset of each interior cell (all fields) in the local solution array
+    std::vector<PetscInt> interiorOffsets;
+    //! the offset of this field in each ghost cell in the local solution array
+    std::vector<PetscInt> ghostOffsets;
+
    public:
     Ghost(std::string fieldName, std::string boundaryName, std::vector<int> labelIds, UpdateFunction updateFunction, void* updateContext, std::string labelName = {});
 
@@ -30,6 +38,21 @@ class Ghost : public BoundaryCondition {
     virtual ~Ghost() override = default;
 
     void SetupBoundary(DM dm, PetscDS problem, PetscInt fieldId) override;
+
+    /**
+     * Precompute the face geometry and the interior/ghost cell offsets of every boundary face so the boundary can be applied without label or DMPlex lookups
+     * @param dm the solution dm
+     * @param fieldId the field in the dm
+     * @param faceGeomVec the fvm face geometry
+     */
+    void BuildBoundaryFaces(DM dm, PetscInt fieldId, Vec faceGeomVec);
+
+    /**
+     * Apply the update function to every precomputed boundary face
+     * @param time
+     * @param xArray the local solution array
+     */
+    virtual PetscErrorCode ApplyBoundary(PetscReal time, PetscScalar* xArray);
 };
 
 }  // namespace ablate::finiteVolume::boundaryConditions
@@ -1,17 +1,35 @@
 #include "cellInterpolant.hpp"
 #include <petsc/private/dmpleximpl.h>
+#include <algorithm>
+#include <array>
+#include <map>
+#include <set>
 #include <utility>
+#include "utilities/kokkosUtilities.hpp"
+
+ablate::finiteVolume::CellInterpolant::CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomainIn, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec,
+                                                       const std::vector<DiscontinuousFluxFunctionDescription>& discontinuousFluxFunctions, bool threaded, bool wenoGradients)
+    : subDomain(std::move(std::move(subDomainIn))), threaded(threaded), wenoGradients(wenoGradients) {
+    // Only the input fields to the discontinuous flux functions are projected (reconstructed) to the face
+    std::set<PetscInt> inputFields;
+    for (const auto& function : discontinuousFluxFunctions) {
+        inputFields.insert(function.inputFields.begin(), function.inputFields.end());
+    }
+    for (const auto& fieldInfo : subDomain->GetFields()) {
+        if (inputFields.count(fieldInfo.id)) {
+            projectedFields.push_back(fieldInfo);
+        }
+    }
 
-ablate::finiteVolume::CellInterpolant::CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomainIn, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec)
-    : subDomain(std::move(std::move(subDomainIn))) {
-    auto getGradientDm = [this, solverRegion, faceGeomVec, cellGeomVec](const domain::Field& fieldInfo, std::vector<DM>& gradDMs) {
+    auto getGradientDm = [this, solverRegion, faceGeomVec, cellGeomVec, &inputFields](const domain::Field& fieldInfo, std::vector<DM>& gradDMs) {
         auto petscField = subDomain->GetPetscFieldObject(fieldInfo);
         auto petscFieldFV = (PetscFV)petscField;
 
         PetscBool computeGradients;
         PetscFVGetComputeGradients(petscFieldFV, &computeGradients) >> checkError;
 
-        if (computeGradients) {
+        // there is no need to compute a gradient if the field is never reconstructed
+        if (computeGradients && inputFields.count(fieldInfo.id)) {
             DM dmGradInt;
 
             DMLabel regionLabel = nullptr;
@@ -29,9 +47,22 @@ ablate::finiteVolume::CellInterpolant::CellInterpolant(std::shared_ptr<ablate::d
     for (const auto& fieldInfo : subDomain->GetFields()) {
         getGradientDm(fieldInfo, gradientCellDms);
     }
+    gradientStencils.resize(gradientCellDms.size());
+
+    // precompute the ghost membership so the point sources do not query the label for every cell
+    DMLabel ghostLabel;
+    DMGetLabel(subDomain->GetDM(), "ghost", &ghostLabel) >> checkError;
+    ghostMask = domain::Region::GetMask(ghostLabel, subDomain->GetDM());
 }
 
 ablate::finiteVolume::CellInterpolant::~CellInterpolant() {
+    // release any gradient vectors held by an interior phase without a matching halo phase
+    for (std::size_t f = 0; f < haloPartition.gradGlobVecs.size(); ++f) {
+        if (haloPartition.gradGlobVecs[f]) {
+            DMRestoreGlobalVector(gradientCellDms[f], &haloPartition.gradGlobVecs[f]) >> checkError;
+            DMRestoreLocalVector(gradientCellDms[f], &haloPartition.gradLocVecs[f]) >> checkError;
+        }
+    }
     for (auto& dm : gradientCellDms) {
         if (dm) {
             DMDestroy(&dm) >> checkError;
@@ -39,9 +70,53 @@ ablate::finiteVolume::CellInterpolant::~CellInterpolant() {
     }
 }
 
+void ablate::finiteVolume::CellInterpolant::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const {
+    // the gradient dms share the topology of the subDomain dm so only their sections and vectors are counted
+    for (std::size_t f = 0; f < gradientCellDms.size(); ++f) {
+        const auto& fieldName = subDomain->GetFields()[f].name;
+        memoryUsage.Add(prefix + "gradientDm::" + fieldName, utilities::MemoryUsage::DMDataBytes(gradientCellDms[f]));
+    }
+    for (std::size_t f = 0; f < gradientStencils.size(); ++f) {
+        const auto& stencil = gradientStencils[f];
+        const auto name = prefix + "gradientStencil::" + subDomain->GetFields()[f].name;
+        memoryUsage.Add(name, stencil.gradOffsets);
+        memoryUsage.Add(name, stencil.gradLocalOffsets);
+        memoryUsage.Add(name, stencil.cells);
+        memoryUsage.Add(name, stencil.cellOffsets);
+        memoryUsage.Add(name, stencil.rowStart);
+        memoryUsage.Add(name, stencil.neighborOffsets);
+        memoryUsage.Add(name, stencil.weights);
+        memoryUsage.Add(name, stencil.neighborCells);
+        memoryUsage.Add(name, stencil.candidateStart);
+        memoryUsage.Add(name, stencil.candidateWeights);
+        memoryUsage.Add(name, stencil.lengthSquared);
+        memoryUsage.Add(name, stencil.interiorRows);
+        memoryUsage.Add(name, stencil.haloRows);
+    }
+
+    const auto faceTableName = prefix + "faceTable";
+    memoryUsage.Add(faceTableName, faceTable.faces);
+    memoryUsage.Add(faceTableName, faceTable.leftCells);
+    memoryUsage.Add(faceTableName, faceTable.rightCells);
+    memoryUsage.Add(faceTableName, faceTable.faceGeomOffsets);
+    memoryUsage.Add(faceTableName, faceTable.leftCellGeomOffsets);
+    memoryUsage.Add(faceTableName, faceTable.rightCellGeomOffsets);
+    memoryUsage.Add(faceTableName, faceTable.projectLeft);
+    memoryUsage.Add(faceTableName, faceTable.projectRight);
+    memoryUsage.Add(faceTableName, faceTable.writeLeft);
+    memoryUsage.Add(faceTableName, faceTable.writeRight);
+    memoryUsage.Add(faceTableName, faceTable.leftInverseVolumes);
+    memoryUsage.Add(faceTableName, faceTable.rightInverseVolumes);
+    memoryUsage.Add(faceTableName, haloPartition.interiorCells);
+    memoryUsage.Add(faceTableName, haloPartition.interiorFaces);
+    memoryUsage.Add(faceTableName, haloPartition.haloFaces);
+
+    memoryUsage.Add(prefix + "fluxScratch", fluxScratch.scratch);
+}
+
 void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
                                                        std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, const solver::Range& faceRange, const solver::Range& cellRange,
-                                                       Vec cellGeomVec, Vec faceGeomVec) {
+                                                       Vec cellGeomVec, Vec faceGeomVec, const FaceInterpolant::ContinuousFluxEvaluator* continuousFluxEvaluator, FacePhase phase) {
     auto dm = subDomain->GetDM();
     auto dmAux = subDomain->GetAuxDM();
 
@@ -73,6 +148,14 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
     VecGetDM(faceGeomVec, &faceDM) >> checkError;
     VecGetDM(cellGeomVec, &cellDM) >> checkError;
 
+    // the interior and halo phases require the face table split before the gradients are computed
+    if (phase != FacePhase::all && !haloPartition.built) {
+        if (!faceTable.built) {
+            BuildFaceTable(dm, faceDM, cellDM, cellGeomArray, solverRegion, faceRange);
+        }
+        BuildHaloPartition(dm, cellRange);
+    }
+
     // Get raw access to the computed values
     const PetscScalar *xArray, *auxArray = nullptr;
     VecGetArrayRead(locXVec, &xArray) >> checkError;
@@ -90,7 +173,7 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
     /* Reconstruct and limit cell gradients */
     // for each field compute the gradient in the localGrads vector
     for (const auto& field : subDomain->GetFields()) {
-        ComputeFieldGradients(field, locXVec, locGradVecs[field.subId], gradientCellDms[field.subId], cellGeomVec, faceGeomVec, faceRange, cellRange);
+        ComputeFieldGradients(field, locXVec, locGradVecs[field.subId], gradientCellDms[field.subId], cellGeomVec, faceGeomVec, faceRange, cellRange, phase);
     }
 
     std::vector<const PetscScalar*> locGradArrays(nf, nullptr);
@@ -118,13 +201,17 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
                            solverRegion,
                            rhsFunctions,
                            faceRange,
-                           cellRange);
+                           cellRange,
+                           continuousFluxEvaluator,
+                           phase);
 
-    // clean up cell grads
+    // clean up cell grads, the interior phase holds onto the local gradients until the halo phase
     for (const auto& field : subDomain->GetFields()) {
         if (locGradVecs[field.subId]) {
             VecRestoreArrayRead(locGradVecs[field.subId], &locGradArrays[field.subId]) >> checkError;
-            DMRestoreLocalVector(gradientCellDms[field.subId], &locGradVecs[field.subId]) >> checkError;
+            if (phase != FacePhase::interior) {
+                DMRestoreLocalVector(gradientCellDms[field.subId], &locGradVecs[field.subId]) >> checkError;
+            }
         }
     }
 
@@ -216,28 +303,15 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
         }
     }
 
-    // check to see if there is a ghost label
-    DMLabel ghostLabel;
-    DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
-
     PetscInt dim = subDomain->GetDimensions();
 
-    // Size up a scratch variable
-    PetscScalar* fScratch;
-    PetscCalloc1(totDim, &fScratch);
-
-    // March over each cell
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+    // compute the point functions for a single cell using the supplied scratch
+    auto computeCellSource = [&](PetscInt c, PetscScalar* fScratch) {
         // if there is a cell array, use it, otherwise it is just c
         const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
 
         // make sure that this is not a ghost cell
-        if (ghostLabel) {
-            PetscInt ghostVal;
-
-            DMLabelGetValue(ghostLabel, cell, &ghostVal) >> checkError;
-            if (ghostVal > 0) continue;
-        }
+        if (ghostMask.Contains(cell)) return;
 
         // extract the point locations for this cell
         const PetscFVCellGeom* cg;
@@ -265,6 +339,24 @@ void ablate::finiteVolume::CellInterpolant::ComputeRHS(PetscReal time, Vec locXV
                 }
             }
         }
+    };
+
+    if (threaded && std::all_of(rhsFunctions.begin(), rhsFunctions.end(), [](const auto& function) { return function.threadSafe; })) {
+        // each cell only writes to its own rhs, so the cells can be split into concurrent chunks with independent scratch
+        std::vector<PetscScalar> fScratch(totDim * utilities::KokkosUtilities::GetHostConcurrency());
+        utilities::KokkosUtilities::ParallelForChunks(cellRange.end - cellRange.start, [&](std::size_t start, std::size_t end, std::size_t chunk) {
+            for (std::size_t i = start; i < end; ++i) {
+                computeCellSource(cellRange.start + (PetscInt)i, fScratch.data() + chunk * totDim);
+            }
+        });
+    } else {
+        // Size up a scratch variable
+        std::vector<PetscScalar> fScratch(totDim);
+
+        // March over each cell
+        for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+            computeCellSource(c, fScratch.data());
+        }
     }
 
     // cleanup (restore access to locGradVecs, locAuxGradVecs with DMRestoreLocalVector)
@@ -334,7 +426,7 @@ static PetscErrorCode DMPlexApplyLimiter_Internal(DM dm, DM dmCell, PetscLimiter
 }
 
 void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::Field& field, Vec xLocalVec, Vec& gradLocVec, DM& dmGrad, Vec cellGeomVec, Vec faceGeomVec,
-                                                                  const solver::Range& faceRange, const solver::Range& cellRange) {
+                                                                  const solver::Range& faceRange, const solver::Range& cellRange, FacePhase phase) {
     // get the FVM petsc field associated with this field
     auto fvm = (PetscFV)subDomain->GetPetscFieldObject(field);
     auto dm = subDomain->GetFieldDM(field);
@@ -345,23 +437,41 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
         return;
     }
 
-    // Create a gradLocVec
-    DMGetLocalVector(dmGrad, &gradLocVec) >> checkError;
-
-    // Get the correct sized vec (gradient for this field)
+    // Get the correct sized vec (gradient for this field), the halo phase continues with the vectors from the interior phase
     Vec gradGlobVec;
-    DMGetGlobalVector(dmGrad, &gradGlobVec) >> checkError;
-    VecZeroEntries(gradGlobVec) >> checkError;
-
-    // check to see if there is a ghost label
-    DMLabel ghostLabel;
-    DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
+    if (phase == FacePhase::halo) {
+        gradGlobVec = haloPartition.gradGlobVecs[field.subId];
+        gradLocVec = haloPartition.gradLocVecs[field.subId];
+        if (!gradGlobVec) {
+            throw std::runtime_error("The interior phase must be computed before the halo phase for field " + field.name);
+        }
+        haloPartition.gradGlobVecs[field.subId] = nullptr;
+        haloPartition.gradLocVecs[field.subId] = nullptr;
+    } else {
+        // Create a gradLocVec
+        DMGetLocalVector(dmGrad, &gradLocVec) >> checkError;
+        DMGetGlobalVector(dmGrad, &gradGlobVec) >> checkError;
+        VecZeroEntries(gradGlobVec) >> checkError;
+    }
 
-    // Get the face geometry
-    DM dmFace;
-    const PetscScalar* faceGeometryArray;
-    VecGetDM(faceGeomVec, &dmFace) >> checkError;
-    VecGetArrayRead(faceGeomVec, &faceGeometryArray);
+    // Build the gradient stencil the first time through
+    auto& gradientStencil = gradientStencils[field.subId];
+    if (!gradientStencil.built) {
+        BuildGradientStencil(field, dm, dmGrad, gradGlobVec, faceGeomVec, faceRange, gradientStencil);
+    }
+    if (wenoGradients && !gradientStencil.wenoBuilt) {
+        BuildWenoStencil(subDomain->GetDimensions(), gradientStencil);
+    }
+    if (phase != FacePhase::all && !gradientStencil.partitioned) {
+        for (std::size_t row = 0; row < gradientStencil.cells.size(); ++row) {
+            if (haloPartition.IsInterior(gradientStencil.cells[row])) {
+                gradientStencil.interiorRows.push_back(row);
+            } else {
+                gradientStencil.haloRows.push_back(row);
+            }
+        }
+        gradientStencil.partitioned = true;
+    }
 
     // extract the local x array
     const PetscScalar* xLocalArray;
@@ -375,53 +485,99 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
     PetscInt dim = subDomain->GetDimensions();
     PetscInt dof = field.numberComponents;
 
-    for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
-        PetscInt face = faceRange.points ? faceRange.points[f] : f;
-
-        // make sure that this is a face we should use
-        PetscBool boundary;
-        PetscInt ghost = -1;
-        if (ghostLabel) {
-            DMLabelGetValue(ghostLabel, face, &ghost);
+    // the candidate gradients (central then one-sided) for a single row when using WENO gradients
+    std::vector<PetscScalar> wenoScratch;
+    std::vector<PetscReal> wenoBeta;
+
+    // replace the central gradient with the WENO combination, omega_k = lambda_k ((eps + beta_min)/(eps + beta_k))^r with beta_k = h^2 |grad_k|^2
+    auto applyWeno = [&](std::size_t row, PetscScalar* cgrad, const PetscScalar* cx) {
+        const PetscInt start = gradientStencil.rowStart[row];
+        const PetscInt rowSize = gradientStencil.rowStart[row + 1] - start;
+        const PetscReal* candidates = gradientStencil.candidateWeights.data() + gradientStencil.candidateStart[row] * dim;
+        const PetscReal lengthSquared = gradientStencil.lengthSquared[row];
+        if (rowSize == 0 || lengthSquared <= 0.0) {
+            return;
         }
-        DMIsBoundaryPoint(dm, face, &boundary);
-        PetscInt numChildren;
-        DMPlexGetTreeChildren(dm, face, &numChildren, nullptr);
-        if (ghost >= 0 || boundary || numChildren) continue;
-
-        // Do a sanity check on the number of cells connected to this face
-        PetscInt numCells;
-        DMPlexGetSupportSize(dm, face, &numCells);
-        if (numCells != 2) {
-            throw std::runtime_error("face " + std::to_string(face) + " has " + std::to_string(numCells) + " support points (cells): expected 2");
+        wenoScratch.assign((rowSize + 1) * dof * dim, 0.0);
+        wenoBeta.resize(rowSize + 1);
+        PetscArraycpy(wenoScratch.data(), cgrad, dof * dim) >> checkError;
+        for (PetscInt k = 0; k < rowSize; ++k) {
+            PetscScalar* candidateGrad = wenoScratch.data() + (k + 1) * dof * dim;
+            for (PetscInt e = 0; e < rowSize; ++e) {
+                const PetscScalar* nx = xLocalArray + gradientStencil.neighborOffsets[start + e];
+                const PetscReal* w = candidates + (k * rowSize + e) * dim;
+                for (PetscInt pd = 0; pd < dof; ++pd) {
+                    PetscScalar delta = nx[pd] - cx[pd];
+                    for (PetscInt d = 0; d < dim; ++d) {
+                        candidateGrad[pd * dim + d] += w[d] * delta;
+                    }
+                }
+            }
         }
 
-        // add in the contributions from this face
-        const PetscInt* cells;
-        PetscFVFaceGeom* fg;
-        PetscScalar* cx[2];
-        PetscScalar* cgrad[2];
-
-        DMPlexGetSupport(dm, face, &cells);
-        DMPlexPointLocalRead(dmFace, face, faceGeometryArray, &fg);
-        for (PetscInt c = 0; c < 2; ++c) {
-            DMPlexPointLocalFieldRead(dm, cells[c], field.id, xLocalArray, &cx[c]) >> checkError;
-            DMPlexPointGlobalRef(dmGrad, cells[c], gradGlobArray, &cgrad[c]) >> checkError;
-        }
+        // combine each component separately
         for (PetscInt pd = 0; pd < dof; ++pd) {
-            PetscScalar delta = cx[1][pd] - cx[0][pd];
+            PetscReal betaMin = PETSC_MAX_REAL;
+            for (PetscInt k = 0; k <= rowSize; ++k) {
+                const PetscScalar* grad = wenoScratch.data() + k * dof * dim + pd * dim;
+                wenoBeta[k] = 0.0;
+                for (PetscInt d = 0; d < dim; ++d) {
+                    wenoBeta[k] += lengthSquared * PetscRealPart(grad[d] * grad[d]);
+                }
+                betaMin = PetscMin(betaMin, wenoBeta[k]);
+            }
 
+            PetscReal omegaSum = 0.0;
             for (PetscInt d = 0; d < dim; ++d) {
-                if (cgrad[0]) cgrad[0][pd * dim + d] += fg->grad[0][d] * delta;
-                if (cgrad[1]) cgrad[1][pd * dim + d] -= fg->grad[1][d] * delta;
+                cgrad[pd * dim + d] = 0.0;
+            }
+            for (PetscInt k = 0; k <= rowSize; ++k) {
+                const PetscScalar* grad = wenoScratch.data() + k * dof * dim + pd * dim;
+                PetscReal omega = (k == 0 ? wenoCentralWeight : 1.0) * PetscPowReal((wenoEpsilon + betaMin) / (wenoEpsilon + wenoBeta[k]), wenoExponent);
+                omegaSum += omega;
+                for (PetscInt d = 0; d < dim; ++d) {
+                    cgrad[pd * dim + d] += omega * grad[d];
+                }
+            }
+            for (PetscInt d = 0; d < dim; ++d) {
+                cgrad[pd * dim + d] /= omegaSum;
+            }
+        }
+    };
+
+    // apply the stencil, grad_c = sum_n w_n (x_n - x_c)
+    auto applyStencil = [&](std::size_t row) {
+        PetscScalar* cgrad = gradGlobArray + gradientStencil.gradOffsets[row];
+        const PetscScalar* cx = xLocalArray + gradientStencil.cellOffsets[row];
+
+        for (PetscInt n = gradientStencil.rowStart[row]; n < gradientStencil.rowStart[row + 1]; ++n) {
+            const PetscScalar* nx = xLocalArray + gradientStencil.neighborOffsets[n];
+            const PetscReal* w = gradientStencil.weights.data() + n * dim;
+            for (PetscInt pd = 0; pd < dof; ++pd) {
+                PetscScalar delta = nx[pd] - cx[pd];
+                for (PetscInt d = 0; d < dim; ++d) {
+                    cgrad[pd * dim + d] += w[d] * delta;
+                }
             }
         }
+        if (wenoGradients) {
+            applyWeno(row, cgrad, cx);
+        }
+    };
+    if (phase == FacePhase::all) {
+        for (std::size_t row = 0; row < gradientStencil.gradOffsets.size(); ++row) {
+            applyStencil(row);
+        }
+    } else {
+        for (const auto row : phase == FacePhase::interior ? gradientStencil.interiorRows : gradientStencil.haloRows) {
+            applyStencil(row);
+        }
     }
 
-    // Check for a limiter the limiter
+    // Check for a limiter the limiter, the WENO gradients replace the limiter
     PetscLimiter lim;
     PetscFVGetLimiter(fvm, &lim) >> checkError;
-    if (lim) {
+    if (lim && !wenoGradients) {
         /* Limit interior gradients (using cell-based loop because it generalizes better to vector limiters) */
         // Get the cell geometry
         DM dmCell;
@@ -433,9 +589,7 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
         PetscReal* cellPhi;
         DMGetWorkArray(dm, dof, MPIU_REAL, &cellPhi) >> checkError;
 
-        for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-            PetscInt cell = cellRange.points ? cellRange.points[c] : c;
-
+        auto limitCell = [&](PetscInt cell) {
             const PetscInt* cellFaces;
             PetscScalar* cx;
             PetscFVCellGeom* cg;
@@ -450,7 +604,7 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
 
             if (!cgrad) {
                 /* Unowned overlap cell, we do not compute */
-                continue;
+                return;
             }
             /* Limiter will be minimum value over all neighbors */
             for (PetscInt d = 0; d < dof; ++d) {
@@ -467,12 +621,47 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
                     cgrad[pd * dim + d] *= cellPhi[pd];
                 }
             }
+        };
+
+        if (phase == FacePhase::interior) {
+            for (std::size_t c = 0; c < haloPartition.interiorCells.size(); ++c) {
+                if (haloPartition.interiorCells[c]) {
+                    limitCell(haloPartition.cellStart + (PetscInt)c);
+                }
+            }
+        } else {
+            for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+                PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+
+                // the interior cells were limited in the interior phase
+                if (phase == FacePhase::halo && haloPartition.IsInterior(cell)) {
+                    continue;
+                }
+                limitCell(cell);
+            }
         }
 
         // clean up the limiter work
         DMRestoreWorkArray(dm, dof, MPIU_REAL, &cellPhi) >> checkError;
         VecRestoreArrayRead(cellGeomVec, &cellGeometryArray);
     }
+
+    if (phase == FacePhase::interior) {
+        // the interior faces only need the owned interior gradients, so copy them to the local vector and hold both vectors for the halo phase
+        PetscScalar* gradLocArray;
+        VecGetArray(gradLocVec, &gradLocArray) >> checkError;
+        for (const auto row : gradientStencil.interiorRows) {
+            PetscArraycpy(gradLocArray + gradientStencil.gradLocalOffsets[row], gradGlobArray + gradientStencil.gradOffsets[row], dof * dim) >> checkError;
+        }
+        VecRestoreArray(gradLocVec, &gradLocArray) >> checkError;
+        VecRestoreArray(gradGlobVec, &gradGlobArray) >> checkError;
+        VecRestoreArrayRead(xLocalVec, &xLocalArray) >> checkError;
+
+        haloPartition.gradGlobVecs[field.subId] = gradGlobVec;
+        haloPartition.gradLocVecs[field.subId] = gradLocVec;
+        return;
+    }
+
     // Communicate gradient values
     VecRestoreArray(gradGlobVec, &gradGlobArray) >> checkError;
     DMGlobalToLocalBegin(dmGrad, gradGlobVec, INSERT_VALUES, gradLocVec) >> checkError;
@@ -480,47 +669,393 @@ void ablate::finiteVolume::CellInterpolant::ComputeFieldGradients(const domain::
 
     // cleanup
     VecRestoreArrayRead(xLocalVec, &xLocalArray) >> checkError;
-    VecRestoreArrayRead(faceGeomVec, &faceGeometryArray) >> checkError;
     DMRestoreGlobalVector(dmGrad, &gradGlobVec) >> checkError;
 }
 
+void ablate::finiteVolume::CellInterpolant::BuildGradientStencil(const domain::Field& field, DM dm, DM dmGrad, Vec gradGlobVec, Vec faceGeomVec, const solver::Range& faceRange,
+                                                                 GradientStencil& gradientStencil) {
+    // check to see if there is a ghost label
+    DMLabel ghostLabel;
+    DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
+
+    // Get the face geometry
+    DM dmFace;
+    const PetscScalar* faceGeometryArray;
+    VecGetDM(faceGeomVec, &dmFace) >> checkError;
+    VecGetArrayRead(faceGeomVec, &faceGeometryArray) >> checkError;
+
+    // the global gradient array only holds the owned values
+    PetscInt gradOwnershipStart;
+    VecGetOwnershipRange(gradGlobVec, &gradOwnershipStart, nullptr) >> checkError;
+
+    PetscInt dim;
+    DMGetDimension(dm, &dim) >> checkError;
+
+    // collect the neighbors (offset and weight) for each owned cell in face order
+    struct Neighbor {
+        PetscInt offset;
+        PetscInt cell;
+        PetscReal weight[3];
+    };
+    std::map<PetscInt, std::vector<Neighbor>> cellNeighbors;
+
+    for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
+        PetscInt face = faceRange.points ? faceRange.points[f] : f;
+
+        // make sure that this is a face we should use
+        PetscBool boundary;
+        PetscInt ghost = -1;
+        if (ghostLabel) {
+            DMLabelGetValue(ghostLabel, face, &ghost) >> checkError;
+        }
+        DMIsBoundaryPoint(dm, face, &boundary) >> checkError;
+        PetscInt numChildren;
+        DMPlexGetTreeChildren(dm, face, &numChildren, nullptr) >> checkError;
+        if (ghost >= 0 || boundary || numChildren) continue;
+
+        // Do a sanity check on the number of cells connected to this face
+        PetscInt numCells;
+        DMPlexGetSupportSize(dm, face, &numCells) >> checkError;
+        if (numCells != 2) {
+            throw std::runtime_error("face " + std::to_string(face) + " has " + std::to_string(numCells) + " support points (cells): expected 2");
+        }
+
+        const PetscInt* cells;
+        const PetscFVFaceGeom* fg;
+        DMPlexGetSupport(dm, face, &cells) >> checkError;
+        DMPlexPointLocalRead(dmFace, face, faceGeometryArray, &fg) >> checkError;
+
+        PetscInt xOffsets[2];
+        for (PetscInt c = 0; c < 2; ++c) {
+            DMPlexGetPointLocalField(dm, cells[c], field.id, &xOffsets[c], nullptr) >> checkError;
+        }
+
+        for (PetscInt c = 0; c < 2; ++c) {
+            // only owned cells have a global gradient
+            PetscInt gradStart, gradEnd;
+            DMPlexGetPointGlobal(dmGrad, cells[c], &gradStart, &gradEnd) >> checkError;
+            if (gradStart >= gradEnd) continue;
+
+            Neighbor neighbor{.offset = xOffsets[1 - c], .cell = cells[1 - c], .weight = {0.0, 0.0, 0.0}};
+            for (PetscInt d = 0; d < dim; ++d) {
+                neighbor.weight[d] = fg->grad[c][d];
+            }
+            cellNeighbors[cells[c]].push_back(neighbor);
+        }
+    }
+
+    // flatten into the compressed row format
+    gradientStencil = GradientStencil{};
+    gradientStencil.rowStart.push_back(0);
+    for (const auto& [cell, neighbors] : cellNeighbors) {
+        PetscInt gradStart, xStart;
+        DMPlexGetPointGlobal(dmGrad, cell, &gradStart, nullptr) >> checkError;
+        DMPlexGetPointLocalField(dm, cell, field.id, &xStart, nullptr) >> checkError;
+
+        PetscInt gradLocalStart;
+        DMPlexGetPointLocal(dmGrad, cell, &gradLocalStart, nullptr) >> checkError;
+
+        gradientStencil.gradOffsets.push_back(gradStart - gradOwnershipStart);
+        gradientStencil.gradLocalOffsets.push_back(gradLocalStart);
+        gradientStencil.cells.push_back(cell);
+        gradientStencil.cellOffsets.push_back(xStart);
+        for (const auto& neighbor : neighbors) {
+            gradientStencil.neighborOffsets.push_back(neighbor.offset);
+            gradientStencil.neighborCells.push_back(neighbor.cell);
+            gradientStencil.weights.insert(gradientStencil.weights.end(), neighbor.weight, neighbor.weight + dim);
+        }
+        gradientStencil.rowStart.push_back((PetscInt)gradientStencil.neighborOffsets.size());
+    }
+    gradientStencil.built = true;
+
+    VecRestoreArrayRead(faceGeomVec, &faceGeometryArray) >> checkError;
+}
+
+void ablate::finiteVolume::CellInterpolant::BuildWenoStencil(PetscInt dim, GradientStencil& gradientStencil) {
+    // inverts the dim x dim symmetric matrix (padded to 3x3 at the same scale), returns false if the matrix is singular relative to that scale
+    auto invert = [dim](PetscReal a[3][3], PetscReal inv[3][3]) {
+        PetscReal scale = 0.0;
+        for (PetscInt d = 0; d < dim; ++d) {
+            scale += a[d][d] / (PetscReal)dim;
+        }
+        if (scale <= 0.0) {
+            return false;
+        }
+        for (PetscInt d = dim; d < 3; ++d) {
+            a[d][d] = scale;
+        }
+        inv[0][0] = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+        inv[0][1] = a[0][2] * a[2][1] - a[0][1] * a[2][2];
+        inv[0][2] = a[0][1] * a[1][2] - a[0][2] * a[1][1];
+        inv[1][0] = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+        inv[1][1] = a[0][0] * a[2][2] - a[0][2] * a[2][0];
+        inv[1][2] = a[0][2] * a[1][0] - a[0][0] * a[1][2];
+        inv[2][0] = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+        inv[2][1] = a[0][1] * a[2][0] - a[0][0] * a[2][1];
+        inv[2][2] = a[0][0] * a[1][1] - a[0][1] * a[1][0];
+        PetscReal det = a[0][0] * inv[0][0] + a[0][1] * inv[1][0] + a[0][2] * inv[2][0];
+        if (PetscAbsReal(det) <= 1.0E-10 * scale * scale * scale) {
+            return false;
+        }
+        for (auto& invRow : inv) {
+            for (auto& value : invRow) {
+                value /= det;
+            }
+        }
+        return true;
+    };
+
+    gradientStencil.candidateStart.assign(1, 0);
+    gradientStencil.candidateWeights.clear();
+    gradientStencil.lengthSquared.clear();
+
+    std::vector<std::array<PetscReal, 3>> dx;
+    for (std::size_t row = 0; row < gradientStencil.cells.size(); ++row) {
+        const PetscInt start = gradientStencil.rowStart[row];
+        const PetscInt rowSize = gradientStencil.rowStart[row + 1] - start;
+        const PetscReal* centralWeights = gradientStencil.weights.data() + start * dim;
+
+        // default every candidate to the central weights so degenerate candidates do not bias the reconstruction
+        for (PetscInt k = 0; k < rowSize; ++k) {
+            gradientStencil.candidateWeights.insert(gradientStencil.candidateWeights.end(), centralWeights, centralWeights + rowSize * dim);
+        }
+        PetscReal* candidates = gradientStencil.candidateWeights.data() + gradientStencil.candidateStart.back() * dim;
+        gradientStencil.candidateStart.push_back(gradientStencil.candidateStart.back() + rowSize * rowSize);
+
+        // recover the neighbor displacements from the central weights
+        PetscReal g[3][3] = {}, gInv[3][3];
+        for (PetscInt n = 0; n < rowSize; ++n) {
+            for (PetscInt i = 0; i < dim; ++i) {
+                for (PetscInt j = 0; j < dim; ++j) {
+                    g[i][j] += centralWeights[n * dim + i] * centralWeights[n * dim + j];
+                }
+            }
+        }
+        if (!invert(g, gInv)) {
+            gradientStencil.lengthSquared.push_back(0.0);
+            continue;
+        }
+        dx.assign(rowSize, {0.0, 0.0, 0.0});
+        PetscReal lengthSquared = 0.0;
+        for (PetscInt n = 0; n < rowSize; ++n) {
+            for (PetscInt i = 0; i < dim; ++i) {
+                for (PetscInt j = 0; j < dim; ++j) {
+                    dx[n][i] += gInv[i][j] * centralWeights[n * dim + j];
+                }
+                lengthSquared += dx[n][i] * dx[n][i] / (PetscReal)rowSize;
+            }
+        }
+        gradientStencil.lengthSquared.push_back(lengthSquared);
+
+        // each candidate drops the neighbor most opposite to neighbor k and solves the least squares weights over the remaining neighbors
+        for (PetscInt k = 0; k < rowSize; ++k) {
+            PetscInt dropped = -1;
+            PetscReal minCosine = PETSC_MAX_REAL;
+            for (PetscInt n = 0; n < rowSize; ++n) {
+                if (n == k) continue;
+                PetscReal dot = 0.0, normN = 0.0, normK = 0.0;
+                for (PetscInt d = 0; d < dim; ++d) {
+                    dot += dx[n][d] * dx[k][d];
+                    normN += dx[n][d] * dx[n][d];
+                    normK += dx[k][d] * dx[k][d];
+                }
+                PetscReal cosine = dot / PetscSqrtReal(normN * normK + PETSC_SMALL * lengthSquared * lengthSquared);
+                if (cosine < minCosine) {
+                    minCosine = cosine;
+                    dropped = n;
+                }
+            }
+            if (dropped < 0) continue;
+
+            PetscReal a[3][3] = {}, aInv[3][3];
+            for (PetscInt n = 0; n < rowSize; ++n) {
+                if (n == dropped) continue;
+                for (PetscInt i = 0; i < dim; ++i) {
+                    for (PetscInt j = 0; j < dim; ++j) {
+                        a[i][j] += dx[n][i] * dx[n][j];
+                    }
+                }
+            }
+            if (!invert(a, aInv)) continue;
+
+            PetscReal* candidate = candidates + k * rowSize * dim;
+            for (PetscInt n = 0; n < rowSize; ++n) {
+                for (PetscInt i = 0; i < dim; ++i) {
+                    candidate[n * dim + i] = 0.0;
+                    if (n == dropped) continue;
+                    for (PetscInt j = 0; j < dim; ++j) {
+                        candidate[n * dim + i] += aInv[i][j] * dx[n][j];
+                    }
+                }
+            }
+        }
+    }
+    gradientStencil.wenoBuilt = true;
+}
+
 void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscDS ds, PetscInt totDim, const PetscScalar* xArray, DM dmAux, PetscDS dsAux, PetscInt totDimAux,
                                                                    const PetscScalar* auxArray, DM faceDM, const PetscScalar* faceGeomArray, DM cellDM, const PetscScalar* cellGeomArray,
                                                                    std::vector<DM>& dmGrads, std::vector<const PetscScalar*>& locGradArrays, PetscScalar* locFArray,
                                                                    const std::shared_ptr<domain::Region>& solverRegion,
                                                                    std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, const solver::Range& faceRange,
-                                                                   const solver::Range& cellRange) {
+                                                                   const solver::Range& cellRange, const FaceInterpolant::ContinuousFluxEvaluator* continuousFluxEvaluator,
+                                                                   FacePhase phase) {
     PetscInt dim = subDomain->GetDimensions();
 
-    // Size up the work arrays (uL, uR, gradL, gradR, auxL, auxR, gradAuxL, gradAuxR), these are only sized for one face at a time
-    PetscScalar* flux;
-    DMGetWorkArray(dm, totDim, MPIU_SCALAR, &flux) >> checkError;
+    // build the face table the first time through
+    if (!faceTable.built) {
+        BuildFaceTable(dm, faceDM, cellDM, cellGeomArray, solverRegion, faceRange);
+    }
+
+    // reuse the offsets and scratch memory unless the flux functions have changed
+    UpdateFluxScratch(ds, dsAux, totDim, rhsFunctions, continuousFluxEvaluator);
+    const auto& fluxComponentSize = fluxScratch.fluxComponentSize;
+    const auto& fluxId = fluxScratch.fluxId;
+    const auto& fluxBufferOffset = fluxScratch.fluxBufferOffset;
+    const auto& uOff = fluxScratch.uOff;
+    const auto& aOff = fluxScratch.aOff;
+    const PetscInt fluxBufferSize = fluxScratch.fluxBufferSize;
+    const PetscInt continuousFluxBufferOffset = fluxScratch.continuousFluxBufferOffset;
+
+    // compute and scatter the flux for a single face using the supplied scratch memory
+    auto computeFaceFlux = [&](std::size_t i, PetscScalar* uL, PetscScalar* uR, PetscScalar* gradL, PetscScalar* gradR, PetscScalar* flux) {
+        const PetscInt leftCell = faceTable.leftCells[i];
+        const PetscInt rightCell = faceTable.rightCells[i];
+
+        // Get the face geometry
+        const auto fg = (const PetscFVFaceGeom*)(faceGeomArray + faceTable.faceGeomOffsets[i]);
+        const auto cgL = (const PetscFVCellGeom*)(cellGeomArray + faceTable.leftCellGeomOffsets[i]);
+        const auto cgR = (const PetscFVCellGeom*)(cellGeomArray + faceTable.rightCellGeomOffsets[i]);
+
+        // compute the left/right face values
+        ProjectToFace(projectedFields, ds, *fg, leftCell, *cgL, dm, xArray, dmGrads, locGradArrays, uL, gradL, faceTable.projectLeft[i]);
+        ProjectToFace(projectedFields, ds, *fg, rightCell, *cgR, dm, xArray, dmGrads, locGradArrays, uR, gradR, faceTable.projectRight[i]);
+
+        // determine the left/right cells
+        const PetscScalar *auxL = nullptr, *auxR = nullptr;
+        if (auxArray) {
+            // Get the field values at this cell
+            DMPlexPointLocalRead(dmAux, leftCell, auxArray, &auxL) >> checkError;
+            DMPlexPointLocalRead(dmAux, rightCell, auxArray, &auxR) >> checkError;
+        }
+
+        // Evaluate every source function for this face into the fused flux buffer
+        PetscArrayzero(flux, fluxBufferSize) >> checkError;
+        for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+            const auto& rhsFluxFunctionDescription = rhsFunctions[fun];
+            rhsFluxFunctionDescription.function(dim, fg, uOff[fun].data(), uL, uR, aOff[fun].data(), auxL, auxR, flux + fluxBufferOffset[fun], rhsFluxFunctionDescription.context) >> checkError;
+        }
+        if (continuousFluxEvaluator) {
+            continuousFluxEvaluator->Evaluate(faceTable.faces[i], fg, flux + continuousFluxBufferOffset);
+        }
+
+        // scatter the fused flux back to the cells
+        if (faceTable.writeLeft[i]) {
+            const PetscReal invVolumeL = faceTable.leftInverseVolumes[i];
+            for (std::size_t fun = 0; fun < fluxId.size(); fun++) {
+                PetscScalar* fL;
+                DMPlexPointLocalFieldRef(dm, leftCell, fluxId[fun], locFArray, &fL) >> checkError;
+                const PetscScalar* funFlux = flux + fluxBufferOffset[fun];
+                for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
+                    fL[d] -= funFlux[d] * invVolumeL;
+                }
+            }
+        }
+        if (faceTable.writeRight[i]) {
+            const PetscReal invVolumeR = faceTable.rightInverseVolumes[i];
+            for (std::size_t fun = 0; fun < fluxId.size(); fun++) {
+                PetscScalar* fR;
+                DMPlexPointLocalFieldRef(dm, rightCell, fluxId[fun], locFArray, &fR) >> checkError;
+                const PetscScalar* funFlux = flux + fluxBufferOffset[fun];
+                for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
+                    fR[d] += funFlux[d] * invVolumeR;
+                }
+            }
+        }
+    };
+
+    // helper lambda to split the scratch memory (uL, uR, gradL, gradR, flux) for each chunk
+    auto computeFaceFluxWithScratch = [&](std::size_t i, std::size_t chunk) {
+        PetscScalar* uL = fluxScratch.scratch.data() + chunk * fluxScratch.scratchStride;
+        PetscScalar* uR = uL + totDim;
+        PetscScalar* gradL = uR + totDim;
+        PetscScalar* gradR = gradL + dim * totDim;
+        PetscScalar* flux = gradR + dim * totDim;
+        computeFaceFlux(i, uL, uR, gradL, gradR, flux);
+    };
+
+    // the faces are only computed concurrently when every flux function is thread safe
+    const bool threadSafe = std::all_of(rhsFunctions.begin(), rhsFunctions.end(), [](const auto& function) { return function.threadSafe; }) &&
+                            (!continuousFluxEvaluator || continuousFluxEvaluator->ThreadSafe());
 
-    PetscScalar *uL, *uR;
-    DMGetWorkArray(dm, totDim, MPIU_SCALAR, &uL) >> checkError;
-    DMGetWorkArray(dm, totDim, MPIU_SCALAR, &uR) >> checkError;
+    if (phase != FacePhase::all) {
+        // only march over the interior or halo part of the face table
+        const auto& faceIndices = phase == FacePhase::interior ? haloPartition.interiorFaces : haloPartition.haloFaces;
+        const auto& faceIndicesColoring = phase == FacePhase::interior ? haloPartition.interiorFaceColoring : haloPartition.haloFaceColoring;
+        if (faceIndicesColoring && threadSafe) {
+            faceIndicesColoring->ForEach([&](std::size_t i, std::size_t chunk) { computeFaceFluxWithScratch(faceIndices[i], chunk); });
+        } else {
+            for (const auto i : faceIndices) {
+                computeFaceFluxWithScratch(i, 0);
+            }
+        }
+    } else if (faceColoring && threadSafe) {
+        // faces with the same color do not share a cell, so they can be computed concurrently
+        faceColoring->ForEach(computeFaceFluxWithScratch);
+    } else {
+        // March over each valid face in this region
+        for (std::size_t i = 0; i < faceTable.Size(); ++i) {
+            computeFaceFluxWithScratch(i, 0);
+        }
+    }
+}
 
-    PetscScalar *gradL, *gradR;
-    DMGetWorkArray(dm, dim * totDim, MPIU_SCALAR, &gradL) >> checkError;
-    DMGetWorkArray(dm, dim * totDim, MPIU_SCALAR, &gradR) >> checkError;
+void ablate::finiteVolume::CellInterpolant::UpdateFluxScratch(PetscDS ds, PetscDS dsAux, PetscInt totDim, const std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
+                                                              const FaceInterpolant::ContinuousFluxEvaluator* continuousFluxEvaluator) {
+    // determine if the flux functions match the ones used to build the scratch
+    const std::size_t numberContinuousFunctions = continuousFluxEvaluator ? continuousFluxEvaluator->GetNumberFunctions() : 0;
+    bool matches = !fluxScratch.scratch.empty() && fluxScratch.hasAux == (dsAux != nullptr) && fluxScratch.functions.size() == rhsFunctions.size() &&
+                   fluxScratch.continuousFluxIds.size() == numberContinuousFunctions;
+    for (std::size_t fun = 0; matches && fun < rhsFunctions.size(); fun++) {
+        const auto& a = fluxScratch.functions[fun];
+        const auto& b = rhsFunctions[fun];
+        matches = a.function == b.function && a.context == b.context && a.field == b.field && a.inputFields == b.inputFields && a.auxFields == b.auxFields;
+    }
+    for (std::size_t fun = 0; matches && fun < numberContinuousFunctions; fun++) {
+        matches = fluxScratch.continuousFluxIds[fun] == continuousFluxEvaluator->GetFluxField(fun) && fluxScratch.continuousFluxSizes[fun] == continuousFluxEvaluator->GetFluxSize(fun);
+    }
+    if (matches) {
+        return;
+    }
 
-    // size up the aux variables
-    PetscScalar *auxL = nullptr, *auxR = nullptr;
+    fluxScratch = FluxScratch{};
+    fluxScratch.functions = rhsFunctions;
+    fluxScratch.hasAux = dsAux != nullptr;
 
     // Precompute the offsets to pass into the rhsFluxFunctionDescriptions
-    std::vector<PetscInt> fluxComponentSize(rhsFunctions.size());
-    std::vector<PetscInt> fluxId(rhsFunctions.size());
-    std::vector<std::vector<PetscInt>> uOff(rhsFunctions.size());
-    std::vector<std::vector<PetscInt>> aOff(rhsFunctions.size());
+    auto& fluxComponentSize = fluxScratch.fluxComponentSize;
+    auto& fluxId = fluxScratch.fluxId;
+    auto& fluxBufferOffset = fluxScratch.fluxBufferOffset;
+    auto& fluxBufferSize = fluxScratch.fluxBufferSize;
+    auto& uOff = fluxScratch.uOff;
+    auto& aOff = fluxScratch.aOff;
+    fluxComponentSize.resize(rhsFunctions.size());
+    fluxId.resize(rhsFunctions.size());
+    fluxBufferOffset.resize(rhsFunctions.size());
+    uOff.resize(rhsFunctions.size());
+    aOff.resize(rhsFunctions.size());
 
     // Get the full set of offsets from the ds
     PetscInt* uOffTotal;
     PetscDSGetComponentOffsets(ds, &uOffTotal) >> checkError;
 
+    // Each function writes into its own section of a single contiguous flux buffer
     for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
         const auto& field = subDomain->GetField(rhsFunctions[fun].field);
         fluxComponentSize[fun] = field.numberComponents;
         fluxId[fun] = field.id;
+        fluxBufferOffset[fun] = fluxBufferSize;
+        fluxBufferSize += field.numberComponents;
         for (std::size_t f = 0; f < rhsFunctions[fun].inputFields.size(); f++) {
             uOff[fun].push_back(uOffTotal[rhsFunctions[fun].inputFields[f]]);
         }
@@ -535,6 +1070,31 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
             }
         }
     }
+
+    // append the continuous flux functions to the end of the flux buffer so they are scattered with the discontinuous flux
+    fluxScratch.continuousFluxBufferOffset = fluxBufferSize;
+    for (std::size_t fun = 0; fun < numberContinuousFunctions; fun++) {
+        fluxScratch.continuousFluxIds.push_back(continuousFluxEvaluator->GetFluxField(fun));
+        fluxScratch.continuousFluxSizes.push_back(continuousFluxEvaluator->GetFluxSize(fun));
+        fluxComponentSize.push_back(continuousFluxEvaluator->GetFluxSize(fun));
+        fluxId.push_back(continuousFluxEvaluator->GetFluxField(fun));
+        fluxBufferOffset.push_back(fluxScratch.continuousFluxBufferOffset + continuousFluxEvaluator->GetFluxBufferOffset(fun));
+    }
+    if (continuousFluxEvaluator) {
+        fluxBufferSize += continuousFluxEvaluator->GetFluxBufferSize();
+    }
+
+    // Size up the scratch memory (uL, uR, gradL, gradR, flux) for each chunk, padded to a 64 byte cache line
+    const PetscInt dim = subDomain->GetDimensions();
+    constexpr std::size_t cacheLineScalars = 64 / sizeof(PetscScalar);
+    const std::size_t scratchSize = 2 * totDim + 2 * dim * totDim + fluxBufferSize;
+    fluxScratch.scratchStride = ((scratchSize + cacheLineScalars - 1) / cacheLineScalars) * cacheLineScalars;
+    fluxScratch.scratch.resize(fluxScratch.scratchStride * (faceColoring ? faceColoring->GetNumberChunks() : 1));
+}
+
+void ablate::finiteVolume::CellInterpolant::BuildFaceTable(DM dm, DM faceDM, DM cellDM, const PetscScalar* cellGeomArray, const std::shared_ptr<domain::Region>& solverRegion, const solver::Range& faceRange) {
+    faceTable = FaceTable{};
+
     // check for ghost cells
     DMLabel ghostLabel;
     DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
@@ -544,7 +1104,29 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
     PetscInt regionValue = 0;
     domain::Region::GetLabel(solverRegion, subDomain->GetDM(), regionLabel, regionValue);
 
-    // March over each face in this region
+    // helper lambda to determine if a cell is in the region
+    auto inRegion = [regionLabel, regionValue](PetscInt cell) {
+        PetscInt cellLabelValue = regionValue;
+        if (regionLabel) {
+            DMLabelGetValue(regionLabel, cell, &cellLabelValue) >> checkError;
+        }
+        return cellLabelValue == regionValue;
+    };
+
+    // helper lambda to determine if the flux should be written back to a cell
+    auto isWritable = [ghostLabel](PetscInt cell) {
+        PetscInt ghost = -1;
+        DMLabelGetValue(ghostLabel, cell, &ghost) >> checkError;
+        return ghost <= 0;
+    };
+
+    // helper lambda to compute the inverse volume (ghost cells may not have a valid volume)
+    auto inverseVolume = [cellGeomArray](PetscInt cellGeomOffset) {
+        const auto cg = (const PetscFVCellGeom*)(cellGeomArray + cellGeomOffset);
+        return cg->volume > 0.0 ? 1.0 / cg->volume : 0.0;
+    };
+
+    faceTable.faces.reserve(faceRange.end - faceRange.start);
     for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
         const PetscInt face = faceRange.points ? faceRange.points[f] : f;
 
@@ -555,71 +1137,132 @@ void ablate::finiteVolume::CellInterpolant::ComputeFluxSourceTerms(DM dm, PetscD
         DMPlexGetTreeChildren(dm, face, &nchild, nullptr) >> checkError;
         if (ghost >= 0 || nsupp > 2 || nchild > 0) continue;
 
-        // Get the face geometry
         const PetscInt* faceCells;
-        PetscFVFaceGeom* fg;
-        PetscFVCellGeom *cgL, *cgR;
-        DMPlexPointLocalRead(faceDM, face, faceGeomArray, &fg) >> checkError;
         DMPlexGetSupport(dm, face, &faceCells) >> checkError;
-        DMPlexPointLocalRead(cellDM, faceCells[0], cellGeomArray, &cgL) >> checkError;
-        DMPlexPointLocalRead(cellDM, faceCells[1], cellGeomArray, &cgR) >> checkError;
 
-        PetscInt leftFlowLabelValue = regionValue;
-        PetscInt rightFlowLabelValue = regionValue;
-        if (regionLabel) {
-            DMLabelGetValue(regionLabel, faceCells[0], &leftFlowLabelValue);
-            DMLabelGetValue(regionLabel, faceCells[1], &rightFlowLabelValue);
-        }
-        // compute the left/right face values
-        ProjectToFace(subDomain->GetFields(), ds, *fg, faceCells[0], *cgL, dm, xArray, dmGrads, locGradArrays, uL, gradL, leftFlowLabelValue == regionValue);
-        ProjectToFace(subDomain->GetFields(), ds, *fg, faceCells[1], *cgR, dm, xArray, dmGrads, locGradArrays, uR, gradR, rightFlowLabelValue == regionValue);
+        // store the geometry offsets
+        PetscInt faceGeomOffset, leftCellGeomOffset, rightCellGeomOffset;
+        DMPlexGetPointLocal(faceDM, face, &faceGeomOffset, nullptr) >> checkError;
+        DMPlexGetPointLocal(cellDM, faceCells[0], &leftCellGeomOffset, nullptr) >> checkError;
+        DMPlexGetPointLocal(cellDM, faceCells[1], &rightCellGeomOffset, nullptr) >> checkError;
+
+        const bool leftInRegion = inRegion(faceCells[0]);
+        const bool rightInRegion = inRegion(faceCells[1]);
+
+        faceTable.faces.push_back(face);
+        faceTable.leftCells.push_back(faceCells[0]);
+        faceTable.rightCells.push_back(faceCells[1]);
+        faceTable.faceGeomOffsets.push_back(faceGeomOffset);
+        faceTable.leftCellGeomOffsets.push_back(leftCellGeomOffset);
+        faceTable.rightCellGeomOffsets.push_back(rightCellGeomOffset);
+        faceTable.projectLeft.push_back(leftInRegion ? PETSC_TRUE : PETSC_FALSE);
+        faceTable.projectRight.push_back(rightInRegion ? PETSC_TRUE : PETSC_FALSE);
+        faceTable.writeLeft.push_back(leftInRegion && isWritable(faceCells[0]) ? PETSC_TRUE : PETSC_FALSE);
+        faceTable.writeRight.push_back(rightInRegion && isWritable(faceCells[1]) ? PETSC_TRUE : PETSC_FALSE);
+        faceTable.leftInverseVolumes.push_back(inverseVolume(leftCellGeomOffset));
+        faceTable.rightInverseVolumes.push_back(inverseVolume(rightCellGeomOffset));
+    }
 
-        // determine the left/right cells
-        if (auxArray) {
-            // Get the field values at this cell
-            DMPlexPointLocalRead(dmAux, faceCells[0], auxArray, &auxL) >> checkError;
-            DMPlexPointLocalRead(dmAux, faceCells[1], auxArray, &auxR) >> checkError;
-        }
+    // color the faces for threaded assembly
+    if (threaded) {
+        faceColoring = std::make_unique<FaceColoring>(faceTable.leftCells, faceTable.rightCells);
+    }
 
-        // March over each source function
-        for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
-            PetscArrayzero(flux, totDim) >> checkError;
-            const auto& rhsFluxFunctionDescription = rhsFunctions[fun];
-            rhsFluxFunctionDescription.function(dim, fg, uOff[fun].data(), uL, uR, aOff[fun].data(), auxL, auxR, flux, rhsFluxFunctionDescription.context) >> checkError;
+    faceTable.built = true;
+}
 
-            // add the flux back to the cell
-            PetscScalar *fL = nullptr, *fR = nullptr;
-            PetscInt cellLabelValue = regionValue;
-            DMLabelGetValue(ghostLabel, faceCells[0], &ghost) >> checkError;
-            if (regionLabel) {
-                DMLabelGetValue(regionLabel, faceCells[0], &cellLabelValue) >> checkError;
-            }
-            if (ghost <= 0 && regionValue == cellLabelValue) {
-                DMPlexPointLocalFieldRef(dm, faceCells[0], fluxId[fun], locFArray, &fL) >> checkError;
-            }
+void ablate::finiteVolume::CellInterpolant::BuildHaloPartition(DM dm, const solver::Range& cellRange) {
+    haloPartition.interiorCells.clear();
+    haloPartition.interiorFaces.clear();
+    haloPartition.haloFaces.clear();
+    haloPartition.gradGlobVecs.assign(gradientCellDms.size(), nullptr);
+    haloPartition.gradLocVecs.assign(gradientCellDms.size(), nullptr);
 
-            cellLabelValue = regionValue;
-            DMLabelGetValue(ghostLabel, faceCells[1], &ghost) >> checkError;
-            if (regionLabel) {
-                DMLabelGetValue(regionLabel, faceCells[1], &cellLabelValue) >> checkError;
+    // check for ghost cells
+    DMLabel ghostLabel;
+    DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
+    PetscInt boundaryCellStart;
+    DMPlexGetGhostCellStratum(dm, &boundaryCellStart, nullptr) >> checkError;
+
+    // the boundary and mpi ghost cells are only valid after the ghost exchange and boundary update
+    auto isOwned = [dm, ghostLabel, boundaryCellStart](PetscInt cell) {
+        PetscInt ghost = -1;
+        if (ghostLabel) {
+            DMLabelGetValue(ghostLabel, cell, &ghost) >> checkError;
+        }
+        PetscInt owned;
+        DMPlexGetPointGlobal(dm, cell, &owned, nullptr) >> checkError;
+        return owned >= 0 && ghost < 0 && (boundaryCellStart < 0 || cell < boundaryCellStart);
+    };
+
+    // a cell is interior if it and every face neighbor used by its gradient/limiter stencil is owned
+    auto isInterior = [dm, ghostLabel, &isOwned](PetscInt cell) {
+        if (!isOwned(cell)) {
+            return false;
+        }
+        PetscInt coneSize;
+        const PetscInt* cellFaces;
+        DMPlexGetConeSize(dm, cell, &coneSize) >> checkError;
+        DMPlexGetCone(dm, cell, &cellFaces) >> checkError;
+        for (PetscInt f = 0; f < coneSize; ++f) {
+            PetscInt ghost = -1, numberSupport, numberChildren;
+            PetscBool boundary;
+            if (ghostLabel) {
+                DMLabelGetValue(ghostLabel, cellFaces[f], &ghost) >> checkError;
             }
-            if (ghost <= 0 && regionValue == cellLabelValue) {
-                DMPlexPointLocalFieldRef(dm, faceCells[1], fluxId[fun], locFArray, &fR) >> checkError;
+            DMIsBoundaryPoint(dm, cellFaces[f], &boundary) >> checkError;
+            DMPlexGetSupportSize(dm, cellFaces[f], &numberSupport) >> checkError;
+            DMPlexGetTreeChildren(dm, cellFaces[f], &numberChildren, nullptr) >> checkError;
+            if (ghost >= 0 || boundary || numberSupport != 2 || numberChildren) {
+                return false;
             }
 
-            for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
-                if (fL) fL[d] -= flux[d] / cgL->volume;
-                if (fR) fR[d] += flux[d] / cgR->volume;
+            const PetscInt* faceCells;
+            DMPlexGetSupport(dm, cellFaces[f], &faceCells) >> checkError;
+            if (!isOwned(faceCells[0] == cell ? faceCells[1] : faceCells[0])) {
+                return false;
             }
         }
+        return true;
+    };
+
+    // flag the interior cells in this region
+    PetscInt cellEnd;
+    DMPlexGetHeightStratum(dm, 0, &haloPartition.cellStart, &cellEnd) >> checkError;
+    haloPartition.interiorCells.resize(cellEnd - haloPartition.cellStart, PETSC_FALSE);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+        if (isInterior(cell)) {
+            haloPartition.interiorCells[cell - haloPartition.cellStart] = PETSC_TRUE;
+        }
     }
 
-    // cleanup
-    DMRestoreWorkArray(dm, totDim, MPIU_SCALAR, &flux) >> checkError;
-    DMRestoreWorkArray(dm, totDim, MPIU_SCALAR, &uL) >> checkError;
-    DMRestoreWorkArray(dm, totDim, MPIU_SCALAR, &uR) >> checkError;
-    DMRestoreWorkArray(dm, dim * totDim, MPIU_SCALAR, &gradL) >> checkError;
-    DMRestoreWorkArray(dm, dim * totDim, MPIU_SCALAR, &gradR) >> checkError;
+    // split the face table
+    for (std::size_t i = 0; i < faceTable.Size(); ++i) {
+        if (haloPartition.IsInterior(faceTable.leftCells[i]) && haloPartition.IsInterior(faceTable.rightCells[i])) {
+            haloPartition.interiorFaces.push_back(i);
+        } else {
+            haloPartition.haloFaces.push_back(i);
+        }
+    }
+
+    // color each part of the face table for threaded assembly
+    if (threaded) {
+        auto colorFaces = [this](const std::vector<std::size_t>& faceIndices) {
+            std::vector<PetscInt> leftCells, rightCells;
+            leftCells.reserve(faceIndices.size());
+            rightCells.reserve(faceIndices.size());
+            for (const auto i : faceIndices) {
+                leftCells.push_back(faceTable.leftCells[i]);
+                rightCells.push_back(faceTable.rightCells[i]);
+            }
+            return std::make_unique<FaceColoring>(leftCells, rightCells);
+        };
+        haloPartition.interiorFaceColoring = colorFaces(haloPartition.interiorFaces);
+        haloPartition.haloFaceColoring = colorFaces(haloPartition.haloFaces);
+    }
+
+    haloPartition.built = true;
 }
 
 static PetscErrorCode BuildGradientReconstruction_Internal(DM dm, DMLabel regionLabel, PetscInt regionValue, PetscFV fvm, DM dmFace, PetscScalar* fgeom, DM dmCell, PetscScalar* cgeom) {
@@ -2,10 +2,14 @@
 #define ABLATELIBRARY_CELLINTERPOLANT_HPP
 
 #include <petsc.h>
+#include <memory>
 #include <vector>
 #include "domain/region.hpp"
 #include "domain/subDomain.hpp"
+#include "faceColoring.hpp"
+#include "faceInterpolant.hpp"
 #include "solver/range.hpp"
+#include "utilities/memoryUsage.hpp"
 namespace ablate::finiteVolume {
 
 class CellInterpolant {
@@ -29,6 +33,9 @@ class CellInterpolant {
         PetscInt field;
         std::vector<PetscInt> inputFields;
         std::vector<PetscInt> auxFields;
+
+        //! true if the function and context can be called concurrently, otherwise the faces are computed serially even when threaded
+        bool threadSafe = false;
     };
 
     /**
@@ -41,22 +48,240 @@ class CellInterpolant {
         std::vector<PetscInt> fields;
         std::vector<PetscInt> inputFields;
         std::vector<PetscInt> auxFields;
+
+        //! true if the function and context can be called concurrently, otherwise the cells are computed serially even when threaded
+        bool threadSafe = false;
     };
 
+    /**
+     * The subset of faces computed by a call to ComputeRHS.  Interior faces only read owned cells (including the gradient and limiter stencils of their cells) so
+     * they can be computed while the ghost exchange of locX is in flight.  Halo faces are the remaining faces.  Computing the interior and then the halo faces
+     * is equivalent to computing all faces at once.
+     */
+    enum class FacePhase { all, interior, halo };
+
    private:
     //! use the subDomain to setup the problem
     std::shared_ptr<ablate::domain::SubDomain> subDomain;
 
-    //! store the dmGrad, these are specific to this finite volume solver
+    //! store the dmGrad, these are specific to this finite volume solver.  The dm is null if the field gradient is not needed
     std::vector<DM> gradientCellDms;
 
+    //! the fields that are inputs to the discontinuous flux functions and must be projected to the face
+    std::vector<domain::Field> projectedFields;
+
+    /**
+     * Flat (struct-of-arrays) description of every valid face in the face range.  This is built once and reused for every rhs evaluation so that the
+     * label and plex queries are not repeated for each face/function.
+     */
+    struct FaceTable {
+        //! true once the table has been populated
+        bool built = false;
+        //! the face point for each valid face
+        std::vector<PetscInt> faces;
+        //! the left/right cells in the support of the face
+        std::vector<PetscInt> leftCells;
+        std::vector<PetscInt> rightCells;
+        //! the offsets into the face/cell geometry arrays
+        std::vector<PetscInt> faceGeomOffsets;
+        std::vector<PetscInt> leftCellGeomOffsets;
+        std::vector<PetscInt> rightCellGeomOffsets;
+        //! flag to determine if the left/right cell is in the solver region and should be projected to the face
+        std::vector<PetscBool> projectLeft;
+        std::vector<PetscBool> projectRight;
+        //! flag to determine if the flux should be added back to the left/right cell
+        std::vector<PetscBool> writeLeft;
+        std::vector<PetscBool> writeRight;
+        //! the precomputed inverse volume of the left/right cells used to scatter the flux
+        std::vector<PetscReal> leftInverseVolumes;
+        std::vector<PetscReal> rightInverseVolumes;
+
+        inline std::size_t Size() const { return faces.size(); }
+    };
+
+    //! the precomputed face table for the discontinuous flux functions
+    FaceTable faceTable;
+
+    //! the points with any value in the ghost label, precomputed so the point sources do not query the label for every cell
+    domain::RegionMask ghostMask;
+
+    //! if true, the face flux and point sources are computed concurrently in the kokkos host execution space
+    const bool threaded;
+
+    //! the optional coloring of the face table used for threaded assembly
+    std::unique_ptr<FaceColoring> faceColoring;
+
+    //! if true, the limited gradients are replaced with a WENO weighted combination of the central and one-sided least squares gradients
+    const bool wenoGradients;
+
+    //! the linear weight of the central stencil and the WENO smoothness exponent/epsilon
+    static constexpr PetscReal wenoCentralWeight = 1.0E3;
+    static constexpr PetscReal wenoExponent = 4.0;
+    static constexpr PetscReal wenoEpsilon = 1.0E-14;
+
+    /**
+     * Compressed sparse row description of the least squares gradient for a single field.  Each row is an owned cell and each entry
+     * holds the neighbor cell offset and the reconstruction weights so that grad_c = sum_n w_n (x_n - x_c).
+     */
+    struct GradientStencil {
+        //! true once the stencil has been populated
+        bool built = false;
+        //! the offset into the global gradient array for each row
+        std::vector<PetscInt> gradOffsets;
+        //! the offset into the local gradient array for each row
+        std::vector<PetscInt> gradLocalOffsets;
+        //! the cell for each row
+        std::vector<PetscInt> cells;
+        //! the offset into the local solution array for the cell in each row
+        std::vector<PetscInt> cellOffsets;
+        //! the start of each row in the neighbor arrays (size rows + 1)
+        std::vector<PetscInt> rowStart;
+        //! the offset into the local solution array for each neighbor
+        std::vector<PetscInt> neighborOffsets;
+        //! the reconstruction weights for each neighbor in [entry*dim + dir] order
+        std::vector<PetscReal> weights;
+        //! the cell for each neighbor
+        std::vector<PetscInt> neighborCells;
+
+        //! true once the WENO candidate stencils have been populated
+        bool wenoBuilt = false;
+        //! the start of each row in the candidate weights (size rows + 1), each row holds rowSize candidates of rowSize entries
+        std::vector<PetscInt> candidateStart;
+        //! the one-sided candidates for each row, candidate k drops the neighbor most opposite to neighbor k.  The weights are stored in
+        //! [(candidateStart[row] + k*rowSize + entry)*dim + dir] order with zero for the dropped neighbor.  Degenerate candidates use the central weights.
+        std::vector<PetscReal> candidateWeights;
+        //! the squared mean neighbor distance for each row used to scale the smoothness indicators
+        std::vector<PetscReal> lengthSquared;
+
+        //! true once the rows have been split into interior and halo rows
+        bool partitioned = false;
+        //! the rows for interior/halo cells
+        std::vector<std::size_t> interiorRows;
+        std::vector<std::size_t> haloRows;
+    };
+
+    //! the gradient stencil for each field
+    std::vector<GradientStencil> gradientStencils;
+
+    /**
+     * The precomputed flux function offsets and the per chunk scratch memory (uL, uR, gradL, gradR, flux) used by the face flux loop.  This is
+     * persistent between rhs evaluations and only rebuilt when the set of flux functions changes.
+     */
+    struct FluxScratch {
+        //! the discontinuous flux functions used to build the offsets
+        std::vector<DiscontinuousFluxFunctionDescription> functions;
+        //! the continuous flux field ids/sizes used to build the offsets
+        std::vector<PetscInt> continuousFluxIds;
+        std::vector<PetscInt> continuousFluxSizes;
+        //! true if the aux offsets were computed
+        bool hasAux = false;
+
+        //! the field id, size, and flux buffer offset for each flux function (discontinuous then continuous)
+        std::vector<PetscInt> fluxComponentSize;
+        std::vector<PetscInt> fluxId;
+        std::vector<PetscInt> fluxBufferOffset;
+        //! the total flux buffer size and the offset of the continuous flux in the buffer
+        PetscInt fluxBufferSize = 0;
+        PetscInt continuousFluxBufferOffset = 0;
+        //! the field/aux offsets passed to each discontinuous flux function
+        std::vector<std::vector<PetscInt>> uOff;
+        std::vector<std::vector<PetscInt>> aOff;
+
+        //! the scratch memory for each chunk, the stride is padded to a cache line to prevent false sharing between threads
+        std::vector<PetscScalar> scratch;
+        std::size_t scratchStride = 0;
+    };
+
+    //! the persistent flux offsets and scratch
+    FluxScratch fluxScratch;
+
+    /**
+     * The split of the cells and face table into interior and halo parts.  An interior cell is an owned, non ghost cell in the region whose face neighbors are all
+     * owned and non ghost, so its gradient and limiter only read owned values.  An interior face has two interior cells.
+     */
+    struct HaloPartition {
+        //! true once the partition has been populated
+        bool built = false;
+        //! the first cell in the dm cell chart
+        PetscInt cellStart = 0;
+        //! flag for each cell (offset by cellStart) to determine if it is interior
+        std::vector<PetscBool> interiorCells;
+        //! the face table indices for the interior and halo faces
+        std::vector<std::size_t> interiorFaces;
+        std::vector<std::size_t> haloFaces;
+        //! the optional coloring of the interior/halo faces used for threaded assembly
+        std::unique_ptr<FaceColoring> interiorFaceColoring;
+        std::unique_ptr<FaceColoring> haloFaceColoring;
+        //! the global and local gradient vector for each field held between the interior and halo phase
+        std::vector<Vec> gradGlobVecs;
+        std::vector<Vec> gradLocVecs;
+
+        inline bool IsInterior(PetscInt cell) const {
+            const PetscInt c = cell - cellStart;
+            return c >= 0 && c < (PetscInt)interiorCells.size() && interiorCells[c];
+        }
+    };
+
+    //! the interior/halo split used to overlap the ghost exchange with the face flux
+    HaloPartition haloPartition;
+
+    /**
+     * Populates the halo partition from the face table
+     * @param dm
+     * @param cellRange the cells in the solver region
+     */
+    void BuildHaloPartition(DM dm, const solver::Range& cellRange);
+
+    /**
+     * Rebuilds the flux scratch if the supplied flux functions differ from the ones used to build it
+     * @param ds
+     * @param dsAux
+     * @param totDim
+     * @param rhsFunctions
+     * @param continuousFluxEvaluator
+     */
+    void UpdateFluxScratch(PetscDS ds, PetscDS dsAux, PetscInt totDim, const std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
+                           const FaceInterpolant::ContinuousFluxEvaluator* continuousFluxEvaluator);
+
+    /**
+     * Builds the gradient stencil for this field
+     * @param field
+     * @param dm the field dm
+     * @param dmGrad
+     * @param gradGlobVec
+     * @param faceGeomVec
+     * @param faceRange
+     * @param gradientStencil
+     */
+    static void BuildGradientStencil(const domain::Field& field, DM dm, DM dmGrad, Vec gradGlobVec, Vec faceGeomVec, const solver::Range& faceRange, GradientStencil& gradientStencil);
+
+    /**
+     * Precomputes the one-sided least squares candidates used by the WENO gradients.  The neighbor displacements are recovered from the central
+     * least squares weights (dx_n = (sum_m w_m w_m^T)^-1 w_n) so periodic neighbors are handled the same as the central stencil.
+     * Must be called after BuildGradientStencil.
+     * @param dim
+     * @param gradientStencil
+     */
+    static void BuildWenoStencil(PetscInt dim, GradientStencil& gradientStencil);
+
+    /**
+     * Populates the face table for the supplied face range
+     * @param dm
+     * @param faceDM
+     * @param cellDM
+     * @param cellGeomArray
+     * @param solverRegion
+     * @param faceRange
+     */
+    void BuildFaceTable(DM dm, DM faceDM, DM cellDM, const PetscScalar* cellGeomArray, const std::shared_ptr<domain::Region>& solverRegion, const solver::Range& faceRange);
+
     /**
      * Function to compute the flux source terms
      */
     void ComputeFluxSourceTerms(DM dm, PetscDS ds, PetscInt totDim, const PetscScalar* xArray, DM dmAux, PetscDS dsAux, PetscInt totDimAux, const PetscScalar* auxArray, DM faceDM,
                                 const PetscScalar* faceGeomArray, DM cellDM, const PetscScalar* cellGeomArray, std::vector<DM>& dmGrads, std::vector<const PetscScalar*>& locGradArrays,
                                 PetscScalar* locFArray, const std::shared_ptr<domain::Region>& solverRegion, std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions,
-                                const solver::Range& faceRange, const solver::Range& cellRange);
+                                const solver::Range& faceRange, const solver::Range& cellRange, const FaceInterpolant::ContinuousFluxEvaluator* continuousFluxEvaluator, FacePhase phase);
 
     /**
      * support call to project to a single face from a side
@@ -74,9 +299,10 @@ class CellInterpolant {
      * @param faceGeomVec
      * @param faceRange
      * @param cellRange
+     * @param phase the interior phase only computes the interior cells and holds the gradient vectors for the halo phase
      */
     void ComputeFieldGradients(const domain::Field& field, Vec xLocalVec, Vec& gradLocVec, DM& dmGrad, Vec cellGeomVec, Vec faceGeomVec, const solver::Range& faceRange,
-                               const solver::Range& cellRange);
+                               const solver::Range& cellRange, FacePhase phase = FacePhase::all);
 
     /**
      * Helper function to compute the gradient at each cell
@@ -98,8 +324,12 @@ class CellInterpolant {
      * @param solverRegion
      * @param faceGeomVec
      * @param cellGeomVec
+     * @param discontinuousFluxFunctions the flux functions used to determine which fields must be reconstructed
+     * @param threaded if true the face fluxes and point sources are computed concurrently.  All flux/point functions must be thread safe.
+     * @param wenoGradients if true the gradients used to project to the face are WENO weighted instead of limited with the PetscFV limiter
      */
-    CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomain, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec);
+    CellInterpolant(std::shared_ptr<ablate::domain::SubDomain> subDomain, const std::shared_ptr<domain::Region>& solverRegion, Vec faceGeomVec, Vec cellGeomVec,
+                    const std::vector<DiscontinuousFluxFunctionDescription>& discontinuousFluxFunctions, bool threaded = false, bool wenoGradients = false);
     ~CellInterpolant();
 
     /**
@@ -107,9 +337,12 @@ class CellInterpolant {
      * @param time
      * @param locXVec
      * @param locFVec
+     * @param continuousFluxEvaluator optional continuous flux functions that are evaluated and scattered in the same face pass
+     * @param phase the subset of faces to compute.  The interior phase may be called while the ghost exchange of locX is in flight and must be followed by the halo phase.
      */
     void ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
-                    std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, const solver::Range& faceRange, const solver::Range& cellRange, Vec cellGeomVec, Vec faceGeomVec);
+                    std::vector<CellInterpolant::DiscontinuousFluxFunctionDescription>& rhsFunctions, const solver::Range& faceRange, const solver::Range& cellRange, Vec cellGeomVec, Vec faceGeomVec,
+                    const FaceInterpolant::ContinuousFluxEvaluator* continuousFluxEvaluator = nullptr, FacePhase phase = FacePhase::all);
 
     /**
      * Adds in contributions for face based rhs point cell functions
@@ -119,6 +352,13 @@ class CellInterpolant {
      */
     void ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion, std::vector<CellInterpolant::PointFunctionDescription>& rhsFunctions,
                     const solver::Range& cellRange, Vec cellGeomVec);
+
+    /**
+     * Add the gradient dms, face table, gradient stencils, and flux scratch to the memory usage
+     * @param memoryUsage
+     * @param prefix prepended to each entry name
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const;
 };
 
 }  // namespace ablate::finiteVolume
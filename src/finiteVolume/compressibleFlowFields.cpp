@@ -7,6 +7,9 @@ ablate::finiteVolume::CompressibleFlowFields::CompressibleFlowFields(std::shared
     : eos(eos), extraVariables(extraVariablesIn), region(region), conservedFieldOptions(conservedFieldParameters) {}
 
 std::vector<std::shared_ptr<ablate::domain::FieldDescription>> ablate::finiteVolume::CompressibleFlowFields::GetFields() {
+    // the aux fields are all computed from the conserved fields
+    const std::vector<std::string> derivedTags{domain::Field::DERIVED_TAG};
+
     std::vector<std::shared_ptr<ablate::domain::FieldDescription>> flowFields{
         std::make_shared<domain::FieldDescription>(EULER_FIELD,
                                                    EULER_FIELD,
@@ -16,14 +19,21 @@ std::vector<std::shared_ptr<ablate::domain::FieldDescription>> ablate::finiteVol
                                                    region,
                                                    conservedFieldOptions),
         std::make_shared<domain::FieldDescription>(
-            TEMPERATURE_FIELD, TEMPERATURE_FIELD, domain::FieldDescription::ONECOMPONENT, domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions),
-        std::make_shared<domain::FieldDescription>(
-            VELOCITY_FIELD, VELOCITY_FIELD, std::vector<std::string>{"vel" + domain::FieldDescription::DIMENSION}, domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions)};
+            TEMPERATURE_FIELD, TEMPERATURE_FIELD, domain::FieldDescription::ONECOMPONENT, domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions, derivedTags),
+        std::make_shared<domain::FieldDescription>(VELOCITY_FIELD,
+                                                   VELOCITY_FIELD,
+                                                   std::vector<std::string>{"vel" + domain::FieldDescription::DIMENSION},
+                                                   domain::FieldLocation::AUX,
+                                                   domain::FieldType::FVM,
+                                                   region,
+                                                   auxFieldOptions,
+                                                   derivedTags)};
 
     if (!eos->GetSpeciesVariables().empty()) {
         flowFields.emplace_back(
             std::make_shared<domain::FieldDescription>(DENSITY_YI_FIELD, DENSITY_YI_FIELD, eos->GetSpecies(), domain::FieldLocation::SOL, domain::FieldType::FVM, region, conservedFieldOptions));
-        flowFields.emplace_back(std::make_shared<domain::FieldDescription>(YI_FIELD, YI_FIELD, eos->GetSpecies(), domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions));
+        flowFields.emplace_back(
+            std::make_shared<domain::FieldDescription>(YI_FIELD, YI_FIELD, eos->GetSpecies(), domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions, derivedTags));
     }
 
     if (!eos->GetProgressVariables().empty()) {
@@ -35,14 +45,15 @@ std::vector<std::shared_ptr<ablate::domain::FieldDescription>> ablate::finiteVol
                                                                            region,
                                                                            conservedFieldOptions,
                                                                            std::vector<std::string>{EV_TAG}));
-        flowFields.emplace_back(
-            std::make_shared<domain::FieldDescription>(PROGRESS_FIELD, PROGRESS_FIELD, eos->GetProgressVariables(), domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions));
+        flowFields.emplace_back(std::make_shared<domain::FieldDescription>(
+            PROGRESS_FIELD, PROGRESS_FIELD, eos->GetProgressVariables(), domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions, derivedTags));
     }
 
     if (!extraVariables.empty()) {
         flowFields.emplace_back(std::make_shared<domain::FieldDescription>(
             DENSITY_EV_FIELD, DENSITY_EV_FIELD, extraVariables, domain::FieldLocation::SOL, domain::FieldType::FVM, region, conservedFieldOptions, std::vector<std::string>{EV_TAG}));
-        flowFields.emplace_back(std::make_shared<domain::FieldDescription>(EV_FIELD, EV_FIELD, extraVariables, domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions));
+        flowFields.emplace_back(
+            std::make_shared<domain::FieldDescription>(EV_FIELD, EV_FIELD, extraVariables, domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions, derivedTags));
     }
 
     return flowFields;
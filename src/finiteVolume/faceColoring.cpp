@@ -0,0 +1,93 @@
+#include "faceColoring.hpp"
+#include <algorithm>
+#include <unordered_map>
+#include "utilities/kokkosUtilities.hpp"
+
+ablate::finiteVolume::FaceColoring::FaceColoring(const std::vector<PetscInt>& leftCells, const std::vector<PetscInt>& rightCells) {
+    // each face writes to the left and right cell
+    std::vector<std::size_t> offsets(leftCells.size() + 1);
+    std::vector<PetscInt> points(2 * leftCells.size());
+    for (std::size_t i = 0; i < leftCells.size(); ++i) {
+        offsets[i + 1] = 2 * (i + 1);
+        points[2 * i] = leftCells[i];
+        points[2 * i + 1] = rightCells[i];
+    }
+    Color(offsets, points);
+}
+
+ablate::finiteVolume::FaceColoring::FaceColoring(const std::vector<std::vector<PetscInt>>& facePoints) {
+    std::vector<std::size_t> offsets(facePoints.size() + 1, 0);
+    std::vector<PetscInt> points;
+    for (std::size_t i = 0; i < facePoints.size(); ++i) {
+        points.insert(points.end(), facePoints[i].begin(), facePoints[i].end());
+        offsets[i + 1] = points.size();
+    }
+    Color(offsets, points);
+}
+
+void ablate::finiteVolume::FaceColoring::Color(const std::vector<std::size_t>& offsets, const std::vector<PetscInt>& points) {
+    // the number of chunks is limited by the available threads
+    numberChunks = ablate::utilities::KokkosUtilities::GetHostConcurrency();
+
+    // keep track of the colors already used by each point
+    const std::size_t numberFaces = offsets.size() - 1;
+    std::unordered_map<PetscInt, std::vector<bool>> pointColors;
+    faceColors.assign(numberFaces, 0);
+    std::size_t numberColors = 0;
+
+    for (std::size_t i = 0; i < numberFaces; ++i) {
+        // find the smallest color not used by any point of this face
+        std::size_t color = 0;
+        bool used = true;
+        while (used) {
+            used = false;
+            for (std::size_t p = offsets[i]; p < offsets[i + 1] && !used; ++p) {
+                const auto& colors = pointColors[points[p]];
+                used = color < colors.size() && colors[color];
+            }
+            if (used) {
+                color++;
+            }
+        }
+
+        // mark the color as used
+        for (std::size_t p = offsets[i]; p < offsets[i + 1]; ++p) {
+            auto& colors = pointColors[points[p]];
+            if (colors.size() <= color) {
+                colors.resize(color + 1, false);
+            }
+            colors[color] = true;
+        }
+
+        faceColors[i] = color;
+        numberColors = std::max(numberColors, color + 1);
+    }
+
+    // order the faces by color (counting sort)
+    colorOffsets.resize(numberColors + 1, 0);
+    for (const auto color : faceColors) {
+        colorOffsets[color + 1]++;
+    }
+    for (std::size_t c = 0; c < numberColors; ++c) {
+        colorOffsets[c + 1] += colorOffsets[c];
+    }
+    coloredFaces.resize(faceColors.size());
+    std::vector<std::size_t> position(colorOffsets.begin(), colorOffsets.end() - 1);
+    for (std::size_t i = 0; i < faceColors.size(); ++i) {
+        coloredFaces[position[faceColors[i]]++] = i;
+    }
+}
+
+void ablate::finiteVolume::FaceColoring::ForEach(const std::function<void(std::size_t, std::size_t)>& function) const {
+    for (std::size_t c = 0; c < GetNumberColors(); ++c) {
+        const std::size_t colorStart = colorOffsets[c];
+        const std::size_t colorSize = colorOffsets[c + 1] - colorStart;
+
+        // faces in this color do not share a cell, so split the color into concurrent chunks
+        ablate::utilities::KokkosUtilities::ParallelForChunks(colorSize, [&](std::size_t start, std::size_t end, std::size_t chunk) {
+            for (std::size_t f = start; f < end; ++f) {
+                function(coloredFaces[colorStart + f], chunk);
+            }
+        });
+    }
+}
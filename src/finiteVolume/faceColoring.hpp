@@ -0,0 +1,77 @@
+#ifndef ABLATELIBRARY_FACECOLORING_HPP
+#define ABLATELIBRARY_FACECOLORING_HPP
+
+#include <petsc.h>
+#include <functional>
+#include <vector>
+
+namespace ablate::finiteVolume {
+
+/**
+ * Greedy coloring of a list of faces so that no two faces of the same color share a cell (or any other point written by the face).  Faces of a single color can then be evaluated
+ * concurrently without write conflicts on the cell based rhs.  Each color is executed in turn using KokkosUtilities::ParallelForChunks.
+ */
+class FaceColoring {
+   private:
+    //! the face indices (into the original list) ordered by color
+    std::vector<std::size_t> coloredFaces;
+
+    //! the offset into coloredFaces for each color (size numberColors + 1)
+    std::vector<std::size_t> colorOffsets;
+
+    //! the color of each face (in the original list)
+    std::vector<std::size_t> faceColors;
+
+    //! the number of independent chunks each color is split into
+    std::size_t numberChunks = 1;
+
+    /**
+     * Greedy coloring of the faces where the points for face i are points[offsets[i]] to points[offsets[i+1]]
+     * @param offsets the start of each face in the points (size numberFaces + 1)
+     * @param points the points written by each face
+     */
+    void Color(const std::vector<std::size_t>& offsets, const std::vector<PetscInt>& points);
+
+   public:
+    /**
+     * Colors the faces described by the left/right support cells
+     * @param leftCells the left cell for each face
+     * @param rightCells the right cell for each face
+     */
+    FaceColoring(const std::vector<PetscInt>& leftCells, const std::vector<PetscInt>& rightCells);
+
+    /**
+     * Colors the faces described by the list of points each face writes to, i.e. a boundary face and its stencil
+     * @param facePoints the points written by each face
+     */
+    explicit FaceColoring(const std::vector<std::vector<PetscInt>>& facePoints);
+
+    /**
+     * The number of colors required to separate faces sharing a cell
+     * @return
+     */
+    [[nodiscard]] inline std::size_t GetNumberColors() const { return colorOffsets.empty() ? 0 : colorOffsets.size() - 1; }
+
+    /**
+     * The number of chunks that may be executed concurrently.  Any per thread scratch memory should be sized for this many chunks.
+     * @return
+     */
+    [[nodiscard]] inline std::size_t GetNumberChunks() const { return numberChunks; }
+
+    /**
+     * The color assigned to the face
+     * @param index the face index (into the original list)
+     * @return
+     */
+    [[nodiscard]] inline std::size_t GetColor(std::size_t index) const { return faceColors[index]; }
+
+    /**
+     * Calls the function for every face, color by color.  The faces in a color are split into chunks that are executed concurrently.
+     * Any exception thrown by the function is rethrown after the color completes.
+     * @param function called with the face index (into the original list) and the chunk id
+     */
+    void ForEach(const std::function<void(std::size_t index, std::size_t chunk)>& function) const;
+};
+
+}  // namespace ablate::finiteVolume
+#endif  // ABLATELIBRARY_FACECOLORING_HPP
@@ -5,8 +5,8 @@
 #include "utilities/mathUtilities.hpp"
 
 ablate::finiteVolume::FaceInterpolant::FaceInterpolant(const std::shared_ptr<ablate::domain::SubDomain>& subDomain, const std::shared_ptr<domain::Region> solverRegion, Vec faceGeomVec,
-                                                       Vec cellGeomVec)
-    : subDomain(subDomain) {
+                                                       Vec cellGeomVec, bool threaded)
+    : subDomain(subDomain), threaded(threaded) {
     auto ds = subDomain->GetDiscreteSystem();
     PetscDSGetTotalDimension(ds, &solTotalSize) >> checkError;
     CreateFaceDm(solTotalSize, subDomain->GetDM(), faceSolutionDm);
@@ -22,7 +22,9 @@ ablate::finiteVolume::FaceInterpolant::FaceInterpolant(const std::shared_ptr<abl
     // Size up the stencil
     PetscInt fStart, fEnd;
     DMPlexGetHeightStratum(subDomain->GetDM(), 1, &fStart, &fEnd) >> checkError;
-    stencils.resize(fEnd - fStart);
+    globalFaceStart = fStart;
+    stencilStart.reserve(fEnd - fStart + 1);
+    stencilStart.push_back(0);
 
     // extract the dm
     auto dm = subDomain->GetDM();
@@ -52,19 +54,27 @@ ablate::finiteVolume::FaceInterpolant::FaceInterpolant(const std::shared_ptr<abl
     DMLabel ghostLabel;
     DMGetLabel(subDomain->GetDM(), "ghost", &ghostLabel) >> checkError;
 
-    // Compute the stencil for each face
-    PetscInt iFace = 0;
-    for (PetscInt face = fStart; face < fEnd; face++) {
-        auto& stencil = stencils[iFace++];
+    // precompute the region and ghost membership used when assembling the flux
+    regionMask = domain::Region::GetMask(solverRegion, dm);
+    ghostMask = domain::Region::GetMask(ghostLabel, dm);
 
+    // Compute the stencil for each face and pack it
+    const auto dim = subDomain->GetDimensions();
+    for (PetscInt face = fStart; face < fEnd; face++) {
         // make sure that this is a valid face
         PetscInt ghost, nsupp, nchild;
         DMLabelGetValue(ghostLabel, face, &ghost) >> checkError;
         DMPlexGetSupportSize(subDomain->GetDM(), face, &nsupp) >> checkError;
         DMPlexGetTreeChildren(subDomain->GetDM(), face, &nchild, nullptr) >> checkError;
-        if (ghost >= 0 || nsupp > 2 || nchild > 0) continue;
+        if (ghost < 0 && nsupp <= 2 && nchild <= 0) {
+            stencil::Stencil stencil;
+            faceStencilGenerator->Generate(face, stencil, *subDomain, solverRegion, cellDM, cellGeomArray, faceDM, faceGeomArray);
 
-        faceStencilGenerator->Generate(face, stencil, *subDomain, solverRegion, cellDM, cellGeomArray, faceDM, faceGeomArray);
+            stencilPoints.insert(stencilPoints.end(), stencil.stencil.begin(), stencil.stencil.begin() + stencil.stencilSize);
+            stencilWeights.insert(stencilWeights.end(), stencil.weights.begin(), stencil.weights.begin() + stencil.stencilSize);
+            stencilGradientWeights.insert(stencilGradientWeights.end(), stencil.gradientWeights.begin(), stencil.gradientWeights.begin() + stencil.stencilSize * dim);
+        }
+        stencilStart.push_back((PetscInt)stencilPoints.size());
     }
 
     // clean up the geom
@@ -87,6 +97,20 @@ ablate::finiteVolume::FaceInterpolant::~FaceInterpolant() {
     }
 }
 
+void ablate::finiteVolume::FaceInterpolant::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const {
+    const auto faceDmName = prefix + "faceDm";
+    for (const auto& faceDm : {faceSolutionDm, faceSolutionGradDm, faceAuxDm, faceAuxGradDm}) {
+        memoryUsage.Add(faceDmName, utilities::MemoryUsage::DMDataBytes(faceDm));
+    }
+
+    const auto stencilName = prefix + "faceStencil";
+    memoryUsage.Add(stencilName, stencilStart);
+    memoryUsage.Add(stencilName, stencilPoints);
+    memoryUsage.Add(stencilName, stencilWeights);
+    memoryUsage.Add(stencilName, stencilGradientWeights);
+    memoryUsage.Add(stencilName, validFaces);
+}
+
 void ablate::finiteVolume::FaceInterpolant::CreateFaceDm(PetscInt totalDim, DM dm, DM& newDm) {
     PetscInt fStart, fEnd;
     DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> checkError;
@@ -110,8 +134,7 @@ void ablate::finiteVolume::FaceInterpolant::GetInterpolatedFaceVectors(Vec solut
     // Compute the stencil for each face
     auto dim = subDomain->GetDimensions();
     PetscInt fEnd;
-    DMPlexGetHeightStratum(subDomain->GetDM(), 1, &globalFaceStart, &fEnd) >> checkError;
-    stencils.resize(fEnd - globalFaceStart);
+    DMPlexGetHeightStratum(subDomain->GetDM(), 1, nullptr, &fEnd) >> checkError;
 
     // Size the return vectors
     DMGetLocalVector(faceSolutionDm, &faceSolutionVec) >> checkError;
@@ -150,11 +173,12 @@ void ablate::finiteVolume::FaceInterpolant::GetInterpolatedFaceVectors(Vec solut
         VecGetArray(faceAuxGradVec, &faceAuxGradArray);
     }
 
-    PetscInt iFacee = 0;
     for (PetscInt face = globalFaceStart; face < fEnd; face++) {
-        auto& stencil = stencils[iFacee];
-        iFacee++;
-        if (!stencil.stencilSize) {
+        const PetscInt row = face - globalFaceStart;
+        const PetscInt rowStart = stencilStart[row];
+        const PetscInt rowEnd = stencilStart[row + 1];
+
+        if (rowStart == rowEnd) {
             PetscScalar* faceSolValues;
             DMPlexPointLocalRead(faceSolutionDm, face, faceSolutionArray, &faceSolValues) >> checkError;
             utilities::MathUtilities::ScaleVector(solTotalSize, faceSolValues, (double)NAN);
@@ -195,43 +219,21 @@ void ablate::finiteVolume::FaceInterpolant::GetInterpolatedFaceVectors(Vec solut
             PetscArrayzero(faceAuxGradValues, auxTotalSize * dim) >> checkError;
         }
 
-        // Using this value compute the gradient on the faces
-        for (PetscInt c = 0; c < stencil.stencilSize; c++) {
-            PetscInt cell = stencil.stencil[c];
+        // Using this value compute the value and gradient on the faces for all components at once
+        for (PetscInt c = rowStart; c < rowEnd; c++) {
+            const PetscInt cell = stencilPoints[c];
+            const PetscScalar weight = stencilWeights[c];
+            const PetscScalar* gradientWeights = stencilGradientWeights.data() + c * dim;
 
-            // compute the value on the face
-            // get cell value and add to the array
-            PetscScalar* solutionValue;
+            // get cell value and add to the arrays
+            const PetscScalar* solutionValue;
             DMPlexPointLocalRead(solutionDm, cell, solutionArray, &solutionValue) >> checkError;
-            AddToArray(solTotalSize, solutionValue, faceSolValues, stencil.weights[c]);
+            AddToArrayWithGradient(solTotalSize, (PetscInt)dim, solutionValue, weight, gradientWeights, faceSolValues, faceSolGradValues);
 
             if (auxTotalSize) {
-                // get cell value and add to the array
-                PetscScalar* auxValue;
+                const PetscScalar* auxValue;
                 DMPlexPointLocalRead(auxDm, cell, auxArray, &auxValue) >> checkError;
-                AddToArray(auxTotalSize, auxValue, faceAuxValues, stencil.weights[c]);
-            }
-
-            // for each component compute the gradient
-            PetscInt offset = 0;
-            for (PetscInt cc = 0; cc < solTotalSize; cc++) {
-                for (PetscInt d = 0; d < dim; ++d) {
-                    faceSolGradValues[offset++] += stencil.gradientWeights[c * dim + d] * solutionValue[cc];
-                }
-            }
-
-            if (auxTotalSize) {
-                // get cell value and add to the array
-                PetscScalar* auxValue;
-                DMPlexPointLocalRead(auxDm, cell, auxArray, &auxValue) >> checkError;
-
-                // for each component
-                offset = 0;
-                for (PetscInt cc = 0; cc < auxTotalSize; cc++) {
-                    for (PetscInt d = 0; d < dim; ++d) {
-                        faceAuxGradValues[offset++] += stencil.gradientWeights[c * dim + d] * auxValue[cc];
-                    }
-                }
+                AddToArrayWithGradient(auxTotalSize, (PetscInt)dim, auxValue, weight, gradientWeights, faceAuxValues, faceAuxGradValues);
             }
         }
     }
@@ -259,67 +261,29 @@ void ablate::finiteVolume::FaceInterpolant::RestoreInterpolatedFaceVectors(Vec,
         DMRestoreLocalVector(faceAuxGradDm, &faceAuxGradVec) >> checkError;
     }
 }
-void ablate::finiteVolume::FaceInterpolant::ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
-                                                       std::vector<FaceInterpolant::ContinuousFluxFunctionDescription>& rhsFunctions, const solver::Range& faceRange, Vec cellGeomVec,
-                                                       Vec faceGeomVec) {
-    // get the dm
-    auto dm = subDomain->GetDM();
-
+ablate::finiteVolume::FaceInterpolant::ContinuousFluxEvaluator::ContinuousFluxEvaluator(ablate::finiteVolume::FaceInterpolant& interpolant, Vec locXVec, Vec locAuxVec,
+                                                                                         const std::vector<ContinuousFluxFunctionDescription>& rhsFunctions)
+    : interpolant(interpolant), locXVec(locXVec), locAuxVec(locAuxVec), rhsFunctions(rhsFunctions) {
     // interpolate to the faces
-    Vec faceSolutionVec, faceAuxVec, faceSolutionGradVec, faceAuxGradVec;
-    GetInterpolatedFaceVectors(locXVec, locAuxVec, faceSolutionVec, faceAuxVec, faceSolutionGradVec, faceAuxGradVec);
-
-    // check for ghost cells
-    DMLabel ghostLabel;
-    DMGetLabel(subDomain->GetDM(), "ghost", &ghostLabel) >> checkError;
+    interpolant.GetInterpolatedFaceVectors(locXVec, locAuxVec, faceSolutionVec, faceAuxVec, faceSolutionGradVec, faceAuxGradVec);
 
     // extract the arrays for each of the vec
-    const PetscScalar* faceSolutionArray;
-    const PetscScalar* faceAuxArray;
-    VecGetArrayRead(faceSolutionVec, &faceSolutionArray);
-    if (auxTotalSize) {
-        VecGetArrayRead(faceAuxVec, &faceAuxArray);
+    VecGetArrayRead(faceSolutionVec, &faceSolutionArray) >> checkError;
+    VecGetArrayRead(faceSolutionGradVec, &faceSolutionGradArray) >> checkError;
+    if (interpolant.auxTotalSize) {
+        VecGetArrayRead(faceAuxVec, &faceAuxArray) >> checkError;
+        VecGetArrayRead(faceAuxGradVec, &faceAuxGradArray) >> checkError;
     }
 
-    const PetscScalar* faceSolutionGradArray;
-    const PetscScalar* faceAuxGradArray;
-    VecGetArrayRead(faceSolutionGradVec, &faceSolutionGradArray);
-    if (auxTotalSize) {
-        VecGetArrayRead(faceAuxGradVec, &faceAuxGradArray);
-    }
-
-    // get raw access to the locF
-    PetscScalar* locFArray;
-    VecGetArray(locFVec, &locFArray) >> checkError;
-
-    // Size up the total dim
-    PetscInt totDim;
-    PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &totDim) >> checkError;
-    std::vector<PetscScalar> flux(totDim);
-    auto dim = subDomain->GetDimensions();
-
-    // Get the geometry for the mesh
-    DM cellDM;
-    VecGetDM(cellGeomVec, &cellDM) >> checkError;
-    const PetscScalar* cellGeomArray;
-    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
-    DM faceDM;
-    VecGetDM(faceGeomVec, &faceDM) >> checkError;
-    const PetscScalar* faceGeomArray;
-    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
-
-    // march only over this region
-    DMLabel regionLabel;
-    PetscInt regionValue;
-    ablate::domain::Region::GetLabel(solverRegion, subDomain->GetDM(), regionLabel, regionValue);
-
     // Precompute the offsets to pass into the rhsFluxFunctionDescriptions
-    std::vector<PetscInt> fluxComponentSize(rhsFunctions.size());
-    std::vector<PetscInt> fluxId(rhsFunctions.size());
-    std::vector<std::vector<PetscInt>> uOff(rhsFunctions.size());
-    std::vector<std::vector<PetscInt>> aOff(rhsFunctions.size());
-    std::vector<std::vector<PetscInt>> uOff_x(rhsFunctions.size());
-    std::vector<std::vector<PetscInt>> aOff_x(rhsFunctions.size());
+    const auto& subDomain = interpolant.subDomain;
+    fluxComponentSize.resize(rhsFunctions.size());
+    fluxId.resize(rhsFunctions.size());
+    fluxBufferOffset.resize(rhsFunctions.size());
+    uOff.resize(rhsFunctions.size());
+    aOff.resize(rhsFunctions.size());
+    uOff_x.resize(rhsFunctions.size());
+    aOff_x.resize(rhsFunctions.size());
 
     // Get the full set of offsets from the ds
     PetscInt* uOffTotal;
@@ -331,13 +295,15 @@ void ablate::finiteVolume::FaceInterpolant::ComputeRHS(PetscReal time, Vec locXV
         const auto& field = subDomain->GetField(rhsFunctions[fun].field);
         fluxComponentSize[fun] = field.numberComponents;
         fluxId[fun] = field.id;
+        fluxBufferOffset[fun] = fluxBufferSize;
+        fluxBufferSize += field.numberComponents;
         for (std::size_t f = 0; f < rhsFunctions[fun].inputFields.size(); f++) {
             uOff[fun].push_back(uOffTotal[rhsFunctions[fun].inputFields[f]]);
             uOff_x[fun].push_back(uGradOffTotal[rhsFunctions[fun].inputFields[f]]);
         }
     }
 
-    if (auxTotalSize) {
+    if (interpolant.auxTotalSize) {
         PetscInt* auxOffTotal;
         PetscInt* auxGradOffTotal;
         PetscDSGetComponentOffsets(subDomain->GetAuxDiscreteSystem(), &auxOffTotal) >> checkError;
@@ -349,31 +315,89 @@ void ablate::finiteVolume::FaceInterpolant::ComputeRHS(PetscReal time, Vec locXV
             }
         }
     }
+}
+
+ablate::finiteVolume::FaceInterpolant::ContinuousFluxEvaluator::~ContinuousFluxEvaluator() {
+    VecRestoreArrayRead(faceSolutionVec, &faceSolutionArray);
+    VecRestoreArrayRead(faceSolutionGradVec, &faceSolutionGradArray);
+    if (interpolant.auxTotalSize) {
+        VecRestoreArrayRead(faceAuxVec, &faceAuxArray);
+        VecRestoreArrayRead(faceAuxGradVec, &faceAuxGradArray);
+    }
+    interpolant.RestoreInterpolatedFaceVectors(locXVec, locAuxVec, faceSolutionVec, faceAuxVec, faceSolutionGradVec, faceAuxGradVec);
+}
 
-    // march over each face
-    for (PetscInt f = faceRange.start; f < faceRange.end; f++) {
-        PetscInt face = faceRange.points ? faceRange.points[f] : f;
+void ablate::finiteVolume::FaceInterpolant::ContinuousFluxEvaluator::Evaluate(PetscInt face, const PetscFVFaceGeom* fg, PetscScalar* flux) const {
+    // extract the arrays
+    const PetscScalar* solutionValue;
+    DMPlexPointLocalRead(interpolant.faceSolutionDm, face, faceSolutionArray, &solutionValue) >> checkError;
+    const PetscScalar* solutionGradValue;
+    DMPlexPointLocalRead(interpolant.faceSolutionGradDm, face, faceSolutionGradArray, &solutionGradValue) >> checkError;
+
+    const PetscScalar* auxValue = nullptr;
+    const PetscScalar* auxGradValue = nullptr;
+    if (interpolant.auxTotalSize) {
+        DMPlexPointLocalRead(interpolant.faceAuxDm, face, faceAuxArray, &auxValue) >> checkError;
+        DMPlexPointLocalRead(interpolant.faceAuxGradDm, face, faceAuxGradArray, &auxGradValue) >> checkError;
+    }
 
-        // make sure that this is a valid face
-        PetscInt ghost, nsupp, nchild;
-        DMLabelGetValue(ghostLabel, face, &ghost) >> checkError;
-        DMPlexGetSupportSize(subDomain->GetDM(), face, &nsupp) >> checkError;
-        DMPlexGetTreeChildren(subDomain->GetDM(), face, &nchild, nullptr) >> checkError;
-        if (ghost >= 0 || nsupp > 2 || nchild > 0) continue;
+    // March over each source function
+    const auto dim = interpolant.subDomain->GetDimensions();
+    PetscArrayzero(flux, fluxBufferSize) >> checkError;
+    for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
+        const auto& rhsFluxFunctionDescription = rhsFunctions[fun];
+        rhsFluxFunctionDescription.function(dim,
+                                            fg,
+                                            uOff[fun].data(),
+                                            uOff_x[fun].data(),
+                                            solutionValue,
+                                            solutionGradValue,
+                                            aOff[fun].data(),
+                                            aOff_x[fun].data(),
+                                            auxValue,
+                                            auxGradValue,
+                                            flux + fluxBufferOffset[fun],
+                                            rhsFluxFunctionDescription.context) >>
+            checkError;
+    }
+}
 
-        // extract the arrays
-        const PetscScalar* solutionValue;
-        DMPlexPointLocalRead(faceSolutionDm, face, faceSolutionArray, &solutionValue) >> checkError;
-        const PetscScalar* solutionGradValue;
-        DMPlexPointLocalRead(faceSolutionGradDm, face, faceSolutionGradArray, &solutionGradValue) >> checkError;
+void ablate::finiteVolume::FaceInterpolant::ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
+                                                       std::vector<FaceInterpolant::ContinuousFluxFunctionDescription>& rhsFunctions, const solver::Range& faceRange, Vec cellGeomVec,
+                                                       Vec faceGeomVec) {
+    // interpolate to the faces and prepare the flux functions
+    ContinuousFluxEvaluator evaluator(*this, locXVec, locAuxVec, rhsFunctions);
+    ComputeFaceFlux(evaluator, locFVec, faceRange, cellGeomVec, faceGeomVec, true);
+}
 
-        const PetscScalar* auxValue = nullptr;
-        const PetscScalar* auxGradValue = nullptr;
-        if (auxTotalSize) {
-            DMPlexPointLocalRead(faceAuxDm, face, faceAuxArray, &auxValue) >> checkError;
-            DMPlexPointLocalRead(faceAuxGradDm, face, faceAuxGradArray, &auxGradValue) >> checkError;
-        }
+void ablate::finiteVolume::FaceInterpolant::ComputeRHS(const ContinuousFluxEvaluator& evaluator, Vec locFVec, const solver::Range& faceRange, Vec cellGeomVec, Vec faceGeomVec) {
+    ComputeFaceFlux(evaluator, locFVec, faceRange, cellGeomVec, faceGeomVec, false);
+}
+
+void ablate::finiteVolume::FaceInterpolant::ComputeFaceFlux(const ContinuousFluxEvaluator& evaluator, Vec locFVec, const solver::Range& faceRange, Vec cellGeomVec, Vec faceGeomVec,
+                                                            bool allowThreaded) {
+    // get the dm
+    auto dm = subDomain->GetDM();
+
+    // get raw access to the locF
+    PetscScalar* locFArray;
+    VecGetArray(locFVec, &locFArray) >> checkError;
+
+    // Size up the flux buffer for all functions
+    std::vector<PetscScalar> flux(evaluator.GetFluxBufferSize());
 
+    // Get the geometry for the mesh
+    DM cellDM;
+    VecGetDM(cellGeomVec, &cellDM) >> checkError;
+    const PetscScalar* cellGeomArray;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+    DM faceDM;
+    VecGetDM(faceGeomVec, &faceDM) >> checkError;
+    const PetscScalar* faceGeomArray;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+
+    // compute and scatter the flux for a single face using the supplied flux scratch
+    auto computeFaceFlux = [&](PetscInt face, PetscScalar* flux) {
         // determine where to add the cell values
         const PetscInt* faceCells;
         PetscFVCellGeom *cgL, *cgR;
@@ -384,61 +408,72 @@ void ablate::finiteVolume::FaceInterpolant::ComputeRHS(PetscReal time, Vec locXV
         PetscFVFaceGeom* fg;
         DMPlexPointLocalRead(faceDM, face, faceGeomArray, &fg);
 
-        // March over each source function
-        for (std::size_t fun = 0; fun < rhsFunctions.size(); fun++) {
-            PetscArrayzero(flux.data(), totDim) >> checkError;
-
-            const auto& rhsFluxFunctionDescription = rhsFunctions[fun];
-            rhsFluxFunctionDescription.function(dim,
-                                                fg,
-                                                uOff[fun].data(),
-                                                uOff_x[fun].data(),
-                                                solutionValue,
-                                                solutionGradValue,
-                                                aOff[fun].data(),
-                                                aOff_x[fun].data(),
-                                                auxValue,
-                                                auxGradValue,
-                                                flux.data(),
-                                                rhsFluxFunctionDescription.context) >>
-                checkError;
-
-            // add the flux back to the cell
+        // evaluate each source function
+        evaluator.Evaluate(face, fg, flux);
+
+        // add the flux back to the cell, ghost cells (the only labeled cells) are not written
+        const bool writeLeft = !ghostMask.Contains(faceCells[0]) && regionMask.Contains(faceCells[0]);
+        const bool writeRight = !ghostMask.Contains(faceCells[1]) && regionMask.Contains(faceCells[1]);
+
+        for (std::size_t fun = 0; fun < evaluator.GetNumberFunctions(); fun++) {
             PetscScalar *fL = nullptr, *fR = nullptr;
-            PetscInt cellLabelValue = regionValue;
-            DMLabelGetValue(ghostLabel, faceCells[0], &ghost) >> checkError;
-            if (regionLabel) {
-                DMLabelGetValue(regionLabel, faceCells[0], &cellLabelValue) >> checkError;
+            if (writeLeft) {
+                DMPlexPointLocalFieldRef(dm, faceCells[0], evaluator.GetFluxField(fun), locFArray, &fL) >> checkError;
             }
-            if (ghost <= 0 && regionValue == cellLabelValue) {
-                DMPlexPointLocalFieldRef(dm, faceCells[0], rhsFunctions[fun].field, locFArray, &fL) >> checkError;
+            if (writeRight) {
+                DMPlexPointLocalFieldRef(dm, faceCells[1], evaluator.GetFluxField(fun), locFArray, &fR) >> checkError;
             }
 
-            cellLabelValue = regionValue;
-            DMLabelGetValue(ghostLabel, faceCells[1], &ghost) >> checkError;
-            if (regionLabel) {
-                DMLabelGetValue(regionLabel, faceCells[1], &cellLabelValue) >> checkError;
+            const PetscScalar* funFlux = flux + evaluator.GetFluxBufferOffset(fun);
+            for (PetscInt d = 0; d < evaluator.GetFluxSize(fun); ++d) {
+                if (fL) fL[d] -= funFlux[d] / cgL->volume;
+                if (fR) fR[d] += funFlux[d] / cgR->volume;
             }
-            if (ghost <= 0 && regionValue == cellLabelValue) {
-                DMPlexPointLocalFieldRef(dm, faceCells[1], rhsFunctions[fun].field, locFArray, &fR) >> checkError;
-            }
-
-            for (PetscInt d = 0; d < fluxComponentSize[fun]; ++d) {
-                if (fL) fL[d] -= flux[d] / cgL->volume;
-                if (fR) fR[d] += flux[d] / cgR->volume;
+        }
+    };
+
+    if (threaded && allowThreaded && evaluator.ThreadSafe()) {
+        // build the list of valid faces and color them the first time through
+        if (!faceColoring) {
+            std::vector<PetscInt> leftCells, rightCells;
+            for (PetscInt f = faceRange.start; f < faceRange.end; f++) {
+                PetscInt face = faceRange.points ? faceRange.points[f] : f;
+
+                // make sure that this is a valid face
+                PetscInt nsupp, nchild;
+                DMPlexGetSupportSize(subDomain->GetDM(), face, &nsupp) >> checkError;
+                DMPlexGetTreeChildren(subDomain->GetDM(), face, &nchild, nullptr) >> checkError;
+                if (ghostMask.Contains(face) || nsupp > 2 || nchild > 0) continue;
+
+                const PetscInt* faceCells;
+                DMPlexGetSupport(subDomain->GetDM(), face, &faceCells) >> checkError;
+                validFaces.push_back(face);
+                leftCells.push_back(faceCells[0]);
+                rightCells.push_back(faceCells[1]);
             }
+            faceColoring = std::make_unique<FaceColoring>(leftCells, rightCells);
         }
-    }
 
-    VecRestoreArrayRead(faceSolutionVec, &faceSolutionArray);
-    VecRestoreArrayRead(faceSolutionGradVec, &faceSolutionGradArray);
+        // faces with the same color do not share a cell, so they can be computed concurrently
+        const auto fluxBufferSize = evaluator.GetFluxBufferSize();
+        std::vector<PetscScalar> scratch(fluxBufferSize * faceColoring->GetNumberChunks());
+        faceColoring->ForEach([&](std::size_t i, std::size_t chunk) { computeFaceFlux(validFaces[i], scratch.data() + chunk * fluxBufferSize); });
+    } else {
+        // march over each face
+        for (PetscInt f = faceRange.start; f < faceRange.end; f++) {
+            PetscInt face = faceRange.points ? faceRange.points[f] : f;
 
-    if (auxTotalSize) {
-        VecRestoreArrayRead(faceAuxVec, &faceAuxArray);
-        VecRestoreArrayRead(faceAuxGradVec, &faceAuxGradArray);
+            // make sure that this is a valid face
+            PetscInt nsupp, nchild;
+            DMPlexGetSupportSize(subDomain->GetDM(), face, &nsupp) >> checkError;
+            DMPlexGetTreeChildren(subDomain->GetDM(), face, &nchild, nullptr) >> checkError;
+            if (ghostMask.Contains(face) || nsupp > 2 || nchild > 0) continue;
+
+            computeFaceFlux(face, flux.data());
+        }
     }
+
     VecRestoreArray(locFVec, &locFArray) >> checkError;
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
     VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
-    RestoreInterpolatedFaceVectors(locXVec, locAuxVec, faceSolutionVec, faceAuxVec, faceSolutionGradVec, faceAuxGradVec);
 }
@@ -1,10 +1,13 @@
 #ifndef ABLATELIBRARY_FACEINTERPOLANT_HPP
 #define ABLATELIBRARY_FACEINTERPOLANT_HPP
 
+#include <algorithm>
 #include <memory>
 #include "domain/subDomain.hpp"
+#include "faceColoring.hpp"
 #include "solver/range.hpp"
 #include "stencils/stencil.hpp"
+#include "utilities/memoryUsage.hpp"
 
 namespace ablate::finiteVolume {
 
@@ -51,9 +54,34 @@ class FaceInterpolant {
     static void CreateFaceDm(PetscInt totalDim, DM dm, DM& newDm);
 
     /**
-     * Store the interpolant for every face
+     * The interpolant for every face packed in compressed row format.  The row for each face (face - faceStart) starts at stencilStart[row]
+     * and ends at stencilStart[row + 1]
      */
-    std::vector<stencil::Stencil> stencils;
+    std::vector<PetscInt> stencilStart;
+
+    //! the cell in each stencil entry
+    std::vector<PetscInt> stencilPoints;
+
+    //! the weight for each stencil entry
+    std::vector<PetscScalar> stencilWeights;
+
+    //! the gradient weights for each stencil entry in [entry*dim + dir] order
+    std::vector<PetscScalar> stencilGradientWeights;
+
+    //! if true, the face flux is computed concurrently using a face coloring
+    const bool threaded;
+
+    //! the valid faces in the face range, only used for threaded assembly
+    std::vector<PetscInt> validFaces;
+
+    //! the optional coloring of the valid faces used for threaded assembly
+    std::unique_ptr<FaceColoring> faceColoring;
+
+    //! the cells in the solver region, precomputed so the flux assembly does not query the region label for every face
+    domain::RegionMask regionMask;
+
+    //! the points with any value in the ghost label (boundary faces and ghost cells)
+    domain::RegionMask ghostMask;
 
     template <class I, class T>
     static inline void AddToArray(I size, const T* input, T* sum, T factor) {
@@ -62,14 +90,38 @@ class FaceInterpolant {
         }
     }
 
+    /**
+     * Adds the contribution of a single cell to the face value and gradient for all components at once
+     * @param size the number of components
+     * @param dim
+     * @param input the cell values
+     * @param weight the stencil weight
+     * @param gradientWeights the dim gradient weights
+     * @param sum the face values
+     * @param gradSum the face gradient in [component*dim + dir] order
+     */
+    template <class I, class T>
+    static inline void AddToArrayWithGradient(I size, I dim, const T* __restrict input, T weight, const T* __restrict gradientWeights, T* __restrict sum, T* __restrict gradSum) {
+        for (I c = 0; c < size; c++) {
+            sum[c] += weight * input[c];
+        }
+        for (I c = 0; c < size; c++) {
+            const T value = input[c];
+            for (I d = 0; d < dim; d++) {
+                gradSum[c * dim + d] += gradientWeights[d] * value;
+            }
+        }
+    }
+
    public:
     /**
      *
      * @param subDomain
      * @param faceGeomVec
      * @param cellGeomVec
+     * @param threaded if true the face fluxes are computed concurrently.  All flux functions must be thread safe.
      */
-    FaceInterpolant(const std::shared_ptr<ablate::domain::SubDomain>& subDomain, const std::shared_ptr<domain::Region> solverRegion, Vec faceGeomVec, Vec cellGeomVec);
+    FaceInterpolant(const std::shared_ptr<ablate::domain::SubDomain>& subDomain, const std::shared_ptr<domain::Region> solverRegion, Vec faceGeomVec, Vec cellGeomVec, bool threaded = false);
     ~FaceInterpolant();
 
     /**
@@ -88,6 +140,69 @@ class FaceInterpolant {
         PetscInt field;
         std::vector<PetscInt> inputFields;
         std::vector<PetscInt> auxFields;
+
+        //! true if the function and context can be called concurrently, otherwise the faces are computed serially even when threaded
+        bool threadSafe = false;
+    };
+
+    /**
+     * Helper class used to interpolate the solution/aux to the faces and evaluate the continuous flux functions one face at a time.  This allows the
+     * continuous flux to be computed inside of another face loop (e.g. fused with the CellInterpolant).  The interpolated face vectors are held
+     * for the lifetime of the evaluator.
+     */
+    class ContinuousFluxEvaluator {
+       private:
+        FaceInterpolant& interpolant;
+        Vec locXVec;
+        Vec locAuxVec;
+        const std::vector<ContinuousFluxFunctionDescription>& rhsFunctions;
+
+        // the interpolated face values
+        Vec faceSolutionVec = nullptr, faceAuxVec = nullptr, faceSolutionGradVec = nullptr, faceAuxGradVec = nullptr;
+        const PetscScalar* faceSolutionArray = nullptr;
+        const PetscScalar* faceAuxArray = nullptr;
+        const PetscScalar* faceSolutionGradArray = nullptr;
+        const PetscScalar* faceAuxGradArray = nullptr;
+
+        // Precomputed offsets for each function
+        std::vector<PetscInt> fluxComponentSize;
+        std::vector<PetscInt> fluxId;
+        std::vector<PetscInt> fluxBufferOffset;
+        PetscInt fluxBufferSize = 0;
+        std::vector<std::vector<PetscInt>> uOff;
+        std::vector<std::vector<PetscInt>> aOff;
+        std::vector<std::vector<PetscInt>> uOff_x;
+        std::vector<std::vector<PetscInt>> aOff_x;
+
+       public:
+        ContinuousFluxEvaluator(FaceInterpolant& interpolant, Vec locXVec, Vec locAuxVec, const std::vector<ContinuousFluxFunctionDescription>& rhsFunctions);
+        ~ContinuousFluxEvaluator();
+
+        ContinuousFluxEvaluator(const ContinuousFluxEvaluator&) = delete;
+        ContinuousFluxEvaluator& operator=(const ContinuousFluxEvaluator&) = delete;
+
+        //! the number of flux functions
+        [[nodiscard]] inline std::size_t GetNumberFunctions() const { return rhsFunctions.size(); }
+        //! true if every flux function can be evaluated concurrently
+        [[nodiscard]] inline bool ThreadSafe() const {
+            return std::all_of(rhsFunctions.begin(), rhsFunctions.end(), [](const auto& function) { return function.threadSafe; });
+        }
+        //! the field id computed by each flux function
+        [[nodiscard]] inline PetscInt GetFluxField(std::size_t fun) const { return fluxId[fun]; }
+        //! the number of components computed by each flux function
+        [[nodiscard]] inline PetscInt GetFluxSize(std::size_t fun) const { return fluxComponentSize[fun]; }
+        //! the offset of each flux function in the flux buffer
+        [[nodiscard]] inline PetscInt GetFluxBufferOffset(std::size_t fun) const { return fluxBufferOffset[fun]; }
+        //! the total size of the flux buffer required by Evaluate
+        [[nodiscard]] inline PetscInt GetFluxBufferSize() const { return fluxBufferSize; }
+
+        /**
+         * Evaluates every flux function for the face, each function writes into its own section of the flux buffer
+         * @param face
+         * @param fg
+         * @param flux buffer of size GetFluxBufferSize()
+         */
+        void Evaluate(PetscInt face, const PetscFVFaceGeom* fg, PetscScalar* flux) const;
     };
 
     /**
@@ -99,6 +214,24 @@ class FaceInterpolant {
     void ComputeRHS(PetscReal time, Vec locXVec, Vec locAuxVec, Vec locFVec, const std::shared_ptr<domain::Region>& solverRegion,
                     std::vector<FaceInterpolant::ContinuousFluxFunctionDescription>& rhsFunctions, const solver::Range& faceRange, Vec cellGeomVec, Vec faceGeomVec);
 
+    /**
+     * Adds in contributions for face based rhs functions using an existing evaluator, so a subset of the faces (i.e. a tile) can be computed without
+     * interpolating every face again.  The faces are always computed serially.
+     * @param evaluator
+     * @param locFVec
+     * @param faceRange
+     * @param cellGeomVec
+     * @param faceGeomVec
+     */
+    void ComputeRHS(const ContinuousFluxEvaluator& evaluator, Vec locFVec, const solver::Range& faceRange, Vec cellGeomVec, Vec faceGeomVec);
+
+   private:
+    /**
+     * compute and scatter the flux for each face in the range, concurrently if allowed and the interpolant is threaded
+     */
+    void ComputeFaceFlux(const ContinuousFluxEvaluator& evaluator, Vec locFVec, const solver::Range& faceRange, Vec cellGeomVec, Vec faceGeomVec, bool allowThreaded);
+
+   public:
     /**
      * function to get the interpolated values on the face
      * @param solutionVec
@@ -120,6 +253,13 @@ class FaceInterpolant {
      * @param faceAuxGradVec
      */
     void RestoreInterpolatedFaceVectors(Vec solutionVec, Vec auxVec, Vec& faceSolutionVec, Vec& faceAuxVec, Vec& faceSolutionGradVec, Vec& faceAuxGradVec);
+
+    /**
+     * Add the face dms and interpolation stencils to the memory usage
+     * @param memoryUsage
+     * @param prefix prepended to each entry name
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const;
 };
 
 }  // namespace ablate::finiteVolume
@@ -1,8 +1,10 @@
 #include "finiteVolumeSolver.hpp"
+#include <algorithm>
 #include <utility>
 #include "cellInterpolant.hpp"
 #include "faceInterpolant.hpp"
 #include "processes/process.hpp"
+#include "utilities/kokkosUtilities.hpp"
 #include "utilities/mpiError.hpp"
 #include "utilities/petscError.hpp"
 
@@ -26,6 +28,25 @@ void ablate::finiteVolume::FiniteVolumeSolver::Setup() {
     // Set the flux calculator solver for each component
     PetscDSSetFromOptions(subDomain->GetDiscreteSystem()) >> checkError;
 
+    // check to see if the rhs loops should be computed concurrently
+    PetscBool threadedRHSOption = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-threadedRHS", &threadedRHSOption, nullptr) >> checkError;
+    // the threaded loops call petsc (and the petsc stack) from the helper threads
+    threadedRHS = threadedRHSOption == PETSC_TRUE && utilities::KokkosUtilities::PetscThreadSafe();
+    PetscBool fusedFaceFluxOption = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-fusedFaceFlux", &fusedFaceFluxOption, nullptr) >> checkError;
+    fusedFaceFlux = fusedFaceFluxOption == PETSC_TRUE;
+    PetscOptionsGetInt(petscOptions, nullptr, "-cellTileSize", &cellTileSize, nullptr) >> checkError;
+    PetscBool overlapHaloExchangeOption = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-overlapHaloExchange", &overlapHaloExchangeOption, nullptr) >> checkError;
+    overlapHaloExchange = overlapHaloExchangeOption == PETSC_TRUE;
+    PetscBool wenoGradientsOption = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-wenoGradients", &wenoGradientsOption, nullptr) >> checkError;
+    wenoGradients = wenoGradientsOption == PETSC_TRUE;
+    PetscBool localTimeSteppingOption = PETSC_FALSE;
+    PetscOptionsGetBool(petscOptions, nullptr, "-localTimeStepping", &localTimeSteppingOption, nullptr) >> checkError;
+    localTimeStepping = localTimeSteppingOption == PETSC_TRUE;
+
     // Some petsc code assumes that a ghostLabel has created, so create one
     PetscBool ghostLabel;
     DMHasLabel(subDomain->GetDM(), "ghost", &ghostLabel) >> checkError;
@@ -34,6 +55,22 @@ void ablate::finiteVolume::FiniteVolumeSolver::Setup() {
     }
 }
 
+void ablate::finiteVolume::FiniteVolumeSolver::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) {
+    CellSolver::AccumulateMemoryUsage(memoryUsage);
+
+    const auto prefix = GetSolverId() + "::";
+    if (cellInterpolant) {
+        cellInterpolant->AccumulateMemoryUsage(memoryUsage, prefix);
+    }
+    if (faceInterpolant) {
+        faceInterpolant->AccumulateMemoryUsage(memoryUsage, prefix);
+    }
+    memoryUsage.Add(prefix + "localTimeStepScale", localTimeStepScale);
+    for (const auto& process : processes) {
+        process->AccumulateMemoryUsage(memoryUsage, prefix);
+    }
+}
+
 void ablate::finiteVolume::FiniteVolumeSolver::Initialize() {
     // add each boundary condition
     for (const auto& boundary : boundaryConditions) {
@@ -43,6 +80,22 @@ void ablate::finiteVolume::FiniteVolumeSolver::Initialize() {
         boundary->SetupBoundary(subDomain->GetDM(), subDomain->GetDiscreteSystem(), fieldId.id);
     }
 
+    // precompute the boundary faces when every boundary is a ghost boundary so they can be applied without the label and DMPlex lookups
+    ghostBoundaryConditions.clear();
+    PetscInt numberBoundaries;
+    PetscDSGetNumBoundary(subDomain->GetDiscreteSystem(), &numberBoundaries) >> checkError;
+    if (numberBoundaries == (PetscInt)boundaryConditions.size()) {
+        for (const auto& boundary : boundaryConditions) {
+            if (auto ghostBoundary = std::dynamic_pointer_cast<boundaryConditions::Ghost>(boundary)) {
+                ghostBoundary->BuildBoundaryFaces(subDomain->GetDM(), subDomain->GetField(boundary->GetFieldName()).id, faceGeomVec);
+                ghostBoundaryConditions.push_back(ghostBoundary);
+            } else {
+                ghostBoundaryConditions.clear();
+                break;
+            }
+        }
+    }
+
     // copy over any boundary information from the dm, to the aux dm and set the sideset
     if (subDomain->GetAuxDM()) {
         PetscDS flowProblem = subDomain->GetDiscreteSystem();
@@ -76,6 +129,12 @@ void ablate::finiteVolume::FiniteVolumeSolver::Initialize() {
     if (!timeStepFunctions.empty() && computePhysicsTimeStep) {
         RegisterPreStep(EnforceTimeStep);
     }
+    if (localTimeStepping) {
+        if (std::none_of(timeStepFunctions.begin(), timeStepFunctions.end(), [](const auto& description) { return description.localFunction != nullptr; })) {
+            throw std::invalid_argument("The FiniteVolumeSolver " + GetSolverId() + " requires at least one process with a local time step function for -localTimeStepping");
+        }
+        RegisterPreStep(UpdateLocalTimeStep);
+    }
 
     {  // get the cell is for the solver minus ghost cell
         // Get the original range
@@ -127,46 +186,98 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
     solver::Range faceRange, cellRange;
     GetFaceRange(faceRange);
     GetCellRange(cellRange);
+
+    // the continuous flux can be computed in the same face pass as the discontinuous flux
+    const bool fuseFaceFlux = fusedFaceFlux && !discontinuousFluxFunctionDescriptions.empty() && !continuousFluxFunctionDescriptions.empty();
+
+    // only compute the halo faces if the interior faces were computed while the ghost exchange was in flight
+    const auto facePhase = interiorFluxComputed ? CellInterpolant::FacePhase::halo : CellInterpolant::FacePhase::all;
+    interiorFluxComputed = false;
+
     try {
         StartEvent("FiniteVolumeSolver::ComputeRHSFunction::discontinuousFluxFunction");
         if (!discontinuousFluxFunctionDescriptions.empty()) {
             if (cellInterpolant == nullptr) {
-                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
+                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, discontinuousFluxFunctionDescriptions, threadedRHS, wenoGradients);
             }
 
-            cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), discontinuousFluxFunctionDescriptions, faceRange, cellRange, cellGeomVec, faceGeomVec);
+            if (fuseFaceFlux) {
+                if (faceInterpolant == nullptr) {
+                    faceInterpolant = std::make_unique<FaceInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, threadedRHS);
+                }
+                FaceInterpolant::ContinuousFluxEvaluator continuousFluxEvaluator(*faceInterpolant, locXVec, subDomain->GetAuxVector(), continuousFluxFunctionDescriptions);
+                cellInterpolant->ComputeRHS(
+                    time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), discontinuousFluxFunctionDescriptions, faceRange, cellRange, cellGeomVec, faceGeomVec, &continuousFluxEvaluator);
+            } else {
+                cellInterpolant->ComputeRHS(
+                    time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), discontinuousFluxFunctionDescriptions, faceRange, cellRange, cellGeomVec, faceGeomVec, nullptr, facePhase);
+            }
         }
         EndEvent();
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in CellInterpolant discontinuousFluxFunction: %s", exception.what());
     }
 
-    try {
-        StartEvent("FiniteVolumeSolver::ComputeRHSFunction::pointFunction");
-        if (!pointFunctionDescriptions.empty()) {
+    // the point functions and continuous flux only read the cell (and face interpolated) values, so they can be run tile by tile while the cells are in cache
+    const bool continuousFluxPass = !continuousFluxFunctionDescriptions.empty() && !fuseFaceFlux;
+    if (cellTileSize > 0 && !threadedRHS && (!pointFunctionDescriptions.empty() || continuousFluxPass)) {
+        try {
+            StartEvent("FiniteVolumeSolver::ComputeRHSFunction::tiledCellStages");
             if (cellInterpolant == nullptr) {
-                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
+                cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, discontinuousFluxFunctionDescriptions, threadedRHS, wenoGradients);
+            }
+            if (continuousFluxPass && faceInterpolant == nullptr) {
+                faceInterpolant = std::make_unique<FaceInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, threadedRHS);
+            }
+            if (cellTiles == nullptr) {
+                cellTiles = std::make_unique<solver::TiledRange>(subDomain->GetDM(), cellRange, faceRange, cellTileSize);
             }
 
-            cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), pointFunctionDescriptions, cellRange, cellGeomVec);
+            // the faces are interpolated once for every tile
+            std::unique_ptr<FaceInterpolant::ContinuousFluxEvaluator> continuousFluxEvaluator;
+            if (continuousFluxPass) {
+                continuousFluxEvaluator = std::make_unique<FaceInterpolant::ContinuousFluxEvaluator>(*faceInterpolant, locXVec, subDomain->GetAuxVector(), continuousFluxFunctionDescriptions);
+            }
+            for (std::size_t tile = 0; tile < cellTiles->GetNumberTiles(); ++tile) {
+                if (!pointFunctionDescriptions.empty()) {
+                    cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), pointFunctionDescriptions, cellTiles->GetCellRange(tile), cellGeomVec);
+                }
+                if (continuousFluxEvaluator) {
+                    faceInterpolant->ComputeRHS(*continuousFluxEvaluator, locFVec, cellTiles->GetFaceRange(tile), cellGeomVec, faceGeomVec);
+                }
+            }
+            EndEvent();
+        } catch (std::exception& exception) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in tiled pointFunctionDescriptions/continuousFluxFunctionDescriptions: %s", exception.what());
         }
-        EndEvent();
-    } catch (std::exception& exception) {
-        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in CellInterpolant pointFunctionDescriptions: %s", exception.what());
-    }
+    } else {
+        try {
+            StartEvent("FiniteVolumeSolver::ComputeRHSFunction::pointFunction");
+            if (!pointFunctionDescriptions.empty()) {
+                if (cellInterpolant == nullptr) {
+                    cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, discontinuousFluxFunctionDescriptions, threadedRHS, wenoGradients);
+                }
 
-    try {
-        StartEvent("FiniteVolumeSolver::ComputeRHSFunction::continuousFluxFunctionDescriptions");
-        if (!continuousFluxFunctionDescriptions.empty()) {
-            if (faceInterpolant == nullptr) {
-                faceInterpolant = std::make_unique<FaceInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec);
+                cellInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), pointFunctionDescriptions, cellRange, cellGeomVec);
             }
+            EndEvent();
+        } catch (std::exception& exception) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in CellInterpolant pointFunctionDescriptions: %s", exception.what());
+        }
 
-            faceInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), continuousFluxFunctionDescriptions, faceRange, cellGeomVec, faceGeomVec);
+        try {
+            StartEvent("FiniteVolumeSolver::ComputeRHSFunction::continuousFluxFunctionDescriptions");
+            if (continuousFluxPass) {
+                if (faceInterpolant == nullptr) {
+                    faceInterpolant = std::make_unique<FaceInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, threadedRHS);
+                }
+
+                faceInterpolant->ComputeRHS(time, locXVec, subDomain->GetAuxVector(), locFVec, GetRegion(), continuousFluxFunctionDescriptions, faceRange, cellGeomVec, faceGeomVec);
+            }
+            EndEvent();
+        } catch (std::exception& exception) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in FaceInterpolant continuousFluxFunctionDescriptions: %s", exception.what());
         }
-        EndEvent();
-    } catch (std::exception& exception) {
-        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in FaceInterpolant continuousFluxFunctionDescriptions: %s", exception.what());
     }
 
     RestoreRange(faceRange);
@@ -182,13 +293,53 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeRHSFunction(Pets
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeInteriorRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) {
+    PetscFunctionBeginUser;
+    // the continuous flux and aux fields require values that are not available until after the ghost exchange, and the pre rhs functions may modify locX after it
+    if (!overlapHaloExchange || discontinuousFluxFunctionDescriptions.empty() || !continuousFluxFunctionDescriptions.empty() || !preRhsFunctions.empty() ||
+        std::any_of(discontinuousFluxFunctionDescriptions.begin(), discontinuousFluxFunctionDescriptions.end(), [](const auto& description) { return !description.auxFields.empty(); })) {
+        PetscFunctionReturn(0);
+    }
+
+    solver::Range faceRange, cellRange;
+    GetFaceRange(faceRange);
+    GetCellRange(cellRange);
+
+    try {
+        StartEvent("FiniteVolumeSolver::ComputeInteriorRHSFunction::discontinuousFluxFunction");
+        if (cellInterpolant == nullptr) {
+            cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, discontinuousFluxFunctionDescriptions, threadedRHS, wenoGradients);
+        }
+        cellInterpolant->ComputeRHS(time,
+                                    locXVec,
+                                    subDomain->GetAuxVector(),
+                                    locFVec,
+                                    GetRegion(),
+                                    discontinuousFluxFunctionDescriptions,
+                                    faceRange,
+                                    cellRange,
+                                    cellGeomVec,
+                                    faceGeomVec,
+                                    nullptr,
+                                    CellInterpolant::FacePhase::interior);
+        interiorFluxComputed = true;
+        EndEvent();
+    } catch (std::exception& exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in CellInterpolant interior discontinuousFluxFunction: %s", exception.what());
+    }
+
+    RestoreRange(faceRange);
+    RestoreRange(cellRange);
+    PetscFunctionReturn(0);
+}
+
 void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(CellInterpolant::DiscontinuousFluxFunction function, void* context, const std::string& field,
-                                                                   const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields) {
+                                                                   const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields, bool threadSafe) {
     // map the field, inputFields, and auxFields to locations
     auto& fieldId = subDomain->GetField(field);
 
     // Create the FVMRHS Function
-    CellInterpolant::DiscontinuousFluxFunctionDescription functionDescription{.function = function, .context = context, .field = fieldId.id};
+    CellInterpolant::DiscontinuousFluxFunctionDescription functionDescription{.function = function, .context = context, .field = fieldId.id, .threadSafe = threadSafe};
 
     for (auto& inputField : inputFields) {
         auto& inputFieldId = subDomain->GetField(inputField);
@@ -200,16 +351,19 @@ void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(CellInterpola
         functionDescription.auxFields.push_back(auxFieldId.id);
     }
 
+    if (registerImplicit) {
+        throw std::invalid_argument("Discontinuous flux functions cannot be integrated implicitly in " + GetSolverId());
+    }
     discontinuousFluxFunctionDescriptions.push_back(functionDescription);
 }
 
 void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(ablate::finiteVolume::FaceInterpolant::ContinuousFluxFunction function, void* context, const std::string& field,
-                                                                   const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields) {
+                                                                   const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields, bool threadSafe) {
     // map the field, inputFields, and auxFields to locations
     auto& fieldId = subDomain->GetField(field);
 
     // Create the FVMRHS Function
-    FaceInterpolant::ContinuousFluxFunctionDescription functionDescription{.function = function, .context = context, .field = fieldId.id};
+    FaceInterpolant::ContinuousFluxFunctionDescription functionDescription{.function = function, .context = context, .field = fieldId.id, .threadSafe = threadSafe};
 
     for (auto& inputField : inputFields) {
         auto& inputFieldId = subDomain->GetField(inputField);
@@ -221,13 +375,13 @@ void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(ablate::finit
         functionDescription.auxFields.push_back(auxFieldId.id);
     }
 
-    continuousFluxFunctionDescriptions.push_back(functionDescription);
+    (registerImplicit ? implicitContinuousFluxFunctionDescriptions : continuousFluxFunctionDescriptions).push_back(functionDescription);
 }
 
 void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(CellInterpolant::PointFunction function, void* context, const std::vector<std::string>& fields,
-                                                                   const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields) {
+                                                                   const std::vector<std::string>& inputFields, const std::vector<std::string>& auxFields, bool threadSafe) {
     // Create the FVMRHS Function
-    CellInterpolant::PointFunctionDescription functionDescription{.function = function, .context = context};
+    CellInterpolant::PointFunctionDescription functionDescription{.function = function, .context = context, .threadSafe = threadSafe};
 
     for (const auto& field : fields) {
         auto& fieldId = subDomain->GetField(field);
@@ -244,13 +398,38 @@ void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(CellInterpola
         functionDescription.auxFields.push_back(fieldId.id);
     }
 
-    pointFunctionDescriptions.push_back(functionDescription);
+    (registerImplicit ? implicitPointFunctionDescriptions : pointFunctionDescriptions).push_back(functionDescription);
+}
+
+void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(RHSArbitraryFunction function, void* context) {
+    (registerImplicit ? implicitRhsArbitraryFunctions : rhsArbitraryFunctions).emplace_back(function, context);
 }
 
-void ablate::finiteVolume::FiniteVolumeSolver::RegisterRHSFunction(RHSArbitraryFunction function, void* context) { rhsArbitraryFunctions.emplace_back(function, context); }
+void ablate::finiteVolume::FiniteVolumeSolver::SetupImplicit(const std::function<void()>& setup) {
+    registerImplicit = true;
+    try {
+        setup();
+    } catch (...) {
+        registerImplicit = false;
+        throw;
+    }
+    registerImplicit = false;
+}
 
 void ablate::finiteVolume::FiniteVolumeSolver::RegisterPreRHSFunction(PreRHSFunctionDefinition function, void* context) { preRhsFunctions.emplace_back(function, context); }
 
+ablate::solver::GlobalDiagnostics& ablate::finiteVolume::FiniteVolumeSolver::GetGlobalDiagnostics() {
+    if (!globalDiagnostics) {
+        globalDiagnostics = std::make_unique<solver::GlobalDiagnostics>();
+        RegisterPreStep([this](TS ts, Solver& solver) { globalDiagnostics->Compute(ts, solver); });
+    }
+    return *globalDiagnostics;
+}
+
+void ablate::finiteVolume::FiniteVolumeSolver::RegisterIFunction(IFunctionDefinition function, IJacobianDefinition jacobian, void* context) {
+    iFunctions.emplace_back(function, jacobian, context);
+}
+
 void ablate::finiteVolume::FiniteVolumeSolver::EnforceTimeStep(TS ts, ablate::solver::Solver& solver) {
     auto& flowFV = dynamic_cast<ablate::finiteVolume::FiniteVolumeSolver&>(solver);
     // Get the dm and current solution vector
@@ -283,8 +462,98 @@ void ablate::finiteVolume::FiniteVolumeSolver::EnforceTimeStep(TS ts, ablate::so
     }
 }
 
-void ablate::finiteVolume::FiniteVolumeSolver::RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx, std::string name) {
-    timeStepFunctions.emplace_back(ComputeTimeStepDescription{.function = function, .context = ctx, .name = std::move(name)});
+void ablate::finiteVolume::FiniteVolumeSolver::UpdateLocalTimeStep(TS ts, ablate::solver::Solver& solver) {
+    auto& flowFV = dynamic_cast<ablate::finiteVolume::FiniteVolumeSolver&>(solver);
+    auto dm = flowFV.subDomain->GetDM();
+    Vec v;
+    TSGetSolution(ts, &v) >> checkError;
+
+    // Get the offsets and geometry needed for the local functions
+    PetscInt dim = flowFV.subDomain->GetDimensions();
+    PetscInt* uOff;
+    PetscDSGetComponentOffsets(flowFV.subDomain->GetDiscreteSystem(), &uOff) >> checkError;
+    DM cellDM;
+    const PetscScalar* cellGeomArray;
+    VecGetDM(flowFV.cellGeomVec, &cellDM) >> checkError;
+    VecGetArrayRead(flowFV.cellGeomVec, &cellGeomArray) >> checkError;
+    const PetscScalar* x;
+    VecGetArrayRead(v, &x) >> checkError;
+
+    // compute the local time step of each owned cell (non owned cells are marked with a zero)
+    solver::Range cellRange;
+    flowFV.GetCellRange(cellRange);
+    flowFV.localTimeStepScale.assign(cellRange.end - cellRange.start, 0.0);
+    PetscReal dtMin = PETSC_MAX_REAL;
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+
+        const PetscScalar* u;
+        DMPlexPointGlobalRead(dm, cell, x, &u) >> checkError;
+        if (!u) {
+            continue;
+        }
+        const PetscFVCellGeom* cg;
+        DMPlexPointLocalRead(cellDM, cell, cellGeomArray, &cg) >> checkError;
+
+        PetscReal dt = PETSC_MAX_REAL;
+        for (const auto& dtFunction : flowFV.timeStepFunctions) {
+            if (dtFunction.localFunction) {
+                dt = PetscMin(dt, dtFunction.localFunction(dim, cg, uOff, u, dtFunction.context));
+            }
+        }
+        flowFV.localTimeStepScale[c - cellRange.start] = dt;
+        dtMin = PetscMin(dtMin, dt);
+    }
+    VecRestoreArrayRead(v, &x) >> checkError;
+    VecRestoreArrayRead(flowFV.cellGeomVec, &cellGeomArray) >> checkError;
+    flowFV.RestoreRange(cellRange);
+
+    // each cell is scaled relative to the smallest time step, which is the largest stable global step
+    PetscReal dtMinGlobal;
+    MPI_Allreduce(&dtMin, &dtMinGlobal, 1, MPIU_REAL, MPI_MIN, PetscObjectComm((PetscObject)ts)) >> checkMpiError;
+    if (PetscIsNanReal(dtMinGlobal) || dtMinGlobal <= 0.0) {
+        throw std::runtime_error("Invalid local time step selected for flow");
+    }
+    for (auto& scale : flowFV.localTimeStepScale) {
+        scale /= dtMinGlobal;
+    }
+}
+
+PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::PostRHSFunction(PetscReal, Vec F) {
+    PetscFunctionBeginUser;
+    if (!localTimeStepping || localTimeStepScale.empty()) {
+        PetscFunctionReturn(0);
+    }
+    StartEvent("FiniteVolumeSolver::PostRHSFunction::localTimeStepping");
+
+    // scale all of the rhs in each owned cell so the steady state is unchanged
+    auto dm = subDomain->GetDM();
+    PetscInt totDim;
+    PetscCall(PetscDSGetTotalDimension(subDomain->GetDiscreteSystem(), &totDim));
+    PetscScalar* fArray;
+    PetscCall(VecGetArray(F, &fArray));
+    solver::Range cellRange;
+    GetCellRange(cellRange);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+        const PetscReal scale = localTimeStepScale[c - cellRange.start];
+        PetscScalar* f;
+        PetscCall(DMPlexPointGlobalRef(dm, cell, fArray, &f));
+        if (!f || scale <= 0.0) {
+            continue;
+        }
+        for (PetscInt d = 0; d < totDim; ++d) {
+            f[d] *= scale;
+        }
+    }
+    RestoreRange(cellRange);
+    PetscCall(VecRestoreArray(F, &fArray));
+    EndEvent();
+    PetscFunctionReturn(0);
+}
+
+void ablate::finiteVolume::FiniteVolumeSolver::RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx, std::string name, ComputeLocalTimeStepFunction localFunction) {
+    timeStepFunctions.emplace_back(ComputeTimeStepDescription{.function = function, .context = ctx, .name = std::move(name), .localFunction = localFunction});
 }
 
 std::map<std::string, double> ablate::finiteVolume::FiniteVolumeSolver::ComputePhysicsTimeSteps(TS ts) {
@@ -292,11 +561,19 @@ std::map<std::string, double> ablate::finiteVolume::FiniteVolumeSolver::ComputeP
     std::map<std::string, double> timeSteps;
 
     // march over each calculator
+    std::vector<PetscReal> dts;
+    dts.reserve(timeStepFunctions.size());
     for (const auto& dtFunction : timeStepFunctions) {
-        double dt = dtFunction.function(ts, *this, dtFunction.context);
-        PetscReal dtMinGlobal;
-        MPI_Reduce(&dt, &dtMinGlobal, 1, MPIU_REAL, MPI_MIN, 0, PetscObjectComm((PetscObject)ts)) >> checkMpiError;
-        timeSteps[dtFunction.name] = dtMinGlobal;
+        dts.push_back(dtFunction.function(ts, *this, dtFunction.context));
+    }
+
+    // reduce every calculator at once
+    std::vector<PetscReal> dtMinGlobal(dts.size());
+    if (!dts.empty()) {
+        MPI_Reduce(dts.data(), dtMinGlobal.data(), (PetscMPIInt)dts.size(), MPIU_REAL, MPI_MIN, 0, PetscObjectComm((PetscObject)ts)) >> checkMpiError;
+    }
+    for (std::size_t f = 0; f < timeStepFunctions.size(); ++f) {
+        timeSteps[timeStepFunctions[f].name] = dtMinGlobal[f];
     }
 
     return timeSteps;
@@ -353,7 +630,87 @@ PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeBoundary(PetscRe
     auto dm = subDomain->GetDM();
     auto ds = subDomain->GetDiscreteSystem();
     /* Handle non-essential (e.g. outflow) boundary values.  This should be done before the auxFields are updated so that boundary values can be updated */
-    PetscCall(ablate::solver::Solver::DMPlexInsertBoundaryValues_Plex(dm, ds, PETSC_FALSE, locX, time, faceGeomVec, cellGeomVec, nullptr));
+    if (!ghostBoundaryConditions.empty()) {
+        PetscScalar* xArray;
+        PetscCall(VecGetArray(locX, &xArray));
+        for (const auto& ghostBoundary : ghostBoundaryConditions) {
+            PetscCall(ghostBoundary->ApplyBoundary(time, xArray));
+        }
+        PetscCall(VecRestoreArray(locX, &xArray));
+    } else {
+        PetscCall(ablate::solver::Solver::DMPlexInsertBoundaryValues_Plex(dm, ds, PETSC_FALSE, locX, time, faceGeomVec, cellGeomVec, nullptr));
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeIFunction(PetscReal time, Vec locX, Vec locX_t, Vec locF) {
+    PetscFunctionBeginUser;
+    StartEvent("FiniteVolumeSolver::ComputeIFunction");
+    auto dm = subDomain->GetDM();
+
+    // add X_t for every cell owned by this rank, the local vector is added to the global residual
+    PetscCall(AddTimeDerivative(locX_t, locF));
+
+    // add the implicit function contributions
+    for (const auto& [function, jacobian, context] : iFunctions) {
+        PetscCall(function(*this, dm, time, locX, locF, context));
+    }
+
+    // subtract the rhs of any implicit processes
+    if (!implicitContinuousFluxFunctionDescriptions.empty() || !implicitPointFunctionDescriptions.empty() || !implicitRhsArbitraryFunctions.empty()) {
+        Vec locS;
+        PetscCall(DMGetLocalVector(dm, &locS));
+        PetscCall(VecZeroEntries(locS));
+
+        solver::Range faceRange, cellRange;
+        GetFaceRange(faceRange);
+        GetCellRange(cellRange);
+        try {
+            // the aux fields must be consistent with the implicit stage solution
+            UpdateAuxFields(time, locX, subDomain->GetAuxVector());
+
+            if (!implicitContinuousFluxFunctionDescriptions.empty()) {
+                if (faceInterpolant == nullptr) {
+                    faceInterpolant = std::make_unique<FaceInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, threadedRHS);
+                }
+                faceInterpolant->ComputeRHS(time, locX, subDomain->GetAuxVector(), locS, GetRegion(), implicitContinuousFluxFunctionDescriptions, faceRange, cellGeomVec, faceGeomVec);
+            }
+            if (!implicitPointFunctionDescriptions.empty()) {
+                if (cellInterpolant == nullptr) {
+                    cellInterpolant = std::make_unique<CellInterpolant>(subDomain, GetRegion(), faceGeomVec, cellGeomVec, discontinuousFluxFunctionDescriptions, threadedRHS, wenoGradients);
+                }
+                cellInterpolant->ComputeRHS(time, locX, subDomain->GetAuxVector(), locS, GetRegion(), implicitPointFunctionDescriptions, cellRange, cellGeomVec);
+            }
+        } catch (std::exception& exception) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "Error in implicit process rhs: %s", exception.what());
+        }
+        RestoreRange(faceRange);
+        RestoreRange(cellRange);
+
+        for (const auto& rhsFunction : implicitRhsArbitraryFunctions) {
+            PetscCall(rhsFunction.first(*this, dm, time, locX, locS, rhsFunction.second));
+        }
+
+        PetscCall(VecAXPY(locF, -1.0, locS));
+        PetscCall(DMRestoreLocalVector(dm, &locS));
+    }
+    EndEvent();
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::FiniteVolumeSolver::ComputeIJacobian(PetscReal time, Vec locX, Vec, PetscReal X_tShift, Mat, Mat JacP) {
+    PetscFunctionBeginUser;
+    StartEvent("FiniteVolumeSolver::ComputeIJacobian");
+    auto dm = subDomain->GetDM();
+
+    // add the X_tShift to the diagonal of every cell owned by this rank
+    PetscCall(AddTimeDerivativeShift(X_tShift, JacP));
+
+    // add the implicit jacobian contributions
+    for (const auto& [function, jacobian, context] : iFunctions) {
+        PetscCall(jacobian(*this, dm, time, locX, JacP, context));
+    }
+    EndEvent();
     PetscFunctionReturn(0);
 }
 
@@ -1,15 +1,20 @@
 #ifndef ABLATELIBRARY_FINITEVOLUMESOLVER_HPP
 #define ABLATELIBRARY_FINITEVOLUMESOLVER_HPP
 
+#include <functional>
 #include <string>
+#include <tuple>
 #include <vector>
 #include "boundaryConditions/boundaryCondition.hpp"
+#include "boundaryConditions/ghost.hpp"
 #include "cellInterpolant.hpp"
 #include "eos/eos.hpp"
 #include "faceInterpolant.hpp"
 #include "mathFunctions/fieldFunction.hpp"
 #include "solver/cellSolver.hpp"
+#include "solver/globalDiagnostics.hpp"
 #include "solver/solver.hpp"
+#include "solver/tiledRange.hpp"
 #include "solver/timeStepper.hpp"
 #include "utilities/vectorUtilities.hpp"
 
@@ -20,11 +25,19 @@ namespace processes {
 class Process;
 }
 
-class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction, public io::Serializable, public solver::BoundaryFunction, private utilities::Loggable<FiniteVolumeSolver> {
+class FiniteVolumeSolver : public solver::CellSolver,
+                           public solver::RHSFunction,
+                           public solver::IFunction,
+                           public io::Serializable,
+                           public solver::BoundaryFunction,
+                           private utilities::Loggable<FiniteVolumeSolver> {
    public:
     using PreRHSFunctionDefinition = PetscErrorCode (*)(const FiniteVolumeSolver&, TS ts, PetscReal time, bool initialStage, Vec locX, void* ctx);
     using RHSArbitraryFunction = PetscErrorCode (*)(const FiniteVolumeSolver&, DM dm, PetscReal time, Vec locXVec, Vec locFVec, void* ctx);
+    using IFunctionDefinition = PetscErrorCode (*)(const FiniteVolumeSolver&, DM dm, PetscReal time, Vec locXVec, Vec locFVec, void* ctx);
+    using IJacobianDefinition = PetscErrorCode (*)(const FiniteVolumeSolver&, DM dm, PetscReal time, Vec locXVec, Mat JacP, void* ctx);
     using ComputeTimeStepFunction = double (*)(TS ts, FiniteVolumeSolver&, void* ctx);
+    using ComputeLocalTimeStepFunction = PetscReal (*)(PetscInt dim, const PetscFVCellGeom* cg, const PetscInt uOff[], const PetscScalar u[], void* ctx);
 
    private:
     /**
@@ -33,7 +46,8 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
     struct ComputeTimeStepDescription {
         ComputeTimeStepFunction function;
         void* context;
-        std::string name; /**used for output**/
+        std::string name;                                    /**used for output**/
+        ComputeLocalTimeStepFunction localFunction = nullptr; /**optional time step for a single cell used for local time stepping**/
     };
 
     // hold the update functions for flux and point sources
@@ -47,6 +61,17 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
     // allow the use of any arbitrary pre rhs functions
     std::vector<std::pair<PreRHSFunctionDefinition, void*>> preRhsFunctions;
 
+    // the implicit functions and their jacobians integrated by the ts, F(t, X, X_t) = X_t - S(X)
+    std::vector<std::tuple<IFunctionDefinition, IJacobianDefinition, void*>> iFunctions;
+
+    // rhs functions from implicit processes that are integrated by the ts as part of the implicit residual without an analytic jacobian
+    std::vector<FaceInterpolant::ContinuousFluxFunctionDescription> implicitContinuousFluxFunctionDescriptions;
+    std::vector<CellInterpolant::PointFunctionDescription> implicitPointFunctionDescriptions;
+    std::vector<std::pair<RHSArbitraryFunction, void*>> implicitRhsArbitraryFunctions;
+
+    //! true while an implicit process is registering its rhs functions
+    bool registerImplicit = false;
+
     // functions to update the timestep
     const bool computePhysicsTimeStep;
     std::vector<ComputeTimeStepDescription> timeStepFunctions;
@@ -57,15 +82,52 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
     // static function to update the flowfield
     static void EnforceTimeStep(TS ts, ablate::solver::Solver& solver);
 
+    // static function to update the local time step scale for each cell
+    static void UpdateLocalTimeStep(TS ts, ablate::solver::Solver& solver);
+
     // store the boundary conditions
     const std::vector<std::shared_ptr<boundaryConditions::BoundaryCondition>> boundaryConditions;
 
+    //! the ghost boundary conditions with precomputed face lists, only used when every boundary in the discrete system is a ghost boundary condition
+    std::vector<std::shared_ptr<boundaryConditions::Ghost>> ghostBoundaryConditions;
+
     //! hold the class responsible for compute face values;
     std::unique_ptr<FaceInterpolant> faceInterpolant = nullptr;
 
     //! hold the class responsible for compute cell based values;
     std::unique_ptr<CellInterpolant> cellInterpolant = nullptr;
 
+    //! the domain values shared by the processes that are computed in a single pass before each step
+    std::unique_ptr<solver::GlobalDiagnostics> globalDiagnostics = nullptr;
+
+    //! compute the face fluxes and point sources concurrently in the kokkos host execution space (set with -threadedRHS in the solver options).  Only loops
+    //! where every function was registered as thread safe are computed concurrently.  It is ignored when petsc cannot be called from the helper threads.
+    bool threadedRHS = false;
+
+    //! evaluate the continuous flux in the same face pass as the discontinuous flux (set with -fusedFaceFlux in the solver options)
+    bool fusedFaceFlux = false;
+
+    //! run the point functions and continuous face flux tile by tile with this many cells per tile, zero disables tiling (set with -cellTileSize in the solver options)
+    PetscInt cellTileSize = 0;
+
+    //! the cell tiles with their adjacent faces, built the first time they are needed
+    std::unique_ptr<solver::TiledRange> cellTiles = nullptr;
+
+    //! compute the interior face flux while the ghost exchange is in flight (set with -overlapHaloExchange in the solver options).  The pre rhs functions must not modify locX.
+    bool overlapHaloExchange = false;
+
+    //! reconstruct the face values with WENO weighted least squares gradients in place of the PetscFV limiter (set with -wenoGradients in the solver options)
+    bool wenoGradients = false;
+
+    //! true if the interior face flux was computed for the current rhs evaluation
+    bool interiorFluxComputed = false;
+
+    //! advance each cell with its own time step for pseudo transient steady state runs (set with -localTimeStepping in the solver options)
+    bool localTimeStepping = false;
+
+    //! the ratio of the local to global time step for each cell in the cell range, updated before each step
+    std::vector<PetscReal> localTimeStepScale;
+
     //!! Store an region of all cells not in the ghost for faster iteration
     std::shared_ptr<domain::Region> solverRegionMinusGhost;
 
@@ -77,6 +139,12 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
     void Setup() override;
     void Initialize() override;
 
+    /**
+     * Add the interpolant caches and the process caches to the memory usage
+     * @param memoryUsage
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) override;
+
     /**
      * Function passed into PETSc to compute the FV RHS
      * @param dm
@@ -88,6 +156,16 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
      */
     PetscErrorCode ComputeRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) override;
 
+    /**
+     * Computes the discontinuous flux across interior faces while the ghost exchange is in flight.  This is only done when -overlapHaloExchange is set and
+     * the flux functions do not depend upon aux fields, which are not updated until the PreRHSFunction.
+     * @param time
+     * @param locXVec
+     * @param locFVec
+     * @return
+     */
+    PetscErrorCode ComputeInteriorRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) override;
+
     /**
      * Updates any traditional ghost node boundary
      * @param time
@@ -97,6 +175,43 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
      */
     PetscErrorCode ComputeBoundary(PetscReal time, Vec locX, Vec locX_t) override;
 
+    /**
+     * Computes the implicit residual F(t, X, X_t) = X_t - S(X) from the registered implicit functions
+     * @param time
+     * @param locX
+     * @param locX_t
+     * @param locF
+     * @return
+     */
+    PetscErrorCode ComputeIFunction(PetscReal time, Vec locX, Vec locX_t, Vec locF) override;
+
+    /**
+     * Computes the jacobian X_tShift*I - dS/dX of the implicit residual from the registered implicit functions
+     * @param time
+     * @param locX
+     * @param locX_t
+     * @param X_tShift
+     * @param Jac
+     * @param JacP
+     * @return
+     */
+    PetscErrorCode ComputeIJacobian(PetscReal time, Vec locX, Vec locX_t, PetscReal X_tShift, Mat Jac, Mat JacP) override;
+
+    /**
+     * The implicit residual is only used when an implicit function or implicit process has been registered
+     * @return
+     */
+    [[nodiscard]] bool HasIFunction() const override {
+        return !iFunctions.empty() || !implicitContinuousFluxFunctionDescriptions.empty() || !implicitPointFunctionDescriptions.empty() || !implicitRhsArbitraryFunctions.empty();
+    }
+
+    /**
+     * Calls the setup function so that any continuous flux, point, or arbitrary rhs functions registered within it are integrated implicitly by the ts.  No
+     * analytic jacobian is provided for these terms, so the ts should be run with -snes_mf_operator (or -snes_fd_color for a colored finite difference jacobian).
+     * @param setup
+     */
+    void SetupImplicit(const std::function<void()>& setup);
+
     /**
      * Register a FVM rhs discontinuous flux function
      * @param function
@@ -104,9 +219,10 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
      * @param field
      * @param inputFields
      * @param auxFields
+     * @param threadSafe true if the function and context can be called concurrently with -threadedRHS, otherwise it is always computed serially
      */
     void RegisterRHSFunction(CellInterpolant::DiscontinuousFluxFunction function, void* context, const std::string& field, const std::vector<std::string>& inputFields,
-                             const std::vector<std::string>& auxFields);
+                             const std::vector<std::string>& auxFields, bool threadSafe = false);
 
     /**
      * Register a FVM rhs continuous flux function
@@ -115,9 +231,10 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
      * @param field
      * @param inputFields
      * @param auxFields
+     * @param threadSafe true if the function and context can be called concurrently with -threadedRHS, otherwise it is always computed serially
      */
     void RegisterRHSFunction(FaceInterpolant::ContinuousFluxFunction function, void* context, const std::string& field, const std::vector<std::string>& inputFields,
-                             const std::vector<std::string>& auxFields);
+                             const std::vector<std::string>& auxFields, bool threadSafe = false);
 
     /**
      * Register a FVM rhs point function
@@ -126,9 +243,10 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
      * @param field
      * @param inputFields
      * @param auxFields
+     * @param threadSafe true if the function and context can be called concurrently with -threadedRHS, otherwise it is always computed serially
      */
     void RegisterRHSFunction(CellInterpolant::PointFunction function, void* context, const std::vector<std::string>& fields, const std::vector<std::string>& inputFields,
-                             const std::vector<std::string>& auxFields);
+                             const std::vector<std::string>& auxFields, bool threadSafe = false);
 
     /**
      * Register an arbitrary function.  The user is responsible for all work
@@ -144,15 +262,30 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
      */
     void RegisterPreRHSFunction(PreRHSFunctionDefinition function, void* context);
 
+    /**
+     * Get the global diagnostics computed in a single pass over the cells and a single reduction before each step.  The pass is registered as a pre step
+     * the first time this is called.
+     * @return
+     */
+    solver::GlobalDiagnostics& GetGlobalDiagnostics();
+
+    /**
+     * Register an implicit function and its jacobian.  The function adds its contribution to the local implicit residual (i.e. -S(X)) and the jacobian adds
+     * its contribution (i.e. -dS/dX) to the global matrix with ADD_VALUES.  The solver adds the X_t terms and assembles the matrix.
+     * @param function
+     * @param jacobian
+     * @param context
+     */
+    void RegisterIFunction(IFunctionDefinition function, IJacobianDefinition jacobian, void* context);
+
     /**
      * Register a dtCalculator
      * @param function
      * @param context
-     * @param field
-     * @param inputFields
-     * @param auxFields
+     * @param name
+     * @param localFunction optional function to compute the time step for a single cell, required for local time stepping
      */
-    void RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx, std::string name);
+    void RegisterComputeTimeStepFunction(ComputeTimeStepFunction function, void* ctx, std::string name, ComputeLocalTimeStepFunction localFunction = nullptr);
 
     /**
      * Computes the individual time steps useful for output/debugging.  This does not enforce the time step
@@ -213,6 +346,14 @@ class FiniteVolumeSolver : public solver::CellSolver, public solver::RHSFunction
      * @return
      */
     PetscErrorCode PreRHSFunction(TS ts, PetscReal time, bool initialStage, Vec locX) override;
+
+    /**
+     * Scales the rhs of each owned cell by its local time step when using local time stepping
+     * @param time
+     * @param F
+     * @return
+     */
+    PetscErrorCode PostRHSFunction(PetscReal time, Vec F) override;
 };
 }  // namespace ablate::finiteVolume
 
@@ -0,0 +1,39 @@
+#include "adaptiveFlux.hpp"
+#include <stdexcept>
+#include <utility>
+
+ablate::finiteVolume::fluxCalculator::AdaptiveFlux::AdaptiveFlux(std::shared_ptr<FluxCalculator> defaultFluxCalculatorIn, std::shared_ptr<FluxCalculator> shockFluxCalculatorIn,
+                                                                  double pressureJump)
+    : defaultFluxCalculator(std::move(defaultFluxCalculatorIn)), shockFluxCalculator(std::move(shockFluxCalculatorIn)), pressureJump(pressureJump) {
+    if (!defaultFluxCalculator || !shockFluxCalculator) {
+        throw std::invalid_argument("ablate::finiteVolume::fluxCalculator::AdaptiveFlux requires both a default and shock flux calculator");
+    }
+    defaultFunction = defaultFluxCalculator->GetFluxCalculatorFunction();
+    defaultContext = defaultFluxCalculator->GetFluxCalculatorContext();
+    shockFunction = shockFluxCalculator->GetFluxCalculatorFunction();
+    shockContext = shockFluxCalculator->GetFluxCalculatorContext();
+}
+
+ablate::finiteVolume::fluxCalculator::AdaptiveFlux::~AdaptiveFlux() {
+    PetscInfo(nullptr, "AdaptiveFlux computed %" PetscInt64_FMT " faces with the default flux and %" PetscInt64_FMT " faces with the shock flux\n", (PetscInt64)defaultCount, (PetscInt64)shockCount);
+}
+
+ablate::finiteVolume::fluxCalculator::Direction ablate::finiteVolume::fluxCalculator::AdaptiveFlux::AdaptiveFluxFunction(void *ctx, PetscReal uL, PetscReal aL, PetscReal rhoL, PetscReal pL,
+                                                                                                                         PetscReal uR, PetscReal aR, PetscReal rhoR, PetscReal pR, PetscReal *massFlux,
+                                                                                                                         PetscReal *p12) {
+    auto adaptiveFlux = (AdaptiveFlux *)ctx;
+    if (adaptiveFlux->SensorFires(pL, pR)) {
+        adaptiveFlux->shockCount.fetch_add(1, std::memory_order_relaxed);
+        return adaptiveFlux->shockFunction(adaptiveFlux->shockContext, uL, aL, rhoL, pL, uR, aR, rhoR, pR, massFlux, p12);
+    } else {
+        adaptiveFlux->defaultCount.fetch_add(1, std::memory_order_relaxed);
+        return adaptiveFlux->defaultFunction(adaptiveFlux->defaultContext, uL, aL, rhoL, pL, uR, aR, rhoR, pR, massFlux, p12);
+    }
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::finiteVolume::fluxCalculator::FluxCalculator, ablate::finiteVolume::fluxCalculator::AdaptiveFlux,
+         "Composite flux calculator that switches from an inexpensive flux calculator to a shock capturing flux calculator where a pressure jump sensor fires",
+         ARG(ablate::finiteVolume::fluxCalculator::FluxCalculator, "default", "the inexpensive flux calculator used on smooth faces (e.g. AverageFlux or Ausm)"),
+         ARG(ablate::finiteVolume::fluxCalculator::FluxCalculator, "shock", "the flux calculator used where the sensor fires (e.g. Rieman)"),
+         ARG(double, "pressureJump", "the relative pressure jump |pR - pL|/min(pL, pR) that triggers the shock flux calculator"));
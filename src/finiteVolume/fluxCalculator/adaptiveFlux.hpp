@@ -0,0 +1,60 @@
+#ifndef ABLATELIBRARY_ADAPTIVEFLUX_HPP
+#define ABLATELIBRARY_ADAPTIVEFLUX_HPP
+#include <atomic>
+#include <memory>
+#include "fluxCalculator.hpp"
+
+namespace ablate::finiteVolume::fluxCalculator {
+
+/*
+ * Composite flux calculator that uses an inexpensive flux calculator on smooth faces and switches to a more expensive (e.g. exact Riemann) flux calculator
+ * only on faces where the pressure jump sensor |pR - pL|/min(pL, pR) exceeds the threshold.
+ */
+class AdaptiveFlux : public fluxCalculator::FluxCalculator {
+   private:
+    static Direction AdaptiveFluxFunction(void *ctx, PetscReal uL, PetscReal aL, PetscReal rhoL, PetscReal pL, PetscReal uR, PetscReal aR, PetscReal rhoR, PetscReal pR, PetscReal *massFlux,
+                                          PetscReal *p12);
+
+    /**
+     * Determines if the shock flux calculator should be used for this face
+     */
+    inline bool SensorFires(PetscReal pL, PetscReal pR) const { return PetscAbsReal(pR - pL) > pressureJump * PetscMin(pL, pR); }
+
+    // the flux calculators
+    const std::shared_ptr<FluxCalculator> defaultFluxCalculator;
+    const std::shared_ptr<FluxCalculator> shockFluxCalculator;
+
+    // the relative pressure jump that triggers the shock flux calculator
+    const PetscReal pressureJump;
+
+    // the cached functions/contexts
+    FluxCalculatorFunction defaultFunction;
+    void *defaultContext;
+    FluxCalculatorFunction shockFunction;
+    void *shockContext;
+
+    // the number of faces computed with each flux calculator, these are atomic so they can be updated by concurrent face loops
+    std::atomic<PetscInt64> defaultCount = 0;
+    std::atomic<PetscInt64> shockCount = 0;
+
+   public:
+    /**
+     * @param defaultFluxCalculator the inexpensive flux calculator used on smooth faces
+     * @param shockFluxCalculator the flux calculator used where the sensor fires
+     * @param pressureJump the relative pressure jump that triggers the shock flux calculator
+     */
+    AdaptiveFlux(std::shared_ptr<FluxCalculator> defaultFluxCalculator, std::shared_ptr<FluxCalculator> shockFluxCalculator, double pressureJump);
+    ~AdaptiveFlux() override;
+
+    FluxCalculatorFunction GetFluxCalculatorFunction() override { return AdaptiveFluxFunction; }
+    void *GetFluxCalculatorContext() override { return this; }
+
+    //! the number of faces computed with the default flux calculator
+    [[nodiscard]] inline PetscInt64 GetDefaultCount() const { return defaultCount; }
+
+    //! the number of faces computed with the shock flux calculator
+    [[nodiscard]] inline PetscInt64 GetShockCount() const { return shockCount; }
+};
+}  // namespace ablate::finiteVolume::fluxCalculator
+
+#endif  // ABLATELIBRARY_ADAPTIVEFLUX_HPP
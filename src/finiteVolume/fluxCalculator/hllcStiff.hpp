@@ -0,0 +1,54 @@
+#ifndef ABLATELIBRARY_HLLCSTIFF_HPP
+#define ABLATELIBRARY_HLLCSTIFF_HPP
+#include <eos/eos.hpp>
+#include <memory>
+#include "fluxCalculator.hpp"
+#include "riemannStiff.hpp"
+
+namespace ablate::finiteVolume::fluxCalculator {
+/*
+ * Computes the flux with an iteration free HLLC approximate Riemann solver, different stiffened gas on left/right.  The wave speeds use the Davis
+ * estimates so every face has the same operation count.  Faces with a large pressure ratio can optionally fall back to the exact RiemannStiff solution.
+ * Reference Toro, Riemann Solvers and Numerical Methods for Fluid Dynamics, 2009, Chapter 10
+ */
+class HllcStiff : public fluxCalculator::FluxCalculator {
+   private:
+    static Direction HllcStiffFluxFunction(void *, PetscReal uL, PetscReal aL, PetscReal rhoL, PetscReal pL, PetscReal uR, PetscReal aR, PetscReal rhoR, PetscReal pR, PetscReal *massFlux,
+                                           PetscReal *p12);
+
+    /**
+     * Branch free hllc kernel
+     */
+    static inline Direction HllcKernel(PetscReal uL, PetscReal aL, PetscReal rhoL, PetscReal pL, PetscReal uR, PetscReal aR, PetscReal rhoR, PetscReal pR, PetscReal &massFlux, PetscReal &p12);
+
+    /**
+     * Determines if the exact solver should be used for this face
+     */
+    inline bool UseExactSolver(PetscReal pL, PetscReal pR) const;
+
+    // the reference pressure for the stiffened gas on the left/right
+    PetscReal p0L = 0.0;
+    PetscReal p0R = 0.0;
+
+    // the pressure ratio (pL + p0L)/(pR + p0R) or inverse above which the exact solver is used, zero disables the exact solver
+    const PetscReal exactPressureRatio;
+
+    // the optional exact solver
+    std::unique_ptr<RiemannStiff> exactSolver;
+    FluxCalculatorFunction exactFunction = nullptr;
+    void *exactContext = nullptr;
+
+   public:
+    /**
+     * @param eosL
+     * @param eosR
+     * @param exactPressureRatio the pressure ratio above which the exact solver is used (default is to never use the exact solver)
+     */
+    explicit HllcStiff(std::shared_ptr<eos::EOS> eosL, std::shared_ptr<eos::EOS> eosR, double exactPressureRatio = 0.0);
+
+    FluxCalculatorFunction GetFluxCalculatorFunction() override { return HllcStiffFluxFunction; }
+    void *GetFluxCalculatorContext() override { return this; }
+};
+}  // namespace ablate::finiteVolume::fluxCalculator
+
+#endif  // ABLATELIBRARY_HLLCSTIFF_HPP
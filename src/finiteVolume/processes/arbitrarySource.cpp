@@ -1,25 +1,76 @@
 
 #include "arbitrarySource.hpp"
+#include "utilities/petscError.hpp"
+
 ablate::finiteVolume::processes::ArbitrarySource::ArbitrarySource(std::map<std::string, std::shared_ptr<ablate::mathFunctions::MathFunction>> functions) : functions(std::move(functions)) {}
 
 void ablate::finiteVolume::processes::ArbitrarySource::Setup(ablate::finiteVolume::FiniteVolumeSolver &fvmSolver) {
     for (const auto &[fieldName, function] : functions) {
         // Get the field from the subDomain
         const auto &field = fvmSolver.GetSubDomain().GetField(fieldName);
+        sourceFields.push_back(SourceField{.function = function, .fieldId = field.id, .fieldSize = field.numberComponents, .timeInvariant = function->IsTimeInvariant()});
+    }
 
-        petscFunctions.emplace_back(PetscFunctionStruct{.petscFunction = function->GetPetscFunction(), .petscContext = function->GetContext(), .fieldSize = field.numberComponents});
+    // add the source function
+    fvmSolver.RegisterRHSFunction(ComputeArbitrarySource, this);
+}
 
-        // add the source function
-        fvmSolver.RegisterRHSFunction(ComputeArbitrarySource, &petscFunctions.back(), {fieldName}, {}, {});
+void ablate::finiteVolume::processes::ArbitrarySource::Initialize(ablate::finiteVolume::FiniteVolumeSolver &fvmSolver) {
+    auto dm = fvmSolver.GetSubDomain().GetDM();
+    dim = fvmSolver.GetSubDomain().GetDimensions();
+
+    // store the centroid of each cell so the functions are evaluated as a single batch
+    solver::Range cellRange;
+    fvmSolver.GetCellRangeWithoutGhost(cellRange);
+    cells.clear();
+    centroids.clear();
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(dm, cell, nullptr, centroid, nullptr) >> checkError;
+        cells.push_back(cell);
+        centroids.insert(centroids.end(), centroid, centroid + dim);
+    }
+    fvmSolver.RestoreRange(cellRange);
+
+    // time invariant sources are computed once
+    for (auto &source : sourceFields) {
+        if (source.timeInvariant) {
+            source.values.resize(cells.size() * source.fieldSize);
+            source.function->EvalBatch(centroids.data(), cells.size(), (int)dim, 0.0, source.values.data(), source.fieldSize, source.fieldSize);
+        }
     }
 }
 
-PetscErrorCode ablate::finiteVolume::processes::ArbitrarySource::ComputeArbitrarySource(PetscInt dim, PetscReal time, const PetscFVCellGeom *cg, const PetscInt *uOff, const PetscScalar *u,
-                                                                                        const PetscInt *aOff, const PetscScalar *a, PetscScalar *f, void *ctx) {
+PetscErrorCode ablate::finiteVolume::processes::ArbitrarySource::ComputeArbitrarySource(const FiniteVolumeSolver &, DM dm, PetscReal time, Vec, Vec locFVec, void *ctx) {
     PetscFunctionBegin;
-    auto function = (PetscFunctionStruct *)ctx;
-    PetscErrorCode ierr = function->petscFunction(dim, time, cg->centroid, function->fieldSize, f, function->petscContext);
-    CHKERRQ(ierr);
+    auto process = (ArbitrarySource *)ctx;
+
+    PetscScalar *locFArray;
+    PetscCall(VecGetArray(locFVec, &locFArray));
+    try {
+        const auto numberCells = process->cells.size();
+        for (const auto &source : process->sourceFields) {
+            const PetscReal *values = source.values.data();
+            if (!source.timeInvariant) {
+                process->sourceValues.resize(numberCells * source.fieldSize);
+                source.function->EvalBatch(process->centroids.data(), numberCells, (int)process->dim, time, process->sourceValues.data(), source.fieldSize, source.fieldSize);
+                values = process->sourceValues.data();
+            }
+
+            // add the source to each cell
+            for (std::size_t c = 0; c < numberCells; ++c) {
+                PetscScalar *f;
+                PetscCall(DMPlexPointLocalFieldRef(dm, process->cells[c], source.fieldId, locFArray, &f));
+                for (PetscInt d = 0; d < source.fieldSize; ++d) {
+                    f[d] += values[c * source.fieldSize + d];
+                }
+            }
+        }
+    } catch (std::exception &exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+    }
+    PetscCall(VecRestoreArray(locFVec, &locFArray));
     PetscFunctionReturn(0);
 }
 
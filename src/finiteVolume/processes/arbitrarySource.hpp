@@ -4,28 +4,44 @@
 #include "process.hpp"
 namespace ablate::finiteVolume::processes {
 /**
- * This class uses math functions to add arbitrary sources to the fvm method
+ * This class uses math functions to add arbitrary sources to the fvm method.  Each function is evaluated once per rhs as a batch over the centroids of every
+ * cell in the solver region, time invariant functions are only evaluated once.
  */
 class ArbitrarySource : public Process {
     //! list of functions used to compute the arbitrary source
     const std::map<std::string, std::shared_ptr<ablate::mathFunctions::MathFunction>> functions;
 
-    /**
-     * private function to compute  source
-     * @return
-     */
-    static PetscErrorCode ComputeArbitrarySource(PetscInt dim, PetscReal time, const PetscFVCellGeom* cg, const PetscInt uOff[], const PetscScalar u[], const PetscInt aOff[], const PetscScalar a[],
-                                                 PetscScalar f[], void* ctx);
-
-    //! pre store the petsc function and context
-    struct PetscFunctionStruct {
-        mathFunctions::PetscFunction petscFunction;
-        void* petscContext;
+    //! the function and field for each source
+    struct SourceField {
+        std::shared_ptr<ablate::mathFunctions::MathFunction> function;
+        PetscInt fieldId;
         PetscInt fieldSize;
+
+        //! if the function is time invariant the values at each cell are computed once in Initialize
+        bool timeInvariant;
+        std::vector<PetscReal> values;
     };
 
-    //! Store pointers to the petsc functions
-    std::vector<PetscFunctionStruct> petscFunctions;
+    //! the sources added to the rhs
+    std::vector<SourceField> sourceFields;
+
+    //! the cells in the solver region without ghost cells
+    std::vector<PetscInt> cells;
+
+    //! the centroid of each cell in [cell*dim + d] order
+    std::vector<PetscReal> centroids;
+
+    //! the dimension of the centroids
+    PetscInt dim = 0;
+
+    //! scratch for the batch of source values
+    std::vector<PetscReal> sourceValues;
+
+    /**
+     * private function to compute the source for every cell
+     * @return
+     */
+    static PetscErrorCode ComputeArbitrarySource(const FiniteVolumeSolver&, DM dm, PetscReal time, Vec locXVec, Vec locFVec, void* ctx);
 
    public:
     explicit ArbitrarySource(std::map<std::string, std::shared_ptr<ablate::mathFunctions::MathFunction>> functions);
@@ -35,6 +51,12 @@ class ArbitrarySource : public Process {
      * @param flow
      */
     void Setup(ablate::finiteVolume::FiniteVolumeSolver& fvmSolver) override;
+
+    /**
+     * compute the cell centroids used to evaluate the functions
+     * @param fvmSolver
+     */
+    void Initialize(ablate::finiteVolume::FiniteVolumeSolver& fvmSolver) override;
 };
 
 }  // namespace ablate::finiteVolume::processes
@@ -9,18 +9,10 @@ class Buoyancy : public FlowProcess {
    private:
     const std::vector<PetscReal> buoyancyVector;
     /**
-     * Compute and store the avg density in the domain
+     * Compute and store the avg density in the domain, this is updated before each step with the solver's global diagnostics
      */
     PetscReal densityAvg = NAN;
 
-    /**
-     * private function to compute the average density in the domain
-     * @param flowTs
-     * @param flow
-     * @return
-     */
-    PetscErrorCode UpdateAverageDensity(TS flowTs, ablate::solver::Solver& flow);
-
     /**
      * private function to compute gravity source
      * @return
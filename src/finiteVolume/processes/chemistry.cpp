@@ -5,17 +5,41 @@
 #include "utilities/petscError.hpp"
 #include "utilities/vectorUtilities.hpp"
 
-ablate::finiteVolume::processes::Chemistry::Chemistry(std::shared_ptr<ablate::eos::ChemistryModel> chemistryModel) : chemistryModel(std::move(chemistryModel)) {}
+ablate::finiteVolume::processes::Chemistry::Chemistry(std::shared_ptr<ablate::eos::ChemistryModel> chemistryModel, std::shared_ptr<io::interval::Interval> splitInterval, bool implicit)
+    : chemistryModel(std::move(chemistryModel)), splitInterval(std::move(splitInterval)), implicit(implicit) {
+    if (this->splitInterval && implicit) {
+        throw std::invalid_argument("ablate::finiteVolume::processes::Chemistry cannot be both operator split and implicit");
+    }
+}
 
 void ablate::finiteVolume::processes::Chemistry::Setup(ablate::finiteVolume::FiniteVolumeSolver& flow) {
+    // When operator split, the chemistry is advanced outside the ts stages and is not added to the rhs
+    if (splitInterval) {
+        flow.RegisterPreStep([this](TS ts, ablate::solver::Solver& solver) { ChemistrySplitPreStep(ts, solver) >> checkError; });
+        return;
+    }
+
+    // When implicit, the instantaneous source and its jacobian are integrated by the ts
+    if (implicit) {
+        flow.RegisterIFunction(AddChemistryImplicitFunction, AddChemistryImplicitJacobian, this);
+        return;
+    }
+
     // Before each step, compute the source term over the entire dt
     auto chemistryPreStage = std::bind(&ablate::finiteVolume::processes::Chemistry::ChemistryPreStage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-    flow.RegisterPreStage(chemistryPreStage);
+    flow.RegisterPreStage(chemistryPreStage, ablate::solver::Solver::PreStageDependence::step);
 
     // Add the rhs point function for the source
     flow.RegisterRHSFunction(AddChemistrySourceToFlow, this);
 }
 
+void ablate::finiteVolume::processes::Chemistry::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const {
+    if (sourceCalculator) {
+        sourceCalculator->AccumulateMemoryUsage(memoryUsage, prefix);
+    }
+    memoryUsage.Add(prefix + "chemistryCost", cellCost);
+}
+
 void ablate::finiteVolume::processes::Chemistry::Initialize(ablate::finiteVolume::FiniteVolumeSolver& flow) {
     // determine the number of nodes we need to compute based upon the local solver
     solver::Range cellRange;
@@ -57,12 +81,117 @@ PetscErrorCode ablate::finiteVolume::processes::Chemistry::ChemistryPreStage(TS
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
     }
+    PetscCall(UpdateCostField(fvSolver, cellRange));
 
     // clean up
     solver.RestoreRange(cellRange);
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::processes::Chemistry::ChemistrySplitPreStep(TS flowTs, ablate::solver::Solver& solver) {
+    PetscFunctionBegin;
+    // get time step information from the ts
+    PetscReal time;
+    PetscCall(TSGetTime(flowTs, &time));
+    PetscInt step;
+    PetscCall(TSGetStepNumber(flowTs, &step));
+    PetscReal dt;
+    PetscCall(TSGetTimeStep(flowTs, &dt));
+
+    // the chemistry starts at the first step time
+    if (PetscIsNanReal(chemistryTime)) {
+        chemistryTime = time;
+    }
+
+    // C(dt0/2) F(dt0) C(dt0/2) C(dt1/2) F(dt1) ... so advance the chemistry from its current time to the middle of this step.  Steps skipped by the
+    // interval are accumulated into the next chemistry advance.
+    if (!splitInterval->Check(PetscObjectComm((PetscObject)flowTs), step, time)) {
+        PetscFunctionReturn(0);
+    }
+    const PetscReal chemistryDt = time + 0.5 * dt - chemistryTime;
+    if (chemistryDt <= 0.0) {
+        PetscFunctionReturn(0);
+    }
+
+    // get the flowSolution from the ts and advance it in place
+    Vec globFlowVec;
+    PetscCall(TSGetSolution(flowTs, &globFlowVec));
+    PetscCall(AdvanceChemistry(dynamic_cast<ablate::finiteVolume::FiniteVolumeSolver&>(solver), globFlowVec, chemistryTime, chemistryDt));
+    chemistryTime += chemistryDt;
+
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::processes::Chemistry::AdvanceChemistry(ablate::finiteVolume::FiniteVolumeSolver& fvSolver, Vec globFlowVec, PetscReal time, PetscReal dt) {
+    PetscFunctionBegin;
+    // Get the valid cell range over this region
+    solver::Range cellRange;
+    fvSolver.GetCellRangeWithoutGhost(cellRange);
+
+    // the source calculators compute the average source over dt, so the chemistry is advanced with u += dt*S
+    auto dm = fvSolver.GetSubDomain().GetDM();
+    Vec locX, locFVec, sourceVec;
+    PetscCall(DMGetLocalVector(dm, &locX));
+    PetscCall(DMGetLocalVector(dm, &locFVec));
+    PetscCall(DMGetGlobalVector(dm, &sourceVec));
+    PetscCall(DMGlobalToLocal(dm, globFlowVec, INSERT_VALUES, locX));
+    PetscCall(VecZeroEntries(locFVec));
+
+    try {
+        sourceCalculator->ComputeSource(cellRange, time, dt, globFlowVec);
+        sourceCalculator->AddSource(cellRange, locX, locFVec);
+    } catch (std::exception& exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+    }
+    PetscCall(UpdateCostField(fvSolver, cellRange));
+
+    PetscCall(VecZeroEntries(sourceVec));
+    PetscCall(DMLocalToGlobal(dm, locFVec, INSERT_VALUES, sourceVec));
+    PetscCall(VecAXPY(globFlowVec, dt, sourceVec));
+
+    // clean up
+    PetscCall(DMRestoreGlobalVector(dm, &sourceVec));
+    PetscCall(DMRestoreLocalVector(dm, &locFVec));
+    PetscCall(DMRestoreLocalVector(dm, &locX));
+    fvSolver.RestoreRange(cellRange);
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::processes::Chemistry::UpdateCostField(ablate::finiteVolume::FiniteVolumeSolver& fvSolver, const solver::Range& cellRange) {
+    PetscFunctionBegin;
+    auto& subDomain = fvSolver.GetSubDomain();
+    if (!subDomain.ContainsField(CHEMISTRY_COST_FIELD)) {
+        PetscFunctionReturn(0);
+    }
+    const auto& costField = subDomain.GetField(CHEMISTRY_COST_FIELD);
+    if (costField.location != domain::FieldLocation::AUX) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_ARG_WRONG, "The %s field must be an aux field", CHEMISTRY_COST_FIELD.c_str());
+    }
+
+    // only models that record the cost are output
+    cellCost.resize((cellRange.end - cellRange.start) * eos::ChemistryModel::SourceCalculator::CELL_COST_SIZE);
+    if (!sourceCalculator->GetCellCost(cellRange, cellCost.data())) {
+        PetscFunctionReturn(0);
+    }
+
+    // copy the cost into the aux field, the aux field is output with the normal serializer
+    auto auxDm = subDomain.GetAuxDM();
+    auto auxVec = subDomain.GetAuxVector();
+    const auto numberComponents = PetscMin(costField.numberComponents, (PetscInt)eos::ChemistryModel::SourceCalculator::CELL_COST_SIZE);
+    PetscScalar* auxArray;
+    PetscCall(VecGetArray(auxVec, &auxArray));
+    for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
+        const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
+        PetscScalar* cost = nullptr;
+        PetscCall(DMPlexPointLocalFieldRef(auxDm, cell, costField.id, auxArray, &cost));
+        for (PetscInt k = 0; k < numberComponents; ++k) {
+            cost[k] = cellCost[(i - cellRange.start) * eos::ChemistryModel::SourceCalculator::CELL_COST_SIZE + k];
+        }
+    }
+    PetscCall(VecRestoreArray(auxVec, &auxArray));
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::finiteVolume::processes::Chemistry::AddChemistrySourceToFlow(const FiniteVolumeSolver& solver, DM dm, PetscReal time, Vec locX, Vec locFVec, void* ctx) {
     PetscFunctionBegin;
     auto process = (ablate::finiteVolume::processes::Chemistry*)ctx;
@@ -84,10 +213,58 @@ PetscErrorCode ablate::finiteVolume::processes::Chemistry::AddChemistrySourceToF
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::finiteVolume::processes::Chemistry::AddChemistryImplicitFunction(const FiniteVolumeSolver& solver, DM, PetscReal, Vec locX, Vec locFVec, void* ctx) {
+    PetscFunctionBegin;
+    auto process = (ablate::finiteVolume::processes::Chemistry*)ctx;
+
+    // get the cell range
+    solver::Range cellRange;
+    solver.GetCellRangeWithoutGhost(cellRange);
+
+    // F(t, X, X_t) = X_t - S(X)
+    try {
+        process->sourceCalculator->AddImplicitSource(cellRange, locX, -1.0, locFVec);
+    } catch (std::exception& exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+    }
+
+    // cleanup
+    solver.RestoreRange(cellRange);
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::processes::Chemistry::AddChemistryImplicitJacobian(const FiniteVolumeSolver& solver, DM, PetscReal, Vec locX, Mat JacP, void* ctx) {
+    PetscFunctionBegin;
+    auto process = (ablate::finiteVolume::processes::Chemistry*)ctx;
+
+    // get the cell range
+    solver::Range cellRange;
+    solver.GetCellRangeWithoutGhost(cellRange);
+
+    // dF/dX = X_tShift*I - dS/dX, the shift is added by the solver
+    try {
+        process->sourceCalculator->AddImplicitJacobian(cellRange, locX, -1.0, JacP);
+    } catch (std::exception& exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+    }
+
+    // cleanup
+    solver.RestoreRange(cellRange);
+    PetscFunctionReturn(0);
+}
+
 void ablate::finiteVolume::processes::Chemistry::AddChemistrySourceToFlow(const FiniteVolumeSolver& solver, Vec locFVec) {
     AddChemistrySourceToFlow(solver, solver.GetSubDomain().GetDM(), NAN, nullptr, locFVec, this) >> checkError;
 }
 
 #include "registrar.hpp"
-REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::Chemistry, "adds chemistry source terms from a chemistry model to the finite volume flow",
-         ARG(ablate::eos::ChemistryModel, "eos", "the eos/chemistry model to generate source terms"));
+REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::Chemistry,
+         "adds chemistry source terms from a chemistry model to the finite volume flow.  When the domain contains a chemistryCost aux field (wallTime, substeps, failures) the per cell cost "
+         "of the last chemistry integration is copied into it for output",
+         ARG(ablate::eos::ChemistryModel, "eos", "the eos/chemistry model to generate source terms"),
+         OPT(ablate::io::interval::Interval, "splitInterval",
+             "when provided the chemistry is operator split (Strang) from the flow and advanced at this interval outside of the ts stages. Skipped steps are accumulated into the next "
+             "chemistry advance (default is to add the chemistry source to each rhs stage)"),
+         OPT(bool, "implicit",
+             "when true the instantaneous chemistry source and its cell block jacobian are added to the ts implicit function so the chemistry can be integrated implicitly with an imex ts "
+             "(e.g. -ts_type arkimex) while the transport remains explicit (default is false)"));
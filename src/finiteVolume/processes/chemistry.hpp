@@ -2,12 +2,19 @@
 #define ABLATELIBRARY_FINITEVOLUME_CHEMISTRY_HPP
 
 #include <memory>
+#include <string>
+#include <vector>
 #include "eos/chemistryModel.hpp"
+#include "io/interval/interval.hpp"
 #include "process.hpp"
 
 namespace ablate::finiteVolume::processes {
 
 class Chemistry : public Process {
+   public:
+    //! the optional aux field (wall time, substeps, integration failures) used to output the per cell chemistry cost from the last source computation
+    inline const static std::string CHEMISTRY_COST_FIELD = "chemistryCost";
+
    private:
     //! store the eos that will be used to create the calculator
     const std::shared_ptr<ablate::eos::ChemistryModel> chemistryModel;
@@ -15,14 +22,54 @@ class Chemistry : public Process {
     //! the current active chemistry calculator
     std::shared_ptr<ablate::eos::ChemistryModel::SourceCalculator> sourceCalculator;
 
+    //! optional interval used to advance the chemistry operator split from the flow.  If not provided the chemistry source is added to each rhs stage
+    const std::shared_ptr<io::interval::Interval> splitInterval;
+
+    //! integrate the instantaneous chemistry source implicitly in the ts (i.e. with an imex ts) instead of adding the average source over dt to the rhs
+    const bool implicit;
+
+    //! the time that the operator split chemistry has been advanced to
+    PetscReal chemistryTime = NAN;
+
+    //! scratch memory for the cost of each cell when the CHEMISTRY_COST_FIELD is output
+    std::vector<PetscReal> cellCost;
+
     /**
-     * private function to compute the energy and densityYi source terms over the next dt
+     * copy the cost of each cell from the source calculator into the CHEMISTRY_COST_FIELD if it is in the subdomain
+     * @param fvSolver
+     * @param cellRange
+     * @return
+     */
+    PetscErrorCode UpdateCostField(ablate::finiteVolume::FiniteVolumeSolver &fvSolver, const solver::Range &cellRange);
+
+    /**
+     * private function to compute the energy and densityYi source terms over the next dt.  This is called by every rank so the source calculator may redistribute the
+     * chemistry work between ranks.
      * @param flowTs
      * @param flow
      * @return
      */
     PetscErrorCode ChemistryPreStage(TS flowTs, ablate::solver::Solver &flow, PetscReal stagetime);
 
+    /**
+     * private function to advance the operator split chemistry before each flow step.  The chemistry is advanced to the middle of the upcoming flow step so
+     * that consecutive Strang half steps are merged into a single chemistry advance.  This is called by every rank.
+     * @param flowTs
+     * @param flow
+     * @return
+     */
+    PetscErrorCode ChemistrySplitPreStep(TS flowTs, ablate::solver::Solver &flow);
+
+    /**
+     * Advance the solution in place over dt using the average chemistry source over dt
+     * @param fvSolver
+     * @param globFlowVec
+     * @param time
+     * @param dt
+     * @return
+     */
+    PetscErrorCode AdvanceChemistry(ablate::finiteVolume::FiniteVolumeSolver &fvSolver, Vec globFlowVec, PetscReal time, PetscReal dt);
+
     /**
      * static function to add chemistry source terms
      * @param solver
@@ -35,11 +82,38 @@ class Chemistry : public Process {
      */
     static PetscErrorCode AddChemistrySourceToFlow(const FiniteVolumeSolver &solver, DM dm, PetscReal time, Vec locX, Vec fVec, void *ctx);
 
+    /**
+     * static function to add the implicit chemistry residual, -S(X), to the local implicit function
+     * @param solver
+     * @param dm
+     * @param time
+     * @param locX
+     * @param locFVec
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode AddChemistryImplicitFunction(const FiniteVolumeSolver &solver, DM dm, PetscReal time, Vec locX, Vec locFVec, void *ctx);
+
+    /**
+     * static function to add the implicit chemistry jacobian, -dS/dX, to the jacobian
+     * @param solver
+     * @param dm
+     * @param time
+     * @param locX
+     * @param JacP
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode AddChemistryImplicitJacobian(const FiniteVolumeSolver &solver, DM dm, PetscReal time, Vec locX, Mat JacP, void *ctx);
+
    public:
     /**
      * The chemistry processes need a chemistry model
+     * @param chemistryModel
+     * @param splitInterval optional interval to advance the chemistry operator split (Strang) from the flow instead of adding the source to each rhs stage
+     * @param implicit integrate the chemistry in the ts implicit function (i.e. ARKIMEX) instead of adding the source to each rhs stage
      */
-    explicit Chemistry(std::shared_ptr<ablate::eos::ChemistryModel>);
+    explicit Chemistry(std::shared_ptr<ablate::eos::ChemistryModel> chemistryModel, std::shared_ptr<io::interval::Interval> splitInterval = {}, bool implicit = false);
 
     /**
      * public function to link this process with the flow
@@ -53,6 +127,11 @@ class Chemistry : public Process {
      */
     void Initialize(ablate::finiteVolume::FiniteVolumeSolver &flow) override;
 
+    /**
+     * Add the source calculator memory to the memory usage
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage &memoryUsage, const std::string &prefix) const override;
+
     /**
      * public function to copy the source terms to a locFVec
      * @param solver
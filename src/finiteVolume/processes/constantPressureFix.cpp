@@ -20,17 +20,27 @@ void ablate::finiteVolume::processes::ConstantPressureFix::Setup(ablate::finiteV
             eos->GetFieldFunctionFunction(finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD, eos::ThermodynamicProperty::InternalSensibleEnergy, eos::ThermodynamicProperty::Pressure);
     }
 
+    // resolve the field handles once so the post evaluate does not search the fields every step
+    const auto eulerHandle = fv.GetSubDomain().GetFieldHandle(finiteVolume::CompressibleFlowFields::EULER_FIELD);
+    domain::FieldHandle densityProgressHandle, densityYiHandle;
+    if (fv.GetSubDomain().ContainsField(finiteVolume::CompressibleFlowFields::DENSITY_PROGRESS_FIELD)) {
+        densityProgressHandle = fv.GetSubDomain().GetFieldHandle(finiteVolume::CompressibleFlowFields::DENSITY_PROGRESS_FIELD);
+    }
+    if (fv.GetSubDomain().ContainsField(finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD)) {
+        densityYiHandle = fv.GetSubDomain().GetFieldHandle(finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD);
+    }
+
     if (std::dynamic_pointer_cast<eos::ChemTab>(eos)) {
-        fv.RegisterPostEvaluate([this](TS ts, ablate::solver::Solver& fvSolver) {
+        fv.RegisterPostEvaluate([this, eulerHandle, densityProgressHandle](TS ts, ablate::solver::Solver& fvSolver) {
             // get access to the underlying data for the flow
-            const auto& eulerId = fvSolver.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::EULER_FIELD);
+            const auto& eulerId = fvSolver.GetSubDomain().GetField(eulerHandle);
             auto chemTab = std::dynamic_pointer_cast<eos::ChemTab>(eos);
             PetscInt densityProgressOffset = PETSC_DECIDE;
             PetscInt numberSpecies = chemTab->GetSpecies().size();
             PetscInt numberProgressVariables = chemTab->GetSpecies().size();
 
-            if (fvSolver.GetSubDomain().ContainsField(finiteVolume::CompressibleFlowFields::DENSITY_PROGRESS_FIELD)) {
-                const auto& densityProgressId = fvSolver.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::DENSITY_PROGRESS_FIELD);
+            if (densityProgressHandle.Valid()) {
+                const auto& densityProgressId = fvSolver.GetSubDomain().GetField(densityProgressHandle);
                 numberProgressVariables = densityProgressId.numberComponents;
                 densityProgressOffset = densityProgressId.offset;
             }
@@ -95,13 +105,13 @@ void ablate::finiteVolume::processes::ConstantPressureFix::Setup(ablate::finiteV
         });
 
     } else {
-        fv.RegisterPostEvaluate([this](TS ts, ablate::solver::Solver& fvSolver) {
+        fv.RegisterPostEvaluate([this, eulerHandle, densityYiHandle](TS ts, ablate::solver::Solver& fvSolver) {
             // get access to the underlying data for the flow
-            const auto& eulerId = fvSolver.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::EULER_FIELD);
+            const auto& eulerId = fvSolver.GetSubDomain().GetField(eulerHandle);
             PetscInt densityYiOffset = PETSC_DECIDE;
             PetscInt numberSpecies = 0;
-            if (fvSolver.GetSubDomain().ContainsField(finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD)) {
-                const auto& densityYiId = fvSolver.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD);
+            if (densityYiHandle.Valid()) {
+                const auto& densityYiId = fvSolver.GetSubDomain().GetField(densityYiHandle);
                 numberSpecies = densityYiId.numberComponents;
                 densityYiOffset = densityYiId.offset;
             }
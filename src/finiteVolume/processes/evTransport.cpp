@@ -9,6 +9,11 @@ ablate::finiteVolume::processes::EVTransport::EVTransport(std::shared_ptr<eos::E
 void ablate::finiteVolume::processes::EVTransport::Setup(ablate::finiteVolume::FiniteVolumeSolver &flow) {
     const auto &evConservedFields = flow.GetSubDomain().GetFields(domain::FieldLocation::SOL, CompressibleFlowFields::EV_TAG);
 
+    // the data is passed to the flux functions by pointer, so it must not be reallocated
+    advectionDatas.reserve(evConservedFields.size());
+    numberEVs.reserve(evConservedFields.size());
+    diffusionDatas.reserve(evConservedFields.size());
+
     for (auto &evConservedField : evConservedFields) {
         // increase the size of the stored data
         auto &advectionData = advectionDatas.emplace_back();
@@ -20,6 +25,10 @@ void ablate::finiteVolume::processes::EVTransport::Setup(ablate::finiteVolume::F
         numberEV = evConservedField.numberComponents;
         diffusionData.numberEV = evConservedField.numberComponents;
 
+        // the first ev field computes the mass flux and diffusivity for each face, the remaining ev fields reuse them
+        advectionData.computeSharedValues = advectionDatas.size() == 1;
+        diffusionData.computeSharedValues = diffusionDatas.size() == 1;
+
         // Get the nonConserved form
         auto nonConserved = evConservedField.name.substr(CompressibleFlowFields::CONSERVED.length());
 
@@ -39,12 +48,11 @@ void ablate::finiteVolume::processes::EVTransport::Setup(ablate::finiteVolume::F
             advectionData.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
             advectionData.computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
 
-            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD, evConservedField.name}, {});
+            // the shared face values are stored per thread, so the advection is thread safe when the eos functions are
+            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD, evConservedField.name}, {}, eos->ThreadSafe());
         }
 
         if (transportModel) {
-            diffusionData.speciesSpeciesSensibleEnthalpy.resize(eos->GetSpecies().size());
-
             diffusionData.diffFunction = transportModel->GetTransportFunction(eos::transport::TransportProperty::Diffusivity, flow.GetSubDomain().GetFields());
 
             if (diffusionData.diffFunction.function) {
@@ -53,9 +61,10 @@ void ablate::finiteVolume::processes::EVTransport::Setup(ablate::finiteVolume::F
                                              &diffusionData,
                                              evConservedField.name,
                                              {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD},
-                                             {nonConserved, CompressibleFlowFields::YI_FIELD});
+                                             {nonConserved, CompressibleFlowFields::YI_FIELD},
+                                             transportModel->ThreadSafe());
                 } else {
-                    flow.RegisterRHSFunction(DiffusionEVFlux, &diffusionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD}, {nonConserved});
+                    flow.RegisterRHSFunction(DiffusionEVFlux, &diffusionData, evConservedField.name, {CompressibleFlowFields::EULER_FIELD}, {nonConserved}, transportModel->ThreadSafe());
                 }
             }
         } else {
@@ -93,78 +102,91 @@ PetscErrorCode ablate::finiteVolume::processes::EVTransport::AdvectionFlux(Petsc
     const int EULER_FIELD = 0;
     const int DENSITY_EV_FIELD = 1;
 
-    // Decode the left and right states
-    PetscReal densityL;
-    PetscReal normalVelocityL;
-    PetscReal velocityL[3];
-    PetscReal internalEnergyL;
-    PetscReal aL;
-    PetscReal pL;
-    {
-        densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureL;
-
-        PetscErrorCode ierr = eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get());
-        CHKERRQ(ierr);
-
-        // Get the velocity in this direction
-        normalVelocityL = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityL[d] = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityL;
-            normalVelocityL += velocityL[d] * norm[d];
+    // the mass flux is the same for every ev field, so only decode the states if it was not computed for this face
+    auto &shared = sharedAdvectionValues;
+    if (eulerAdvectionData->computeSharedValues || shared.face != fg || shared.fieldL != fieldL || shared.fieldR != fieldR) {
+        // Decode the left and right states
+        PetscReal densityL;
+        PetscReal normalVelocityL;
+        PetscReal velocityL[3];
+        PetscReal internalEnergyL;
+        PetscReal aL;
+        PetscReal pL;
+        {
+            densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
+            PetscReal temperatureL;
+
+            PetscErrorCode ierr = eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get());
+            CHKERRQ(ierr);
+
+            // Get the velocity in this direction
+            normalVelocityL = 0.0;
+            for (PetscInt d = 0; d < dim; d++) {
+                velocityL[d] = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityL;
+                normalVelocityL += velocityL[d] * norm[d];
+            }
+
+            ierr = eulerAdvectionData->computeInternalEnergy.function(fieldL, temperatureL, &internalEnergyL, eulerAdvectionData->computeInternalEnergy.context.get());
+            CHKERRQ(ierr);
+            ierr = eulerAdvectionData->computeSpeedOfSound.function(fieldL, temperatureL, &aL, eulerAdvectionData->computeSpeedOfSound.context.get());
+            CHKERRQ(ierr);
+            ierr = eulerAdvectionData->computePressure.function(fieldL, temperatureL, &pL, eulerAdvectionData->computePressure.context.get());
+            CHKERRQ(ierr);
         }
 
-        ierr = eulerAdvectionData->computeInternalEnergy.function(fieldL, temperatureL, &internalEnergyL, eulerAdvectionData->computeInternalEnergy.context.get());
-        CHKERRQ(ierr);
-        ierr = eulerAdvectionData->computeSpeedOfSound.function(fieldL, temperatureL, &aL, eulerAdvectionData->computeSpeedOfSound.context.get());
-        CHKERRQ(ierr);
-        ierr = eulerAdvectionData->computePressure.function(fieldL, temperatureL, &pL, eulerAdvectionData->computePressure.context.get());
-        CHKERRQ(ierr);
-    }
+        PetscReal densityR;
+        PetscReal normalVelocityR;
+        PetscReal velocityR[3];
+        PetscReal internalEnergyR;
+        PetscReal aR;
+        PetscReal pR;
+        {  // decode right state
+            densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
+            PetscReal temperatureR;
+
+            PetscErrorCode ierr = eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get());
+            CHKERRQ(ierr);
+
+            // Get the velocity in this direction
+            normalVelocityR = 0.0;
+            for (PetscInt d = 0; d < dim; d++) {
+                velocityR[d] = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityR;
+                normalVelocityR += velocityR[d] * norm[d];
+            }
 
-    PetscReal densityR;
-    PetscReal normalVelocityR;
-    PetscReal velocityR[3];
-    PetscReal internalEnergyR;
-    PetscReal aR;
-    PetscReal pR;
-    {  // decode right state
-        densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureR;
-
-        PetscErrorCode ierr = eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get());
-        CHKERRQ(ierr);
-
-        // Get the velocity in this direction
-        normalVelocityR = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityR[d] = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityR;
-            normalVelocityR += velocityR[d] * norm[d];
+            ierr = eulerAdvectionData->computeInternalEnergy.function(fieldR, temperatureR, &internalEnergyR, eulerAdvectionData->computeInternalEnergy.context.get());
+            CHKERRQ(ierr);
+            ierr = eulerAdvectionData->computeSpeedOfSound.function(fieldR, temperatureR, &aR, eulerAdvectionData->computeSpeedOfSound.context.get());
+            CHKERRQ(ierr);
+            ierr = eulerAdvectionData->computePressure.function(fieldR, temperatureR, &pR, eulerAdvectionData->computePressure.context.get());
+            CHKERRQ(ierr);
         }
 
-        ierr = eulerAdvectionData->computeInternalEnergy.function(fieldR, temperatureR, &internalEnergyR, eulerAdvectionData->computeInternalEnergy.context.get());
-        CHKERRQ(ierr);
-        ierr = eulerAdvectionData->computeSpeedOfSound.function(fieldR, temperatureR, &aR, eulerAdvectionData->computeSpeedOfSound.context.get());
-        CHKERRQ(ierr);
-        ierr = eulerAdvectionData->computePressure.function(fieldR, temperatureR, &pR, eulerAdvectionData->computePressure.context.get());
-        CHKERRQ(ierr);
-    }
+        // get the face values
+        PetscReal massFlux;
+        const bool upwindLeft = eulerAdvectionData->fluxCalculatorFunction(
+                                    eulerAdvectionData->fluxCalculatorCtx, normalVelocityL, aL, densityL, pL, normalVelocityR, aR, densityR, pR, &massFlux, NULL) == fluxCalculator::LEFT;
 
-    // get the face values
-    PetscReal massFlux;
+        shared.face = fg;
+        shared.fieldL = fieldL;
+        shared.fieldR = fieldR;
+        shared.massFlux = massFlux;
+        shared.upwindLeft = upwindLeft;
+    }
 
-    if (eulerAdvectionData->fluxCalculatorFunction(eulerAdvectionData->fluxCalculatorCtx, normalVelocityL, aL, densityL, pL, normalVelocityR, aR, densityR, pR, &massFlux, NULL) ==
-        fluxCalculator::LEFT) {
+    if (shared.upwindLeft) {
+        const PetscReal densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
         // march over each gas species
         for (PetscInt ev = 0; ev < eulerAdvectionData->numberEV; ev++) {
             // Note: there is no density in the flux because uR and UL are density*yi
-            flux[ev] = (massFlux * fieldL[uOff[DENSITY_EV_FIELD] + ev] / densityL) * areaMag;
+            flux[ev] = (shared.massFlux * fieldL[uOff[DENSITY_EV_FIELD] + ev] / densityL) * areaMag;
         }
     } else {
+        const PetscReal densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
         // march over each gas species
         for (PetscInt ev = 0; ev < eulerAdvectionData->numberEV; ev++) {
             // Note: there is no density in the flux because uR and UL are density*yi
-            flux[ev] = (massFlux * fieldR[uOff[DENSITY_EV_FIELD] + ev] / densityR) * areaMag;
+            flux[ev] = (shared.massFlux * fieldR[uOff[DENSITY_EV_FIELD] + ev] / densityR) * areaMag;
         }
     }
 
@@ -184,9 +206,15 @@ PetscErrorCode ablate::finiteVolume::processes::EVTransport::DiffusionEVFlux(Pet
     // get the current density from euler
     const PetscReal density = field[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
 
-    // compute diff
-    PetscReal diff = 0.0;
-    flowParameters->diffFunction.function(field, &diff, flowParameters->diffFunction.context.get());
+    // compute diff, it is the same for every ev field so it is only computed if it was not computed for this face
+    auto &shared = sharedDiffusionValues;
+    if (flowParameters->computeSharedValues || shared.face != fg || shared.field != field) {
+        shared.diffusivity = 0.0;
+        PetscCall(flowParameters->diffFunction.function(field, &shared.diffusivity, flowParameters->diffFunction.context.get()));
+        shared.face = fg;
+        shared.field = field;
+    }
+    const PetscReal diff = shared.diffusivity;
 
     // species equations
     for (PetscInt ev = 0; ev < flowParameters->numberEV; ++ev) {
@@ -33,18 +33,40 @@ class EVTransport : public FlowProcess {
         /* store method used for flux calculator */
         ablate::finiteVolume::fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction;
         void* fluxCalculatorCtx;
+
+        /* true if this is the first ev field, it always computes the shared face values */
+        bool computeSharedValues;
     };
 
     struct DiffusionData {
         /* number of extra species */
         PetscInt numberEV;
 
+        /* true if this is the first ev field, it always computes the shared face values */
+        bool computeSharedValues;
+
         /* functions to compute diffusion */
         eos::ThermodynamicFunction diffFunction;
+    };
 
-        /* store a scratch space for speciesSpeciesSensibleEnthalpy */
-        std::vector<PetscReal> speciesSpeciesSensibleEnthalpy;
+    /**
+     * The mass flux and diffusivity are the same for every ev field.  They are computed by the first ev field for each face and reused by the remaining ev
+     * fields on the same face.  The values are stored per thread, so the flux functions remain thread safe.
+     */
+    struct SharedAdvectionValues {
+        const PetscFVFaceGeom* face = nullptr;
+        const PetscScalar* fieldL = nullptr;
+        const PetscScalar* fieldR = nullptr;
+        PetscReal massFlux = 0.0;
+        bool upwindLeft = true;
+    };
+    struct SharedDiffusionValues {
+        const PetscFVFaceGeom* face = nullptr;
+        const PetscScalar* field = nullptr;
+        PetscReal diffusivity = 0.0;
     };
+    inline static thread_local SharedAdvectionValues sharedAdvectionValues;
+    inline static thread_local SharedDiffusionValues sharedDiffusionValues;
 
     // Store an AdvectionData, diffusionData, and numberEV for each ev field
     std::vector<AdvectionData> advectionDatas;
@@ -4,7 +4,7 @@ ablate::finiteVolume::processes::Gravity::Gravity(std::vector<double> gravityVec
 
 void ablate::finiteVolume::processes::Gravity::Setup(ablate::finiteVolume::FiniteVolumeSolver &fv) {
     // add the source function
-    fv.RegisterRHSFunction(ComputeGravitySource, this, {CompressibleFlowFields::EULER_FIELD}, {CompressibleFlowFields::EULER_FIELD}, {});
+    fv.RegisterRHSFunction(ComputeGravitySource, this, {CompressibleFlowFields::EULER_FIELD}, {CompressibleFlowFields::EULER_FIELD}, {}, true);
 }
 
 PetscErrorCode ablate::finiteVolume::processes::Gravity::ComputeGravitySource(PetscInt dim, PetscReal time, const PetscFVCellGeom *cg, const PetscInt *uOff, const PetscScalar *u, const PetscInt *aOff,
@@ -0,0 +1,18 @@
+#include "implicitProcess.hpp"
+
+ablate::finiteVolume::processes::ImplicitProcess::ImplicitProcess(std::shared_ptr<Process> process) : process(std::move(process)) {
+    if (!this->process) {
+        throw std::invalid_argument("The ImplicitProcess requires a process");
+    }
+}
+
+void ablate::finiteVolume::processes::ImplicitProcess::Setup(ablate::finiteVolume::FiniteVolumeSolver &fv) {
+    fv.SetupImplicit([this, &fv]() { process->Setup(fv); });
+}
+
+void ablate::finiteVolume::processes::ImplicitProcess::Initialize(ablate::finiteVolume::FiniteVolumeSolver &fv) { process->Initialize(fv); }
+
+#include "registrar.hpp"
+REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::ImplicitProcess,
+         "integrates the continuous flux, point, and arbitrary rhs functions of the process implicitly (use with an imex ts and -snes_mf_operator)",
+         ARG(ablate::finiteVolume::processes::Process, "process", "the process to integrate implicitly"));
@@ -0,0 +1,25 @@
+#ifndef ABLATELIBRARY_IMPLICITPROCESS_HPP
+#define ABLATELIBRARY_IMPLICITPROCESS_HPP
+
+#include <memory>
+#include "process.hpp"
+
+namespace ablate::finiteVolume::processes {
+
+/**
+ * Wraps a process so that its continuous flux (e.g. diffusion), point (e.g. buoyancy), and arbitrary rhs functions are integrated implicitly by the ts while
+ * the remaining processes stay explicit.  This is intended for imex time steppers such as TSARKIMEX run with -snes_mf_operator.
+ */
+class ImplicitProcess : public Process {
+   private:
+    //! the process integrated implicitly
+    const std::shared_ptr<Process> process;
+
+   public:
+    explicit ImplicitProcess(std::shared_ptr<Process> process);
+    void Setup(ablate::finiteVolume::FiniteVolumeSolver& fv) override;
+    void Initialize(ablate::finiteVolume::FiniteVolumeSolver& fv) override;
+};
+
+}  // namespace ablate::finiteVolume::processes
+#endif  // ABLATELIBRARY_IMPLICITPROCESS_HPP
@@ -21,24 +21,22 @@ void ablate::finiteVolume::processes::LES::Setup(ablate::finiteVolume::FiniteVol
         throw std::invalid_argument("The ablate::finiteVolume::processes::LES expects the non-conserved form of tke field \"" + tkeField + "\".");
     }
 
-    // Register the euler/Energy LESdiffusion source term tke
-    flow.RegisterRHSFunction(LesEnergyFlux,
+    // Register the euler (momentum and energy) LESdiffusion source terms
+    flow.RegisterRHSFunction(SelectByDimension(flow.GetSubDomain().GetDimensions(), LesEulerFluxDim<1>, LesEulerFluxDim<2>, LesEulerFluxDim<3>),
                              nullptr,
                              CompressibleFlowFields::EULER_FIELD,
                              {CompressibleFlowFields::EULER_FIELD},
-                             {tkeField, CompressibleFlowFields::VELOCITY_FIELD, CompressibleFlowFields::TEMPERATURE_FIELD});
-
-    // Register the N_S LESdiffusion source terms
-    flow.RegisterRHSFunction(LesMomentumFlux, nullptr, CompressibleFlowFields::EULER_FIELD, {CompressibleFlowFields::EULER_FIELD}, {tkeField, CompressibleFlowFields::VELOCITY_FIELD});
+                             {tkeField, CompressibleFlowFields::VELOCITY_FIELD, CompressibleFlowFields::TEMPERATURE_FIELD},
+                             true);
 
     // Register the tke LESdiffusion source term
-    flow.RegisterRHSFunction(LesTkeFlux, nullptr, conservedFieldName, {CompressibleFlowFields::EULER_FIELD}, {tkeField, CompressibleFlowFields::VELOCITY_FIELD});
+    flow.RegisterRHSFunction(LesTkeFlux, nullptr, conservedFieldName, {CompressibleFlowFields::EULER_FIELD}, {tkeField, CompressibleFlowFields::VELOCITY_FIELD}, true);
 
     // Register the Species LESdiffusion source term
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::DENSITY_YI_FIELD)) {
         // the species are treated like any other transported ev
         auto& numberComponent = numberComponents.emplace_back(flow.GetSubDomain().GetField(CompressibleFlowFields::YI_FIELD).numberComponents);
-        flow.RegisterRHSFunction(LesEvFlux, &numberComponent, CompressibleFlowFields::DENSITY_YI_FIELD, {CompressibleFlowFields::EULER_FIELD}, {tkeField, CompressibleFlowFields::YI_FIELD});
+        flow.RegisterRHSFunction(LesEvFlux, &numberComponent, CompressibleFlowFields::DENSITY_YI_FIELD, {CompressibleFlowFields::EULER_FIELD}, {tkeField, CompressibleFlowFields::YI_FIELD}, true);
     }
 
     // March over any ev
@@ -48,31 +46,49 @@ void ablate::finiteVolume::processes::LES::Setup(ablate::finiteVolume::FiniteVol
 
         // the species are treated like any other transported ev
         auto& numberComponent = numberComponents.emplace_back(evConservedField.numberComponents);
-        flow.RegisterRHSFunction(LesEvFlux, &numberComponent, evConservedField.name, {CompressibleFlowFields::EULER_FIELD}, {tkeField, nonConservedEvName});
+        flow.RegisterRHSFunction(LesEvFlux, &numberComponent, evConservedField.name, {CompressibleFlowFields::EULER_FIELD}, {tkeField, nonConservedEvName}, true);
+    }
+}
+
+PetscErrorCode ablate::finiteVolume::processes::LES::LesEulerFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[],
+                                                                  const PetscScalar grad[], const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[],
+                                                                  PetscScalar flux[], void* ctx) {
+    PetscFunctionBeginUser;
+    switch (dim) {
+        case 1:
+            PetscCall(LesEulerFluxDim<1>(dim, fg, uOff, uOff_x, field, grad, aOff, aOff_x, aux, gradAux, flux, ctx));
+            break;
+        case 2:
+            PetscCall(LesEulerFluxDim<2>(dim, fg, uOff, uOff_x, field, grad, aOff, aOff_x, aux, gradAux, flux, ctx));
+            break;
+        case 3:
+            PetscCall(LesEulerFluxDim<3>(dim, fg, uOff, uOff_x, field, grad, aOff, aOff_x, aux, gradAux, flux, ctx));
+            break;
+        default:
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Unsupported dimension %" PetscInt_FMT, dim);
     }
+    PetscFunctionReturn(0);
 }
 
-PetscErrorCode ablate::finiteVolume::processes::LES::LesMomentumFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt* uOff, const PetscInt* uOff_x, const PetscScalar* field,
-                                                                     const PetscScalar* grad, const PetscInt* aOff, const PetscInt* aOff_x, const PetscScalar* aux, const PetscScalar* gradAux,
-                                                                     PetscScalar* flux, void* ctx) {
+template <PetscInt dim>
+PetscErrorCode ablate::finiteVolume::processes::LES::LesEulerFluxDim(PetscInt, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[],
+                                                                     const PetscScalar grad[], const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[],
+                                                                     PetscScalar flux[], void* ctx) {
     PetscFunctionBeginUser;
     const int euler = 0;
     const int TKE_FIELD = 0;
     const int VEL = 1;
+    const int T = 2;
 
-    for (PetscInt d = 0; d < dim; d++) {
-        flux[CompressibleFlowFields::RHOU + d] = 0.0;
-    }
-    PetscReal tau[9];
+    // the turbulent viscosity and les stress tensor are shared by the momentum and energy equations
     PetscReal muT;
-    PetscReal turbulence;
-
-    turbulence = aux[aOff[TKE_FIELD]];
-
+    PetscReal turbulence = aux[aOff[TKE_FIELD]];
     PetscCall(LesViscosity(dim, fg, field + uOff[euler], turbulence, muT));
-    // Compute the LES stress tensor tau
-    PetscCall(NavierStokesTransport::CompressibleFlowComputeStressTensor(dim, muT, gradAux + aOff_x[VEL], tau));
 
+    PetscReal tau[dim * dim];
+    NavierStokesTransport::CompressibleFlowComputeStressTensor<dim>(muT, gradAux + aOff_x[VEL], tau);
+
+    // momentum equation
     for (PetscInt c = 0; c < dim; ++c) {
         PetscReal lesViscousFlux = 0.0;
 
@@ -85,30 +101,8 @@ PetscErrorCode ablate::finiteVolume::processes::LES::LesMomentumFlux(PetscInt di
         flux[CompressibleFlowFields::RHOU + c] = lesViscousFlux;
     }
 
-    PetscFunctionReturn(0);
-}
-
-PetscErrorCode ablate::finiteVolume::processes::LES::LesEnergyFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[],
-                                                                   const PetscScalar grad[], const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[],
-                                                                   PetscScalar flux[], void* ctx) {
-    PetscFunctionBeginUser;
-    const int euler = 0;
-    const int TKE_FIELD = 0;
-    const int VEL = 1;
-    const int T = 2;
-
-    // set the fluxes to zero
+    // energy equation
     flux[CompressibleFlowFields::RHOE] = 0.0;
-
-    PetscReal tau[9];
-    PetscReal muT;
-
-    PetscReal turbulence = aux[aOff[TKE_FIELD]];
-
-    // Compute the les stress tensor LESTau
-    PetscCall(LesViscosity(dim, fg, field + uOff[euler], turbulence, muT));
-    PetscCall(NavierStokesTransport::CompressibleFlowComputeStressTensor(dim, muT, gradAux + aOff_x[VEL], tau));
-
     for (PetscInt d = 0; d < dim; ++d) {
         PetscReal lesHeatFlux = 0.0;
         // add in the contributions for this turbulence terms
@@ -124,8 +118,11 @@ PetscErrorCode ablate::finiteVolume::processes::LES::LesEnergyFlux(PetscInt dim,
         flux[CompressibleFlowFields::RHOE] += lesHeatFlux;
     }
 
+    // zero out the density flux
+    flux[CompressibleFlowFields::RHO] = 0.0;
     PetscFunctionReturn(0);
 }
+
 PetscErrorCode ablate::finiteVolume::processes::LES::LesTkeFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[],
                                                                 const PetscScalar grad[], const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[],
                                                                 PetscScalar flux[], void* ctx) {
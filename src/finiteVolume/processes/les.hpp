@@ -40,25 +40,15 @@ class LES : public FlowProcess {
 
    public:
     /**
-     * This computes the momentum source for SGS model for rhoU
-     * f = "euler"
-     * u = {"euler"}
-     * a = {"tke, "vel"}
-     * ctx = nullptr
-     * @return
-     */
-    static PetscErrorCode LesMomentumFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
-                                          const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void* ctx);
-    /**
-     * This computes the energy source for SGS model for rhoE
+     * This computes the momentum and energy source for SGS model for rhoU and rhoE.  The turbulent viscosity and stress tensor are computed once for both.
      * f = "euler"
      * u = {"euler"}
      * a = {"tke", "vel", "temperature"}
      * ctx = nullptr
      * @return
      */
-    static PetscErrorCode LesEnergyFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
-                                        const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void* ctx);
+    static PetscErrorCode LesEulerFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
+                                       const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void* ctx);
 
     /**
      * This computes the EV transfer for SGS model for density_tke
@@ -92,6 +82,14 @@ class LES : public FlowProcess {
      * @return
      */
     static PetscErrorCode LesViscosity(PetscInt dim, const PetscFVFaceGeom* fg, const PetscScalar* densityField, const PetscReal turbulence, PetscReal& mut);
+
+   private:
+    /**
+     * Dimension specialized version of LesEulerFlux, the dim argument is ignored
+     */
+    template <PetscInt dim>
+    static PetscErrorCode LesEulerFluxDim(PetscInt, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
+                                          const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void* ctx);
 };
 }  // namespace ablate::finiteVolume::processes
 
@@ -1,6 +1,8 @@
 #include "navierStokesTransport.hpp"
 
 #include <utility>
+#include "eos/perfectGas.hpp"
+#include "eos/stiffenedGas.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "finiteVolume/fluxCalculator/ausm.hpp"
 #include "utilities/mathUtilities.hpp"
@@ -29,10 +31,32 @@ ablate::finiteVolume::processes::NavierStokesTransport::NavierStokesTransport(co
 void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finiteVolume::FiniteVolumeSolver& flow) {
     // Register the euler source terms
     if (fluxCalculator) {
-        flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::EULER_FIELD, {CompressibleFlowFields::EULER_FIELD}, {});
+        // if the temperature aux field is available, use it as the initial guess for the temperature computation in the flux
+        std::vector<std::string> advectionAuxFields;
+        if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
+            advectionAuxFields.push_back(CompressibleFlowFields::TEMPERATURE_FIELD);
+            advectionData.computeTemperatureFromGuess = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+        }
+        // the perfect and stiffened gas thermodynamics are inlined into the flux, every other eos uses the generic eos functions
+        if (auto perfectGas = std::dynamic_pointer_cast<eos::PerfectGas>(eos)) {
+            advectionData.advectionEos = AdvectionEos::PerfectGas;
+            advectionData.gamma = perfectGas->GetSpecificHeatRatio();
+        } else if (auto stiffenedGas = std::dynamic_pointer_cast<eos::StiffenedGas>(eos)) {
+            advectionData.advectionEos = AdvectionEos::StiffenedGas;
+            advectionData.gamma = stiffenedGas->GetSpecificHeatRatio();
+            advectionData.p0 = stiffenedGas->GetReferencePressure();
+        }
+        // the inlined perfect and stiffened gas fluxes do not call the eos functions
+        flow.RegisterRHSFunction(SelectAdvectionFlux(flow.GetSubDomain().GetDimensions(), advectionData.advectionEos),
+                                 &advectionData,
+                                 CompressibleFlowFields::EULER_FIELD,
+                                 {CompressibleFlowFields::EULER_FIELD},
+                                 advectionAuxFields,
+                                 advectionData.advectionEos != AdvectionEos::Generic || eos->ThreadSafe());
 
         // PetscErrorCode PetscOptionsGetBool(PetscOptions options,const char pre[],const char name[],PetscBool *ivalue,PetscBool *set)
-        flow.RegisterComputeTimeStepFunction(ComputeTimeStep, &timeStepData, "cfl");
+        timeStepData.eulerId = flow.GetSubDomain().GetField(CompressibleFlowFields::EULER_FIELD).id;
+        flow.RegisterComputeTimeStepFunction(ComputeTimeStep, &timeStepData, "cfl", ComputeLocalTimeStep);
 
         advectionData.computeTemperature = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
         advectionData.computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, flow.GetSubDomain().GetFields());
@@ -48,11 +72,12 @@ void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finit
 
         if (diffusionData.muFunction.function || diffusionData.kFunction.function) {
             // Register the euler diffusion source terms
-            flow.RegisterRHSFunction(DiffusionFlux,
+            flow.RegisterRHSFunction(SelectByDimension(flow.GetSubDomain().GetDimensions(), DiffusionFluxDim<1>, DiffusionFluxDim<2>, DiffusionFluxDim<3>),
                                      &diffusionData,
                                      CompressibleFlowFields::EULER_FIELD,
                                      {CompressibleFlowFields::EULER_FIELD},
-                                     {CompressibleFlowFields::TEMPERATURE_FIELD, CompressibleFlowFields::VELOCITY_FIELD});
+                                     {CompressibleFlowFields::TEMPERATURE_FIELD, CompressibleFlowFields::VELOCITY_FIELD},
+                                     transportModel->ThreadSafe());
         }
     }
 
@@ -60,27 +85,101 @@ void ablate::finiteVolume::processes::NavierStokesTransport::Setup(ablate::finit
     if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::VELOCITY_FIELD)) {
         flow.RegisterAuxFieldUpdate(UpdateAuxVelocityField, nullptr, std::vector<std::string>{CompressibleFlowFields::VELOCITY_FIELD}, {CompressibleFlowFields::EULER_FIELD});
     }
-    if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD)) {
+    const bool temperatureAux = flow.GetSubDomain().ContainsField(CompressibleFlowFields::TEMPERATURE_FIELD);
+    const bool pressureAux = flow.GetSubDomain().ContainsField(CompressibleFlowFields::PRESSURE_FIELD);
+    if (temperatureAux && pressureAux) {
+        // compute the pressure from the updated temperature instead of solving for the temperature again
+        temperaturePressureData.computeTemperatureFunction = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+        temperaturePressureData.computePressureFunction = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
+        flow.RegisterAuxFieldUpdate(UpdateAuxTemperaturePressureField,
+                                    &temperaturePressureData,
+                                    std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD, CompressibleFlowFields::PRESSURE_FIELD},
+                                    {});
+    } else if (temperatureAux) {
         // set decode state functions
         computeTemperatureFunction = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
         // add in aux update variables
         flow.RegisterAuxFieldUpdate(UpdateAuxTemperatureField, &computeTemperatureFunction, std::vector<std::string>{CompressibleFlowFields::TEMPERATURE_FIELD}, {});
-    }
-
-    if (flow.GetSubDomain().ContainsField(CompressibleFlowFields::PRESSURE_FIELD)) {
+    } else if (pressureAux) {
         computePressureFunction = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
         flow.RegisterAuxFieldUpdate(UpdateAuxPressureField, &computePressureFunction, std::vector<std::string>{CompressibleFlowFields::PRESSURE_FIELD}, {});
     }
 }
 
+ablate::finiteVolume::processes::NavierStokesTransport::AdvectionFluxFunction ablate::finiteVolume::processes::NavierStokesTransport::SelectAdvectionFlux(PetscInt dim,
+                                                                                                                                                     AdvectionEos advectionEos) {
+    switch (advectionEos) {
+        case AdvectionEos::PerfectGas:
+            return SelectByDimension(dim, AdvectionFluxDim<1, AdvectionEos::PerfectGas>, AdvectionFluxDim<2, AdvectionEos::PerfectGas>, AdvectionFluxDim<3, AdvectionEos::PerfectGas>);
+        case AdvectionEos::StiffenedGas:
+            return SelectByDimension(
+                dim, AdvectionFluxDim<1, AdvectionEos::StiffenedGas>, AdvectionFluxDim<2, AdvectionEos::StiffenedGas>, AdvectionFluxDim<3, AdvectionEos::StiffenedGas>);
+        default:
+            return SelectByDimension(dim, AdvectionFluxDim<1, AdvectionEos::Generic>, AdvectionFluxDim<2, AdvectionEos::Generic>, AdvectionFluxDim<3, AdvectionEos::Generic>);
+    }
+}
+
 PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::AdvectionFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt* uOff, const PetscScalar* fieldL,
                                                                                      const PetscScalar* fieldR, const PetscInt* aOff, const PetscScalar* auxL, const PetscScalar* auxR,
                                                                                      PetscScalar* flux, void* ctx) {
     PetscFunctionBeginUser;
+    AdvectionFluxFunction advectionFlux;
+    try {
+        advectionFlux = SelectAdvectionFlux(dim, ((AdvectionData*)ctx)->advectionEos);
+    } catch (std::exception& exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "%s", exception.what());
+    }
+    PetscCall(advectionFlux(dim, fg, uOff, fieldL, fieldR, aOff, auxL, auxR, flux, ctx));
+    PetscFunctionReturn(0);
+}
 
-    auto eulerAdvectionData = (AdvectionData*)ctx;
-
+template <PetscInt dim, ablate::finiteVolume::processes::NavierStokesTransport::AdvectionEos advectionEos>
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::DecodeAdvectionState(const AdvectionData* advectionData, const PetscInt* uOff, const PetscScalar* field,
+                                                                                            const PetscInt* aOff, const PetscScalar* aux, const PetscReal* norm, PetscReal& density,
+                                                                                            PetscReal& normalVelocity, PetscReal* velocity, PetscReal& internalEnergy, PetscReal& a,
+                                                                                            PetscReal& p) {
+    PetscFunctionBeginUser;
     const int EULER_FIELD = 0;
+    density = field[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
+
+    // Get the velocity in this direction
+    normalVelocity = 0.0;
+    for (PetscInt d = 0; d < dim; d++) {
+        velocity[d] = field[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / density;
+        normalVelocity += velocity[d] * norm[d];
+    }
+
+    if constexpr (advectionEos == AdvectionEos::Generic) {
+        PetscReal temperature;
+        if (aux && advectionData->computeTemperatureFromGuess.function) {
+            PetscCall(advectionData->computeTemperatureFromGuess.function(field, TemperatureGuess(aux[aOff[0]]), &temperature, advectionData->computeTemperatureFromGuess.context.get()));
+        } else {
+            PetscCall(advectionData->computeTemperature.function(field, &temperature, advectionData->computeTemperature.context.get()));
+        }
+        PetscCall(advectionData->computeInternalEnergy.function(field, temperature, &internalEnergy, advectionData->computeInternalEnergy.context.get()));
+        PetscCall(advectionData->computeSpeedOfSound.function(field, temperature, &a, advectionData->computeSpeedOfSound.context.get()));
+        PetscCall(advectionData->computePressure.function(field, temperature, &p, advectionData->computePressure.context.get()));
+    } else {
+        // the perfect gas is a stiffened gas with a zero reference pressure, neither requires the temperature
+        const PetscReal p0 = advectionEos == AdvectionEos::StiffenedGas ? advectionData->p0 : 0.0;
+        PetscReal speedSquare = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            speedSquare += velocity[d] * velocity[d];
+        }
+        internalEnergy = field[uOff[EULER_FIELD] + CompressibleFlowFields::RHOE] / density - 0.5 * speedSquare;
+        p = (advectionData->gamma - 1.0) * density * internalEnergy - advectionData->gamma * p0;
+        a = PetscSqrtReal(advectionData->gamma * (p + p0) / density);
+    }
+    PetscFunctionReturn(0);
+}
+
+template <PetscInt dim, ablate::finiteVolume::processes::NavierStokesTransport::AdvectionEos advectionEos>
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::AdvectionFluxDim(PetscInt, const PetscFVFaceGeom* fg, const PetscInt* uOff, const PetscScalar* fieldL,
+                                                                                        const PetscScalar* fieldR, const PetscInt* aOff, const PetscScalar* auxL, const PetscScalar* auxR,
+                                                                                        PetscScalar* flux, void* ctx) {
+    PetscFunctionBeginUser;
+
+    auto eulerAdvectionData = (AdvectionData*)ctx;
 
     // Compute the norm
     PetscReal norm[3];
@@ -94,29 +193,7 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Advection
     PetscReal internalEnergyL;
     PetscReal aL;
     PetscReal pL;
-
-    // decode the left side
-    {
-        densityL = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureL;
-
-        PetscErrorCode ierr = eulerAdvectionData->computeTemperature.function(fieldL, &temperatureL, eulerAdvectionData->computeTemperature.context.get());
-        CHKERRQ(ierr);
-
-        // Get the velocity in this direction
-        normalVelocityL = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityL[d] = fieldL[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityL;
-            normalVelocityL += velocityL[d] * norm[d];
-        }
-
-        ierr = eulerAdvectionData->computeInternalEnergy.function(fieldL, temperatureL, &internalEnergyL, eulerAdvectionData->computeInternalEnergy.context.get());
-        CHKERRQ(ierr);
-        ierr = eulerAdvectionData->computeSpeedOfSound.function(fieldL, temperatureL, &aL, eulerAdvectionData->computeSpeedOfSound.context.get());
-        CHKERRQ(ierr);
-        ierr = eulerAdvectionData->computePressure.function(fieldL, temperatureL, &pL, eulerAdvectionData->computePressure.context.get());
-        CHKERRQ(ierr);
-    }
+    PetscCall(DecodeAdvectionState<dim, advectionEos>(eulerAdvectionData, uOff, fieldL, aOff, auxL, norm, densityL, normalVelocityL, velocityL, internalEnergyL, aL, pL));
 
     PetscReal densityR;
     PetscReal normalVelocityR;
@@ -124,28 +201,7 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Advection
     PetscReal internalEnergyR;
     PetscReal aR;
     PetscReal pR;
-
-    {  // decode right state
-        densityR = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHO];
-        PetscReal temperatureR;
-
-        PetscErrorCode ierr = eulerAdvectionData->computeTemperature.function(fieldR, &temperatureR, eulerAdvectionData->computeTemperature.context.get());
-        CHKERRQ(ierr);
-
-        // Get the velocity in this direction
-        normalVelocityR = 0.0;
-        for (PetscInt d = 0; d < dim; d++) {
-            velocityR[d] = fieldR[uOff[EULER_FIELD] + CompressibleFlowFields::RHOU + d] / densityR;
-            normalVelocityR += velocityR[d] * norm[d];
-        }
-
-        ierr = eulerAdvectionData->computeInternalEnergy.function(fieldR, temperatureR, &internalEnergyR, eulerAdvectionData->computeInternalEnergy.context.get());
-        CHKERRQ(ierr);
-        ierr = eulerAdvectionData->computeSpeedOfSound.function(fieldR, temperatureR, &aR, eulerAdvectionData->computeSpeedOfSound.context.get());
-        CHKERRQ(ierr);
-        ierr = eulerAdvectionData->computePressure.function(fieldR, temperatureR, &pR, eulerAdvectionData->computePressure.context.get());
-        CHKERRQ(ierr);
-    }
+    PetscCall(DecodeAdvectionState<dim, advectionEos>(eulerAdvectionData, uOff, fieldR, aOff, auxR, norm, densityR, normalVelocityR, velocityR, internalEnergyR, aR, pR));
 
     // get the face values
     PetscReal massFlux;
@@ -226,6 +282,16 @@ double ablate::finiteVolume::processes::NavierStokesTransport::ComputeTimeStep(T
         pgsAlpha = timeStepData->pgs->GetAlpha();
     }
 
+    // reuse the aux temperature from the last rhs evaluation as the guess so the eos temperature solve converges in a few iterations
+    DM auxDm = nullptr;
+    const PetscScalar* auxArray = nullptr;
+    PetscInt temperatureId = -1;
+    if (advectionData->computeTemperatureFromGuess.function) {
+        auxDm = flow.GetSubDomain().GetAuxDM();
+        temperatureId = flow.GetSubDomain().GetField(CompressibleFlowFields::TEMPERATURE_FIELD).id;
+        VecGetArrayRead(flow.GetSubDomain().GetAuxVector(), &auxArray) >> checkError;
+    }
+
     // March over each cell
     PetscReal dtMin = 1000.0;
     for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
@@ -241,7 +307,16 @@ double ablate::finiteVolume::processes::NavierStokesTransport::ComputeTimeStep(T
 
             // Get the speed of sound from the eos
             PetscReal temperature;
-            advectionData->computeTemperature.function(conserved, &temperature, advectionData->computeTemperature.context.get()) >> checkError;
+            const PetscScalar* auxTemperature = nullptr;
+            if (auxArray) {
+                DMPlexPointLocalFieldRead(auxDm, cell, temperatureId, auxArray, &auxTemperature) >> checkError;
+            }
+            if (auxTemperature) {
+                advectionData->computeTemperatureFromGuess.function(conserved, TemperatureGuess(*auxTemperature), &temperature, advectionData->computeTemperatureFromGuess.context.get()) >>
+                    checkError;
+            } else {
+                advectionData->computeTemperature.function(conserved, &temperature, advectionData->computeTemperature.context.get()) >> checkError;
+            }
             PetscReal a;
             advectionData->computeSpeedOfSound.function(conserved, temperature, &a, advectionData->computeSpeedOfSound.context.get()) >> checkError;
 
@@ -255,18 +330,69 @@ double ablate::finiteVolume::processes::NavierStokesTransport::ComputeTimeStep(T
         }
     }
     VecRestoreArrayRead(v, &x) >> checkError;
+    if (auxArray) {
+        VecRestoreArrayRead(flow.GetSubDomain().GetAuxVector(), &auxArray) >> checkError;
+    }
     flow.RestoreRange(cellRange);
     return dtMin;
 }
+
+PetscReal ablate::finiteVolume::processes::NavierStokesTransport::ComputeLocalTimeStep(PetscInt dim, const PetscFVCellGeom* cg, const PetscInt uOff[], const PetscScalar u[], void* ctx) {
+    auto timeStepData = (TimeStepData*)ctx;
+    auto advectionData = timeStepData->advectionData;
+    const PetscScalar* euler = u + uOff[timeStepData->eulerId];
+
+    // Get alpha if provided
+    PetscReal pgsAlpha = 1.0;
+    if (timeStepData->pgs) {
+        pgsAlpha = timeStepData->pgs->GetAlpha();
+    }
+
+    // use the cell size instead of the smallest cell in the domain
+    const PetscReal dx = PetscPowReal(cg->volume, 1.0 / (PetscReal)dim);
+
+    // Get the speed of sound from the eos
+    PetscReal rho = euler[CompressibleFlowFields::RHO];
+    PetscReal temperature;
+    advectionData->computeTemperature.function(u, &temperature, advectionData->computeTemperature.context.get()) >> checkError;
+    PetscReal a;
+    advectionData->computeSpeedOfSound.function(u, temperature, &a, advectionData->computeSpeedOfSound.context.get()) >> checkError;
+
+    PetscReal velSum = 0.0;
+    for (PetscInt d = 0; d < dim; d++) {
+        velSum += PetscAbsReal(euler[CompressibleFlowFields::RHOU + d]) / rho;
+    }
+    return advectionData->cfl * dx / (a / pgsAlpha + velSum);
+}
 PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::DiffusionFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[],
                                                                                      const PetscScalar grad[], const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[],
                                                                                      const PetscScalar gradAux[], PetscScalar flux[], void* ctx) {
     PetscFunctionBeginUser;
+    switch (dim) {
+        case 1:
+            PetscCall(DiffusionFluxDim<1>(dim, fg, uOff, uOff_x, field, grad, aOff, aOff_x, aux, gradAux, flux, ctx));
+            break;
+        case 2:
+            PetscCall(DiffusionFluxDim<2>(dim, fg, uOff, uOff_x, field, grad, aOff, aOff_x, aux, gradAux, flux, ctx));
+            break;
+        case 3:
+            PetscCall(DiffusionFluxDim<3>(dim, fg, uOff, uOff_x, field, grad, aOff, aOff_x, aux, gradAux, flux, ctx));
+            break;
+        default:
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Unsupported dimension %" PetscInt_FMT, dim);
+    }
+    PetscFunctionReturn(0);
+}
+
+template <PetscInt dim>
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::DiffusionFluxDim(PetscInt, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[],
+                                                                                        const PetscScalar grad[], const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[],
+                                                                                        const PetscScalar gradAux[], PetscScalar flux[], void* ctx) {
+    PetscFunctionBeginUser;
     // this order is based upon the order that they are passed into RegisterRHSFunction
     const int T = 0;
     const int VEL = 1;
 
-    PetscErrorCode ierr;
     auto flowParameters = (DiffusionData*)ctx;
 
     // Compute mu and k
@@ -276,9 +402,8 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Diffusion
     flowParameters->kFunction.function(field, aux[aOff[T]], &k, flowParameters->kFunction.context.get());
 
     // Compute the stress tensor tau
-    PetscReal tau[9];  // Maximum size without symmetry
-    ierr = CompressibleFlowComputeStressTensor(dim, mu, gradAux + aOff_x[VEL], tau);
-    CHKERRQ(ierr);
+    PetscReal tau[dim * dim];
+    CompressibleFlowComputeStressTensor<dim>(mu, gradAux + aOff_x[VEL], tau);
 
     // for each velocity component
     for (PetscInt c = 0; c < dim; ++c) {
@@ -318,24 +443,18 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::Diffusion
 
 PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::CompressibleFlowComputeStressTensor(PetscInt dim, PetscReal mu, const PetscReal* gradVel, PetscReal* tau) {
     PetscFunctionBeginUser;
-    // pre-compute the div of the velocity field
-    PetscReal divVel = 0.0;
-    for (PetscInt c = 0; c < dim; ++c) {
-        divVel += gradVel[c * dim + c];
-    }
-
-    // March over each velocity component, u, v, w
-    for (PetscInt c = 0; c < dim; ++c) {
-        // March over each physical coordinates
-        for (PetscInt d = 0; d < dim; ++d) {
-            if (d == c) {
-                // for the xx, yy, zz, components
-                tau[c * dim + d] = 2.0 * mu * ((gradVel[c * dim + d]) - divVel / 3.0);
-            } else {
-                // for xy, xz, etc
-                tau[c * dim + d] = mu * ((gradVel[c * dim + d]) + (gradVel[d * dim + c]));
-            }
-        }
+    switch (dim) {
+        case 1:
+            CompressibleFlowComputeStressTensor<1>(mu, gradVel, tau);
+            break;
+        case 2:
+            CompressibleFlowComputeStressTensor<2>(mu, gradVel, tau);
+            break;
+        case 3:
+            CompressibleFlowComputeStressTensor<3>(mu, gradVel, tau);
+            break;
+        default:
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "Unsupported dimension %" PetscInt_FMT, dim);
     }
     PetscFunctionReturn(0);
 }
@@ -374,6 +493,21 @@ PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAux
     PetscFunctionReturn(0);
 }
 
+// When used, you must request euler, then densityYi
+PetscErrorCode ablate::finiteVolume::processes::NavierStokesTransport::UpdateAuxTemperaturePressureField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[],
+                                                                                                         const PetscScalar* conservedValues, const PetscInt aOff[], PetscScalar* auxField,
+                                                                                                         void* ctx) {
+    PetscFunctionBeginUser;
+    auto temperaturePressureData = (TemperaturePressureData*)ctx;
+
+    // the previous temperature is used as the guess
+    PetscReal* temperature = auxField + aOff[0];
+    PetscCall(temperaturePressureData->computeTemperatureFunction.function(conservedValues, *temperature, temperature, temperaturePressureData->computeTemperatureFunction.context.get()));
+    PetscCall(temperaturePressureData->computePressureFunction.function(conservedValues, *temperature, auxField + aOff[1], temperaturePressureData->computePressureFunction.context.get()));
+
+    PetscFunctionReturn(0);
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::NavierStokesTransport, "build advection/diffusion for the euler field",
          OPT(ablate::parameters::Parameters, "parameters", "the parameters used by advection"), ARG(ablate::eos::EOS, "eos", "the equation of state used to describe the flow"),
@@ -11,6 +11,9 @@ namespace ablate::finiteVolume::processes {
 
 class NavierStokesTransport : public FlowProcess {
    public:
+    //! the equations of state with thermodynamics inlined into the advection flux, every other eos uses the generic eos functions
+    enum class AdvectionEos { Generic, PerfectGas, StiffenedGas };
+
     // Store ctx needed for static function advection function passed to PETSc
     struct AdvectionData {
         // flow CFL
@@ -21,6 +24,8 @@ class NavierStokesTransport : public FlowProcess {
 
         // EOS function calls
         eos::ThermodynamicFunction computeTemperature;
+        //! optional temperature function seeded with the aux temperature field, used when the aux values are passed to the flux
+        eos::ThermodynamicTemperatureFunction computeTemperatureFromGuess;
         eos::ThermodynamicTemperatureFunction computeInternalEnergy;
         eos::ThermodynamicTemperatureFunction computeSpeedOfSound;
         eos::ThermodynamicTemperatureFunction computePressure;
@@ -28,6 +33,11 @@ class NavierStokesTransport : public FlowProcess {
         /* store method used for flux calculator */
         ablate::finiteVolume::fluxCalculator::FluxCalculatorFunction fluxCalculatorFunction;
         void* fluxCalculatorCtx;
+
+        //! the eos inlined into the flux and its parameters, the reference pressure is only used by the stiffened gas
+        AdvectionEos advectionEos = AdvectionEos::Generic;
+        PetscReal gamma = 0.0;
+        PetscReal p0 = 0.0;
     };
 
     // Store ctx needed for static function diffusion function passed to PETSc
@@ -50,6 +60,13 @@ class NavierStokesTransport : public FlowProcess {
 
     eos::ThermodynamicFunction computePressureFunction;
 
+    // the functions used to update the temperature and pressure aux fields together
+    struct TemperaturePressureData {
+        eos::ThermodynamicTemperatureFunction computeTemperatureFunction;
+        eos::ThermodynamicTemperatureFunction computePressureFunction;
+    };
+    TemperaturePressureData temperaturePressureData;
+
     // Store the required ctx for time stepping
     struct TimeStepData {
         /* thermal conductivity*/
@@ -59,12 +76,59 @@ class NavierStokesTransport : public FlowProcess {
          * pressure gradient scaling
          */
         std::shared_ptr<ablate::finiteVolume::processes::PressureGradientScaling> pgs;
+
+        //! the euler field id used to index the uOff in the local time step
+        PetscInt eulerId = 0;
     };
     TimeStepData timeStepData;
 
     // static function to compute time step for euler advection
     static double ComputeTimeStep(TS ts, ablate::finiteVolume::FiniteVolumeSolver& flow, void* ctx);
 
+    // static function to compute the euler advection time step for a single cell, used for local time stepping
+    static PetscReal ComputeLocalTimeStep(PetscInt dim, const PetscFVCellGeom* cg, const PetscInt uOff[], const PetscScalar u[], void* ctx);
+
+    /**
+     * The aux temperature in ghost/boundary cells may not be set, so fall back to a reasonable guess when it is not physical
+     * @param auxTemperature
+     * @return
+     */
+    static inline PetscReal TemperatureGuess(PetscReal auxTemperature) { return PetscIsNormalReal(auxTemperature) && auxTemperature > 0.0 ? auxTemperature : 300.0; }
+
+    /**
+     * Decodes the density, velocity, internal energy, speed of sound, and pressure on one side of a face.  The perfect and stiffened gas thermodynamics are
+     * computed in place, otherwise the eos functions in the advection data are called.
+     */
+    template <PetscInt dim, AdvectionEos advectionEos>
+    static PetscErrorCode DecodeAdvectionState(const AdvectionData* advectionData, const PetscInt uOff[], const PetscScalar field[], const PetscInt aOff[], const PetscScalar aux[],
+                                               const PetscReal norm[], PetscReal& density, PetscReal& normalVelocity, PetscReal velocity[], PetscReal& internalEnergy, PetscReal& a,
+                                               PetscReal& p);
+
+    /**
+     * Dimension and eos specialized version of AdvectionFlux, the dim argument is ignored
+     */
+    template <PetscInt dim, AdvectionEos advectionEos>
+    static PetscErrorCode AdvectionFluxDim(PetscInt, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscScalar fieldL[], const PetscScalar fieldR[], const PetscInt aOff[],
+                                           const PetscScalar auxL[], const PetscScalar auxR[], PetscScalar* flux, void* ctx);
+
+    using AdvectionFluxFunction = PetscErrorCode (*)(PetscInt, const PetscFVFaceGeom*, const PetscInt[], const PetscScalar[], const PetscScalar[], const PetscInt[], const PetscScalar[],
+                                                     const PetscScalar[], PetscScalar*, void*);
+
+    /**
+     * Selects the dimension and eos specialized version of AdvectionFlux
+     * @param dim
+     * @param advectionEos
+     * @return
+     */
+    static AdvectionFluxFunction SelectAdvectionFlux(PetscInt dim, AdvectionEos advectionEos);
+
+    /**
+     * Dimension specialized version of DiffusionFlux, the dim argument is ignored
+     */
+    template <PetscInt dim>
+    static PetscErrorCode DiffusionFluxDim(PetscInt, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
+                                           const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void* ctx);
+
    public:
     /**
      * Function to compute the temperature field. This function assumes that the input values will be {"euler", "densityYi"}
@@ -83,6 +147,13 @@ class NavierStokesTransport : public FlowProcess {
     static PetscErrorCode UpdateAuxPressureField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* conservedValues, const PetscInt aOff[],
                                                  PetscScalar* auxField, void* ctx);
 
+    /**
+     * Function to compute the temperature and then the pressure from that temperature so the temperature is only computed once.  The aux fields must be
+     * {"temperature", "pressure"} and the ctx a TemperaturePressureData
+     */
+    static PetscErrorCode UpdateAuxTemperaturePressureField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* conservedValues,
+                                                            const PetscInt aOff[], PetscScalar* auxField, void* ctx);
+
     /**
      *
      * public constructor for euler advection
@@ -97,7 +168,7 @@ class NavierStokesTransport : public FlowProcess {
     void Setup(ablate::finiteVolume::FiniteVolumeSolver& flow) override;
 
     /**
-     * This Computes the Flow Euler flow for rho, rhoE, and rhoVel.
+     * This Computes the Flow Euler flow for rho, rhoE, and rhoVel.  The version specialized for the dimension and the advection eos in the ctx is called.
      * u = {"euler"} or {"euler", "densityYi"} if species are tracked
      * a = {}
      * ctx = FlowData_CompressibleFlow
@@ -126,6 +197,35 @@ class NavierStokesTransport : public FlowProcess {
      * @return
      */
     static PetscErrorCode CompressibleFlowComputeStressTensor(PetscInt dim, PetscReal mu, const PetscReal* gradVel, PetscReal* tau);
+
+    /**
+     * dimension specialized support function to compute the stress tensor
+     * @param mu
+     * @param gradVel
+     * @param tau
+     */
+    template <PetscInt dim>
+    static inline void CompressibleFlowComputeStressTensor(PetscReal mu, const PetscReal* gradVel, PetscReal* tau) {
+        // pre-compute the div of the velocity field
+        PetscReal divVel = 0.0;
+        for (PetscInt c = 0; c < dim; ++c) {
+            divVel += gradVel[c * dim + c];
+        }
+
+        // March over each velocity component, u, v, w
+        for (PetscInt c = 0; c < dim; ++c) {
+            // March over each physical coordinates
+            for (PetscInt d = 0; d < dim; ++d) {
+                if (d == c) {
+                    // for the xx, yy, zz, components
+                    tau[c * dim + d] = 2.0 * mu * ((gradVel[c * dim + d]) - divVel / 3.0);
+                } else {
+                    // for xy, xz, etc
+                    tau[c * dim + d] = mu * ((gradVel[c * dim + d]) + (gradVel[d * dim + c]));
+                }
+            }
+        }
+    }
 };
 
 }  // namespace ablate::finiteVolume::processes
@@ -0,0 +1,76 @@
+#include "particleCoupling.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::finiteVolume::processes::ParticleCoupling::ParticleCoupling(const std::shared_ptr<ablate::solver::Solver>& particleSolver)
+    : particleSolver(std::dynamic_pointer_cast<ablate::particles::ParticleSolver>(particleSolver)) {
+    if (!this->particleSolver) {
+        throw std::invalid_argument("ablate::finiteVolume::processes::ParticleCoupling requires an ablate::particles::ParticleSolver");
+    }
+}
+
+ablate::finiteVolume::processes::ParticleCoupling::~ParticleCoupling() {
+    if (localSource) {
+        VecDestroy(&localSource) >> checkError;
+    }
+}
+
+void ablate::finiteVolume::processes::ParticleCoupling::Setup(ablate::finiteVolume::FiniteVolumeSolver& flow) {
+    // Before each step, deposit the particle source from the current particle and flow state
+    flow.RegisterPreStep([this](TS ts, ablate::solver::Solver& solver) { DepositParticleSource(ts, solver) >> checkError; });
+
+    // Add the deposited source to each rhs evaluation
+    flow.RegisterRHSFunction(AddParticleSource, this);
+}
+
+void ablate::finiteVolume::processes::ParticleCoupling::Initialize(ablate::finiteVolume::FiniteVolumeSolver& flow) {
+    DM dm = flow.GetSubDomain().GetDM();
+    if (particleSolver->GetSubDomain().GetDM() != dm) {
+        throw std::invalid_argument("ablate::finiteVolume::processes::ParticleCoupling requires the particle solver " + particleSolver->GetSolverId() + " to share the mesh with the flow " +
+                                    flow.GetSolverId());
+    }
+
+    // this may be called again if the mesh changes
+    if (localSource) {
+        VecDestroy(&localSource) >> checkError;
+    }
+    DMCreateLocalVector(dm, &localSource) >> checkError;
+    VecZeroEntries(localSource) >> checkError;
+
+    // compute the volume of every local cell
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+    cellVolumes.resize(cEnd - cStart);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        DMPlexComputeCellGeometryFVM(dm, c, &cellVolumes[c - cStart], nullptr, nullptr) >> checkError;
+    }
+}
+
+PetscErrorCode ablate::finiteVolume::processes::ParticleCoupling::DepositParticleSource(TS flowTs, ablate::solver::Solver& flow) {
+    PetscFunctionBegin;
+    PetscReal time;
+    PetscCall(TSGetTime(flowTs, &time));
+
+    PetscCall(VecZeroEntries(localSource));
+    try {
+        const auto& eulerField = flow.GetSubDomain().GetField(CompressibleFlowFields::EULER_FIELD);
+        particleSolver->DepositEulerianSource(time, flow.GetSubDomain().GetDM(), eulerField.id, cellVolumes, localSource);
+    } catch (std::exception& exception) {
+        SETERRQ(PetscObjectComm((PetscObject)flowTs), PETSC_ERR_LIB, "%s", exception.what());
+    }
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::finiteVolume::processes::ParticleCoupling::AddParticleSource(const FiniteVolumeSolver&, DM, PetscReal, Vec, Vec locFVec, void* ctx) {
+    PetscFunctionBegin;
+    auto process = (ablate::finiteVolume::processes::ParticleCoupling*)ctx;
+
+    // the ghost cell contributions are summed when the local rhs is added to the global rhs
+    PetscCall(VecAXPY(locFVec, 1.0, process->localSource));
+    PetscFunctionReturn(0);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::ParticleCoupling,
+         "two-way coupling that adds the mass, energy, and momentum source from each particle to the flow",
+         ARG(ablate::solver::Solver, "particles", "the particle solver coupled to the flow, this should be a yaml anchor to a solver registered with the time stepper"));
@@ -0,0 +1,68 @@
+#ifndef ABLATELIBRARY_FINITEVOLUME_PARTICLECOUPLING_HPP
+#define ABLATELIBRARY_FINITEVOLUME_PARTICLECOUPLING_HPP
+
+#include <memory>
+#include <vector>
+#include "particles/particleSolver.hpp"
+#include "process.hpp"
+
+namespace ablate::finiteVolume::processes {
+
+/**
+ * Two-way coupling between a particle solver and the flow.  Before each flow step the mass, energy, and momentum source of every particle is deposited into a local source vector
+ * that is added to the euler field in each rhs evaluation.  The particle solver must share the mesh with the flow (i.e. be registered with a yaml anchor to the same solver).
+ */
+class ParticleCoupling : public Process {
+   private:
+    //! the particle solver that computes the source from each particle
+    const std::shared_ptr<ablate::particles::ParticleSolver> particleSolver;
+
+    //! the volume of each cell offset by the cStart
+    std::vector<PetscReal> cellVolumes;
+
+    //! the deposited particle source for the current flow step
+    Vec localSource = nullptr;
+
+    /**
+     * Deposit the particle source for the upcoming flow step.  This is called by every rank.
+     * @param flowTs
+     * @param flow
+     * @return
+     */
+    PetscErrorCode DepositParticleSource(TS flowTs, ablate::solver::Solver& flow);
+
+    /**
+     * static function to add the deposited particle source to the flow rhs
+     * @param solver
+     * @param dm
+     * @param time
+     * @param locX
+     * @param locFVec
+     * @param ctx
+     * @return
+     */
+    static PetscErrorCode AddParticleSource(const FiniteVolumeSolver& solver, DM dm, PetscReal time, Vec locX, Vec locFVec, void* ctx);
+
+   public:
+    /**
+     * @param particleSolver the particle solver coupled to this flow, this must be an ablate::particles::ParticleSolver
+     */
+    explicit ParticleCoupling(const std::shared_ptr<ablate::solver::Solver>& particleSolver);
+
+    ~ParticleCoupling() override;
+
+    /**
+     * Register the deposition and the rhs function
+     * @param flow
+     */
+    void Setup(ablate::finiteVolume::FiniteVolumeSolver& flow) override;
+
+    /**
+     * Size the source vector and compute the cell volumes
+     * @param flow
+     */
+    void Initialize(ablate::finiteVolume::FiniteVolumeSolver& flow) override;
+};
+
+}  // namespace ablate::finiteVolume::processes
+#endif  // ABLATELIBRARY_FINITEVOLUME_PARTICLECOUPLING_HPP
@@ -2,7 +2,7 @@
 #include <utility>
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "finiteVolume/processes/flowProcess.hpp"
-#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
 
 ablate::finiteVolume::processes::PressureGradientScaling::PressureGradientScaling(std::shared_ptr<eos::EOS> eos, double alphaInit, double domainLength, double maxAlphaAllowedIn,
                                                                                   double maxDeltaPressureFacIn, std::shared_ptr<ablate::monitors::logs::Log> log)
@@ -15,144 +15,103 @@ ablate::finiteVolume::processes::PressureGradientScaling::PressureGradientScalin
 
 PetscErrorCode ablate::finiteVolume::processes::PressureGradientScaling::UpdatePreconditioner(TS flowTs, ablate::solver::Solver &flow) {
     PetscFunctionBeginUser;
+    try {
+        solver::GlobalDiagnostics diagnostics;
+        RegisterDiagnostics(diagnostics);
+        diagnostics.Compute(flowTs, flow);
+    } catch (std::exception &exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+    }
+    PetscFunctionReturn(0);
+}
 
-    // Compute global maximum valuesfluxCalculator
-    PetscReal pAvgLocal = 0.e+0;
-    PetscReal pMinLocal = PETSC_MAX_REAL;
-    PetscReal pMaxLocal = 0.e+0;
-    PetscReal cMaxLocal = 0.e+0;
-    PetscReal machMaxLocal = 0.e+0;
-    PetscReal alphaMaxLocal = PETSC_MAX_REAL;
-
-    PetscInt countLocal = 0;
-
-    // get access to the underlying data for the flow
-    const auto &flowEulerId = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::EULER_FIELD);
-    PetscInt dim = flow.GetSubDomain().GetDimensions();
-
-    // get the flowSolution from the ts
-    Vec globFlowVec = flow.GetSubDomain().GetSolutionVector();
-    const PetscScalar *flowArray;
-    PetscErrorCode ierr = VecGetArrayRead(globFlowVec, &flowArray);
-    CHKERRQ(ierr);
-
-    // Get the valid cell range over this region
-    solver::Range cellRange;
-    flow.GetCellRange(cellRange);
-
-    // get decode state function/context
-    eos::ThermodynamicFunction computeTemperature = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
-    eos::ThermodynamicTemperatureFunction computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, flow.GetSubDomain().GetFields());
-    eos::ThermodynamicTemperatureFunction computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
-    eos::ThermodynamicTemperatureFunction computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
-
-    // check for ghost nodes
-    // check to see if there is a ghost label
-    auto dm = flow.GetSubDomain().GetDM();
-    DMLabel ghostLabel;
-    DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
-
-    // March over each cell
-    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
-        // if there is a cell array, use it, otherwise it is just c
-        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
-
-        PetscBool boundary;
-        PetscInt ghost = -1;
-        if (ghostLabel) {
-            DMLabelGetValue(ghostLabel, cell, &ghost);
-        }
-        DMIsBoundaryPoint(dm, cell, &boundary);
-        PetscInt numChildren;
-        DMPlexGetTreeChildren(dm, cell, &numChildren, nullptr);
-        if (ghost >= 0 || boundary || numChildren) {
-            continue;
-        }
-
-        // Get the current state variables for this cell
-        const PetscScalar *conserved = nullptr;
-        ierr = DMPlexPointGlobalRead(flow.GetSubDomain().GetDM(), cell, flowArray, &conserved);
-        CHKERRQ(ierr);
-
-        // If valid cell
-        if (conserved) {
-            // Extract values
-            PetscReal a;
-            PetscReal mach;
-            PetscReal p;
+void ablate::finiteVolume::processes::PressureGradientScaling::RegisterDiagnostics(solver::GlobalDiagnostics &diagnostics) {
+    // sum: pressure, count; max: pressure, speed of sound, mach; min: pressure, alpha
+    auto beginFunction = [this](solver::Solver &flow) -> solver::GlobalDiagnostics::CellFunction {
+        // get access to the underlying data for the flow
+        const auto eulerOffset = flow.GetSubDomain().GetField(finiteVolume::CompressibleFlowFields::EULER_FIELD).offset;
+        const PetscInt dim = flow.GetSubDomain().GetDimensions();
+
+        // get decode state function/context
+        auto computeTemperature = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
+        auto computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
+        auto computePressure = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::Pressure, flow.GetSubDomain().GetFields());
+
+        // check for ghost nodes
+        // check to see if there is a ghost label
+        auto dm = flow.GetSubDomain().GetDM();
+        DMLabel ghostLabel;
+        DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
+
+        return [=](PetscInt cell, const PetscScalar *conserved, PetscReal sum[], PetscReal max[], PetscReal min[]) {
+            PetscBool boundary;
+            PetscInt ghost = -1;
+            if (ghostLabel) {
+                DMLabelGetValue(ghostLabel, cell, &ghost) >> checkError;
+            }
+            DMIsBoundaryPoint(dm, cell, &boundary) >> checkError;
+            PetscInt numChildren;
+            DMPlexGetTreeChildren(dm, cell, &numChildren, nullptr) >> checkError;
+            if (ghost >= 0 || boundary || numChildren) {
+                return;
+            }
 
             // Decode the state to compute
-            PetscReal temperature;
-            ierr = computeTemperature.function(conserved, &temperature, computeTemperature.context.get());
-            CHKERRQ(ierr);
-            ierr = computePressure.function(conserved, temperature, &p, computePressure.context.get());
-            CHKERRQ(ierr);
-            ierr = computeSpeedOfSound.function(conserved, temperature, &a, computeSpeedOfSound.context.get());
-            CHKERRQ(ierr);
-
-            PetscReal density = conserved[flowEulerId.offset + CompressibleFlowFields::RHO];
+            PetscReal temperature, p, a;
+            computeTemperature.function(conserved, &temperature, computeTemperature.context.get()) >> checkError;
+            computePressure.function(conserved, temperature, &p, computePressure.context.get()) >> checkError;
+            computeSpeedOfSound.function(conserved, temperature, &a, computeSpeedOfSound.context.get()) >> checkError;
+
+            PetscReal density = conserved[eulerOffset + CompressibleFlowFields::RHO];
             PetscReal velMag = 0.0;
             for (PetscInt d = 0; d < dim; d++) {
-                velMag += PetscSqr(conserved[flowEulerId.offset + CompressibleFlowFields::RHOU + d] / density);
+                velMag += PetscSqr(conserved[eulerOffset + CompressibleFlowFields::RHOU + d] / density);
             }
-            mach = PetscSqrtReal(velMag) / a;
+            PetscReal mach = PetscSqrtReal(velMag) / a;
 
             // Store the max/min values
-            countLocal++;
-            pAvgLocal += p;
-            pMinLocal = PetscMin(pMinLocal, p);
-            pMaxLocal = PetscMax(pMaxLocal, p);
-            cMaxLocal = PetscMax(cMaxLocal, a);
-            machMaxLocal = PetscMax(machMaxLocal, mach);
-            alphaMaxLocal = PetscMin(alphaMaxLocal, maxMachAllowed / mach);
+            sum[0] += p;
+            sum[1] += 1.0;
+            max[0] = PetscMax(max[0], p);
+            max[1] = PetscMax(max[1], a);
+            max[2] = PetscMax(max[2], mach);
+            min[0] = PetscMin(min[0], p);
+            min[1] = PetscMin(min[1], maxMachAllowed / mach);
+        };
+    };
+
+    auto resultFunction = [this](TS flowTs, const PetscReal sum[], const PetscReal max[], const PetscReal min[]) {
+        PetscReal alphaMax = min[1];
+        PetscReal cMax = max[1];
+        PetscReal pRef = sum[0] / sum[1];
+        PetscReal maxDeltaP = PetscMax(PetscAbsReal(max[0] - pRef), PetscAbsReal(min[0] - pRef));
+        maxMach = max[2];
+
+        // Get the current timeStep from TS
+        PetscReal dt;
+        TSGetTimeStep(flowTs, &dt) >> checkError;
+
+        // Update alpha
+        PetscReal alphaOld = alpha;
+        PetscReal term1 = 0.5e+0 * dt * cMax / domainLength;
+        alpha = (alpha + term1 * (PetscSqrtReal(maxDeltaPressureFac * pRef / (maxDeltaP + 1E-30)) - 1.0));
+        alpha = PetscMin(alpha, (1. + maxAlphaChange) * alphaOld);  // avoid alpha jumping up to quickly if maxdelPfac=0
+        alpha = PetscMin(alpha, alphaMax);
+        alpha = PetscMin(alpha, maxAlphaAllowed);
+        alpha = PetscMax(alpha, 1.e+0);
+
+        // Update log
+        if (log) {
+            log->Printf("PGS: %g (alpha), %g (maxMach),  %g (maxMach'), %g (maxDeltaP)\n", alpha, maxMach, alpha * maxMach, maxDeltaP);
         }
-    }
+    };
 
-    // return the cell range
-    flow.RestoreRange(cellRange);
-
-    // Take the global values
-    auto comm = flow.GetSubDomain().GetComm();
-    PetscReal sumValues[2] = {pAvgLocal, (PetscReal)countLocal};
-    ierr = MPIU_Allreduce(MPI_IN_PLACE, sumValues, 2, MPIU_REAL, MPIU_SUM, comm);
-    CHKERRMPI(ierr);
-    PetscReal maxValues[3] = {pMaxLocal, cMaxLocal, machMaxLocal};
-    ierr = MPIU_Allreduce(MPI_IN_PLACE, maxValues, 3, MPIU_REAL, MPIU_MAX, comm);
-    CHKERRMPI(ierr);
-    PetscReal minValues[2] = {pMinLocal, alphaMaxLocal};
-    ierr = MPIU_Allreduce(MPI_IN_PLACE, minValues, 2, MPIU_REAL, MPIU_MIN, comm);
-    CHKERRMPI(ierr);
-
-    PetscReal alphaMax = minValues[1];
-    PetscReal cMax = maxValues[1];
-    PetscReal pRef = sumValues[0] / (sumValues[1]);
-    PetscReal maxDeltaP = PetscMax(PetscAbsReal(maxValues[0] - pRef), PetscAbsReal(minValues[0] - pRef));
-    maxMach = maxValues[2];
-
-    // Get the current timeStep from TS
-    PetscReal dt;
-    ierr = TSGetTimeStep(flowTs, &dt);
-    CHKERRQ(ierr);
-
-    // Update alpha
-    PetscReal alphaOld = alpha;
-    PetscReal term1 = 0.5e+0 * dt * cMax / domainLength;
-    alpha = (alpha + term1 * (PetscSqrtReal(maxDeltaPressureFac * pRef / (maxDeltaP + 1E-30)) - 1.0));
-    alpha = PetscMin(alpha, (1. + maxAlphaChange) * alphaOld);  // avoid alpha jumping up to quickly if maxdelPfac=0
-    alpha = PetscMin(alpha, alphaMax);
-    alpha = PetscMin(alpha, maxAlphaAllowed);
-    alpha = PetscMax(alpha, 1.e+0);
-
-    // Update log
-    if (log) {
-        log->Printf("PGS: %g (alpha), %g (maxMach),  %g (maxMach'), %g (maxDeltaP)\n", alpha, maxMach, alpha * maxMach, maxDeltaP);
-    }
-    PetscFunctionReturn(0);
+    diagnostics.Register(2, 3, 2, beginFunction, resultFunction);
 }
 
 void ablate::finiteVolume::processes::PressureGradientScaling::Setup(ablate::finiteVolume::FiniteVolumeSolver &fv) {
-    auto preStep = std::bind(&ablate::finiteVolume::processes::PressureGradientScaling::UpdatePreconditioner, this, std::placeholders::_1, std::placeholders::_2);
-    fv.RegisterPreStep(preStep);
+    // compute the reference values in the solver's shared pass before each step
+    RegisterDiagnostics(fv.GetGlobalDiagnostics());
 
     // initialize the log if provided
     if (log) {
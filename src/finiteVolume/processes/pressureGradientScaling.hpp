@@ -62,12 +62,19 @@ class PressureGradientScaling : public FlowProcess, public io::Serializable {
     PetscReal maxMach = 0.0;
     PetscReal alpha;
 
+    /**
+     * Register the pressure and mach number reductions and the alpha update with the diagnostics
+     * @param diagnostics
+     */
+    void RegisterDiagnostics(solver::GlobalDiagnostics& diagnostics);
+
    public:
     PressureGradientScaling(std::shared_ptr<eos::EOS> eos, double alphaInit, double domainLength, double maxAlphaAllowed = {}, double maxDeltaPressureFac = {},
                             std::shared_ptr<ablate::monitors::logs::Log> = {});
 
     /**
-     * function to compute the average density in the domain
+     * function to compute the pressure and mach number in the domain and update alpha.  When setup with a FiniteVolumeSolver this is computed with the
+     * solver's global diagnostics instead.
      * @param flowTs
      * @param flow
      * @return
@@ -2,6 +2,8 @@
 #define ABLATELIBRARY_FINITEVOLUME_PROCESS_HPP
 
 #include <finiteVolume/finiteVolumeSolver.hpp>
+#include <stdexcept>
+#include <string>
 namespace ablate::finiteVolume::processes {
 
 class Process {
@@ -17,6 +19,33 @@ class Process {
      * @param fv
      */
     virtual void Initialize(ablate::finiteVolume::FiniteVolumeSolver& fv){};
+
+    /**
+     * Add any memory held by the process (i.e. chemistry views or radiation rays) to the memory usage
+     * @param memoryUsage
+     * @param prefix prepended to each entry name
+     */
+    virtual void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const {}
+
+   protected:
+    /**
+     * Selects the dimension specialized version of a function so the dispatch happens once at setup
+     * @param dim the dimension of the domain
+     * @return the function specialized for dim
+     */
+    template <class Function>
+    static Function SelectByDimension(PetscInt dim, Function function1D, Function function2D, Function function3D) {
+        switch (dim) {
+            case 1:
+                return function1D;
+            case 2:
+                return function2D;
+            case 3:
+                return function3D;
+            default:
+                throw std::invalid_argument("Unsupported dimension " + std::to_string(dim));
+        }
+    }
 };
 
 }  // namespace ablate::finiteVolume::processes
@@ -1,10 +1,12 @@
 #include "speciesTransport.hpp"
+#include <algorithm>
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "utilities/mathUtilities.hpp"
 
 ablate::finiteVolume::processes::SpeciesTransport::SpeciesTransport(std::shared_ptr<eos::EOS> eosIn, std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalcIn,
-                                                                    std::shared_ptr<eos::transport::TransportModel> transportModelIn)
-    : fluxCalculator(std::move(fluxCalcIn)), eos(std::move(eosIn)), transportModel(std::move(transportModelIn)), advectionData() {
+                                                                    std::shared_ptr<eos::transport::TransportModel> transportModelIn, bool diffusionCorrection,
+                                                                    bool normalizeInAuxUpdate)
+    : fluxCalculator(std::move(fluxCalcIn)), eos(std::move(eosIn)), transportModel(std::move(transportModelIn)), advectionData(), normalizeInAuxUpdate(normalizeInAuxUpdate) {
     if (fluxCalculator) {
         // set the decode state function
         advectionData.numberSpecies = (PetscInt)eos->GetSpecies().size();
@@ -17,7 +19,7 @@ ablate::finiteVolume::processes::SpeciesTransport::SpeciesTransport(std::shared_
     if (transportModel) {
         // set the eos functions
         diffusionData.numberSpecies = (PetscInt)eos->GetSpecies().size();
-        diffusionData.speciesSpeciesSensibleEnthalpy.resize(eos->GetSpecies().size());
+        diffusionData.diffusionCorrection = diffusionCorrection;
     }
 
     numberSpecies = (PetscInt)eos->GetSpecies().size();
@@ -26,7 +28,12 @@ ablate::finiteVolume::processes::SpeciesTransport::SpeciesTransport(std::shared_
 void ablate::finiteVolume::processes::SpeciesTransport::Setup(ablate::finiteVolume::FiniteVolumeSolver &flow) {
     if (!eos->GetSpeciesVariables().empty()) {
         if (fluxCalculator) {
-            flow.RegisterRHSFunction(AdvectionFlux, &advectionData, CompressibleFlowFields::DENSITY_YI_FIELD, {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD}, {});
+            flow.RegisterRHSFunction(SelectByDimension(flow.GetSubDomain().GetDimensions(), AdvectionFlux<1>, AdvectionFlux<2>, AdvectionFlux<3>),
+                                     &advectionData,
+                                     CompressibleFlowFields::DENSITY_YI_FIELD,
+                                     {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD},
+                                     {},
+                                     eos->ThreadSafe());
             advectionData.computeTemperature = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
             advectionData.computeInternalEnergy = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::InternalSensibleEnergy, flow.GetSubDomain().GetFields());
             advectionData.computeSpeedOfSound = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeedOfSound, flow.GetSubDomain().GetFields());
@@ -35,28 +42,43 @@ void ablate::finiteVolume::processes::SpeciesTransport::Setup(ablate::finiteVolu
 
         if (transportModel) {
             diffusionData.diffFunction = transportModel->GetTransportTemperatureFunction(eos::transport::TransportProperty::Diffusivity, flow.GetSubDomain().GetFields());
-            if (diffusionData.diffFunction.function) {
-                flow.RegisterRHSFunction(DiffusionEnergyFlux,
+            diffusionData.speciesDiffFunction = transportModel->GetSpeciesDiffusivityTemperatureFunction(flow.GetSubDomain().GetFields());
+            if (diffusionData.diffFunction.function || diffusionData.speciesDiffFunction.function) {
+                // the scratch is per thread, so the diffusion is thread safe when the eos and transport functions are
+                const bool threadSafe = eos->ThreadSafe() && transportModel->ThreadSafe();
+                flow.RegisterRHSFunction(SelectByDimension(flow.GetSubDomain().GetDimensions(), DiffusionEnergyFlux<1>, DiffusionEnergyFlux<2>, DiffusionEnergyFlux<3>),
                                          &diffusionData,
                                          CompressibleFlowFields::EULER_FIELD,
                                          {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD},
-                                         {CompressibleFlowFields::YI_FIELD});
-                flow.RegisterRHSFunction(DiffusionSpeciesFlux,
+                                         {CompressibleFlowFields::YI_FIELD},
+                                         threadSafe);
+                flow.RegisterRHSFunction(SelectByDimension(flow.GetSubDomain().GetDimensions(), DiffusionSpeciesFlux<1>, DiffusionSpeciesFlux<2>, DiffusionSpeciesFlux<3>),
                                          &diffusionData,
                                          CompressibleFlowFields::DENSITY_YI_FIELD,
                                          {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD},
-                                         {CompressibleFlowFields::YI_FIELD});
+                                         {CompressibleFlowFields::YI_FIELD},
+                                         threadSafe);
 
                 diffusionData.computeTemperatureFunction = eos->GetThermodynamicFunction(eos::ThermodynamicProperty::Temperature, flow.GetSubDomain().GetFields());
                 diffusionData.computeSpeciesSensibleEnthalpyFunction = eos->GetThermodynamicTemperatureFunction(eos::ThermodynamicProperty::SpeciesSensibleEnthalpy, flow.GetSubDomain().GetFields());
             }
         }
 
-        flow.RegisterAuxFieldUpdate(
-            UpdateAuxMassFractionField, &numberSpecies, std::vector<std::string>{CompressibleFlowFields::YI_FIELD}, {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD});
-
-        // clean up the species
-        flow.RegisterPostEvaluate(NormalizeSpecies);
+        if (normalizeInAuxUpdate) {
+            // clean up the species while computing the mass fractions, saving a sweep of the solution after each step
+            flow.RegisterAuxFieldUpdate(UpdateAuxNormalizedMassFractionField,
+                                        &numberSpecies,
+                                        std::vector<std::string>{CompressibleFlowFields::YI_FIELD},
+                                        {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD});
+        } else {
+            flow.RegisterAuxFieldUpdate(UpdateAuxMassFractionField,
+                                        &numberSpecies,
+                                        std::vector<std::string>{CompressibleFlowFields::YI_FIELD},
+                                        {CompressibleFlowFields::EULER_FIELD, CompressibleFlowFields::DENSITY_YI_FIELD});
+
+            // clean up the species
+            flow.RegisterPostEvaluate(NormalizeSpecies);
+        }
     }
 }
 
@@ -74,7 +96,85 @@ PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::UpdateAuxMassF
     PetscFunctionReturn(0);
 }
 
-PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::DiffusionEnergyFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt uOff[], const PetscInt uOff_x[],
+PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::UpdateAuxNormalizedMassFractionField(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[],
+                                                                                                       const PetscScalar *conservedValues, const PetscInt aOff[], PetscScalar *auxField, void *ctx) {
+    PetscFunctionBeginUser;
+    PetscReal density = conservedValues[uOff[0] + CompressibleFlowFields::RHO];
+
+    auto numberSpecies = *(PetscInt *)ctx;
+    if (numberSpecies < 1) {
+        PetscFunctionReturn(0);
+    }
+
+    // limit the bounds of all but the last species
+    PetscScalar *yi = auxField + aOff[0];
+    PetscScalar yiSum = 0.0;
+    for (PetscInt sp = 0; sp < numberSpecies - 1; sp++) {
+        yi[sp] = PetscMin(1.0, PetscMax(0.0, conservedValues[uOff[1] + sp] / density));
+        yiSum += yi[sp];
+    }
+
+    // the last species is the balance, the same as NormalizeSpecies
+    if (yiSum > 1.0) {
+        for (PetscInt sp = 0; sp < numberSpecies - 1; sp++) {
+            yi[sp] /= yiSum;
+        }
+        yi[numberSpecies - 1] = 0.0;
+    } else {
+        yi[numberSpecies - 1] = 1.0 - yiSum;
+    }
+
+    PetscFunctionReturn(0);
+}
+
+ablate::finiteVolume::processes::SpeciesTransport::DiffusionScratch &ablate::finiteVolume::processes::SpeciesTransport::GetDiffusionScratch(PetscInt numberSpecies) {
+    // the scratch is shared by every instance on this thread, so only grow it
+    if (diffusionScratch.speciesDiffusionFlux.size() < (std::size_t)numberSpecies) {
+        diffusionScratch.speciesDiffusivity.resize(numberSpecies);
+        diffusionScratch.speciesSpeciesSensibleEnthalpy.resize(numberSpecies);
+        diffusionScratch.speciesDiffusionFlux.resize(numberSpecies);
+    }
+    return diffusionScratch;
+}
+
+PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::ComputeSpeciesDiffusivity(const PetscScalar field[], PetscReal temperature, const DiffusionData &diffusionData,
+                                                                                            DiffusionScratch &scratch) {
+    PetscFunctionBeginUser;
+    if (diffusionData.speciesDiffFunction.function) {
+        PetscCall(diffusionData.speciesDiffFunction.function(field, temperature, scratch.speciesDiffusivity.data(), diffusionData.speciesDiffFunction.context.get()));
+    } else {
+        PetscReal diff = 0.0;
+        PetscCall(diffusionData.diffFunction.function(field, temperature, &diff, diffusionData.diffFunction.context.get()));
+        std::fill_n(scratch.speciesDiffusivity.begin(), diffusionData.numberSpecies, diff);
+    }
+    PetscFunctionReturn(0);
+}
+
+template <PetscInt dim>
+void ablate::finiteVolume::processes::SpeciesTransport::ComputeSpeciesDiffusionFlux(const PetscFVFaceGeom *fg, PetscReal density, const PetscScalar yi[], const PetscScalar gradYi[],
+                                                                                     const DiffusionData &diffusionData, DiffusionScratch &scratch) {
+    // speciesFlux(-rho Di dYi/dx - rho Di dYi/dy - rho Di dYi//dz) . n A
+    PetscReal correctionFlux = 0.0;
+    for (PetscInt sp = 0; sp < diffusionData.numberSpecies; ++sp) {
+        PetscReal normalGradient = 0.0;
+        for (PetscInt d = 0; d < dim; ++d) {
+            normalGradient += fg->normal[d] * gradYi[sp * dim + d];
+        }
+        const PetscReal diffusionFlux = density * scratch.speciesDiffusivity[sp] * normalGradient;
+        scratch.speciesDiffusionFlux[sp] = -diffusionFlux;
+        correctionFlux += diffusionFlux;
+    }
+
+    // the correction velocity (sum of Dj grad(Yj)) removes the net mass flux, each species is corrected by its mass fraction
+    if (diffusionData.diffusionCorrection) {
+        for (PetscInt sp = 0; sp < diffusionData.numberSpecies; ++sp) {
+            scratch.speciesDiffusionFlux[sp] += yi[sp] * correctionFlux;
+        }
+    }
+}
+
+template <PetscInt dim>
+PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::DiffusionEnergyFlux(PetscInt, const PetscFVFaceGeom *fg, const PetscInt uOff[], const PetscInt uOff_x[],
                                                                                       const PetscScalar field[], const PetscScalar grad[], const PetscInt aOff[], const PetscInt aOff_x[],
                                                                                       const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void *ctx) {
     PetscFunctionBeginUser;
@@ -83,19 +183,23 @@ PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::DiffusionEnerg
     const int euler = 0;
 
     auto flowParameters = (DiffusionData *)ctx;
+    auto &scratch = GetDiffusionScratch(flowParameters->numberSpecies);
 
     // get the current density from euler
     const PetscReal density = field[uOff[euler] + CompressibleFlowFields::RHO];
 
     // compute the temperature in this volume
-    PetscErrorCode ierr;
     PetscReal temperature;
-    ierr = flowParameters->computeTemperatureFunction.function(field, &temperature, flowParameters->computeTemperatureFunction.context.get());
-    CHKERRQ(ierr);
+    PetscCall(flowParameters->computeTemperatureFunction.function(field, &temperature, flowParameters->computeTemperatureFunction.context.get()));
+    PetscCall(flowParameters->computeSpeciesSensibleEnthalpyFunction.function(
+        field, temperature, scratch.speciesSpeciesSensibleEnthalpy.data(), flowParameters->computeSpeciesSensibleEnthalpyFunction.context.get()));
 
-    ierr = flowParameters->computeSpeciesSensibleEnthalpyFunction.function(
-        field, temperature, flowParameters->speciesSpeciesSensibleEnthalpy.data(), flowParameters->computeSpeciesSensibleEnthalpyFunction.context.get());
-    CHKERRQ(ierr);
+    // compute the diffusivity and species diffusion flux once for both the energy and species equations
+    PetscCall(ComputeSpeciesDiffusivity(field, temperature, *flowParameters, scratch));
+    ComputeSpeciesDiffusionFlux<dim>(fg, density, aux + aOff[yi], gradAux + aOff_x[yi], *flowParameters, scratch);
+    scratch.cachedData = flowParameters;
+    scratch.cachedFace = fg;
+    scratch.cachedField = field;
 
     // set the non rho E fluxes to zero
     flux[CompressibleFlowFields::RHO] = 0.0;
@@ -104,22 +208,15 @@ PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::DiffusionEnerg
         flux[CompressibleFlowFields::RHOU + d] = 0.0;
     }
 
-    // compute diff
-    PetscReal diff = 0.0;
-    flowParameters->diffFunction.function(field, temperature, &diff, flowParameters->diffFunction.context.get());
-
+    // the energy carried by each species
     for (PetscInt sp = 0; sp < flowParameters->numberSpecies; ++sp) {
-        for (PetscInt d = 0; d < dim; ++d) {
-            // speciesFlux(-rho Di dYi/dx - rho Di dYi/dy - rho Di dYi//dz) . n A
-            const int offset = aOff_x[yi] + (sp * dim) + d;
-            PetscReal speciesFlux = -fg->normal[d] * density * diff * flowParameters->speciesSpeciesSensibleEnthalpy[sp] * gradAux[offset];
-            flux[CompressibleFlowFields::RHOE] += speciesFlux;
-        }
+        flux[CompressibleFlowFields::RHOE] += scratch.speciesSpeciesSensibleEnthalpy[sp] * scratch.speciesDiffusionFlux[sp];
     }
 
     PetscFunctionReturn(0);
 }
-PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::DiffusionSpeciesFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt uOff[], const PetscInt uOff_x[],
+template <PetscInt dim>
+PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::DiffusionSpeciesFlux(PetscInt, const PetscFVFaceGeom *fg, const PetscInt uOff[], const PetscInt uOff_x[],
                                                                                        const PetscScalar field[], const PetscScalar grad[], const PetscInt aOff[], const PetscInt aOff_x[],
                                                                                        const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void *ctx) {
     PetscFunctionBeginUser;
@@ -128,34 +225,32 @@ PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::DiffusionSpeci
     const int euler = 0;
 
     auto flowParameters = (DiffusionData *)ctx;
+    auto &scratch = GetDiffusionScratch(flowParameters->numberSpecies);
 
-    // get the current density from euler
-    const PetscReal density = field[uOff[euler] + CompressibleFlowFields::RHO];
-
-    PetscErrorCode ierr;
-    PetscReal temperature;
-    ierr = flowParameters->computeTemperatureFunction.function(field, &temperature, flowParameters->computeTemperatureFunction.context.get());
-    CHKERRQ(ierr);
+    // reuse the species diffusion flux from the energy flux for this face, it is only used once so it is never stale
+    if (scratch.cachedData != flowParameters || scratch.cachedFace != fg || scratch.cachedField != field) {
+        // get the current density from euler
+        const PetscReal density = field[uOff[euler] + CompressibleFlowFields::RHO];
 
-    // compute diff
-    PetscReal diff = 0.0;
-    flowParameters->diffFunction.function(field, temperature, &diff, flowParameters->diffFunction.context.get());
+        PetscReal temperature;
+        PetscCall(flowParameters->computeTemperatureFunction.function(field, &temperature, flowParameters->computeTemperatureFunction.context.get()));
+        PetscCall(ComputeSpeciesDiffusivity(field, temperature, *flowParameters, scratch));
+        ComputeSpeciesDiffusionFlux<dim>(fg, density, aux + aOff[yi], gradAux + aOff_x[yi], *flowParameters, scratch);
+    }
+    scratch.cachedData = nullptr;
+    scratch.cachedFace = nullptr;
+    scratch.cachedField = nullptr;
 
     // species equations
     for (PetscInt sp = 0; sp < flowParameters->numberSpecies; ++sp) {
-        flux[sp] = 0;
-        for (PetscInt d = 0; d < dim; ++d) {
-            // speciesFlux(-rho Di dYi/dx - rho Di dYi/dy - rho Di dYi//dz) . n A
-            const int offset = aOff_x[yi] + (sp * dim) + d;
-            PetscReal speciesFlux = -fg->normal[d] * density * diff * gradAux[offset];
-            flux[sp] += speciesFlux;
-        }
+        flux[sp] = scratch.speciesDiffusionFlux[sp];
     }
 
     PetscFunctionReturn(0);
 }
 
-PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::AdvectionFlux(PetscInt dim, const PetscFVFaceGeom *fg, const PetscInt *uOff, const PetscScalar *fieldL, const PetscScalar *fieldR,
+template <PetscInt dim>
+PetscErrorCode ablate::finiteVolume::processes::SpeciesTransport::AdvectionFlux(PetscInt, const PetscFVFaceGeom *fg, const PetscInt *uOff, const PetscScalar *fieldL, const PetscScalar *fieldR,
                                                                                 const PetscInt *aOff, const PetscScalar *auxL, const PetscScalar *auxR, PetscScalar *flux, void *ctx) {
     PetscFunctionBeginUser;
     auto eulerAdvectionData = (AdvectionData *)ctx;
@@ -313,4 +408,8 @@ void ablate::finiteVolume::processes::SpeciesTransport::NormalizeSpecies(TS ts,
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::SpeciesTransport, "diffusion/advection for the species yi field",
          ARG(ablate::eos::EOS, "eos", "the equation of state used to describe the flow"),
          OPT(ablate::finiteVolume::fluxCalculator::FluxCalculator, "fluxCalculator", "the flux calculator (default is no advection)"),
-         OPT(ablate::eos::transport::TransportModel, "transport", "the diffusion transport model (default is no diffusion)"));
+         OPT(ablate::eos::transport::TransportModel, "transport", "the diffusion transport model (default is no diffusion)"),
+         OPT(bool, "diffusionCorrection", "apply the correction velocity so that the species diffusion fluxes sum to zero (default is false)"),
+         OPT(bool, "normalizeInAuxUpdate",
+             "bound and normalize the yi aux field while it is updated instead of normalizing the densityYi solution in a separate sweep after each step.  The densityYi solution is not "
+             "cleaned up (default is false)"));
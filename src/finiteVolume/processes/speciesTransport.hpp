@@ -34,6 +34,9 @@ class SpeciesTransport : public FlowProcess {
         /* diffusivity */
         eos::ThermodynamicTemperatureFunction diffFunction;
 
+        /* optional diffusivity of each species, when available it is used instead of diffFunction */
+        eos::ThermodynamicTemperatureFunction speciesDiffFunction;
+
         /* number of gas species */
         PetscInt numberSpecies;
 
@@ -41,16 +44,48 @@ class SpeciesTransport : public FlowProcess {
         eos::ThermodynamicFunction computeTemperatureFunction;
         eos::ThermodynamicTemperatureFunction computeSpeciesSensibleEnthalpyFunction;
 
-        /* store a scratch space for speciesSpeciesSensibleEnthalpy */
-        std::vector<PetscReal> speciesSpeciesSensibleEnthalpy;
+        /* when true the correction velocity is applied so that the species diffusion fluxes sum to zero */
+        bool diffusionCorrection = false;
     };
     DiffusionData diffusionData;
 
+    /**
+     * The scratch space used to compute the species diffusion for a face.  The species diffusion flux is computed once by the energy flux and reused by the species
+     * flux for the same face.  The scratch is stored per thread, so the diffusion flux functions remain thread safe.
+     */
+    struct DiffusionScratch {
+        /* the diffusivity of each species */
+        std::vector<PetscReal> speciesDiffusivity;
+
+        /* the sensible enthalpy of each species */
+        std::vector<PetscReal> speciesSpeciesSensibleEnthalpy;
+
+        /* the normal species diffusion flux for a face, computed once and shared by the energy and species flux functions */
+        std::vector<PetscReal> speciesDiffusionFlux;
+
+        /* the diffusion data, face, and face values used to compute the speciesDiffusionFlux, the energy flux is evaluated immediately before the species flux for each face */
+        const DiffusionData* cachedData = nullptr;
+        const PetscFVFaceGeom* cachedFace = nullptr;
+        const PetscScalar* cachedField = nullptr;
+    };
+    inline static thread_local DiffusionScratch diffusionScratch;
+
     // Store ctx needed for static function diffusion function passed to PETSc
     PetscInt numberSpecies;
 
+    // when true the mass fractions are bounded and normalized in the aux update instead of a separate sweep of the solution after each step
+    const bool normalizeInAuxUpdate;
+
    public:
-    explicit SpeciesTransport(std::shared_ptr<eos::EOS> eos, std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalcIn = {}, std::shared_ptr<eos::transport::TransportModel> transportModel = {});
+    /**
+     * @param eos
+     * @param fluxCalcIn the flux calculator (default is no advection)
+     * @param transportModel the diffusion transport model (default is no diffusion)
+     * @param diffusionCorrection apply the correction velocity so that the species diffusion fluxes sum to zero
+     * @param normalizeInAuxUpdate bound and normalize the yi aux field in the aux update instead of normalizing the densityYi solution after each step
+     */
+    explicit SpeciesTransport(std::shared_ptr<eos::EOS> eos, std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalcIn = {}, std::shared_ptr<eos::transport::TransportModel> transportModel = {},
+                              bool diffusionCorrection = false, bool normalizeInAuxUpdate = false);
 
     /**
      * public function to link this process with the flow
@@ -64,6 +99,13 @@ class SpeciesTransport : public FlowProcess {
     static PetscErrorCode UpdateAuxMassFractionField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* conservedValues, const PetscInt aOff[],
                                                      PetscScalar* auxField, void* ctx);
 
+    /**
+     * Function to compute the bounded and normalized mass fraction, the same cleanup as NormalizeSpecies is applied to the yi aux field while it is computed
+     * so no separate sweep of the solution is needed.  The densityYi solution is not modified.  This function assumes that the input values will be {"euler", "densityYi"}
+     */
+    static PetscErrorCode UpdateAuxNormalizedMassFractionField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* conservedValues,
+                                                               const PetscInt aOff[], PetscScalar* auxField, void* ctx);
+
     /**
      * Normalize and cleanup the species mass fractions in the solution vector
      * @param ts
@@ -72,14 +114,34 @@ class SpeciesTransport : public FlowProcess {
 
    private:
     /**
-     * This computes the energy transfer for species diffusion flux for rhoE
+     * Returns the scratch space for this thread, sized for the number of species
+     */
+    static DiffusionScratch& GetDiffusionScratch(PetscInt numberSpecies);
+
+    /**
+     * Fill the diffusivity of each species using the species diffusivity function when available, otherwise the single diffusivity is used for every species
+     */
+    static PetscErrorCode ComputeSpeciesDiffusivity(const PetscScalar field[], PetscReal temperature, const DiffusionData& diffusionData, DiffusionScratch& scratch);
+
+    // the flux functions are specialized by dimension and selected at setup, the dim argument is ignored
+    /**
+     * Compute the normal diffusion flux of every species at the face, including the optional correction velocity, and store it in the scratch.
+     * The species diffusivity must be computed before calling.
+     */
+    template <PetscInt dim>
+    static void ComputeSpeciesDiffusionFlux(const PetscFVFaceGeom* fg, PetscReal density, const PetscScalar yi[], const PetscScalar gradYi[], const DiffusionData& diffusionData,
+                                            DiffusionScratch& scratch);
+
+    /**
+     * This computes the energy transfer for species diffusion flux for rhoE.  The species diffusion flux computed here is reused by the DiffusionSpeciesFlux for the same face.
      * f = "euler"
      * u = {"euler", "densityYi"}
      * a = {"yi"}
      * ctx = SpeciesDiffusionData
      * @return
      */
-    static PetscErrorCode DiffusionEnergyFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
+    template <PetscInt dim>
+    static PetscErrorCode DiffusionEnergyFlux(PetscInt, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
                                               const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void* ctx);
     /**
      * This computes the species transfer for species diffusion fluxy
@@ -89,7 +151,8 @@ class SpeciesTransport : public FlowProcess {
      * ctx = SpeciesDiffusionData
      * @return
      */
-    static PetscErrorCode DiffusionSpeciesFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
+    template <PetscInt dim>
+    static PetscErrorCode DiffusionSpeciesFlux(PetscInt, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscInt uOff_x[], const PetscScalar field[], const PetscScalar grad[],
                                                const PetscInt aOff[], const PetscInt aOff_x[], const PetscScalar aux[], const PetscScalar gradAux[], PetscScalar flux[], void* ctx);
 
     /**
@@ -98,7 +161,8 @@ class SpeciesTransport : public FlowProcess {
      * ctx = FlowData_CompressibleFlow
      * @return
      */
-    static PetscErrorCode AdvectionFlux(PetscInt dim, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscScalar fieldL[], const PetscScalar fieldR[], const PetscInt aOff[],
+    template <PetscInt dim>
+    static PetscErrorCode AdvectionFlux(PetscInt, const PetscFVFaceGeom* fg, const PetscInt uOff[], const PetscScalar fieldL[], const PetscScalar fieldR[], const PetscInt aOff[],
                                         const PetscScalar auxL[], const PetscScalar auxR[], PetscScalar* flux, void* ctx);
 };
 
@@ -1,5 +1,7 @@
 #include "twoPhaseEulerAdvection.hpp"
 
+#include <cstdint>
+#include <cstring>
 #include <utility>
 #include "eos/perfectGas.hpp"
 #include "eos/stiffenedGas.hpp"
@@ -25,6 +27,44 @@ static inline PetscReal MagVector(PetscInt dim, const PetscReal *in) {
     return PetscSqrtReal(mag);
 }
 
+/**
+ * Closed form pressure/temperature equilibrium for two stiffened gases.  With p = (gamma - 1) rho e - gamma p0 and T = (e - p0/rho)/cv each phase satisfies
+ * rho_k = (p + p0_k)/((gamma_k - 1) cv_k T) and e_k = cv_k T (p + gamma_k p0_k)/(p + p0_k).  Substituting into the mixture energy and volume constraints
+ * gives a quadratic in p whose larger root is the physical one (the other root is below -min(p0_k)).
+ */
+static inline void StiffenedGasStiffenedGasEquilibrium(PetscReal Yg, PetscReal Yl, PetscReal density, PetscReal internalEnergy, PetscReal gamma1, PetscReal gamma2, PetscReal cp1, PetscReal cp2,
+                                                       PetscReal p01, PetscReal p02, PetscReal &rhoG, PetscReal &rhoL, PetscReal &eG, PetscReal &eL) {
+    const PetscReal cv1 = cp1 / gamma1;
+    const PetscReal cv2 = cp2 / gamma2;
+    const PetscReal A = Yg * cv1 + Yl * cv2;
+    const PetscReal B1 = Yg * (gamma1 - 1) * cv1;
+    const PetscReal B2 = Yl * (gamma2 - 1) * cv2;
+    const PetscReal rhoE = density * internalEnergy;
+
+    // a p^2 + b p + c = 0
+    const PetscReal a = A;
+    const PetscReal b = A * (p01 + p02) + B1 * p01 + B2 * p02 - rhoE * (B1 + B2);
+    const PetscReal c = p01 * p02 * (A + B1 + B2) - rhoE * (B1 * p02 + B2 * p01);
+    const PetscReal discriminant = PetscSqr(b) - 4 * a * c;
+    if (discriminant < 0) {
+        throw std::invalid_argument("ablate::finiteVolume::twoPhaseEulerAdvection StiffenedGas/StiffenedGas DecodeState has no pressure equilibrium");
+    }
+
+    // larger root, computed without cancellation
+    const PetscReal p = b > 0 ? (2 * c) / (-b - PetscSqrtReal(discriminant)) : (-b + PetscSqrtReal(discriminant)) / (2 * a);
+    if (p + p01 <= 0 || p + p02 <= 0) {
+        throw std::invalid_argument("ablate::finiteVolume::twoPhaseEulerAdvection StiffenedGas/StiffenedGas DecodeState cannot result in negative density");
+    }
+
+    // temperature from the volume constraint
+    const PetscReal T = 1.0 / (density * (B1 / (p + p01) + B2 / (p + p02)));
+
+    rhoG = (p + p01) / ((gamma1 - 1) * cv1 * T);
+    rhoL = (p + p02) / ((gamma2 - 1) * cv2 * T);
+    eG = cv1 * T * (p + gamma1 * p01) / (p + p01);
+    eL = cv2 * T * (p + gamma2 * p02) / (p + p02);
+}
+
 PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::FormFunctionGas(SNES snes, Vec x, Vec F, void *ctx) {
     auto decodeDataStruct = (DecodeDataStructGas *)ctx;
     const PetscReal *ax;
@@ -194,23 +234,27 @@ ablate::finiteVolume::processes::TwoPhaseEulerAdvection::TwoPhaseEulerAdvection(
                                                                                 std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorGasGas,
                                                                                 std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorGasLiquid,
                                                                                 std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorLiquidGas,
-                                                                                std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorLiquidLiquid)
+                                                                                std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorLiquidLiquid, std::optional<bool> snesPressureEquilibrium,
+                                                                                PetscReal thincSharpness, PetscReal interfaceTolerance)
     : eosGas(std::move(eosGas)),
       eosLiquid(std::move(eosLiquid)),
       fluxCalculatorGasGas(std::move(fluxCalculatorGasGas)),
       fluxCalculatorGasLiquid(std::move(fluxCalculatorGasLiquid)),
       fluxCalculatorLiquidGas(std::move(fluxCalculatorLiquidGas)),
-      fluxCalculatorLiquidLiquid(std::move(fluxCalculatorLiquidLiquid)) {}
+      fluxCalculatorLiquidLiquid(std::move(fluxCalculatorLiquidLiquid)),
+      snesPressureEquilibrium(snesPressureEquilibrium.value_or(false)),
+      thincSharpness(thincSharpness),
+      interfaceTolerance(interfaceTolerance > 0 ? interfaceTolerance : 1E-6) {}
 
 void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Setup(ablate::finiteVolume::FiniteVolumeSolver &flow) {
     // Before each step, compute the alpha
     auto multiphasePreStage = std::bind(&ablate::finiteVolume::processes::TwoPhaseEulerAdvection::MultiphaseFlowPreStage, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
-    flow.RegisterPreStage(multiphasePreStage);
+    flow.RegisterPreStage(multiphasePreStage, ablate::solver::Solver::PreStageDependence::step);
 
     // Create the decoder based upon the eoses
-    decoder = CreateTwoPhaseDecoder(flow.GetSubDomain().GetDimensions(), eosGas, eosLiquid);
+    decoder = std::make_shared<CachedTwoPhaseDecoder>(CreateTwoPhaseDecoder(flow.GetSubDomain().GetDimensions(), eosGas, eosLiquid, snesPressureEquilibrium), 0);
 
-    // Currently, no option for species advection
+    // Currently, no option for species advection.  The decoders hold scratch memory, so the fluxes are not registered as thread safe
     flow.RegisterRHSFunction(CompressibleFlowComputeEulerFlux, this, CompressibleFlowFields::EULER_FIELD, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
     flow.RegisterRHSFunction(CompressibleFlowComputeVFFlux, this, DENSITY_VF_FIELD, {VOLUME_FRACTION_FIELD, DENSITY_VF_FIELD, CompressibleFlowFields::EULER_FIELD}, {});
 
@@ -259,6 +303,9 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Multipha
     norm[1] = 1;
     norm[2] = 1;
 
+    // the conserved values change each stage, so start with an empty cache sized for the cells decoded below and by the fluxes
+    decoder->Reset(cellRange.end - cellRange.start);
+
     for (PetscInt i = cellRange.start; i < cellRange.end; ++i) {
         const PetscInt cell = cellRange.points ? cellRange.points[i] : i;
         PetscScalar *allFields = nullptr;
@@ -625,10 +672,17 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
 
     fluxCalculator::Direction directionG = twoPhaseEulerAdvection->fluxCalculatorGasGas->GetFluxCalculatorFunction()(
         twoPhaseEulerAdvection->fluxCalculatorGasGas->GetFluxCalculatorContext(), normalVelocityL, aG_L, densityG_L, pL, normalVelocityR, aG_R, densityG_R, pR, &massFlux, &p12);
+    // sharpen the upwind volume fraction when the upwind cell (which may be a ghost cell) is an interface cell
+    const bool reconstruct = twoPhaseEulerAdvection->thincSharpness > 0;
+    const auto isInterface = [twoPhaseEulerAdvection](PetscReal alpha) {
+        return alpha > twoPhaseEulerAdvection->interfaceTolerance && alpha < 1.0 - twoPhaseEulerAdvection->interfaceTolerance;
+    };
     if (directionG == fluxCalculator::LEFT) {
-        flux[0] = massFlux * areaMag * alphaL;
+        const PetscReal alphaFace = reconstruct && isInterface(alphaL) ? ThincFaceValue(alphaL, alphaR, twoPhaseEulerAdvection->thincSharpness) : alphaL;
+        flux[0] = massFlux * areaMag * alphaFace;
     } else if (directionG == fluxCalculator::RIGHT) {
-        flux[0] = massFlux * areaMag * alphaR;
+        const PetscReal alphaFace = reconstruct && isInterface(alphaR) ? ThincFaceValue(alphaR, alphaL, twoPhaseEulerAdvection->thincSharpness) : alphaR;
+        flux[0] = massFlux * areaMag * alphaFace;
     } else {
         flux[0] = massFlux * areaMag * 0.5 * (alphaL + alphaR);
     }
@@ -636,6 +690,21 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::Compress
     PetscFunctionReturn(0);
 }
 
+PetscReal ablate::finiteVolume::processes::TwoPhaseEulerAdvection::ThincFaceValue(PetscReal alphaUpwind, PetscReal alphaDownwind, PetscReal sharpness) {
+    // the orientation of the jump within the upwind cell
+    if (alphaDownwind == alphaUpwind) {
+        return alphaUpwind;
+    }
+    const PetscReal orientation = alphaDownwind > alphaUpwind ? 1.0 : -1.0;
+
+    // position the jump so the reconstruction conserves the cell average, the volume fraction is bounded by zero and one
+    const PetscReal tanhSharpness = PetscTanhReal(sharpness);
+    const PetscReal b = PetscExpReal(orientation * sharpness * (2.0 * alphaUpwind - 1.0));
+    const PetscReal a = (b / PetscCoshReal(sharpness) - 1.0) / tanhSharpness;
+
+    return 0.5 * (1.0 + orientation * (tanhSharpness + a) / (1.0 + a * tanhSharpness));
+}
+
 PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::UpdateAuxVelocityField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[],
                                                                                                    const PetscScalar *conservedValues, const PetscInt aOff[], PetscScalar *auxField, void *ctx) {
     PetscFunctionBeginUser;
@@ -713,7 +782,7 @@ PetscErrorCode ablate::finiteVolume::processes::TwoPhaseEulerAdvection::UpdateAu
 }
 
 std::shared_ptr<ablate::finiteVolume::processes::TwoPhaseEulerAdvection::TwoPhaseDecoder> ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CreateTwoPhaseDecoder(
-    PetscInt dim, const std::shared_ptr<eos::EOS> &eosGas, const std::shared_ptr<eos::EOS> &eosLiquid) {
+    PetscInt dim, const std::shared_ptr<eos::EOS> &eosGas, const std::shared_ptr<eos::EOS> &eosLiquid, bool snesPressureEquilibrium) {
     // check if both perfect gases, use analytical solution
     auto perfectGasEos1 = std::dynamic_pointer_cast<eos::PerfectGas>(eosGas);
     auto perfectGasEos2 = std::dynamic_pointer_cast<eos::PerfectGas>(eosLiquid);
@@ -725,11 +794,124 @@ std::shared_ptr<ablate::finiteVolume::processes::TwoPhaseEulerAdvection::TwoPhas
     } else if (perfectGasEos1 && stiffenedGasEos2) {
         return std::make_shared<PerfectGasStiffenedGasDecoder>(dim, perfectGasEos1, stiffenedGasEos2);
     } else if (stiffenedGasEos1 && stiffenedGasEos2) {
-        return std::make_shared<StiffenedGasStiffenedGasDecoder>(dim, stiffenedGasEos1, stiffenedGasEos2);
+        return std::make_shared<StiffenedGasStiffenedGasDecoder>(dim, stiffenedGasEos1, stiffenedGasEos2, snesPressureEquilibrium);
     }
     throw std::invalid_argument("Unknown combination of equation of states for ablate::finiteVolume::processes::TwoPhaseEulerAdvection::TwoPhaseDecoder");
 }
 
+std::shared_ptr<ablate::finiteVolume::processes::TwoPhaseEulerAdvection::TwoPhaseDecoder> ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CreateCachedTwoPhaseDecoder(
+    PetscInt dim, const std::shared_ptr<eos::EOS> &eosGas, const std::shared_ptr<eos::EOS> &eosLiquid, PetscInt numberStates) {
+    return std::make_shared<CachedTwoPhaseDecoder>(CreateTwoPhaseDecoder(dim, eosGas, eosLiquid), numberStates);
+}
+
+/**CachedTwoPhaseDecoder**************/
+ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CachedTwoPhaseDecoder::CachedTwoPhaseDecoder(std::shared_ptr<TwoPhaseDecoder> decoder, PetscInt numberStates)
+    : decoder(std::move(decoder)) {
+    Reset(numberStates);
+}
+
+void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CachedTwoPhaseDecoder::Reset(PetscInt numberStates) {
+    ownerThread = std::this_thread::get_id();
+
+    // use twice the expected number of states to limit collisions in the direct mapped cache
+    std::size_t size = 64;
+    while (size < 2 * (std::size_t)PetscMax(numberStates, 0)) {
+        size *= 2;
+    }
+
+    if (states.size() != size) {
+        states.assign(size, DecodedState{});
+    } else {
+        for (auto &state : states) {
+            state.valid = false;
+        }
+    }
+    hits = 0;
+    misses = 0;
+}
+
+void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::CachedTwoPhaseDecoder::DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues,
+                                                                                                              const PetscReal *normal, PetscReal *density, PetscReal *densityG, PetscReal *densityL,
+                                                                                                              PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy,
+                                                                                                              PetscReal *internalEnergyG, PetscReal *internalEnergyL, PetscReal *aG, PetscReal *aL,
+                                                                                                              PetscReal *MG, PetscReal *ML, PetscReal *p, PetscReal *T, PetscReal *alpha) {
+    const int EULER_FIELD = 2;
+    const int VF_FIELD = 1;
+
+    // the states and counters are not protected, so bypass the cache when called concurrently
+    if (std::this_thread::get_id() != ownerThread) {
+        decoder->DecodeTwoPhaseEulerState(dim, uOff, conservedValues, normal, density, densityG, densityL, normalVelocity, velocity, internalEnergy, internalEnergyG, internalEnergyL, aG, aL, MG, ML, p, T, alpha);
+        return;
+    }
+
+    // the decoded state only depends upon densityVF and the euler field
+    const std::size_t keySize = 3 + dim;
+    PetscReal key[maxKeySize];
+    key[0] = conservedValues[uOff[VF_FIELD]];
+    for (std::size_t k = 1; k < keySize; k++) {
+        key[k] = conservedValues[uOff[EULER_FIELD] + k - 1];
+    }
+
+    // hash the bit pattern of the key
+    std::uint64_t hash = 1469598103934665603ULL;
+    for (std::size_t k = 0; k < keySize; k++) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &key[k], sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ULL;
+        hash ^= hash >> 29;
+    }
+    auto &state = states[hash & (states.size() - 1)];
+
+    bool hit = state.valid;
+    for (std::size_t k = 0; k < keySize && hit; k++) {
+        hit = state.key[k] == key[k];
+    }
+
+    if (hit) {
+        hits++;
+        *density = state.density;
+        *densityG = state.densityG;
+        *densityL = state.densityL;
+        *internalEnergy = state.internalEnergy;
+        *internalEnergyG = state.internalEnergyG;
+        *internalEnergyL = state.internalEnergyL;
+        *aG = state.aG;
+        *aL = state.aL;
+        *p = state.p;
+        *T = state.T;
+        *alpha = state.alpha;
+
+        // only the normal dependent values need to be recomputed
+        (*normalVelocity) = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            velocity[d] = state.velocity[d];
+            (*normalVelocity) += velocity[d] * normal[d];
+        }
+        *MG = (*normalVelocity) / (*aG);
+        *ML = (*normalVelocity) / (*aL);
+        return;
+    }
+
+    misses++;
+    decoder->DecodeTwoPhaseEulerState(dim, uOff, conservedValues, normal, density, densityG, densityL, normalVelocity, velocity, internalEnergy, internalEnergyG, internalEnergyL, aG, aL, MG, ML, p, T, alpha);
+
+    // store the result, only successful decodes reach here
+    state.valid = true;
+    std::copy(key, key + keySize, state.key);
+    state.density = *density;
+    state.densityG = *densityG;
+    state.densityL = *densityL;
+    std::copy(velocity, velocity + dim, state.velocity);
+    state.internalEnergy = *internalEnergy;
+    state.internalEnergyG = *internalEnergyG;
+    state.internalEnergyL = *internalEnergyL;
+    state.aG = *aG;
+    state.aL = *aL;
+    state.p = *p;
+    state.T = *T;
+    state.alpha = *alpha;
+}
+
 /**PerfectGasPerfectGasDecoder**************/
 ablate::finiteVolume::processes::TwoPhaseEulerAdvection::PerfectGasPerfectGasDecoder::PerfectGasPerfectGasDecoder(PetscInt dim, const std::shared_ptr<eos::PerfectGas> &eosGas,
                                                                                                                   const std::shared_ptr<eos::PerfectGas> &eosLiquid)
@@ -1037,8 +1219,8 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::PerfectGasStiffene
 
 /**StiffenedGasStiffenedGasDecoder**************/
 ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffenedGasDecoder::StiffenedGasStiffenedGasDecoder(PetscInt dim, const std::shared_ptr<eos::StiffenedGas> &eosGas,
-                                                                                                                          const std::shared_ptr<eos::StiffenedGas> &eosLiquid)
-    : eosGas(eosGas), eosLiquid(eosLiquid) {
+                                                                                                                          const std::shared_ptr<eos::StiffenedGas> &eosLiquid, bool snesPressureEquilibrium)
+    : eosGas(eosGas), eosLiquid(eosLiquid), snesPressureEquilibrium(snesPressureEquilibrium) {
     // Create the fake euler field
     auto fakeEulerField = ablate::domain::Field{.name = CompressibleFlowFields::EULER_FIELD, .numberComponents = 2 + dim, .offset = 0};
 
@@ -1089,50 +1271,57 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffe
     PetscReal gamma1 = eosGas->GetSpecificHeatRatio();
     PetscReal gamma2 = eosLiquid->GetSpecificHeatRatio();
 
-    SNES snes;
-    Vec x, r;
-    Mat J;
-    VecCreate(PETSC_COMM_SELF, &x);
-    VecSetSizes(x, PETSC_DECIDE, 4);
-    VecSetFromOptions(x);
-    VecSet(x, (*density));  // set initial guess to conserved density, [rho1, rho2, e1, e2] = [rho, rho, rho, rho]
-    VecDuplicate(x, &r);
-
-    MatCreate(PETSC_COMM_SELF, &J);
-    MatSetSizes(J, PETSC_DECIDE, PETSC_DECIDE, 4, 4);
-    MatSetFromOptions(J);
-    MatSetUp(J);
-
-    SNESCreate(PETSC_COMM_SELF, &snes);
-    DecodeDataStructStiff decodeDataStruct{
-        .etot = (*internalEnergy),
-        .rhotot = (*density),
-        .Yg = densityVF / (*density),
-        .Yl = ((*density) - densityVF) / (*density),
-        .gam1 = gamma1,
-        .gam2 = gamma2,
-        .cpg = cp1,
-        .cpl = cp2,
-        .p0g = p01,
-        .p0l = p02,
-    };
-    SNESSetFunction(snes, r, FormFunctionStiff, &decodeDataStruct);
-    SNESSetJacobian(snes, J, J, FormJacobianStiff, &decodeDataStruct);
-    SNESSetTolerances(snes, 1E-8, 1E-12, 1E-8, 100, 1000);  // refine relative tolerance for more accurate pressure value
-    SNESSetFromOptions(snes);
-    SNESSolve(snes, NULL, x);
-
-    const PetscScalar *ax;
-    VecGetArrayRead(x, &ax);
-    PetscReal rhoG = ax[0];
-    PetscReal rhoL = ax[1];
-    PetscReal eG = ax[2];
-    PetscReal eL = ax[3];
-
-    SNESDestroy(&snes);
-    VecDestroy(&x);
-    VecDestroy(&r);
-    MatDestroy(&J);
+    PetscReal rhoG, rhoL, eG, eL;
+    if (!snesPressureEquilibrium) {
+        StiffenedGasStiffenedGasEquilibrium(densityVF / (*density), ((*density) - densityVF) / (*density), *density, *internalEnergy, gamma1, gamma2, cp1, cp2, p01, p02, rhoG, rhoL, eG, eL);
+    } else {
+        // solve the full nonlinear system with SNES, this is slow and is only intended to validate the closed form solution
+        SNES snes;
+        Vec x, r;
+        Mat J;
+        VecCreate(PETSC_COMM_SELF, &x);
+        VecSetSizes(x, PETSC_DECIDE, 4);
+        VecSetFromOptions(x);
+        VecSet(x, (*density));  // set initial guess to conserved density, [rho1, rho2, e1, e2] = [rho, rho, rho, rho]
+        VecDuplicate(x, &r);
+
+        MatCreate(PETSC_COMM_SELF, &J);
+        MatSetSizes(J, PETSC_DECIDE, PETSC_DECIDE, 4, 4);
+        MatSetFromOptions(J);
+        MatSetUp(J);
+
+        SNESCreate(PETSC_COMM_SELF, &snes);
+        DecodeDataStructStiff decodeDataStruct{
+            .etot = (*internalEnergy),
+            .rhotot = (*density),
+            .Yg = densityVF / (*density),
+            .Yl = ((*density) - densityVF) / (*density),
+            .gam1 = gamma1,
+            .gam2 = gamma2,
+            .cpg = cp1,
+            .cpl = cp2,
+            .p0g = p01,
+            .p0l = p02,
+        };
+        SNESSetFunction(snes, r, FormFunctionStiff, &decodeDataStruct);
+        SNESSetJacobian(snes, J, J, FormJacobianStiff, &decodeDataStruct);
+        SNESSetTolerances(snes, 1E-8, 1E-12, 1E-8, 100, 1000);  // refine relative tolerance for more accurate pressure value
+        SNESSetFromOptions(snes);
+        SNESSolve(snes, NULL, x);
+
+        const PetscScalar *ax;
+        VecGetArrayRead(x, &ax);
+        rhoG = ax[0];
+        rhoL = ax[1];
+        eG = ax[2];
+        eL = ax[3];
+        VecRestoreArrayRead(x, &ax);
+
+        SNESDestroy(&snes);
+        VecDestroy(&x);
+        VecDestroy(&r);
+        MatDestroy(&J);
+    }
 
     PetscReal etG = eG + ke;
     PetscReal etL = eL + ke;
@@ -1188,4 +1377,7 @@ void ablate::finiteVolume::processes::TwoPhaseEulerAdvection::StiffenedGasStiffe
 #include "registrar.hpp"
 REGISTER(ablate::finiteVolume::processes::Process, ablate::finiteVolume::processes::TwoPhaseEulerAdvection, "", ARG(ablate::eos::EOS, "eosGas", ""), ARG(ablate::eos::EOS, "eosLiquid", ""),
          ARG(ablate::finiteVolume::fluxCalculator::FluxCalculator, "fluxCalculatorGasGas", ""), ARG(ablate::finiteVolume::fluxCalculator::FluxCalculator, "fluxCalculatorGasLiquid", ""),
-         ARG(ablate::finiteVolume::fluxCalculator::FluxCalculator, "fluxCalculatorLiquidGas", ""), ARG(ablate::finiteVolume::fluxCalculator::FluxCalculator, "fluxCalculatorLiquidLiquid", ""));
+         ARG(ablate::finiteVolume::fluxCalculator::FluxCalculator, "fluxCalculatorLiquidGas", ""), ARG(ablate::finiteVolume::fluxCalculator::FluxCalculator, "fluxCalculatorLiquidLiquid", ""),
+         OPT(bool, "snesPressureEquilibrium", "use a SNES solve for the stiffened gas/stiffened gas pressure equilibrium to validate the closed form solution (default is false)"),
+         OPT(double, "thincSharpness", "reconstruct the volume fraction at interface faces with a THINC jump of this sharpness, typical values are 1.5 to 3.5 (default is 0, no reconstruction)"),
+         OPT(double, "interfaceTolerance", "cells with a volume fraction within this tolerance of zero or one are not reconstructed (default is 1E-6)"));
@@ -2,6 +2,8 @@
 #define ABLATELIBRARY_TWOPHASEEULERADVECTION_HPP
 
 #include <petsc.h>
+#include <optional>
+#include <thread>
 #include "eos/perfectGas.hpp"
 #include "eos/stiffenedGas.hpp"
 #include "finiteVolume/fluxCalculator/fluxCalculator.hpp"
@@ -148,14 +150,86 @@ class TwoPhaseEulerAdvection : public Process {
         eos::ThermodynamicTemperatureFunction liquidComputeSpeedOfSound;
         eos::ThermodynamicTemperatureFunction liquidComputePressure;
 
+        /**
+         * use the SNES solve instead of the closed form pressure equilibrium, only intended for validation
+         */
+        const bool snesPressureEquilibrium;
+
        public:
-        StiffenedGasStiffenedGasDecoder(PetscInt dim, const std::shared_ptr<eos::StiffenedGas> &perfectGasEos1, const std::shared_ptr<eos::StiffenedGas> &perfectGasEos2);
+        StiffenedGasStiffenedGasDecoder(PetscInt dim, const std::shared_ptr<eos::StiffenedGas> &perfectGasEos1, const std::shared_ptr<eos::StiffenedGas> &perfectGasEos2,
+                                        bool snesPressureEquilibrium = false);
 
         void DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, PetscReal *density, PetscReal *densityG, PetscReal *densityL,
                                       PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy, PetscReal *internalEnergyG, PetscReal *internalEnergyL, PetscReal *aG, PetscReal *aL,
                                       PetscReal *MG, PetscReal *ML, PetscReal *p, PetscReal *T, PetscReal *alpha) override;
     };
 
+    /**
+     * Decoder that remembers recently decoded states so each distinct conserved state is only decoded once.  The left/right face states of the euler and vf fluxes
+     * and the cell states in the pre stage repeat the same inputs, so only the normal dependent values (normalVelocity, MG, ML) are recomputed on a hit.
+     * The cache is not thread safe; calls from any thread other than the one that last reset the cache bypass it and go directly to the decoder.
+     */
+    class CachedTwoPhaseDecoder : public TwoPhaseDecoder {
+        //! the decoder used when the state is not in the cache
+        const std::shared_ptr<TwoPhaseDecoder> decoder;
+
+        //! densityVF followed by the euler field (RHO, RHOE, RHOU, RHOV, RHOW)
+        static constexpr std::size_t maxKeySize = 6;
+
+        /**
+         * Store the normal independent part of a decoded state
+         */
+        struct DecodedState {
+            bool valid = false;
+            PetscReal key[maxKeySize];
+            PetscReal density;
+            PetscReal densityG;
+            PetscReal densityL;
+            PetscReal velocity[3];
+            PetscReal internalEnergy;
+            PetscReal internalEnergyG;
+            PetscReal internalEnergyL;
+            PetscReal aG;
+            PetscReal aL;
+            PetscReal p;
+            PetscReal T;
+            PetscReal alpha;
+        };
+
+        //! direct mapped cache with a power of two size
+        std::vector<DecodedState> states;
+
+        //! keep track of the number of hits/misses since the last reset
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+
+        //! the only thread allowed to read/write the states
+        std::thread::id ownerThread;
+
+       public:
+        /**
+         * @param decoder the decoder used to compute new states
+         * @param numberStates the expected number of distinct states, i.e. the number of cells
+         */
+        CachedTwoPhaseDecoder(std::shared_ptr<TwoPhaseDecoder> decoder, PetscInt numberStates);
+
+        /**
+         * invalidate all stored states and size the cache for the expected number of distinct states.  The calling thread becomes the owner of the cache.
+         * @param numberStates
+         */
+        void Reset(PetscInt numberStates);
+
+        void DecodeTwoPhaseEulerState(PetscInt dim, const PetscInt *uOff, const PetscReal *conservedValues, const PetscReal *normal, PetscReal *density, PetscReal *densityG, PetscReal *densityL,
+                                      PetscReal *normalVelocity, PetscReal *velocity, PetscReal *internalEnergy, PetscReal *internalEnergyG, PetscReal *internalEnergyL, PetscReal *aG, PetscReal *aL,
+                                      PetscReal *MG, PetscReal *ML, PetscReal *p, PetscReal *T, PetscReal *alpha) override;
+
+        //! the number of decodes served from the cache since the last reset
+        std::size_t GetHits() const { return hits; }
+
+        //! the number of decodes computed by the decoder since the last reset
+        std::size_t GetMisses() const { return misses; }
+    };
+
     const std::shared_ptr<eos::EOS> eosGas;
     const std::shared_ptr<eos::EOS> eosLiquid;
     const std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorGasGas;
@@ -164,9 +238,24 @@ class TwoPhaseEulerAdvection : public Process {
     const std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorLiquidLiquid;
 
     /**
-     * Create and store the decoder
+     * use the SNES solve for the stiffened gas pressure equilibrium
+     */
+    const bool snesPressureEquilibrium;
+
+    /**
+     * the THINC sharpness (beta) used to reconstruct the volume fraction at interface faces, zero disables the reconstruction
+     */
+    const PetscReal thincSharpness;
+
+    /**
+     * cells with a volume fraction within this tolerance of zero or one are not interface cells (zero uses the default of 1E-6)
+     */
+    const PetscReal interfaceTolerance;
+
+    /**
+     * Create and store the decoder, decoded states are cached and reset before each stage
      */
-    std::shared_ptr<TwoPhaseDecoder> decoder;
+    std::shared_ptr<CachedTwoPhaseDecoder> decoder;
 
    public:
     static PetscErrorCode UpdateAuxTemperatureField2Gas(PetscReal time, PetscInt dim, const PetscFVCellGeom *cellGeom, const PetscInt uOff[], const PetscScalar *conservedValues, const PetscInt aOff[],
@@ -180,7 +269,8 @@ class TwoPhaseEulerAdvection : public Process {
 
     TwoPhaseEulerAdvection(std::shared_ptr<eos::EOS> eosGas, std::shared_ptr<eos::EOS> eosLiquid, std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorGasGas,
                            std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorGasLiquid, std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorLiquidGas,
-                           std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorLiquidLiquid);
+                           std::shared_ptr<fluxCalculator::FluxCalculator> fluxCalculatorLiquidLiquid, std::optional<bool> snesPressureEquilibrium = {}, PetscReal thincSharpness = 0,
+                           PetscReal interfaceTolerance = 0);
     void Setup(ablate::finiteVolume::FiniteVolumeSolver &flow) override;
 
    private:
@@ -190,14 +280,36 @@ class TwoPhaseEulerAdvection : public Process {
                                                         const PetscScalar auxL[], const PetscScalar auxR[], PetscScalar *flux, void *ctx);
 
    public:
+    /**
+     * Compute the THINC (tangent of hyperbola) reconstruction of the volume fraction at the downwind face of the upwind cell.  The volume fraction in the
+     * cell is reconstructed as a jump between zero and one oriented by the downwind cell and positioned to conserve the cell average.
+     * @param alphaUpwind the average volume fraction in the upwind cell
+     * @param alphaDownwind the average volume fraction in the downwind cell
+     * @param sharpness the THINC sharpness (beta)
+     * @return
+     */
+    static PetscReal ThincFaceValue(PetscReal alphaUpwind, PetscReal alphaDownwind, PetscReal sharpness);
+
     /**
      * static call to create a TwoPhaseDecoder based upon eos
      * @param dim
      * @param eosGas
      * @param eosLiquid
+     * @param snesPressureEquilibrium use the SNES validation solve for the stiffened gas pressure equilibrium
+     * @return
+     */
+    static std::shared_ptr<TwoPhaseDecoder> CreateTwoPhaseDecoder(PetscInt dim, const std::shared_ptr<eos::EOS> &eosGas, const std::shared_ptr<eos::EOS> &eosLiquid,
+                                                                  bool snesPressureEquilibrium = false);
+
+    /**
+     * static call to create a TwoPhaseDecoder based upon eos that caches the decoded states
+     * @param dim
+     * @param eosGas
+     * @param eosLiquid
+     * @param numberStates the expected number of distinct states
      * @return
      */
-    static std::shared_ptr<TwoPhaseDecoder> CreateTwoPhaseDecoder(PetscInt dim, const std::shared_ptr<eos::EOS> &eosGas, const std::shared_ptr<eos::EOS> &eosLiquid);
+    static std::shared_ptr<TwoPhaseDecoder> CreateCachedTwoPhaseDecoder(PetscInt dim, const std::shared_ptr<eos::EOS> &eosGas, const std::shared_ptr<eos::EOS> &eosLiquid, PetscInt numberStates);
 };
 
 }  // namespace ablate::finiteVolume::processes
@@ -14,7 +14,14 @@ std::vector<std::shared_ptr<ablate::domain::FieldDescription>> ablate::finiteVol
                                                        region,
                                                        conservedFieldOptions,
                                                        std::vector<std::string>{CompressibleFlowFields::EV_TAG}),
-            std::make_shared<domain::FieldDescription>(TKE_FIELD, TKE_FIELD, domain::FieldDescription::ONECOMPONENT, domain::FieldLocation::AUX, domain::FieldType::FVM, region, auxFieldOptions)};
+            std::make_shared<domain::FieldDescription>(TKE_FIELD,
+                                                       TKE_FIELD,
+                                                       domain::FieldDescription::ONECOMPONENT,
+                                                       domain::FieldLocation::AUX,
+                                                       domain::FieldType::FVM,
+                                                       region,
+                                                       auxFieldOptions,
+                                                       std::vector<std::string>{domain::Field::DERIVED_TAG})};
 }
 
 #include "registrar.hpp"
@@ -0,0 +1,42 @@
+#include "checkpointDeadline.hpp"
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include "utilities/mpiError.hpp"
+
+ablate::io::CheckpointDeadline::CheckpointDeadline(double remainingTime, double safetyFactor, std::function<Clock::time_point()> nowFunction)
+    : now(std::move(nowFunction)), safetyFactor(safetyFactor > 0 ? safetyFactor : 1.5) {
+    if (remainingTime > 0) {
+        deadline = now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(remainingTime));
+    } else if (const char* jobEndTime = std::getenv("SLURM_JOB_END_TIME")) {
+        deadline = Clock::time_point(std::chrono::seconds(std::stoll(jobEndTime)));
+    }
+}
+
+bool ablate::io::CheckpointDeadline::Check(MPI_Comm comm) {
+    const auto currentTime = now();
+    if (previousCheck) {
+        stepDuration = std::chrono::duration<double>(currentTime - *previousCheck).count();
+    }
+    previousCheck = currentTime;
+
+    // the clocks can be different on different machines, so only the root decision is used
+    int reached = 0;
+    if (deadline) {
+        const double remainingTime = std::chrono::duration<double>(*deadline - currentTime).count();
+        reached = remainingTime <= safetyFactor * (stepDuration + checkpointDuration);
+    }
+    MPI_Bcast(&reached, 1, MPI_INT, 0, comm) >> checkMpiError;
+    return reached;
+}
+
+void ablate::io::CheckpointDeadline::RecordCheckpoint(double seconds) {
+    double current = checkpointDuration;
+    while (seconds > current && !checkpointDuration.compare_exchange_weak(current, seconds)) {
+    }
+}
+
+#include "registrar.hpp"
+REGISTER_DEFAULT(ablate::io::CheckpointDeadline, ablate::io::CheckpointDeadline, "forces a final checkpoint and a clean exit before the job time limit",
+                 OPT(double, "remainingTime", "the remaining wall time in seconds (default is to read SLURM_JOB_END_TIME)"),
+                 OPT(double, "safetyFactor", "the multiplier applied to the estimated time to step and checkpoint (default is 1.5)"));
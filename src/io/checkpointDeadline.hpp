@@ -0,0 +1,66 @@
+#ifndef ABLATELIBRARY_CHECKPOINTDEADLINE_HPP
+#define ABLATELIBRARY_CHECKPOINTDEADLINE_HPP
+
+#include <petsc.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <optional>
+
+namespace ablate::io {
+
+/**
+ * Forces a final checkpoint before a batch job reaches its time limit.  The deadline is the supplied remaining wall time or, if not supplied, the
+ * SLURM_JOB_END_TIME environment variable (unix seconds).  The time needed to finish is estimated from the last step and the longest previous checkpoint, and
+ * the deadline is reached once the remaining time is less than the safety factor times that estimate.
+ */
+class CheckpointDeadline {
+   public:
+    using Clock = std::chrono::system_clock;
+
+   private:
+    //! the function used to get the current time
+    const std::function<Clock::time_point()> now;
+
+    //! the time the job will be killed, empty if unknown
+    std::optional<Clock::time_point> deadline;
+
+    //! the multiplier applied to the estimated time to checkpoint
+    const double safetyFactor;
+
+    //! the longest checkpoint so far in seconds, asynchronous writes are recorded from the writer thread
+    std::atomic<double> checkpointDuration = 0.0;
+
+    //! the duration of the last step in seconds and the time of the last check
+    double stepDuration = 0.0;
+    std::optional<Clock::time_point> previousCheck;
+
+   public:
+    /**
+     * @param remainingTime the remaining wall time in seconds (default is to read SLURM_JOB_END_TIME)
+     * @param safetyFactor the multiplier applied to the estimated time to step and checkpoint (default is 1.5)
+     * @param now the function used to get the current time
+     */
+    explicit CheckpointDeadline(double remainingTime = {}, double safetyFactor = {}, std::function<Clock::time_point()> now = Clock::now);
+
+    /**
+     * Check if the final checkpoint must be written now.  Called once per step, only the root decision is used.
+     * @param comm
+     * @return true if the deadline has been reached
+     */
+    bool Check(MPI_Comm comm);
+
+    /**
+     * Record the duration of a completed checkpoint
+     * @param seconds
+     */
+    void RecordCheckpoint(double seconds);
+
+    /**
+     * @return true if the deadline is known
+     */
+    [[nodiscard]] bool Active() const { return deadline.has_value(); }
+};
+
+}  // namespace ablate::io
+#endif  // ABLATELIBRARY_CHECKPOINTDEADLINE_HPP
@@ -2,13 +2,15 @@
 #include <petscviewerhdf5.h>
 #include <yaml-cpp/yaml.h>
 #include <fstream>
+#include <stdexcept>
 #include <utility>
 #include "environment/runEnvironment.hpp"
 #include "generators.hpp"
 #include "utilities/petscOptions.hpp"
 
-ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::shared_ptr<parameters::Parameters> options)
-    : interval(std::move(interval)) {
+ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::shared_ptr<parameters::Parameters> options,
+                                                             std::shared_ptr<IoAggregation> aggregation, bool singlePrecision, bool compress, bool incrementalXdmf, bool meshOnce)
+    : interval(std::move(interval)), aggregation(std::move(aggregation)), incrementalXdmf(incrementalXdmf), meshOnce(meshOnce) {
     // Load the metadata from the file is available, otherwise set to 0
     auto restartFilePath = environment::RunEnvironment::Get().GetOutputDirectory() / "restart.rst";
 
@@ -36,30 +38,44 @@ ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializer(std::shared_ptr<abl
     }
 
     // setup petsc options if provided
-    if (options) {
+    if (options || singlePrecision || compress) {
         PetscOptionsCreate(&petscOptions) >> checkError;
+    }
+    if (options) {
         options->Fill(petscOptions);
     }
+
+    // the visualization output profile is passed to the viewer through its options
+    if (singlePrecision) {
+        PetscOptionsSetValue(petscOptions, "-viewer_hdf5_sp_output", "true") >> checkError;
+    }
+    if (compress) {
+        PetscOptionsSetValue(petscOptions, "-viewer_hdf5_compress", "true") >> checkError;
+        PetscOptionsSetValue(petscOptions, "-viewer_hdf5_collective", "true") >> checkError;
+    }
 }
 
 ablate::io::Hdf5MultiFileSerializer::~Hdf5MultiFileSerializer() {
-    // save each serializer
-    for (std::string id : postProcessesIds) {
-        std::vector<std::filesystem::path> inputFilePaths;
-
-        auto directoryPath = GetOutputDirectoryPath(id);
-        for (const auto& file : std::filesystem::directory_iterator(directoryPath)) {
-            if (file.path().extension() == ".hdf5") {
-                inputFilePaths.push_back(file.path());
+    // the incremental xdmf collection is already complete
+    if (!incrementalXdmf) {
+        // save each serializer
+        for (std::string id : postProcessesIds) {
+            std::vector<std::filesystem::path> inputFilePaths;
+
+            auto directoryPath = GetOutputDirectoryPath(id);
+            for (const auto& file : std::filesystem::directory_iterator(directoryPath)) {
+                if (file.path().extension() == ".hdf5") {
+                    inputFilePaths.push_back(file.path());
+                }
             }
-        }
 
-        // sort the paths
-        std::sort(inputFilePaths.begin(), inputFilePaths.end());
+            // sort the paths
+            std::sort(inputFilePaths.begin(), inputFilePaths.end());
 
-        // run the convert function
-        std::filesystem::path outputFile = directoryPath / (id + ".xmf");
-        xdmfGenerator::Generate(inputFilePaths, outputFile);
+            // run the convert function
+            std::filesystem::path outputFile = directoryPath / (id + ".xmf");
+            xdmfGenerator::Generate(inputFilePaths, outputFile);
+        }
     }
 
     if (petscOptions) {
@@ -87,6 +103,9 @@ void ablate::io::Hdf5MultiFileSerializer::Register(std::weak_ptr<Serializable> s
             // set the petsc options if provided
             PetscObjectSetOptions((PetscObject)petscViewer, petscOptions) >> checkError;
             PetscViewerSetFromOptions(petscViewer) >> checkError;
+            if (aggregation) {
+                aggregation->Apply(petscViewer);
+            }
             PetscViewerViewFromOptions(petscViewer, nullptr, "-hdf5ViewerView") >> checkError;
 
             // Restore the simulation
@@ -134,31 +153,67 @@ PetscErrorCode ablate::io::Hdf5MultiFileSerializer::Hdf5MultiFileSerializerSaveS
 
         try {
             // save each serializer
+            hdf5Serializer->telemetry.Start();
+            double bytes = 0.0;
             for (auto& serializablePtr : hdf5Serializer->serializables) {
                 if (auto serializableObject = serializablePtr.lock()) {
                     // Create an output path
                     auto filePath = hdf5Serializer->GetOutputFilePath(serializableObject->GetId());
 
-                    PetscViewer petscViewer = nullptr;
-                    hdf5Serializer->StartEvent("PetscViewerHDF5Open");
-                    PetscViewerHDF5Open(PETSC_COMM_WORLD, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer) >> checkError;
-                    hdf5Serializer->EndEvent();
-
-                    // set the petsc options if provided
-                    PetscObjectSetOptions((PetscObject)petscViewer, hdf5Serializer->petscOptions) >> checkError;
-                    PetscViewerSetFromOptions(petscViewer) >> checkError;
-                    PetscViewerViewFromOptions(petscViewer, nullptr, "-hdf5ViewerView") >> checkError;
+                    // when the mesh is saved separately, only save it if it has changed
+                    const PetscObjectId meshId = hdf5Serializer->meshOnce ? serializableObject->GetMeshId() : 0;
+                    if (meshId) {
+                        auto& meshFile = hdf5Serializer->meshFiles[serializableObject->GetId()];
+                        if (meshFile.first != meshId) {
+                            auto meshFilePath = hdf5Serializer->GetOutputMeshFilePath(serializableObject->GetId());
+                            PetscViewer meshViewer = hdf5Serializer->OpenViewer(meshFilePath);
+                            hdf5Serializer->StartEvent("SaveMesh");
+                            serializableObject->SaveMesh(meshViewer);
+                            hdf5Serializer->EndEvent();
+                            PetscViewerDestroy(&meshViewer) >> checkError;
+                            meshFile = {meshId, meshFilePath};
+                            bytes += (double)std::filesystem::file_size(meshFilePath);
+                        }
+                    }
+
+                    PetscViewer petscViewer = hdf5Serializer->OpenViewer(filePath);
 
                     hdf5Serializer->StartEvent("Save");
                     // NOTE: as far as the output file the sequence number is always zero because it is a new file
-                    serializableObject->Save(petscViewer, 0, time);
+                    if (meshId) {
+                        serializableObject->SaveFields(petscViewer, 0, time);
+                    } else {
+                        serializableObject->Save(petscViewer, 0, time);
+                    }
                     hdf5Serializer->EndEvent();
 
                     hdf5Serializer->StartEvent("PetscViewerHDF5Destroy");
                     PetscViewerDestroy(&petscViewer) >> checkError;
                     hdf5Serializer->EndEvent();
+                    bytes += (double)std::filesystem::file_size(filePath);
+
+                    // link the mesh into the fields file so that it reads as a complete file
+                    if (meshId) {
+                        PetscMPIInt rank;
+                        MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+                        if (rank == 0) {
+                            LinkMesh(hdf5Serializer->meshFiles[serializableObject->GetId()].second, filePath);
+                        }
+                        MPI_Barrier(PETSC_COMM_WORLD);
+                    }
+
+                    if (hdf5Serializer->incrementalXdmf) {
+                        PetscMPIInt rank;
+                        MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+                        if (rank == 0) {
+                            hdf5Serializer->StartEvent("AppendXdmf");
+                            hdf5Serializer->AppendXdmf(serializableObject->GetId(), filePath);
+                            hdf5Serializer->EndEvent();
+                        }
+                    }
                 }
             }
+            hdf5Serializer->telemetry.Stop(bytes);
         } catch (std::exception& exception) {
             SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
         }
@@ -209,9 +264,97 @@ std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputFilePath(con
     return GetOutputDirectoryPath(objectId) / (objectId + sequenceNumberOutputString + extension);
 }
 
+PetscViewer ablate::io::Hdf5MultiFileSerializer::OpenViewer(const std::filesystem::path& filePath) {
+    PetscViewer petscViewer = nullptr;
+    StartEvent("PetscViewerHDF5Open");
+    PetscViewerHDF5Open(PETSC_COMM_WORLD, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer) >> checkError;
+    EndEvent();
+
+    // set the petsc options if provided
+    PetscObjectSetOptions((PetscObject)petscViewer, petscOptions) >> checkError;
+    PetscViewerSetFromOptions(petscViewer) >> checkError;
+    if (aggregation) {
+        aggregation->Apply(petscViewer);
+    }
+    PetscViewerViewFromOptions(petscViewer, nullptr, "-hdf5ViewerView") >> checkError;
+    return petscViewer;
+}
+
+void ablate::io::Hdf5MultiFileSerializer::LinkMesh(const std::filesystem::path& meshFilePath, const std::filesystem::path& filePath) {
+    hid_t fileId = H5Fopen(filePath.string().c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+    hid_t meshFileId = H5Fopen(meshFilePath.string().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (fileId < 0 || meshFileId < 0) {
+        throw std::runtime_error("Unable to link the mesh file " + meshFilePath.string() + " into " + filePath.string());
+    }
+
+    // collect the top level groups of the mesh file
+    std::vector<std::string> meshGroups;
+    H5Literate(
+        meshFileId,
+        H5_INDEX_NAME,
+        H5_ITER_NATIVE,
+        nullptr,
+        [](hid_t, const char* name, const H5L_info_t*, void* groups) -> herr_t {
+            ((std::vector<std::string>*)groups)->emplace_back(name);
+            return 0;
+        },
+        &meshGroups);
+    H5Fclose(meshFileId);
+
+    // link each group not written with the fields, the mesh file is referenced relative to the fields file
+    for (const auto& group : meshGroups) {
+        if (H5Lexists(fileId, group.c_str(), H5P_DEFAULT) <= 0) {
+            H5Lcreate_external(meshFilePath.filename().string().c_str(), ("/" + group).c_str(), fileId, group.c_str(), H5P_DEFAULT, H5P_DEFAULT);
+        }
+    }
+    H5Fclose(fileId);
+}
+
+void ablate::io::Hdf5MultiFileSerializer::AppendXdmf(const std::string& objectId, const std::filesystem::path& filePath) const {
+    // generate the xdmf for only the new file
+    auto stepXdmfPath = filePath;
+    stepXdmfPath.replace_extension(".xmf");
+    xdmfGenerator::Generate(std::vector<std::filesystem::path>{filePath}, stepXdmfPath);
+
+    // the collection includes each step file, the footer is rewritten after each new entry
+    static const std::string header =
+        "<?xml version=\"1.0\" ?>\n"
+        "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+        "<Xdmf xmlns:xi=\"http://www.w3.org/2001/XInclude\" Version=\"2.0\">\n"
+        "  <Domain>\n"
+        "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+    static const std::string footer =
+        "    </Grid>\n"
+        "  </Domain>\n"
+        "</Xdmf>\n";
+
+    auto collectionPath = GetOutputDirectoryPath(objectId) / (objectId + ".xmf");
+    if (!std::filesystem::exists(collectionPath) || std::filesystem::file_size(collectionPath) < header.size() + footer.size()) {
+        std::ofstream collection(collectionPath);
+        collection << header << footer;
+    }
+
+    // overwrite the footer with the new entry
+    std::fstream collection(collectionPath, std::ios::in | std::ios::out);
+    collection.seekp((std::streamoff)(std::filesystem::file_size(collectionPath) - footer.size()));
+    collection << "      <xi:include href=\"" << stepXdmfPath.filename().string() << "\" xpointer=\"xpointer(//Xdmf/Domain/Grid)\"/>\n" << footer;
+}
+
+std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputMeshFilePath(const std::string& objectId) const {
+    // the mesh files do not use the hdf5 extension so they are not treated as outputs
+    std::stringstream sequenceNumberOutputStream;
+    sequenceNumberOutputStream << std::setw(5) << std::setfill('0') << sequenceNumber;
+    return GetOutputDirectoryPath(objectId) / (objectId + ".mesh." + sequenceNumberOutputStream.str() + ".h5");
+}
+
 std::filesystem::path ablate::io::Hdf5MultiFileSerializer::GetOutputDirectoryPath(const std::string& objectId) { return environment::RunEnvironment::Get().GetOutputDirectory() / objectId; }
 
 #include "registrar.hpp"
 REGISTER(ablate::io::Serializer, ablate::io::Hdf5MultiFileSerializer, "serializer for IO that writes each time to a separate hdf5 file",
          ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine write interval."),
-         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc including (hdf5ViewerView, viewer_hdf5_collective, viewer_hdf5_sp_output"));
+         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc including (hdf5ViewerView, viewer_hdf5_collective, viewer_hdf5_sp_output"),
+         OPT(ablate::io::IoAggregation, "aggregation", "optionally write through a subset of aggregator ranks"),
+         OPT(bool, "singlePrecision", "write the fields in single precision for visualization, this output cannot be used for restart (default is false)"),
+         OPT(bool, "compress", "compress the output with the hdf5 deflate filter using collective io (default is false)"),
+         OPT(bool, "incrementalXdmf", "append each output to the xdmf collection as it is written instead of generating the xdmf from every file at the end (default is false)"),
+         OPT(bool, "meshOnce", "write the mesh to a separate file only when it changes and link it into each field only output (default is false)"));
@@ -4,8 +4,13 @@
 #include <petscviewer.h>
 #include <filesystem>
 #include <io/interval/interval.hpp>
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
+#include "ioAggregation.hpp"
+#include "ioTelemetry.hpp"
 #include "parameters/parameters.hpp"
 #include "serializable.hpp"
 #include "serializer.hpp"
@@ -37,6 +42,21 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     // an optional petscOptions that is used for this solver
     PetscOptions petscOptions = nullptr;
 
+    // optionally write through a subset of aggregator ranks
+    const std::shared_ptr<IoAggregation> aggregation;
+
+    // if true, the xdmf collection is appended after each output instead of generated from every file at the end
+    const bool incrementalXdmf;
+
+    // if true, the mesh is written to a separate file only when it changes and each output only contains the fields
+    const bool meshOnce;
+
+    // record the time and bytes of each save
+    IoTelemetry telemetry{"Hdf5MultiFileSerializer"};
+
+    // the id and path of the last mesh file written for each object
+    std::map<std::string, std::pair<PetscObjectId, std::filesystem::path>> meshFiles;
+
     //! Petsc function used to save the system state
     static PetscErrorCode Hdf5MultiFileSerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
 
@@ -46,14 +66,35 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     //! Private functions to load and save the ts metadata data
     std::filesystem::path GetOutputFilePath(const std::string& objectId) const;
 
+    //! open a new hdf5 file with the serializer options
+    PetscViewer OpenViewer(const std::filesystem::path& filePath);
+
+    //! link each mesh group of the mesh file into the fields file with hdf5 external links
+    static void LinkMesh(const std::filesystem::path& meshFilePath, const std::filesystem::path& filePath);
+
+    //! the path of the mesh file for the current sequence number
+    std::filesystem::path GetOutputMeshFilePath(const std::string& objectId) const;
+
+    //! generate the xdmf for a single output file and append it to the xdmf collection for the object
+    void AppendXdmf(const std::string& objectId, const std::filesystem::path& filePath) const;
+
     //! private function to get the output directory
     static std::filesystem::path GetOutputDirectoryPath(const std::string& objectId);
 
    public:
     /**
      * Separates into multiple files to solve some io issues
+     * @param interval
+     * @param options
+     * @param aggregation optionally write through a subset of aggregator ranks
+     * @param singlePrecision write the fields in single precision for visualization (this output cannot be used for restart)
+     * @param compress compress the output with the hdf5 deflate filter.  Compressed parallel writes require collective io, which is enabled with compression.
+     * @param incrementalXdmf append each output to the xdmf collection as it is written instead of generating the xdmf from every file at the end
+     * @param meshOnce write the mesh to a separate file only when it changes and link it into each field only output
      */
-    explicit Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval>, std::shared_ptr<parameters::Parameters> options = nullptr);
+    explicit Hdf5MultiFileSerializer(std::shared_ptr<ablate::io::interval::Interval>, std::shared_ptr<parameters::Parameters> options = nullptr,
+                                     std::shared_ptr<IoAggregation> aggregation = {}, bool singlePrecision = false, bool compress = false, bool incrementalXdmf = false,
+                                     bool meshOnce = false);
 
     /**
      * Allow file cleanup
@@ -72,6 +113,8 @@ class Hdf5MultiFileSerializer : public Serializer, private utilities::Loggable<H
     PetscSerializeFunction GetSerializeFunction() override { return Hdf5MultiFileSerializerSaveStateFunction; }
 
     void RestoreTS(TS ts) override;
+
+    bool Resumed() const override { return resumed; }
 };
 
 }  // namespace ablate::io
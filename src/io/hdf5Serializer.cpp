@@ -3,12 +3,14 @@
 #include <yaml-cpp/yaml.h>
 #include <environment/runEnvironment.hpp>
 #include <fstream>
+#include <utility>
 #include <io/interval/interval.hpp>
 #include <utilities/mpiError.hpp>
 #include "generators.hpp"
 #include "utilities/petscError.hpp"
 
-ablate::io::Hdf5Serializer::Hdf5Serializer(std::shared_ptr<ablate::io::interval::Interval> interval) : interval(interval) {
+ablate::io::Hdf5Serializer::Hdf5Serializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::shared_ptr<IoAggregation> aggregation, std::shared_ptr<CheckpointDeadline> deadline)
+    : interval(interval), aggregation(std::move(aggregation)), deadline(std::move(deadline)) {
     // Load the metadata from the file is available, otherwise set to 0
     auto restartFilePath = environment::RunEnvironment::Get().GetOutputDirectory() / "restart.rst";
 
@@ -38,7 +40,7 @@ ablate::io::Hdf5Serializer::Hdf5Serializer(std::shared_ptr<ablate::io::interval:
 
 void ablate::io::Hdf5Serializer::Register(std::weak_ptr<Serializable> serializable) {
     // for each serializable object create a Hdf5ObjectSerializer
-    serializers.push_back(std::make_unique<Hdf5ObjectSerializer>(serializable, sequenceNumber, time, resumed));
+    serializers.push_back(std::make_unique<Hdf5ObjectSerializer>(serializable, sequenceNumber, time, resumed, aggregation));
 }
 
 PetscErrorCode ablate::io::Hdf5Serializer::Hdf5SerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* ctx) {
@@ -50,7 +52,14 @@ PetscErrorCode ablate::io::Hdf5Serializer::Hdf5SerializerSaveStateFunction(TS ts
         PetscFunctionReturn(0);
     }
 
-    if (hdf5Serializer->interval->Check(PetscObjectComm((PetscObject)ts), steps, time)) {
+    // the interval is always checked so that its state is consistent on every rank
+    const bool intervalCheck = hdf5Serializer->interval->Check(PetscObjectComm((PetscObject)ts), steps, time);
+    const bool deadlineReached = hdf5Serializer->deadline && hdf5Serializer->deadline->Active() && hdf5Serializer->deadline->Check(PetscObjectComm((PetscObject)ts));
+
+    if (intervalCheck || deadlineReached) {
+        PetscLogDouble saveStartTime;
+        PetscCall(PetscTime(&saveStartTime));
+
         // Update all metadata
         hdf5Serializer->time = time;
         hdf5Serializer->timeStep = steps;
@@ -62,12 +71,27 @@ PetscErrorCode ablate::io::Hdf5Serializer::Hdf5SerializerSaveStateFunction(TS ts
 
         try {
             // save each serializer
+            hdf5Serializer->telemetry.Start();
+            double bytes = 0.0;
             for (auto& serializer : hdf5Serializer->serializers) {
                 serializer->Save(hdf5Serializer->sequenceNumber, time);
+                bytes += serializer->FlushWrittenBytes();
             }
+            hdf5Serializer->telemetry.Stop(bytes);
         } catch (std::exception& exception) {
             SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
         }
+        if (hdf5Serializer->deadline) {
+            PetscLogDouble saveEndTime;
+            PetscCall(PetscTime(&saveEndTime));
+            hdf5Serializer->deadline->RecordCheckpoint(saveEndTime - saveStartTime);
+        }
+
+        // complete the final checkpoint and stop the time stepper so the run exits cleanly
+        if (deadlineReached) {
+            PetscCall(PetscPrintf(PetscObjectComm((PetscObject)ts), "Wrote the final checkpoint at step %" PetscInt_FMT " before the job time limit\n", steps));
+            PetscCall(TSSetConvergedReason(ts, TS_CONVERGED_USER));
+        }
     }
     PetscFunctionReturn(0);
 }
@@ -109,7 +133,8 @@ void ablate::io::Hdf5Serializer::RestoreTS(TS ts) {
 }
 
 ////////////// Hdf5ObjectSerializer Implementation //////////////
-ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Hdf5ObjectSerializer(std::weak_ptr<Serializable> serializableIn, PetscInt sequenceNumber, PetscReal time, bool resume)
+ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Hdf5ObjectSerializer(std::weak_ptr<Serializable> serializableIn, PetscInt sequenceNumber, PetscReal time, bool resume,
+                                                                       const std::shared_ptr<IoAggregation>& aggregation)
     : serializable(serializableIn) {
     if (auto serializableObject = serializable.lock()) {
         filePath = environment::RunEnvironment::Get().GetOutputDirectory() / (serializableObject->GetId() + extension);
@@ -120,16 +145,23 @@ ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Hdf5ObjectSerializer(std::weak
                 StartEvent("PetscViewerHDF5Open");
                 PetscViewerHDF5Open(PETSC_COMM_WORLD, filePath.string().c_str(), FILE_MODE_UPDATE, &petscViewer) >> checkError;
                 EndEvent();
+                if (aggregation) {
+                    aggregation->Apply(petscViewer);
+                }
 
                 // Restore the simulation
                 StartEvent("Restore");
                 serializableObject->Restore(petscViewer, sequenceNumber, time);
                 EndEvent();
+                fileSize = (double)std::filesystem::file_size(filePath);
             } else {
                 throw std::runtime_error("Cannot resume simulation.  Unable to locate file: " + filePath.string());
             }
         } else {
             PetscViewerHDF5Open(PETSC_COMM_WORLD, filePath.string().c_str(), FILE_MODE_WRITE, &petscViewer) >> checkError;
+            if (aggregation) {
+                aggregation->Apply(petscViewer);
+            }
         }
     }
 }
@@ -155,6 +187,18 @@ void ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::Save(PetscInt sn, PetscRe
     PetscFunctionReturnVoid();
 }
 
+double ablate::io::Hdf5Serializer::Hdf5ObjectSerializer::FlushWrittenBytes() {
+    if (!petscViewer) {
+        return 0.0;
+    }
+    PetscViewerFlush(petscViewer) >> checkError;
+    const double previousSize = fileSize;
+    fileSize = (double)std::filesystem::file_size(filePath);
+    return fileSize - previousSize;
+}
+
 #include "registrar.hpp"
 REGISTER_DEFAULT(ablate::io::Serializer, ablate::io::Hdf5Serializer, "default serializer for IO",
-                 ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine write interval."));
+                 ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine write interval."),
+                 OPT(ablate::io::IoAggregation, "aggregation", "optionally write through a subset of aggregator ranks"),
+                 OPT(ablate::io::CheckpointDeadline, "deadline", "optionally force a final checkpoint and stop the time stepper before the job time limit"));
@@ -6,6 +6,9 @@
 #include <io/interval/interval.hpp>
 #include <memory>
 #include <vector>
+#include "checkpointDeadline.hpp"
+#include "ioAggregation.hpp"
+#include "ioTelemetry.hpp"
 #include "serializable.hpp"
 #include "serializer.hpp"
 #include "utilities/loggable.hpp"
@@ -25,11 +28,20 @@ class Hdf5Serializer : public Serializer {
         inline const static std::string extension = ".hdf5";
         std::filesystem::path filePath;
 
+        // the size of the file after the last write
+        double fileSize = 0.0;
+
        public:
-        explicit Hdf5ObjectSerializer(std::weak_ptr<Serializable> serializable, PetscInt sequenceNumber, PetscReal time, bool resumed);
+        explicit Hdf5ObjectSerializer(std::weak_ptr<Serializable> serializable, PetscInt sequenceNumber, PetscReal time, bool resumed, const std::shared_ptr<IoAggregation>& aggregation);
         ~Hdf5ObjectSerializer();
 
         void Save(PetscInt sequenceNumber, PetscReal time);
+
+        /**
+         * Flush the file so that its size includes every write
+         * @return the bytes written since the last call
+         */
+        double FlushWrittenBytes();
     };
 
     // Use the interval class to determine when to write to file
@@ -42,9 +54,18 @@ class Hdf5Serializer : public Serializer {
     PetscInt timeStep;
     bool resumed = false;
 
+    // optionally write through a subset of aggregator ranks
+    const std::shared_ptr<IoAggregation> aggregation;
+
     // Hold the pointer to each serializers;
     std::vector<std::unique_ptr<Hdf5ObjectSerializer>> serializers;
 
+    // record the time and bytes of each save
+    IoTelemetry telemetry{"Hdf5Serializer"};
+
+    // optionally force a final checkpoint and stop the time stepper before the job time limit
+    const std::shared_ptr<CheckpointDeadline> deadline;
+
     // Petsc function used to save the system state
     static PetscErrorCode Hdf5SerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
 
@@ -52,7 +73,12 @@ class Hdf5Serializer : public Serializer {
     void SaveMetadata(TS ts);
 
    public:
-    explicit Hdf5Serializer(std::shared_ptr<ablate::io::interval::Interval>);
+    /**
+     * @param interval
+     * @param aggregation optionally write through a subset of aggregator ranks
+     * @param deadline optionally force a final checkpoint and stop the time stepper before the job time limit
+     */
+    explicit Hdf5Serializer(std::shared_ptr<ablate::io::interval::Interval>, std::shared_ptr<IoAggregation> aggregation = {}, std::shared_ptr<CheckpointDeadline> deadline = {});
 
     /**
      * Handles registering the object and restore if available.
@@ -64,6 +90,8 @@ class Hdf5Serializer : public Serializer {
     PetscSerializeFunction GetSerializeFunction() override { return Hdf5SerializerSaveStateFunction; }
 
     void RestoreTS(TS ts) override;
+
+    bool Resumed() const override { return resumed; }
 };
 }  // namespace ablate::io
 
@@ -0,0 +1,38 @@
+#include "collectiveInterval.hpp"
+#include <algorithm>
+#include "utilities/mpiError.hpp"
+
+ablate::io::interval::CollectiveInterval::CollectiveInterval() { intervals.push_back(this); }
+
+ablate::io::interval::CollectiveInterval::~CollectiveInterval() { intervals.erase(std::remove(intervals.begin(), intervals.end(), this), intervals.end()); }
+
+bool ablate::io::interval::CollectiveInterval::Check(MPI_Comm comm, PetscInt steps, PetscReal time) {
+    int check;
+    if (agreedStep == steps) {
+        check = agreedCheck;
+        agreedStep = PETSC_MIN_INT;
+    } else {
+        // Broadcast to all ranks from root
+        check = LocalCheck(steps, time);
+        MPI_Bcast(&check, 1, MPI_INT, 0, comm) >> checkMpiError;
+    }
+
+    Accept(check);
+    return check;
+}
+
+void ablate::io::interval::CollectiveInterval::Synchronize(MPI_Comm comm, PetscInt steps, PetscReal time) {
+    if (intervals.empty()) {
+        return;
+    }
+
+    std::vector<int> checks(intervals.size());
+    for (std::size_t i = 0; i < intervals.size(); ++i) {
+        checks[i] = intervals[i]->LocalCheck(steps, time);
+    }
+    MPI_Bcast(checks.data(), (PetscMPIInt)checks.size(), MPI_INT, 0, comm) >> checkMpiError;
+    for (std::size_t i = 0; i < intervals.size(); ++i) {
+        intervals[i]->agreedStep = steps;
+        intervals[i]->agreedCheck = checks[i];
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef ABLATELIBRARY_COLLECTIVEINTERVAL_HPP
+#define ABLATELIBRARY_COLLECTIVEINTERVAL_HPP
+
+#include <vector>
+#include "interval.hpp"
+
+namespace ablate::io::interval {
+
+/**
+ * Base class for intervals where the decision on the first rank must be shared with every rank.  Rather than communicating in each Check, Synchronize can be
+ * called once per step (by the TimeStepper before the monitors) to agree on every collective interval with a single broadcast.  Check then uses the agreed
+ * decision for that step without communication, falling back to a broadcast if the interval was not synchronized.
+ */
+class CollectiveInterval : public Interval {
+   private:
+    //! every live collective interval in the order they were created, which is the same on every rank
+    inline static std::vector<CollectiveInterval*> intervals;
+
+    //! the step the agreed decision is valid for, it is only used once
+    PetscInt agreedStep = PETSC_MIN_INT;
+    int agreedCheck = 0;
+
+   protected:
+    /**
+     * Compute the decision on this rank without communication
+     */
+    virtual bool LocalCheck(PetscInt steps, PetscReal time) = 0;
+
+    /**
+     * Called on every rank with the agreed decision
+     */
+    virtual void Accept(bool check) {}
+
+   public:
+    CollectiveInterval();
+    ~CollectiveInterval() override;
+
+    CollectiveInterval(const CollectiveInterval&) = delete;
+    CollectiveInterval& operator=(const CollectiveInterval&) = delete;
+
+    [[nodiscard]] bool NeedsCollective() const override { return true; }
+
+    bool Check(MPI_Comm comm, PetscInt steps, PetscReal time) final;
+
+    /**
+     * Agree on the decision of every collective interval for this step with a single broadcast from the first rank
+     */
+    static void Synchronize(MPI_Comm comm, PetscInt steps, PetscReal time);
+};
+
+}  // namespace ablate::io::interval
+
+#endif  // ABLATELIBRARY_COLLECTIVEINTERVAL_HPP
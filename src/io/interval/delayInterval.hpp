@@ -37,6 +37,11 @@ class DelayInterval : public Interval {
      * @return
      */
     bool Check(MPI_Comm comm, PetscInt steps, PetscReal time) override;
+
+    /**
+     * The delay is local, so only the base interval may need a collective
+     */
+    [[nodiscard]] bool NeedsCollective() const override { return interval->NeedsCollective(); }
 };
 
 }  // namespace ablate::io::interval
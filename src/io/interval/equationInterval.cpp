@@ -2,21 +2,23 @@
 
 ablate::io::interval::EquationInterval::EquationInterval(std::string functionString) : ablate::mathFunctions::FormulaBase(functionString, {}) {
     // Remove the x, y, z for this implmentation
-    parser.ClearVar();
+    auto& state = GetState();
+    state.parser.ClearVar();
 
     // add back the two required vars
-    parser.DefineVar("step", &step);
-    parser.DefineVar("time", &time);
+    state.parser.DefineVar("step", &step);
+    state.parser.DefineVar("time", &state.time);
 
     // set the expression
-    parser.SetExpr(functionString);
+    state.parser.SetExpr(functionString);
 }
 bool ablate::io::interval::EquationInterval::Check(MPI_Comm comm, PetscInt stepIn, PetscReal timeIn) {
     // updated the linked variables
+    auto& state = GetState();
     step = stepIn;
-    time = timeIn;
+    state.time = timeIn;
 
-    auto value = parser.Eval();
+    auto value = state.parser.Eval();
     return value > 0;
 }
 
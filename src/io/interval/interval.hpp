@@ -13,6 +13,11 @@ class Interval {
     virtual ~Interval() = default;
 
     virtual bool Check(MPI_Comm comm, PetscInt steps, PetscReal time) = 0;
+
+    /**
+     * True if the check must communicate so that every rank agrees
+     */
+    [[nodiscard]] virtual bool NeedsCollective() const { return false; }
 };
 }  // namespace ablate::io::interval
 
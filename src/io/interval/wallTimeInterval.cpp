@@ -1,25 +1,22 @@
 #include "wallTimeInterval.hpp"
-#include "utilities/mpiError.hpp"
 
 ablate::io::interval::WallTimeInterval::WallTimeInterval(int timeInterval, std::function<std::chrono::time_point<std::chrono::system_clock>()> nowFunction)
     : timeInterval(timeInterval), now(nowFunction) {
     previousTime = now();
 }
-bool ablate::io::interval::WallTimeInterval::Check(MPI_Comm comm, PetscInt steps, PetscReal time) {
+bool ablate::io::interval::WallTimeInterval::LocalCheck(PetscInt steps, PetscReal time) {
     // Get the current duration
-    auto nowTime = now();
-    auto duration = nowTime - previousTime;
+    checkTime = now();
+    auto duration = checkTime - previousTime;
 
-    // If enough wall time las passed
-    int checkPoint = duration >= timeInterval;
-
-    // Broadcast to all ranks from root (time can be different on different machines)
-    MPI_Bcast(&checkPoint, 1, MPI_INT, 0, comm) >> checkMpiError;
+    // If enough wall time las passed, only the root decision is used (time can be different on different machines)
+    return duration >= timeInterval;
+}
 
-    if (checkPoint) {
-        previousTime = nowTime;
+void ablate::io::interval::WallTimeInterval::Accept(bool check) {
+    if (check) {
+        previousTime = checkTime;
     }
-    return checkPoint;
 }
 
 #include "registrar.hpp"
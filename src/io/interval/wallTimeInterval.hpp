@@ -3,18 +3,24 @@
 
 #include "chrono"
 #include "functional"
-#include "interval.hpp"
+#include "collectiveInterval.hpp"
 namespace ablate::io::interval {
 
-class WallTimeInterval : public Interval {
+class WallTimeInterval : public CollectiveInterval {
    private:
     const std::chrono::seconds timeInterval;
     std::chrono::time_point<std::chrono::system_clock> previousTime;
     const std::function<std::chrono::time_point<std::chrono::system_clock>()> now;
 
+    //! the time of the last local check, used as the previous time if the check is accepted
+    std::chrono::time_point<std::chrono::system_clock> checkTime;
+
+   protected:
+    bool LocalCheck(PetscInt steps, PetscReal time) override;
+    void Accept(bool check) override;
+
    public:
     explicit WallTimeInterval(int timeInterval, std::function<std::chrono::time_point<std::chrono::system_clock>()> = std::chrono::system_clock::now);
-    bool Check(MPI_Comm comm, PetscInt steps, PetscReal time) override;
 };
 
 }  // namespace ablate::io::interval
@@ -0,0 +1,59 @@
+#include "ioAggregation.hpp"
+#include <petscviewerhdf5.h>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include "environment/runEnvironment.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::io::IoAggregation::IoAggregation(int ranksPerAggregator, int stripeCount, int stripeSize) {
+    PetscMPIInt rank, size;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank) >> checkMpiError;
+    MPI_Comm_size(PETSC_COMM_WORLD, &size) >> checkMpiError;
+
+    if (ranksPerAggregator > 0) {
+        aggregators = (size + ranksPerAggregator - 1) / ranksPerAggregator;
+    } else {
+        // count the nodes by counting the first rank on each shared memory communicator
+        MPI_Comm nodeComm;
+        MPI_Comm_split_type(PETSC_COMM_WORLD, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm) >> checkMpiError;
+        PetscMPIInt nodeRank;
+        MPI_Comm_rank(nodeComm, &nodeRank) >> checkMpiError;
+        int nodeLeader = nodeRank == 0 ? 1 : 0;
+        MPI_Allreduce(&nodeLeader, &aggregators, 1, MPI_INT, MPI_SUM, PETSC_COMM_WORLD) >> checkMpiError;
+        MPI_Comm_free(&nodeComm) >> checkMpiError;
+    }
+
+    // build the romio hints (one key value pair per line) and the equivalent cray hints
+    std::stringstream romioHints;
+    std::stringstream crayHints;
+    romioHints << "romio_cb_write enable" << std::endl << "cb_nodes " << aggregators << std::endl;
+    crayHints << "*:romio_cb_write=enable:cb_nodes=" << aggregators;
+    if (stripeCount > 0) {
+        romioHints << "striping_factor " << stripeCount << std::endl;
+        crayHints << ":striping_factor=" << stripeCount;
+    }
+    if (stripeSize > 0) {
+        romioHints << "striping_unit " << stripeSize << std::endl << "cb_buffer_size " << stripeSize << std::endl;
+        crayHints << ":striping_unit=" << stripeSize << ":cb_buffer_size=" << stripeSize;
+    }
+
+    // the hints are read by mpi-io when each file is opened, so they must be in place before the first file is written
+    hintsFilePath = environment::RunEnvironment::Get().GetOutputDirectory() / "romioHints";
+    if (rank == 0) {
+        std::ofstream hintsFile(hintsFilePath);
+        hintsFile << romioHints.str();
+    }
+    MPI_Barrier(PETSC_COMM_WORLD) >> checkMpiError;
+    setenv("ROMIO_HINTS", hintsFilePath.string().c_str(), 0);
+    setenv("MPICH_MPIIO_HINTS", crayHints.str().c_str(), 0);
+}
+
+void ablate::io::IoAggregation::Apply(PetscViewer viewer) const { PetscViewerHDF5SetCollective(viewer, PETSC_TRUE) >> checkError; }
+
+#include "registrar.hpp"
+REGISTER_DEFAULT(ablate::io::IoAggregation, ablate::io::IoAggregation, "writes through a subset of aggregator ranks using collective mpi-io",
+                 OPT(int, "ranksPerAggregator", "the number of ranks for each aggregator (default is one aggregator per node)"),
+                 OPT(int, "stripeCount", "the number of file system stripes for new files (default is the file system default)"),
+                 OPT(int, "stripeSize", "the stripe size in bytes for new files, aggregators write stripe aligned blocks of this size (default is the file system default)"));
@@ -0,0 +1,43 @@
+#ifndef ABLATELIBRARY_IOAGGREGATION_HPP
+#define ABLATELIBRARY_IOAGGREGATION_HPP
+
+#include <petscviewer.h>
+#include <filesystem>
+
+namespace ablate::io {
+
+/**
+ * Limits the ranks that perform file operations by using collective mpi-io, where only a subset of aggregator ranks receive the data and write to the file
+ * system.  The number of aggregators and the file striping are passed to mpi-io as hints (ROMIO_HINTS and MPICH_MPIIO_HINTS) unless already set by the user.
+ */
+class IoAggregation {
+   private:
+    //! the number of aggregator ranks used by mpi-io
+    int aggregators = 0;
+
+    //! the hints file written for this run
+    std::filesystem::path hintsFilePath;
+
+   public:
+    /**
+     * @param ranksPerAggregator the number of ranks for each aggregator, defaults to one aggregator per node
+     * @param stripeCount the number of file system stripes (e.g. lustre OSTs) for new files, defaults to the file system default
+     * @param stripeSize the stripe size in bytes for new files.  Aggregators write stripe aligned blocks of this size.
+     */
+    explicit IoAggregation(int ranksPerAggregator = {}, int stripeCount = {}, int stripeSize = {});
+
+    /**
+     * Set the viewer to use collective mpi-io so the data is written through the aggregators
+     * @param viewer
+     */
+    void Apply(PetscViewer viewer) const;
+
+    /**
+     * the number of aggregator ranks
+     * @return
+     */
+    [[nodiscard]] int GetAggregators() const { return aggregators; }
+};
+
+}  // namespace ablate::io
+#endif  // ABLATELIBRARY_IOAGGREGATION_HPP
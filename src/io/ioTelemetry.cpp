@@ -0,0 +1,36 @@
+#include "ioTelemetry.hpp"
+#include <iostream>
+#include <utility>
+#include "utilities/mpiError.hpp"
+
+ablate::io::IoTelemetry::IoTelemetry(std::string nameIn, MPI_Comm comm) : name(std::move(nameIn)) {
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+    PetscOptionsGetBool(nullptr, nullptr, "-ioTelemetry", &report, nullptr) >> checkError;
+}
+
+ablate::io::IoTelemetry::~IoTelemetry() {
+    // the summary is printed without petsc because this may be destroyed after finalize
+    if (report && rank == 0 && numberWrites > 0) {
+        std::cout << name << ": " << numberWrites << " writes, " << totalBytes / 1.0E6 << " MB in " << totalTime << " s ("
+                  << (totalTime > 0.0 ? totalBytes / 1.0E6 / totalTime : 0.0) << " MB/s)" << std::endl;
+    }
+}
+
+void ablate::io::IoTelemetry::Start() {
+    StartEvent((name + "::Write").c_str());
+    PetscTime(&startTime) >> checkError;
+}
+
+void ablate::io::IoTelemetry::Stop(double bytes) {
+    PetscLogDouble endTime;
+    PetscTime(&endTime) >> checkError;
+    EndEvent();
+
+    const PetscLogDouble writeTime = endTime - startTime;
+    totalTime += writeTime;
+    totalBytes += bytes;
+    numberWrites++;
+    if (rank == 0) {
+        PetscInfo(nullptr, "%s wrote %g MB in %g s (%g MB/s)\n", name.c_str(), bytes / 1.0E6, writeTime, writeTime > 0.0 ? bytes / 1.0E6 / writeTime : 0.0) >> checkError;
+    }
+}
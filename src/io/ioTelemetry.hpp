@@ -0,0 +1,58 @@
+#ifndef ABLATELIBRARY_IOTELEMETRY_HPP
+#define ABLATELIBRARY_IOTELEMETRY_HPP
+
+#include <petsc.h>
+#include <string>
+#include "utilities/loggable.hpp"
+
+namespace ablate::io {
+
+/**
+ * Records the time and bytes of each write so that output cost can be separated from the solver cost.  Each write is logged as a PETSc event and the achieved
+ * bandwidth is reported with PetscInfo (-info).  A summary is printed when destroyed if the -ioTelemetry option is set.
+ */
+class IoTelemetry : private utilities::Loggable<IoTelemetry> {
+   private:
+    //! the name used for the event and report
+    const std::string name;
+
+    //! the rank in the comm used for the report
+    PetscMPIInt rank = 0;
+
+    //! print a summary when destroyed
+    PetscBool report = PETSC_FALSE;
+
+    //! the start time of the active write
+    PetscLogDouble startTime = 0.0;
+
+    //! the running totals
+    PetscLogDouble totalTime = 0.0;
+    double totalBytes = 0.0;
+    PetscInt numberWrites = 0;
+
+   public:
+    /**
+     * @param name the name used for the event and report
+     * @param comm the comm used for the writes, the report is only printed on the first rank
+     */
+    explicit IoTelemetry(std::string name, MPI_Comm comm = PETSC_COMM_WORLD);
+
+    /**
+     * Print the summary if requested
+     */
+    ~IoTelemetry();
+
+    /**
+     * Start timing a write
+     */
+    void Start();
+
+    /**
+     * Stop timing a write and record the bytes written
+     * @param bytes the total bytes written, only used on the first rank
+     */
+    void Stop(double bytes);
+};
+
+}  // namespace ablate::io
+#endif  // ABLATELIBRARY_IOTELEMETRY_HPP
@@ -31,6 +31,27 @@ class Serializable {
      */
     virtual void Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) = 0;
 
+    /**
+     * Objects with a mesh that can be saved separately from the state return a non zero id that changes whenever the mesh changes (e.g. the id of the dm).
+     * This allows a serializer to save the mesh once and only the fields for each output.
+     * @return the mesh id, or 0 if the mesh is always saved with the state
+     */
+    virtual PetscObjectId GetMeshId() { return 0; }
+
+    /**
+     * Save only the mesh to the PetscViewer, used when GetMeshId is non zero
+     * @param viewer
+     */
+    virtual void SaveMesh(PetscViewer viewer) {}
+
+    /**
+     * Save the state without the mesh to the PetscViewer, used when GetMeshId is non zero
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    virtual void SaveFields(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) { Save(viewer, sequenceNumber, time); }
+
     /**
      * Restore the state from the PetscViewer
      * @param viewer
@@ -18,6 +18,11 @@ class Serializer {
     virtual void* GetContext() { return this; }
     virtual PetscSerializeFunction GetSerializeFunction() = 0;
     virtual void RestoreTS(TS ts) = 0;
+
+    /**
+     * @return true if the serializer is resuming from a previous checkpoint, so the initial conditions do not need to be computed
+     */
+    virtual bool Resumed() const { return false; }
 };
 }  // namespace ablate::io
 
@@ -0,0 +1,76 @@
+#include "streamSerializer.hpp"
+#include <utility>
+#include "utilities/petscError.hpp"
+#include "utilities/petscOptions.hpp"
+
+ablate::io::StreamSerializer::StreamSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::string type, const std::shared_ptr<parameters::Parameters>& options)
+    : interval(std::move(interval)), type(type.empty() ? PETSCVIEWERSOCKET : std::move(type)) {
+    // setup petsc options if provided
+    if (options) {
+        PetscOptionsCreate(&petscOptions) >> checkError;
+        options->Fill(petscOptions);
+    }
+}
+
+ablate::io::StreamSerializer::~StreamSerializer() {
+    if (petscViewer) {
+        PetscViewerDestroy(&petscViewer) >> checkError;
+    }
+    if (petscOptions) {
+        ablate::utilities::PetscOptionsDestroyAndCheck("ablate::io::StreamSerializer::StreamSerializer", &petscOptions);
+    }
+}
+
+void ablate::io::StreamSerializer::Register(std::weak_ptr<Serializable> serializable) {
+    serializables.push_back(serializable);
+
+    // open the stream once there is something to send
+    if (!petscViewer) {
+        StartEvent("PetscViewerOpen");
+        PetscViewerCreate(PETSC_COMM_WORLD, &petscViewer) >> checkError;
+        PetscObjectSetOptions((PetscObject)petscViewer, petscOptions) >> checkError;
+        PetscViewerSetType(petscViewer, type.c_str()) >> checkError;
+        PetscViewerSetFromOptions(petscViewer) >> checkError;
+        EndEvent();
+    }
+}
+
+PetscErrorCode ablate::io::StreamSerializer::StreamSerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec, void* ctx) {
+    PetscFunctionBeginUser;
+    auto streamSerializer = (StreamSerializer*)ctx;
+
+    // Make sure that the same timeStep is not streamed more than once
+    if (steps <= streamSerializer->timeStep || !streamSerializer->petscViewer) {
+        PetscFunctionReturn(0);
+    }
+
+    if (streamSerializer->interval->Check(PetscObjectComm((PetscObject)ts), steps, time)) {
+        streamSerializer->timeStep = steps;
+        streamSerializer->sequenceNumber++;
+
+        try {
+            streamSerializer->StartEvent("Stream");
+            for (auto& serializablePtr : streamSerializer->serializables) {
+                if (auto serializableObject = serializablePtr.lock()) {
+                    // only the fields are streamed for objects with a separate mesh
+                    if (serializableObject->GetMeshId()) {
+                        serializableObject->SaveFields(streamSerializer->petscViewer, streamSerializer->sequenceNumber, time);
+                    } else {
+                        serializableObject->Save(streamSerializer->petscViewer, streamSerializer->sequenceNumber, time);
+                    }
+                }
+            }
+            PetscViewerFlush(streamSerializer->petscViewer) >> checkError;
+            streamSerializer->EndEvent();
+        } catch (std::exception& exception) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::io::Serializer, ablate::io::StreamSerializer, "serializer that streams the fields through a single PETSc viewer (e.g. socket or adios) for in-situ processing",
+         ARG(ablate::io::interval::Interval, "interval", "The interval object used to determine stream interval."),
+         OPT(std::string, "type", "the PETSc viewer type used for the stream (default is socket)"),
+         OPT(ablate::parameters::Parameters, "options", "options for the viewer passed directly to PETSc (e.g. viewer_socket_machine, viewer_socket_port)"));
@@ -0,0 +1,71 @@
+#ifndef ABLATELIBRARY_STREAMSERIALIZER_HPP
+#define ABLATELIBRARY_STREAMSERIALIZER_HPP
+
+#include <petscviewer.h>
+#include <io/interval/interval.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "parameters/parameters.hpp"
+#include "serializable.hpp"
+#include "serializer.hpp"
+#include "utilities/loggable.hpp"
+
+namespace ablate::io {
+
+/**
+ * Streams the registered objects through a single PETSc viewer (e.g. a socket or adios viewer) that is kept open for the entire simulation, avoiding the file
+ * system for in-situ visualization and analysis.  The mesh is never streamed, only the fields of each object in the order they were registered.  Streamed
+ * output cannot be used to restart.
+ */
+class StreamSerializer : public Serializer, private utilities::Loggable<StreamSerializer> {
+   private:
+    // Use the interval class to determine when to write to the stream
+    const std::shared_ptr<ablate::io::interval::Interval> interval;
+
+    // the PETSc viewer type used for the stream
+    const std::string type;
+
+    // keep track of the last streamed step and number of outputs
+    PetscInt sequenceNumber = -1;
+    PetscInt timeStep = -1;
+
+    // Hold the pointer to each serializable object;
+    std::vector<std::weak_ptr<Serializable>> serializables;
+
+    // an optional petscOptions that is used for the viewer
+    PetscOptions petscOptions = nullptr;
+
+    // the stream viewer, opened when the first object is registered
+    PetscViewer petscViewer = nullptr;
+
+    //! Petsc function used to stream the system state
+    static PetscErrorCode StreamSerializerSaveStateFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
+
+   public:
+    /**
+     * @param interval the interval used to determine when to stream
+     * @param type the PETSc viewer type used for the stream (default is socket)
+     * @param options options for the viewer passed directly to PETSc (e.g. viewer_socket_machine, viewer_socket_port)
+     */
+    explicit StreamSerializer(std::shared_ptr<ablate::io::interval::Interval> interval, std::string type = {}, const std::shared_ptr<parameters::Parameters>& options = {});
+
+    /**
+     * Close the stream
+     */
+    ~StreamSerializer() override;
+
+    /**
+     * Registers the object to be streamed, there is nothing to restore
+     */
+    void Register(std::weak_ptr<Serializable>) override;
+
+    //! public functions to interface with the main TS
+    PetscSerializeFunction GetSerializeFunction() override { return StreamSerializerSaveStateFunction; }
+
+    //! the stream is never used to restart
+    void RestoreTS(TS ts) override {}
+};
+
+}  // namespace ablate::io
+#endif  // ABLATELIBRARY_STREAMSERIALIZER_HPP
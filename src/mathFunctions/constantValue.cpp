@@ -53,5 +53,17 @@ void ablate::mathFunctions::ConstantValue::Eval(const double *xyz, const int &nd
     }
 }
 
+void ablate::mathFunctions::ConstantValue::EvalBatch(const double *xyz, std::size_t numberPoints, const int &ndims, const double &t, double *result, std::size_t numberResults,
+                                                     std::size_t stride) const {
+    if (!uniformValue && numberResults != 1 && numberResults != value.size()) {
+        throw std::invalid_argument("The function and result size do not match.");
+    }
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        for (std::size_t i = 0; i < numberResults; i++) {
+            result[p * stride + i] = uniformValue ? value[0] : value[i];
+        }
+    }
+}
+
 #include "registrar.hpp"
 REGISTER_PASS_THROUGH(ablate::mathFunctions::MathFunction, ablate::mathFunctions::ConstantValue, "sets a constant value to all values in field", double);
\ No newline at end of file
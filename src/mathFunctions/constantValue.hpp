@@ -26,6 +26,10 @@ class ConstantValue : public MathFunction {
 
     void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
 
+    void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const override;
+
+    bool IsTimeInvariant() const override { return true; }
+
     PetscFunction GetPetscFunction() override { return uniformValue ? ConstantValueUniformPetscFunction : ConstantValuePetscFunction; }
 
     void* GetContext() override { return (void*)value.data(); }
@@ -0,0 +1,50 @@
+#include "ensembleFunction.hpp"
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+ablate::mathFunctions::EnsembleFunction::EnsembleFunction(std::vector<std::shared_ptr<MathFunction>> membersIn) : members(std::move(membersIn)) {
+    if (members.empty()) {
+        throw std::invalid_argument("The EnsembleFunction requires at least one member function");
+    }
+}
+
+const std::shared_ptr<ablate::mathFunctions::MathFunction>& ablate::mathFunctions::EnsembleFunction::GetActiveFunction() const {
+    if (activeMember >= members.size()) {
+        throw std::out_of_range("The EnsembleFunction has " + std::to_string(members.size()) + " members but member " + std::to_string(activeMember) + " is active");
+    }
+    return members[activeMember];
+}
+
+double ablate::mathFunctions::EnsembleFunction::Eval(const double &x, const double &y, const double &z, const double &t) const { return GetActiveFunction()->Eval(x, y, z, t); }
+
+double ablate::mathFunctions::EnsembleFunction::Eval(const double *xyz, const int &ndims, const double &t) const { return GetActiveFunction()->Eval(xyz, ndims, t); }
+
+void ablate::mathFunctions::EnsembleFunction::Eval(const double &x, const double &y, const double &z, const double &t, std::vector<double> &result) const {
+    GetActiveFunction()->Eval(x, y, z, t, result);
+}
+
+void ablate::mathFunctions::EnsembleFunction::Eval(const double *xyz, const int &ndims, const double &t, std::vector<double> &result) const {
+    GetActiveFunction()->Eval(xyz, ndims, t, result);
+}
+
+void ablate::mathFunctions::EnsembleFunction::EvalBatch(const double *xyz, std::size_t numberPoints, const int &ndims, const double &t, double *result, std::size_t numberResults,
+                                                        std::size_t stride) const {
+    GetActiveFunction()->EvalBatch(xyz, numberPoints, ndims, t, result, numberResults, stride);
+}
+
+PetscErrorCode ablate::mathFunctions::EnsembleFunction::EnsemblePetscFunction(PetscInt dim, PetscReal time, const PetscReal *x, PetscInt nf, PetscScalar *u, void *ctx) {
+    PetscFunctionBeginUser;
+    auto ensembleFunction = (EnsembleFunction *)ctx;
+    if (activeMember >= ensembleFunction->members.size()) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_ARG_OUTOFRANGE, "The EnsembleFunction has %d members but member %d is active", (int)ensembleFunction->members.size(), (int)activeMember);
+    }
+    auto &function = ensembleFunction->members[activeMember];
+    PetscCall(function->GetPetscFunction()(dim, time, x, nf, u, function->GetContext()));
+    PetscFunctionReturn(0);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::mathFunctions::MathFunction, ablate::mathFunctions::EnsembleFunction,
+         "selects the function for the active member of a TimeStepper ensemble so that initial conditions, boundary values, and inflow can vary between members",
+         ARG(std::vector<ablate::mathFunctions::MathFunction>, "members", "the function for each ensemble member"));
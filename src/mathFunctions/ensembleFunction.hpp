@@ -0,0 +1,67 @@
+#ifndef ABLATELIBRARY_ENSEMBLEFUNCTION_HPP
+#define ABLATELIBRARY_ENSEMBLEFUNCTION_HPP
+
+#include <memory>
+#include "mathFunction.hpp"
+
+namespace ablate::mathFunctions {
+
+/**
+ * Selects one of a list of functions based upon the active ensemble member.  This allows the initial conditions, boundary values, and inflow functions to
+ * vary between the members of a TimeStepper ensemble that share a single mesh and setup.  The active member is global and is set by the TimeStepper before
+ * each member is solved.
+ */
+class EnsembleFunction : public MathFunction {
+   private:
+    //! the function for each ensemble member
+    const std::vector<std::shared_ptr<MathFunction>> members;
+
+    //! the member used by every ensemble function
+    inline static std::size_t activeMember = 0;
+
+    /**
+     * @return the function for the active member
+     */
+    [[nodiscard]] const std::shared_ptr<MathFunction>& GetActiveFunction() const;
+
+    static PetscErrorCode EnsemblePetscFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
+
+   public:
+    /**
+     * @param members the function for each ensemble member
+     */
+    explicit EnsembleFunction(std::vector<std::shared_ptr<MathFunction>> members);
+
+    double Eval(const double& x, const double& y, const double& z, const double& t) const override;
+
+    double Eval(const double* xyz, const int& ndims, const double& t) const override;
+
+    void Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const override;
+
+    void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
+
+    void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const override;
+
+    /**
+     * The values change between members so they are never cached
+     */
+    bool IsTimeInvariant() const override { return false; }
+
+    PetscFunction GetPetscFunction() override { return EnsemblePetscFunction; }
+
+    void* GetContext() override { return this; }
+
+    /**
+     * Sets the member used by every ensemble function
+     * @param member
+     */
+    static void SetActiveMember(std::size_t member) { activeMember = member; }
+
+    /**
+     * @return the member used by every ensemble function
+     */
+    static std::size_t GetActiveMember() { return activeMember; }
+};
+
+}  // namespace ablate::mathFunctions
+#endif  // ABLATELIBRARY_ENSEMBLEFUNCTION_HPP
@@ -1,5 +1,6 @@
 #include "formula.hpp"
 
+#include <algorithm>
 #include <utility>
 #include "simpleFormula.hpp"
 
@@ -11,102 +12,89 @@ ablate::mathFunctions::Formula::Formula(std::string functionString, const std::m
         // store the function
         nestedFunctions.push_back(nestedFunction.second);
 
-        // store the pointer
-        nestedValues.push_back(std::make_unique<double>(0.0));
-
-        // register this with the parser
-        parser.DefineVar(nestedFunction.first, nestedValues.back().get());
+        // register this with the parser, the nested values are the only variables so they share the index of the function
+        DefineVariable(nestedFunction.first);
+        nestedNames.push_back(nestedFunction.first);
     }
 
     // Test the function
     try {
-        parser.Eval();
+        GetState().parser.Eval();
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::SimpleFormula::ConvertToException(exception);
     }
+    CheckBulkSupport();
 }
 
 double ablate::mathFunctions::Formula::Eval(const double& x, const double& y, const double& z, const double& t) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
+    auto& state = GetState();
+    state.SetPoint(x, y, z, t);
 
     // updated the nested functions
-    for (std::size_t i = 0; i < nestedValues.size(); i++) {
-        *nestedValues[i] = nestedFunctions[i]->Eval(x, y, z, t);
+    for (std::size_t i = 0; i < nestedFunctions.size(); i++) {
+        state.variables[i] = nestedFunctions[i]->Eval(x, y, z, t);
     }
 
-    return parser.Eval();
+    return state.parser.Eval();
 }
 
 double ablate::mathFunctions::Formula::Eval(const double* xyz, const int& ndims, const double& t) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
-
-    for (auto d = 0; d < std::min(ndims, 3); d++) {
-        coordinate[d] = xyz[d];
-    }
-    time = t;
+    auto& state = GetState();
+    state.SetPoint(xyz, ndims, t);
 
     // updated the nested functions
-    for (std::size_t i = 0; i < nestedValues.size(); i++) {
-        *nestedValues[i] = nestedFunctions[i]->Eval(xyz, ndims, t);
+    for (std::size_t i = 0; i < nestedFunctions.size(); i++) {
+        state.variables[i] = nestedFunctions[i]->Eval(xyz, ndims, t);
     }
 
-    return parser.Eval();
+    return state.parser.Eval();
 }
 
 void ablate::mathFunctions::Formula::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
+    auto& state = GetState();
+    state.SetPoint(x, y, z, t);
 
     // updated the nested functions
-    for (std::size_t i = 0; i < nestedValues.size(); i++) {
-        *nestedValues[i] = nestedFunctions[i]->Eval(x, y, z, t);
-    }
-
-    int functionSize = 0;
-    auto rawResult = parser.Eval(functionSize);
-
-    if ((int)result.size() < functionSize) {
-        throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+    for (std::size_t i = 0; i < nestedFunctions.size(); i++) {
+        state.variables[i] = nestedFunctions[i]->Eval(x, y, z, t);
     }
 
-    // copy over
-    for (auto i = 0; i < functionSize; i++) {
-        result[i] = rawResult[i];
-    }
+    EvalResult(state, result.size(), result.data());
 }
 
 void ablate::mathFunctions::Formula::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+    auto& state = GetState();
+    state.SetPoint(xyz, ndims, t);
 
     // updated the nested functions
-    for (std::size_t i = 0; i < nestedValues.size(); i++) {
-        *nestedValues[i] = nestedFunctions[i]->Eval(xyz, ndims, t);
+    for (std::size_t i = 0; i < nestedFunctions.size(); i++) {
+        state.variables[i] = nestedFunctions[i]->Eval(xyz, ndims, t);
     }
 
-    for (auto i = 0; i < std::min(ndims, 3); i++) {
-        coordinate[i] = xyz[i];
+    EvalResult(state, result.size(), result.data());
+}
+
+void ablate::mathFunctions::Formula::EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const {
+    if (!bulkSupported || numberResults != 1) {
+        FormulaBase::EvalBatch(xyz, numberPoints, ndims, t, result, numberResults, stride);
+        return;
+    }
+    if (numberPoints == 0) {
+        return;
     }
-    time = t;
 
-    int functionSize = 0;
-    auto rawResult = parser.Eval(functionSize);
+    auto& state = GetState();
+    state.PrepareBulk(numberPoints);
+    state.FillBulkCoordinates(numberPoints, xyz, ndims, t);
 
-    if ((int)result.size() < functionSize) {
-        throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+    // evaluate each nested function for the batch
+    for (std::size_t i = 0; i < nestedFunctions.size(); i++) {
+        nestedFunctions[i]->EvalBatch(xyz, numberPoints, ndims, t, state.bulkVariables[nestedNames[i]].data(), 1, 1);
     }
 
-    // copy over
-    for (auto i = 0; i < functionSize; i++) {
-        result[i] = rawResult[i];
+    state.EvalBulk(numberPoints);
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        result[p * stride] = state.bulkResults[p];
     }
 }
 
@@ -114,42 +102,37 @@ PetscErrorCode ablate::mathFunctions::Formula::ParsedPetscNested(PetscInt dim, P
     // wrap in try, so we return petsc error code instead of c++ exception
     PetscFunctionBeginUser;
     try {
-        auto parser = (Formula*)ctx;
+        auto formula = (Formula*)ctx;
 
         // update the coordinates
-        parser->coordinate[0] = 0;
-        parser->coordinate[1] = 0;
-        parser->coordinate[2] = 0;
-
-        for (PetscInt i = 0; i < PetscMin(dim, 3); i++) {
-            parser->coordinate[i] = x[i];
-        }
-        parser->time = time;
+        auto& state = formula->GetState();
+        state.SetPoint(x, (int)dim, time);
 
         // updated the nested functions
-        for (std::size_t i = 0; i < parser->nestedValues.size(); i++) {
-            parser->nestedFunctions[i]->GetPetscFunction()(dim, time, x, 1, parser->nestedValues[i].get(), parser->nestedFunctions[i]->GetContext());
+        for (std::size_t i = 0; i < formula->nestedFunctions.size(); i++) {
+            formula->nestedFunctions[i]->GetPetscFunction()(dim, time, x, 1, &state.variables[i], formula->nestedFunctions[i]->GetContext());
         }
 
         // Evaluate
-        int functionSize = 0;
-        auto rawResult = parser->parser.Eval(functionSize);
-
-        if (nf < functionSize) {
-            throw std::invalid_argument("The result vector is not sized to hold the function " + parser->parser.GetExpr());
-        }
-
-        // copy over
-        for (auto i = 0; i < functionSize; i++) {
-            u[i] = rawResult[i];
-        }
-
+        formula->EvalResult(state, nf, u);
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
     }
     PetscFunctionReturn(0);
 }
 
+bool ablate::mathFunctions::Formula::IsTimeInvariant() const {
+    if (!FormulaBase::IsTimeInvariant()) {
+        return false;
+    }
+    for (const auto& nestedFunction : nestedFunctions) {
+        if (!nestedFunction->IsTimeInvariant()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::MathFunction, ablate::mathFunctions::Formula,
          " computes string function with variables x, y, z, and t where additional variables can be specified using other functions",
@@ -9,9 +9,9 @@
 namespace ablate::mathFunctions {
 class Formula : public FormulaBase {
    private:
-    // store the scratch variables
-    std::vector<std::unique_ptr<double>> nestedValues;
+    // store the nested functions, the value of each is stored in the matching EvaluationState::variables
     std::vector<std::shared_ptr<MathFunction>> nestedFunctions;
+    std::vector<std::string> nestedNames;
 
    private:
     static PetscErrorCode ParsedPetscNested(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
@@ -30,6 +30,16 @@ class Formula : public FormulaBase {
 
     void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
 
+    /**
+     * Evaluate a batch of points, the nested functions are evaluated for the batch and the formula in one call to the muParser bulk mode when it is single valued
+     */
+    void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const override;
+
+    /**
+     * The formula is time invariant if it does not use t and each nested function is time invariant
+     */
+    bool IsTimeInvariant() const override;
+
     void* GetContext() override { return this; }
 
     PetscFunction GetPetscFunction() override { return ParsedPetscNested; }
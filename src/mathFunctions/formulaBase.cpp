@@ -1,42 +1,196 @@
 #include "formulaBase.hpp"
 
 #include <tgmath.h>
+#include <algorithm>
+#include <unordered_map>
 #include <utility>
+#include "utilities/kokkosUtilities.hpp"
 #include "utilities/stringUtilities.hpp"
 
-ablate::mathFunctions::FormulaBase::FormulaBase(std::string functionString, const std::shared_ptr<ablate::parameters::Parameters>& constants) : formula(std::move(functionString)) {
+ablate::mathFunctions::FormulaBase::FormulaBase(std::string functionString, std::shared_ptr<ablate::parameters::Parameters> constants)
+    : constants(std::move(constants)), primaryThread(std::this_thread::get_id()), id(nextId++), formula(std::move(functionString)) {
+    primaryState = std::make_unique<EvaluationState>();
+    InitializeState(*primaryState);
+}
+
+void ablate::mathFunctions::FormulaBase::InitializeState(EvaluationState& state) const {
     // define the x,y,z and t variables
-    parser.DefineVar("x", &coordinate[0]);
-    parser.DefineVar("y", &coordinate[1]);
-    parser.DefineVar("z", &coordinate[2]);
-    parser.DefineVar("t", &time);
+    state.parser.DefineVar("x", &state.coordinate[0]);
+    state.parser.DefineVar("y", &state.coordinate[1]);
+    state.parser.DefineVar("z", &state.coordinate[2]);
+    state.parser.DefineVar("t", &state.time);
+    for (const auto& name : variableNames) {
+        state.variables.push_back(0.0);
+        state.parser.DefineVar(name, &state.variables.back());
+    }
+
+    // check for random number
+    if (ablate::utilities::StringUtilities::Contains(formula, "rand")) {
+        std::random_device rd;
+        state.randomEngine = std::default_random_engine(rd());
+    }
+
+    ConfigureParser(state.parser, state);
 
+    // the bulk parser variables are bound when the batch is sized
+    for (const auto& name : {"x", "y", "z", "t"}) {
+        state.bulkVariables[name];
+    }
+    for (const auto& name : variableNames) {
+        state.bulkVariables[name];
+    }
+    ConfigureParser(state.bulkParser, state);
+}
+
+void ablate::mathFunctions::FormulaBase::ConfigureParser(mu::Parser& formulaParser, EvaluationState& state) const {
     // Add in any provided constants
     if (constants) {
         for (const auto& key : constants->GetKeys()) {
-            parser.DefineConst(key, constants->GetExpect<double>(key));
+            formulaParser.DefineConst(key, constants->GetExpect<double>(key));
         }
     }
 
     // add in any additional helper functions
     if (ablate::utilities::StringUtilities::Contains(formula, "Power")) {
-        parser.DefineFun("Power", PowerFunction, true);
+        formulaParser.DefineFun("Power", PowerFunction, true);
     }
     // check for random number
     if (ablate::utilities::StringUtilities::Contains(formula, "pRand")) {
-        parser.DefineFunUserData("pRand", PseudoRandomFunction, reinterpret_cast<void*>(&pseudoRandomEngine), false);
+        formulaParser.DefineFunUserData("pRand", PseudoRandomFunction, reinterpret_cast<void*>(&state.pseudoRandomEngine), false);
     }
     if (ablate::utilities::StringUtilities::Contains(formula, "rand")) {
-        std::random_device rd;
-        randomEngine = std::default_random_engine(rd());
-        parser.DefineFunUserData("rand", RandomFunction, reinterpret_cast<void*>(&randomEngine), false);
+        formulaParser.DefineFunUserData("rand", RandomFunction, reinterpret_cast<void*>(&state.randomEngine), false);
     }
     if (ablate::utilities::StringUtilities::Contains(formula, "%")) {
-        parser.DefineOprt("%", ModulusOperator, mu::prADD_SUB, mu::oaLEFT, true);
+        formulaParser.DefineOprt("%", ModulusOperator, mu::prADD_SUB, mu::oaLEFT, true);
     }
 
     // set the expression
-    parser.SetExpr(formula);
+    formulaParser.SetExpr(formula);
+}
+
+ablate::mathFunctions::FormulaBase::EvaluationState& ablate::mathFunctions::FormulaBase::GetState() const {
+    // the thread that built the formula never needs a lookup
+    if (std::this_thread::get_id() == primaryThread) {
+        return *primaryState;
+    }
+
+    // each thread remembers its state for every formula it has evaluated
+    thread_local std::unordered_map<std::size_t, EvaluationState*> localStates;
+    auto& localState = localStates[id];
+    if (!localState) {
+        std::lock_guard<std::mutex> lock(threadStateMutex);
+        auto state = std::make_unique<EvaluationState>();
+        InitializeState(*state);
+
+        // the primary thread uses stream zero, every other thread uses the stream after the statically scheduled chunk it first evaluated so the streams do not
+        // depend on the order in which the threads arrive
+        std::seed_seq seed{ablate::utilities::KokkosUtilities::GetCurrentChunk() + 1};
+        state->pseudoRandomEngine.seed(seed);
+
+        localState = state.get();
+        threadStates.push_back(std::move(state));
+    }
+    return *localState;
+}
+
+std::size_t ablate::mathFunctions::FormulaBase::DefineVariable(const std::string& name) {
+    variableNames.push_back(name);
+
+    auto& state = *primaryState;
+    state.variables.push_back(0.0);
+    state.parser.DefineVar(name, &state.variables.back());
+    state.bulkVariables[name];
+
+    // force the variables to be rebound on the next batch
+    state.bulkResults.clear();
+    return state.variables.size() - 1;
+}
+
+void ablate::mathFunctions::FormulaBase::EvalResult(EvaluationState& state, std::size_t numberResults, double* result) {
+    int functionSize = 0;
+    auto rawResult = state.parser.Eval(functionSize);
+
+    if ((int)numberResults < functionSize) {
+        throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
+    }
+
+    // copy over
+    for (auto i = 0; i < functionSize; i++) {
+        result[i] = rawResult[i];
+    }
+}
+
+void ablate::mathFunctions::FormulaBase::CheckBulkSupport() {
+    // the bulk mode only returns a single value for each entry, random numbers are left on the point by point path so the sequence does not change
+    auto& state = *primaryState;
+    bulkSupported = state.parser.GetNumResults() == 1 && !ablate::utilities::StringUtilities::Contains(formula, "rand");
+    if (bulkSupported) {
+        try {
+            state.PrepareBulk(1);
+            state.EvalBulk(1);
+        } catch (mu::Parser::exception_type&) {
+            bulkSupported = false;
+        }
+    }
+}
+
+void ablate::mathFunctions::FormulaBase::EvaluationState::SetPoint(const double& x, const double& y, const double& z, const double& t) {
+    coordinate[0] = x;
+    coordinate[1] = y;
+    coordinate[2] = z;
+    time = t;
+}
+
+void ablate::mathFunctions::FormulaBase::EvaluationState::SetPoint(const double* xyz, const int& ndims, const double& t) {
+    coordinate[0] = 0;
+    coordinate[1] = 0;
+    coordinate[2] = 0;
+
+    for (auto d = 0; d < std::min(ndims, 3); d++) {
+        coordinate[d] = xyz[d];
+    }
+    time = t;
+}
+
+void ablate::mathFunctions::FormulaBase::EvaluationState::PrepareBulk(std::size_t size) {
+    if (bulkResults.size() >= size) {
+        return;
+    }
+
+    // growing the arrays may move them, so rebind each variable
+    bulkResults.resize(size);
+    for (auto& [name, values] : bulkVariables) {
+        values.resize(size);
+        bulkParser.DefineVar(name, values.data());
+    }
+}
+
+void ablate::mathFunctions::FormulaBase::EvaluationState::FillBulkCoordinates(std::size_t numberPoints, const double* xyz, const int& ndims, const double& t) {
+    double* bulkCoordinates[3] = {bulkVariables["x"].data(), bulkVariables["y"].data(), bulkVariables["z"].data()};
+    for (int d = 0; d < 3; d++) {
+        if (d < ndims) {
+            for (std::size_t p = 0; p < numberPoints; p++) {
+                bulkCoordinates[d][p] = xyz[p * ndims + d];
+            }
+        } else {
+            std::fill_n(bulkCoordinates[d], numberPoints, 0.0);
+        }
+    }
+    std::fill_n(bulkVariables["t"].data(), numberPoints, t);
+}
+
+void ablate::mathFunctions::FormulaBase::EvaluationState::EvalBulk(std::size_t size) { bulkParser.Eval(bulkResults.data(), (int)size); }
+
+bool ablate::mathFunctions::FormulaBase::IsTimeInvariant() const {
+    if (ablate::utilities::StringUtilities::Contains(formula, "rand")) {
+        return false;
+    }
+    try {
+        return primaryState->parser.GetUsedVar().count("t") == 0;
+    } catch (mu::Parser::exception_type&) {
+        return false;
+    }
 }
 
 std::invalid_argument ablate::mathFunctions::FormulaBase::ConvertToException(mu::Parser::exception_type& exception) {
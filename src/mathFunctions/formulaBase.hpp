@@ -2,7 +2,15 @@
 #define ABLATELIBRARY_FORMULABASE_HPP
 
 #include <muParser.h>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <random>
+#include <string>
+#include <thread>
+#include <vector>
 #include "mathFunction.hpp"
 #include "parameters/parameters.hpp"
 
@@ -12,32 +20,138 @@ namespace ablate::mathFunctions {
  * Formula base is the base abstract class shared by other formulas
  */
 class FormulaBase : public MathFunction {
+   protected:
+    /**
+     * The variables, parsers, and random engines used to evaluate the formula.  Each thread evaluating the formula uses its own state so no parser
+     * or engine is shared between threads.
+     */
+    struct EvaluationState {
+        //! The coordinate linked to the parser
+        double coordinate[3] = {0, 0, 0};
+
+        //! the time linked to the parser
+        double time = 0.0;
+
+        //! the additional variables linked to the parser in the order they were defined, a deque so the addresses are stable
+        std::deque<double> variables;
+
+        //! The parser object library for this formula
+        mu::Parser parser;
+
+        //! a second parser used in the muParser bulk mode, each variable is bound to an array with a value for every entry in the batch
+        mu::Parser bulkParser;
+
+        //! the arrays bound to the bulk parser variables
+        std::map<std::string, std::vector<double>> bulkVariables;
+
+        //! the results of the last bulk evaluation
+        std::vector<double> bulkResults;
+
+        //! Hold a random number engine always using the same seed for this stream
+        std::minstd_rand0 pseudoRandomEngine{0};
+
+        //! Hold a "real" random number engine
+        std::default_random_engine randomEngine{0};
+
+        /**
+         * Set the coordinate and time linked to the parser
+         */
+        void SetPoint(const double& x, const double& y, const double& z, const double& t);
+
+        /**
+         * Set the coordinate and time linked to the parser, missing dimensions are zero
+         */
+        void SetPoint(const double* xyz, const int& ndims, const double& t);
+
+        /**
+         * Size each bulk variable and the results for a batch
+         * @param size
+         */
+        void PrepareBulk(std::size_t size);
+
+        /**
+         * Copy the coordinates and time for a batch of points into the bulk variables
+         */
+        void FillBulkCoordinates(std::size_t numberPoints, const double* xyz, const int& ndims, const double& t);
+
+        /**
+         * Evaluate the bulk parser for the prepared batch size, the results are stored in bulkResults
+         */
+        void EvalBulk(std::size_t size);
+    };
+
    private:
-    //! Hold a random number engine always using the same seed
-    std::minstd_rand0 pseudoRandomEngine{0};
+    //! the constants used to configure the parser for each thread
+    const std::shared_ptr<ablate::parameters::Parameters> constants;
 
-    //! Hold a "real" random number engine
-    std::default_random_engine randomEngine{0};
+    //! the names of the additional variables in the order they were defined
+    std::vector<std::string> variableNames;
 
-   protected:
-    //! The coordinate linked to the parser
-    mutable double coordinate[3] = {0, 0, 0};
+    //! the state used by the thread that built the formula
+    std::unique_ptr<EvaluationState> primaryState;
 
-    //! the time linked to the parser
-    mutable double time = 0.0;
+    //! the thread that built the formula
+    const std::thread::id primaryThread;
 
-    //! The parser object library for this formula
-    mu::Parser parser;
+    //! the id given to the next formula
+    inline static std::atomic<std::size_t> nextId = 0;
 
+    //! a unique id for this formula used to look up the state of each thread, the address of the formula may be reused
+    const std::size_t id;
+
+    //! the state for each additional thread that evaluated the formula
+    mutable std::vector<std::unique_ptr<EvaluationState>> threadStates;
+
+    //! guards the creation of the thread states
+    mutable std::mutex threadStateMutex;
+
+    /**
+     * Bind the coordinate, time, and additional variables and configure both parsers for a new state
+     * @param state
+     */
+    void InitializeState(EvaluationState& state) const;
+
+   protected:
     //! the formula output for debugging
     const std::string formula;
 
+    //! true if the formula is single valued and can be evaluated with the bulk parser
+    bool bulkSupported = false;
+
+    /**
+     * Get the state for the calling thread, the state for a new thread is created on first use.  Each additional thread receives a deterministic
+     * pseudo random stream based upon the ParallelForChunks chunk in which the thread first evaluated the formula.
+     * @return
+     */
+    EvaluationState& GetState() const;
+
+    /**
+     * Register an additional variable with the parser and bulk parser, x, y, z, and t are always registered.  This must be called in the constructor
+     * before the formula is evaluated.
+     * @param name
+     * @return the index of the variable in EvaluationState::variables
+     */
+    std::size_t DefineVariable(const std::string& name);
+
+    /**
+     * Evaluate the parser for the state and copy the results
+     * @param state
+     * @param numberResults the size of the result
+     * @param result
+     */
+    static void EvalResult(EvaluationState& state, std::size_t numberResults, double* result);
+
+    /**
+     * Determine if the bulk parser can be used, this should be called after the formula has been tested
+     */
+    void CheckBulkSupport();
+
     /**
      * protected constructor to build the formula base
      * @param functionString
      * @param constants
      */
-    explicit FormulaBase(std::string functionString, const std::shared_ptr<ablate::parameters::Parameters>& constants);
+    explicit FormulaBase(std::string functionString, std::shared_ptr<ablate::parameters::Parameters> constants);
 
     /**
      * helper function to convert to a invalid_exception
@@ -52,7 +166,19 @@ class FormulaBase : public MathFunction {
     //! prevent copy of this object
     void operator=(const FormulaBase&) = delete;
 
+    /**
+     * The formula is time invariant if it does not use t or random numbers
+     */
+    bool IsTimeInvariant() const override;
+
    private:
+    /**
+     * Add the constants, helper functions, and expression to a parser
+     * @param formulaParser
+     * @param state the state holding the random engines
+     */
+    void ConfigureParser(mu::Parser& formulaParser, EvaluationState& state) const;
+
     /**
      * mu parser function to compute power given a^2
      * @param a
@@ -19,3 +19,9 @@ void ablate::mathFunctions::FunctionPointer::Eval(const double &x, const double
 void ablate::mathFunctions::FunctionPointer::Eval(const double *xyz, const int &ndims, const double &t, std::vector<double> &result) const {
     function(ndims, t, xyz, result.size(), &result[0], context);
 }
+void ablate::mathFunctions::FunctionPointer::EvalBatch(const double *xyz, std::size_t numberPoints, const int &ndims, const double &t, double *result, std::size_t numberResults,
+                                                       std::size_t stride) const {
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        function(ndims, t, xyz + p * ndims, (PetscInt)numberResults, result + p * stride, context);
+    }
+}
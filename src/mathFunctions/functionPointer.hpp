@@ -22,6 +22,8 @@ class FunctionPointer : public MathFunction {
 
     void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
 
+    void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const override;
+
     inline ablate::mathFunctions::PetscFunction GetPetscFunction() override { return function; }
 
     inline void* GetContext() override { return context; }
@@ -36,6 +36,15 @@ bool ablate::mathFunctions::geom::CylinderShell::InsideGeometry(const double *xy
     return !((dsq > (radiusMax * radiusMax)) || (radiusMin > 0.0 && dsq < (radiusMin * radiusMin)));
 }
 
+ablate::mathFunctions::geom::Geometry::BoundingBox ablate::mathFunctions::geom::CylinderShell::GetBoundingBox() const {
+    BoundingBox boundingBox;
+    for (std::size_t i = 0; i < PetscMin((std::size_t)3, PetscMin(start.size(), end.size())); i++) {
+        boundingBox.lower[i] = PetscMin(start[i], end[i]) - radiusMax;
+        boundingBox.upper[i] = PetscMax(start[i], end[i]) + radiusMax;
+    }
+    return boundingBox;
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::CylinderShell, "assigns a uniform value to all points inside a cylindrical shell",
          ARG(std::vector<double>, "start", "the center of the cylinder start"), ARG(std::vector<double>, "end", "the center of the cylinder end"),
@@ -16,6 +16,8 @@ class CylinderShell : public Geometry {
                   const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {});
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    BoundingBox GetBoundingBox() const override;
 };
 
 }  // namespace ablate::mathFunctions::geom
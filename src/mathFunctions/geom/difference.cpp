@@ -1,13 +1,40 @@
 #include "difference.hpp"
 
+#include <numeric>
 #include <utility>
 
 ablate::mathFunctions::geom::Difference::Difference(std::shared_ptr<ablate::mathFunctions::geom::Geometry> minuend, std::shared_ptr<ablate::mathFunctions::geom::Geometry> subtrahend,
                                                     const std::shared_ptr<mathFunctions::MathFunction> &insideValues, const std::shared_ptr<mathFunctions::MathFunction> &outsideValues)
-    : Geometry(insideValues, outsideValues), minuend(std::move(minuend)), subtrahend(std::move(subtrahend)) {}
+    : Geometry(insideValues, outsideValues),
+      minuend(std::move(minuend)),
+      subtrahend(std::move(subtrahend)),
+      minuendBoundingBox(this->minuend->GetBoundingBox()),
+      subtrahendBoundingBox(this->subtrahend->GetBoundingBox()) {}
 
 bool ablate::mathFunctions::geom::Difference::InsideGeometry(const double *xyz, const int &ndims, const double &time) const {
-    return minuend->InsideGeometry(xyz, ndims, time) && !subtrahend->InsideGeometry(xyz, ndims, time);
+    return minuendBoundingBox.Contains(xyz, ndims) && minuend->InsideGeometry(xyz, ndims, time) &&
+           !(subtrahendBoundingBox.Contains(xyz, ndims) && subtrahend->InsideGeometry(xyz, ndims, time));
+}
+
+void ablate::mathFunctions::geom::Difference::InsideGeometryBatch(const double *xyz, std::size_t numberPoints, const int &ndims, const double &time, std::vector<bool> &inside) const {
+    std::vector<std::size_t> points(numberPoints);
+    std::iota(points.begin(), points.end(), 0);
+    ClassifyPoints(*minuend, minuendBoundingBox, xyz, points, ndims, time, inside);
+
+    // remove the points inside the minuend that are also inside the subtrahend
+    points.clear();
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        if (inside[p]) {
+            points.push_back(p);
+        }
+    }
+    std::vector<bool> subtrahendInside;
+    ClassifyPoints(*subtrahend, subtrahendBoundingBox, xyz, points, ndims, time, subtrahendInside);
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (subtrahendInside[i]) {
+            inside[points[i]] = false;
+        }
+    }
 }
 
 #include "registrar.hpp"
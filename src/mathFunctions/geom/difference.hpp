@@ -10,11 +10,22 @@ class Difference : public Geometry {
     const std::shared_ptr<ablate::mathFunctions::geom::Geometry> minuend;
     const std::shared_ptr<ablate::mathFunctions::geom::Geometry> subtrahend;
 
+    //! the bounding boxes used to skip the inside tests
+    const BoundingBox minuendBoundingBox;
+    const BoundingBox subtrahendBoundingBox;
+
    public:
     explicit Difference(std::shared_ptr<ablate::mathFunctions::geom::Geometry> minuend, std::shared_ptr<ablate::mathFunctions::geom::Geometry> subtrahend,
                         const std::shared_ptr<mathFunctions::MathFunction>& insideValues = {}, const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {});
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    /**
+     * The subtrahend only classifies the points inside of the minuend
+     */
+    void InsideGeometryBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& time, std::vector<bool>& inside) const override;
+
+    BoundingBox GetBoundingBox() const override { return minuendBoundingBox; }
 };
 }  // namespace ablate::mathFunctions::geom
 
@@ -1,4 +1,5 @@
 #include "geometry.hpp"
+#include <algorithm>
 #include "mathFunctions/functionFactory.hpp"
 
 ablate::mathFunctions::geom::Geometry::Geometry(const std::shared_ptr<mathFunctions::MathFunction> &insideValuesIn, const std::shared_ptr<mathFunctions::MathFunction> &outsideValuesIn)
@@ -47,5 +48,65 @@ void ablate::mathFunctions::geom::Geometry::Eval(const double *xyz, const int &n
     }
 }
 
+void ablate::mathFunctions::geom::Geometry::EvalBatch(const double *xyz, std::size_t numberPoints, const int &ndims, const double &t, double *result, std::size_t numberResults,
+                                                      std::size_t stride) const {
+    // classify the batch and gather the inside and outside points
+    std::vector<bool> inside;
+    InsideGeometryBatch(xyz, numberPoints, ndims, t, inside);
+    std::vector<std::size_t> points[2];
+    std::vector<double> coordinates[2];
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        const std::size_t side = inside[p] ? 0 : 1;
+        points[side].push_back(p);
+        coordinates[side].insert(coordinates[side].end(), xyz + p * ndims, xyz + (p + 1) * ndims);
+    }
+
+    // evaluate each side as a batch and scatter the values back
+    std::vector<double> values;
+    for (std::size_t side = 0; side < 2; side++) {
+        if (points[side].empty()) {
+            continue;
+        }
+        const auto &function = side == 0 ? insideValues : outsideValues;
+        values.resize(points[side].size() * numberResults);
+        function->EvalBatch(coordinates[side].data(), points[side].size(), ndims, t, values.data(), numberResults, numberResults);
+        for (std::size_t i = 0; i < points[side].size(); i++) {
+            std::copy_n(values.data() + i * numberResults, numberResults, result + points[side][i] * stride);
+        }
+    }
+}
+
+void ablate::mathFunctions::geom::Geometry::InsideGeometryBatch(const double *xyz, std::size_t numberPoints, const int &ndims, const double &time, std::vector<bool> &inside) const {
+    inside.resize(numberPoints);
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        inside[p] = InsideGeometry(xyz + p * ndims, ndims, time);
+    }
+}
+
+void ablate::mathFunctions::geom::Geometry::ClassifyPoints(const Geometry &geometry, const BoundingBox &boundingBox, const double *xyz, const std::vector<std::size_t> &points, const int &ndims,
+                                                           const double &time, std::vector<bool> &inside) {
+    inside.assign(points.size(), false);
+
+    // only the points inside the bounding box are classified by the geometry
+    std::vector<std::size_t> candidates;
+    std::vector<double> coordinates;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        const double *point = xyz + points[i] * ndims;
+        if (boundingBox.Contains(point, ndims)) {
+            candidates.push_back(i);
+            coordinates.insert(coordinates.end(), point, point + ndims);
+        }
+    }
+    if (candidates.empty()) {
+        return;
+    }
+
+    std::vector<bool> candidateInside;
+    geometry.InsideGeometryBatch(coordinates.data(), candidates.size(), ndims, time, candidateInside);
+    for (std::size_t c = 0; c < candidates.size(); c++) {
+        inside[candidates[c]] = candidateInside[c];
+    }
+}
+
 #include "registrar.hpp"
 REGISTER_DERIVED(ablate::mathFunctions::MathFunction, ablate::mathFunctions::geom::Geometry);
\ No newline at end of file
@@ -2,11 +2,34 @@
 #define ABLATELIBRARY_GEOMETRY_HPP
 
 #include <mathFunctions/mathFunction.hpp>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace ablate::mathFunctions::geom {
 
 class Geometry : public MathFunction {
+   public:
+    /**
+     * Axis aligned bounds of a geometry used to skip inside tests, an unbounded box contains every point
+     */
+    struct BoundingBox {
+        double lower[3] = {-std::numeric_limits<double>::max(), -std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+        double upper[3] = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+
+        /**
+         * returns true if the point may be inside the geometry
+         */
+        inline bool Contains(const double* xyz, const int& ndims) const {
+            for (int d = 0; d < ndims && d < 3; d++) {
+                if (xyz[d] < lower[d] || xyz[d] > upper[d]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
    private:
     const std::shared_ptr<mathFunctions::MathFunction> insideValues;
     const std::shared_ptr<mathFunctions::MathFunction> outsideValues;
@@ -24,6 +47,19 @@ class Geometry : public MathFunction {
 
     static PetscErrorCode GeometryPetscFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
 
+    /**
+     * Classifies the listed points of the batch with the geometry, points outside of the bounding box are not passed to the geometry
+     * @param geometry
+     * @param boundingBox the bounding box of the geometry
+     * @param xyz the coordinates of every point in the batch
+     * @param points the points in the batch to classify
+     * @param ndims
+     * @param time
+     * @param inside the result for each listed point
+     */
+    static void ClassifyPoints(const Geometry& geometry, const BoundingBox& boundingBox, const double* xyz, const std::vector<std::size_t>& points, const int& ndims, const double& time,
+                               std::vector<bool>& inside);
+
    public:
     double Eval(const double& x, const double& y, const double& z, const double& t) const override;
 
@@ -33,6 +69,16 @@ class Geometry : public MathFunction {
 
     void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
 
+    /**
+     * Sorts the batch into inside and outside points so each of the value functions is evaluated as a single batch
+     */
+    void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const override;
+
+    /**
+     * The geometry is assumed to be fixed, so it is time invariant when both the inside and outside values are
+     */
+    bool IsTimeInvariant() const override { return insideValues->IsTimeInvariant() && outsideValues->IsTimeInvariant(); }
+
     void* GetContext() override { return this; }
 
     PetscFunction GetPetscFunction() override { return GeometryPetscFunction; }
@@ -46,6 +92,21 @@ class Geometry : public MathFunction {
      */
     virtual bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const = 0;
 
+    /**
+     * determines if each point in the batch is inside the geometry, by default each point is tested with InsideGeometry
+     * @param xyz the coordinates of each point in [point*ndims + d] order
+     * @param numberPoints
+     * @param ndims
+     * @param time
+     * @param inside the result for each point
+     */
+    virtual void InsideGeometryBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& time, std::vector<bool>& inside) const;
+
+    /**
+     * The bounds of the points inside of the geometry, by default the geometry is unbounded
+     */
+    virtual BoundingBox GetBoundingBox() const { return {}; }
+
     /**
      * Returns the inside values function
      */
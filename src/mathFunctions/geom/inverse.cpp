@@ -1,9 +1,19 @@
 #include "inverse.hpp"
+#include <numeric>
 
 ablate::mathFunctions::geom::Inverse::Inverse(const std::shared_ptr<ablate::mathFunctions::geom::Geometry> &geometry)
-    : Geometry(geometry->InsideValues(), geometry->OutsideValues()), geometry(geometry) {}
+    : Geometry(geometry->InsideValues(), geometry->OutsideValues()), geometry(geometry), geometryBoundingBox(geometry->GetBoundingBox()) {}
 
-bool ablate::mathFunctions::geom::Inverse::InsideGeometry(const double *xyz, const int &ndims, const double &time) const { return !geometry->InsideGeometry(xyz, ndims, time); }
+bool ablate::mathFunctions::geom::Inverse::InsideGeometry(const double *xyz, const int &ndims, const double &time) const {
+    return !(geometryBoundingBox.Contains(xyz, ndims) && geometry->InsideGeometry(xyz, ndims, time));
+}
+
+void ablate::mathFunctions::geom::Inverse::InsideGeometryBatch(const double *xyz, std::size_t numberPoints, const int &ndims, const double &time, std::vector<bool> &inside) const {
+    std::vector<std::size_t> points(numberPoints);
+    std::iota(points.begin(), points.end(), 0);
+    ClassifyPoints(*geometry, geometryBoundingBox, xyz, points, ndims, time, inside);
+    inside.flip();
+}
 
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::Inverse, "Inverses the supplied geometry.",
@@ -9,10 +9,15 @@ class Inverse : public Geometry {
    private:
     const std::shared_ptr<ablate::mathFunctions::geom::Geometry> geometry;
 
+    //! the bounding box of the base geometry, every point outside of it is inside the inverse
+    const BoundingBox geometryBoundingBox;
+
    public:
     explicit Inverse(const std::shared_ptr<ablate::mathFunctions::geom::Geometry>& geometry);
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    void InsideGeometryBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& time, std::vector<bool>& inside) const override;
 };
 }  // namespace ablate::mathFunctions::geom
 
@@ -13,6 +13,8 @@ class Sphere : public Geometry {
     Sphere(std::vector<double> center, double radius, const std::shared_ptr<mathFunctions::MathFunction>& insideValues = {}, const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {});
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    BoundingBox GetBoundingBox() const override;
 };
 
 }  // namespace ablate::mathFunctions::geom
@@ -1,17 +1,66 @@
 #include "surface.hpp"
 #include <stdexcept>
+#include "environment/fileBroadcast.hpp"
 #include "utilities/petscError.hpp"
 
 ablate::mathFunctions::geom::Surface::Surface(const std::filesystem::path &meshPath, const std::shared_ptr<mathFunctions::MathFunction> &insideValues,
-                                              const std::shared_ptr<mathFunctions::MathFunction> &outsideValues, int egadsVerboseLevel)
-    : Geometry(insideValues, outsideValues) {
-    // Create a surface from the meshFile
-    if (!exists(meshPath)) {
+                                              const std::shared_ptr<mathFunctions::MathFunction> &outsideValues, int egadsVerboseLevel, int voxelResolution)
+    : Geometry(insideValues, outsideValues), voxelResolution(voxelResolution) {
+    // Create a surface from the meshFile, when broadcasting files only the root rank reads it from the shared file system
+    const auto localMeshPath = environment::FileBroadcast::Localize(meshPath);
+    if (!exists(localMeshPath)) {
         throw std::runtime_error("Cannot locate ablate::mathFunctions::geom::Surface::Surface file " + meshPath.string());
     }
     EG_open(&context) >> checkError;
     EG_setOutLevel(context, egadsVerboseLevel);
-    EG_loadModel(context, 0, meshPath.c_str(), &model) >> checkError;
+    EG_loadModel(context, 0, localMeshPath.c_str(), &model) >> checkError;
+
+    // Get all the bodies in this domain
+    ego geom, *modelBodies;
+    int numberBodies;
+    int oclass, mtype, *senses;
+    EG_getTopology(model, &geom, &oclass, &mtype, nullptr, &numberBodies, &modelBodies, &senses) >> checkError;
+
+    // store the bounds of each body
+    for (int d = 0; d < 3; d++) {
+        boundingBox.lower[d] = std::numeric_limits<double>::max();
+        boundingBox.upper[d] = -std::numeric_limits<double>::max();
+    }
+    for (int b = 0; b < numberBodies; b++) {
+        double box[6];
+        EG_getBoundingBox(modelBodies[b], box) >> checkError;
+
+        BoundingBox bodyBoundingBox;
+        for (int d = 0; d < 3; d++) {
+            bodyBoundingBox.lower[d] = box[d];
+            bodyBoundingBox.upper[d] = box[d + 3];
+            boundingBox.lower[d] = PetscMin(boundingBox.lower[d], box[d]);
+            boundingBox.upper[d] = PetscMax(boundingBox.upper[d], box[d + 3]);
+        }
+        bodies.push_back(modelBodies[b]);
+        bodyBoundingBoxes.push_back(bodyBoundingBox);
+    }
+
+    // pad the bounds so points on the surface are still tested
+    if (!bodies.empty()) {
+        double diagonal = 0.0;
+        for (int d = 0; d < 3; d++) {
+            diagonal += PetscSqr(boundingBox.upper[d] - boundingBox.lower[d]);
+        }
+        const double padding = 1E-8 * PetscSqrtReal(diagonal);
+        for (int d = 0; d < 3; d++) {
+            boundingBox.lower[d] -= padding;
+            boundingBox.upper[d] += padding;
+            for (auto &bodyBoundingBox : bodyBoundingBoxes) {
+                bodyBoundingBox.lower[d] -= padding;
+                bodyBoundingBox.upper[d] += padding;
+            }
+        }
+    }
+
+    if (voxelResolution > 0 && !bodies.empty()) {
+        BuildVoxelCache();
+    }
 }
 
 ablate::mathFunctions::geom::Surface::~Surface() {
@@ -23,21 +72,86 @@ ablate::mathFunctions::geom::Surface::~Surface() {
     }
 }
 
-bool ablate::mathFunctions::geom::Surface::InsideGeometry(const double *xyz, const int &ndims, const double &time) const {
-    // Get all the bod`ies in this domain
-    ego geom, *bodies;
-    int numberBodies;
-    int oclass, mtype, *senses;
+void ablate::mathFunctions::geom::Surface::BuildVoxelCache() {
+    double diagonal = 0.0;
+    for (int d = 0; d < 3; d++) {
+        voxelSize[d] = PetscMax((boundingBox.upper[d] - boundingBox.lower[d]) / voxelResolution, PETSC_SMALL);
+        diagonal += PetscSqr(boundingBox.upper[d] - boundingBox.lower[d]);
+    }
+    diagonal = PetscSqrtReal(diagonal);
+    voxels.assign((std::size_t)voxelResolution * voxelResolution * voxelResolution, Outside);
 
-    EG_getTopology(model, &geom, &oclass, &mtype, nullptr, &numberBodies, &bodies, &senses) >> checkError;
+    // the tessellation is within the sag tolerance of the surface, so any voxel within that distance of a triangle may hold surface points
+    double tessellationParameters[3] = {0.025 * diagonal, 0.001 * diagonal, 15.0};
+    const double tolerance = 2.0 * tessellationParameters[1];
+    for (const auto &body : bodies) {
+        ego tessellation;
+        EG_makeTessBody(body, tessellationParameters, &tessellation) >> checkError;
+        int numberFaces;
+        EG_getBodyTopos(body, nullptr, FACE, &numberFaces, nullptr) >> checkError;
 
-    // Make sure always supply 3D array
-    double coord[3] = {0.0, 0.0, 0.0};
-    PetscArraycpy(coord, xyz, ndims);
+        for (int f = 1; f <= numberFaces; f++) {
+            int numberVertices, numberTriangles;
+            const double *xyz, *uv;
+            const int *ptype, *pindex, *triangles, *triangleNeighbors;
+            EG_getTessFace(tessellation, f, &numberVertices, &xyz, &uv, &ptype, &pindex, &numberTriangles, &triangles, &triangleNeighbors) >> checkError;
+
+            for (int t = 0; t < numberTriangles; t++) {
+                // mark every voxel overlapping the padded triangle bounds
+                double lower[3], upper[3];
+                for (int d = 0; d < 3; d++) {
+                    lower[d] = std::numeric_limits<double>::max();
+                    upper[d] = -std::numeric_limits<double>::max();
+                    for (int v = 0; v < 3; v++) {
+                        const double x = xyz[3 * (triangles[3 * t + v] - 1) + d];
+                        lower[d] = PetscMin(lower[d], x - tolerance);
+                        upper[d] = PetscMax(upper[d], x + tolerance);
+                    }
+                }
+                std::size_t start[3], end[3];
+                for (int d = 0; d < 3; d++) {
+                    start[d] = (std::size_t)PetscMax((int)((lower[d] - boundingBox.lower[d]) / voxelSize[d]), 0);
+                    end[d] = (std::size_t)PetscMin((int)((upper[d] - boundingBox.lower[d]) / voxelSize[d]) + 1, voxelResolution);
+                }
+                for (std::size_t k = start[2]; k < end[2]; k++) {
+                    for (std::size_t j = start[1]; j < end[1]; j++) {
+                        for (std::size_t i = start[0]; i < end[0]; i++) {
+                            voxels[(k * voxelResolution + j) * voxelResolution + i] = Near;
+                        }
+                    }
+                }
+            }
+        }
+        EG_deleteObject(tessellation) >> checkError;
+    }
+
+    // the surface does not cross a row of voxels between near voxels, so a single test classifies the whole run
+    for (int k = 0; k < voxelResolution; k++) {
+        for (int j = 0; j < voxelResolution; j++) {
+            const std::size_t row = ((std::size_t)k * voxelResolution + j) * voxelResolution;
+            int i = 0;
+            while (i < voxelResolution) {
+                if (voxels[row + i] == Near) {
+                    i++;
+                    continue;
+                }
+                const double center[3] = {boundingBox.lower[0] + (i + 0.5) * voxelSize[0], boundingBox.lower[1] + (j + 0.5) * voxelSize[1], boundingBox.lower[2] + (k + 0.5) * voxelSize[2]};
+                const VoxelState state = InsideBodies(center) ? Inside : Outside;
+                for (; i < voxelResolution && voxels[row + i] != Near; i++) {
+                    voxels[row + i] = state;
+                }
+            }
+        }
+    }
+}
 
+bool ablate::mathFunctions::geom::Surface::InsideBodies(const double coord[3]) const {
     // March over each body
     bool inside = false;
-    for (int b = 0; b < numberBodies; b++) {
+    for (std::size_t b = 0; b < bodies.size() && !inside; b++) {
+        if (!bodyBoundingBoxes[b].Contains(coord, 3)) {
+            continue;
+        }
         int result = EG_inTopology(bodies[b], coord);
         if (result == 0) {
             inside = true;
@@ -49,8 +163,28 @@ bool ablate::mathFunctions::geom::Surface::InsideGeometry(const double *xyz, con
     return inside;
 }
 
+bool ablate::mathFunctions::geom::Surface::InsideGeometry(const double *xyz, const int &ndims, const double &) const {
+    // Make sure always supply 3D array
+    double coord[3] = {0.0, 0.0, 0.0};
+    PetscArraycpy(coord, xyz, ndims);
+
+    if (!boundingBox.Contains(coord, 3)) {
+        return false;
+    }
+
+    // only points near the surface need to be tested with egads
+    if (!voxels.empty()) {
+        const auto state = voxels[VoxelIndex(coord)];
+        if (state != Near) {
+            return state == Inside;
+        }
+    }
+    return InsideBodies(coord);
+}
+
 #include "registrar.hpp"
 REGISTER(ablate::mathFunctions::geom::Geometry, ablate::mathFunctions::geom::Surface, "Assigned a unified number to all points inside of cad geometry file.",
          ARG(std::filesystem::path, "path", "the path to the step/stp file"), OPT(ablate::mathFunctions::MathFunction, "insideValues", "the values for inside the sphere, defaults to 1"),
          OPT(ablate::mathFunctions::MathFunction, "outsideValues", "the outside values, defaults to zero"),
-         OPT(int, "egadsVerboseLevel", "the egads verbose level for output (default is 0, max is 3)"));
\ No newline at end of file
+         OPT(int, "egadsVerboseLevel", "the egads verbose level for output (default is 0, max is 3)"),
+         OPT(int, "voxelResolution", "the number of voxels in each direction used to cache the classification of points away from the surface (default is 0, no cache)"));
@@ -4,21 +4,69 @@
 #include <egads.h>
 #include <petsc.h>
 #include <filesystem>
+#include <vector>
 #include "geometry.hpp"
 
 namespace ablate::mathFunctions::geom {
 
+/**
+ * Classifies points against the bodies in a cad file.  Each body is only tested when the point is inside of its bounding box.  An optional voxel cache over
+ * the bounds of the bodies stores the state of every voxel away from the tessellated surface so that only points near the surface are tested with egads.
+ */
 class Surface : public Geometry {
    private:
     ego context = nullptr;
     ego model = nullptr;
 
+    //! the bodies in the model and the bounding box of each
+    std::vector<ego> bodies;
+    std::vector<BoundingBox> bodyBoundingBoxes;
+
+    //! the bounds of every body
+    BoundingBox boundingBox;
+
+    //! the state of each voxel in the classification cache
+    enum VoxelState : char { Outside = 0, Inside = 1, Near = 2 };
+
+    //! the number of voxels in each direction, zero disables the cache
+    const int voxelResolution;
+
+    //! the voxel states in [(k*res + j)*res + i] order
+    std::vector<VoxelState> voxels;
+
+    //! the size of each voxel
+    double voxelSize[3] = {1.0, 1.0, 1.0};
+
+    /**
+     * Tests the point against each body with egads
+     * @param coord a 3D point
+     */
+    bool InsideBodies(const double coord[3]) const;
+
+    /**
+     * Marks the voxels near the tessellated surface and classifies the remaining voxels
+     */
+    void BuildVoxelCache();
+
+    /**
+     * Returns the index of the voxel holding the 3D point
+     */
+    inline std::size_t VoxelIndex(const double coord[3]) const {
+        std::size_t index[3];
+        for (int d = 0; d < 3; d++) {
+            index[d] = (std::size_t)PetscMax(PetscMin((int)((coord[d] - boundingBox.lower[d]) / voxelSize[d]), voxelResolution - 1), 0);
+        }
+        return (index[2] * voxelResolution + index[1]) * voxelResolution + index[0];
+    }
+
    public:
     explicit Surface(const std::filesystem::path& meshPath, const std::shared_ptr<mathFunctions::MathFunction>& insideValues = {},
-                     const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {}, int egadsVerboseLevel = 0);
+                     const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {}, int egadsVerboseLevel = 0, int voxelResolution = 0);
     ~Surface() override;
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    BoundingBox GetBoundingBox() const override { return boundingBox; }
 };
 }  // namespace ablate::mathFunctions::geom
 
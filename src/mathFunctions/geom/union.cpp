@@ -1,13 +1,63 @@
 #include "union.hpp"
 #include <algorithm>
+#include <numeric>
 #include <utility>
 
 ablate::mathFunctions::geom::Union::Union(std::vector<std::shared_ptr<ablate::mathFunctions::geom::Geometry>> geometries, const std::shared_ptr<mathFunctions::MathFunction> &insideValues,
                                           const std::shared_ptr<mathFunctions::MathFunction> &outsideValues)
-    : Geometry(insideValues, outsideValues), geometries(std::move(geometries)) {}
+    : Geometry(insideValues, outsideValues), geometries(std::move(geometries)) {
+    for (const auto &geometry : this->geometries) {
+        boundingBoxes.push_back(geometry->GetBoundingBox());
+    }
+}
 
 bool ablate::mathFunctions::geom::Union::InsideGeometry(const double *xyz, const int &ndims, const double &time) const {
-    return std::any_of(geometries.begin(), geometries.end(), [&](const auto &geometry) { return geometry->InsideGeometry(xyz, ndims, time); });
+    for (std::size_t g = 0; g < geometries.size(); g++) {
+        if (boundingBoxes[g].Contains(xyz, ndims) && geometries[g]->InsideGeometry(xyz, ndims, time)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ablate::mathFunctions::geom::Union::InsideGeometryBatch(const double *xyz, std::size_t numberPoints, const int &ndims, const double &time, std::vector<bool> &inside) const {
+    inside.assign(numberPoints, false);
+    std::vector<std::size_t> remaining(numberPoints);
+    std::iota(remaining.begin(), remaining.end(), 0);
+
+    std::vector<bool> geometryInside;
+    std::vector<std::size_t> outside;
+    for (std::size_t g = 0; g < geometries.size() && !remaining.empty(); g++) {
+        ClassifyPoints(*geometries[g], boundingBoxes[g], xyz, remaining, ndims, time, geometryInside);
+
+        // only the points outside of this geometry are passed to the next
+        outside.clear();
+        for (std::size_t i = 0; i < remaining.size(); i++) {
+            if (geometryInside[i]) {
+                inside[remaining[i]] = true;
+            } else {
+                outside.push_back(remaining[i]);
+            }
+        }
+        remaining.swap(outside);
+    }
+}
+
+ablate::mathFunctions::geom::Geometry::BoundingBox ablate::mathFunctions::geom::Union::GetBoundingBox() const {
+    // the union is bounded in a direction only if every geometry is bounded
+    BoundingBox boundingBox;
+    if (boundingBoxes.empty()) {
+        return boundingBox;
+    }
+    for (int d = 0; d < 3; d++) {
+        boundingBox.lower[d] = std::numeric_limits<double>::max();
+        boundingBox.upper[d] = -std::numeric_limits<double>::max();
+        for (const auto &geometryBox : boundingBoxes) {
+            boundingBox.lower[d] = std::min(boundingBox.lower[d], geometryBox.lower[d]);
+            boundingBox.upper[d] = std::max(boundingBox.upper[d], geometryBox.upper[d]);
+        }
+    }
+    return boundingBox;
 }
 
 #include "registrar.hpp"
@@ -9,11 +9,21 @@ class Union : public Geometry {
    private:
     const std::vector<std::shared_ptr<ablate::mathFunctions::geom::Geometry>> geometries;
 
+    //! the bounding box of each geometry, used to skip the inside tests
+    std::vector<BoundingBox> boundingBoxes;
+
    public:
     explicit Union(std::vector<std::shared_ptr<ablate::mathFunctions::geom::Geometry>> geometries, const std::shared_ptr<mathFunctions::MathFunction>& insideValues = {},
                    const std::shared_ptr<mathFunctions::MathFunction>& outsideValues = {});
 
     bool InsideGeometry(const double* xyz, const int& ndims, const double& time) const override;
+
+    /**
+     * Each geometry only classifies the points that are not yet inside the union
+     */
+    void InsideGeometryBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& time, std::vector<bool>& inside) const override;
+
+    BoundingBox GetBoundingBox() const override;
 };
 }  // namespace ablate::mathFunctions::geom
 
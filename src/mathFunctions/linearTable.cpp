@@ -2,15 +2,15 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include "environment/fileBroadcast.hpp"
 
 ablate::mathFunctions::LinearTable::LinearTable(std::filesystem::path inputFile, std::string xAxisColumn, std::vector<std::string> yColumns, std::shared_ptr<MathFunction> locationToXCoordFunction)
     : independentColumnName(xAxisColumn), dependentColumnsNames(yColumns), independentValueFunction(locationToXCoordFunction) {
-    // open the file
-    std::fstream inputFileStream;
-    inputFileStream.open(inputFile, std::ios::in);
+    // read the file, when broadcasting files only the root rank reads the table from the shared file system
+    std::istringstream inputFileStream(environment::FileBroadcast::ReadContents(inputFile));
     ParseInputData(inputFileStream);
-    inputFileStream.close();
 }
 
 ablate::mathFunctions::LinearTable::LinearTable(std::istream& inputStream, std::string xAxisColumn, std::vector<std::string> yColumns, std::shared_ptr<MathFunction> locationToXCoordFunction)
@@ -58,7 +58,7 @@ void ablate::mathFunctions::LinearTable::ParseInputData(std::istream& inputStrea
 
     // size up a double array to hold the values
     std::vector<double> rowValues(headers.size());
-    dependentValues.resize(yIndexes.size());
+    numberDependent = yIndexes.size();
 
     // Now parse each line
     while (std::getline(inputStream, line)) {
@@ -72,20 +72,38 @@ void ablate::mathFunctions::LinearTable::ParseInputData(std::istream& inputStrea
         // now extract the values and place in the columns/xvalues
         independentValues.push_back(rowValues[xIndex]);
         for (std::size_t v = 0; v < yIndexes.size(); v++) {
-            dependentValues[v].push_back(rowValues[yIndexes[v]]);
+            dependentValues.push_back(rowValues[yIndexes[v]]);
         }
     }
+
+    // check for uniformly spaced independent values
+    if (independentValues.size() > 1) {
+        const double spacing = (independentValues.back() - independentValues.front()) / (double)(independentValues.size() - 1);
+        uniform = spacing > 0.0;
+        for (std::size_t i = 1; i < independentValues.size() && uniform; i++) {
+            uniform = PetscAbsReal(independentValues[i] - independentValues.front() - (double)i * spacing) <= 1E-10 * PetscAbsReal(independentValues.back() - independentValues.front());
+        }
+        inverseSpacing = uniform ? 1.0 / spacing : 0.0;
+    }
 }
-void ablate::mathFunctions::LinearTable::Interpolate(double x, size_t numInterpolations, double* result) const {
-    // Determine the upper index
-    std::size_t upIndex = 0;
-    for (upIndex = 1; upIndex < independentValues.size() - 1; upIndex++) {
-        // If the inquiry value is less then this, we have the right index
-        if (x < independentValues[upIndex]) {
-            break;
+
+std::size_t ablate::mathFunctions::LinearTable::FindUpperIndex(double x) const {
+    const std::size_t lastIndex = independentValues.size() - 1;
+    if (uniform) {
+        const double position = (x - independentValues.front()) * inverseSpacing;
+        if (!(position >= 0.0)) {
+            return 1;
         }
+        return position >= (double)(lastIndex - 1) ? lastIndex : (std::size_t)position + 1;
     }
 
+    // the first value greater than x, excluding the first and last values
+    return std::distance(independentValues.begin(), std::upper_bound(independentValues.begin() + 1, independentValues.end() - 1, x));
+}
+void ablate::mathFunctions::LinearTable::Interpolate(double x, size_t numInterpolations, double* result) const {
+    // Determine the upper index
+    const std::size_t upIndex = FindUpperIndex(x);
+
     // We need the x-x0 and deltaX
     double x_x0 = x - independentValues[upIndex - 1];
     double deltaX = independentValues[upIndex] - independentValues[upIndex - 1];
@@ -99,8 +117,11 @@ void ablate::mathFunctions::LinearTable::Interpolate(double x, size_t numInterpo
     }
 
     // Do the linear interpolation for each variable
+    const double* lower = dependentValues.data() + (upIndex - 1) * numberDependent;
+    const double* upper = lower + numberDependent;
+    const double fraction = x_x0 / deltaX;
     for (std::size_t s = 0; s < numInterpolations; s++) {
-        result[s] = dependentValues[s][upIndex - 1] + (x_x0 / deltaX) * (dependentValues[s][upIndex] - dependentValues[s][upIndex - 1]);
+        result[s] = lower[s] + fraction * (upper[s] - lower[s]);
     }
 }
 double ablate::mathFunctions::LinearTable::Eval(const double& x, const double& y, const double& z, const double& t) const {
@@ -117,12 +138,29 @@ double ablate::mathFunctions::LinearTable::Eval(const double* xyz, const int& nd
 }
 void ablate::mathFunctions::LinearTable::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
     double independentValue = independentValueFunction->Eval(x, y, z, t);
-    Interpolate(independentValue, result.size() < dependentValues.size() ? result.size() : dependentValues.size(), &result[0]);
+    Interpolate(independentValue, PetscMin(result.size(), numberDependent), &result[0]);
 }
 void ablate::mathFunctions::LinearTable::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
     double independentValue = independentValueFunction->Eval(xyz, ndims, t);
-    Interpolate(independentValue, result.size() < dependentValues.size() ? result.size() : dependentValues.size(), &result[0]);
+    Interpolate(independentValue, PetscMin(result.size(), numberDependent), &result[0]);
+}
+void ablate::mathFunctions::LinearTable::EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const {
+    const std::size_t numberInterpolations = PetscMin(numberResults, numberDependent);
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        Interpolate(independentValueFunction->Eval(xyz + p * ndims, ndims, t), numberInterpolations, result + p * stride);
+    }
+}
+
+std::vector<std::vector<double>> ablate::mathFunctions::LinearTable::GetDependentValues() const {
+    std::vector<std::vector<double>> columns(numberDependent);
+    for (std::size_t s = 0; s < numberDependent; s++) {
+        for (std::size_t row = 0; row < independentValues.size(); row++) {
+            columns[s].push_back(dependentValues[row * numberDependent + s]);
+        }
+    }
+    return columns;
 }
+
 PetscErrorCode ablate::mathFunctions::LinearTable::LinearInterpolatorPetscFunction(PetscInt dim, PetscReal time, const PetscReal* x, PetscInt nf, PetscScalar* u, void* ctx) {
     // wrap in try, so we return petsc error code instead of c++ exception
     PetscFunctionBeginUser;
@@ -130,7 +168,7 @@ PetscErrorCode ablate::mathFunctions::LinearTable::LinearInterpolatorPetscFuncti
         auto table = (LinearTable*)ctx;
 
         double independentValue = table->independentValueFunction->Eval(x, dim, time);
-        table->Interpolate(independentValue, nf < (PetscInt)table->dependentValues.size() ? nf : table->dependentValues.size(), u);
+        table->Interpolate(independentValue, PetscMin((std::size_t)nf, table->numberDependent), u);
 
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
@@ -17,7 +17,16 @@ namespace ablate::mathFunctions {
 class LinearTable : public MathFunction {
    private:
     std::vector<double> independentValues;
-    std::vector<std::vector<double>> dependentValues;
+
+    //! the dependent values interleaved by row, [row*numberDependent + column], so an interpolation reads two contiguous rows
+    std::vector<double> dependentValues;
+
+    //! the number of dependent columns
+    std::size_t numberDependent = 0;
+
+    //! if the independent values are uniformly spaced the interval is computed directly with the inverse spacing
+    bool uniform = false;
+    double inverseSpacing = 0.0;
     const std::string independentColumnName;
     const std::vector<std::string> dependentColumnsNames;
     const std::shared_ptr<MathFunction> independentValueFunction;
@@ -25,6 +34,11 @@ class LinearTable : public MathFunction {
    private:
     void ParseInputData(std::istream& inputFile);
 
+    /**
+     * Find the upper index of the interval containing x, bounded to [1, size - 1].  This is O(1) for uniform tables and a binary search otherwise.
+     */
+    std::size_t FindUpperIndex(double x) const;
+
     void Interpolate(double x, size_t numInterpolations, double* result) const;
 
     static PetscErrorCode LinearInterpolatorPetscFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
@@ -41,13 +55,23 @@ class LinearTable : public MathFunction {
 
     void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
 
+    /**
+     * Evaluate the table at a batch of points without allocating
+     */
+    void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const override;
+
+    bool IsTimeInvariant() const override { return independentValueFunction->IsTimeInvariant(); }
+
     void* GetContext() override { return this; }
 
     PetscFunction GetPetscFunction() override { return LinearInterpolatorPetscFunction; }
 
     const std::vector<double>& GetIndependentValues() const { return independentValues; }
 
-    const std::vector<std::vector<double>>& GetDependentValues() const { return dependentValues; }
+    /**
+     * Copy the dependent values into columns
+     */
+    std::vector<std::vector<double>> GetDependentValues() const;
 };
 }  // namespace ablate::mathFunctions
 #endif  // ABLATELIBRARY_LINEARTABLE_HPP
@@ -1,6 +1,7 @@
 #ifndef ABLATELIBRARY_MATHFUNCTION_HPP
 #define ABLATELIBRARY_MATHFUNCTION_HPP
 #include <petsc.h>
+#include <algorithm>
 #include <vector>
 
 namespace ablate::mathFunctions {
@@ -20,6 +21,37 @@ class MathFunction {
 
     virtual void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const = 0;
 
+    /**
+     * Evaluate the function at a batch of points in one call.  The default evaluates one point at a time, functions that can evaluate a batch more
+     * efficiently override it.
+     * @param xyz the point coordinates in [point*ndims + d] order
+     * @param numberPoints the number of points
+     * @param ndims
+     * @param t
+     * @param result the values for each point, the values for point p start at result[p*stride]
+     * @param numberResults the number of values computed for each point
+     * @param stride the distance between the values of consecutive points in result
+     */
+    virtual void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const {
+        if (numberResults == 1) {
+            for (std::size_t p = 0; p < numberPoints; p++) {
+                result[p * stride] = Eval(xyz + p * ndims, ndims, t);
+            }
+            return;
+        }
+        std::vector<double> pointResult(numberResults);
+        for (std::size_t p = 0; p < numberPoints; p++) {
+            Eval(xyz + p * ndims, ndims, t, pointResult);
+            std::copy(pointResult.begin(), pointResult.end(), result + p * stride);
+        }
+    }
+
+    /**
+     * Returns true if the function values do not depend upon time, this allows the values to be computed once and reused.  The default assumes that the
+     * function depends upon time.
+     */
+    virtual bool IsTimeInvariant() const { return false; }
+
     virtual void* GetContext() = 0;
 
     virtual PetscFunction GetPetscFunction() = 0;
@@ -0,0 +1,216 @@
+#include "multiLinearTable.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include "environment/fileBroadcast.hpp"
+
+ablate::mathFunctions::MultiLinearTable::MultiLinearTable(const std::filesystem::path& file, std::shared_ptr<MathFunction> mappingFunction) : mappingFunction(std::move(mappingFunction)) {
+    if (!this->mappingFunction) {
+        throw std::invalid_argument("The ablate::mathFunctions::MultiLinearTable requires a mappingFunction");
+    }
+
+    // map the entire file, when broadcasting files this is a node local copy of the table
+    const auto localFile = environment::FileBroadcast::Localize(file);
+    int fileDescriptor = open(localFile.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        throw std::invalid_argument("Cannot open ablate::mathFunctions::MultiLinearTable file " + file.string());
+    }
+    struct stat fileStat {};
+    if (fstat(fileDescriptor, &fileStat) != 0) {
+        close(fileDescriptor);
+        throw std::runtime_error("Cannot read the size of ablate::mathFunctions::MultiLinearTable file " + file.string());
+    }
+    mappingSize = (std::size_t)fileStat.st_size;
+    mapping = mappingSize ? mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0) : MAP_FAILED;
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED) {
+        mapping = nullptr;
+        throw std::runtime_error("Cannot map ablate::mathFunctions::MultiLinearTable file " + file.string());
+    }
+
+    // read the header, every entry is eight bytes so the values are aligned
+    const auto bytes = (const char*)mapping;
+    std::size_t offset = 0;
+    auto readHeader = [&](void* destination) {
+        if (offset + 8 > mappingSize) {
+            throw std::invalid_argument("The ablate::mathFunctions::MultiLinearTable file " + file.string() + " is truncated");
+        }
+        std::memcpy(destination, bytes + offset, 8);
+        offset += 8;
+    };
+    try {
+        char identifier[8];
+        readHeader(identifier);
+        if (std::memcmp(identifier, fileIdentifier, 8) != 0) {
+            throw std::invalid_argument("The file " + file.string() + " is not an ablate::mathFunctions::MultiLinearTable file");
+        }
+        std::uint64_t headerValue;
+        readHeader(&headerValue);
+        numberDimensions = headerValue;
+        readHeader(&headerValue);
+        numberDependent = headerValue;
+        if (numberDimensions == 0 || numberDimensions > maxDimensions || numberDependent == 0) {
+            throw std::invalid_argument("The ablate::mathFunctions::MultiLinearTable must have between 1 and " + std::to_string(maxDimensions) + " dimensions and at least one dependent value");
+        }
+
+        std::size_t numberGridPoints = 1;
+        for (std::size_t d = 0; d < numberDimensions; d++) {
+            double lowerBound, upperBound;
+            readHeader(&headerValue);
+            readHeader(&lowerBound);
+            readHeader(&upperBound);
+            if (headerValue < 2 || !(upperBound > lowerBound)) {
+                throw std::invalid_argument("Each dimension of the ablate::mathFunctions::MultiLinearTable must have at least two points and an upper bound greater than the lower bound");
+            }
+            strides.push_back(numberGridPoints);
+            sizes.push_back(headerValue);
+            lowerBounds.push_back(lowerBound);
+            inverseSpacing.push_back((double)(headerValue - 1) / (upperBound - lowerBound));
+            numberGridPoints *= headerValue;
+        }
+
+        if (mappingSize != offset + numberGridPoints * numberDependent * sizeof(double)) {
+            throw std::invalid_argument("The size of the ablate::mathFunctions::MultiLinearTable file " + file.string() + " does not match the header");
+        }
+        values = (const double*)(bytes + offset);
+    } catch (...) {
+        munmap(mapping, mappingSize);
+        mapping = nullptr;
+        throw;
+    }
+
+    // precompute the offset to each corner of a cell
+    for (std::size_t corner = 0; corner < ((std::size_t)1 << numberDimensions); corner++) {
+        std::size_t cornerOffset = 0;
+        for (std::size_t d = 0; d < numberDimensions; d++) {
+            if (corner & ((std::size_t)1 << d)) {
+                cornerOffset += strides[d];
+            }
+        }
+        cornerOffsets.push_back(cornerOffset * numberDependent);
+    }
+}
+
+ablate::mathFunctions::MultiLinearTable::~MultiLinearTable() {
+    if (mapping) {
+        munmap(mapping, mappingSize);
+    }
+}
+
+void ablate::mathFunctions::MultiLinearTable::Interpolate(const double* coordinates, std::size_t numberInterpolations, double* result) const {
+    // locate the cell and the fraction within the cell in each dimension, bounded to the grid
+    double fractions[maxDimensions];
+    std::size_t lowerCorner = 0;
+    for (std::size_t d = 0; d < numberDimensions; d++) {
+        const double position = PetscMin(PetscMax((coordinates[d] - lowerBounds[d]) * inverseSpacing[d], 0.0), (double)(sizes[d] - 1));
+        const std::size_t index = PetscMin((std::size_t)position, sizes[d] - 2);
+        fractions[d] = position - (double)index;
+        lowerCorner += index * strides[d];
+    }
+
+    // sum the weighted contribution of each cell corner, the dependent values of each corner are contiguous
+    const double* lowerValues = values + lowerCorner * numberDependent;
+    std::fill_n(result, numberInterpolations, 0.0);
+    for (std::size_t corner = 0; corner < cornerOffsets.size(); corner++) {
+        double weight = 1.0;
+        for (std::size_t d = 0; d < numberDimensions; d++) {
+            weight *= (corner & ((std::size_t)1 << d)) ? fractions[d] : 1.0 - fractions[d];
+        }
+        const double* cornerValues = lowerValues + cornerOffsets[corner];
+        for (std::size_t s = 0; s < numberInterpolations; s++) {
+            result[s] += weight * cornerValues[s];
+        }
+    }
+}
+
+double ablate::mathFunctions::MultiLinearTable::Eval(const double& x, const double& y, const double& z, const double& t) const {
+    const double xyz[3] = {x, y, z};
+    return Eval(xyz, 3, t);
+}
+
+double ablate::mathFunctions::MultiLinearTable::Eval(const double* xyz, const int& ndims, const double& t) const {
+    double coordinates[maxDimensions];
+    mappingFunction->EvalBatch(xyz, 1, ndims, t, coordinates, numberDimensions, numberDimensions);
+    double result;
+    Interpolate(coordinates, 1, &result);
+    return result;
+}
+
+void ablate::mathFunctions::MultiLinearTable::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
+    const double xyz[3] = {x, y, z};
+    Eval(xyz, 3, t, result);
+}
+
+void ablate::mathFunctions::MultiLinearTable::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
+    double coordinates[maxDimensions];
+    mappingFunction->EvalBatch(xyz, 1, ndims, t, coordinates, numberDimensions, numberDimensions);
+    Interpolate(coordinates, PetscMin(result.size(), numberDependent), result.data());
+}
+
+void ablate::mathFunctions::MultiLinearTable::EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults,
+                                                        std::size_t stride) const {
+    std::vector<double> coordinates(numberPoints * numberDimensions);
+    mappingFunction->EvalBatch(xyz, numberPoints, ndims, t, coordinates.data(), numberDimensions, numberDimensions);
+
+    const std::size_t numberInterpolations = PetscMin(numberResults, numberDependent);
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        Interpolate(coordinates.data() + p * numberDimensions, numberInterpolations, result + p * stride);
+    }
+}
+
+PetscErrorCode ablate::mathFunctions::MultiLinearTable::MultiLinearTablePetscFunction(PetscInt dim, PetscReal time, const PetscReal* x, PetscInt nf, PetscScalar* u, void* ctx) {
+    // wrap in try, so we return petsc error code instead of c++ exception
+    PetscFunctionBeginUser;
+    try {
+        auto table = (MultiLinearTable*)ctx;
+
+        double coordinates[maxDimensions];
+        table->mappingFunction->EvalBatch(x, 1, (int)dim, time, coordinates, table->numberDimensions, table->numberDimensions);
+        table->Interpolate(coordinates, PetscMin((std::size_t)nf, table->numberDependent), u);
+    } catch (std::exception& exception) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+    }
+    PetscFunctionReturn(0);
+}
+
+void ablate::mathFunctions::MultiLinearTable::Write(const std::filesystem::path& file, const std::vector<std::size_t>& sizes, const std::vector<double>& lowerBounds,
+                                                    const std::vector<double>& upperBounds, std::size_t numberDependent, const std::vector<double>& values) {
+    if (sizes.size() != lowerBounds.size() || sizes.size() != upperBounds.size()) {
+        throw std::invalid_argument("The sizes, lowerBounds, and upperBounds of an ablate::mathFunctions::MultiLinearTable must be the same length");
+    }
+    std::size_t numberGridPoints = 1;
+    for (const auto& size : sizes) {
+        numberGridPoints *= size;
+    }
+    if (values.size() != numberGridPoints * numberDependent) {
+        throw std::invalid_argument("The ablate::mathFunctions::MultiLinearTable requires " + std::to_string(numberGridPoints * numberDependent) + " values");
+    }
+
+    std::ofstream outputStream(file, std::ios::binary | std::ios::trunc);
+    if (!outputStream) {
+        throw std::runtime_error("Cannot write ablate::mathFunctions::MultiLinearTable file " + file.string());
+    }
+    auto writeValue = [&outputStream](const auto& value) { outputStream.write((const char*)&value, sizeof(value)); };
+    outputStream.write(fileIdentifier, sizeof(fileIdentifier));
+    writeValue((std::uint64_t)sizes.size());
+    writeValue((std::uint64_t)numberDependent);
+    for (std::size_t d = 0; d < sizes.size(); d++) {
+        writeValue((std::uint64_t)sizes[d]);
+        writeValue(lowerBounds[d]);
+        writeValue(upperBounds[d]);
+    }
+    outputStream.write((const char*)values.data(), (std::streamsize)(values.size() * sizeof(double)));
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::mathFunctions::MathFunction, ablate::mathFunctions::MultiLinearTable,
+         "A memory mapped table of values over a regular n dimensional grid that is multilinearly interpolated.  The table does not extrapolate beyond the grid.",
+         ARG(std::filesystem::path, "file", "the binary table file, see MultiLinearTable::Write for the format"),
+         ARG(ablate::mathFunctions::MathFunction, "mappingFunction", "the function that maps from the physical x,y,z, and t space to the n table coordinates"));
@@ -0,0 +1,111 @@
+#ifndef ABLATELIBRARY_MULTILINEARTABLE_HPP
+#define ABLATELIBRARY_MULTILINEARTABLE_HPP
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include "mathFunction.hpp"
+namespace ablate::mathFunctions {
+
+/**
+ * A table of values over a regular n dimensional grid that is multilinearly interpolated.  The mapping function computes the n table coordinates (i.e.
+ * axial position and time) from the physical x,y,z and t space.  Coordinates outside the grid are bounded to the grid, i.e. the table does not
+ * extrapolate.
+ *
+ * The table is memory mapped from a binary file written in the native byte order with MultiLinearTable::Write,
+ *  - char[8] file identifier "ABLMLTBL"
+ *  - uint64 number of dimensions (n)
+ *  - uint64 number of dependent values (m)
+ *  - for each dimension: uint64 number of grid points, double lower bound, double upper bound
+ *  - double values[m * numberPoints0 * numberPoints1 * ...] with the dependent values for each grid point stored together and the first dimension varying
+ * fastest
+ */
+class MultiLinearTable : public MathFunction {
+   private:
+    //! the maximum number of table dimensions
+    static constexpr std::size_t maxDimensions = 8;
+
+    //! the identifier at the start of each table file
+    inline static const char fileIdentifier[8] = {'A', 'B', 'L', 'M', 'L', 'T', 'B', 'L'};
+
+    //! the function that maps from x,y,z,t to the table coordinates
+    const std::shared_ptr<MathFunction> mappingFunction;
+
+    //! the number of table dimensions and dependent values at each grid point
+    std::size_t numberDimensions = 0;
+    std::size_t numberDependent = 0;
+
+    //! the number of grid points, lower bound, and inverse grid spacing in each dimension
+    std::vector<std::size_t> sizes;
+    std::vector<double> lowerBounds;
+    std::vector<double> inverseSpacing;
+
+    //! the offset between consecutive grid points in each dimension
+    std::vector<std::size_t> strides;
+
+    //! the offset of each cell corner from the lower corner of the cell
+    std::vector<std::size_t> cornerOffsets;
+
+    //! the memory mapped table file
+    void* mapping = nullptr;
+    std::size_t mappingSize = 0;
+
+    //! the dependent values in the mapped file
+    const double* values = nullptr;
+
+    /**
+     * Interpolate the dependent values at the table coordinates
+     * @param coordinates the n table coordinates
+     * @param numberInterpolations the number of dependent values to compute
+     * @param result
+     */
+    void Interpolate(const double* coordinates, std::size_t numberInterpolations, double* result) const;
+
+    static PetscErrorCode MultiLinearTablePetscFunction(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
+
+   public:
+    /**
+     * @param file the binary table file
+     * @param mappingFunction the function that maps from x,y,z,t to the table coordinates
+     */
+    MultiLinearTable(const std::filesystem::path& file, std::shared_ptr<MathFunction> mappingFunction);
+    ~MultiLinearTable() override;
+
+    //! prevent copy of this object
+    MultiLinearTable(const MultiLinearTable&) = delete;
+    //! prevent copy of this object
+    void operator=(const MultiLinearTable&) = delete;
+
+    double Eval(const double& x, const double& y, const double& z, const double& t) const override;
+
+    double Eval(const double* xyz, const int& ndims, const double& t) const override;
+
+    void Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const override;
+
+    void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
+
+    /**
+     * Map the batch of points to table coordinates in a single call and interpolate each point
+     */
+    void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const override;
+
+    bool IsTimeInvariant() const override { return mappingFunction->IsTimeInvariant(); }
+
+    void* GetContext() override { return this; }
+
+    PetscFunction GetPetscFunction() override { return MultiLinearTablePetscFunction; }
+
+    /**
+     * Write a table file that can be read by the MultiLinearTable
+     * @param file
+     * @param sizes the number of grid points in each dimension
+     * @param lowerBounds the lower bound of the grid in each dimension
+     * @param upperBounds the upper bound of the grid in each dimension
+     * @param numberDependent the number of dependent values at each grid point
+     * @param values the dependent values at each grid point, first dimension varying fastest
+     */
+    static void Write(const std::filesystem::path& file, const std::vector<std::size_t>& sizes, const std::vector<double>& lowerBounds, const std::vector<double>& upperBounds,
+                      std::size_t numberDependent, const std::vector<double>& values);
+};
+}  // namespace ablate::mathFunctions
+#endif  // ABLATELIBRARY_MULTILINEARTABLE_HPP
@@ -7,65 +7,54 @@
 
 ablate::mathFunctions::ParsedSeries::ParsedSeries(std::string functionString, int lowerBound, int upperBound, const std::shared_ptr<ablate::parameters::Parameters>& constants)
     : FormulaBase(std::move(functionString), constants), lowerBound(lowerBound), upperBound(upperBound) {
-    // define the x,y,z and t variables
-    parser.DefineVar("i", &i);
+    // define the index of summation
+    indexVariable = DefineVariable("i");
 
     // Test the function
     try {
-        parser.Eval();
+        GetState().parser.Eval();
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::SimpleFormula::ConvertToException(exception);
     }
+    CheckBulkSupport();
 }
 
-double ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y, const double& z, const double& t) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
-    double sum = 0.0;
-
-    for (i = lowerBound; i <= upperBound; i++) {
-        sum += parser.Eval();
-    }
-
-    return sum;
-}
-
-double ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndims, const double& t) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+void ablate::mathFunctions::ParsedSeries::SumSeries(EvaluationState& state, std::size_t numberResults, double* result) const {
+    // zero out the result
+    std::fill_n(result, numberResults, 0.0);
 
-    for (auto d = 0; d < std::min(ndims, 3); d++) {
-        coordinate[d] = xyz[d];
-    }
-    time = t;
+    if (bulkSupported) {
+        if (upperBound < lowerBound || numberResults == 0) {
+            return;
+        }
 
-    double sum = 0.0;
+        // each entry in the batch is a term in the series
+        const auto numberTerms = (std::size_t)(upperBound - lowerBound + 1);
+        state.PrepareBulk(numberTerms);
+        std::fill_n(state.bulkVariables["x"].data(), numberTerms, state.coordinate[0]);
+        std::fill_n(state.bulkVariables["y"].data(), numberTerms, state.coordinate[1]);
+        std::fill_n(state.bulkVariables["z"].data(), numberTerms, state.coordinate[2]);
+        std::fill_n(state.bulkVariables["t"].data(), numberTerms, state.time);
+        double* terms = state.bulkVariables["i"].data();
+        for (std::size_t n = 0; n < numberTerms; n++) {
+            terms[n] = lowerBound + (double)n;
+        }
 
-    for (i = lowerBound; i <= upperBound; i++) {
-        sum += parser.Eval();
+        state.EvalBulk(numberTerms);
+        for (std::size_t n = 0; n < numberTerms; n++) {
+            result[0] += state.bulkResults[n];
+        }
+        return;
     }
 
-    return sum;
-}
-void ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
-
-    // zero out the result
-    std::fill(result.begin(), result.end(), 0.0);
-
     // perform multiple evals
+    double& i = state.variables[indexVariable];
     for (i = lowerBound; i <= upperBound; i++) {
         int functionSize = 0;
-        auto rawResult = parser.Eval(functionSize);
+        auto rawResult = state.parser.Eval(functionSize);
 
-        if ((int)result.size() < functionSize) {
-            throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+        if ((int)numberResults < functionSize) {
+            throw std::invalid_argument("The result vector is not sized to hold the function " + state.parser.GetExpr());
         }
 
         // copy over
@@ -75,70 +64,58 @@ void ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y,
     }
 }
 
-void ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+double ablate::mathFunctions::ParsedSeries::SumSeries(EvaluationState& state) const {
+    double sum = 0.0;
+    if (bulkSupported) {
+        SumSeries(state, 1, &sum);
+        return sum;
+    }
 
-    for (auto d = 0; d < std::min(ndims, 3); d++) {
-        coordinate[d] = xyz[d];
+    double& i = state.variables[indexVariable];
+    for (i = lowerBound; i <= upperBound; i++) {
+        sum += state.parser.Eval();
     }
-    time = t;
+    return sum;
+}
 
-    // zero out the result
-    std::fill(result.begin(), result.end(), 0.0);
+double ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y, const double& z, const double& t) const {
+    auto& state = GetState();
+    state.SetPoint(x, y, z, t);
 
-    // perform multiple evals
-    for (i = lowerBound; i <= upperBound; i++) {
-        int functionSize = 0;
-        auto rawResult = parser.Eval(functionSize);
+    return SumSeries(state);
+}
 
-        if ((int)result.size() < functionSize) {
-            throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
-        }
+double ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndims, const double& t) const {
+    auto& state = GetState();
+    state.SetPoint(xyz, ndims, t);
 
-        // copy over
-        for (auto d = 0; d < functionSize; d++) {
-            result[d] += rawResult[d];
-        }
-    }
+    return SumSeries(state);
+}
+void ablate::mathFunctions::ParsedSeries::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
+    auto& state = GetState();
+    state.SetPoint(x, y, z, t);
+
+    SumSeries(state, result.size(), result.data());
+}
+
+void ablate::mathFunctions::ParsedSeries::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
+    auto& state = GetState();
+    state.SetPoint(xyz, ndims, t);
+
+    SumSeries(state, result.size(), result.data());
 }
 
 PetscErrorCode ablate::mathFunctions::ParsedSeries::ParsedPetscSeries(PetscInt dim, PetscReal time, const PetscReal* x, PetscInt nf, PetscScalar* u, void* ctx) {
     // wrap in try, so we return petsc error code instead of c++ exception
     PetscFunctionBeginUser;
     try {
-        auto parser = (ParsedSeries*)ctx;
+        auto series = (ParsedSeries*)ctx;
 
         // update the coordinates
-        parser->coordinate[0] = 0;
-        parser->coordinate[1] = 0;
-        parser->coordinate[2] = 0;
+        auto& state = series->GetState();
+        state.SetPoint(x, (int)dim, time);
 
-        for (PetscInt d = 0; d < PetscMin(dim, 3); d++) {
-            parser->coordinate[d] = x[d];
-        }
-        parser->time = time;
-
-        // zero out the u vector
-        for (PetscInt f = 0; f < nf; f++) {
-            u[f] = 0.0;
-        }
-
-        // perform multiple evals
-        for (parser->i = parser->lowerBound; parser->i <= parser->upperBound; parser->i++) {
-            int functionSize = 0;
-            auto rawResult = parser->parser.Eval(functionSize);
-
-            if (nf < functionSize) {
-                throw std::invalid_argument("The result vector is not sized to hold the function " + parser->parser.GetExpr());
-            }
-
-            // copy over
-            for (auto d = 0; d < functionSize; d++) {
-                u[d] += rawResult[d];
-            }
-        }
+        series->SumSeries(state, nf, u);
 
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
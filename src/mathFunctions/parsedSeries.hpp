@@ -12,8 +12,8 @@ namespace ablate::mathFunctions {
 
 class ParsedSeries : public FormulaBase {
    private:
-    // The local count for the series
-    mutable double i = 0;
+    //! the index of the summation variable (i) in EvaluationState::variables
+    std::size_t indexVariable = 0;
 
     //! the lower bound for the series
     const int lowerBound;
@@ -22,6 +22,20 @@ class ParsedSeries : public FormulaBase {
     const int upperBound;
 
    private:
+    /**
+     * Sum the series at the current coordinate and time.  Single valued formulas evaluate every term in one call to the muParser bulk mode.
+     * @param state the state for the calling thread
+     * @param numberResults the size of the result
+     * @param result
+     */
+    void SumSeries(EvaluationState& state, std::size_t numberResults, double* result) const;
+
+    /**
+     * Sum the first value of the series at the current coordinate and time
+     * @param state the state for the calling thread
+     */
+    double SumSeries(EvaluationState& state) const;
+
     static PetscErrorCode ParsedPetscSeries(PetscInt dim, PetscReal time, const PetscReal x[], PetscInt Nf, PetscScalar* u, void* ctx);
 
    public:
@@ -6,70 +6,51 @@
 ablate::mathFunctions::SimpleFormula::SimpleFormula(std::string functionString) : FormulaBase(functionString, {}) {
     // Test the function
     try {
-        parser.Eval();
+        GetState().parser.Eval();
     } catch (mu::Parser::exception_type& exception) {
         throw ablate::mathFunctions::FormulaBase::ConvertToException(exception);
     }
+    CheckBulkSupport();
 }
 double ablate::mathFunctions::SimpleFormula::Eval(const double& x, const double& y, const double& z, const double& t) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
-    return parser.Eval();
+    auto& state = GetState();
+    state.SetPoint(x, y, z, t);
+    return state.parser.Eval();
 }
 
 double ablate::mathFunctions::SimpleFormula::Eval(const double* xyz, const int& ndims, const double& t) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
-
-    for (auto i = 0; i < std::min(ndims, 3); i++) {
-        coordinate[i] = xyz[i];
-    }
-    time = t;
-    return parser.Eval();
+    auto& state = GetState();
+    state.SetPoint(xyz, ndims, t);
+    return state.parser.Eval();
 }
 
 void ablate::mathFunctions::SimpleFormula::Eval(const double& x, const double& y, const double& z, const double& t, std::vector<double>& result) const {
-    coordinate[0] = x;
-    coordinate[1] = y;
-    coordinate[2] = z;
-    time = t;
-
-    int functionSize = 0;
-    auto rawResult = parser.Eval(functionSize);
-
-    if ((int)result.size() < functionSize) {
-        throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
-    }
-
-    // copy over
-    for (auto i = 0; i < functionSize; i++) {
-        result[i] = rawResult[i];
-    }
+    auto& state = GetState();
+    state.SetPoint(x, y, z, t);
+    EvalResult(state, result.size(), result.data());
 }
 
 void ablate::mathFunctions::SimpleFormula::Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const {
-    coordinate[0] = 0;
-    coordinate[1] = 0;
-    coordinate[2] = 0;
+    auto& state = GetState();
+    state.SetPoint(xyz, ndims, t);
+    EvalResult(state, result.size(), result.data());
+}
 
-    for (auto i = 0; i < std::min(ndims, 3); i++) {
-        coordinate[i] = xyz[i];
+void ablate::mathFunctions::SimpleFormula::EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const {
+    if (!bulkSupported || numberResults != 1) {
+        FormulaBase::EvalBatch(xyz, numberPoints, ndims, t, result, numberResults, stride);
+        return;
     }
-    time = t;
-
-    int functionSize = 0;
-    auto rawResult = parser.Eval(functionSize);
-
-    if ((int)result.size() < functionSize) {
-        throw std::invalid_argument("The result vector is not sized to hold the function " + parser.GetExpr());
+    if (numberPoints == 0) {
+        return;
     }
 
-    // copy over
-    for (auto i = 0; i < functionSize; i++) {
-        result[i] = rawResult[i];
+    auto& state = GetState();
+    state.PrepareBulk(numberPoints);
+    state.FillBulkCoordinates(numberPoints, xyz, ndims, t);
+    state.EvalBulk(numberPoints);
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        result[p * stride] = state.bulkResults[p];
     }
 }
 
@@ -77,31 +58,14 @@ PetscErrorCode ablate::mathFunctions::SimpleFormula::ParsedPetscFunction(PetscIn
     // wrap in try, so we return petsc error code instead of c++ exception
     PetscFunctionBeginUser;
     try {
-        auto parser = (SimpleFormula*)ctx;
+        auto formula = (SimpleFormula*)ctx;
 
         // update the coordinates
-        parser->coordinate[0] = 0;
-        parser->coordinate[1] = 0;
-        parser->coordinate[2] = 0;
-
-        for (PetscInt i = 0; i < PetscMin(dim, (PetscInt)3); i++) {
-            parser->coordinate[i] = x[i];
-        }
-        parser->time = time;
+        auto& state = formula->GetState();
+        state.SetPoint(x, (int)dim, time);
 
         // Evaluate
-        int functionSize = 0;
-        auto rawResult = parser->parser.Eval(functionSize);
-
-        if (nf < functionSize) {
-            throw std::invalid_argument("The result vector is not sized to hold the function " + parser->parser.GetExpr());
-        }
-
-        // copy over
-        for (auto i = 0; i < functionSize; i++) {
-            u[i] = rawResult[i];
-        }
-
+        formula->EvalResult(state, nf, u);
     } catch (std::exception& exception) {
         SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
     }
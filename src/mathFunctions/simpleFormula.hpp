@@ -27,6 +27,11 @@ class SimpleFormula : public FormulaBase {
 
     void Eval(const double* xyz, const int& ndims, const double& t, std::vector<double>& result) const override;
 
+    /**
+     * Evaluate a batch of points in one call to the muParser bulk mode when the formula is single valued
+     */
+    void EvalBatch(const double* xyz, std::size_t numberPoints, const int& ndims, const double& t, double* result, std::size_t numberResults, std::size_t stride) const override;
+
     void* GetContext() override { return this; }
 
     PetscFunction GetPetscFunction() override { return ParsedPetscFunction; }
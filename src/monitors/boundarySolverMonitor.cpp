@@ -1,7 +1,27 @@
 #include "boundarySolverMonitor.hpp"
+#include <petscviewerhdf5.h>
+#include <algorithm>
 #include "io/interval/fixedInterval.hpp"
+#include "utilities/mathUtilities.hpp"
+#include "utilities/mpiError.hpp"
+
+ablate::monitors::BoundarySolverMonitor::BoundarySolverMonitor(std::vector<std::string> components, bool surfaceAverageOnly)
+    : components(std::move(components)), surfaceAverageOnly(surfaceAverageOnly) {}
 
 ablate::monitors::BoundarySolverMonitor::~BoundarySolverMonitor() {
+    if (localBoundaryVec) {
+        VecDestroy(&localBoundaryVec) >> checkError;
+    }
+    if (localFaceVec) {
+        VecDestroy(&localFaceVec) >> checkError;
+    }
+    if (globalFaceVec) {
+        VecDestroy(&globalFaceVec) >> checkError;
+    }
+    if (globalAreaVec) {
+        VecDestroy(&globalAreaVec) >> checkError;
+    }
+
     if (boundaryDm) {
         DMDestroy(&boundaryDm) >> checkError;
     }
@@ -23,6 +43,31 @@ void ablate::monitors::BoundarySolverMonitor::Register(std::shared_ptr<solver::S
     // update the name
     name = solver->GetSolverId() + name;
 
+    // determine which of the output components are written
+    const auto& outputComponents = boundarySolver->GetOutputComponents();
+    if (components.empty()) {
+        for (std::size_t c = 0; c < outputComponents.size(); ++c) {
+            componentIndices.push_back((PetscInt)c);
+        }
+    } else {
+        for (const auto& component : components) {
+            auto componentLoc = std::find(outputComponents.begin(), outputComponents.end(), component);
+            if (componentLoc == outputComponents.end()) {
+                throw std::invalid_argument("The BoundarySolverMonitor component " + component + " is not an output of the boundary solver " + solver->GetSolverId());
+            }
+            componentIndices.push_back((PetscInt)std::distance(outputComponents.begin(), componentLoc));
+        }
+    }
+
+    // only the output functions that compute a written component are called
+    for (const auto& function : boundarySolver->GetOutputFunctions()) {
+        if (std::any_of(function.sourceFieldsOffset.begin(), function.sourceFieldsOffset.end(), [this](PetscInt offset) {
+                return std::find(componentIndices.begin(), componentIndices.end(), offset) != componentIndices.end();
+            })) {
+            outputFunctions.push_back(function);
+        }
+    }
+
     // make a copy of the dm for a boundary dm.
     DM coordDM;
     DMGetCoordinateDM(solver->GetSubDomain().GetDM(), &coordDM) >> checkError;
@@ -68,11 +113,11 @@ void ablate::monitors::BoundarySolverMonitor::Register(std::shared_ptr<solver::S
     // Now create a sub dm with only the faces
     DMPlexFilter(boundaryDm, boundaryFaceLabel, 1, &faceDm) >> checkError;
 
-    // Add each of the output components on each face in the faceDm
-    for (const auto& field : boundarySolver->GetOutputComponents()) {
+    // Add each of the written components on each face in the faceDm
+    for (const auto& componentIndex : componentIndices) {
         PetscFV fvm;
         PetscFVCreate(PetscObjectComm(PetscObject(faceDm)), &fvm) >> checkError;
-        PetscObjectSetName((PetscObject)fvm, field.c_str()) >> checkError;
+        PetscObjectSetName((PetscObject)fvm, outputComponents[componentIndex].c_str()) >> checkError;
         PetscFVSetFromOptions(fvm) >> checkError;
         PetscFVSetNumComponents(fvm, 1) >> checkError;
         PetscInt dim;
@@ -83,12 +128,119 @@ void ablate::monitors::BoundarySolverMonitor::Register(std::shared_ptr<solver::S
         PetscFVDestroy(&fvm);
     }
     DMCreateDS(faceDm) >> checkError;
+
+    // map each written component of each face in the faceDm back to the boundaryDm once so that each save is a single sparse copy
+    PetscSection boundarySection, faceSection;
+    DMGetLocalSection(boundaryDm, &boundarySection) >> checkError;
+    DMGetLocalSection(faceDm, &faceSection) >> checkError;
+
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(faceDm, 0, &cStart, &cEnd) >> checkError;
+    IS faceIs;
+    const PetscInt* faceToBoundary = nullptr;
+    DMPlexGetSubpointIS(faceDm, &faceIs) >> checkError;
+    ISGetIndices(faceIs, &faceToBoundary) >> checkError;
+
+    std::vector<ablate::boundarySolver::DistributionOperator::Entry> entries;
+    for (PetscInt facePt = cStart; facePt < cEnd; ++facePt) {
+        PetscInt boundaryPt = faceToBoundary[facePt];
+
+        PetscInt boundaryDof, faceDof;
+        PetscSectionGetDof(boundarySection, boundaryPt, &boundaryDof) >> checkError;
+        PetscSectionGetDof(faceSection, facePt, &faceDof) >> checkError;
+        if (boundaryDof && faceDof) {
+            PetscInt boundaryOffset, faceOffset;
+            PetscSectionGetOffset(boundarySection, boundaryPt, &boundaryOffset) >> checkError;
+            PetscSectionGetOffset(faceSection, facePt, &faceOffset) >> checkError;
+            for (std::size_t c = 0; c < componentIndices.size(); ++c) {
+                entries.push_back({.rowOffset = faceOffset + (PetscInt)c, .columnOffset = boundaryOffset + componentIndices[c], .weight = 1.0});
+            }
+        }
+    }
+    ISRestoreIndices(faceIs, &faceToBoundary) >> checkError;
+    faceOperator = ablate::boundarySolver::DistributionOperator(std::move(entries));
+
+    // create the vectors once, they are reused for each save
+    DMCreateLocalVector(boundaryDm, &localBoundaryVec) >> checkError;
+    DMCreateLocalVector(faceDm, &localFaceVec) >> checkError;
+    DMCreateGlobalVector(faceDm, &globalFaceVec) >> checkError;
+    PetscObjectSetName((PetscObject)globalFaceVec, GetId().c_str()) >> checkError;
+
+    // the area of each face is mapped with the same operator so that the surface average uses the global face layout
+    if (surfaceAverageOnly) {
+        PetscInt boundarySize;
+        VecGetLocalSize(localBoundaryVec, &boundarySize) >> checkError;
+        std::vector<PetscScalar> boundaryArea(boundarySize, 0.0);
+        for (const auto& gradientStencil : boundarySolver->GetBoundaryGeometry()) {
+            PetscInt boundaryOffset;
+            PetscSectionGetOffset(boundarySection, gradientStencil.geometry.faceId, &boundaryOffset) >> checkError;
+            std::fill_n(boundaryArea.begin() + boundaryOffset, numberOfComponents, utilities::MathUtilities::MagVector(solver->GetSubDomain().GetDimensions(), gradientStencil.geometry.areas));
+        }
+
+        VecZeroEntries(localFaceVec) >> checkError;
+        PetscScalar* localFaceArray;
+        VecGetArray(localFaceVec, &localFaceArray) >> checkError;
+        faceOperator.Apply(boundaryArea.data(), localFaceArray, 1);
+        VecRestoreArray(localFaceVec, &localFaceArray) >> checkError;
+
+        VecDuplicate(globalFaceVec, &globalAreaVec) >> checkError;
+        VecZeroEntries(globalAreaVec) >> checkError;
+        DMLocalToGlobal(faceDm, localFaceVec, INSERT_VALUES, globalAreaVec) >> checkError;
+    }
+}
+
+void ablate::monitors::BoundarySolverMonitor::SaveSurfaceAverage(PetscViewer viewer, PetscInt sequenceNumber) const {
+    // sum the area weighted value and area of each component over the owned faces
+    const auto numberOfComponents = (PetscInt)componentIndices.size();
+    std::vector<PetscReal> localSums(2 * numberOfComponents, 0.0);
+    PetscInt size;
+    VecGetLocalSize(globalFaceVec, &size) >> checkError;
+    const PetscScalar *faceArray, *areaArray;
+    VecGetArrayRead(globalFaceVec, &faceArray) >> checkError;
+    VecGetArrayRead(globalAreaVec, &areaArray) >> checkError;
+    for (PetscInt i = 0; i < size; ++i) {
+        localSums[i % numberOfComponents] += faceArray[i] * areaArray[i];
+        localSums[numberOfComponents + i % numberOfComponents] += areaArray[i];
+    }
+    VecRestoreArrayRead(globalFaceVec, &faceArray) >> checkError;
+    VecRestoreArrayRead(globalAreaVec, &areaArray) >> checkError;
+
+    std::vector<PetscReal> sums(localSums.size());
+    auto comm = PetscObjectComm((PetscObject)faceDm);
+    MPI_Allreduce(localSums.data(), sums.data(), (PetscMPIInt)sums.size(), MPIU_REAL, MPIU_SUM, comm) >> checkMpiError;
+
+    // write the averages from the first rank
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+    Vec averageVec;
+    VecCreateMPI(comm, rank == 0 ? numberOfComponents : 0, numberOfComponents, &averageVec) >> checkError;
+    PetscObjectSetName((PetscObject)averageVec, (GetId() + "_surfaceAverage").c_str()) >> checkError;
+    if (rank == 0) {
+        PetscScalar* averageArray;
+        VecGetArrayWrite(averageVec, &averageArray) >> checkError;
+        for (PetscInt c = 0; c < numberOfComponents; ++c) {
+            averageArray[c] = sums[numberOfComponents + c] > 0.0 ? sums[c] / sums[numberOfComponents + c] : 0.0;
+        }
+        VecRestoreArrayWrite(averageVec, &averageArray) >> checkError;
+    }
+
+    PetscBool ishdf5;
+    PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5) >> checkError;
+    if (ishdf5) {
+        PetscViewerHDF5PushTimestepping(viewer) >> checkError;
+        PetscViewerHDF5SetTimestep(viewer, sequenceNumber) >> checkError;
+    }
+    VecView(averageVec, viewer) >> checkError;
+    if (ishdf5) {
+        PetscViewerHDF5PopTimestepping(viewer) >> checkError;
+    }
+    VecDestroy(&averageVec) >> checkError;
 }
 
 void ablate::monitors::BoundarySolverMonitor::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
     // If this is the first output, store a copy of the faceDm
-    if (sequenceNumber == 0) {
+    if (sequenceNumber == 0 && !surfaceAverageOnly) {
         DMView(faceDm, viewer) >> checkError;
     }
 
@@ -100,81 +252,47 @@ void ablate::monitors::BoundarySolverMonitor::Save(PetscViewer viewer, PetscInt
     DMGetLocalVector(GetSolver()->GetSubDomain().GetDM(), &locXVec) >> checkError;
     DMGlobalToLocalBegin(GetSolver()->GetSubDomain().GetDM(), GetSolver()->GetSubDomain().GetSolutionVector(), INSERT_VALUES, locXVec) >> checkError;
 
-    // create a local vector on the boundary solver
-    Vec localBoundaryVec;
-    DMGetLocalVector(boundaryDm, &localBoundaryVec) >> checkError;
+    // reset the cached boundary and face vectors
     VecZeroEntries(localBoundaryVec) >> checkError;
+    VecZeroEntries(localFaceVec) >> checkError;
 
     // finish with the locXVec
     DMGlobalToLocalEnd(GetSolver()->GetSubDomain().GetDM(), GetSolver()->GetSubDomain().GetSolutionVector(), INSERT_VALUES, locXVec) >> checkError;
 
-    // compute the rhs
-    boundarySolver->ComputeRHSFunction(time, locXVec, localBoundaryVec, boundarySolver->GetOutputFunctions()) >> checkError;
+    // compute the rhs for only the output functions of the written components
+    boundarySolver->ComputeRHSFunction(time, locXVec, localBoundaryVec, outputFunctions) >> checkError;
 
-    // Create a local vector for just the monitor
-    Vec localFaceVec;
-    DMGetLocalVector(faceDm, &localFaceVec) >> checkError;
-    VecZeroEntries(localFaceVec) >> checkError;
-
-    // Get the raw data for the global vectors
+    // Get the raw data for the local vectors
     const PetscScalar* localBoundaryArray;
     VecGetArrayRead(localBoundaryVec, &localBoundaryArray) >> checkError;
     PetscScalar* localFaceArray;
     VecGetArray(localFaceVec, &localFaceArray) >> checkError;
 
-    // Determine the size of data
-    PetscInt dataSize;
-    VecGetBlockSize(localFaceVec, &dataSize) >> checkError;
-
-    // March over each cell in the face dm
-    PetscInt cStart, cEnd;
-    DMPlexGetHeightStratum(faceDm, 0, &cStart, &cEnd) >> checkError;
-
-    // get the mapping information
-    IS faceIs;
-    const PetscInt* faceToBoundary = nullptr;
-    DMPlexGetSubpointIS(faceDm, &faceIs) >> checkError;
-    ISGetIndices(faceIs, &faceToBoundary) >> checkError;
-
     // Copy over the values that are in the globalFaceVec.  We may skip some local ghost values
     if (localBoundaryArray && localFaceArray) {
-        for (PetscInt facePt = cStart; facePt < cEnd; ++facePt) {
-            PetscInt boundaryPt = faceToBoundary[facePt];
-
-            const PetscScalar* localBoundaryData = nullptr;
-            PetscScalar* globalFaceData = nullptr;
-
-            DMPlexPointLocalRead(boundaryDm, boundaryPt, localBoundaryArray, &localBoundaryData) >> checkError;
-            DMPlexPointLocalRef(faceDm, facePt, localFaceArray, &globalFaceData) >> checkError;
-            if (globalFaceData && localBoundaryData) {
-                PetscArraycpy(globalFaceData, localBoundaryData, dataSize) >> checkError;
-            }
-        }
+        faceOperator.Apply(localBoundaryArray, localFaceArray, 1);
     }
 
-    // restore
-    ISRestoreIndices(faceIs, &faceToBoundary) >> checkError;
-
     VecRestoreArrayRead(localBoundaryVec, &localBoundaryArray) >> checkError;
     VecRestoreArray(localFaceVec, &localFaceArray) >> checkError;
 
     // Map to a global array with add values
-    Vec globalFaceVec;
-    DMGetGlobalVector(faceDm, &globalFaceVec) >> checkError;
-    PetscObjectSetName((PetscObject)globalFaceVec, GetId().c_str()) >> checkError;
-    VecZeroEntries(globalFaceVec);
+    VecZeroEntries(globalFaceVec) >> checkError;
     DMLocalToGlobal(faceDm, localFaceVec, ADD_VALUES, globalFaceVec) >> checkError;
 
-    // write to the output file
-    VecView(globalFaceVec, viewer) >> checkError;
-    DMRestoreGlobalVector(faceDm, &globalFaceVec) >> checkError;
+    // write the surface average or the full field to the output file
+    if (surfaceAverageOnly) {
+        SaveSurfaceAverage(viewer, sequenceNumber);
+    } else {
+        VecView(globalFaceVec, viewer) >> checkError;
+    }
 
     // cleanup
-    DMRestoreLocalVector(faceDm, &localFaceVec) >> checkError;
     DMRestoreLocalVector(GetSolver()->GetSubDomain().GetDM(), &locXVec) >> checkError;
-    DMRestoreLocalVector(boundaryDm, &localBoundaryVec) >> checkError;
     PetscFunctionReturnVoid();
 }
 
 #include "registrar.hpp"
-REGISTER_WITHOUT_ARGUMENTS(ablate::monitors::Monitor, ablate::monitors::BoundarySolverMonitor, "Outputs any provided information from the boundary time to the serializer.");
+REGISTER(ablate::monitors::Monitor, ablate::monitors::BoundarySolverMonitor, "Outputs any provided information from the boundary time to the serializer.",
+         OPT(std::vector<std::string>, "components", "the output components to write (default is all)"),
+         OPT(bool, "surfaceAverageOnly", "only write the area weighted surface average of each component instead of the full boundary field (default is false)"));
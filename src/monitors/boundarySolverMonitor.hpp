@@ -2,6 +2,8 @@
 #define ABLATELIBRARY_BOUNDARYSOLVERMONITOR_HPP
 
 #include <petsc.h>
+#include <string>
+#include <vector>
 #include "boundarySolver/boundarySolver.hpp"
 #include "domain/region.hpp"
 #include "domain/subDomain.hpp"
@@ -40,7 +42,43 @@ class BoundarySolverMonitor : public Monitor, public io::Serializable {
      */
     DM faceDm = nullptr;
 
+    /**
+     * Copies the boundary output on each face of the boundaryDm to the matching cell in the faceDm.  This is assembled once at registration.
+     */
+    ablate::boundarySolver::DistributionOperator faceOperator;
+
+    //! the output components to write, all components are written if empty
+    const std::vector<std::string> components;
+
+    //! only write the area weighted surface average of each component instead of the full boundary field
+    const bool surfaceAverageOnly;
+
+    //! the index of each written component in the boundary solver output components
+    std::vector<PetscInt> componentIndices;
+
+    //! the subset of the boundary output functions that compute at least one written component
+    std::vector<ablate::boundarySolver::BoundarySolver::BoundarySourceFunctionDescription> outputFunctions;
+
+    //! the vectors are cached between saves
+    Vec localBoundaryVec = nullptr;
+    Vec localFaceVec = nullptr;
+    Vec globalFaceVec = nullptr;
+
+    //! the area of each face in the global face vec layout, used for the surface average
+    Vec globalAreaVec = nullptr;
+
+    /**
+     * Compute and write the area weighted average of each component over the boundary
+     */
+    void SaveSurfaceAverage(PetscViewer viewer, PetscInt sequenceNumber) const;
+
    public:
+    /**
+     * @param components the output components to write (default is all)
+     * @param surfaceAverageOnly only write the area weighted surface average of each component (default is false)
+     */
+    explicit BoundarySolverMonitor(std::vector<std::string> components = {}, bool surfaceAverageOnly = false);
+
     /**
      * Clean up the petsc objects
      */
@@ -5,8 +5,8 @@
 #include "io/interval/fixedInterval.hpp"
 #include "utilities/mpiError.hpp"
 
-ablate::monitors::CurveMonitor::CurveMonitor(std::shared_ptr<io::interval::Interval> intervalIn, std::string prefix)
-    : interval(intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>()), filePrefix(prefix) {}
+ablate::monitors::CurveMonitor::CurveMonitor(std::shared_ptr<io::interval::Interval> intervalIn, std::string prefix, bool binary)
+    : interval(intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>()), filePrefix(prefix), binary(binary) {}
 
 void ablate::monitors::CurveMonitor::Register(std::shared_ptr<solver::Solver> solver) {
     ablate::monitors::Monitor::Register(solver);
@@ -18,13 +18,41 @@ void ablate::monitors::CurveMonitor::Register(std::shared_ptr<solver::Solver> so
     if (dim != 1) {
         throw std::invalid_argument("The CurveMonitor monitor can only be used with DMs in 1D");
     }
+}
+
+void ablate::monitors::CurveMonitor::BuildSamples() {
+    auto subDM = GetSolver()->GetSubDomain().GetSubDM();
+
+    // build the list of local coordinates
+    Vec cellGeomVec;
+    DMPlexGetDataFVM(subDM, nullptr, &cellGeomVec, nullptr, nullptr) >> checkError;
+    DM cellGeomDM;
+    VecGetDM(cellGeomVec, &cellGeomDM) >> checkError;
+    const PetscScalar* cellGeomArray;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
 
-    // check the size
-    int size;
-    MPI_Comm_size(solver->GetSubDomain().GetComm(), &size) >> checkMpiError;
-    if (size != 1) {
-        throw std::runtime_error("The CurveMonitor monitor only works with a single mpi rank");
+    // only the cells owned by this rank are sampled
+    PetscSection globalSection;
+    DMGetGlobalSection(subDM, &globalSection) >> checkError;
+
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(subDM, 0, &cStart, &cEnd) >> checkError;
+    std::vector<PetscInt> cells;
+    std::vector<PetscReal> centroids;
+    for (PetscInt c = cStart; c < cEnd; c++) {
+        PetscInt globalOffset;
+        PetscSectionGetOffset(globalSection, c, &globalOffset) >> checkError;
+        if (globalOffset < 0) {
+            continue;
+        }
+        PetscFVCellGeom* cellGeom;
+        DMPlexPointLocalRead(cellGeomDM, c, cellGeomArray, &cellGeom) >> checkError;
+        cells.push_back(c);
+        centroids.push_back(cellGeom->centroid[0]);
     }
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+
+    samples = std::make_unique<CurveSamples>(GetSolver()->GetSubDomain().GetComm(), std::move(cells), std::move(centroids));
 }
 
 PetscErrorCode ablate::monitors::CurveMonitor::OutputCurve(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx) {
@@ -34,77 +62,104 @@ PetscErrorCode ablate::monitors::CurveMonitor::OutputCurve(TS ts, PetscInt steps
     auto comm = PetscObjectComm((PetscObject)ts);
 
     if (monitor->interval->Check(comm, steps, time)) {
-        // Open a new file
-        std::filesystem::path outputFile =
-            ablate::environment::RunEnvironment::Get().GetOutputDirectory() / (monitor->filePrefix + monitor->GetSolver()->GetSolverId() + "." + std::to_string(steps) + monitor->fileExtension);
-        std::ofstream curveFile;
-        curveFile.open(outputFile);
-
-        // March over each solution vector
-        curveFile << "#title=" << monitor->GetSolver()->GetSolverId() << std::endl;
-        curveFile << "##time=" << time << std::endl << std::endl;
+        try {
+            auto& subDomain = monitor->GetSolver()->GetSubDomain();
 
-        // build the list of local coordinates
-        auto subDM = monitor->GetSolver()->GetSubDomain().GetSubDM();
-        Vec cellGeomVec;
-        PetscCall(DMPlexGetDataFVM(subDM, nullptr, &cellGeomVec, nullptr, nullptr));
+            // the cells and coordinates do not change, so they are only computed once
+            if (!monitor->samples) {
+                monitor->BuildSamples();
+            }
 
-        // March over each cell
-        PetscInt cStart, cEnd;
-        PetscCall(DMPlexGetHeightStratum(subDM, 0, &cStart, &cEnd));
+            // Determine the name of each solution component followed by each aux component
+            auto auxSubDM = subDomain.GetSubAuxDM();
+            const auto& solFields = subDomain.GetFields();
+            const auto& auxFields = auxSubDM ? subDomain.GetFields(domain::FieldLocation::AUX) : std::vector<domain::Field>();
+            std::vector<std::string> componentNames;
+            auto addComponentNames = [&componentNames](const std::vector<domain::Field>& fields) {
+                for (const auto& field : fields) {
+                    for (PetscInt comp = 0; comp < field.numberComponents; comp++) {
+                        componentNames.push_back(field.name + (field.numberComponents > 1 ? "_" + field.components[comp] : ""));
+                    }
+                }
+            };
+            addComponentNames(solFields);
+            const auto numberSolComponents = (PetscInt)componentNames.size();
+            addComponentNames(auxFields);
+            const auto numberComponents = (PetscInt)componentNames.size();
+
+            // Read the solution and aux vars for each owned cell
+            std::vector<PetscReal> localValues(monitor->samples->GetCells().size() * numberComponents);
+            monitor->ReadValues(solFields, subDomain.GetSubDM(), subDomain.GetSubSolutionVector(), 0, numberComponents, localValues);
+            if (auxSubDM) {
+                monitor->ReadValues(auxFields, auxSubDM, subDomain.GetSubAuxVector(), numberSolComponents, numberComponents, localValues);
+            }
 
-        try {
-            // Output the solution vars
-            WriteToCurveFile(curveFile, cStart, cEnd, cellGeomVec, monitor->GetSolver()->GetSubDomain().GetFields(), subDM, monitor->GetSolver()->GetSubDomain().GetSubSolutionVector());
+            // Only the ranks with cells take part in the gather
+            std::vector<PetscReal> centroids, values;
+            monitor->samples->Gather(localValues, numberComponents, centroids, values);
+
+            if (monitor->samples->IsRoot()) {
+                auto outputName = monitor->filePrefix + monitor->GetSolver()->GetSolverId() + "." + std::to_string(steps);
+
+                // Open a new file
+                std::filesystem::path outputFile = ablate::environment::RunEnvironment::Get().GetOutputDirectory() / (outputName + monitor->fileExtension);
+                std::ofstream curveFile;
+                curveFile.open(outputFile);
+
+                // March over each solution vector
+                curveFile << "#title=" << monitor->GetSolver()->GetSolverId() << std::endl;
+                curveFile << "##time=" << time << std::endl << std::endl;
+
+                // Output each component, the solution and aux vars are separated by a blank line
+                for (PetscInt comp = 0; comp < numberComponents; comp++) {
+                    curveFile << "#" << componentNames[comp] << std::endl;
+                    for (std::size_t c = 0; c < centroids.size(); c++) {
+                        const auto value = values[c * numberComponents + comp];
+                        curveFile << centroids[c] << " ";
+                        curveFile << ((PetscAbs(value) < minimumOutputValue) ? 0.0 : value) << std::endl;
+                    }
+                    if (comp + 1 == numberSolComponents) {
+                        curveFile << std::endl;
+                    }
+                }
+                if (numberComponents > numberSolComponents) {
+                    curveFile << std::endl;
+                }
+                curveFile.close();
 
-            // check for and then write aux vars
-            if (auto auxSubDM = monitor->GetSolver()->GetSubDomain().GetSubAuxDM()) {
-                WriteToCurveFile(
-                    curveFile, cStart, cEnd, cellGeomVec, monitor->GetSolver()->GetSubDomain().GetFields(domain::FieldLocation::AUX), auxSubDM, monitor->GetSolver()->GetSubDomain().GetSubAuxVector());
+                if (monitor->binary) {
+                    CurveSamples::WriteBinary(ablate::environment::RunEnvironment::Get().GetOutputDirectory() / (outputName + monitor->binaryFileExtension), componentNames, centroids, values);
+                }
             }
         } catch (std::exception& exp) {
             SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exp.what());
         }
-
-        curveFile.close();
     }
     PetscFunctionReturn(0);
 }
-void ablate::monitors::CurveMonitor::WriteToCurveFile(std::ostream& curveFile, PetscInt cStart, PetscInt cEnd, Vec cellGeomVec, const std::vector<domain::Field>& fields, DM dm, Vec valuesVec) {
-    DM cellGeomDM;
-    VecGetDM(cellGeomVec, &cellGeomDM) >> checkError;
-    const PetscScalar* cellGeomArray;
-    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
 
+void ablate::monitors::CurveMonitor::ReadValues(const std::vector<domain::Field>& fields, DM dm, Vec valuesVec, PetscInt componentOffset, PetscInt numberComponents,
+                                                std::vector<PetscReal>& localValues) const {
     // get the value field
     const PetscScalar* valuesArray;
     VecGetArrayRead(valuesVec, &valuesArray) >> checkError;
 
+    const auto& cells = samples->GetCells();
     for (const auto& field : fields) {
-        for (PetscInt comp = 0; comp < field.numberComponents; comp++) {
-            curveFile << "#" << field.name << (field.numberComponents > 1 ? "_" + field.components[comp] : "") << std::endl;
-
-            // march over each cell
-            for (PetscInt c = cStart; c < cEnd; c++) {
-                PetscFVCellGeom* cellGeom;
-                DMPlexPointLocalRead(cellGeomDM, c, cellGeomArray, &cellGeom) >> checkError;
-
-                // Now grab the field
-                const PetscScalar* values;
-                DMPlexPointGlobalFieldRead(dm, c, field.subId, valuesArray, &values) >> checkError;
-
-                if (values) {
-                    curveFile << cellGeom->centroid[0] << " ";
-                    curveFile << ((PetscAbs(values[comp]) < minimumOutputValue) ? 0.0 : values[comp]) << std::endl;
-                }
+        // march over each owned cell
+        for (std::size_t c = 0; c < cells.size(); c++) {
+            // Now grab the field
+            const PetscScalar* values;
+            DMPlexPointGlobalFieldRead(dm, cells[c], field.subId, valuesArray, &values) >> checkError;
+            for (PetscInt comp = 0; values && comp < field.numberComponents; comp++) {
+                localValues[c * numberComponents + componentOffset + comp] = PetscRealPart(values[comp]);
             }
         }
+        componentOffset += field.numberComponents;
     }
-    curveFile << std::endl;
-    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
     VecRestoreArrayRead(valuesVec, &valuesArray) >> checkError;
 }
 
 #include "registrar.hpp"
 REGISTER(ablate::monitors::Monitor, ablate::monitors::CurveMonitor, "Write 1D results to a curve file", OPT(ablate::io::interval::Interval, "interval", "output interval"),
-         OPT(std::string, "prefix", "the file prefix"));
+         OPT(std::string, "prefix", "the file prefix"), OPT(bool, "binary", "also write each output as a PETSc binary file with a vec for the centroid and each component (default is false)"));
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <memory>
+#include "curveSamples.hpp"
 #include "io/interval/interval.hpp"
 #include "monitor.hpp"
 
@@ -13,17 +14,32 @@ class CurveMonitor : public Monitor {
     const std::shared_ptr<io::interval::Interval> interval;
     const std::string filePrefix;
     inline static const std::string fileExtension = ".curve";
+    inline static const std::string binaryFileExtension = ".bin";
     /**
      * Curve output values cannot be lessthan the this minimum in order to be read into visit
      */
     inline static const PetscReal minimumOutputValue = 1E-64;
 
+    //! also write each output as a PETSc binary file
+    const bool binary;
+
+    //! the owned cells and their centroid, computed on the first output
+    std::unique_ptr<CurveSamples> samples;
+
     static PetscErrorCode OutputCurve(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
 
-    static void WriteToCurveFile(std::ostream& curveFile, PetscInt cStart, PetscInt cEnd, Vec cellGeomVec, const std::vector<domain::Field>& fields, DM dm, Vec vec);
+    /**
+     * Determine the owned cells in the sub dm and their centroid
+     */
+    void BuildSamples();
+
+    /**
+     * Copy the values of each field into the packed values for each owned cell
+     */
+    void ReadValues(const std::vector<domain::Field>& fields, DM dm, Vec vec, PetscInt componentOffset, PetscInt numberComponents, std::vector<PetscReal>& localValues) const;
 
    public:
-    CurveMonitor(std::shared_ptr<io::interval::Interval> interval, std::string prefix);
+    CurveMonitor(std::shared_ptr<io::interval::Interval> interval, std::string prefix, bool binary = false);
 
     void Register(std::shared_ptr<solver::Solver>) override;
     PetscMonitorFunction GetPetscFunction() override { return OutputCurve; }
@@ -0,0 +1,116 @@
+#include "curveSamples.hpp"
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::monitors::CurveSamples::CurveSamples(MPI_Comm comm, std::vector<PetscInt> cellsIn, std::vector<PetscReal> positionsIn) : cells(std::move(cellsIn)), positions(std::move(positionsIn)) {
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    // Only the ranks that own samples (and the first rank that writes them) take part in the gather
+    MPI_Comm_split(comm, (!cells.empty() || rank == 0) ? 0 : MPI_UNDEFINED, rank, &gatherComm) >> checkMpiError;
+    if (gatherComm == MPI_COMM_NULL) {
+        return;
+    }
+
+    PetscMPIInt gatherRank, gatherSize;
+    MPI_Comm_rank(gatherComm, &gatherRank) >> checkMpiError;
+    MPI_Comm_size(gatherComm, &gatherSize) >> checkMpiError;
+
+    // The counts never change so they are only gathered once
+    auto localCount = (PetscMPIInt)cells.size();
+    if (gatherRank == 0) {
+        gatherCounts.resize(gatherSize);
+        gatherOffsets.resize(gatherSize, 0);
+    }
+    MPI_Gather(&localCount, 1, MPI_INT, gatherCounts.data(), 1, MPI_INT, 0, gatherComm) >> checkMpiError;
+    if (gatherRank == 0) {
+        std::exclusive_scan(gatherCounts.begin(), gatherCounts.end(), gatherOffsets.begin(), 0);
+    }
+
+    // Determine the order of the samples along the curve
+    std::vector<PetscReal> globalPositions(gatherRank == 0 ? std::accumulate(gatherCounts.begin(), gatherCounts.end(), (std::size_t)0) : 0);
+    MPI_Gatherv(positions.data(), localCount, MPIU_REAL, globalPositions.data(), gatherCounts.data(), gatherOffsets.data(), MPIU_REAL, 0, gatherComm) >> checkMpiError;
+    if (gatherRank == 0) {
+        order.resize(globalPositions.size());
+        std::iota(order.begin(), order.end(), 0);
+        if (gatherSize > 1) {
+            std::stable_sort(order.begin(), order.end(), [&globalPositions](auto a, auto b) { return globalPositions[a] < globalPositions[b]; });
+        }
+    }
+}
+
+ablate::monitors::CurveSamples::~CurveSamples() {
+    if (gatherComm != MPI_COMM_NULL) {
+        MPI_Comm_free(&gatherComm) >> checkMpiError;
+    }
+}
+
+bool ablate::monitors::CurveSamples::IsRoot() const {
+    if (gatherComm == MPI_COMM_NULL) {
+        return false;
+    }
+    PetscMPIInt gatherRank;
+    MPI_Comm_rank(gatherComm, &gatherRank) >> checkMpiError;
+    return gatherRank == 0;
+}
+
+void ablate::monitors::CurveSamples::Gather(const std::vector<PetscReal>& localValues, PetscInt numberComponents, std::vector<PetscReal>& globalPositions,
+                                            std::vector<PetscReal>& globalValues) const {
+    if (gatherComm == MPI_COMM_NULL) {
+        return;
+    }
+    const bool root = IsRoot();
+
+    // Pack the position in front of the values for each sample
+    const PetscInt stride = numberComponents + 1;
+    std::vector<PetscReal> localPacked(cells.size() * stride);
+    for (std::size_t c = 0; c < cells.size(); ++c) {
+        localPacked[c * stride] = positions[c];
+        std::copy_n(localValues.begin() + c * numberComponents, numberComponents, localPacked.begin() + c * stride + 1);
+    }
+
+    std::vector<PetscMPIInt> counts, offsets;
+    for (std::size_t r = 0; root && r < gatherCounts.size(); ++r) {
+        counts.push_back(gatherCounts[r] * (PetscMPIInt)stride);
+        offsets.push_back(gatherOffsets[r] * (PetscMPIInt)stride);
+    }
+    std::vector<PetscReal> globalPacked(root ? order.size() * stride : 0);
+    MPI_Gatherv(localPacked.data(), (PetscMPIInt)localPacked.size(), MPIU_REAL, globalPacked.data(), counts.data(), offsets.data(), MPIU_REAL, 0, gatherComm) >> checkMpiError;
+
+    if (root) {
+        globalPositions.resize(order.size());
+        globalValues.resize(order.size() * numberComponents);
+        for (std::size_t i = 0; i < order.size(); ++i) {
+            globalPositions[i] = globalPacked[order[i] * stride];
+            std::copy_n(globalPacked.begin() + order[i] * stride + 1, numberComponents, globalValues.begin() + i * numberComponents);
+        }
+    }
+}
+
+void ablate::monitors::CurveSamples::WriteBinary(const std::filesystem::path& path, const std::vector<std::string>& componentNames, const std::vector<PetscReal>& globalPositions,
+                                                 const std::vector<PetscReal>& globalValues) {
+    PetscViewer viewer;
+    PetscViewerBinaryOpen(PETSC_COMM_SELF, path.c_str(), FILE_MODE_WRITE, &viewer) >> checkError;
+
+    const auto numberSamples = (PetscInt)globalPositions.size();
+    Vec vec;
+    VecCreateSeq(PETSC_COMM_SELF, numberSamples, &vec) >> checkError;
+
+    // write the positions followed by each component
+    for (std::size_t c = 0; c <= componentNames.size(); ++c) {
+        PetscObjectSetName((PetscObject)vec, c == 0 ? "position" : componentNames[c - 1].c_str()) >> checkError;
+        PetscScalar* array;
+        VecGetArray(vec, &array) >> checkError;
+        for (PetscInt i = 0; i < numberSamples; ++i) {
+            array[i] = c == 0 ? globalPositions[i] : globalValues[i * componentNames.size() + c - 1];
+        }
+        VecRestoreArray(vec, &array) >> checkError;
+        VecView(vec, viewer) >> checkError;
+    }
+
+    VecDestroy(&vec) >> checkError;
+    PetscViewerDestroy(&viewer) >> checkError;
+}
@@ -0,0 +1,74 @@
+#ifndef ABLATELIBRARY_CURVESAMPLES_HPP
+#define ABLATELIBRARY_CURVESAMPLES_HPP
+
+#include <petsc.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace ablate::monitors {
+
+/**
+ * The cells sampled along a curve and their position along the curve, computed once when the monitor is registered.  Each rank only holds the cells it owns,
+ * and the sampled values are gathered to the first rank through a persistent communicator that only includes the ranks with samples.
+ */
+class CurveSamples {
+   private:
+    //! the owned cells and their position along the curve
+    std::vector<PetscInt> cells;
+    std::vector<PetscReal> positions;
+
+    //! the communicator used to gather the samples, MPI_COMM_NULL if this rank does not take part
+    MPI_Comm gatherComm = MPI_COMM_NULL;
+
+    //! the number of samples and offset from each rank in the gather comm, only set on the first rank
+    std::vector<PetscMPIInt> gatherCounts;
+    std::vector<PetscMPIInt> gatherOffsets;
+
+    //! the order of the gathered samples along the curve, only set on the first rank
+    std::vector<std::size_t> order;
+
+   public:
+    /**
+     * @param comm the comm of the solver
+     * @param cells the owned cells along the curve
+     * @param positions the position of each cell along the curve
+     */
+    CurveSamples(MPI_Comm comm, std::vector<PetscInt> cells, std::vector<PetscReal> positions);
+    ~CurveSamples();
+
+    CurveSamples(const CurveSamples&) = delete;
+    CurveSamples& operator=(const CurveSamples&) = delete;
+
+    /**
+     * The owned cells along the curve
+     */
+    [[nodiscard]] const std::vector<PetscInt>& GetCells() const { return cells; }
+
+    /**
+     * True on the rank that receives the gathered samples
+     */
+    [[nodiscard]] bool IsRoot() const;
+
+    /**
+     * Gather the values, [cell][component], to the first rank
+     * @param localValues the values for each owned cell
+     * @param numberComponents the number of values per cell
+     * @param globalPositions the position of each sample, ordered along the curve, on the first rank
+     * @param globalValues the values of each sample, ordered along the curve, on the first rank
+     */
+    void Gather(const std::vector<PetscReal>& localValues, PetscInt numberComponents, std::vector<PetscReal>& globalPositions, std::vector<PetscReal>& globalValues) const;
+
+    /**
+     * Write the gathered samples as a PETSc binary file with a vec for the positions followed by a vec for each component
+     * @param path the output file
+     * @param componentNames the name of each component
+     * @param globalPositions the gathered positions
+     * @param globalValues the gathered values
+     */
+    static void WriteBinary(const std::filesystem::path& path, const std::vector<std::string>& componentNames, const std::vector<PetscReal>& globalPositions,
+                            const std::vector<PetscReal>& globalValues);
+};
+
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_CURVESAMPLES_HPP
@@ -1,29 +1,24 @@
 #include "extractLineMonitor.hpp"
 #include <fstream>
 #include <iostream>
+#include <set>
 #include <utilities/mpiError.hpp>
 #include <utilities/petscError.hpp>
 #include "environment/runEnvironment.hpp"
 
 ablate::monitors::ExtractLineMonitor::ExtractLineMonitor(int interval, std::string prefix, std::vector<double> start, std::vector<double> end, std::vector<std::string> outputFields,
-                                                         std::vector<std::string> outputAuxFields)
-    : interval(interval), start(start), end(end), outputFields(outputFields), outputAuxFields(outputAuxFields), filePrefix(prefix) {}
+                                                         std::vector<std::string> outputAuxFields, bool binary)
+    : interval(interval), start(start), end(end), outputFields(outputFields), outputAuxFields(outputAuxFields), filePrefix(prefix), binary(binary) {}
 
 void ablate::monitors::ExtractLineMonitor::Register(std::shared_ptr<solver::Solver> monitorableObject) {
     ablate::monitors::Monitor::Register(monitorableObject);
 
-    // this probe will only work with fV flow and a single process
+    // this probe will only work with fV flow
     flow = std::dynamic_pointer_cast<finiteVolume::FiniteVolumeSolver>(monitorableObject);
     if (!flow) {
         throw std::invalid_argument("The ExtractLineMonitor monitor can only be used with ablate::finiteVolume::FiniteVolume");
     }
-
-    // check the size
-    int size;
-    MPI_Comm_size(flow->GetSubDomain().GetComm(), &size) >> checkMpiError;
-    if (size != 1) {
-        throw std::runtime_error("The CurveMonitor monitor only works with a single mpi rank");
-    }
+    DM dm = flow->GetSubDomain().GetDM();
 
     // get the cell geom
     Vec cellGeomVec;
@@ -32,19 +27,15 @@ void ablate::monitors::ExtractLineMonitor::Register(std::shared_ptr<solver::Solv
 
     // get the min cell size
     PetscReal minCellRadius;
-    DMPlexGetGeometryFVM(flow->GetSubDomain().GetDM(), NULL, &cellGeomVec, &minCellRadius) >> checkError;
+    DMPlexGetGeometryFVM(dm, NULL, &cellGeomVec, &minCellRadius) >> checkError;
     VecGetDM(cellGeomVec, &dmCell) >> checkError;
     VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
 
-    PetscMPIInt rank;
-    MPI_Comm_rank(flow->GetSubDomain().GetComm(), &rank) >> checkMpiError;
-
     PetscInt dim;
-    DMGetDimension(flow->GetSubDomain().GetDM(), &dim) >> checkError;
+    DMGetDimension(dm, &dim) >> checkError;
 
-    // Now march over each subsegment in the line
+    // March over each subsegment in the line, computing every location up front so they can be located at once
     double ds = minCellRadius / 10.0;
-    double s = 0.0;
     double L = 0.0;
     std::vector<double> lineVec;
     for (std::size_t d = 0; d < start.size(); d++) {
@@ -55,85 +46,76 @@ void ablate::monitors::ExtractLineMonitor::Register(std::shared_ptr<solver::Solv
     for (auto& c : lineVec) {
         c /= L;
     }
+    std::vector<PetscScalar> locations;
+    for (double s = 0.0; s < L; s += ds) {
+        for (PetscInt d = 0; d < dim; d++) {
+            locations.push_back(start[d] + s * lineVec[d]);
+        }
+    }
 
-    // Create a location vector
     Vec locVec;
-    VecCreateSeq(PETSC_COMM_SELF, dim, &locVec) >> checkError;
-    VecSetBlockSize(locVec, dim) >> checkError;
+    VecCreateSeqWithArray(PETSC_COMM_SELF, dim, (PetscInt)locations.size(), locations.data(), &locVec) >> checkError;
+
+    // find the points in the mesh
+    PetscSF cellSF = NULL;
+    DMLocatePoints(dm, locVec, DM_POINTLOCATION_REMOVE, &cellSF) >> checkError;
+    const PetscSFNode* cells;
+    PetscInt numberFound;
+    PetscSFGetGraph(cellSF, NULL, &numberFound, NULL, &cells) >> checkError;
+
+    // cells shared from another rank are not owned, so they are sampled by the owning rank
+    PetscSF pointSF;
+    PetscInt numberLeaves;
+    const PetscInt* leaves = nullptr;
+    DMGetPointSF(dm, &pointSF) >> checkError;
+    PetscSFGetGraph(pointSF, nullptr, &numberLeaves, &leaves, nullptr) >> checkError;
+    std::set<PetscInt> countedCells;
+    for (PetscInt l = 0; l < PetscMax(numberLeaves, 0); ++l) {
+        countedCells.insert(leaves ? leaves[l] : l);
+    }
 
-    while (s < L) {
-        // Compute the current location
-        for (PetscInt d = 0; d < dim; d++) {
-            VecSetValue(locVec, d, s * lineVec[d], INSERT_VALUES) >> checkError;
-        }
-        VecAssemblyBegin(locVec) >> checkError;
-        VecAssemblyEnd(locVec) >> checkError;
-
-        // find the point in the mesh
-        PetscSF cellSF = NULL;
-        DMLocatePoints(flow->GetSubDomain().GetDM(), locVec, DM_POINTLOCATION_NONE, &cellSF) >> checkError;
-
-        const PetscSFNode* cells;
-        PetscInt numberFound;
-        PetscSFGetGraph(cellSF, NULL, &numberFound, NULL, &cells) >> checkError;
-        if (cells[0].rank == rank) {
-            // search over the history of indexes
-            if (std::find(indexLocations.begin(), indexLocations.end(), cells[0].index) == indexLocations.end()) {
-                // we have not counted this cell
-                indexLocations.push_back(cells[0].index);
-
-                // get the center location of this cell
-                PetscFVCellGeom* cellGeom;
-                DMPlexPointLocalRead(dmCell, cells[0].index, cellGeomArray, &cellGeom) >> checkError;
-                // figure out where this cell is along the line
-                double alongLine = 0.0;
-                for (PetscInt d = 0; d < dim; d++) {
-                    alongLine += PetscSqr(cellGeom->centroid[d] - start[d]);
-                }
-                distanceAlongLine.push_back(PetscSqrtReal(alongLine));
+    std::vector<PetscInt> indexLocations;
+    std::vector<PetscReal> distanceAlongLine;
+    for (PetscInt p = 0; p < numberFound; ++p) {
+        // we have not counted this cell
+        if (cells[p].index >= 0 && countedCells.insert(cells[p].index).second) {
+            indexLocations.push_back(cells[p].index);
+
+            // get the center location of this cell
+            PetscFVCellGeom* cellGeom;
+            DMPlexPointLocalRead(dmCell, cells[p].index, cellGeomArray, &cellGeom) >> checkError;
+            // figure out where this cell is along the line
+            double alongLine = 0.0;
+            for (PetscInt d = 0; d < dim; d++) {
+                alongLine += PetscSqr(cellGeom->centroid[d] - start[d]);
             }
+            distanceAlongLine.push_back(PetscSqrtReal(alongLine));
         }
-        PetscSFDestroy(&cellSF) >> checkError;
-        s += ds;
     }
+    PetscSFDestroy(&cellSF) >> checkError;
     VecDestroy(&locVec) >> checkError;
     VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+
+    samples = std::make_unique<CurveSamples>(flow->GetSubDomain().GetComm(), std::move(indexLocations), std::move(distanceAlongLine));
 }
 
-static PetscErrorCode OutputCurveForField(std::ostream& stream, PetscInt fieldIndex, const ablate::domain::Field& fieldDescription, const std::vector<PetscInt>& indexLocations,
-                                          const std::vector<PetscReal> distanceAlongLine, PetscErrorCode(plexPointRead)(DM, PetscInt, PetscInt, const PetscScalar*, void*), Vec u) {
+static PetscErrorCode ReadCurveValues(const std::vector<PetscInt>& indexLocations, const ablate::domain::Field& fieldDescription, PetscInt componentOffset, PetscInt numberComponents,
+                                      PetscErrorCode(plexPointRead)(DM, PetscInt, PetscInt, const PetscScalar*, void*), DM dm, Vec u, std::vector<PetscReal>& localValues) {
     PetscFunctionBeginUser;
     // Open the array
     const PetscScalar* uArray;
-    PetscErrorCode ierr = VecGetArrayRead(u, &uArray);
-    CHKERRQ(ierr);
-
-    // Get the DM for the vec
-    DM dm;
-    ierr = VecGetDM(u, &dm);
-    CHKERRQ(ierr);
-
-    // Output each component
-    for (PetscInt c = 0; c < fieldDescription.numberComponents; c++) {
-        stream << "#" << fieldDescription.name << (fieldDescription.numberComponents > 1 ? "_" + (fieldDescription.components.empty() ? std::to_string(c) : fieldDescription.components[c]) : "")
-               << std::endl;
-
-        // Output each cell
-        for (std::size_t i = 0; i < indexLocations.size(); i++) {
-            stream << distanceAlongLine[i] << " ";
-
-            // extract the location
-            const PetscScalar* values;
-            ierr = plexPointRead(dm, indexLocations[i], fieldIndex, uArray, &values);
-            CHKERRQ(ierr);
-
-            stream << values[c] << std::endl;
+    PetscCall(VecGetArrayRead(u, &uArray));
+
+    // copy each component of each cell into the packed values
+    for (std::size_t i = 0; i < indexLocations.size(); i++) {
+        const PetscScalar* values;
+        PetscCall(plexPointRead(dm, indexLocations[i], fieldDescription.id, uArray, &values));
+        for (PetscInt c = 0; c < fieldDescription.numberComponents; c++) {
+            localValues[i * numberComponents + componentOffset + c] = PetscRealPart(values[c]);
         }
-        stream << std::endl;
     }
 
-    ierr = VecRestoreArrayRead(u, &uArray);
-    CHKERRQ(ierr);
+    PetscCall(VecRestoreArrayRead(u, &uArray));
     PetscFunctionReturn(0);
 }
 
@@ -157,44 +139,81 @@ PetscErrorCode ablate::monitors::ExtractLineMonitor::OutputCurve(TS ts, PetscInt
 
     auto monitor = (ablate::monitors::ExtractLineMonitor*)mctx;
     auto flow = monitor->flow;
+    auto& subDomain = flow->GetSubDomain();
 
     if (steps == 0 || monitor->interval == 0 || (steps % monitor->interval == 0)) {
-        // Open a new file
-        std::filesystem::path outputFile =
-            ablate::environment::RunEnvironment::Get().GetOutputDirectory() / (monitor->filePrefix + "." + std::to_string(monitor->outputIndex) + monitor->fileExtension);
-        monitor->outputIndex++;
-        std::ofstream curveFile;
-        curveFile.open(outputFile);
-
-        // March over each solution vector
-        curveFile << "#title=" << flow->GetSolverId() << std::endl;
-        curveFile << "##time=" << time << std::endl << std::endl;
-
-        // output each solution variable
+        // Determine the name and offset of each component, the solution fields are followed by the aux fields
+        std::vector<std::string> componentNames;
+        std::vector<const domain::Field*> fields;
         for (const auto& fieldName : monitor->outputFields) {
-            auto fieldIndex = flow->GetSubDomain().GetField(fieldName).id;
-            const auto& fieldDescription = flow->GetSubDomain().GetField(fieldName);
-
-            ierr = OutputCurveForField(curveFile, fieldIndex, fieldDescription, monitor->indexLocations, monitor->distanceAlongLine, DMPlexPointGlobalFieldRead, u);
-            CHKERRQ(ierr);
+            fields.push_back(&subDomain.GetField(fieldName));
         }
-
-        // output each aux variable
         for (const auto& fieldName : monitor->outputAuxFields) {
-            auto fieldIndex = flow->GetSubDomain().GetField(fieldName).id;
-            const auto& fieldDescription = flow->GetSubDomain().GetField(fieldName);
-
-            ierr = OutputCurveForField(curveFile, fieldIndex, fieldDescription, monitor->indexLocations, monitor->distanceAlongLine, DMPlexPointLocalFieldRead, flow->GetSubDomain().GetAuxVector());
+            fields.push_back(&subDomain.GetField(fieldName));
+        }
+        for (const auto& field : fields) {
+            for (PetscInt c = 0; c < field->numberComponents; c++) {
+                componentNames.push_back(field->name + (field->numberComponents > 1 ? "_" + (field->components.empty() ? std::to_string(c) : field->components[c]) : ""));
+            }
+        }
+        const auto numberComponents = (PetscInt)componentNames.size();
+
+        // Read the owned cells directly
+        const auto& indexLocations = monitor->samples->GetCells();
+        std::vector<PetscReal> localValues(indexLocations.size() * numberComponents);
+        PetscInt componentOffset = 0;
+        for (std::size_t f = 0; f < fields.size(); f++) {
+            if (f < monitor->outputFields.size()) {
+                ierr = ReadCurveValues(indexLocations, *fields[f], componentOffset, numberComponents, DMPlexPointGlobalFieldRead, dm, u, localValues);
+            } else {
+                ierr = ReadCurveValues(indexLocations, *fields[f], componentOffset, numberComponents, DMPlexPointLocalFieldRead, subDomain.GetAuxDM(), subDomain.GetAuxVector(), localValues);
+            }
             CHKERRQ(ierr);
+            componentOffset += fields[f]->numberComponents;
         }
 
-        curveFile.close();
+        // Only the ranks with samples take part in the gather
+        std::vector<PetscReal> distanceAlongLine, values;
+        try {
+            monitor->samples->Gather(localValues, numberComponents, distanceAlongLine, values);
+
+            if (monitor->samples->IsRoot()) {
+                auto outputName = monitor->filePrefix + "." + std::to_string(monitor->outputIndex);
+
+                // Open a new file
+                std::filesystem::path outputFile = ablate::environment::RunEnvironment::Get().GetOutputDirectory() / (outputName + monitor->fileExtension);
+                std::ofstream curveFile;
+                curveFile.open(outputFile);
+
+                // March over each solution vector
+                curveFile << "#title=" << flow->GetSolverId() << std::endl;
+                curveFile << "##time=" << time << std::endl << std::endl;
+
+                // Output each component
+                for (PetscInt c = 0; c < numberComponents; c++) {
+                    curveFile << "#" << componentNames[c] << std::endl;
+                    for (std::size_t i = 0; i < distanceAlongLine.size(); i++) {
+                        curveFile << distanceAlongLine[i] << " " << values[i * numberComponents + c] << std::endl;
+                    }
+                    curveFile << std::endl;
+                }
+                curveFile.close();
+
+                if (monitor->binary) {
+                    CurveSamples::WriteBinary(
+                        ablate::environment::RunEnvironment::Get().GetOutputDirectory() / (outputName + monitor->binaryFileExtension), componentNames, distanceAlongLine, values);
+                }
+            }
+        } catch (std::exception& exp) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exp.what());
+        }
+        monitor->outputIndex++;
     }
-    CHKERRQ(ierr);
     PetscFunctionReturn(0);
 }
 
 #include "registrar.hpp"
 REGISTER(ablate::monitors::Monitor, ablate::monitors::ExtractLineMonitor, "Outputs the results along a line as a curve file (beta)", ARG(int, "interval", "output interval"),
          ARG(std::string, "prefix", "the file prefix"), ARG(std::vector<double>, "start", "the line start location"), ARG(std::vector<double>, "end", "the line end location"),
-         ARG(std::vector<std::string>, "outputFields", "a list of fields to write to the curve"), ARG(std::vector<std::string>, "outputAuxFields", "a list of aux fields to write to the curve "));
+         ARG(std::vector<std::string>, "outputFields", "a list of fields to write to the curve"), ARG(std::vector<std::string>, "outputAuxFields", "a list of aux fields to write to the curve "),
+         OPT(bool, "binary", "also write each output as a PETSc binary file with a vec for the position and each component (default is false)"));
@@ -2,7 +2,9 @@
 #define ABLATELIBRARY_EXTRACTLINEMONITOR_HPP
 
 #include <petsc.h>
+#include <memory>
 #include <vector>
+#include "curveSamples.hpp"
 #include "finiteVolume/finiteVolumeSolver.hpp"
 #include "monitor.hpp"
 namespace ablate::monitors {
@@ -18,17 +20,21 @@ class ExtractLineMonitor : public Monitor {
 
     const std::string filePrefix;
     inline static const std::string fileExtension = ".curve";
+    inline static const std::string binaryFileExtension = ".bin";
+
+    // also write each output as a PETSc binary file
+    const bool binary;
 
     // working variables
     PetscInt outputIndex = 0; /*keep track of the local cell number we are outputting*/
-    std::vector<PetscInt> indexLocations;
-    std::vector<PetscReal> distanceAlongLine;
+    std::unique_ptr<CurveSamples> samples;
     std::shared_ptr<ablate::finiteVolume::FiniteVolumeSolver> flow;
 
     static PetscErrorCode OutputCurve(TS ts, PetscInt steps, PetscReal time, Vec u, void *mctx);
 
    public:
-    ExtractLineMonitor(int interval, std::string prefix, std::vector<double> start, std::vector<double> end, std::vector<std::string> outputFields, const std::vector<std::string> outputAuxFields);
+    ExtractLineMonitor(int interval, std::string prefix, std::vector<double> start, std::vector<double> end, std::vector<std::string> outputFields, const std::vector<std::string> outputAuxFields,
+                       bool binary = false);
 
     void Register(std::shared_ptr<solver::Solver>) override;
     PetscMonitorFunction GetPetscFunction() override { return OutputCurve; }
@@ -36,4 +42,4 @@ class ExtractLineMonitor : public Monitor {
 
 }  // namespace ablate::monitors
 
-#endif  // ABLATELIBRARY_EXTRACTLINEMONITOR_HPP
\ No newline at end of file
+#endif  // ABLATELIBRARY_EXTRACTLINEMONITOR_HPP
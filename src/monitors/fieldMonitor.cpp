@@ -14,15 +14,25 @@ void ablate::monitors::FieldMonitor::Register(std::string id, std::shared_ptr<so
         }
     }
 
+    // hold onto the description, the monitor domain is created on first use
+    monitorId = std::move(id);
+    monitorFieldDescriptors = std::move(fieldDescriptors);
+}
+
+const std::shared_ptr<ablate::domain::SubDomain>& ablate::monitors::FieldMonitor::GetMonitorSubDomain() {
+    if (monitorSubDomain) {
+        return monitorSubDomain;
+    }
+
     // Create a subDomain only over this solver region
     DM subDm;
-    solverIn->GetSubDomain().CreateEmptySubDM(&subDm, solverIn->GetRegion());
+    GetSolver()->GetSubDomain().CreateEmptySubDM(&subDm, GetSolver()->GetRegion());
 
     // name the subDm
-    PetscObjectSetName((PetscObject)subDm, id.c_str()) >> checkError;
+    PetscObjectSetName((PetscObject)subDm, monitorId.c_str()) >> checkError;
 
     // Create a domain
-    monitorDomain = std::make_shared<ablate::domain::DMTransfer>(subDm, fieldDescriptors);
+    monitorDomain = std::make_shared<ablate::domain::DMTransfer>(subDm, monitorFieldDescriptors);
 
     // Init the monitorDomain
     monitorDomain->InitializeSubDomains({}, {});
@@ -32,11 +42,12 @@ void ablate::monitors::FieldMonitor::Register(std::string id, std::shared_ptr<so
 
     // remove the name for this vector
     PetscObjectSetName((PetscObject)monitorSubDomain->GetSolutionVector(), "monitor") >> checkError;
+    return monitorSubDomain;
 }
 
 void ablate::monitors::FieldMonitor::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
-    monitorSubDomain->Save(viewer, sequenceNumber, time);
+    GetMonitorSubDomain()->Save(viewer, sequenceNumber, time);
     PetscFunctionReturnVoid();
 }
-void ablate::monitors::FieldMonitor::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) { monitorSubDomain->Restore(viewer, sequenceNumber, time); }
+void ablate::monitors::FieldMonitor::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) { GetMonitorSubDomain()->Restore(viewer, sequenceNumber, time); }
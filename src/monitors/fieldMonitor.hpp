@@ -2,6 +2,7 @@
 #define ABLATELIBRARY_FIELDMONITOR_HPP
 
 #include <petsc.h>
+#include <string>
 #include <vector>
 #include "io/serializable.hpp"
 #include "monitor.hpp"
@@ -13,19 +14,30 @@ namespace ablate::monitors {
  */
 class FieldMonitor : public Monitor, public io::Serializable {
    private:
+    // the id and field descriptors for the monitor domain, kept so the domain can be created on first use
+    std::string monitorId;
+    std::vector<std::shared_ptr<domain::FieldDescriptor>> monitorFieldDescriptors;
+
     // Reuse the domain object to set up a domain to hold the monitor vector/dm
     std::shared_ptr<ablate::domain::Domain> monitorDomain = nullptr;
 
-   protected:
     // Hold onto the subdomain for this monitor.  It should be over the entire monitorDomain
     std::shared_ptr<ablate::domain::SubDomain> monitorSubDomain = nullptr;
 
+   protected:
+    /**
+     * Returns the subdomain for this monitor, the monitor dm, fields, and vectors are created the first time this is called so monitors that never
+     * fire (or are never saved) do not allocate them
+     * @return
+     */
+    const std::shared_ptr<ablate::domain::SubDomain>& GetMonitorSubDomain();
+
    public:
     /**
      * only required function, returns the id of the object.  Should be unique for the simulation
      * @return
      */
-    const std::string& GetId() const override { return monitorDomain->GetName(); }
+    const std::string& GetId() const override { return monitorId; }
 
     /**
      * In order to use the base class, the Register call must be overridden and Register(std::shared_ptr<solver::Solver> solverIn, std::vector<domain::FieldDescription> fields) must be called from the
@@ -35,7 +47,7 @@ class FieldMonitor : public Monitor, public io::Serializable {
     void Register(std::shared_ptr<solver::Solver> solverIn) override = 0;
 
     /**
-     * In order to use the base class, the Register call must be overridden and
+     * In order to use the base class, the Register call must be overridden and this called.  The monitor domain is not created until it is used.
      * @param solverIn
      */
     void Register(std::string id, std::shared_ptr<solver::Solver> solverIn, std::vector<std::shared_ptr<domain::FieldDescriptor>> fields);
@@ -0,0 +1,355 @@
+#include "homogeneousStatistics.hpp"
+#include <set>
+#include <utility>
+#include "io/interval/fixedInterval.hpp"
+#include "solver/range.hpp"
+#include "utilities/constants.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::monitors::HomogeneousStatistics::HomogeneousStatistics(std::string name, std::vector<std::string> fields, int homogeneousDirection, int profileDirection, int bins,
+                                                               std::vector<double> spectrumStart, int spectrumPoints, std::shared_ptr<io::interval::Interval> interval)
+    : name(std::move(name)),
+      fieldNames(std::move(fields)),
+      homogeneousDirection(homogeneousDirection),
+      profileDirection(profileDirection),
+      bins(bins > 0 ? bins : 50),
+      spectrumStart(spectrumStart.begin(), spectrumStart.end()),
+      spectrumPoints(spectrumPoints > 0 ? spectrumPoints : 0),
+      interval(interval ? std::move(interval) : std::make_shared<io::interval::FixedInterval>()) {
+    if (homogeneousDirection == profileDirection) {
+        throw std::invalid_argument("The homogeneousDirection and profileDirection in HomogeneousStatistics " + this->name + " must be different.");
+    }
+}
+
+void ablate::monitors::HomogeneousStatistics::Register(std::shared_ptr<solver::Solver> solverIn) {
+    Monitor::Register(solverIn);
+    auto& subDomain = solverIn->GetSubDomain();
+    DM dm = subDomain.GetDM();
+    const PetscInt dim = subDomain.GetDimensions();
+
+    if (homogeneousDirection < 0 || homogeneousDirection >= dim || profileDirection < 0 || profileDirection >= dim) {
+        throw std::invalid_argument("The homogeneousDirection and profileDirection in HomogeneousStatistics " + name + " must be less than the dimension " + std::to_string(dim) + ".");
+    }
+
+    // Only FVM fields are supported so that the cell values can be read directly
+    numberComponents = 0;
+    for (const auto& fieldName : fieldNames) {
+        const auto& field = subDomain.GetField(fieldName);
+        if (field.type != domain::FieldType::FVM) {
+            throw std::invalid_argument("HomogeneousStatistics only supports FVM fields, " + fieldName + " is not.");
+        }
+        numberComponents += field.numberComponents;
+    }
+
+    // The bins and spectrum line span the entire domain
+    PetscReal globalMin[3], globalMax[3];
+    DMGetBoundingBox(dm, globalMin, globalMax) >> checkError;
+    profileMin = globalMin[profileDirection];
+    profileMax = globalMax[profileDirection];
+    homogeneousLength = globalMax[homogeneousDirection] - globalMin[homogeneousDirection];
+
+    // cells shared from another rank are not owned, so they are skipped
+    PetscSF pointSF;
+    PetscInt numberLeaves;
+    const PetscInt* leaves = nullptr;
+    DMGetPointSF(dm, &pointSF) >> checkError;
+    PetscSFGetGraph(pointSF, nullptr, &numberLeaves, &leaves, nullptr) >> checkError;
+    std::set<PetscInt> sharedPoints;
+    for (PetscInt l = 0; l < PetscMax(numberLeaves, 0); ++l) {
+        sharedPoints.insert(leaves ? leaves[l] : l);
+    }
+
+    // Precompute the bin and volume of each owned cell
+    cells.clear();
+    cellBins.clear();
+    cellVolumes.clear();
+    solver::Range cellRange;
+    solverIn->GetCellRange(cellRange);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+        if (sharedPoints.count(cell)) {
+            continue;
+        }
+        PetscReal volume;
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(dm, cell, &volume, centroid, nullptr) >> checkError;
+
+        auto bin = (PetscInt)PetscFloorReal((centroid[profileDirection] - profileMin) / (profileMax - profileMin) * bins);
+        cells.push_back(cell);
+        cellBins.push_back(PetscMin(PetscMax(bin, 0), bins - 1));
+        cellVolumes.push_back(volume);
+    }
+    solverIn->RestoreRange(cellRange);
+    profileSums.assign(bins * ProfileStride(), 0.0);
+
+    // Determine which rank owns each point in the spectrum line
+    spectrumCells.clear();
+    spectrumSums.clear();
+    if (spectrumPoints > 0) {
+        if ((PetscInt)spectrumStart.size() < dim) {
+            throw std::invalid_argument("The spectrumStart in HomogeneousStatistics " + name + " must be at least dimension " + std::to_string(dim) + ".");
+        }
+
+        // the points are cell centered along the homogeneous direction
+        std::vector<PetscScalar> linePoints(spectrumPoints * dim);
+        for (PetscInt p = 0; p < spectrumPoints; ++p) {
+            for (PetscInt d = 0; d < dim; d++) {
+                linePoints[p * dim + d] = spectrumStart[d];
+            }
+            linePoints[p * dim + homogeneousDirection] = globalMin[homogeneousDirection] + (p + 0.5) * homogeneousLength / spectrumPoints;
+        }
+        Vec pointVec;
+        VecCreateSeqWithArray(PETSC_COMM_SELF, dim, (PetscInt)linePoints.size(), linePoints.data(), &pointVec) >> checkError;
+
+        PetscSF cellSF = nullptr;
+        DMLocatePoints(dm, pointVec, DM_POINTLOCATION_REMOVE, &cellSF) >> checkError;
+        PetscInt numFound;
+        const PetscSFNode* foundCells = nullptr;
+        const PetscInt* foundPoints = nullptr;
+        PetscSFGetGraph(cellSF, nullptr, &numFound, &foundPoints, &foundCells) >> checkError;
+
+        // Let the lowest rank process own each point
+        PetscMPIInt rank, size;
+        MPI_Comm_rank(subDomain.GetComm(), &rank) >> checkMpiError;
+        MPI_Comm_size(subDomain.GetComm(), &size) >> checkMpiError;
+        std::vector<PetscMPIInt> foundProcs(spectrumPoints, size);
+        std::vector<PetscMPIInt> globalProcs(spectrumPoints, size);
+        std::vector<PetscInt> foundCellIndex(spectrumPoints, -1);
+        for (PetscInt p = 0; p < numFound; ++p) {
+            if (foundCells[p].index >= 0 && !sharedPoints.count(foundCells[p].index)) {
+                const auto point = foundPoints ? foundPoints[p] : p;
+                foundProcs[point] = rank;
+                foundCellIndex[point] = foundCells[p].index;
+            }
+        }
+        MPI_Allreduce(foundProcs.data(), globalProcs.data(), spectrumPoints, MPI_INT, MPI_MIN, subDomain.GetComm()) >> checkMpiError;
+
+        spectrumCells.resize(spectrumPoints, -1);
+        for (PetscInt p = 0; p < spectrumPoints; ++p) {
+            if (globalProcs[p] == size) {
+                throw std::invalid_argument("Cannot locate spectrum point " + std::to_string(p) + " in HomogeneousStatistics " + name + ".");
+            } else if (globalProcs[p] == rank) {
+                spectrumCells[p] = foundCellIndex[p];
+            }
+        }
+        spectrumSums.assign(SpectrumSize() * numberComponents, 0.0);
+
+        PetscSFDestroy(&cellSF) >> checkError;
+        VecDestroy(&pointVec) >> checkError;
+    }
+}
+
+PetscErrorCode ablate::monitors::HomogeneousStatistics::MonitorHomogeneousStatistics(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::HomogeneousStatistics*)ctx;
+
+    if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
+        monitor->samples++;
+        auto& subDomain = monitor->GetSolver()->GetSubDomain();
+        const PetscInt stride = monitor->ProfileStride();
+
+        // the line values are gathered on every rank for the spectrum, [point][component]
+        std::vector<PetscReal> lineValues(monitor->spectrumCells.size() * monitor->numberComponents, 0.0);
+
+        // Accumulate each field directly from the solution (global) or aux (local) vector
+        PetscInt componentOffset = 0;
+        for (const auto& fieldName : monitor->fieldNames) {
+            const auto& field = subDomain.GetField(fieldName);
+            const bool solutionField = field.location == domain::FieldLocation::SOL;
+            Vec fieldVec = solutionField ? subDomain.GetSolutionVector() : subDomain.GetAuxVector();
+            const PetscScalar* fieldArray;
+            PetscCall(VecGetArrayRead(fieldVec, &fieldArray));
+
+            for (std::size_t c = 0; c < monitor->cells.size(); ++c) {
+                const PetscScalar* values = nullptr;
+                if (solutionField) {
+                    PetscCall(DMPlexPointGlobalFieldRead(subDomain.GetDM(), monitor->cells[c], field.id, fieldArray, &values));
+                } else {
+                    PetscCall(DMPlexPointLocalFieldRead(subDomain.GetAuxDM(), monitor->cells[c], field.id, fieldArray, &values));
+                }
+                if (!values) {
+                    continue;
+                }
+                const PetscReal volume = monitor->cellVolumes[c];
+                PetscReal* binSums = monitor->profileSums.data() + monitor->cellBins[c] * stride;
+                for (PetscInt p = 0; p < field.numberComponents; ++p) {
+                    const PetscReal value = PetscRealPart(values[p]);
+                    binSums[1 + 2 * (componentOffset + p)] += volume * value;
+                    binSums[2 + 2 * (componentOffset + p)] += volume * value * value;
+                }
+            }
+
+            for (std::size_t l = 0; l < monitor->spectrumCells.size(); ++l) {
+                if (monitor->spectrumCells[l] < 0) {
+                    continue;
+                }
+                const PetscScalar* values = nullptr;
+                if (solutionField) {
+                    PetscCall(DMPlexPointGlobalFieldRead(subDomain.GetDM(), monitor->spectrumCells[l], field.id, fieldArray, &values));
+                } else {
+                    PetscCall(DMPlexPointLocalFieldRead(subDomain.GetAuxDM(), monitor->spectrumCells[l], field.id, fieldArray, &values));
+                }
+                for (PetscInt p = 0; values && p < field.numberComponents; ++p) {
+                    lineValues[l * monitor->numberComponents + componentOffset + p] = PetscRealPart(values[p]);
+                }
+            }
+
+            PetscCall(VecRestoreArrayRead(fieldVec, &fieldArray));
+            componentOffset += field.numberComponents;
+        }
+
+        // the volume of each bin is accumulated once per sample
+        for (std::size_t c = 0; c < monitor->cells.size(); ++c) {
+            monitor->profileSums[monitor->cellBins[c] * stride] += monitor->cellVolumes[c];
+        }
+
+        // Each point is owned by a single rank, so the line is assembled with a sum
+        if (!lineValues.empty()) {
+            PetscCallMPI(MPI_Allreduce(MPI_IN_PLACE, lineValues.data(), (PetscMPIInt)lineValues.size(), MPIU_REAL, MPIU_SUM, subDomain.GetComm()));
+
+            PetscMPIInt rank;
+            PetscCallMPI(MPI_Comm_rank(subDomain.GetComm(), &rank));
+            if (rank == 0) {
+                // The line is short, so the one-sided power spectrum is computed with a direct transform
+                const PetscInt n = monitor->spectrumPoints;
+                for (PetscInt k = 0; k < monitor->SpectrumSize(); ++k) {
+                    for (PetscInt p = 0; p < monitor->numberComponents; ++p) {
+                        PetscReal real = 0.0, imag = 0.0;
+                        for (PetscInt l = 0; l < n; ++l) {
+                            const PetscReal angle = 2.0 * ablate::utilities::Constants::pi * (PetscReal)(k * l) / n;
+                            real += lineValues[l * monitor->numberComponents + p] * PetscCosReal(angle);
+                            imag -= lineValues[l * monitor->numberComponents + p] * PetscSinReal(angle);
+                        }
+                        monitor->spectrumSums[k * monitor->numberComponents + p] += (real * real + imag * imag) / (PetscReal)(n * n);
+                    }
+                }
+            }
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
+void ablate::monitors::HomogeneousStatistics::ViewArray(PetscViewer viewer, const char* arrayName, PetscInt blockSize, const std::vector<PetscReal>& values) {
+    PetscMPIInt rank;
+    MPI_Comm_rank(PetscObjectComm((PetscObject)viewer), &rank) >> checkMpiError;
+
+    Vec vec;
+    VecCreate(PetscObjectComm((PetscObject)viewer), &vec) >> checkError;
+    VecSetSizes(vec, rank == 0 ? (PetscInt)values.size() : 0, PETSC_DECIDE) >> checkError;
+    VecSetBlockSize(vec, blockSize) >> checkError;
+    VecSetFromOptions(vec) >> checkError;
+    PetscObjectSetName((PetscObject)vec, arrayName) >> checkError;
+    if (rank == 0) {
+        PetscScalar* array;
+        VecGetArray(vec, &array) >> checkError;
+        std::copy(values.begin(), values.end(), array);
+        VecRestoreArray(vec, &array) >> checkError;
+    }
+    VecView(vec, viewer) >> checkError;
+    VecDestroy(&vec) >> checkError;
+}
+
+void ablate::monitors::HomogeneousStatistics::LoadArray(PetscViewer viewer, const char* arrayName, PetscInt blockSize, std::vector<PetscReal>& values) {
+    PetscMPIInt rank;
+    MPI_Comm_rank(PetscObjectComm((PetscObject)viewer), &rank) >> checkMpiError;
+
+    Vec vec;
+    VecCreate(PetscObjectComm((PetscObject)viewer), &vec) >> checkError;
+    VecSetSizes(vec, rank == 0 ? (PetscInt)values.size() : 0, PETSC_DECIDE) >> checkError;
+    VecSetBlockSize(vec, blockSize) >> checkError;
+    VecSetFromOptions(vec) >> checkError;
+    PetscObjectSetName((PetscObject)vec, arrayName) >> checkError;
+    VecLoad(vec, viewer) >> checkError;
+
+    // the sums are additive, so the first rank holds the restored values and the others restart from zero
+    std::fill(values.begin(), values.end(), 0.0);
+    if (rank == 0) {
+        const PetscScalar* array;
+        VecGetArrayRead(vec, &array) >> checkError;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = PetscRealPart(array[i]);
+        }
+        VecRestoreArrayRead(vec, &array) >> checkError;
+    }
+    VecDestroy(&vec) >> checkError;
+}
+
+void ablate::monitors::HomogeneousStatistics::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
+    PetscMPIInt rank;
+    MPI_Comm comm = GetSolver()->GetSubDomain().GetComm();
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    // The local sums are only reduced for output
+    std::vector<PetscReal> globalProfileSums(profileSums.size(), 0.0);
+    MPI_Reduce(profileSums.data(), globalProfileSums.data(), (PetscMPIInt)profileSums.size(), MPIU_REAL, MPIU_SUM, 0, comm) >> checkMpiError;
+
+    // Compute the profile, [bin][position, (mean, rms) for each component]
+    const PetscInt stride = ProfileStride();
+    std::vector<PetscReal> profile(rank == 0 ? bins * stride : 0, 0.0);
+    if (rank == 0) {
+        for (PetscInt b = 0; b < bins; ++b) {
+            const PetscReal* binSums = globalProfileSums.data() + b * stride;
+            PetscReal* binProfile = profile.data() + b * stride;
+            binProfile[0] = profileMin + (b + 0.5) * (profileMax - profileMin) / bins;
+            for (PetscInt p = 0; binSums[0] > 0.0 && p < numberComponents; ++p) {
+                const PetscReal mean = binSums[1 + 2 * p] / binSums[0];
+                binProfile[1 + 2 * p] = mean;
+                binProfile[2 + 2 * p] = PetscSqrtReal(PetscMax(binSums[2 + 2 * p] / binSums[0] - mean * mean, 0.0));
+            }
+        }
+    }
+    ViewArray(viewer, "profile", stride, profile);
+    ViewArray(viewer, "profileSums", stride, rank == 0 ? globalProfileSums : std::vector<PetscReal>());
+
+    if (spectrumPoints > 0) {
+        // The spectrum is only accumulated on the first rank, [wavenumber][wavenumber, (power) for each component]
+        const PetscInt spectrumSize = SpectrumSize();
+        std::vector<PetscReal> spectrum(rank == 0 ? spectrumSize * (1 + numberComponents) : 0, 0.0);
+
+        // The two-point correlation is the inverse cosine transform of the averaged spectrum, [separation][separation, (correlation) for each component]
+        std::vector<PetscReal> correlation(rank == 0 ? spectrumSize * (1 + numberComponents) : 0, 0.0);
+        if (rank == 0 && samples > 0) {
+            for (PetscInt k = 0; k < spectrumSize; ++k) {
+                spectrum[k * (1 + numberComponents)] = 2.0 * ablate::utilities::Constants::pi * k / homogeneousLength;
+                correlation[k * (1 + numberComponents)] = k * homogeneousLength / spectrumPoints;
+                for (PetscInt p = 0; p < numberComponents; ++p) {
+                    spectrum[k * (1 + numberComponents) + 1 + p] = spectrumSums[k * numberComponents + p] / samples;
+                }
+            }
+            for (PetscInt r = 0; r < spectrumSize; ++r) {
+                for (PetscInt k = 0; k < spectrumSize; ++k) {
+                    // the two-sided spectrum is symmetric, so all but the zero and Nyquist wavenumbers are counted twice
+                    const PetscReal weight = (k == 0 || 2 * k == spectrumPoints) ? 1.0 : 2.0;
+                    const PetscReal cosine = PetscCosReal(2.0 * ablate::utilities::Constants::pi * (PetscReal)(k * r) / spectrumPoints);
+                    for (PetscInt p = 0; p < numberComponents; ++p) {
+                        correlation[r * (1 + numberComponents) + 1 + p] += weight * spectrum[k * (1 + numberComponents) + 1 + p] * cosine;
+                    }
+                }
+            }
+        }
+        ViewArray(viewer, "spectrum", 1 + numberComponents, spectrum);
+        ViewArray(viewer, "correlation", 1 + numberComponents, correlation);
+        ViewArray(viewer, "spectrumSums", numberComponents, rank == 0 ? spectrumSums : std::vector<PetscReal>());
+    }
+
+    ablate::io::Serializable::SaveKeyValue(viewer, "samples", samples);
+}
+
+void ablate::monitors::HomogeneousStatistics::Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
+    LoadArray(viewer, "profileSums", ProfileStride(), profileSums);
+    if (spectrumPoints > 0) {
+        LoadArray(viewer, "spectrumSums", numberComponents, spectrumSums);
+    }
+    ablate::io::Serializable::RestoreKeyValue(viewer, "samples", samples);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::HomogeneousStatistics,
+         "Computes in-situ time and homogeneous direction averaged profiles of FVM fields along with the spectrum and two-point correlation along a line",
+         ARG(std::string, "name", "the name used to identify the output"), ARG(std::vector<std::string>, "fields", "the FVM fields to compute the statistics for"),
+         ARG(int, "homogeneousDirection", "the direction (0, 1, 2) that the statistics are averaged over"), ARG(int, "profileDirection", "the direction (0, 1, 2) that the averages are binned along"),
+         OPT(int, "bins", "the number of bins along the profile direction (default is 50)"),
+         OPT(std::vector<double>, "spectrumStart", "the start of the line used for the spectrum and two-point correlation, the homogeneous coordinate is ignored"),
+         OPT(int, "spectrumPoints", "the number of uniformly spaced points in the spectrum line, the spectrum is not computed if zero (default is 0)"),
+         OPT(ablate::io::interval::Interval, "interval", "determine when to sample the statistics (default is every step)"));
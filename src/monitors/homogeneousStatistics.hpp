@@ -0,0 +1,121 @@
+#ifndef ABLATELIBRARY_HOMOGENEOUSSTATISTICS_HPP
+#define ABLATELIBRARY_HOMOGENEOUSSTATISTICS_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "domain/field.hpp"
+#include "io/interval/interval.hpp"
+#include "io/serializable.hpp"
+#include "monitor.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Computes in-situ statistics of FVM fields for flows with a homogeneous direction.  The fields are averaged in time and over the homogeneous direction
+ * (planes in 3D, lines in 2D) into bins along the profile direction.  Optionally, each field is sampled along a line in the homogeneous direction to accumulate
+ * the power spectrum and the two-point correlation (computed from the averaged spectrum).  Only the local running sums are updated each sample, they are
+ * reduced to the first rank when output so that the compact profiles and spectra can be written instead of the full field.
+ */
+class HomogeneousStatistics : public Monitor, public io::Serializable {
+   private:
+    //! the name used to identify the output
+    const std::string name;
+
+    //! the FVM fields (solution or aux) to compute the statistics for
+    const std::vector<std::string> fieldNames;
+
+    //! the direction that the statistics are averaged over
+    const PetscInt homogeneousDirection;
+
+    //! the direction that the averages are binned along
+    const PetscInt profileDirection;
+
+    //! the number of bins along the profile direction
+    const PetscInt bins;
+
+    //! the start of the spectrum line, the coordinate in the homogeneous direction is ignored
+    const std::vector<PetscReal> spectrumStart;
+
+    //! the number of uniformly spaced points in the spectrum line
+    const PetscInt spectrumPoints;
+
+    //! determine when to sample the statistics
+    const std::shared_ptr<io::interval::Interval> interval;
+
+    //! the total number of components in all fields
+    PetscInt numberComponents = 0;
+
+    //! the extent of the domain in the profile and homogeneous directions
+    PetscReal profileMin = 0.0;
+    PetscReal profileMax = 0.0;
+    PetscReal homogeneousLength = 0.0;
+
+    //! the owned cells along with their bin and volume
+    std::vector<PetscInt> cells;
+    std::vector<PetscInt> cellBins;
+    std::vector<PetscReal> cellVolumes;
+
+    //! the owned cell for each spectrum point, or -1 if the point is owned by another rank
+    std::vector<PetscInt> spectrumCells;
+
+    //! the local running sums, [bin][volume, (sum, sumSqr) for each component]
+    std::vector<PetscReal> profileSums;
+
+    //! the running sum of the power spectrum, [wavenumber][component], only accumulated on the first rank
+    std::vector<PetscReal> spectrumSums;
+
+    //! the number of samples in the sums
+    PetscInt samples = 0;
+
+    /**
+     * The number of values stored per bin
+     */
+    [[nodiscard]] inline PetscInt ProfileStride() const { return 1 + 2 * numberComponents; }
+
+    /**
+     * The number of wavenumbers in the one-sided spectrum
+     */
+    [[nodiscard]] inline PetscInt SpectrumSize() const { return spectrumPoints / 2 + 1; }
+
+    /**
+     * Helper function to view/load an array that is only stored on the first rank
+     */
+    static void ViewArray(PetscViewer viewer, const char* arrayName, PetscInt blockSize, const std::vector<PetscReal>& values);
+    static void LoadArray(PetscViewer viewer, const char* arrayName, PetscInt blockSize, std::vector<PetscReal>& values);
+
+    static PetscErrorCode MonitorHomogeneousStatistics(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
+
+   public:
+    /**
+     * @param name the name used to identify the output
+     * @param fields the FVM fields to compute the statistics for
+     * @param homogeneousDirection the direction that the statistics are averaged over
+     * @param profileDirection the direction that the averages are binned along
+     * @param bins the number of bins along the profile direction (default is 50)
+     * @param spectrumStart the start of the line used for the spectrum and two-point correlation
+     * @param spectrumPoints the number of points in the spectrum line, the spectrum is not computed if zero
+     * @param interval determine when to sample the statistics
+     */
+    HomogeneousStatistics(std::string name, std::vector<std::string> fields, int homogeneousDirection, int profileDirection, int bins = {}, std::vector<double> spectrumStart = {},
+                          int spectrumPoints = {}, std::shared_ptr<io::interval::Interval> interval = {});
+
+    void Register(std::shared_ptr<solver::Solver> solver) override;
+
+    PetscMonitorFunction GetPetscFunction() override { return MonitorHomogeneousStatistics; }
+
+    [[nodiscard]] const std::string& GetId() const override { return name; }
+
+    /**
+     * Reduce the running sums and write the profiles, spectrum, and correlation
+     */
+    void Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    /**
+     * Restore the running sums
+     */
+    void Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+};
+
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_HOMOGENEOUSSTATISTICS_HPP
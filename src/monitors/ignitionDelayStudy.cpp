@@ -0,0 +1,276 @@
+#include "ignitionDelayStudy.hpp"
+#include <TChem_IgnitionZeroD.hpp>
+#include <TChem_Impl_IgnitionZeroD_Problem.hpp>
+#include <algorithm>
+#include <cctype>
+#include "monitors/logs/stdOut.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+//! the universal gas constant (J/(kmol K)) used to compute the initial density
+static constexpr double universalGasConstant = 8314.462618;
+
+ablate::monitors::IgnitionDelayStudy::IgnitionDelayStudy(std::shared_ptr<eos::TChem> eosIn, std::vector<double> temperaturesIn, std::vector<double> pressuresIn,
+                                                         std::vector<double> equivalenceRatiosIn, const std::shared_ptr<ablate::parameters::Parameters>& fuelIn,
+                                                         const std::shared_ptr<ablate::parameters::Parameters>& oxidizerIn, double endTime, int numberIntervals, double temperatureIncrease,
+                                                         const std::shared_ptr<ablate::parameters::Parameters>& options, std::shared_ptr<logs::Log> logIn)
+    : eos(std::move(eosIn)),
+      temperatures(std::move(temperaturesIn)),
+      pressures(std::move(pressuresIn)),
+      equivalenceRatios(std::move(equivalenceRatiosIn)),
+      fuel(fuelIn ? fuelIn->ToMap<double>() : std::map<std::string, double>{}),
+      oxidizer(oxidizerIn ? oxidizerIn->ToMap<double>() : std::map<std::string, double>{}),
+      endTime(endTime),
+      numberIntervals(numberIntervals > 0 ? numberIntervals : 1000),
+      temperatureIncrease(temperatureIncrease > 0.0 ? temperatureIncrease : 400.0),
+      log(logIn ? logIn : std::make_shared<logs::StdOut>()) {
+    if (temperatures.empty() || pressures.empty() || equivalenceRatios.empty()) {
+        throw std::invalid_argument("The IgnitionDelayStudy requires at least one temperature, pressure, and equivalenceRatio");
+    }
+    if (endTime <= 0.0) {
+        throw std::invalid_argument("The IgnitionDelayStudy requires a positive endTime");
+    }
+
+    // check that each of the fuel and oxidizer species is known to the eos
+    const auto& species = eos->GetSpeciesVariables();
+    for (const auto& stream : {fuel, oxidizer}) {
+        if (stream.empty()) {
+            throw std::invalid_argument("The IgnitionDelayStudy requires the fuel and oxidizer mole fractions");
+        }
+        for (const auto& [name, moleFraction] : stream) {
+            if (std::find(species.begin(), species.end(), name) == species.end()) {
+                throw std::invalid_argument("The IgnitionDelayStudy species " + name + " is not in the eos");
+            }
+        }
+    }
+
+    constraints.Set(options);
+}
+
+std::vector<double> ablate::monitors::IgnitionDelayStudy::ComputeMassFractions(double equivalenceRatio) const {
+    // the oxygen required to burn a mole of each species to CO2 and H2O, negative for species that supply oxygen
+    auto elementalInformation = eos->GetSpeciesElementalInformation();
+    auto requiredOxygen = [&elementalInformation](const std::map<std::string, double>& stream) {
+        double oxygen = 0.0;
+        for (const auto& [name, moleFraction] : stream) {
+            for (const auto& [element, count] : elementalInformation[name]) {
+                std::string upperElement = element;
+                std::transform(upperElement.begin(), upperElement.end(), upperElement.begin(), ::toupper);
+                if (upperElement == "C") {
+                    oxygen += moleFraction * count;
+                } else if (upperElement == "H") {
+                    oxygen += moleFraction * count / 4.0;
+                } else if (upperElement == "O") {
+                    oxygen -= moleFraction * count / 2.0;
+                }
+            }
+        }
+        return oxygen;
+    };
+    const double fuelOxygen = requiredOxygen(fuel);
+    const double oxidizerOxygen = -requiredOxygen(oxidizer);
+    if (fuelOxygen <= 0.0 || oxidizerOxygen <= 0.0) {
+        throw std::invalid_argument("The IgnitionDelayStudy fuel must require oxygen and the oxidizer must supply it");
+    }
+
+    // moles of fuel per mole of oxidizer
+    const double fuelToOxidizer = equivalenceRatio * oxidizerOxygen / fuelOxygen;
+
+    const auto& species = eos->GetSpeciesVariables();
+    auto molecularMass = eos->GetSpeciesMolecularMass();
+    std::vector<double> massFractions(species.size(), 0.0);
+    double totalMass = 0.0;
+    for (std::size_t sp = 0; sp < species.size(); ++sp) {
+        double moles = 0.0;
+        if (auto fuelIt = fuel.find(species[sp]); fuelIt != fuel.end()) {
+            moles += fuelToOxidizer * fuelIt->second;
+        }
+        if (auto oxidizerIt = oxidizer.find(species[sp]); oxidizerIt != oxidizer.end()) {
+            moles += oxidizerIt->second;
+        }
+        massFractions[sp] = moles * molecularMass[species[sp]];
+        totalMass += massFractions[sp];
+    }
+    for (auto& massFraction : massFractions) {
+        massFraction /= totalMass;
+    }
+    return massFractions;
+}
+
+std::vector<double> ablate::monitors::IgnitionDelayStudy::Run(MPI_Comm comm) {
+    PetscMPIInt rank, size;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+    MPI_Comm_size(comm, &size) >> checkMpiError;
+
+    // the cases are ordered with the temperature changing fastest and assigned round-robin to each rank
+    const std::size_t numberCases = temperatures.size() * pressures.size() * equivalenceRatios.size();
+    std::vector<std::size_t> localCases;
+    for (std::size_t c = rank; c < numberCases; c += size) {
+        localCases.push_back(c);
+    }
+    const auto numberLocal = (ordinal_type)localCases.size();
+
+    std::vector<double> localDelay(numberCases, 0.0);
+    if (numberLocal > 0) {
+        auto kineticModelGasConstDataHost = tChemLib::createGasKineticModelConstData<typename Tines::UseThisDevice<host_exec_space>::type>(eos->GetKineticModelData());
+        const ordinal_type numberSpecies = kineticModelGasConstDataHost.nSpec;
+        const ordinal_type stateVecDim = tChemLib::Impl::getStateVectorSize(numberSpecies);
+
+        // fill the initial state of each reactor on the host, the density is recomputed by the integrator
+        real_type_2d_view stateDevice("ignitionDelayStudyState", numberLocal, stateVecDim);
+        auto stateHost = Kokkos::create_mirror_view(stateDevice);
+        auto molecularMass = eos->GetSpeciesMolecularMass();
+        const auto& species = eos->GetSpeciesVariables();
+        std::vector<double> initialTemperature(numberLocal);
+        for (ordinal_type i = 0; i < numberLocal; ++i) {
+            const auto c = localCases[i];
+            const double temperature = temperatures[c % temperatures.size()];
+            const double pressure = pressures[(c / temperatures.size()) % pressures.size()];
+            const auto massFractions = ComputeMassFractions(equivalenceRatios[c / (temperatures.size() * pressures.size())]);
+
+            double inverseMolecularMass = 0.0;
+            for (ordinal_type sp = 0; sp < numberSpecies; ++sp) {
+                inverseMolecularMass += massFractions[sp] / molecularMass[species[sp]];
+            }
+            auto stateAtI = Kokkos::subview(stateHost, i, Kokkos::ALL());
+            tChemLib::Impl::StateVector<real_type_1d_view_host> stateVector(numberSpecies, stateAtI);
+            stateVector.Density() = pressure / (universalGasConstant * temperature * inverseMolecularMass);
+            stateVector.Pressure() = pressure;
+            stateVector.Temperature() = temperature;
+            for (ordinal_type sp = 0; sp < numberSpecies; ++sp) {
+                stateVector.MassFractions()(sp) = massFractions[sp];
+            }
+            initialTemperature[i] = temperature;
+        }
+        Kokkos::deep_copy(stateDevice, stateHost);
+
+        // size up the integrator, each reactor is integrated by its own team
+        auto kineticModelDataClone = eos->GetKineticModelData().clone(numberLocal);
+        auto kineticModelGasConstDataDevices = tChemLib::createGasKineticModelConstData<typename Tines::UseThisDevice<exec_space>::type>(kineticModelDataClone);
+        auto kineticModelGasConstDataDevice = tChemLib::createGasKineticModelConstData<typename Tines::UseThisDevice<exec_space>::type>(eos->GetKineticModelData());
+        const auto numberOfEquations =
+            tChemLib::Impl::IgnitionZeroD_Problem<real_type, Tines::UseThisDevice<exec_space>::type>::getNumberOfTimeODEs(kineticModelGasConstDataDevice);
+
+        real_type_2d_view tolTimeDevice("tolTimeDevice", numberOfEquations, 2);
+        real_type_1d_view tolNewtonDevice("tolNewtonDevice", 2);
+        real_type_2d_view facDevice("facDevice", numberLocal, numberOfEquations);
+        {
+            auto tolTimeHost = Kokkos::create_mirror_view(tolTimeDevice);
+            auto tolNewtonHost = Kokkos::create_mirror_view(tolNewtonDevice);
+            for (ordinal_type i = 0, iend = tolTimeDevice.extent(0); i < iend; ++i) {
+                tolTimeHost(i, 0) = constraints.absToleranceTime;
+                tolTimeHost(i, 1) = constraints.relToleranceTime;
+            }
+            tolNewtonHost(0) = constraints.absToleranceNewton;
+            tolNewtonHost(1) = constraints.relToleranceNewton;
+            Kokkos::deep_copy(tolTimeDevice, tolTimeHost);
+            Kokkos::deep_copy(tolNewtonDevice, tolNewtonHost);
+        }
+
+        time_advance_type timeAdvanceDefault{};
+        timeAdvanceDefault._tbeg = 0.0;
+        timeAdvanceDefault._tend = 0.0;
+        timeAdvanceDefault._dt = constraints.dtDefault;
+        timeAdvanceDefault._dtmin = constraints.dtMin;
+        timeAdvanceDefault._dtmax = constraints.dtMax;
+        timeAdvanceDefault._max_num_newton_iterations = constraints.maxNumNewtonIterations;
+        timeAdvanceDefault._num_time_iterations_per_interval = constraints.numTimeIterationsPerInterval;
+        timeAdvanceDefault._num_outer_time_iterations_per_interval = 10;
+        timeAdvanceDefault._jacobian_interval = constraints.jacobianInterval;
+        time_advance_type_1d_view timeAdvanceDevice("timeAdvanceDevice", numberLocal);
+        Kokkos::deep_copy(timeAdvanceDevice, timeAdvanceDefault);
+
+        real_type_1d_view timeDevice("timeDevice", numberLocal);
+        real_type_1d_view dtDevice("dtDevice", numberLocal);
+        Kokkos::deep_copy(dtDevice, constraints.dtDefault);
+
+        auto policy = tChemLib::UseThisTeamPolicy<tChemLib::exec_space>::type(tChemLib::exec_space(), numberLocal, Kokkos::AUTO());
+        policy.set_scratch_size(1, Kokkos::PerTeam(tChemLib::Scratch<real_type_1d_view>::shmem_size(tChemLib::IgnitionZeroD::getWorkSpaceSize(kineticModelGasConstDataDevice))));
+
+        // march over each interval, the reactors that have ignited are integrated with the rest so the batch shape does not change
+        std::vector<double> delay(numberLocal, -1.0);
+        std::vector<double> previousTemperature = initialTemperature;
+        double previousTime = 0.0;
+        for (int interval = 1; interval <= numberIntervals && std::find(delay.begin(), delay.end(), -1.0) != delay.end(); ++interval) {
+            const double intervalEnd = endTime * interval / numberIntervals;
+            const double intervalEndTolerance = intervalEnd * (1.0 - 1.0E-10);
+            Kokkos::parallel_for(
+                "ignitionDelayStudyAdvance", Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberLocal), KOKKOS_LAMBDA(const auto i) {
+                    timeAdvanceDevice(i)._tbeg = timeDevice(i);
+                    timeAdvanceDevice(i)._tend = intervalEnd;
+                    timeAdvanceDevice(i)._dt = dtDevice(i);
+                });
+
+            // the integrator stops after numTimeIterationsPerInterval steps, so call it until every reactor has reached the end of the interval
+            double minimumTime = 0.0;
+            for (int attempt = 0; attempt < constraints.maxAttempts; ++attempt) {
+                tChemLib::IgnitionZeroD::runDeviceBatch(
+                    policy, tolNewtonDevice, tolTimeDevice, facDevice, timeAdvanceDevice, stateDevice, timeDevice, dtDevice, stateDevice, kineticModelGasConstDataDevices);
+                Kokkos::parallel_reduce(
+                    "ignitionDelayStudyTime",
+                    Kokkos::RangePolicy<typename tChemLib::exec_space>(0, numberLocal),
+                    KOKKOS_LAMBDA(const int& i, double& timeMin) {
+                        timeAdvanceDevice(i)._tbeg = timeDevice(i);
+                        timeAdvanceDevice(i)._dt = dtDevice(i);
+                        timeMin = timeDevice(i) < timeMin ? timeDevice(i) : timeMin;
+                    },
+                    Kokkos::Min<double>(minimumTime));
+                if (minimumTime >= intervalEndTolerance) {
+                    break;
+                }
+            }
+            if (minimumTime < intervalEndTolerance) {
+                throw std::runtime_error("The IgnitionDelayStudy was unable to integrate every reactor to " + std::to_string(intervalEnd));
+            }
+
+            // check each reactor for the temperature rise
+            Kokkos::deep_copy(stateHost, stateDevice);
+            for (ordinal_type i = 0; i < numberLocal; ++i) {
+                auto stateAtI = Kokkos::subview(stateHost, i, Kokkos::ALL());
+                tChemLib::Impl::StateVector<real_type_1d_view_host> stateVector(numberSpecies, stateAtI);
+                const double temperature = stateVector.Temperature();
+                const double ignitionTemperature = initialTemperature[i] + temperatureIncrease;
+                if (delay[i] < 0.0 && temperature >= ignitionTemperature) {
+                    const double fraction = (ignitionTemperature - previousTemperature[i]) / (temperature - previousTemperature[i]);
+                    delay[i] = previousTime + fraction * (intervalEnd - previousTime);
+                }
+                previousTemperature[i] = temperature;
+            }
+            previousTime = intervalEnd;
+        }
+
+        for (ordinal_type i = 0; i < numberLocal; ++i) {
+            localDelay[localCases[i]] = delay[i];
+        }
+    }
+
+    // each case is owned by a single rank so the table can be summed
+    std::vector<double> ignitionDelay(numberCases);
+    MPI_Allreduce(localDelay.data(), ignitionDelay.data(), (int)numberCases, MPI_DOUBLE, MPI_SUM, comm) >> checkMpiError;
+
+    if (!log->Initialized()) {
+        log->Initialize(comm);
+    }
+    log->Printf("temperature, pressure, equivalenceRatio, ignitionDelay\n");
+    for (std::size_t c = 0; c < numberCases; ++c) {
+        log->Printf("%g, %g, %g, %g\n",
+                    temperatures[c % temperatures.size()],
+                    pressures[(c / temperatures.size()) % pressures.size()],
+                    equivalenceRatios[c / (temperatures.size() * pressures.size())],
+                    ignitionDelay[c]);
+    }
+    return ignitionDelay;
+}
+
+#include "registrar.hpp"
+REGISTER_DEFAULT(ablate::monitors::IgnitionDelayStudy, ablate::monitors::IgnitionDelayStudy,
+                 "Computes an ignition delay table for every combination of temperature, pressure, and equivalence ratio using batched constant pressure 0-D TChem reactors distributed across "
+                 "the ranks",
+                 ARG(ablate::eos::TChem, "eos", "the TChem eos used for the kinetics"), ARG(std::vector<double>, "temperatures", "the initial temperatures (K)"),
+                 ARG(std::vector<double>, "pressures", "the initial pressures (Pa)"), ARG(std::vector<double>, "equivalenceRatios", "the equivalence ratios"),
+                 ARG(ablate::parameters::Parameters, "fuel", "the fuel mole fractions"), ARG(ablate::parameters::Parameters, "oxidizer", "the oxidizer mole fractions"),
+                 ARG(double, "endTime", "the maximum time integrated for each reactor"),
+                 OPT(int, "numberIntervals", "the number of intervals used to detect and interpolate the ignition time (default is 1000)"),
+                 OPT(double, "temperatureIncrease", "the temperature rise above the initial temperature that defines ignition (default is 400 K)"),
+                 OPT(ablate::parameters::Parameters, "options", "the chemistry integration options (dtMin, dtMax, dtDefault, tolerances, maxAttempts), see the TChem eos"),
+                 OPT(ablate::monitors::logs::Log, "log", "where to write the ignition delay table (default is stdout)"));
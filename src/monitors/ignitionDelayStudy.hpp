@@ -0,0 +1,78 @@
+#ifndef ABLATELIBRARY_IGNITIONDELAYSTUDY_HPP
+#define ABLATELIBRARY_IGNITIONDELAYSTUDY_HPP
+
+#include <memory>
+#include <vector>
+#include "eos/tChem.hpp"
+#include "monitors/logs/log.hpp"
+#include "parameters/parameters.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Computes an ignition delay table for every combination of the initial temperatures, pressures, and equivalence ratios without the TimeStepper/FV
+ * machinery used by the IgnitionDelayTemperature and IgnitionDelayPeakYi monitors.  Each case is a constant pressure 0-D TChem reactor, the cases are
+ * distributed round-robin across the ranks and every rank integrates its reactors as a single batch (one Kokkos team per reactor).  Ignition is defined as the
+ * time the temperature first rises temperatureIncrease above the initial temperature, linearly interpolated between the output intervals.
+ */
+class IgnitionDelayStudy {
+   private:
+    //! the eos used for the kinetics
+    const std::shared_ptr<eos::TChem> eos;
+
+    //! the initial conditions swept by the study
+    const std::vector<double> temperatures;
+    const std::vector<double> pressures;
+    const std::vector<double> equivalenceRatios;
+
+    //! the mole fractions of the fuel and oxidizer streams
+    const std::map<std::string, double> fuel;
+    const std::map<std::string, double> oxidizer;
+
+    //! the end time for every reactor and the number of intervals used to detect ignition
+    const double endTime;
+    const int numberIntervals;
+
+    //! the temperature rise used to define ignition
+    const double temperatureIncrease;
+
+    //! the integration tolerances and time step limits
+    eos::tChem::SourceCalculator::ChemistryConstraints constraints;
+
+    //! where to write the table
+    const std::shared_ptr<logs::Log> log;
+
+    /**
+     * Compute the species mass fractions for an equivalence ratio from the fuel and oxidizer mole fractions
+     * @param equivalenceRatio
+     * @return the mass fractions in the order of the eos species
+     */
+    [[nodiscard]] std::vector<double> ComputeMassFractions(double equivalenceRatio) const;
+
+   public:
+    /**
+     * @param eos the TChem eos used for the kinetics
+     * @param temperatures the initial temperatures (K)
+     * @param pressures the initial pressures (Pa)
+     * @param equivalenceRatios the equivalence ratios
+     * @param fuel the fuel mole fractions
+     * @param oxidizer the oxidizer mole fractions
+     * @param endTime the maximum time integrated for each reactor
+     * @param numberIntervals the number of intervals used to detect ignition (default is 1000)
+     * @param temperatureIncrease the temperature rise used to define ignition (default is 400 K)
+     * @param options the chemistry integration options, see the TChem eos
+     * @param log where to write the ignition delay table (default is stdout)
+     */
+    IgnitionDelayStudy(std::shared_ptr<eos::TChem> eos, std::vector<double> temperatures, std::vector<double> pressures, std::vector<double> equivalenceRatios,
+                       const std::shared_ptr<ablate::parameters::Parameters>& fuel, const std::shared_ptr<ablate::parameters::Parameters>& oxidizer, double endTime, int numberIntervals = 1000,
+                       double temperatureIncrease = 400.0, const std::shared_ptr<ablate::parameters::Parameters>& options = {}, std::shared_ptr<logs::Log> log = {});
+
+    /**
+     * Integrate every case and write the ignition delay table on the root rank.  Cases that do not ignite before the endTime are reported as -1.
+     * @param comm the comm to distribute the cases over, must be called by every rank in the comm
+     * @return the ignition delay of each case (temperature fastest, then pressure, then equivalence ratio) on every rank
+     */
+    std::vector<double> Run(MPI_Comm comm = PETSC_COMM_WORLD);
+};
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_IGNITIONDELAYSTUDY_HPP
@@ -0,0 +1,109 @@
+#include "loadBalanceMonitor.hpp"
+#include <algorithm>
+#include "io/interval/fixedInterval.hpp"
+#include "monitors/logs/stdOut.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::monitors::LoadBalanceMonitor::LoadBalanceMonitor(std::shared_ptr<logs::Log> logIn, std::shared_ptr<io::interval::Interval> interval, double threshold)
+    : log(logIn ? logIn : std::make_shared<logs::StdOut>()), interval(interval ? interval : std::make_shared<io::interval::FixedInterval>()), threshold(threshold > 1.0 ? threshold : 1.2) {}
+
+void ablate::monitors::LoadBalanceMonitor::Register(std::shared_ptr<solver::Solver> solverIn) {
+    Monitor::Register(solverIn);
+
+    // the event times are only recorded when petsc logging is active
+    PetscBool logActive;
+    PetscLogIsActive(&logActive) >> checkError;
+    if (!logActive) {
+        PetscLogDefaultBegin() >> checkError;
+    }
+}
+
+PetscLogDouble ablate::monitors::LoadBalanceMonitor::GetEventTime() {
+    // the events are registered by the TimeStepper after the monitors, so they are looked up on the first use
+    if (events.empty()) {
+        for (const auto& eventName : {"SolverComputeRHSFunction::PreRHSFunction::", "SolverComputeRHSFunction::ComputeRHSFunction::"}) {
+            PetscLogEvent event = -1;
+            PetscLogEventGetId((eventName + GetSolver()->GetSolverId()).c_str(), &event) >> checkError;
+            if (event >= 0) {
+                events.push_back(event);
+            }
+        }
+        if (events.empty()) {
+            throw std::invalid_argument("The LoadBalanceMonitor requires a solver that computes a rhs function");
+        }
+    }
+
+    PetscLogDouble time = 0.0;
+    for (const auto& event : events) {
+        PetscEventPerfInfo info;
+        PetscLogEventGetPerfInfo(PETSC_DETERMINE, event, &info) >> checkError;
+        time += info.time;
+    }
+    return time;
+}
+
+PetscErrorCode ablate::monitors::LoadBalanceMonitor::MonitorLoadBalance(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::LoadBalanceMonitor*)ctx;
+
+    if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
+        try {
+            auto comm = monitor->GetSolver()->GetSubDomain().GetComm();
+            PetscMPIInt rank, size;
+            PetscCallMPI(MPI_Comm_rank(comm, &rank));
+            PetscCallMPI(MPI_Comm_size(comm, &size));
+
+            // the cost on this rank since the last check and the number of cells
+            const auto eventTime = monitor->GetEventTime();
+            solver::Range cellRange;
+            monitor->GetSolver()->GetCellRange(cellRange);
+            PetscReal local[2] = {(PetscReal)(eventTime - monitor->lastTime), (PetscReal)(cellRange.end - cellRange.start)};
+            monitor->GetSolver()->RestoreRange(cellRange);
+            monitor->lastTime = eventTime;
+
+            // gather the cost and cells from every rank at once
+            std::vector<PetscReal> global(rank == 0 ? 2 * size : 0);
+            PetscCallMPI(MPI_Gather(local, 2, MPIU_REAL, global.data(), 2, MPIU_REAL, 0, comm));
+
+            // if this is the first time step init the log
+            if (!monitor->log->Initialized()) {
+                monitor->log->Initialize(comm);
+            }
+
+            if (rank == 0) {
+                PetscReal maxCost = 0.0, sumCost = 0.0, maxCells = 0.0, sumCells = 0.0;
+                PetscReal minCellCost = PETSC_MAX_REAL, maxCellCost = 0.0;
+                for (PetscMPIInt r = 0; r < size; ++r) {
+                    maxCost = PetscMax(maxCost, global[2 * r]);
+                    sumCost += global[2 * r];
+                    maxCells = PetscMax(maxCells, global[2 * r + 1]);
+                    sumCells += global[2 * r + 1];
+                    if (global[2 * r + 1] > 0) {
+                        minCellCost = PetscMin(minCellCost, global[2 * r] / global[2 * r + 1]);
+                        maxCellCost = PetscMax(maxCellCost, global[2 * r] / global[2 * r + 1]);
+                    }
+                }
+                const PetscReal averageCost = sumCost / size;
+                const PetscReal imbalance = averageCost > 0.0 ? maxCost / averageCost : 1.0;
+
+                monitor->log->Printf("LoadBalance %s for timestep %04d:\n", monitor->GetSolver()->GetSolverId().c_str(), (int)step);
+                monitor->log->Printf("\timbalance: %2.3g (max %2.3g s, avg %2.3g s)\n", imbalance, maxCost, averageCost);
+                monitor->log->Printf("\tcells per rank: max %d, avg %2.3g\n", (int)maxCells, sumCells / size);
+                if (maxCellCost > 0.0) {
+                    monitor->log->Printf("\tcost per cell: min %2.3g s, max %2.3g s\n", minCellCost, maxCellCost);
+                }
+                if (imbalance > monitor->threshold) {
+                    monitor->log->Printf("\timbalance is above %2.3g, consider restarting with a cost weighted partition\n", monitor->threshold);
+                }
+            }
+        } catch (std::exception& exp) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exp.what());
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::LoadBalanceMonitor, "Reports the load imbalance of the solver rhs cost across ranks",
+         OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"), OPT(ablate::io::interval::Interval, "interval", "report interval object, defaults to every"),
+         OPT(double, "threshold", "the imbalance (max/average cost) above which a repartition is recommended (default is 1.2)"));
@@ -0,0 +1,50 @@
+#ifndef ABLATELIBRARY_LOADBALANCEMONITOR_HPP
+#define ABLATELIBRARY_LOADBALANCEMONITOR_HPP
+
+#include <memory>
+#include <vector>
+#include "io/interval/interval.hpp"
+#include "monitor.hpp"
+#include "monitors/logs/log.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Reports the load imbalance of a solver across ranks.  The cost on each rank is the time spent in the per solver rhs log events recorded by the TimeStepper,
+ * so the chemistry, particle and boundary work of the solver are included without any wait time from the ghost exchange.  The imbalance (max/average cost)
+ * and the cost per cell on each rank can be used to weight the partition (DistributeWithGhostCells) when restarting from a naturally ordered checkpoint.
+ */
+class LoadBalanceMonitor : public Monitor {
+   private:
+    static PetscErrorCode MonitorLoadBalance(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
+    const std::shared_ptr<logs::Log> log;
+    const std::shared_ptr<io::interval::Interval> interval;
+
+    //! the imbalance (max/average cost) above which a repartition is recommended
+    const double threshold;
+
+    //! the per solver rhs log events, found on the first check after the TimeStepper registers them
+    std::vector<PetscLogEvent> events;
+
+    //! the event time on this rank at the last check
+    PetscLogDouble lastTime = 0.0;
+
+    /**
+     * The total time this rank has spent in the solver events
+     */
+    PetscLogDouble GetEventTime();
+
+   public:
+    /**
+     * @param log where to record the log (default is stdout)
+     * @param interval the report interval (default is every)
+     * @param threshold the imbalance above which a repartition is recommended (default is 1.2)
+     */
+    explicit LoadBalanceMonitor(std::shared_ptr<logs::Log> log = {}, std::shared_ptr<io::interval::Interval> interval = {}, double threshold = 1.2);
+
+    void Register(std::shared_ptr<solver::Solver> solverIn) override;
+
+    PetscMonitorFunction GetPetscFunction() override { return MonitorLoadBalance; }
+};
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_LOADBALANCEMONITOR_HPP
@@ -0,0 +1,84 @@
+#include "aggregatedLog.hpp"
+#include <cstdarg>
+#include <utilities/mpiError.hpp>
+#include <utilities/petscError.hpp>
+#include "environment/runEnvironment.hpp"
+
+ablate::monitors::logs::AggregatedLog::AggregatedLog(std::string fileName, int bufferSize, double flushInterval)
+    : outputPath(std::filesystem::path(fileName).is_absolute() ? std::filesystem::path(fileName) : ablate::environment::RunEnvironment::Get().GetOutputDirectory() / fileName),
+      bufferSize(bufferSize > 0 ? (std::size_t)bufferSize : 1048576),
+      flushInterval(flushInterval > 0.0 ? flushInterval : 0.0) {}
+
+ablate::monitors::logs::AggregatedLog::~AggregatedLog() {
+    if (file != MPI_FILE_NULL) {
+        // the remaining records are written together in rank order
+        std::string block = buffer.empty() ? std::string() : blockHeader + buffer;
+        MPI_File_write_ordered(file, block.data(), (int)block.size(), MPI_CHAR, MPI_STATUS_IGNORE) >> checkMpiError;
+        MPI_File_close(&file) >> checkMpiError;
+    }
+}
+
+void ablate::monitors::logs::AggregatedLog::Initialize(MPI_Comm comm) {
+    Log::Initialize(comm);
+
+    int rank, size;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+    MPI_Comm_size(comm, &size) >> checkMpiError;
+    if (size > 1) {
+        blockHeader = "[" + std::to_string(rank) + "]\n";
+    }
+
+    MPI_File_open(comm, outputPath.c_str(), MPI_MODE_WRONLY | MPI_MODE_CREATE | MPI_MODE_APPEND, MPI_INFO_NULL, &file) >> checkMpiError;
+    buffer.reserve(bufferSize);
+    PetscTime(&lastFlushTime) >> checkError;
+    telemetry = std::make_unique<io::IoTelemetry>("AggregatedLog", comm);
+}
+
+void ablate::monitors::logs::AggregatedLog::Printf(const char* format, ...) {
+    if (file == MPI_FILE_NULL) {
+        return;
+    }
+
+    // format directly into the end of the buffer
+    va_list args, argsCopy;
+    va_start(args, format);
+    va_copy(argsCopy, args);
+    const int length = vsnprintf(nullptr, 0, format, argsCopy);
+    va_end(argsCopy);
+    if (length > 0) {
+        const auto offset = buffer.size();
+        buffer.resize(offset + length + 1);
+        vsnprintf(buffer.data() + offset, length + 1, format, args);
+        buffer.resize(offset + length);
+    }
+    va_end(args);
+
+    // write once the buffer is full or the interval has passed
+    bool flush = buffer.size() >= bufferSize;
+    if (!flush && flushInterval > 0.0) {
+        PetscLogDouble now;
+        PetscTime(&now) >> checkError;
+        flush = now - lastFlushTime >= flushInterval;
+    }
+    if (flush) {
+        Flush();
+    }
+}
+
+void ablate::monitors::logs::AggregatedLog::Flush() {
+    if (!buffer.empty()) {
+        // each rank writes independently so a full buffer does not wait on the other ranks
+        std::string block = blockHeader + buffer;
+        telemetry->Start();
+        MPI_File_write_shared(file, block.data(), (int)block.size(), MPI_CHAR, MPI_STATUS_IGNORE) >> checkMpiError;
+        telemetry->Stop((double)block.size());
+        buffer.clear();
+    }
+    PetscTime(&lastFlushTime) >> checkError;
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::logs::Log, ablate::monitors::logs::AggregatedLog,
+         "Buffers the log of every rank in memory and writes it in large blocks to a single shared file with MPI-IO. Each block is prefixed with the rank when run in parallel.",
+         ARG(std::string, "name", "the name of the shared log file"), OPT(int, "bufferSize", "the number of bytes to buffer on each rank before writing (default is 1 MB)"),
+         OPT(double, "flushInterval", "the wall time in seconds between writes (default is 0, only write when the buffer is full)"));
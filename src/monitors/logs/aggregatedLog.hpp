@@ -0,0 +1,62 @@
+#ifndef ABLATELIBRARY_AGGREGATEDLOG_HPP
+#define ABLATELIBRARY_AGGREGATEDLOG_HPP
+
+#include <petsc.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include "io/ioTelemetry.hpp"
+#include "log.hpp"
+
+namespace ablate::monitors::logs {
+
+/**
+ * Buffers the log of every rank in memory and writes it to a single shared file with MPI-IO.  Each rank writes its buffer as one block (prefixed by the rank)
+ * when it fills or the flush interval has passed, so small records do not each touch the file system or pass through the root.  The remaining buffers are
+ * written collectively in rank order when the log is destroyed.
+ */
+class AggregatedLog : public Log {
+   private:
+    std::filesystem::path outputPath;
+
+    //! the number of bytes to buffer before writing
+    const std::size_t bufferSize;
+
+    //! the wall time in seconds between writes, zero to only write when the buffer is full
+    const PetscLogDouble flushInterval;
+
+    //! the shared file, opened in Initialize
+    MPI_File file = MPI_FILE_NULL;
+
+    //! the rank header written before each block when there is more than one rank
+    std::string blockHeader;
+
+    //! the records not yet written
+    std::string buffer;
+
+    //! the wall time of the last write
+    PetscLogDouble lastFlushTime = 0.0;
+
+    //! record the time and bytes of each block written
+    std::unique_ptr<io::IoTelemetry> telemetry;
+
+    /**
+     * Write the buffer as a single block with the shared file pointer
+     */
+    void Flush();
+
+   public:
+    /**
+     * @param fileName the name of the shared log file
+     * @param bufferSize the number of bytes to buffer on each rank before writing (default is 1 MB)
+     * @param flushInterval the wall time in seconds between writes (default is 0, only write when the buffer is full)
+     */
+    explicit AggregatedLog(std::string fileName, int bufferSize = {}, double flushInterval = {});
+    ~AggregatedLog() override;
+
+    void Printf(const char *, ...) final;
+    void Initialize(MPI_Comm comm) final;
+};
+}  // namespace ablate::monitors::logs
+
+#endif  // ABLATELIBRARY_AGGREGATEDLOG_HPP
@@ -17,6 +17,7 @@ void ablate::monitors::logs::CsvLog::Initialize(MPI_Comm commIn) {
     Log::Initialize(commIn);
     comm = commIn;
     PetscFOpen(comm, outputPath.c_str(), "a", &file) >> checkError;
+    telemetry = std::make_unique<io::IoTelemetry>("CsvLog", comm);
 }
 void ablate::monitors::logs::CsvLog::Printf(const char *format, ...) {
     if (file) {
@@ -33,7 +34,10 @@ void ablate::monitors::logs::CsvLog::Printf(const char *format, ...) {
 
         va_list args;
         va_start(args, format);
+        telemetry->Start();
+        const auto startPosition = ftell(file);
         PetscVFPrintf(file, formatString.c_str(), args) >> checkError;
+        telemetry->Stop((double)(ftell(file) - startPosition));
         va_end(args);
     }
 }
@@ -3,6 +3,8 @@
 
 #include <petsc.h>
 #include <filesystem>
+#include <memory>
+#include "io/ioTelemetry.hpp"
 #include "log.hpp"
 
 namespace ablate::monitors::logs {
@@ -14,6 +16,9 @@ class CsvLog : public Log {
     MPI_Comm comm = MPI_COMM_SELF;
     const char* separator = ",";
 
+    //! record the time and bytes of each line written
+    std::unique_ptr<io::IoTelemetry> telemetry;
+
    public:
     explicit CsvLog(std::string fileName);
     ~CsvLog() override;
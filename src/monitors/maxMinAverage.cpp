@@ -5,6 +5,11 @@
 ablate::monitors::MaxMinAverage::MaxMinAverage(const std::string& fieldName, std::shared_ptr<logs::Log> logIn, std::shared_ptr<io::interval::Interval> interval)
     : fieldName(fieldName), log(logIn ? logIn : std::make_shared<logs::StdOut>()), interval(interval ? interval : std::make_shared<io::interval::FixedInterval>()) {}
 
+void ablate::monitors::MaxMinAverage::Register(std::shared_ptr<solver::Solver> solverIn) {
+    Monitor::Register(solverIn);
+    fieldHandle = GetSolver()->GetSubDomain().GetFieldHandle(fieldName);
+}
+
 PetscErrorCode ablate::monitors::MaxMinAverage::MonitorMaxMinAverage(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
     PetscFunctionBeginUser;
     PetscErrorCode ierr;
@@ -12,7 +17,7 @@ PetscErrorCode ablate::monitors::MaxMinAverage::MonitorMaxMinAverage(TS ts, Pets
 
     if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
         // Get a subvector with only this field
-        const auto& field = monitor->GetSolver()->GetSubDomain().GetField(monitor->fieldName);
+        const auto& field = monitor->GetSolver()->GetSubDomain().GetField(monitor->fieldHandle);
         IS vecIs;
         Vec vec;
         DM subDm;
@@ -15,9 +15,18 @@ class MaxMinAverage : public Monitor {
     const std::shared_ptr<logs::Log> log;
     const std::shared_ptr<io::interval::Interval> interval;
 
+    //! the handle to the field, resolved when the monitor is registered
+    domain::FieldHandle fieldHandle;
+
    public:
     explicit MaxMinAverage(const std::string& fieldName, std::shared_ptr<logs::Log> log = {}, std::shared_ptr<io::interval::Interval> interval = {});
 
+    /**
+     * Resolve the field handle with the solver
+     * @param solverIn
+     */
+    void Register(std::shared_ptr<solver::Solver> solverIn) override;
+
     PetscMonitorFunction GetPetscFunction() override { return MonitorMaxMinAverage; }
 };
 }  // namespace ablate::monitors
@@ -0,0 +1,89 @@
+#include "memoryMonitor.hpp"
+#include "io/interval/fixedInterval.hpp"
+#include "monitors/logs/stdOut.hpp"
+#include "utilities/memoryUsage.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::monitors::MemoryMonitor::MemoryMonitor(std::shared_ptr<logs::Log> logIn, std::shared_ptr<io::interval::Interval> interval)
+    : log(logIn ? logIn : std::make_shared<logs::StdOut>()), interval(interval ? interval : std::make_shared<io::interval::FixedInterval>()) {}
+
+void ablate::monitors::MemoryMonitor::Register(std::shared_ptr<solver::Solver> solverIn) {
+    Monitor::Register(solverIn);
+
+    // the monitors are registered after the solver setup and initialization so the caches are already sized
+    Report("after setup");
+}
+
+void ablate::monitors::MemoryMonitor::Report(const std::string& label) {
+    auto comm = GetSolver()->GetSubDomain().GetComm();
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    utilities::MemoryUsage memoryUsage;
+    GetSolver()->AccumulateMemoryUsage(memoryUsage);
+    const auto& entries = memoryUsage.GetEntries();
+
+    // every rank adds the same entries in the same order so they can be reduced directly
+    int numberEntries[2] = {(int)entries.size(), -(int)entries.size()};
+    MPI_Allreduce(MPI_IN_PLACE, numberEntries, 2, MPI_INT, MPI_MAX, comm) >> checkMpiError;
+    if (numberEntries[0] != -numberEntries[1]) {
+        throw std::runtime_error("The MemoryMonitor requires the same memory entries on every rank for " + GetSolver()->GetSolverId());
+    }
+
+    // the accounted total, the petsc malloc usage, and the resident memory are appended to the entries
+    PetscLogDouble mallocUsage, residentUsage;
+    PetscMallocGetCurrentUsage(&mallocUsage) >> checkError;
+    PetscMemoryGetCurrentUsage(&residentUsage) >> checkError;
+    std::vector<PetscLogDouble> local;
+    local.reserve(entries.size() + 3);
+    for (const auto& entry : entries) {
+        local.push_back(entry.second);
+    }
+    local.push_back(memoryUsage.GetTotal());
+    local.push_back(mallocUsage);
+    local.push_back(residentUsage);
+
+    std::vector<PetscLogDouble> sum(local.size()), max(local.size()), min(local.size());
+    MPI_Reduce(local.data(), sum.data(), (int)local.size(), MPIU_PETSCLOGDOUBLE, MPI_SUM, 0, comm) >> checkMpiError;
+    MPI_Reduce(local.data(), max.data(), (int)local.size(), MPIU_PETSCLOGDOUBLE, MPI_MAX, 0, comm) >> checkMpiError;
+    MPI_Reduce(local.data(), min.data(), (int)local.size(), MPIU_PETSCLOGDOUBLE, MPI_MIN, 0, comm) >> checkMpiError;
+
+    if (!log->Initialized()) {
+        log->Initialize(comm);
+    }
+
+    if (rank == 0) {
+        constexpr PetscLogDouble megabyte = 1024.0 * 1024.0;
+        auto printEntry = [&](const std::string& name, std::size_t i) {
+            log->Printf("\t%s: %.3f MB (min %.3f MB, max %.3f MB per rank)\n", name.c_str(), sum[i] / megabyte, min[i] / megabyte, max[i] / megabyte);
+        };
+
+        log->Printf("Memory %s %s:\n", GetSolver()->GetSolverId().c_str(), label.c_str());
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            printEntry(entries[i].first, i);
+        }
+        printEntry("accounted", entries.size());
+        printEntry("petsc malloc", entries.size() + 1);
+        printEntry("resident", entries.size() + 2);
+    }
+}
+
+PetscErrorCode ablate::monitors::MemoryMonitor::MonitorMemory(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::MemoryMonitor*)ctx;
+
+    if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
+        try {
+            monitor->Report("for timestep " + std::to_string(step));
+        } catch (std::exception& exp) {
+            SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exp.what());
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::MemoryMonitor,
+         "Reports the memory owned by each field, cache, and subsystem of the solver after setup and at the requested interval, summed and bounded across ranks",
+         OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"), OPT(ablate::io::interval::Interval, "interval", "report interval object, defaults to every"));
@@ -0,0 +1,40 @@
+#ifndef ABLATELIBRARY_MEMORYMONITOR_HPP
+#define ABLATELIBRARY_MEMORYMONITOR_HPP
+
+#include <memory>
+#include "io/interval/interval.hpp"
+#include "monitor.hpp"
+#include "monitors/logs/log.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Reports the bytes owned by each subsystem of a solver (the dm and sections, each solution and aux field, the gradient dms and stencils of the interpolants,
+ * boundary stencils, chemistry views, radiation rays, and particle fields) along with the resident memory of the process.  The report is written once when
+ * the monitor is registered after the solver setup and then at the requested interval.
+ */
+class MemoryMonitor : public Monitor {
+   private:
+    static PetscErrorCode MonitorMemory(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
+    const std::shared_ptr<logs::Log> log;
+    const std::shared_ptr<io::interval::Interval> interval;
+
+    /**
+     * Reduce the memory usage of the solver across ranks and write it to the log
+     * @param label describes when the report was taken
+     */
+    void Report(const std::string& label);
+
+   public:
+    /**
+     * @param log where to record the log (default is stdout)
+     * @param interval the report interval (default is every)
+     */
+    explicit MemoryMonitor(std::shared_ptr<logs::Log> log = {}, std::shared_ptr<io::interval::Interval> interval = {});
+
+    void Register(std::shared_ptr<solver::Solver> solverIn) override;
+
+    PetscMonitorFunction GetPetscFunction() override { return MonitorMemory; }
+};
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_MEMORYMONITOR_HPP
@@ -1,4 +1,5 @@
 #include "mixtureFractionCalculator.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
 #include "utilities/mathUtilities.hpp"
 
 ablate::monitors::MixtureFractionCalculator::MixtureFractionCalculator(const std::shared_ptr<ablate::eos::EOS>& eosIn, std::map<std::string, double> massFractionsFuel,
@@ -68,6 +69,13 @@ ablate::monitors::MixtureFractionCalculator::MixtureFractionCalculator(const std
         zMixFuel += zMixCoefficients[s] * massFractionsFuel[species[s]];
         zMixOxidizer += zMixCoefficients[s] * massFractionsOxidizer[species[s]];
     }
+
+    // fold the fuel/oxidizer normalization into the coefficients
+    zMixWeights.resize(species.size());
+    for (std::size_t s = 0; s < species.size(); s++) {
+        zMixWeights[s] = zMixCoefficients[s] / (zMixFuel - zMixOxidizer);
+    }
+    zMixOffset = -zMixOxidizer / (zMixFuel - zMixOxidizer);
 }
 
 ablate::monitors::MixtureFractionCalculator::MixtureFractionCalculator(const std::shared_ptr<ablate::eos::EOS>& eos, const std::shared_ptr<ablate::mathFunctions::FieldFunction>& massFractionsFuel,
@@ -95,6 +103,14 @@ std::map<std::string, double> ablate::monitors::MixtureFractionCalculator::ToMas
     return yiMap;
 }
 
+PetscErrorCode ablate::monitors::MixtureFractionCalculator::UpdateAuxMixtureFractionField(PetscReal, PetscInt, const PetscFVCellGeom*, const PetscInt uOff[], const PetscScalar* conservedValues,
+                                                                                          const PetscInt aOff[], PetscScalar* auxField, void* ctx) {
+    PetscFunctionBeginUser;
+    auto calculator = (MixtureFractionCalculator*)ctx;
+    auxField[aOff[0]] = calculator->CalculateFromDensityYi(conservedValues + uOff[1], conservedValues[uOff[0] + ablate::finiteVolume::CompressibleFlowFields::RHO]);
+    PetscFunctionReturn(0);
+}
+
 #include "registrar.hpp"
 REGISTER_DEFAULT(ablate::monitors::MixtureFractionCalculator, ablate::monitors::MixtureFractionCalculator,
                  "Calculate mixture fraction given a list of species using elemental species based on Bilger's (1980) definition of mixture fraction",
@@ -29,6 +29,10 @@ class MixtureFractionCalculator {
     //! the mixture fraction coefficients for each of the species in the equation of state
     std::vector<double> zMixCoefficients;
 
+    //! the coefficients normalized by (zMixFuel - zMixOxidizer) so zMix = zMixOffset + sum(zMixWeights*yi) is a single pass over yi
+    std::vector<double> zMixWeights;
+    double zMixOffset;
+
     /**
      * static function to help convert from FieldFunction to map
      * @param eos
@@ -65,14 +69,36 @@ class MixtureFractionCalculator {
      * @return
      */
     template <class T>
-    inline T Calculate(T* yi) const {
+    inline T Calculate(const T* yi) const {
         double zMix = 0.;
-        for (std::size_t s = 0; s < zMixCoefficients.size(); s++) {
-            zMix += zMixCoefficients[s] * yi[s];
+        for (std::size_t s = 0; s < zMixWeights.size(); s++) {
+            zMix += zMixWeights[s] * yi[s];
         }
-        return (zMix - zMixOxidizer) / (zMixFuel - zMixOxidizer);
+        return zMixOffset + zMix;
     }
 
+    /**
+     * Computes the mixture fraction directly from the conserved densityYi without first computing yi
+     * @tparam T
+     * @param densityYi.  The densityYi's are assumed to be of length/order of the species in the eos
+     * @param density
+     * @return
+     */
+    template <class T>
+    inline T CalculateFromDensityYi(const T* densityYi, T density) const {
+        double zMix = 0.;
+        for (std::size_t s = 0; s < zMixWeights.size(); s++) {
+            zMix += zMixWeights[s] * densityYi[s];
+        }
+        return zMixOffset + zMix / density;
+    }
+
+    /**
+     * Aux field update function that computes zMix from the euler and densityYi fields, the context is the MixtureFractionCalculator
+     */
+    static PetscErrorCode UpdateAuxMixtureFractionField(PetscReal time, PetscInt dim, const PetscFVCellGeom* cellGeom, const PetscInt uOff[], const PetscScalar* conservedValues,
+                                                        const PetscInt aOff[], PetscScalar* auxField, void* ctx);
+
     /**
      * Return accesses the base eos
      * @return
@@ -3,8 +3,8 @@
 #include <utility>
 #include "finiteVolume/compressibleFlowFields.hpp"
 
-ablate::monitors::MixtureFractionMonitor::MixtureFractionMonitor(std::shared_ptr<MixtureFractionCalculator> mixtureFractionCalculator)
-    : mixtureFractionCalculator(std::move(std::move(mixtureFractionCalculator))) {}
+ablate::monitors::MixtureFractionMonitor::MixtureFractionMonitor(std::shared_ptr<MixtureFractionCalculator> mixtureFractionCalculator, bool cacheInAuxField)
+    : mixtureFractionCalculator(std::move(std::move(mixtureFractionCalculator))), cacheInAuxField(cacheInAuxField) {}
 
 void ablate::monitors::MixtureFractionMonitor::Register(std::shared_ptr<solver::Solver> solverIn) {
     // Name this monitor
@@ -21,9 +21,6 @@ void ablate::monitors::MixtureFractionMonitor::Register(std::shared_ptr<solver::
         std::make_shared<domain::FieldDescription>("densityEnergySource", "energySource", domain::FieldDescription::ONECOMPONENT, domain::FieldLocation::SOL, domain::FieldType::FVM),
         std::make_shared<domain::FieldDescription>("densityYiSource", "densityYiSource", mixtureFractionCalculator->GetEos()->GetSpecies(), domain::FieldLocation::SOL, domain::FieldType::FVM)};
 
-    // get the required function to compute density
-    densityFunction = mixtureFractionCalculator->GetEos()->GetThermodynamicFunction(eos::ThermodynamicProperty::Density, solverIn->GetSubDomain().GetFields());
-
     // this probe will only work with fV flow with a single mpi rank for now.  It should be replaced with DMInterpolationEvaluate
     auto finiteVolumeSolver = std::dynamic_pointer_cast<ablate::finiteVolume::FiniteVolumeSolver>(solverIn);
     if (!finiteVolumeSolver) {
@@ -32,16 +29,27 @@ void ablate::monitors::MixtureFractionMonitor::Register(std::shared_ptr<solver::
     // get a reference to the tchem reactions instance in the solver
     chemistry = finiteVolumeSolver->FindProcess<ablate::finiteVolume::processes::Chemistry>();
 
+    // compute zMix with the other aux fields, the first update happens at the start of the next step
+    if (cacheInAuxField) {
+        if (!solverIn->GetSubDomain().ContainsField("zMix") || solverIn->GetSubDomain().GetField("zMix").location != domain::FieldLocation::AUX) {
+            throw std::invalid_argument("The MixtureFractionMonitor cacheInAuxField option requires a zMix aux field in " + solverIn->GetSolverId());
+        }
+        finiteVolumeSolver->RegisterAuxFieldUpdate(MixtureFractionCalculator::UpdateAuxMixtureFractionField,
+                                                   mixtureFractionCalculator.get(),
+                                                   std::vector<std::string>{"zMix"},
+                                                   {ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD, ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD});
+    }
+
     // call the base function to create the domain
     FieldMonitor::Register(monitorName, solverIn, fields);
 }
 void ablate::monitors::MixtureFractionMonitor::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
     PetscFunctionBeginUser;
     // get the required fields from the fieldDm and main dm
-    const auto& zMixMonitorField = monitorSubDomain->GetField("zMix");
-    const auto& yiMonitorField = monitorSubDomain->GetField(ablate::finiteVolume::CompressibleFlowFields::YI_FIELD);
-    const auto& energySourceField = monitorSubDomain->GetField("densityEnergySource");
-    const auto& densityYiSourceField = monitorSubDomain->GetField("densityYiSource");
+    const auto& zMixMonitorField = GetMonitorSubDomain()->GetField("zMix");
+    const auto& yiMonitorField = GetMonitorSubDomain()->GetField(ablate::finiteVolume::CompressibleFlowFields::YI_FIELD);
+    const auto& energySourceField = GetMonitorSubDomain()->GetField("densityEnergySource");
+    const auto& densityYiSourceField = GetMonitorSubDomain()->GetField("densityYiSource");
     const auto& eulerField = GetSolver()->GetSubDomain().GetField(ablate::finiteVolume::CompressibleFlowFields::EULER_FIELD);
     const auto& densityYiField = GetSolver()->GetSubDomain().GetField(ablate::finiteVolume::CompressibleFlowFields::DENSITY_YI_FIELD);
 
@@ -58,7 +66,15 @@ void ablate::monitors::MixtureFractionMonitor::Save(PetscViewer viewer, PetscInt
     const PetscScalar* solutionFieldArray;
     PetscScalar* monitorFieldArray;
     VecGetArrayRead(GetSolver()->GetSubDomain().GetSolutionVector(), &solutionFieldArray) >> checkError;
-    VecGetArray(monitorSubDomain->GetSolutionVector(), &monitorFieldArray) >> checkError;
+    VecGetArray(GetMonitorSubDomain()->GetSolutionVector(), &monitorFieldArray) >> checkError;
+
+    // the cached zMix is read from the local aux vector
+    const PetscScalar* auxArray = nullptr;
+    const domain::Field* zMixAuxField = nullptr;
+    if (cacheInAuxField) {
+        zMixAuxField = &GetSolver()->GetSubDomain().GetField("zMix");
+        VecGetArrayRead(GetSolver()->GetSubDomain().GetAuxVector(), &auxArray) >> checkError;
+    }
 
     // check for the tmpLocalFArray
     const PetscScalar* sourceTermArray = nullptr;
@@ -68,23 +84,20 @@ void ablate::monitors::MixtureFractionMonitor::Save(PetscViewer viewer, PetscInt
 
     // March over each cell in the monitorDm
     PetscInt cStart, cEnd;
-    DMPlexGetHeightStratum(monitorSubDomain->GetDM(), 0, &cStart, &cEnd) >> checkError;
+    DMPlexGetHeightStratum(GetMonitorSubDomain()->GetDM(), 0, &cStart, &cEnd) >> checkError;
 
     // Get the cells we need to march over
     DMLabel solutionToMonitor;
-    DMPlexGetSubpointMap(monitorSubDomain->GetDM(), &solutionToMonitor) >> checkError;
+    DMPlexGetSubpointMap(GetMonitorSubDomain()->GetDM(), &solutionToMonitor) >> checkError;
 
     const PetscInt* monitorToSolution = nullptr;
     IS monitorToSolutionIs = nullptr;
     // if this is a submap, get the monitor to solution
     if (solutionToMonitor) {
-        DMPlexGetSubpointIS(monitorSubDomain->GetDM(), &monitorToSolutionIs) >> checkError;
+        DMPlexGetSubpointIS(GetMonitorSubDomain()->GetDM(), &monitorToSolutionIs) >> checkError;
         ISGetIndices(monitorToSolutionIs, &monitorToSolution) >> checkError;
     }
 
-    // save time to get densityFunctionContext
-    const auto densityFunctionContext = densityFunction.context.get();
-
     for (PetscInt monitorPt = cStart; monitorPt < cEnd; ++monitorPt) {
         PetscInt solutionPt = monitorToSolution ? monitorToSolution[monitorPt] : monitorPt;
 
@@ -92,7 +105,7 @@ void ablate::monitors::MixtureFractionMonitor::Save(PetscViewer viewer, PetscInt
         const PetscScalar* solutionField = nullptr;
         DMPlexPointGlobalRead(GetSolver()->GetSubDomain().GetDM(), solutionPt, solutionFieldArray, &solutionField) >> checkError;
         PetscScalar* monitorField = nullptr;
-        DMPlexPointGlobalRead(monitorSubDomain->GetDM(), monitorPt, monitorFieldArray, &monitorField) >> checkError;
+        DMPlexPointGlobalRead(GetMonitorSubDomain()->GetDM(), monitorPt, monitorFieldArray, &monitorField) >> checkError;
 
         const PetscScalar* sourceTermField = nullptr;
         if (sourceTermArray) {
@@ -100,17 +113,22 @@ void ablate::monitors::MixtureFractionMonitor::Save(PetscViewer viewer, PetscInt
         }
         // Do not bother in ghost cells
         if (solutionField && monitorField) {
-            // compute the density from the solutionPt
-            PetscReal density;
-            densityFunction.function(solutionField, &density, densityFunctionContext) >> checkError;
+            // the density is part of the conserved state so no eos call is needed
+            const PetscReal density = solutionField[eulerField.offset + ablate::finiteVolume::CompressibleFlowFields::RHO];
 
             // Copy over and compute yi
             for (PetscInt sp = 0; sp < yiMonitorField.numberComponents; sp++) {
                 monitorField[yiMonitorField.offset + sp] = solutionField[densityYiField.offset + sp] / density;
             }
 
-            // Compute mixture fraction
-            monitorField[zMixMonitorField.offset] = mixtureFractionCalculator->Calculate(monitorField + yiMonitorField.offset);
+            // Compute mixture fraction or copy it from the aux field
+            if (auxArray) {
+                const PetscScalar* auxField = nullptr;
+                DMPlexPointLocalFieldRead(GetSolver()->GetSubDomain().GetAuxDM(), solutionPt, zMixAuxField->id, auxArray, &auxField) >> checkError;
+                monitorField[zMixMonitorField.offset] = auxField[0];
+            } else {
+                monitorField[zMixMonitorField.offset] = mixtureFractionCalculator->CalculateFromDensityYi(solutionField + densityYiField.offset, density);
+            }
 
             if (sourceTermField) {
                 monitorField[energySourceField.offset] = sourceTermField[eulerField.offset + ablate::finiteVolume::CompressibleFlowFields::RHOE];
@@ -124,11 +142,14 @@ void ablate::monitors::MixtureFractionMonitor::Save(PetscViewer viewer, PetscInt
         VecRestoreArrayRead(sourceTermVec, &sourceTermArray) >> checkError;
         DMRestoreLocalVector(GetSolver()->GetSubDomain().GetDM(), &sourceTermVec) >> checkError;
     }
+    if (auxArray) {
+        VecRestoreArrayRead(GetSolver()->GetSubDomain().GetAuxVector(), &auxArray) >> checkError;
+    }
     if (monitorToSolutionIs) {
         ISRestoreIndices(monitorToSolutionIs, &monitorToSolution) >> checkError;
     }
     VecRestoreArrayRead(GetSolver()->GetSubDomain().GetSolutionVector(), &solutionFieldArray) >> checkError;
-    VecRestoreArray(monitorSubDomain->GetSolutionVector(), &monitorFieldArray) >> checkError;
+    VecRestoreArray(GetMonitorSubDomain()->GetSolutionVector(), &monitorFieldArray) >> checkError;
 
     // Call the base Save function only after the subdomain global function is updated
     FieldMonitor::Save(viewer, sequenceNumber, time);
@@ -138,4 +159,5 @@ void ablate::monitors::MixtureFractionMonitor::Save(PetscViewer viewer, PetscInt
 #include "registrar.hpp"
 REGISTER(ablate::monitors::Monitor, ablate::monitors::MixtureFractionMonitor,
          "This class computes the mixture fraction for each point in the domain and outputs zMix, Yi, and source terms to the hdf5 file",
-         ARG(ablate::monitors::MixtureFractionCalculator, "mixtureFractionCalculator", "the calculator used to compute zMix"));
\ No newline at end of file
+         ARG(ablate::monitors::MixtureFractionCalculator, "mixtureFractionCalculator", "the calculator used to compute zMix"),
+         OPT(bool, "cacheInAuxField", "compute zMix with the other aux fields into the solver's zMix aux field and copy it at each save (default is false)"));
\ No newline at end of file
@@ -16,8 +16,8 @@ class MixtureFractionMonitor : public FieldMonitor {
     //! the mixture fraction calculator
     const std::shared_ptr<MixtureFractionCalculator> mixtureFractionCalculator;
 
-    //! store a reference to a function to compute density from solution field
-    eos::ThermodynamicFunction densityFunction;
+    //! read zMix from the solver aux field of the same name, updated with the other aux fields, instead of computing it at each save
+    const bool cacheInAuxField;
 
     //! store an optional pointer to the TChemReactions to output chemistry source terms
     std::shared_ptr<ablate::finiteVolume::processes::Chemistry> chemistry;
@@ -25,8 +25,10 @@ class MixtureFractionMonitor : public FieldMonitor {
    public:
     /**
      * Create the mixture fraction monitor using a mixture fraction calculator
+     * @param mixtureFractionCalculator
+     * @param cacheInAuxField when true zMix is computed with the other aux fields into the solver's zMix aux field (default is false)
      */
-    explicit MixtureFractionMonitor(std::shared_ptr<MixtureFractionCalculator>);
+    explicit MixtureFractionMonitor(std::shared_ptr<MixtureFractionCalculator> mixtureFractionCalculator, bool cacheInAuxField = false);
 
     /**
      * Update the fields and save the results to an hdf5 file
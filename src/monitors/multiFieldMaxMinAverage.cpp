@@ -0,0 +1,143 @@
+#include "multiFieldMaxMinAverage.hpp"
+#include <limits>
+#include <utility>
+#include "io/interval/fixedInterval.hpp"
+#include "monitors/logs/stdOut.hpp"
+#include "utilities/mpiError.hpp"
+
+ablate::monitors::MultiFieldMaxMinAverage::MultiFieldMaxMinAverage(std::vector<std::string> fieldNames, std::shared_ptr<logs::Log> logIn, std::shared_ptr<io::interval::Interval> interval)
+    : fieldNames(std::move(fieldNames)), log(logIn ? logIn : std::make_shared<logs::StdOut>()), interval(interval ? interval : std::make_shared<io::interval::FixedInterval>()) {}
+
+ablate::monitors::MultiFieldMaxMinAverage::~MultiFieldMaxMinAverage() {
+    if (reductionOp != MPI_OP_NULL) MPI_Op_free(&reductionOp) >> checkMpiError;
+    if (reductionType != MPI_DATATYPE_NULL) MPI_Type_free(&reductionType) >> checkMpiError;
+}
+
+void ablate::monitors::MultiFieldMaxMinAverage::ReduceMaxMinSum(void* in, void* inout, int* len, MPI_Datatype*) {
+    auto inValues = (const PetscReal*)in;
+    auto inoutValues = (PetscReal*)inout;
+    for (int i = 0; i < *len; ++i) {
+        inoutValues[3 * i] = PetscMin(inoutValues[3 * i], inValues[3 * i]);
+        inoutValues[3 * i + 1] = PetscMax(inoutValues[3 * i + 1], inValues[3 * i + 1]);
+        inoutValues[3 * i + 2] += inValues[3 * i + 2];
+    }
+}
+
+void ablate::monitors::MultiFieldMaxMinAverage::Register(std::shared_ptr<solver::Solver> solverIn) {
+    Monitor::Register(solverIn);
+
+    if (reductionType == MPI_DATATYPE_NULL) {
+        MPI_Type_contiguous(3, MPIU_REAL, &reductionType) >> checkMpiError;
+        MPI_Type_commit(&reductionType) >> checkMpiError;
+        MPI_Op_create(ReduceMaxMinSum, 1, &reductionOp) >> checkMpiError;
+    }
+}
+
+PetscErrorCode ablate::monitors::MultiFieldMaxMinAverage::MonitorMaxMinAverage(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::MultiFieldMaxMinAverage*)ctx;
+
+    if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
+        auto& subDomain = monitor->GetSolver()->GetSubDomain();
+        auto comm = subDomain.GetComm();
+
+        // Look up each field and the offset of its first component in the packed (min, max, sum) triples, the last triple holds the point count for each field
+        std::vector<domain::Field> fields;
+        std::vector<PetscInt> fieldOffsets;
+        PetscInt numberTriples = 0;
+        for (const auto& fieldName : monitor->fieldNames) {
+            fields.push_back(subDomain.GetField(fieldName));
+            fieldOffsets.push_back(numberTriples);
+            numberTriples += fields.back().numberComponents + 1;
+        }
+
+        std::vector<PetscReal> local(3 * numberTriples);
+        for (PetscInt t = 0; t < numberTriples; ++t) {
+            local[3 * t] = std::numeric_limits<PetscReal>::max();
+            local[3 * t + 1] = std::numeric_limits<PetscReal>::lowest();
+            local[3 * t + 2] = 0.0;
+        }
+
+        for (std::size_t f = 0; f < fields.size(); ++f) {
+            const auto& field = fields[f];
+            const bool solutionField = field.location == domain::FieldLocation::SOL;
+            DM dm = subDomain.GetFieldDM(field);
+            Vec vec = solutionField ? subDomain.GetSolutionVector() : subDomain.GetAuxVector();
+            PetscReal* triples = local.data() + 3 * fieldOffsets[f];
+            PetscReal& count = triples[3 * field.numberComponents + 2];
+
+            // The sections determine the owned points and the number of dofs for this field
+            PetscSection section, globalSection;
+            PetscCall(DMGetLocalSection(dm, &section));
+            PetscCall(DMGetGlobalSection(dm, &globalSection));
+            PetscInt pStart, pEnd;
+            PetscCall(PetscSectionGetChart(section, &pStart, &pEnd));
+
+            const PetscScalar* data;
+            PetscCall(VecGetArrayRead(vec, &data));
+            for (PetscInt p = pStart; p < pEnd; ++p) {
+                PetscInt dof, globalOffset;
+                PetscCall(PetscSectionGetFieldDof(section, p, field.id, &dof));
+                PetscCall(PetscSectionGetOffset(globalSection, p, &globalOffset));
+                if (dof == 0 || globalOffset < 0) {
+                    continue;
+                }
+
+                const PetscScalar* values;
+                if (solutionField) {
+                    PetscCall(DMPlexPointGlobalFieldRead(dm, p, field.id, data, &values));
+                } else {
+                    PetscCall(DMPlexPointLocalFieldRead(dm, p, field.id, data, &values));
+                }
+
+                // Higher order fields may have more than one node per point
+                for (PetscInt i = 0; i < dof; ++i) {
+                    const auto d = i % field.numberComponents;
+                    const PetscReal value = PetscRealPart(values[i]);
+                    triples[3 * d] = PetscMin(triples[3 * d], value);
+                    triples[3 * d + 1] = PetscMax(triples[3 * d + 1], value);
+                    triples[3 * d + 2] += value;
+                }
+                count += (PetscReal)(dof / field.numberComponents);
+            }
+            PetscCall(VecRestoreArrayRead(vec, &data));
+        }
+
+        // Take across all ranks in a single reduction
+        std::vector<PetscReal> global(local.size());
+        PetscCallMPI(MPI_Reduce(local.data(), global.data(), (PetscMPIInt)numberTriples, monitor->reductionType, monitor->reductionOp, 0, comm));
+
+        // if this is the first time step init the log
+        if (!monitor->log->Initialized()) {
+            monitor->log->Initialize(comm);
+        }
+
+        // Print the results for each field
+        for (std::size_t f = 0; f < fields.size(); ++f) {
+            const auto& field = fields[f];
+            const PetscReal* triples = global.data() + 3 * fieldOffsets[f];
+            const PetscReal count = PetscMax(triples[3 * field.numberComponents + 2], 1.0);
+
+            std::vector<double> minGlob(field.numberComponents), maxGlob(field.numberComponents), avgGlob(field.numberComponents);
+            for (PetscInt d = 0; d < field.numberComponents; ++d) {
+                minGlob[d] = triples[3 * d];
+                maxGlob[d] = triples[3 * d + 1];
+                avgGlob[d] = triples[3 * d + 2] / count;
+            }
+
+            monitor->log->Printf("MinMaxAvg %s for timestep %04d:\n", field.name.c_str(), (int)step);
+            monitor->log->Print("\tmin", minGlob.size(), &minGlob[0], "%2.3g");
+            monitor->log->Print("\n");
+            monitor->log->Print("\tmax", maxGlob.size(), &maxGlob[0], "%2.3g");
+            monitor->log->Print("\n");
+            monitor->log->Print("\tavg", avgGlob.size(), &avgGlob[0], "%2.3g");
+            monitor->log->Print("\n");
+        }
+    }
+    PetscFunctionReturn(0);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::MultiFieldMaxMinAverage, "Prints the min/max/average for multiple fields using a single reduction",
+         ARG(std::vector<std::string>, "fields", "the name of each field"), OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"),
+         OPT(ablate::io::interval::Interval, "interval", "report interval object, defaults to every"));
@@ -0,0 +1,42 @@
+#ifndef ABLATELIBRARY_MULTIFIELDMAXMINAVERAGE_HPP
+#define ABLATELIBRARY_MULTIFIELDMAXMINAVERAGE_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "io/interval/interval.hpp"
+#include "monitor.hpp"
+#include "monitors/logs/log.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Prints the min/max/average for multiple fields.  The values are read directly from the solution and aux vectors and all fields are reduced together in a
+ * single MPI_Reduce with a custom op, so a single instance should be used in place of a MaxMinAverage monitor for each field.
+ */
+class MultiFieldMaxMinAverage : public Monitor {
+   private:
+    static PetscErrorCode MonitorMaxMinAverage(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
+    const std::vector<std::string> fieldNames;
+    const std::shared_ptr<logs::Log> log;
+    const std::shared_ptr<io::interval::Interval> interval;
+
+    //! the mpi type for a (min, max, sum) triple and the op used to reduce it
+    MPI_Datatype reductionType = MPI_DATATYPE_NULL;
+    MPI_Op reductionOp = MPI_OP_NULL;
+
+    /**
+     * Reduce the (min, max, sum) triples
+     */
+    static void ReduceMaxMinSum(void* in, void* inout, int* len, MPI_Datatype* datatype);
+
+   public:
+    explicit MultiFieldMaxMinAverage(std::vector<std::string> fieldNames, std::shared_ptr<logs::Log> log = {}, std::shared_ptr<io::interval::Interval> interval = {});
+    ~MultiFieldMaxMinAverage() override;
+
+    void Register(std::shared_ptr<solver::Solver> solverIn) override;
+
+    PetscMonitorFunction GetPetscFunction() override { return MonitorMaxMinAverage; }
+};
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_MULTIFIELDMAXMINAVERAGE_HPP
@@ -24,34 +24,45 @@ PetscErrorCode ablate::monitors::ParticleAverage::OutputParticleAverage(TS ts, P
 
         // Get the particle sizes
         PetscInt localParticleCount;
-        PetscInt globalParticleCount;
         ierr = DMSwarmGetLocalSize(monitor->particles->GetParticleDM(), &localParticleCount);
         CHKERRQ(ierr);
-        ierr = DMSwarmGetSize(monitor->particles->GetParticleDM(), &globalParticleCount);
-        CHKERRQ(ierr);
 
-        // compute the average particle location
+        // compute the average particle location weighted by the number of physical particles in each parcel, the total weight is stored after the location
         const PetscReal *coords;
+        const PetscReal *weights = nullptr;
         PetscInt dims;
-        PetscReal avg[3] = {0.0, 0.0, 0.0};
+        PetscReal avg[4] = {0.0, 0.0, 0.0, 0.0};
         ierr = DMSwarmGetField(monitor->particles->GetParticleDM(), DMSwarmPICField_coor, &dims, NULL, (void **)&coords);
         CHKERRQ(ierr);
+        if (monitor->particles->HasField(particles::ParticleSolver::ParticleWeight)) {
+            ierr = DMSwarmGetField(monitor->particles->GetParticleDM(), particles::ParticleSolver::ParticleWeight, NULL, NULL, (void **)&weights);
+            CHKERRQ(ierr);
+        }
         for (PetscInt p = 0; p < localParticleCount; p++) {
+            const PetscReal weight = weights ? weights[p] : 1.0;
             for (PetscInt n = 0; n < dims; n++) {
-                avg[n] += coords[p * dims + n] / PetscReal(globalParticleCount);
+                avg[n] += weight * coords[p * dims + n];
             }
+            avg[dims] += weight;
+        }
+        if (weights) {
+            ierr = DMSwarmRestoreField(monitor->particles->GetParticleDM(), particles::ParticleSolver::ParticleWeight, NULL, NULL, (void **)&weights);
+            CHKERRQ(ierr);
         }
         ierr = DMSwarmRestoreField(monitor->particles->GetParticleDM(), DMSwarmPICField_coor, &dims, NULL, (void **)&coords);
         CHKERRQ(ierr);
 
         // sum across all ranks
-        PetscReal globAvg[3] = {0.0, 0.0, 0.0};
+        PetscReal globAvg[4] = {0.0, 0.0, 0.0, 0.0};
         PetscMPIInt bufferSize;
-        ierr = PetscMPIIntCast(dims, &bufferSize);
+        ierr = PetscMPIIntCast(dims + 1, &bufferSize);
         CHKERRQ(ierr);
 
         int mpiErr = MPI_Reduce(avg, globAvg, bufferSize, MPIU_REAL, MPI_SUM, 0, PetscObjectComm((PetscObject)monitor->particles->GetParticleDM()));
         CHKERRMPI(mpiErr);
+        for (PetscInt n = 0; n < dims; n++) {
+            globAvg[n] /= globAvg[dims] > 0.0 ? globAvg[dims] : 1.0;
+        }
 
         // print to the log
         monitor->log->Printf("%s ", monitor->particles->GetSolverId().c_str());
@@ -25,7 +25,29 @@ PetscErrorCode ablate::monitors::ParticleCount::OutputParticleCount(TS ts, Petsc
         ierr = DMSwarmGetSize(monitor->particles->GetParticleDM(), &particleCount);
         CHKERRQ(ierr);
 
-        monitor->log->Printf("%s Count: %" PetscInt_FMT "\n", monitor->particles->GetSolverId().c_str(), particleCount);
+        monitor->log->Printf("%s Count: %" PetscInt_FMT, monitor->particles->GetSolverId().c_str(), particleCount);
+
+        // parcels also report the number of physical particles
+        if (monitor->particles->HasField(particles::ParticleSolver::ParticleWeight)) {
+            PetscInt localParticleCount;
+            ierr = DMSwarmGetLocalSize(monitor->particles->GetParticleDM(), &localParticleCount);
+            CHKERRQ(ierr);
+            const PetscReal *weights;
+            ierr = DMSwarmGetField(monitor->particles->GetParticleDM(), particles::ParticleSolver::ParticleWeight, NULL, NULL, (void **)&weights);
+            CHKERRQ(ierr);
+            PetscReal localWeight = 0.0;
+            for (PetscInt p = 0; p < localParticleCount; p++) {
+                localWeight += weights[p];
+            }
+            ierr = DMSwarmRestoreField(monitor->particles->GetParticleDM(), particles::ParticleSolver::ParticleWeight, NULL, NULL, (void **)&weights);
+            CHKERRQ(ierr);
+
+            PetscReal globalWeight = 0.0;
+            int mpiErr = MPI_Reduce(&localWeight, &globalWeight, 1, MPIU_REAL, MPI_SUM, 0, PetscObjectComm((PetscObject)monitor->particles->GetParticleDM()));
+            CHKERRMPI(mpiErr);
+            monitor->log->Printf(" PhysicalCount: %g", (double)globalWeight);
+        }
+        monitor->log->Printf("\n");
     }
     PetscFunctionReturn(0);
 }
@@ -0,0 +1,234 @@
+#include "particleStatistics.hpp"
+#include <numeric>
+#include <utility>
+#include "io/interval/fixedInterval.hpp"
+#include "monitors/logs/stdOut.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::monitors::ParticleStatistics::ParticleStatistics(std::shared_ptr<io::interval::Interval> interval, int numberBins, std::vector<double> diameterRange, std::vector<double> velocityRange,
+                                                         std::shared_ptr<logs::Log> logIn)
+    : interval(interval ? interval : std::make_shared<io::interval::FixedInterval>()),
+      numberBins(numberBins),
+      diameterRange(std::move(diameterRange)),
+      velocityRange(std::move(velocityRange)),
+      log(logIn ? logIn : std::make_shared<logs::StdOut>()) {
+    if (numberBins < 1) {
+        throw std::invalid_argument("The ParticleStatistics monitor requires at least one bin");
+    }
+    for (const auto& range : {&this->diameterRange, &this->velocityRange}) {
+        if (!range->empty() && (range->size() != 2 || (*range)[1] <= (*range)[0])) {
+            throw std::invalid_argument("The ParticleStatistics monitor histogram ranges must be [min, max]");
+        }
+    }
+}
+
+void ablate::monitors::ParticleStatistics::Register(std::shared_ptr<solver::Solver> solverIn) {
+    particles = std::dynamic_pointer_cast<particles::ParticleSolver>(solverIn);
+    if (!particles) {
+        throw std::invalid_argument("The ParticleStatistics monitor can only be used with ablate::particles::ParticleSolver");
+    }
+    if (!diameterRange.empty() && !particles->HasField(particles::ParticleSolver::ParticleDiameter)) {
+        throw std::invalid_argument("The ParticleStatistics monitor diameter histogram requires the " + std::string(particles::ParticleSolver::ParticleDiameter) + " field");
+    }
+    if (!velocityRange.empty() && !particles->HasField(particles::ParticleSolver::ParticleVelocity)) {
+        throw std::invalid_argument("The ParticleStatistics monitor velocity histogram requires the " + std::string(particles::ParticleSolver::ParticleVelocity) + " field");
+    }
+
+    // the mean velocity is only output if the particles have a velocity
+    std::vector<std::shared_ptr<domain::FieldDescriptor>> fields{
+        std::make_shared<domain::FieldDescription>(NumberDensity, NumberDensity, domain::FieldDescription::ONECOMPONENT, domain::FieldLocation::SOL, domain::FieldType::FVM)};
+    if (particles->HasField(particles::ParticleSolver::ParticleVelocity)) {
+        fields.push_back(std::make_shared<domain::FieldDescription>(
+            MeanVelocity, MeanVelocity, particles->GetField(particles::ParticleSolver::ParticleVelocity).components, domain::FieldLocation::SOL, domain::FieldType::FVM));
+    }
+    FieldMonitor::Register(solverIn->GetSolverId() + "_particleStatistics", solverIn, fields);
+}
+
+PetscErrorCode ablate::monitors::ParticleStatistics::OutputParticleStatistics(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::ParticleStatistics*)mctx;
+    MPI_Comm comm = PetscObjectComm((PetscObject)ts);
+    if (!monitor->interval->Check(comm, steps, time)) {
+        PetscFunctionReturn(0);
+    }
+    DM swarmDm = monitor->particles->GetParticleDM();
+    PetscInt np;
+    PetscCall(DMSwarmGetLocalSize(swarmDm, &np));
+
+    // each parcel is weighted by the number of physical particles it represents
+    const PetscReal* weights = nullptr;
+    if (monitor->particles->HasField(particles::ParticleSolver::ParticleWeight)) {
+        PetscCall(DMSwarmGetField(swarmDm, particles::ParticleSolver::ParticleWeight, nullptr, nullptr, (void**)&weights));
+    }
+
+    // pack the parcel count, physical count, weighted velocity sum, and histograms into a single buffer so only one reduction is needed
+    const bool hasVelocity = monitor->particles->HasField(particles::ParticleSolver::ParticleVelocity);
+    const PetscInt dim = hasVelocity ? monitor->particles->GetField(particles::ParticleSolver::ParticleVelocity).numberComponents : 0;
+    const PetscInt velocityStart = 2;
+    const PetscInt diameterHistogramStart = velocityStart + dim;
+    const PetscInt velocityHistogramStart = diameterHistogramStart + (monitor->diameterRange.empty() ? 0 : monitor->numberBins);
+    const PetscInt bufferSize = velocityHistogramStart + (monitor->velocityRange.empty() ? 0 : monitor->numberBins);
+    std::vector<PetscReal> localStatistics(bufferSize, 0.0);
+    localStatistics[0] = (PetscReal)np;
+    localStatistics[1] = weights ? std::accumulate(weights, weights + np, 0.0) : (PetscReal)np;
+
+    if (hasVelocity) {
+        const auto& velocityField = monitor->particles->GetField(particles::ParticleSolver::ParticleVelocity);
+        const PetscReal* velocity;
+        PetscCall(DMSwarmGetField(swarmDm, velocityField.location == domain::FieldLocation::SOL ? particles::ParticleSolver::PackedSolution : velocityField.name.c_str(), nullptr, nullptr,
+                                  (void**)&velocity));
+        for (PetscInt p = 0; p < np; ++p) {
+            const PetscReal weight = weights ? weights[p] : 1.0;
+            PetscReal magnitude = 0.0;
+            for (PetscInt d = 0; d < dim; ++d) {
+                localStatistics[velocityStart + d] += weight * velocity[velocityField[p] + d];
+                magnitude += PetscSqr(velocity[velocityField[p] + d]);
+            }
+            if (!monitor->velocityRange.empty()) {
+                monitor->AddToHistogram(monitor->velocityRange, PetscSqrtReal(magnitude), weight, localStatistics.data() + velocityHistogramStart);
+            }
+        }
+        PetscCall(DMSwarmRestoreField(swarmDm, velocityField.location == domain::FieldLocation::SOL ? particles::ParticleSolver::PackedSolution : velocityField.name.c_str(), nullptr, nullptr,
+                                      (void**)&velocity));
+    }
+    if (!monitor->diameterRange.empty()) {
+        const auto& diameterField = monitor->particles->GetField(particles::ParticleSolver::ParticleDiameter);
+        const PetscReal* diameter;
+        PetscCall(DMSwarmGetField(swarmDm, diameterField.location == domain::FieldLocation::SOL ? particles::ParticleSolver::PackedSolution : diameterField.name.c_str(), nullptr, nullptr,
+                                  (void**)&diameter));
+        for (PetscInt p = 0; p < np; ++p) {
+            monitor->AddToHistogram(monitor->diameterRange, diameter[diameterField[p]], weights ? weights[p] : 1.0, localStatistics.data() + diameterHistogramStart);
+        }
+        PetscCall(DMSwarmRestoreField(swarmDm, diameterField.location == domain::FieldLocation::SOL ? particles::ParticleSolver::PackedSolution : diameterField.name.c_str(), nullptr, nullptr,
+                                      (void**)&diameter));
+    }
+    if (weights) {
+        PetscCall(DMSwarmRestoreField(swarmDm, particles::ParticleSolver::ParticleWeight, nullptr, nullptr, (void**)&weights));
+    }
+
+    std::vector<PetscReal> statistics(bufferSize, 0.0);
+    PetscMPIInt mpiBufferSize;
+    PetscCall(PetscMPIIntCast(bufferSize, &mpiBufferSize));
+    PetscCallMPI(MPI_Reduce(localStatistics.data(), statistics.data(), mpiBufferSize, MPIU_REAL, MPI_SUM, 0, comm));
+
+    // print to the log
+    if (!monitor->log->Initialized()) {
+        monitor->log->Initialize(comm);
+    }
+    monitor->log->Printf("%s Count: %" PetscInt64_FMT, monitor->particles->GetSolverId().c_str(), (PetscInt64)statistics[0]);
+    if (weights) {
+        monitor->log->Printf(" PhysicalCount: %g", (double)statistics[1]);
+    }
+    if (hasVelocity) {
+        std::vector<double> meanVelocity(statistics.begin() + velocityStart, statistics.begin() + diameterHistogramStart);
+        for (auto& component : meanVelocity) {
+            component /= statistics[1] > 0.0 ? statistics[1] : 1.0;
+        }
+        monitor->log->Print(" MeanVelocity", meanVelocity);
+    }
+    if (!monitor->diameterRange.empty()) {
+        monitor->log->Print(" DiameterHistogram", std::vector<double>(statistics.begin() + diameterHistogramStart, statistics.begin() + velocityHistogramStart));
+    }
+    if (!monitor->velocityRange.empty()) {
+        monitor->log->Print(" VelocityHistogram", std::vector<double>(statistics.begin() + velocityHistogramStart, statistics.end()));
+    }
+    monitor->log->Print("\n");
+    PetscFunctionReturn(0);
+}
+
+void ablate::monitors::ParticleStatistics::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
+    DM dm = particles->GetSubDomain().GetDM();
+    DM swarmDm = particles->GetParticleDM();
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+
+    // accumulate the local particles in each cell, the particles are migrated so each is in a local cell
+    const bool hasVelocity = particles->HasField(particles::ParticleSolver::ParticleVelocity);
+    const PetscInt dim = hasVelocity ? particles->GetField(particles::ParticleSolver::ParticleVelocity).numberComponents : 0;
+    std::vector<PetscReal> cellCount(cEnd - cStart, 0.0);
+    std::vector<PetscReal> cellVelocity((cEnd - cStart) * dim, 0.0);
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    const PetscInt* cellIds;
+    DMSwarmGetField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&cellIds) >> checkError;
+    const PetscReal* weights = nullptr;
+    if (particles->HasField(particles::ParticleSolver::ParticleWeight)) {
+        DMSwarmGetField(swarmDm, particles::ParticleSolver::ParticleWeight, nullptr, nullptr, (void**)&weights) >> checkError;
+    }
+    const PetscReal* velocity = nullptr;
+    const char* velocityArrayName = nullptr;
+    const particles::Field* velocityField = nullptr;
+    if (hasVelocity) {
+        velocityField = &particles->GetField(particles::ParticleSolver::ParticleVelocity);
+        velocityArrayName = velocityField->location == domain::FieldLocation::SOL ? particles::ParticleSolver::PackedSolution : velocityField->name.c_str();
+        DMSwarmGetField(swarmDm, velocityArrayName, nullptr, nullptr, (void**)&velocity) >> checkError;
+    }
+    for (PetscInt p = 0; p < np; ++p) {
+        if (cellIds[p] < cStart || cellIds[p] >= cEnd) {
+            continue;
+        }
+        const PetscInt c = cellIds[p] - cStart;
+        const PetscReal weight = weights ? weights[p] : 1.0;
+        cellCount[c] += weight;
+        for (PetscInt d = 0; d < dim; ++d) {
+            cellVelocity[c * dim + d] += weight * velocity[(*velocityField)[p] + d];
+        }
+    }
+    if (hasVelocity) {
+        DMSwarmRestoreField(swarmDm, velocityArrayName, nullptr, nullptr, (void**)&velocity) >> checkError;
+    }
+    if (weights) {
+        DMSwarmRestoreField(swarmDm, particles::ParticleSolver::ParticleWeight, nullptr, nullptr, (void**)&weights) >> checkError;
+    }
+    DMSwarmRestoreField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&cellIds) >> checkError;
+
+    // map the monitor cells to the solution cells if this is a sub dm
+    DMLabel solutionToMonitor;
+    DMPlexGetSubpointMap(GetMonitorSubDomain()->GetDM(), &solutionToMonitor) >> checkError;
+    const PetscInt* monitorToSolution = nullptr;
+    IS monitorToSolutionIs = nullptr;
+    if (solutionToMonitor) {
+        DMPlexGetSubpointIS(GetMonitorSubDomain()->GetDM(), &monitorToSolutionIs) >> checkError;
+        ISGetIndices(monitorToSolutionIs, &monitorToSolution) >> checkError;
+    }
+
+    // set the number density and mean velocity in each owned monitor cell
+    const auto& numberDensityField = GetMonitorSubDomain()->GetField(NumberDensity);
+    PetscScalar* monitorArray;
+    VecGetArray(GetMonitorSubDomain()->GetSolutionVector(), &monitorArray) >> checkError;
+    PetscInt monitorStart, monitorEnd;
+    DMPlexGetHeightStratum(GetMonitorSubDomain()->GetDM(), 0, &monitorStart, &monitorEnd) >> checkError;
+    for (PetscInt monitorPt = monitorStart; monitorPt < monitorEnd; ++monitorPt) {
+        const PetscInt solutionPt = monitorToSolution ? monitorToSolution[monitorPt] : monitorPt;
+        PetscScalar* monitorField = nullptr;
+        DMPlexPointGlobalRef(GetMonitorSubDomain()->GetDM(), monitorPt, monitorArray, &monitorField) >> checkError;
+        if (!monitorField || solutionPt < cStart || solutionPt >= cEnd) {
+            continue;
+        }
+        const PetscInt c = solutionPt - cStart;
+        PetscReal volume;
+        DMPlexComputeCellGeometryFVM(dm, solutionPt, &volume, nullptr, nullptr) >> checkError;
+        monitorField[numberDensityField.offset] = cellCount[c] / volume;
+        if (hasVelocity) {
+            const auto& meanVelocityField = GetMonitorSubDomain()->GetField(MeanVelocity);
+            for (PetscInt d = 0; d < dim; ++d) {
+                monitorField[meanVelocityField.offset + d] = cellCount[c] > 0.0 ? cellVelocity[c * dim + d] / cellCount[c] : 0.0;
+            }
+        }
+    }
+    VecRestoreArray(GetMonitorSubDomain()->GetSolutionVector(), &monitorArray) >> checkError;
+    if (monitorToSolutionIs) {
+        ISRestoreIndices(monitorToSolutionIs, &monitorToSolution) >> checkError;
+    }
+
+    // Call the base Save function only after the monitor vector is updated
+    FieldMonitor::Save(viewer, sequenceNumber, time);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::ParticleStatistics,
+         "Computes the particle count, Lagrangian mean velocity, and diameter/velocity histograms with a single reduction per interval and saves the cell number density and mean particle velocity",
+         OPT(ablate::io::interval::Interval, "interval", "how often to log the statistics (default is every step)"), OPT(int, "numberBins", "the number of bins in each histogram (default is 10)"),
+         OPT(std::vector<double>, "diameterRange", "the [min, max] of the diameter histogram, the histogram is skipped if not specified"),
+         OPT(std::vector<double>, "velocityRange", "the [min, max] of the velocity magnitude histogram, the histogram is skipped if not specified"),
+         OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
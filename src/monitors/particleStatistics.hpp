@@ -0,0 +1,80 @@
+#ifndef ABLATELIBRARY_PARTICLESTATISTICS_HPP
+#define ABLATELIBRARY_PARTICLESTATISTICS_HPP
+
+#include <petsc.h>
+#include <memory>
+#include <vector>
+#include "fieldMonitor.hpp"
+#include "io/interval/interval.hpp"
+#include "monitors/logs/log.hpp"
+#include "particles/particleSolver.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Computes in situ statistics for a particle solver without gathering or writing any per particle data.  At each interval the global particle count, Lagrangian mean velocity, and optional
+ * diameter and velocity magnitude histograms are accumulated locally and combined with a single reduction.  When saved, the cell number density and cell mean particle velocity are computed from
+ * the local particles and written as monitor fields.  Each statistic is weighted by the ParticleWeight of the parcels if provided.
+ */
+class ParticleStatistics : public FieldMonitor {
+   private:
+    //! the particle solver being monitored
+    std::shared_ptr<ablate::particles::ParticleSolver> particles;
+
+    //! how often to log the statistics
+    const std::shared_ptr<io::interval::Interval> interval;
+
+    //! the number of bins in each histogram
+    const PetscInt numberBins;
+
+    //! the [min, max] of the diameter and velocity magnitude histograms, the histogram is skipped if empty
+    const std::vector<double> diameterRange;
+    const std::vector<double> velocityRange;
+
+    //! where to record the log
+    const std::shared_ptr<logs::Log> log;
+
+    //! the names of the cell fields written by this monitor
+    inline static const char NumberDensity[] = "particleNumberDensity";
+    inline static const char MeanVelocity[] = "particleMeanVelocity";
+
+    /**
+     * Add the parcel weight to the histogram, values outside of the range are added to the first or last bin
+     */
+    inline void AddToHistogram(const std::vector<double>& range, PetscReal value, PetscReal weight, PetscReal* histogram) const {
+        auto bin = (PetscInt)PetscFloorReal((value - range[0]) / (range[1] - range[0]) * (PetscReal)numberBins);
+        histogram[PetscMax(0, PetscMin(numberBins - 1, bin))] += weight;
+    }
+
+    static PetscErrorCode OutputParticleStatistics(TS ts, PetscInt steps, PetscReal time, Vec u, void* mctx);
+
+   public:
+    /**
+     * @param interval how often to log the statistics
+     * @param numberBins the number of bins in each histogram
+     * @param diameterRange the [min, max] of the diameter histogram
+     * @param velocityRange the [min, max] of the velocity magnitude histogram
+     * @param log where to record the log (default is stdout)
+     */
+    explicit ParticleStatistics(std::shared_ptr<io::interval::Interval> interval = {}, int numberBins = 10, std::vector<double> diameterRange = {}, std::vector<double> velocityRange = {},
+                                std::shared_ptr<logs::Log> log = {});
+
+    /**
+     * Create the cell fields for the particle solver
+     * @param solverIn
+     */
+    void Register(std::shared_ptr<solver::Solver> solverIn) override;
+
+    /**
+     * Compute the cell number density and mean particle velocity and save them to the viewer
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    void Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    PetscMonitorFunction GetPetscFunction() override { return OutputParticleStatistics; }
+};
+
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_PARTICLESTATISTICS_HPP
@@ -0,0 +1,97 @@
+#include "particleSubsample.hpp"
+#include <petscviewerhdf5.h>
+#include "utilities/petscError.hpp"
+
+ablate::monitors::ParticleSubsample::ParticleSubsample(int stride, bool compress) : stride(stride), compress(compress) {
+    if (stride < 1) {
+        throw std::invalid_argument("The ParticleSubsample monitor stride must be at least 1");
+    }
+}
+
+void ablate::monitors::ParticleSubsample::Register(std::shared_ptr<solver::Solver> solverIn) {
+    ablate::monitors::Monitor::Register(solverIn);
+
+    particles = std::dynamic_pointer_cast<particles::ParticleSolver>(solverIn);
+    if (!particles) {
+        throw std::invalid_argument("The ParticleSubsample monitor can only be used with ablate::particles::ParticleSolver");
+    }
+    id = particles->GetSolverId() + "_subsample";
+}
+
+void ablate::monitors::ParticleSubsample::SaveField(PetscViewer viewer, const std::string& name, const std::vector<PetscInt>& selected) const {
+    DM swarmDm = particles->GetParticleDM();
+    PetscInt blockSize;
+    PetscDataType dataType;
+    DMSwarmGetFieldInfo(swarmDm, name.c_str(), &blockSize, &dataType) >> checkError;
+
+    // copy the selected particles into a vector with one block per particle
+    Vec subsampleVec;
+    VecCreate(PetscObjectComm((PetscObject)swarmDm), &subsampleVec) >> checkError;
+    VecSetSizes(subsampleVec, (PetscInt)selected.size() * blockSize, PETSC_DETERMINE) >> checkError;
+    VecSetBlockSize(subsampleVec, blockSize) >> checkError;
+    VecSetType(subsampleVec, VECSTANDARD) >> checkError;
+    PetscObjectSetName((PetscObject)subsampleVec, name.c_str()) >> checkError;
+
+    const PetscReal* data;
+    PetscScalar* subsampleArray;
+    DMSwarmGetField(swarmDm, name.c_str(), nullptr, nullptr, (void**)&data) >> checkError;
+    VecGetArrayWrite(subsampleVec, &subsampleArray) >> checkError;
+    for (std::size_t i = 0; i < selected.size(); ++i) {
+        PetscArraycpy(subsampleArray + i * blockSize, data + selected[i] * blockSize, blockSize) >> checkError;
+    }
+    VecRestoreArrayWrite(subsampleVec, &subsampleArray) >> checkError;
+    DMSwarmRestoreField(swarmDm, name.c_str(), nullptr, nullptr, (void**)&data) >> checkError;
+
+    VecView(subsampleVec, viewer) >> checkError;
+    VecDestroy(&subsampleVec) >> checkError;
+}
+
+void ablate::monitors::ParticleSubsample::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
+    DM swarmDm = particles->GetParticleDM();
+
+    // select the particles by pid so the same particles are written each time
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    std::vector<PetscInt> selected;
+    const PetscInt64* pids;
+    DMSwarmGetField(swarmDm, DMSwarmField_pid, nullptr, nullptr, (void**)&pids) >> checkError;
+    for (PetscInt p = 0; p < np; ++p) {
+        if (pids[p] % stride == 0) {
+            selected.push_back(p);
+        }
+    }
+    DMSwarmRestoreField(swarmDm, DMSwarmField_pid, nullptr, nullptr, (void**)&pids) >> checkError;
+
+    // the subsample is written with collective mpi-io to chunked and optionally compressed datasets
+    PetscBool ishdf5;
+    PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5) >> checkError;
+    if (ishdf5) {
+        PetscViewerHDF5SetCollective(viewer, PETSC_TRUE) >> checkError;
+        PetscViewerHDF5SetCompress(viewer, compress ? PETSC_TRUE : PETSC_FALSE) >> checkError;
+        PetscViewerHDF5PushTimestepping(viewer) >> checkError;
+        PetscViewerHDF5SetTimestep(viewer, sequenceNumber) >> checkError;
+        PetscViewerHDF5PushGroup(viewer, "/particle_fields") >> checkError;
+    }
+
+    // output the coordinates and every real aux field
+    SaveField(viewer, DMSwarmPICField_coor, selected);
+    for (const auto& field : particles->GetFields()) {
+        if (field.dataType == PETSC_REAL && field.location == domain::FieldLocation::AUX) {
+            SaveField(viewer, field.name, selected);
+        }
+    }
+
+    if (ishdf5) {
+        PetscViewerHDF5PopGroup(viewer) >> checkError;
+        PetscViewerHDF5PopTimestepping(viewer) >> checkError;
+
+        // write the time for this sequence
+        DMSetOutputSequenceNumber(swarmDm, sequenceNumber, time) >> checkError;
+        particles::ParticleSolver::DMSequenceViewTimeHDF5(swarmDm, viewer) >> checkError;
+    }
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::ParticleSubsample, "Writes a subsample of the particles for visualization, the particle checkpoint is unchanged",
+         OPT(int, "stride", "write the particles with a pid that is a multiple of the stride (default is 10)"),
+         OPT(bool, "compress", "compress the chunked hdf5 datasets (default is true)"));
@@ -0,0 +1,70 @@
+#ifndef ABLATELIBRARY_PARTICLESUBSAMPLE_HPP
+#define ABLATELIBRARY_PARTICLESUBSAMPLE_HPP
+
+#include <petsc.h>
+#include <memory>
+#include <string>
+#include "io/serializable.hpp"
+#include "monitor.hpp"
+#include "particles/particleSolver.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Writes a subsample of the particles for visualization.  Only the particles with a pid that is a multiple of the stride are written so the same particles are output at every save.  The
+ * particle solver checkpoint is unchanged, this output is only for visualization and is not restored.
+ */
+class ParticleSubsample : public Monitor, public io::Serializable {
+   private:
+    //! the particle solver being output
+    std::shared_ptr<ablate::particles::ParticleSolver> particles;
+
+    //! write every stride particle
+    const PetscInt stride;
+
+    //! compress the chunked hdf5 datasets
+    const bool compress;
+
+    //! the id for this output
+    std::string id;
+
+    /**
+     * Write the selected particle values of a swarm field as a single vector
+     */
+    void SaveField(PetscViewer viewer, const std::string& name, const std::vector<PetscInt>& selected) const;
+
+   public:
+    /**
+     * @param stride write the particles with a pid that is a multiple of the stride
+     * @param compress compress the chunked hdf5 datasets
+     */
+    explicit ParticleSubsample(int stride = 10, bool compress = true);
+
+    /**
+     * Set up the monitor for the particle solver
+     * @param solverIn
+     */
+    void Register(std::shared_ptr<solver::Solver> solverIn) override;
+
+    /**
+     * only required function, returns the id of the object.  Should be unique for the simulation
+     * @return
+     */
+    [[nodiscard]] const std::string& GetId() const override { return id; }
+
+    /**
+     * Write the subsample of particles to the viewer
+     * @param viewer
+     * @param sequenceNumber
+     * @param time
+     */
+    void Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override;
+
+    /**
+     * The subsample is only for visualization so nothing is restored
+     */
+    void Restore(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) override {}
+};
+
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_PARTICLESUBSAMPLE_HPP
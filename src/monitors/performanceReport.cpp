@@ -0,0 +1,182 @@
+#include "performanceReport.hpp"
+#include <sys/resource.h>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <vector>
+#include "environment/runEnvironment.hpp"
+#include "utilities/loggable.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::monitors::PerformanceReport::PerformanceReport(std::string fileName) : fileName(std::move(fileName)), statistics(std::make_shared<RunStatistics>()) {}
+
+void ablate::monitors::PerformanceReport::Register(std::shared_ptr<solver::Solver> solverIn) {
+    Monitor::Register(solverIn);
+
+    // the event times are only recorded when petsc logging is active
+    PetscBool logActive;
+    PetscLogIsActive(&logActive) >> checkError;
+    if (!logActive) {
+        PetscLogDefaultBegin() >> checkError;
+    }
+
+    // the number of cells does not change during the run
+    statistics->solverId = solverIn->GetSolverId();
+    solver::Range cellRange;
+    solverIn->GetCellRange(cellRange);
+    statistics->localCells = cellRange.end - cellRange.start;
+    solverIn->RestoreRange(cellRange);
+
+    // write the report before petsc is finalized, the statistics are captured so the report does not depend upon the lifetime of the monitor
+    auto reportPath = environment::RunEnvironment::Get().GetOutputDirectory() / (fileName.empty() ? "performanceReport." + statistics->solverId + ".json" : fileName);
+    environment::RunEnvironment::RegisterCleanUpFunction("ablate::monitors::PerformanceReport::" + statistics->solverId,
+                                                         [statistics = statistics, reportPath]() { WriteReport(*statistics, reportPath); });
+}
+
+PetscErrorCode ablate::monitors::PerformanceReport::MonitorPerformance(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::PerformanceReport*)ctx;
+
+    PetscLogDouble time;
+    PetscCall(PetscTime(&time));
+    if (monitor->statistics->firstStep < 0) {
+        monitor->statistics->firstStep = step;
+        monitor->statistics->firstTime = time;
+    }
+    monitor->statistics->lastStep = step;
+    monitor->statistics->lastTime = time;
+    PetscFunctionReturn(0);
+}
+
+void ablate::monitors::PerformanceReport::WriteReport(const RunStatistics& statistics, const std::filesystem::path& reportPath) {
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    PetscMPIInt rank, size;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+    MPI_Comm_size(comm, &size) >> checkMpiError;
+
+    // the events may be registered in a different order on each rank, so look up the events registered on the root by name
+    std::string eventList;
+    if (rank == 0) {
+        std::set<std::string> eventNames;
+        for (const auto& event : utilities::LoggableEvents::Get()) {
+            if (eventNames.insert(event.eventName).second) {
+                eventList += event.className + '\t' + event.eventName + '\n';
+            }
+        }
+    }
+    int eventListSize = (int)eventList.size();
+    MPI_Bcast(&eventListSize, 1, MPI_INT, 0, comm) >> checkMpiError;
+    eventList.resize(eventListSize);
+    MPI_Bcast(eventList.data(), eventListSize, MPI_CHAR, 0, comm) >> checkMpiError;
+
+    std::vector<utilities::LoggableEvents::Event> events;
+    std::istringstream eventStream(eventList);
+    std::string line;
+    while (std::getline(eventStream, line)) {
+        const auto separator = line.find('\t');
+        events.push_back(utilities::LoggableEvents::Event{.className = line.substr(0, separator), .eventName = line.substr(separator + 1)});
+    }
+
+    // the time and count for each event on this rank
+    std::vector<PetscLogDouble> localTime(events.size(), 0.0);
+    std::vector<PetscLogDouble> localCount(events.size(), 0.0);
+    for (std::size_t e = 0; e < events.size(); e++) {
+        PetscLogEvent event = -1;
+        PetscLogEventGetId(events[e].eventName.c_str(), &event) >> checkError;
+        if (event >= 0) {
+            PetscEventPerfInfo info;
+            PetscLogEventGetPerfInfo(PETSC_DETERMINE, event, &info) >> checkError;
+            localTime[e] = info.time;
+            localCount[e] = (PetscLogDouble)info.count;
+        }
+    }
+    std::vector<PetscLogDouble> minTime(events.size()), maxTime(events.size()), sumTime(events.size()), maxCount(events.size());
+    if (!events.empty()) {
+        MPI_Reduce(localTime.data(), minTime.data(), (int)events.size(), MPIU_PETSCLOGDOUBLE, MPI_MIN, 0, comm) >> checkMpiError;
+        MPI_Reduce(localTime.data(), maxTime.data(), (int)events.size(), MPIU_PETSCLOGDOUBLE, MPI_MAX, 0, comm) >> checkMpiError;
+        MPI_Reduce(localTime.data(), sumTime.data(), (int)events.size(), MPIU_PETSCLOGDOUBLE, MPI_SUM, 0, comm) >> checkMpiError;
+        MPI_Reduce(localCount.data(), maxCount.data(), (int)events.size(), MPIU_PETSCLOGDOUBLE, MPI_MAX, 0, comm) >> checkMpiError;
+    }
+
+    // the total cells, the time spent stepping, and the memory high-water mark (ru_maxrss is in kilobytes) of each rank
+    PetscLogDouble localCells = (PetscLogDouble)statistics.localCells, totalCells = 0.0;
+    MPI_Reduce(&localCells, &totalCells, 1, MPIU_PETSCLOGDOUBLE, MPI_SUM, 0, comm) >> checkMpiError;
+    PetscLogDouble localSteppingTime = statistics.lastTime - statistics.firstTime, steppingTime = 0.0;
+    MPI_Reduce(&localSteppingTime, &steppingTime, 1, MPIU_PETSCLOGDOUBLE, MPI_MAX, 0, comm) >> checkMpiError;
+    struct rusage usage {};
+    getrusage(RUSAGE_SELF, &usage);
+    PetscLogDouble localMemory = (PetscLogDouble)usage.ru_maxrss * 1024.0;
+    std::vector<PetscLogDouble> memory(rank == 0 ? size : 0);
+    MPI_Gather(&localMemory, 1, MPIU_PETSCLOGDOUBLE, memory.data(), 1, MPIU_PETSCLOGDOUBLE, 0, comm) >> checkMpiError;
+
+    if (rank != 0) {
+        return;
+    }
+    const PetscInt timeSteps = statistics.firstStep < 0 ? 0 : statistics.lastStep - statistics.firstStep;
+    const PetscLogDouble cellsPerSecond = steppingTime > 0.0 ? totalCells * (PetscLogDouble)timeSteps / steppingTime : 0.0;
+    const auto& runEnvironment = environment::RunEnvironment::Get();
+
+    std::ofstream report(reportPath);
+    if (!report) {
+        throw std::runtime_error("Cannot write the performance report " + reportPath.string());
+    }
+    report.precision(12);
+    if (reportPath.extension() == ".csv") {
+        // the run information is written as comments before the event table
+        report << "# input: " << runEnvironment.GetInputPath().string() << "\n";
+        report << "# version: " << environment::RunEnvironment::GetVersion() << "\n";
+        report << "# solver: " << statistics.solverId << "\n";
+        report << "# ranks: " << size << "\n";
+        report << "# timeSteps: " << timeSteps << "\n";
+        report << "# cells: " << totalCells << "\n";
+        report << "# steppingTime: " << steppingTime << "\n";
+        report << "# cellsPerSecond: " << cellsPerSecond << "\n";
+        report << "# memoryHighWaterMark:";
+        for (const auto& rankMemory : memory) {
+            report << " " << rankMemory;
+        }
+        report << "\n";
+        report << "class,event,count,timeMin,timeMax,timeAverage\n";
+        for (std::size_t e = 0; e < events.size(); e++) {
+            report << events[e].className << "," << events[e].eventName << "," << maxCount[e] << "," << minTime[e] << "," << maxTime[e] << "," << sumTime[e] / size << "\n";
+        }
+    } else {
+        auto quote = [](const std::string& value) {
+            std::string quoted = "\"";
+            for (const auto& character : value) {
+                if (character == '"' || character == '\\') {
+                    quoted += '\\';
+                }
+                quoted += character;
+            }
+            return quoted + "\"";
+        };
+        report << "{\n";
+        report << "  \"input\": " << quote(runEnvironment.GetInputPath().string()) << ",\n";
+        report << "  \"version\": " << quote(std::string(environment::RunEnvironment::GetVersion())) << ",\n";
+        report << "  \"solver\": " << quote(statistics.solverId) << ",\n";
+        report << "  \"ranks\": " << size << ",\n";
+        report << "  \"timeSteps\": " << timeSteps << ",\n";
+        report << "  \"cells\": " << totalCells << ",\n";
+        report << "  \"steppingTime\": " << steppingTime << ",\n";
+        report << "  \"cellsPerSecond\": " << cellsPerSecond << ",\n";
+        report << "  \"memoryHighWaterMark\": [";
+        for (std::size_t r = 0; r < memory.size(); r++) {
+            report << (r ? ", " : "") << memory[r];
+        }
+        report << "],\n";
+        report << "  \"events\": [";
+        for (std::size_t e = 0; e < events.size(); e++) {
+            report << (e ? "," : "") << "\n    {\"class\": " << quote(events[e].className) << ", \"event\": " << quote(events[e].eventName) << ", \"count\": " << maxCount[e]
+                   << ", \"timeMin\": " << minTime[e] << ", \"timeMax\": " << maxTime[e] << ", \"timeAverage\": " << sumTime[e] / size << "}";
+        }
+        report << "\n  ]\n}\n";
+    }
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::PerformanceReport,
+         "Writes a json or csv performance summary (event times, time steps, cell throughput, and memory high-water mark) when the run is finalized",
+         OPT(std::string, "name", "the report file name in the output directory, a .csv extension writes a csv table (default is performanceReport.{solverId}.json)"));
@@ -0,0 +1,56 @@
+#ifndef ABLATELIBRARY_PERFORMANCEREPORT_HPP
+#define ABLATELIBRARY_PERFORMANCEREPORT_HPP
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include "monitor.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Writes a performance summary for a solver when the run environment is finalized so runs can be compared.  The report includes the time in every event
+ * registered by a Loggable (i.e. the per solver rhs, flux, chemistry, radiation, and io events), the number of time steps, the cell throughput, and the memory
+ * high-water mark of each rank, keyed by the input file and ablate version.  A json report is written unless the file name ends in .csv.
+ */
+class PerformanceReport : public Monitor {
+   private:
+    /**
+     * The statistics collected during the run, shared with the finalize function so they outlive the monitor
+     */
+    struct RunStatistics {
+        std::string solverId;
+        PetscInt firstStep = -1;
+        PetscInt lastStep = -1;
+        PetscLogDouble firstTime = 0.0;
+        PetscLogDouble lastTime = 0.0;
+        PetscInt localCells = 0;
+    };
+
+    //! the report file name in the output directory
+    const std::string fileName;
+
+    //! the statistics for this run
+    std::shared_ptr<RunStatistics> statistics;
+
+    static PetscErrorCode MonitorPerformance(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
+
+    /**
+     * Reduce the statistics across all ranks and write the report from the root rank
+     * @param statistics
+     * @param reportPath
+     */
+    static void WriteReport(const RunStatistics& statistics, const std::filesystem::path& reportPath);
+
+   public:
+    /**
+     * @param fileName the report file name in the output directory (default is performanceReport.{solverId}.json)
+     */
+    explicit PerformanceReport(std::string fileName = {});
+
+    void Register(std::shared_ptr<solver::Solver> solverIn) override;
+
+    PetscMonitorFunction GetPetscFunction() override { return MonitorPerformance; }
+};
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_PERFORMANCEREPORT_HPP
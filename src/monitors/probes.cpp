@@ -1,17 +1,25 @@
 #include "probes.hpp"
+#include <hdf5.h>
+#include <algorithm>
 #include <fstream>
+#include <iostream>
+#include <optional>
 #include <regex>
+#include <set>
+#include <sstream>
 #include "environment/runEnvironment.hpp"
 #include "io/interval/fixedInterval.hpp"
 #include "utilities/mpiError.hpp"
 #include "utilities/vectorUtilities.hpp"
 
 ablate::monitors::Probes::Probes(const std::shared_ptr<ablate::monitors::probes::ProbeInitializer> &initializer, std::vector<std::string> variableNames,
-                                 const std::shared_ptr<io::interval::Interval> &intervalIn, const int bufferSize)
+                                 const std::shared_ptr<io::interval::Interval> &intervalIn, const int bufferSize, bool binary)
     : initializer(initializer),
       variableNames(std::move(variableNames)),
       interval(intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>()),
-      bufferSize(bufferSize == 0 ? 100 : bufferSize) {}
+      bufferSize(bufferSize == 0 ? 100 : bufferSize),
+      binary(binary),
+      telemetry(std::make_shared<io::IoTelemetry>("Probes", PETSC_COMM_SELF)) {}
 
 void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver) {
     Monitor::Register(solver);
@@ -50,16 +58,30 @@ void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver)
         const PetscInt *foundPoints = nullptr;
         PetscSFGetGraph(cellSF, nullptr, &numFound, &foundPoints, &foundCells) >> checkMpiError;
 
+        // cells shared from another rank are not owned, so they are skipped to allow the owned values to be read directly
+        PetscSF pointSF;
+        PetscInt numberLeaves;
+        const PetscInt *leaves = nullptr;
+        DMGetPointSF(solver->GetSubDomain().GetDM(), &pointSF) >> checkError;
+        PetscSFGetGraph(pointSF, nullptr, &numberLeaves, &leaves, nullptr) >> checkError;
+        std::set<PetscInt> sharedPoints;
+        for (PetscInt l = 0; l < PetscMax(numberLeaves, 0); ++l) {
+            sharedPoints.insert(leaves ? leaves[l] : l);
+        }
+
         // Let the lowest rank process own each point
         PetscMPIInt rank, size;
         MPI_Comm_rank(solver->GetSubDomain().GetComm(), &rank) >> checkMpiError;
         MPI_Comm_size(solver->GetSubDomain().GetComm(), &size) >> checkMpiError;
         std::vector<PetscMPIInt> foundProcs(globalPointsCount, size);
         std::vector<PetscMPIInt> globalProcs(globalPointsCount, size);
+        std::vector<PetscInt> foundCellIndex(globalPointsCount, -1);
 
         for (PetscInt p = 0; p < numFound; ++p) {
-            if (foundCells[p].index >= 0) {
-                foundProcs[foundPoints ? foundPoints[p] : p] = rank;
+            if (foundCells[p].index >= 0 && !sharedPoints.count(foundCells[p].index)) {
+                const auto point = foundPoints ? foundPoints[p] : p;
+                foundProcs[point] = rank;
+                foundCellIndex[point] = foundCells[p].index;
             }
         }
         // Let the lowest rank process own each point
@@ -71,6 +93,7 @@ void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver)
                 throw std::invalid_argument("Cannot locate probe " + initializer->GetProbes()[p].name + " in domain");
             } else if (globalProcs[p] == rank) {
                 localProbes.push_back(initializer->GetProbes()[p]);
+                localProbeCells.push_back(foundCellIndex[p]);
             }
         }
 
@@ -100,6 +123,23 @@ void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver)
         // Store this field
         fields.push_back(field);
 
+        // convert the variable names to the variable names with components
+        if (field.numberComponents > 0) {
+            for (const auto &componentName : field.components) {
+                componentNames.push_back(variableName + "_" + componentName);
+            }
+        } else {
+            componentNames.push_back(variableName);
+        }
+        fieldOffset.push_back(variableFieldOffset);
+        variableFieldOffset += field.numberComponents;
+
+        // fvm fields are constant over each cell, so the value is read directly from the owning cell
+        if (field.type == domain::FieldType::FVM) {
+            interpolants.push_back(nullptr);
+            continue;
+        }
+
         // Create the interpolant.  This uses PETSC_COMM_SELF because it should only work over local variables
         DMInterpolationInfo interpolant;
         DMInterpolationCreate(PETSC_COMM_SELF, &interpolant) >> checkError;
@@ -122,29 +162,34 @@ void ablate::monitors::Probes::Register(std::shared_ptr<solver::Solver> solver)
 
         // restore
         solver->GetSubDomain().RestoreFieldLocalVector(field, &subIs, &locVec, &subDm) >> checkError;
+    }
 
-        // convert the variable names to the variable names with components
-        if (field.numberComponents > 0) {
-            for (const auto &componentName : field.components) {
-                componentNames.push_back(variableName + "_" + componentName);
+    if (binary) {
+        // Build a single recorder for all probes on this rank
+        if (!localProbes.empty()) {
+            PetscMPIInt rank;
+            MPI_Comm_rank(solver->GetSubDomain().GetComm(), &rank) >> checkMpiError;
+            std::vector<std::string> probeNames;
+            for (const auto &probe : localProbes) {
+                probeNames.push_back(probe.name);
             }
-        } else {
-            componentNames.push_back(variableName);
+            std::filesystem::path probePath = initializer->GetDirectory() / ("probes." + std::to_string(rank) + ".h5");
+            hdf5Recorder = std::make_unique<Hdf5ProbeRecorder>(bufferSize, probeNames, componentNames, probePath, telemetry);
+        }
+    } else {
+        // Build a ProbeRecorder for each probe
+        for (const auto &probe : localProbes) {
+            std::filesystem::path probePath = initializer->GetDirectory() / (probe.name + ".csv");
+            recorders.emplace_back(bufferSize, componentNames, probePath, telemetry);
         }
-        fieldOffset.push_back(variableFieldOffset);
-        variableFieldOffset += field.numberComponents;
-    }
-
-    // Build a ProbeRecorder for each probe
-    for (const auto &probe : localProbes) {
-        std::filesystem::path probePath = initializer->GetDirectory() / (probe.name + ".csv");
-        recorders.emplace_back(bufferSize, componentNames, probePath);
     }
 }
 
 ablate::monitors::Probes::~Probes() {
     for (auto &interpolant : interpolants) {
-        DMInterpolationDestroy(&interpolant) >> checkError;
+        if (interpolant) {
+            DMInterpolationDestroy(&interpolant) >> checkError;
+        }
     }
 }
 
@@ -159,11 +204,41 @@ PetscErrorCode ablate::monitors::Probes::UpdateProbes(TS ts, PetscInt step, Pets
         for (auto &recorder : monitor->recorders) {
             recorder.AdvanceTime(time);
         }
+        if (monitor->hdf5Recorder) {
+            monitor->hdf5Recorder->AdvanceTime(time);
+        }
+
+        auto &subDomain = monitor->GetSolver()->GetSubDomain();
 
         // March over each field
         for (std::size_t it = 0; it < monitor->fields.size(); it++) {
             // determine the field
             const auto &field = monitor->fields[it];
+            const int &fieldOffset = monitor->fieldOffset[it];
+
+            // the fvm fields are read directly from the owned cells of the solution (global) or aux (local) vector
+            if (!monitor->interpolants[it]) {
+                const bool solutionField = field.location == domain::FieldLocation::SOL;
+                Vec fieldVec = solutionField ? subDomain.GetSolutionVector() : subDomain.GetAuxVector();
+                const PetscScalar *fieldArray;
+                ierr = VecGetArrayRead(fieldVec, &fieldArray);
+                CHKERRQ(ierr);
+                for (std::size_t p = 0; p < monitor->localProbes.size(); p++) {
+                    const PetscScalar *values = nullptr;
+                    if (solutionField) {
+                        ierr = DMPlexPointGlobalFieldRead(subDomain.GetDM(), monitor->localProbeCells[p], field.id, fieldArray, &values);
+                    } else {
+                        ierr = DMPlexPointLocalFieldRead(subDomain.GetAuxDM(), monitor->localProbeCells[p], field.id, fieldArray, &values);
+                    }
+                    CHKERRQ(ierr);
+                    for (PetscInt c = 0; values && c < field.numberComponents; c++) {
+                        monitor->SetProbeValue(p, fieldOffset + c, values[c]);
+                    }
+                }
+                ierr = VecRestoreArrayRead(fieldVec, &fieldArray);
+                CHKERRQ(ierr);
+                continue;
+            }
 
             // Get the sub vector
             IS subIs;
@@ -185,10 +260,9 @@ PetscErrorCode ablate::monitors::Probes::UpdateProbes(TS ts, PetscInt step, Pets
             const PetscScalar *interValuesArray;
             VecGetArrayRead(interpValues, &interValuesArray);
             PetscInt offset = 0;
-            const int &fieldOffset = monitor->fieldOffset[it];
-            for (auto &recorder : monitor->recorders) {
+            for (std::size_t p = 0; p < monitor->localProbes.size(); p++) {
                 for (PetscInt c = 0; c < field.numberComponents; c++) {
-                    recorder.SetValue(fieldOffset + c, interValuesArray[offset++]);
+                    monitor->SetProbeValue(p, fieldOffset + c, interValuesArray[offset++]);
                 }
             }
 
@@ -199,13 +273,15 @@ PetscErrorCode ablate::monitors::Probes::UpdateProbes(TS ts, PetscInt step, Pets
             ierr = monitor->GetSolver()->GetSubDomain().RestoreFieldLocalVector(field, &subIs, &locVec, &subDm);
             CHKERRQ(ierr);
         }
+
     }
 
     PetscFunctionReturn(0);
 }
 
-ablate::monitors::Probes::ProbeRecorder::ProbeRecorder(int bufferSizeIn, const std::vector<std::string> &variables, const std::filesystem::path &outputPath)
-    : bufferSize(PetscMax(bufferSizeIn, 1)), outputPath(outputPath) {
+ablate::monitors::Probes::ProbeRecorder::ProbeRecorder(int bufferSizeIn, const std::vector<std::string> &variables, const std::filesystem::path &outputPath,
+                                                       std::shared_ptr<io::IoTelemetry> telemetry)
+    : bufferSize(PetscMax(bufferSizeIn, 1)), outputPath(outputPath), telemetry(std::move(telemetry)) {
     // size up the buffers
     buffer = std::vector<std::vector<double>>(bufferSize, std::vector<double>(variables.size()));
     timeHistory = std::vector<double>(bufferSize);
@@ -246,7 +322,12 @@ ablate::monitors::Probes::ProbeRecorder::~ProbeRecorder() { WriteBuffer(); }
 void ablate::monitors::Probes::ProbeRecorder::AdvanceTime(double time) {
     if (time > lastOutputTime) {
         if (activeIndex + 1 >= bufferSize) {
-            WriteBuffer();
+            if (telemetry) {
+                telemetry->Start();
+                telemetry->Stop((double)WriteBuffer());
+            } else {
+                WriteBuffer();
+            }
         }
 
         activeIndex++;
@@ -261,9 +342,10 @@ void ablate::monitors::Probes::ProbeRecorder::SetValue(std::size_t index, double
     }
 }
 
-void ablate::monitors::Probes::ProbeRecorder::WriteBuffer() {
+std::size_t ablate::monitors::Probes::ProbeRecorder::WriteBuffer() {
     // write the header file
     std::ofstream probeFile;
+    const auto startSize = std::filesystem::exists(outputPath) ? std::filesystem::file_size(outputPath) : 0;
     probeFile.open(outputPath, std::ios_base::app);
     for (int r = 0; r <= activeIndex; r++) {
         probeFile << timeHistory[r] << ",";
@@ -274,9 +356,270 @@ void ablate::monitors::Probes::ProbeRecorder::WriteBuffer() {
     }
     probeFile.close();
     activeIndex = -1;
+    return (std::size_t)(std::filesystem::file_size(outputPath) - startSize);
+}
+
+namespace {
+/**
+ * throw if the hdf5 call failed, otherwise return the result
+ */
+template <class T>
+T CheckHdf5(T result, const char *operation, const std::filesystem::path &path) {
+    if (result < 0) {
+        throw std::runtime_error(std::string(operation) + " failed for the probe file " + path.string());
+    }
+    return result;
+}
+
+/**
+ * join the names into a comma separated string
+ */
+std::string JoinNames(const std::vector<std::string> &names) {
+    std::string joined;
+    for (const auto &value : names) {
+        joined += (joined.empty() ? "" : ",") + value;
+    }
+    return joined;
+}
+
+/**
+ * read the comma separated names stored in the file attribute
+ */
+std::vector<std::string> ReadNames(hid_t file, const char *name, const std::filesystem::path &path) {
+    hid_t attribute = CheckHdf5(H5Aopen(file, name, H5P_DEFAULT), "H5Aopen", path);
+    hid_t stringType = CheckHdf5(H5Aget_type(attribute), "H5Aget_type", path);
+    const auto size = H5Tget_size(stringType);
+    if (size == 0) {
+        throw std::runtime_error("Unable to read the " + std::string(name) + " attribute size from " + path.string());
+    }
+    std::string joined(size, '\0');
+    CheckHdf5(H5Aread(attribute, stringType, joined.data()), "H5Aread", path);
+    CheckHdf5(H5Tclose(stringType), "H5Tclose", path);
+    CheckHdf5(H5Aclose(attribute), "H5Aclose", path);
+
+    std::vector<std::string> names;
+    std::stringstream stream(joined.c_str());
+    std::string value;
+    while (std::getline(stream, value, ',')) {
+        names.push_back(value);
+    }
+    return names;
+}
+
+/**
+ * read the dimensions of the dataset
+ */
+std::vector<hsize_t> ReadDims(hid_t file, const char *name, const std::filesystem::path &path) {
+    hid_t dataset = CheckHdf5(H5Dopen2(file, name, H5P_DEFAULT), "H5Dopen2", path);
+    hid_t space = CheckHdf5(H5Dget_space(dataset), "H5Dget_space", path);
+    const int rank = CheckHdf5(H5Sget_simple_extent_ndims(space), "H5Sget_simple_extent_ndims", path);
+    std::vector<hsize_t> dims(rank);
+    CheckHdf5(H5Sget_simple_extent_dims(space, dims.data(), nullptr), "H5Sget_simple_extent_dims", path);
+    CheckHdf5(H5Sclose(space), "H5Sclose", path);
+    CheckHdf5(H5Dclose(dataset), "H5Dclose", path);
+    return dims;
+}
+
+/**
+ * read all values in the dataset
+ */
+std::vector<double> ReadDataset(hid_t file, const char *name, const std::filesystem::path &path) {
+    hid_t dataset = CheckHdf5(H5Dopen2(file, name, H5P_DEFAULT), "H5Dopen2", path);
+    hid_t space = CheckHdf5(H5Dget_space(dataset), "H5Dget_space", path);
+    std::vector<double> data((std::size_t)CheckHdf5(H5Sget_simple_extent_npoints(space), "H5Sget_simple_extent_npoints", path));
+    if (!data.empty()) {
+        CheckHdf5(H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data()), "H5Dread", path);
+    }
+    CheckHdf5(H5Sclose(space), "H5Sclose", path);
+    CheckHdf5(H5Dclose(dataset), "H5Dclose", path);
+    return data;
+}
+
+/**
+ * read the times from an existing probe file, returns an empty optional if the file was not written for the same probes and variables
+ */
+std::optional<std::vector<double>> ReadMatchingFile(const std::filesystem::path &path, const std::vector<std::string> &probeNames, const std::vector<std::string> &variables) {
+    // a file that is not an hdf5 probe file is reported as not matching without printing the hdf5 error stack
+    hid_t file = -1;
+    H5E_BEGIN_TRY { file = H5Fopen(path.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT); }
+    H5E_END_TRY;
+    if (file < 0) {
+        return {};
+    }
+
+    std::optional<std::vector<double>> times;
+    const bool hasEntries = H5Aexists(file, "probes") > 0 && H5Aexists(file, "variables") > 0 && H5Lexists(file, "time", H5P_DEFAULT) > 0 && H5Lexists(file, "values", H5P_DEFAULT) > 0;
+    if (hasEntries && ReadNames(file, "probes", path) == probeNames && ReadNames(file, "variables", path) == variables) {
+        // the time and values datasets must have the same number of times and the values must be sized for these probes and variables
+        const auto timeDims = ReadDims(file, "time", path);
+        const auto valueDims = ReadDims(file, "values", path);
+        if (timeDims.size() == 1 && valueDims.size() == 3 && valueDims[0] == timeDims[0] && valueDims[1] == probeNames.size() && valueDims[2] == variables.size()) {
+            times = ReadDataset(file, "time", path);
+        }
+    }
+    CheckHdf5(H5Fclose(file), "H5Fclose", path);
+    return times;
+}
+}  // namespace
+
+ablate::monitors::Probes::Hdf5ProbeRecorder::Hdf5ProbeRecorder(int bufferSizeIn, const std::vector<std::string> &probeNames, const std::vector<std::string> &variables,
+                                                               std::filesystem::path outputPathIn, std::shared_ptr<io::IoTelemetry> telemetry)
+    : bufferSize(PetscMax(bufferSizeIn, 1)),
+      outputPath(std::move(outputPathIn)),
+      numberProbes(probeNames.size()),
+      numberVariables(variables.size()),
+      buffer(bufferSize * numberProbes * numberVariables),
+      timeHistory(bufferSize),
+      telemetry(std::move(telemetry)) {
+    // only append to an existing file written for the same probes and variables, otherwise keep the old file and start a new one
+    if (std::filesystem::exists(outputPath)) {
+        if (auto fileTimes = ReadMatchingFile(outputPath, probeNames, variables)) {
+            if (!fileTimes->empty()) {
+                lastOutputTime = *std::max_element(fileTimes->begin(), fileTimes->end());
+            }
+            return;
+        }
+        auto previousPath = outputPath;
+        previousPath += ".previous";
+        std::cout << "Warning: the probe file " << outputPath << " does not match the current probes and variables and was moved to " << previousPath << std::endl;
+        std::filesystem::rename(outputPath, previousPath);
+    }
+
+    // create the file with an extendable time dimension, chunked by the buffer size
+    hid_t file = CheckHdf5(H5Fcreate(outputPath.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT), "H5Fcreate", outputPath);
+    auto createDataset = [this, file](const char *name, int rank, const hsize_t *chunk) {
+        std::vector<hsize_t> dims(chunk, chunk + rank);
+        std::vector<hsize_t> maxDims(dims);
+        dims[0] = 0;
+        maxDims[0] = H5S_UNLIMITED;
+        hid_t space = CheckHdf5(H5Screate_simple(rank, dims.data(), maxDims.data()), "H5Screate_simple", outputPath);
+        hid_t properties = CheckHdf5(H5Pcreate(H5P_DATASET_CREATE), "H5Pcreate", outputPath);
+        CheckHdf5(H5Pset_chunk(properties, rank, chunk), "H5Pset_chunk", outputPath);
+        hid_t dataset = CheckHdf5(H5Dcreate2(file, name, H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, properties, H5P_DEFAULT), "H5Dcreate2", outputPath);
+        CheckHdf5(H5Dclose(dataset), "H5Dclose", outputPath);
+        CheckHdf5(H5Pclose(properties), "H5Pclose", outputPath);
+        CheckHdf5(H5Sclose(space), "H5Sclose", outputPath);
+    };
+    const hsize_t timeChunk[1] = {(hsize_t)bufferSize};
+    createDataset("time", 1, timeChunk);
+    const hsize_t valueChunk[3] = {(hsize_t)bufferSize, (hsize_t)numberProbes, (hsize_t)numberVariables};
+    createDataset("values", 3, valueChunk);
+
+    // store the probe and variable names as comma separated attributes
+    auto writeNames = [this, file](const char *name, const std::vector<std::string> &names) {
+        const auto joined = JoinNames(names);
+        hid_t stringType = CheckHdf5(H5Tcopy(H5T_C_S1), "H5Tcopy", outputPath);
+        CheckHdf5(H5Tset_size(stringType, std::max<std::size_t>(joined.size(), 1)), "H5Tset_size", outputPath);
+        hid_t space = CheckHdf5(H5Screate(H5S_SCALAR), "H5Screate", outputPath);
+        hid_t attribute = CheckHdf5(H5Acreate2(file, name, stringType, space, H5P_DEFAULT, H5P_DEFAULT), "H5Acreate2", outputPath);
+        CheckHdf5(H5Awrite(attribute, stringType, joined.c_str()), "H5Awrite", outputPath);
+        CheckHdf5(H5Aclose(attribute), "H5Aclose", outputPath);
+        CheckHdf5(H5Sclose(space), "H5Sclose", outputPath);
+        CheckHdf5(H5Tclose(stringType), "H5Tclose", outputPath);
+    };
+    writeNames("probes", probeNames);
+    writeNames("variables", variables);
+    CheckHdf5(H5Fclose(file), "H5Fclose", outputPath);
+}
+
+ablate::monitors::Probes::Hdf5ProbeRecorder::~Hdf5ProbeRecorder() { WriteBuffer(); }
+
+void ablate::monitors::Probes::Hdf5ProbeRecorder::AdvanceTime(double time) {
+    if (time > lastOutputTime) {
+        if (activeIndex + 1 >= bufferSize) {
+            if (telemetry) {
+                telemetry->Start();
+                telemetry->Stop((double)WriteBuffer());
+            } else {
+                WriteBuffer();
+            }
+        }
+
+        activeIndex++;
+        lastOutputTime = time;
+        timeHistory[activeIndex] = time;
+    }
+}
+
+std::size_t ablate::monitors::Probes::Hdf5ProbeRecorder::WriteBuffer() {
+    if (activeIndex < 0) {
+        return 0;
+    }
+    const auto numberTimes = (hsize_t)(activeIndex + 1);
+
+    hid_t file = CheckHdf5(H5Fopen(outputPath.c_str(), H5F_ACC_RDWR, H5P_DEFAULT), "H5Fopen", outputPath);
+    // extend the dataset by the buffered times and write them to the end.  The count is sized from this recorder so the write always matches the buffer
+    auto append = [this, file](const char *name, std::vector<hsize_t> count, const double *data) {
+        const int rank = (int)count.size();
+        hid_t dataset = CheckHdf5(H5Dopen2(file, name, H5P_DEFAULT), "H5Dopen2", outputPath);
+        hid_t space = CheckHdf5(H5Dget_space(dataset), "H5Dget_space", outputPath);
+        if (CheckHdf5(H5Sget_simple_extent_ndims(space), "H5Sget_simple_extent_ndims", outputPath) != rank) {
+            throw std::runtime_error("The " + std::string(name) + " dataset in " + outputPath.string() + " does not match the probe recorder");
+        }
+        std::vector<hsize_t> dims(rank);
+        CheckHdf5(H5Sget_simple_extent_dims(space, dims.data(), nullptr), "H5Sget_simple_extent_dims", outputPath);
+        CheckHdf5(H5Sclose(space), "H5Sclose", outputPath);
+        if (!std::equal(dims.begin() + 1, dims.end(), count.begin() + 1)) {
+            throw std::runtime_error("The " + std::string(name) + " dataset in " + outputPath.string() + " does not match the probe recorder");
+        }
+
+        std::vector<hsize_t> start(rank, 0);
+        start[0] = dims[0];
+        dims[0] += count[0];
+        CheckHdf5(H5Dset_extent(dataset, dims.data()), "H5Dset_extent", outputPath);
+
+        space = CheckHdf5(H5Dget_space(dataset), "H5Dget_space", outputPath);
+        CheckHdf5(H5Sselect_hyperslab(space, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr), "H5Sselect_hyperslab", outputPath);
+        hid_t memorySpace = CheckHdf5(H5Screate_simple(rank, count.data(), nullptr), "H5Screate_simple", outputPath);
+        CheckHdf5(H5Dwrite(dataset, H5T_NATIVE_DOUBLE, memorySpace, space, H5P_DEFAULT, data), "H5Dwrite", outputPath);
+        CheckHdf5(H5Sclose(memorySpace), "H5Sclose", outputPath);
+        CheckHdf5(H5Sclose(space), "H5Sclose", outputPath);
+        CheckHdf5(H5Dclose(dataset), "H5Dclose", outputPath);
+    };
+    append("time", {numberTimes}, timeHistory.data());
+    append("values", {numberTimes, (hsize_t)numberProbes, (hsize_t)numberVariables}, buffer.data());
+    CheckHdf5(H5Fclose(file), "H5Fclose", outputPath);
+
+    activeIndex = -1;
+    return (std::size_t)numberTimes * (1 + numberProbes * numberVariables) * sizeof(double);
+}
+
+void ablate::monitors::Probes::ConvertToCsv(const std::filesystem::path &probeFile, const std::filesystem::path &directory) {
+    hid_t file = H5Fopen(probeFile.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if (file < 0) {
+        throw std::invalid_argument("Unable to open probe file " + probeFile.string());
+    }
+
+    // read the comma separated names and values
+    const auto probeNames = ReadNames(file, "probes", probeFile);
+    const auto variables = ReadNames(file, "variables", probeFile);
+    const auto times = ReadDataset(file, "time", probeFile);
+    const auto values = ReadDataset(file, "values", probeFile);
+    CheckHdf5(H5Fclose(file), "H5Fclose", probeFile);
+    if (values.size() != times.size() * probeNames.size() * variables.size()) {
+        throw std::invalid_argument("The values in probe file " + probeFile.string() + " do not match the probes and variables");
+    }
+
+    // write a csv file per probe
+    for (std::size_t p = 0; p < probeNames.size(); p++) {
+        std::ofstream probeCsv(directory / (probeNames[p] + ".csv"));
+        probeCsv << "time,";
+        for (const auto &variable : variables) {
+            probeCsv << variable << ",";
+        }
+        probeCsv << std::endl;
+        for (std::size_t t = 0; t < times.size(); t++) {
+            probeCsv << times[t] << ",";
+            for (std::size_t v = 0; v < variables.size(); v++) {
+                probeCsv << values[(t * probeNames.size() + p) * variables.size() + v] << ",";
+            }
+            probeCsv << "\n";
+        }
+    }
 }
 
 #include "registrar.hpp"
 REGISTER(ablate::monitors::Monitor, ablate::monitors::Probes, "Records the values of the specified variables at a specific point in space",
          ARG(ablate::monitors::probes::ProbeInitializer, "probes", "where to record log (default is stdout)"), ARG(std::vector<std::string>, "variables", "list of variables to output"),
-         OPT(ablate::io::interval::Interval, "interval", "report interval object, defaults to every"), OPT(int, "bufferSize", "how often the probe file is written (default is 100, must be > 0)"));
+         OPT(ablate::io::interval::Interval, "interval", "report interval object, defaults to every"), OPT(int, "bufferSize", "how often the probe file is written (default is 100, must be > 0)"),
+         OPT(bool, "binary", "write all probes on each rank to a single hdf5 file (probes.rank.h5) with an extendable time dimension instead of a csv file per probe (default is false)"));
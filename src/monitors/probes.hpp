@@ -1,8 +1,10 @@
 #ifndef ABLATELIBRARY_PROBES_HPP
 #define ABLATELIBRARY_PROBES_HPP
 
+#include <memory>
 #include <utility>
 #include "io/interval/interval.hpp"
+#include "io/ioTelemetry.hpp"
 #include "monitor.hpp"
 #include "probes/probe.hpp"
 #include "probes/probeInitializer.hpp"
@@ -37,13 +39,17 @@ class Probes : public Monitor {
         //! store the time history
         std::vector<double> timeHistory;
 
+        //! record the time and bytes of each buffer write
+        std::shared_ptr<io::IoTelemetry> telemetry;
+
        public:
         /**
          * List of variables to output in the order that they will be set
          * @param bufferSize
          * @param variables
+         * @param telemetry optional telemetry used to record each buffer write
          */
-        ProbeRecorder(int bufferSize, const std::vector<std::string>& variables, const std::filesystem::path& outputPath);
+        ProbeRecorder(int bufferSize, const std::vector<std::string>& variables, const std::filesystem::path& outputPath, std::shared_ptr<io::IoTelemetry> telemetry = {});
 
         /**
          * Catch close and output the buffer
@@ -64,8 +70,77 @@ class Probes : public Monitor {
 
         /**
          * Writes and resets the buffer
+         * @return the number of bytes written
          */
-        void WriteBuffer();
+        std::size_t WriteBuffer();
+    };
+
+    /**
+     * Private class for recording every local probe to a single hdf5 file with an extendable time dimension
+     */
+    class Hdf5ProbeRecorder {
+       private:
+        //! The amount of data to store before writing
+        const int bufferSize;
+
+        //! The output path for the hdf5 file
+        std::filesystem::path outputPath;
+
+        //! the size of each time entry
+        const std::size_t numberProbes;
+        const std::size_t numberVariables;
+
+        //! The last output, useful for restart
+        PetscReal lastOutputTime = PETSC_MIN_REAL;
+
+        //! The current location in the buffer to record
+        int activeIndex = -1;
+
+        //! store the output buffer [buffer][probe][variables]
+        std::vector<double> buffer;
+
+        //! store the time history
+        std::vector<double> timeHistory;
+
+        //! record the time and bytes of each buffer write
+        std::shared_ptr<io::IoTelemetry> telemetry;
+
+       public:
+        /**
+         * @param bufferSize
+         * @param probeNames the names of each local probe
+         * @param variables the names of each variable component
+         * @param outputPath
+         * @param telemetry optional telemetry used to record each buffer write
+         */
+        Hdf5ProbeRecorder(int bufferSize, const std::vector<std::string>& probeNames, const std::vector<std::string>& variables, std::filesystem::path outputPath,
+                          std::shared_ptr<io::IoTelemetry> telemetry = {});
+
+        /**
+         * Catch close and output the buffer
+         */
+        ~Hdf5ProbeRecorder();
+
+        /**
+         * Advance and record the next time.  Output the buffer if needed
+         * @param time
+         */
+        void AdvanceTime(double time);
+
+        /**
+         * Record the value for a probe at the current time
+         */
+        inline void SetValue(std::size_t probe, std::size_t index, double value) {
+            if (activeIndex >= 0) {
+                buffer[(activeIndex * numberProbes + probe) * numberVariables + index] = value;
+            }
+        }
+
+        /**
+         * Appends the buffer to the file and resets the buffer
+         * @return the number of bytes written
+         */
+        std::size_t WriteBuffer();
     };
 
     //! Original list of all requested probe locations by name
@@ -80,23 +155,44 @@ class Probes : public Monitor {
     //!  output bufferSize
     const int bufferSize;
 
+    //! write all local probes to a single hdf5 file instead of a csv file per probe
+    const bool binary;
+
     //! list of local probes on this rank
     std::vector<probes::Probe> localProbes;
 
+    //! the owned cell containing each local probe, used to read the fvm fields directly without interpolation
+    std::vector<PetscInt> localProbeCells;
+
     //! list of fields to interpolate
     std::vector<domain::Field> fields;
 
     //! store the offset for the field in the output (needed for multiple components)
     std::vector<int> fieldOffset;
 
-    //! list of petsc intepolants
+    //! list of petsc intepolants, only needed for the fem fields (nullptr for fvm fields)
     std::vector<DMInterpolationInfo> interpolants;
 
     //! list of probe recorders that goe
     std::vector<ProbeRecorder> recorders;
 
+    //! the single recorder for all local probes when using binary output
+    std::unique_ptr<Hdf5ProbeRecorder> hdf5Recorder;
+
+    //! record the time and bytes of the probe writes on this rank
+    std::shared_ptr<io::IoTelemetry> telemetry;
+
     static PetscErrorCode UpdateProbes(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
 
+    //! record the value for a local probe with the active recorder
+    inline void SetProbeValue(std::size_t probe, std::size_t index, double value) {
+        if (hdf5Recorder) {
+            hdf5Recorder->SetValue(probe, index, value);
+        } else {
+            recorders[probe].SetValue(index, value);
+        }
+    }
+
    public:
     /**
      * Probes monitor
@@ -104,9 +200,10 @@ class Probes : public Monitor {
      * @param variables a list of output variables
      * @param bufferSize the buffer size between writes
      * @param interval the sampling interval
+     * @param binary write all local probes to a single hdf5 file instead of a csv file per probe
      */
     Probes(const std::shared_ptr<ablate::monitors::probes::ProbeInitializer>&, std::vector<std::string> variableNames, const std::shared_ptr<io::interval::Interval>& interval = {},
-           const int bufferSize = 0);
+           const int bufferSize = 0, bool binary = false);
 
     ~Probes() override;
 
@@ -121,6 +218,13 @@ class Probes : public Monitor {
      * @return
      */
     PetscMonitorFunction GetPetscFunction() override { return UpdateProbes; }
+
+    /**
+     * Converts a binary probe file into a csv file per probe in the same format as the csv output
+     * @param probeFile the hdf5 probe file
+     * @param directory the directory for the csv files
+     */
+    static void ConvertToCsv(const std::filesystem::path& probeFile, const std::filesystem::path& directory);
 };
 
 }  // namespace ablate::monitors
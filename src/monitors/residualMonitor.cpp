@@ -0,0 +1,68 @@
+#include "residualMonitor.hpp"
+#include "io/interval/fixedInterval.hpp"
+#include "monitors/logs/stdOut.hpp"
+#include "utilities/petscError.hpp"
+
+ablate::monitors::ResidualMonitor::ResidualMonitor(std::shared_ptr<logs::Log> logIn, std::shared_ptr<io::interval::Interval> intervalIn, double relativeTolerance, double absoluteTolerance)
+    : log(logIn ? logIn : std::make_shared<logs::StdOut>()),
+      interval(intervalIn ? intervalIn : std::make_shared<io::interval::FixedInterval>()),
+      relativeTolerance(relativeTolerance),
+      absoluteTolerance(absoluteTolerance) {}
+
+ablate::monitors::ResidualMonitor::~ResidualMonitor() {
+    if (previousSolution) {
+        VecDestroy(&previousSolution) >> checkError;
+    }
+}
+
+PetscErrorCode ablate::monitors::ResidualMonitor::MonitorResidual(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
+    PetscFunctionBeginUser;
+    auto monitor = (ablate::monitors::ResidualMonitor*)ctx;
+
+    if (!monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
+        PetscFunctionReturn(0);
+    }
+
+    // if this is the first time step init the log
+    if (!monitor->log->Initialized()) {
+        monitor->log->Initialize(PetscObjectComm((PetscObject)ts));
+    }
+
+    // the first check only stores the solution
+    if (!monitor->previousSolution) {
+        PetscCall(VecDuplicate(u, &monitor->previousSolution));
+        PetscCall(VecCopy(u, monitor->previousSolution));
+        monitor->previousTime = crtime;
+        PetscFunctionReturn(0);
+    }
+    if (crtime <= monitor->previousTime) {
+        PetscFunctionReturn(0);
+    }
+
+    // compute the rate of change since the last check
+    PetscReal norm;
+    PetscCall(VecAXPY(monitor->previousSolution, -1.0, u));
+    PetscCall(VecNorm(monitor->previousSolution, NORM_2, &norm));
+    const PetscReal residual = norm / (crtime - monitor->previousTime);
+    PetscCall(VecCopy(u, monitor->previousSolution));
+    monitor->previousTime = crtime;
+
+    if (monitor->initialResidual < 0) {
+        monitor->initialResidual = residual;
+    }
+    const PetscReal relativeResidual = monitor->initialResidual > 0 ? residual / monitor->initialResidual : 0.0;
+    monitor->log->Printf("Residual: %04d time = %-8.4g |du/dt| = %g relative = %g\n", (int)step, (double)crtime, (double)residual, (double)relativeResidual);
+
+    // stop the time stepper if converged
+    if ((monitor->absoluteTolerance > 0 && residual < monitor->absoluteTolerance) || (monitor->relativeTolerance > 0 && relativeResidual < monitor->relativeTolerance)) {
+        monitor->log->Printf("Residual converged at step %d\n", (int)step);
+        PetscCall(TSSetConvergedReason(ts, TS_CONVERGED_USER));
+    }
+    PetscFunctionReturn(0);
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::monitors::Monitor, ablate::monitors::ResidualMonitor, "Reports the rate of change of the solution and optionally stops the time stepper once it has converged",
+         OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"), OPT(ablate::io::interval::Interval, "interval", "report interval object, defaults to every"),
+         OPT(double, "relativeTolerance", "stop once the residual relative to the first residual is below this value (default is to never stop)"),
+         OPT(double, "absoluteTolerance", "stop once the residual is below this value (default is to never stop)"));
@@ -0,0 +1,42 @@
+#ifndef ABLATELIBRARY_RESIDUALMONITOR_HPP
+#define ABLATELIBRARY_RESIDUALMONITOR_HPP
+
+#include <memory>
+#include "io/interval/interval.hpp"
+#include "monitor.hpp"
+#include "monitors/logs/log.hpp"
+
+namespace ablate::monitors {
+
+/**
+ * Reports the rate of change of the solution, |u - u_prev| / (t - t_prev), and optionally stops the time stepper once it has converged.  This is intended
+ * for steady state (pseudo transient) runs, i.e. with local time stepping.
+ */
+class ResidualMonitor : public Monitor {
+   private:
+    static PetscErrorCode MonitorResidual(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
+    const std::shared_ptr<logs::Log> log;
+    const std::shared_ptr<io::interval::Interval> interval;
+
+    //! stop once the residual relative to the first residual is below this value (ignored if zero)
+    const PetscReal relativeTolerance;
+
+    //! stop once the residual is below this value (ignored if zero)
+    const PetscReal absoluteTolerance;
+
+    //! the solution and time at the last check
+    Vec previousSolution = nullptr;
+    PetscReal previousTime = 0.0;
+
+    //! the first computed residual used for the relative tolerance
+    PetscReal initialResidual = -1.0;
+
+   public:
+    explicit ResidualMonitor(std::shared_ptr<logs::Log> log = {}, std::shared_ptr<io::interval::Interval> interval = {}, double relativeTolerance = {}, double absoluteTolerance = {});
+    ~ResidualMonitor() override;
+
+    PetscMonitorFunction GetPetscFunction() override { return MonitorResidual; }
+};
+
+}  // namespace ablate::monitors
+#endif  // ABLATELIBRARY_RESIDUALMONITOR_HPP
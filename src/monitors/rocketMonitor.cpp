@@ -1,6 +1,7 @@
 #include "rocketMonitor.hpp"
 #include <utilities/mpiError.hpp>
 #include <utilities/petscError.hpp>
+#include <set>
 #include <utility>
 #include "io/interval/fixedInterval.hpp"
 #include "monitor.hpp"
@@ -26,114 +27,161 @@ void ablate::monitors::RocketMonitor::Register(std::shared_ptr<solver::Solver> s
     }
 }
 
+void ablate::monitors::RocketMonitor::ComputeBoundaryFaces() {
+    auto dm = GetSolver()->GetSubDomain().GetDM();
+
+    // check to see if there is a ghost label
+    DMLabel ghostLabel;
+    DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
+
+    // cells shared from another rank are not owned, so they are only counted by the owning rank
+    PetscSF pointSF;
+    PetscInt numberLeaves;
+    const PetscInt* leaves = nullptr;
+    DMGetPointSF(dm, &pointSF) >> checkError;
+    PetscSFGetGraph(pointSF, nullptr, &numberLeaves, &leaves, nullptr) >> checkError;
+    std::set<PetscInt> sharedPoints;
+    for (PetscInt l = 0; l < PetscMax(numberLeaves, 0); ++l) {
+        sharedPoints.insert(leaves ? leaves[l] : l);
+    }
+
+    Vec faceGeomVec;
+    Vec cellGeomVec;
+    DMPlexComputeGeometryFVM(dm, &cellGeomVec, &faceGeomVec) >> checkError;
+    DM faceDM;
+    VecGetDM(faceGeomVec, &faceDM) >> checkError;
+    const PetscScalar* faceGeomArray;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+
+    // find all faces
+    PetscInt fStart, fEnd;
+    DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> checkError;
+
+    // need to look for faces at specified fieldBoundary then find cells bordering those faces which are in specified region
+    boundaryFaces.clear();
+    for (PetscInt face = fStart; face < fEnd; ++face) {                   // Iterate through all faces to check if in fieldBoundary
+        if (ablate::domain::Region::InRegion(fieldBoundary, dm, face)) {  // Check if each face is in fieldBoundary
+            PetscFVFaceGeom* fg;
+            DMPlexPointLocalRead(faceDM, face, faceGeomArray, &fg) >> checkError;  // read face geometry for face
+
+            PetscInt numberNeighborCells;
+            const PetscInt* neighborCells;
+            DMPlexGetSupportSize(dm, face, &numberNeighborCells) >> ablate::checkError;
+            DMPlexGetSupport(dm, face, &neighborCells) >> ablate::checkError;
+            for (PetscInt n = 0; n < numberNeighborCells; n++) {
+                // Make sure that we are not working with a ghost cell
+                PetscInt ghost = -1;
+                if (ghostLabel) {
+                    DMLabelGetValue(ghostLabel, neighborCells[n], &ghost) >> checkError;
+                }
+                if (ghost >= 0 || sharedPoints.count(neighborCells[n])) {
+                    continue;
+                }
+
+                if (ablate::domain::Region::InRegion(region, dm, neighborCells[n])) {  // check if cell is in region
+                    boundaryFaces.push_back(BoundaryFace{.cell = neighborCells[n], .normal = {fg->normal[0], fg->normal[1], fg->normal[2]}});
+                }
+            }
+        }
+    }
+
+    // cleanup
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+    VecDestroy(&cellGeomVec) >> checkError;
+    VecDestroy(&faceGeomVec) >> checkError;
+    boundaryFacesComputed = true;
+}
+
 PetscErrorCode ablate::monitors::RocketMonitor::OutputRocket(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
     PetscFunctionBeginUser;
     auto monitor = (ablate::monitors::RocketMonitor*)ctx;
 
     if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
-        auto dm = monitor->GetSolver()->GetSubDomain().GetDM();      // get the dm
-        auto solDM = monitor->GetSolver()->GetSubDomain().GetDM();   // get the sol dm
-        auto comm = monitor->GetSolver()->GetSubDomain().GetComm();  // The communicator in which the reduction takes place.
+        auto& subDomain = monitor->GetSolver()->GetSubDomain();
+        auto solDM = subDomain.GetDM();   // get the sol dm
+        auto comm = subDomain.GetComm();  // The communicator in which the reduction takes place.
+
+        // The boundary cells and face normals do not change, so they are only found once
+        if (!monitor->boundaryFacesComputed) {
+            try {
+                monitor->ComputeBoundaryFaces();
+            } catch (std::exception& exception) {
+                SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+            }
+        }
 
         PetscInt dim;
-        DMGetDimension(dm, &dim);           // get the dimensions of the dm
-        PetscMPIInt bufferSize;             // initialize buffer size
-        PetscMPIIntCast(dim, &bufferSize);  // define the number of elements in buffer
-        // check to see if there is a ghost label
-        DMLabel ghostLabel;
-        DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
-
-        const auto& fieldEuler = monitor->GetSolver()->GetSubDomain().GetField("euler");  // get the euler field
-        PetscReal* cellEuler;
-        PetscReal* conservedValues;
-        PetscReal cellPressure;
+        PetscCall(DMGetDimension(solDM, &dim));  // get the dimensions of the dm
 
-        const auto auxVec = monitor->GetSolver()->GetSubDomain().GetAuxVector();
-        const PetscScalar* auxArray;
-        VecGetArrayRead(auxVec, &auxArray);
-        const auto solVec = monitor->GetSolver()->GetSubDomain().GetSolutionVector();
-        const PetscScalar* solArray;
-        VecGetArrayRead(solVec, &solArray);
+        const auto& fieldEuler = subDomain.GetField("euler");  // get the euler field
+        const PetscReal* cellEuler;
+        const PetscReal* conservedValues;
+        PetscReal cellPressure;
 
-        Vec faceGeomVec;
-        Vec cellGeomVec;
-        DMPlexComputeGeometryFVM(dm, &cellGeomVec, &faceGeomVec) >> checkError;
-        DM faceDM;
-        DM cellDM;
+        // use the pressure already computed by the flow solver when available instead of the eos
+        const domain::Field* pressureField = nullptr;
+        if (subDomain.ContainsField(finiteVolume::CompressibleFlowFields::PRESSURE_FIELD)) {
+            pressureField = &subDomain.GetField(finiteVolume::CompressibleFlowFields::PRESSURE_FIELD);
+            if (pressureField->location != domain::FieldLocation::AUX) {
+                pressureField = nullptr;
+            }
+        }
 
-        VecGetDM(faceGeomVec, &faceDM) >> checkError;
-        const PetscScalar* faceGeomArray;
-        VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
-        VecGetDM(cellGeomVec, &cellDM) >> checkError;
-        const PetscScalar* cellGeomArray;
-        VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+        const auto auxVec = subDomain.GetAuxVector();
+        const PetscScalar* auxArray = nullptr;
+        if (pressureField) {
+            PetscCall(VecGetArrayRead(auxVec, &auxArray));
+        }
+        const auto solVec = subDomain.GetSolutionVector();
+        const PetscScalar* solArray;
+        PetscCall(VecGetArrayRead(solVec, &solArray));
 
         PetscReal tol = 1e-3;
 
-        // initialize vectors (send_buffer)
+        // initialize vectors (send_buffer), the mass flow rate followed by the thrust
         PetscReal mDotCell[3] = {0, 0, 0};
-        PetscReal mDotTotal[3] = {0, 0, 0};
         PetscReal thrustCell[3] = {0, 0, 0};
-        PetscReal thrustTotal[3] = {0, 0, 0};
+        PetscReal totals[6] = {0, 0, 0, 0, 0, 0};
+        PetscReal* mDotTotal = totals;
+        PetscReal* thrustTotal = totals + 3;
 
         // initialize global vectors (receive_buffer)
-        PetscReal mDotTotalGlob[3] = {0, 0, 0};
-        PetscReal thrustTotalGlob[3] = {0, 0, 0};
+        PetscReal totalsGlob[6] = {0, 0, 0, 0, 0, 0};
+        const PetscReal* mDotTotalGlob = totalsGlob;
+        const PetscReal* thrustTotalGlob = totalsGlob + 3;
         PetscReal IspGlob[3] = {0, 0, 0};
 
-        // find all faces
-        PetscInt fStart, fEnd;
-        DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> checkError;
-
         /** Get the current rank associated with this process */
         PetscMPIInt rank;
-        MPI_Comm_rank(MPI_COMM_WORLD, &rank);  //!< Get the origin rank of the current process. The particle belongs to this rank. The rank only needs to be read once.
-
-        // need to look for faces at specified fieldBoundary then find cells bordering those faces which are in specified region
-        for (PetscInt face = fStart; face < fEnd; ++face) {                            // Iterate through all faces to check if in fieldBoundary
-            if (ablate::domain::Region::InRegion(monitor->fieldBoundary, dm, face)) {  // Check if each face is in fieldBoundary
-                PetscFVFaceGeom* fg;
-                DMPlexPointLocalRead(faceDM, face, faceGeomArray, &fg) >> checkError;  // read face geometry for face
-
-                PetscInt numberNeighborCells;
-                const PetscInt* neighborCells;
-                DMPlexGetSupportSize(dm, face, &numberNeighborCells) >> ablate::checkError;
-                DMPlexGetSupport(dm, face, &neighborCells) >> ablate::checkError;
-                for (PetscInt n = 0; n < numberNeighborCells; n++) {
-                    // Make sure that we are not working with a ghost cell
-                    PetscInt ghost = -1;
-                    if (ghostLabel) {
-                        DMLabelGetValue(ghostLabel, neighborCells[n], &ghost);
-                    }
-                    if (ghost >= 0) {
-                        continue;
-                    }
-
-                    if (ablate::domain::Region::InRegion(monitor->region, dm, neighborCells[n])) {  // check if cell is in region
-
-                        DMPlexPointLocalRead(solDM, neighborCells[n], solArray, &conservedValues);                                  // Retrieve conserved values from cell
-                        monitor->computePressure.function(conservedValues, &cellPressure, monitor->computePressure.context.get());  // Retrieve pressure from cell
-                        DMPlexPointLocalFieldRead(solDM, neighborCells[n], fieldEuler.id, solArray, &cellEuler);                    // retrieve euler field for density, density*velocity
-
-                        for (PetscInt d = 0; d < dim; d++) {
-                            mDotCell[d] = fg->normal[d] * cellEuler[finiteVolume::CompressibleFlowFields::RHOU + d];  // calculate mass flow rate for the cell
-                            mDotTotal[d] = mDotTotal[d] + mDotCell[d];                                                // summation of total mass flow rate along fieldBoundary
-                            if (abs(mDotCell[d]) > tol) {
-                                thrustCell[d] = (mDotCell[d]) * ((cellEuler[finiteVolume::CompressibleFlowFields::RHOU + d]) / (cellEuler[finiteVolume::CompressibleFlowFields::RHO])) +
-                                                (fg->normal[d]) * (cellPressure - monitor->referencePressure);  // calculate thrust for the cell
-                            } else {
-                                thrustCell[d] = (fg->normal[d]) * (cellPressure - 101325);  // calculate thrust for the cell
-                            };
-                            thrustTotal[d] = thrustTotal[d] + thrustCell[d];  // summation of total trust along fieldBoundary
-                        }
-                    }
-                }
+        PetscCallMPI(MPI_Comm_rank(comm, &rank));
+
+        // only the owned cells next to the fieldBoundary are visited
+        for (const auto& boundaryFace : monitor->boundaryFaces) {
+            PetscCall(DMPlexPointGlobalFieldRead(solDM, boundaryFace.cell, fieldEuler.id, solArray, &cellEuler));  // retrieve euler field for density, density*velocity
+            if (pressureField) {
+                const PetscScalar* pressure;
+                PetscCall(DMPlexPointLocalFieldRead(subDomain.GetAuxDM(), boundaryFace.cell, pressureField->id, auxArray, &pressure));
+                cellPressure = pressure[0];
+            } else {
+                PetscCall(DMPlexPointGlobalRead(solDM, boundaryFace.cell, solArray, &conservedValues));                     // Retrieve conserved values from cell
+                monitor->computePressure.function(conservedValues, &cellPressure, monitor->computePressure.context.get());  // Retrieve pressure from cell
+            }
+
+            for (PetscInt d = 0; d < dim; d++) {
+                mDotCell[d] = boundaryFace.normal[d] * cellEuler[finiteVolume::CompressibleFlowFields::RHOU + d];  // calculate mass flow rate for the cell
+                mDotTotal[d] = mDotTotal[d] + mDotCell[d];                                                         // summation of total mass flow rate along fieldBoundary
+                if (abs(mDotCell[d]) > tol) {
+                    thrustCell[d] = (mDotCell[d]) * ((cellEuler[finiteVolume::CompressibleFlowFields::RHOU + d]) / (cellEuler[finiteVolume::CompressibleFlowFields::RHO])) +
+                                    (boundaryFace.normal[d]) * (cellPressure - monitor->referencePressure);  // calculate thrust for the cell
+                } else {
+                    thrustCell[d] = (boundaryFace.normal[d]) * (cellPressure - 101325);  // calculate thrust for the cell
+                };
+                thrustTotal[d] = thrustTotal[d] + thrustCell[d];  // summation of total trust along fieldBoundary
             }
         }
 
-        // Take across all ranks
-        MPI_Reduce(mDotTotal, mDotTotalGlob, bufferSize, MPI_DOUBLE, MPI_SUM, 0, comm);
-        MPI_Reduce(thrustTotal, thrustTotalGlob, bufferSize, MPI_DOUBLE, MPI_SUM, 0, comm);
+        // Take across all ranks in a single reduction
+        PetscCallMPI(MPI_Reduce(totals, totalsGlob, 6, MPIU_REAL, MPIU_SUM, 0, comm));
 
         for (PetscInt d = 0; d < dim; d++) {
             if (tol < abs(thrustTotalGlob[d]) && 1e-2 < abs(mDotTotalGlob[d])) {  // avoid nan or dividing to near zero numbers
@@ -142,23 +190,19 @@ PetscErrorCode ablate::monitors::RocketMonitor::OutputRocket(TS ts, PetscInt ste
         }
 
         if (rank == 0) {
-            if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
-                if (monitor->name != "") {  // If user passed a name argument then output name
-                    monitor->log->Printf("%s ", monitor->name.c_str());
-                }
-                monitor->log->Printf("RocketMonitor for timestep %04d: time: %-8.4g\n", (int)step, (double)crtime);
-                monitor->log->Printf("\tThrust:\t [ %1.7f, %1.7f, %1.7f]\n", thrustTotalGlob[0], thrustTotalGlob[1], thrustTotalGlob[2]);
-                monitor->log->Printf("\tIsp:\t [ %1.7f, %1.7f, %1.7f]\n", IspGlob[0], IspGlob[1], IspGlob[2]);
+            if (monitor->name != "") {  // If user passed a name argument then output name
+                monitor->log->Printf("%s ", monitor->name.c_str());
             }
+            monitor->log->Printf("RocketMonitor for timestep %04d: time: %-8.4g\n", (int)step, (double)crtime);
+            monitor->log->Printf("\tThrust:\t [ %1.7f, %1.7f, %1.7f]\n", thrustTotalGlob[0], thrustTotalGlob[1], thrustTotalGlob[2]);
+            monitor->log->Printf("\tIsp:\t [ %1.7f, %1.7f, %1.7f]\n", IspGlob[0], IspGlob[1], IspGlob[2]);
         }
 
         // cleanup
-        VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
-        VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
-        VecDestroy(&cellGeomVec) >> checkError;
-        VecDestroy(&faceGeomVec) >> checkError;
-        VecRestoreArrayRead(auxVec, &auxArray) >> checkError;
-        VecRestoreArrayRead(solVec, &solArray) >> checkError;
+        if (auxArray) {
+            PetscCall(VecRestoreArrayRead(auxVec, &auxArray));
+        }
+        PetscCall(VecRestoreArrayRead(solVec, &solArray));
     }
     PetscFunctionReturn(0);
 }
@@ -2,6 +2,8 @@
 #define ABLATELIBRARY_ROCKETMONITOR_HPP
 
 #include <petsc.h>
+#include <array>
+#include <vector>
 #include "domain/region.hpp"
 #include "domain/subDomain.hpp"
 #include "eos/eos.hpp"
@@ -26,6 +28,21 @@ class RocketMonitor : public Monitor {
     const std::shared_ptr<io::interval::Interval> interval;
     double referencePressure;
 
+    /**
+     * The owned cell in the region next to each fieldBoundary face and the face normal, computed once on the first output
+     */
+    struct BoundaryFace {
+        PetscInt cell;
+        std::array<PetscReal, 3> normal;
+    };
+    std::vector<BoundaryFace> boundaryFaces;
+    bool boundaryFacesComputed = false;
+
+    /**
+     * Find the owned cells next to the fieldBoundary faces so only those cells are visited each output
+     */
+    void ComputeBoundaryFaces();
+
    public:
     RocketMonitor(const std::string name, std::shared_ptr<domain::Region> region, std::shared_ptr<domain::Region> fieldBoundary, std::shared_ptr<eos::EOS> eos,
                   const std::shared_ptr<logs::Log>& log = {}, const std::shared_ptr<io::interval::Interval>& interval = {}, double referencePressure = {});
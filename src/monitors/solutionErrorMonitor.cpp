@@ -1,11 +1,12 @@
 #include "solutionErrorMonitor.hpp"
 #include <monitors/logs/stdOut.hpp>
+#include <utilities/mpiError.hpp>
 #include <utilities/petscError.hpp>
 #include "mathFunctions/mathFunction.hpp"
 
 ablate::monitors::SolutionErrorMonitor::SolutionErrorMonitor(ablate::monitors::SolutionErrorMonitor::Scope errorScope, ablate::monitors::SolutionErrorMonitor::Norm normType,
-                                                             std::shared_ptr<logs::Log> logIn)
-    : errorScope(errorScope), normType(normType), log(logIn ? logIn : std::make_shared<logs::StdOut>()) {}
+                                                             std::shared_ptr<logs::Log> logIn, int sampleStride)
+    : errorScope(errorScope), normType(normType), log(logIn ? logIn : std::make_shared<logs::StdOut>()), sampleStride(sampleStride > 1 ? sampleStride : 1) {}
 
 PetscErrorCode ablate::monitors::SolutionErrorMonitor::MonitorError(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx) {
     PetscFunctionBeginUser;
@@ -40,9 +41,20 @@ PetscErrorCode ablate::monitors::SolutionErrorMonitor::MonitorError(TS ts, Petsc
         errorMonitor->log->Initialize(PetscObjectComm((PetscObject)dm));
     }
 
+    // the error is only sampled before the final step
+    TSConvergedReason reason;
+    ierr = TSGetConvergedReason(ts, &reason);
+    CHKERRQ(ierr);
+    const bool sampled = errorMonitor->sampleStride > 1 && reason == TS_CONVERGED_ITERATING;
+
     std::vector<PetscReal> ferrors;
+    std::vector<PetscReal> confidence;
     try {
-        ferrors = errorMonitor->ComputeError(ts, crtime, u);
+        if (sampled) {
+            ferrors = errorMonitor->ComputeSampledError(ts, crtime, u, errorMonitor->sampleCount++ % errorMonitor->sampleStride, confidence);
+        } else {
+            ferrors = errorMonitor->ComputeError(ts, crtime, u);
+        }
     } catch (std::exception& exception) {
         SETERRQ(PetscObjectComm((PetscObject)dm), PETSC_ERR_LIB, "%s", exception.what());
     }
@@ -50,12 +62,18 @@ PetscErrorCode ablate::monitors::SolutionErrorMonitor::MonitorError(TS ts, Petsc
     // get the error type
     std::stringstream errorTypeStream;
     errorTypeStream << errorMonitor->normType;
+    if (sampled) {
+        errorTypeStream << " (sampled 1/" << errorMonitor->sampleStride << ")";
+    }
     auto errorTypeName = errorTypeStream.str();
     // Change the output depending upon type
     switch (errorMonitor->errorScope) {
         case Scope::VECTOR:
             errorMonitor->log->Printf("Timestep: %04d time = %-8.4g \t %s", (int)step, (double)crtime, errorTypeName.c_str());
             errorMonitor->log->Print("error", ferrors, "%2.3g");
+            if (sampled) {
+                errorMonitor->log->Print(" relative 95% confidence", confidence, "%2.3g");
+            }
             errorMonitor->log->Print("\n");
             break;
         case Scope::COMPONENT: {
@@ -70,6 +88,9 @@ PetscErrorCode ablate::monitors::SolutionErrorMonitor::MonitorError(TS ts, Petsc
 
                 errorMonitor->log->Print("\t ");
                 errorMonitor->log->Print(name, numberComponentsPerField[f], &ferrors[fieldOffset], "%2.3g");
+                if (sampled) {
+                    errorMonitor->log->Print(" relative 95% confidence", numberComponentsPerField[f], &confidence[fieldOffset], "%2.3g");
+                }
                 errorMonitor->log->Print("\n");
                 fieldOffset += numberComponentsPerField[f];
             }
@@ -168,6 +189,134 @@ std::vector<PetscReal> ablate::monitors::SolutionErrorMonitor::ComputeError(TS t
     return ferrors;
 }
 
+std::vector<PetscReal> ablate::monitors::SolutionErrorMonitor::ComputeSampledError(TS ts, PetscReal time, Vec u, PetscInt offset, std::vector<PetscReal>& confidence) {
+    DM dm;
+    PetscDS ds;
+    TSGetDM(ts, &dm) >> checkError;
+    DMGetDS(dm, &ds) >> checkError;
+    PetscInt dim;
+    DMGetDimension(dm, &dim) >> checkError;
+
+    // Get the number of fields
+    PetscInt numberOfFields;
+    PetscDSGetNumFields(ds, &numberOfFields) >> checkError;
+    PetscInt* numberComponentsPerField;
+    PetscDSGetComponents(ds, &numberComponentsPerField) >> checkError;
+
+    // Get the exact funcs and context, the exact solution is evaluated at the cell centroid so only FVM fields are supported
+    PetscInt totalComponents = 0;
+    std::vector<ablate::mathFunctions::PetscFunction> exactFuncs(numberOfFields);
+    std::vector<void*> exactCtxs(numberOfFields);
+    for (auto f = 0; f < numberOfFields; ++f) {
+        PetscDSGetExactSolution(ds, f, &exactFuncs[f], &exactCtxs[f]) >> checkError;
+        if (!exactFuncs[f]) {
+            throw std::invalid_argument("The exact solution has not set");
+        }
+        PetscObject field;
+        PetscClassId fieldClassId;
+        DMGetField(dm, f, nullptr, &field) >> checkError;
+        PetscObjectGetClassId(field, &fieldClassId) >> checkError;
+        if (fieldClassId != PETSCFV_CLASSID) {
+            throw std::invalid_argument("The sampled SolutionErrorMonitor only supports FVM fields");
+        }
+        totalComponents += numberComponentsPerField[f];
+    }
+
+    // If we treat this as a single vector or multiple components change how this is done
+    const PetscInt numberErrors = errorScope == Scope::VECTOR ? 1 : totalComponents;
+    const bool squared = normType == Norm::L2 || normType == Norm::L2_NORM;
+
+    // Accumulate the sum of the error measure (|e| or e^2), its square, and the max |e| for every sampled value
+    std::vector<PetscReal> sums(2 * numberErrors + 1, 0.0);
+    std::vector<PetscReal> maxima(numberErrors, 0.0);
+
+    Vec cellGeomVec;
+    DM cellGeomDM;
+    DMPlexGetGeometryFVM(dm, nullptr, &cellGeomVec, nullptr) >> checkError;
+    VecGetDM(cellGeomVec, &cellGeomDM) >> checkError;
+    const PetscScalar* cellGeomArray;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+    const PetscScalar* uArray;
+    VecGetArrayRead(u, &uArray) >> checkError;
+
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+    std::vector<PetscScalar> exact(totalComponents);
+    for (PetscInt c = cStart + offset; c < cEnd; c += sampleStride) {
+        PetscFVCellGeom* cellGeom;
+        DMPlexPointLocalRead(cellGeomDM, c, cellGeomArray, &cellGeom) >> checkError;
+
+        PetscInt fieldOffset = 0;
+        for (PetscInt f = 0; f < numberOfFields; ++f) {
+            // ghost and non owned cells are not in the global vector
+            const PetscScalar* values = nullptr;
+            DMPlexPointGlobalFieldRead(dm, c, f, uArray, &values) >> checkError;
+            if (values) {
+                exactFuncs[f](dim, time, cellGeom->centroid, numberComponentsPerField[f], exact.data(), exactCtxs[f]) >> checkError;
+                for (PetscInt p = 0; p < numberComponentsPerField[f]; ++p) {
+                    const PetscReal error = PetscAbsScalar(exact[p] - values[p]);
+                    const PetscReal measure = squared ? error * error : error;
+                    const PetscInt e = errorScope == Scope::VECTOR ? 0 : fieldOffset + p;
+                    sums[e] += measure;
+                    sums[numberErrors + e] += measure * measure;
+                    maxima[e] = PetscMax(maxima[e], error);
+                }
+                sums[2 * numberErrors] += errorScope == Scope::VECTOR ? numberComponentsPerField[f] : (f == 0 ? 1.0 : 0.0);
+            }
+            fieldOffset += numberComponentsPerField[f];
+        }
+    }
+    VecRestoreArrayRead(u, &uArray) >> checkError;
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+
+    MPI_Comm comm = PetscObjectComm((PetscObject)dm);
+    MPI_Allreduce(MPI_IN_PLACE, sums.data(), (PetscMPIInt)sums.size(), MPIU_REAL, MPIU_SUM, comm) >> checkMpiError;
+    MPI_Allreduce(MPI_IN_PLACE, maxima.data(), (PetscMPIInt)maxima.size(), MPIU_REAL, MPIU_MAX, comm) >> checkMpiError;
+
+    // The sampled mean is scaled by the number of values in the entire vector to estimate the norm
+    PetscInt size;
+    VecGetSize(u, &size) >> checkError;
+    const PetscReal numberValues = errorScope == Scope::VECTOR ? (PetscReal)size : (PetscReal)(size / totalComponents);
+    const PetscReal numberSamples = sums[2 * numberErrors];
+
+    std::vector<PetscReal> ferrors(numberErrors, 0.0);
+    confidence.assign(numberErrors, PETSC_INFINITY);
+    for (PetscInt e = 0; e < numberErrors; ++e) {
+        if (normType == Norm::LINF) {
+            // the sampled max is a lower bound of the true max
+            ferrors[e] = maxima[e];
+            continue;
+        }
+        if (numberSamples < 1) {
+            continue;
+        }
+        const PetscReal mean = sums[e] / numberSamples;
+        switch (normType) {
+            case Norm::L1:
+                ferrors[e] = mean * numberValues;
+                break;
+            case Norm::L1_NORM:
+                ferrors[e] = mean;
+                break;
+            case Norm::L2:
+                ferrors[e] = PetscSqrtReal(mean * numberValues);
+                break;
+            case Norm::L2_NORM:
+                ferrors[e] = PetscSqrtReal(mean);
+                break;
+            default:
+                break;
+        }
+
+        // the standard error of the mean, halved for the square root of the l2 norms
+        if (numberSamples > 1 && mean > 0.0) {
+            const PetscReal variance = PetscMax(sums[numberErrors + e] / numberSamples - mean * mean, 0.0) * numberSamples / (numberSamples - 1);
+            confidence[e] = 1.96 * PetscSqrtReal(variance / numberSamples) / mean * (squared ? 0.5 : 1.0);
+        }
+    }
+    return ferrors;
+}
+
 std::ostream& ablate::monitors::operator<<(std::ostream& os, const ablate::monitors::SolutionErrorMonitor::Scope& v) {
     switch (v) {
         case SolutionErrorMonitor::Scope::VECTOR:
@@ -234,4 +383,6 @@ std::istream& ablate::monitors::operator>>(std::istream& is, ablate::monitors::S
 REGISTER(ablate::monitors::Monitor, ablate::monitors::SolutionErrorMonitor, "Computes and reports the error every time step",
          ENUM(ablate::monitors::SolutionErrorMonitor::Scope, "scope", "how the error should be calculated ('vector', 'component')"),
          ENUM(ablate::monitors::SolutionErrorMonitor::Norm, "type", "norm type ('l1','l1_norm','l2', 'linf', 'l2_norm')"),
-         OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
+         OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"),
+         OPT(int, "sampleStride",
+             "when greater than one, the error is estimated from every n-th cell with a 95% confidence interval and the full projection is only used at the final step (default is 0)"));
@@ -18,12 +18,33 @@ class SolutionErrorMonitor : public Monitor {
     Norm normType;
     const std::shared_ptr<logs::Log> log;
 
+    //! when greater than one, only every n-th cell is used to estimate the error until the final step
+    const PetscInt sampleStride;
+
+    //! the number of sampled error reports, used to rotate the sampled cells
+    PetscInt sampleCount = 0;
+
    public:
-    SolutionErrorMonitor(Scope errorScope, Norm normType, std::shared_ptr<logs::Log> log = {});
+    /**
+     * @param errorScope how the error should be calculated
+     * @param normType the norm type
+     * @param log where to record log (default is stdout)
+     * @param sampleStride when greater than one, only every n-th cell is used to estimate the error until the final step (default is 0, full projection)
+     */
+    SolutionErrorMonitor(Scope errorScope, Norm normType, std::shared_ptr<logs::Log> log = {}, int sampleStride = {});
 
     PetscMonitorFunction GetPetscFunction() override { return MonitorError; }
 
+    /**
+     * Compute the error by projecting the exact solution over the entire domain
+     */
     std::vector<PetscReal> ComputeError(TS ts, PetscReal time, Vec u);
+
+    /**
+     * Estimate the error from the exact solution at the centroid of every sampleStride-th cell starting at offset.  Only supports FVM fields.
+     * @param confidence the relative half width of the 95% confidence interval of each error estimate (a lower bound is reported for linf)
+     */
+    std::vector<PetscReal> ComputeSampledError(TS ts, PetscReal time, Vec u, PetscInt offset, std::vector<PetscReal>& confidence);
 };
 
 /**
@@ -25,31 +25,30 @@ PetscErrorCode ablate::monitors::TurbFlowStats::MonitorTurbFlowStats(TS ts, Pets
     if (monitor->interval->Check(PetscObjectComm((PetscObject)ts), step, crtime)) {
         // Increment the number of steps taken so far
         monitor->step += 1;
+        auto& subDomain = monitor->GetSolver()->GetSubDomain();
 
-        // Extract all fields to be monitored
-        std::vector<Vec> vec(monitor->fieldNames.size(), nullptr);
-        std::vector<IS> vecIS(monitor->fieldNames.size(), nullptr);
-        std::vector<DM> fieldDM(monitor->fieldNames.size(), nullptr);
-        for (std::size_t f = 0; f < monitor->fieldNames.size(); f++) {
-            const auto& field = monitor->GetSolver()->GetSubDomain().GetField(monitor->fieldNames[f]);
-            ierr = monitor->GetSolver()->GetSubDomain().GetFieldGlobalVector(field, &vecIS[f], &vec[f], &fieldDM[f]);
-            CHKERRQ(ierr);
+        // Look up each field to be monitored, the values are read directly from the solution or aux vector
+        std::vector<domain::Field> fields;
+        for (const auto& fieldName : monitor->fieldNames) {
+            fields.push_back(subDomain.GetField(fieldName));
         }
 
-        // Extract the main solution vector for the density calculation
-        DM solDM;
-        Vec solVec;
-        solVec = monitor->GetSolver()->GetSubDomain().GetSubSolutionVector();
-        solDM = monitor->GetSolver()->GetSubDomain().GetDM();
+        // Extract the main solution (global) and aux (local) vectors
+        DM solDM = subDomain.GetDM();
+        Vec solVec = subDomain.GetSolutionVector();
+        DM auxDM = subDomain.GetAuxDM();
+        Vec auxVec = subDomain.GetAuxVector();
 
         // Store the monitorDM, monitorVec, and the monitorFields
-        DM monitorDM = monitor->monitorSubDomain->GetSubDM();
-        Vec monitorVec = monitor->monitorSubDomain->GetSolutionVector();
-        auto& monitorFields = monitor->monitorSubDomain->GetFields();
+        DM monitorDM = monitor->GetMonitorSubDomain()->GetSubDM();
+        Vec monitorVec = monitor->GetMonitorSubDomain()->GetSolutionVector();
+        auto& monitorFields = monitor->GetMonitorSubDomain()->GetFields();
+        const PetscInt densitySumOffset = monitorFields[FieldPlacements::densitySum].offset;
+        const PetscInt densityDtSumOffset = monitorFields[FieldPlacements::densityDtSum].offset;
 
         // Get the local cell range
         PetscInt cStart, cEnd;
-        DMPlexGetHeightStratum(monitor->monitorSubDomain->GetSubDM(), 0, &cStart, &cEnd);
+        DMPlexGetHeightStratum(monitorDM, 0, &cStart, &cEnd);
 
         // Get the local to global cell mapping
         IS subpointIS;
@@ -57,12 +56,15 @@ PetscErrorCode ablate::monitors::TurbFlowStats::MonitorTurbFlowStats(TS ts, Pets
         DMPlexGetSubpointIS(monitorDM, &subpointIS);
         ISGetIndices(subpointIS, &subpointIndices);
 
-        // Extract the solution global array
+        // Extract the solution, aux, and monitor arrays
         const PetscScalar* solDat;
         ierr = VecGetArrayRead(solVec, &solDat);
         CHKERRQ(ierr);
-
-        // Extract the monitor array
+        const PetscScalar* auxDat = nullptr;
+        if (auxVec) {
+            ierr = VecGetArrayRead(auxVec, &auxDat);
+            CHKERRQ(ierr);
+        }
         PetscScalar* monitorDat;
         ierr = VecGetArray(monitorVec, &monitorDat);
         CHKERRQ(ierr);
@@ -72,88 +74,114 @@ PetscErrorCode ablate::monitors::TurbFlowStats::MonitorTurbFlowStats(TS ts, Pets
         ierr = TSGetTimeStep(ts, &dt);
         CHKERRQ(ierr);
 
-        // Create pointers to the field and monitor data exterior to loop
-        const PetscScalar* fieldDat;
         //! Iterator guide
-        // f - field iterator
         // c - cell iterator
+        // f - field iterator
         // p - field component iterator
-        for (std::size_t f = 0; f < monitor->fieldNames.size(); f++) {
-            // Extract the field vector global array
-            ierr = VecGetArrayRead(vec[f], &fieldDat);
-            CHKERRQ(ierr);
+        // A single pass over the cells updates the running sums for every field, the favre average and rms values are only computed when saved
+        for (PetscInt c = cStart; c < cEnd; c++) {
+            PetscInt masterCell = subpointIndices[c];
 
-            //! Compute measures
-            for (PetscInt c = cStart; c < cEnd; c++) {
-                PetscInt monitorCell = c;
-                PetscInt masterCell = subpointIndices[monitorCell];
-                const PetscScalar* fieldPt;
-                const PetscScalar* solPt;
-                PetscScalar* monitorPt;
+            // Get read/write access to point in monitor array and the solution point data (only owned cells are updated)
+            PetscScalar* monitorPt;
+            ierr = DMPlexPointGlobalRef(monitorDM, c, monitorDat, &monitorPt);
+            CHKERRQ(ierr);
+            const PetscScalar* solPt;
+            ierr = DMPlexPointGlobalRead(solDM, masterCell, solDat, &solPt);
+            CHKERRQ(ierr);
+            if (!monitorPt || !solPt) {
+                continue;
+            }
 
-                // Get field point data
-                ierr = DMPlexPointLocalRead(fieldDM[f], masterCell, fieldDat, &fieldPt);
-                CHKERRQ(ierr);
+            // Get the density data from solution point data
+            PetscReal densLoc;
+            monitor->densityFunc.function(solPt, &densLoc, monitor->densityFunc.context.get());
+            const PetscReal densDtLoc = densLoc * dt;
+            monitorPt[densitySumOffset] += densLoc;
+            monitorPt[densityDtSumOffset] += densDtLoc;
 
-                // Get solution point data
-                ierr = DMPlexPointLocalRead(solDM, masterCell, solDat, &solPt);
-                CHKERRQ(ierr);
+            for (std::size_t f = 0; f < fields.size(); f++) {
+                const auto& field = fields[f];
 
-                // Get read/write access to point in monitor array
-                ierr = DMPlexPointGlobalRef(monitorDM, monitorCell, monitorDat, &monitorPt);
+                // Get field point data
+                const PetscScalar* fieldPt = nullptr;
+                if (field.location == fLoc::SOL) {
+                    ierr = DMPlexPointGlobalFieldRead(solDM, masterCell, field.id, solDat, &fieldPt);
+                } else {
+                    ierr = DMPlexPointLocalFieldRead(auxDM, masterCell, field.id, auxDat, &fieldPt);
+                }
                 CHKERRQ(ierr);
+                if (!fieldPt) {
+                    continue;
+                }
 
-                if (monitorPt && solPt) {
-                    // Get the density data from solution point data
-                    PetscReal densLoc;
-                    monitor->densityFunc.function(solPt, &densLoc, monitor->densityFunc.context.get());
-
-                    // Perform actual calculations now
-                    monitorPt[monitorFields[FieldPlacements::densitySum].offset] += densLoc;
-                    monitorPt[monitorFields[FieldPlacements::densityDtSum].offset] += densLoc * dt;
-
-                    // Set the offset
-                    PetscInt offset = monitorFields[FieldPlacements::fieldsStart + f].offset;
-
-                    // March over each field component
-                    for (int p = 0; p < monitorFields[f].numberComponents; p++) {
-                        offset += SectionLabels::END * p;
-                        monitorPt[offset + SectionLabels::densityMult] += fieldPt[p] * densLoc;
-                        monitorPt[offset + SectionLabels::densityDtMult] += fieldPt[p] * densLoc * dt;
-                        monitorPt[offset + SectionLabels::densitySqr] += fieldPt[p] * fieldPt[p] * densLoc;
-                        monitorPt[offset + SectionLabels::sum] += fieldPt[p];
-                        monitorPt[offset + SectionLabels::sumSqr] += fieldPt[p] * fieldPt[p];
-                        monitorPt[offset + SectionLabels::favreAvg] =
-                            monitorPt[offset + SectionLabels::densityDtMult] / (monitorPt[monitorFields[FieldPlacements::densityDtSum].offset] + Constant::tiny);
-                        monitorPt[offset + SectionLabels::rms] = PetscSqrtReal(monitorPt[offset + SectionLabels::sumSqr] / (monitor->step + Constant::tiny) -
-                                                                               PetscPowReal(monitorPt[offset + SectionLabels::sum] / (monitor->step + Constant::tiny), 2));
-                        monitorPt[offset + SectionLabels::mRms] =
-                            PetscSqrtReal(monitorPt[offset + SectionLabels::densitySqr] / (monitorPt[monitorFields[FieldPlacements::densitySum].offset] + Constant::tiny) -
-                                          PetscPowReal(monitorPt[offset + SectionLabels::densityMult] / (monitorPt[monitorFields[FieldPlacements::densitySum].offset] + Constant::tiny), 2));
-                    }
+                // March over each field component, the sums for each component are stored contiguously
+                PetscScalar* statPt = monitorPt + monitorFields[FieldPlacements::fieldsStart + f].offset;
+                for (PetscInt p = 0; p < field.numberComponents; p++) {
+                    const PetscReal value = fieldPt[p];
+                    PetscScalar* componentPt = statPt + SectionLabels::END * p;
+                    componentPt[SectionLabels::densityMult] += value * densLoc;
+                    componentPt[SectionLabels::densityDtMult] += value * densDtLoc;
+                    componentPt[SectionLabels::densitySqr] += value * value * densLoc;
+                    componentPt[SectionLabels::sum] += value;
+                    componentPt[SectionLabels::sumSqr] += value * value;
                 }
             }
-            ierr = VecRestoreArrayRead(vec[f], &fieldDat);
-            CHKERRQ(ierr);
         }
+
         // Cleanup
         // Restore arrays
         ierr = ISRestoreIndices(subpointIS, &subpointIndices);
         CHKERRQ(ierr);
         ierr = VecRestoreArrayRead(solVec, &solDat);
         CHKERRQ(ierr);
-        ierr = VecRestoreArray(monitorVec, &monitorDat);
-        CHKERRQ(ierr);
-        // Restore field vectors
-        for (std::size_t f = 0; f < monitor->fieldNames.size(); f++) {
-            const auto& field = monitor->GetSolver()->GetSubDomain().GetField(monitor->fieldNames[f]);
-            ierr = monitor->GetSolver()->GetSubDomain().RestoreFieldGlobalVector(field, &vecIS[f], &vec[f], &fieldDM[f]);
+        if (auxVec) {
+            ierr = VecRestoreArrayRead(auxVec, &auxDat);
             CHKERRQ(ierr);
         }
+        ierr = VecRestoreArray(monitorVec, &monitorDat);
+        CHKERRQ(ierr);
     }
     PetscFunctionReturn(0);
 }
 
+void ablate::monitors::TurbFlowStats::ComputeDerivedStatistics() {
+    DM monitorDM = GetMonitorSubDomain()->GetSubDM();
+    Vec monitorVec = GetMonitorSubDomain()->GetSolutionVector();
+    auto& monitorFields = GetMonitorSubDomain()->GetFields();
+    const PetscInt densitySumOffset = monitorFields[FieldPlacements::densitySum].offset;
+    const PetscInt densityDtSumOffset = monitorFields[FieldPlacements::densityDtSum].offset;
+
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(monitorDM, 0, &cStart, &cEnd) >> checkError;
+
+    PetscScalar* monitorDat;
+    VecGetArray(monitorVec, &monitorDat) >> checkError;
+    for (PetscInt c = cStart; c < cEnd; c++) {
+        PetscScalar* monitorPt;
+        DMPlexPointGlobalRef(monitorDM, c, monitorDat, &monitorPt) >> checkError;
+        if (!monitorPt) {
+            continue;
+        }
+        const PetscReal densitySumValue = monitorPt[densitySumOffset] + Constant::tiny;
+        const PetscReal densityDtSumValue = monitorPt[densityDtSumOffset] + Constant::tiny;
+        const PetscReal stepValue = step + Constant::tiny;
+
+        for (std::size_t f = FieldPlacements::fieldsStart; f < monitorFields.size(); f++) {
+            PetscScalar* statPt = monitorPt + monitorFields[f].offset;
+            for (PetscInt p = 0; p < monitorFields[f].numberComponents / SectionLabels::END; p++) {
+                PetscScalar* componentPt = statPt + SectionLabels::END * p;
+                const PetscReal mean = componentPt[SectionLabels::sum] / stepValue;
+                const PetscReal densityMean = componentPt[SectionLabels::densityMult] / densitySumValue;
+                componentPt[SectionLabels::favreAvg] = componentPt[SectionLabels::densityDtMult] / densityDtSumValue;
+                componentPt[SectionLabels::rms] = PetscSqrtReal(PetscMax(componentPt[SectionLabels::sumSqr] / stepValue - mean * mean, 0.0));
+                componentPt[SectionLabels::mRms] = PetscSqrtReal(PetscMax(componentPt[SectionLabels::densitySqr] / densitySumValue - densityMean * densityMean, 0.0));
+            }
+        }
+    }
+    VecRestoreArray(monitorVec, &monitorDat) >> checkError;
+}
+
 void ablate::monitors::TurbFlowStats::Register(std::shared_ptr<ablate::solver::Solver> solverIn) {
     // Create the monitor name
     std::string dmID = solverIn->GetSolverId() + "_turbulenceFlowStats";
@@ -193,6 +221,9 @@ void ablate::monitors::TurbFlowStats::Register(std::shared_ptr<ablate::solver::S
 }
 
 void ablate::monitors::TurbFlowStats::Save(PetscViewer viewer, PetscInt sequenceNumber, PetscReal time) {
+    // The favre average and rms values are only needed for output
+    ComputeDerivedStatistics();
+
     // Perform the principal save
     ablate::monitors::FieldMonitor::Save(viewer, sequenceNumber, time);
 
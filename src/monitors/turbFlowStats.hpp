@@ -24,6 +24,11 @@ class TurbFlowStats : public FieldMonitor {
 
     static PetscErrorCode MonitorTurbFlowStats(TS ts, PetscInt step, PetscReal crtime, Vec u, void* ctx);
 
+    /**
+     * Compute the favre average and rms values from the running sums, this is only done before output
+     */
+    void ComputeDerivedStatistics();
+
    public:
     explicit TurbFlowStats(const std::vector<std::string> nameIn, const std::shared_ptr<ablate::eos::EOS> eosIn, std::shared_ptr<io::interval::Interval> intervalIn = {});
     PetscMonitorFunction GetPetscFunction() override { return MonitorTurbFlowStats; }
@@ -62,7 +62,7 @@ class Accessor {
      */
     inline Data<DataType> GetData(const std::string& fieldName) {
         if (cachePointData) {
-            if (dataCache.count(fieldName)) {
+            if (!dataCache.count(fieldName)) {
                 dataCache[fieldName] = CreateData(fieldName);
             }
             return dataCache.at(fieldName);
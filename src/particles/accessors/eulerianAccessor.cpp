@@ -1,7 +1,9 @@
 #include "eulerianAccessor.hpp"
 
+#include <string>
 #include <utility>
 #include "particles/particleSolver.hpp"
+#include "utilities/kokkosUtilities.hpp"
 
 ablate::particles::accessors::EulerianAccessor::EulerianAccessor(bool cachePointData, std::shared_ptr<ablate::domain::SubDomain> subDomain, SwarmAccessor& swarm, PetscReal currentTime)
     : Accessor(cachePointData), subDomain(std::move(subDomain)), currentTime(currentTime), np(swarm.GetNumberParticles()) {
@@ -13,6 +15,30 @@ ablate::particles::accessors::EulerianAccessor::EulerianAccessor(bool cachePoint
     coodinatesField.CopyAll(coordinates.data(), np);
 }
 
+ablate::particles::accessors::EulerianAccessor::~EulerianAccessor() {
+    if (interpolant) {
+        DMInterpolationDestroy(&interpolant) >> checkError;
+    }
+}
+
+void ablate::particles::accessors::EulerianAccessor::SetUpInterpolant() {
+    // Set up the interpolation, the dof is set for each field
+    DM dm = subDomain->GetDM();
+    DMInterpolationCreate(PETSC_COMM_SELF, &interpolant) >> checkError;
+    DMInterpolationSetDim(interpolant, subDomain->GetDimensions()) >> checkError;
+    DMInterpolationSetDof(interpolant, 1) >> checkError;
+
+    // Copy over the np of particles
+    DMInterpolationAddPoints(interpolant, np, coordinates.data()) >> checkError;
+
+    /* Particles that lie outside the domain should be dropped,
+    whereas particles that move to another partition should trigger a migration */
+    DMInterpolationSetUp(interpolant, dm, PETSC_FALSE, PETSC_TRUE) >> checkError;
+    if (interpolant->n != np) {
+        throw std::runtime_error("ablate::particles::accessors::EulerianAccessor located " + std::to_string(interpolant->n) + " of " + std::to_string(np) + " particles");
+    }
+}
+
 ablate::particles::accessors::ConstPointData ablate::particles::accessors::EulerianAccessor::CreateData(const std::string& fieldName) {
     // Store the eulerianFieldInformation
     Vec locEulerianField;
@@ -23,28 +49,49 @@ ablate::particles::accessors::ConstPointData ablate::particles::accessors::Euler
     const auto& eulerianField = subDomain->GetField(fieldName);
     subDomain->GetFieldLocalVector(eulerianField, currentTime, &eulerianFieldIs, &locEulerianField, &eulerianFieldDm) >> checkError;
 
-    // Set up the interpolation
-    DMInterpolationInfo interpolant;
-    DMInterpolationCreate(PETSC_COMM_SELF, &interpolant) >> checkError;
-    DMInterpolationSetDim(interpolant, subDomain->GetDimensions()) >> checkError;
-    DMInterpolationSetDof(interpolant, eulerianField.numberComponents) >> checkError;
-
-    // Copy over the np of particles
-    DMInterpolationAddPoints(interpolant, np, coordinates.data()) >> checkError;
-
-    /* Particles that lie outside the domain should be dropped,
-    whereas particles that move to another partition should trigger a migration */
-    DMInterpolationSetUp(interpolant, eulerianFieldDm, PETSC_FALSE, PETSC_TRUE) >> checkError;
+    // The particle locations are only searched for the first field
+    if (!interpolant) {
+        SetUpInterpolant();
+    }
 
     // Create a vec to hold the information
     Vec eulerianFieldAtParticles;
     VecCreateSeq(PETSC_COMM_SELF, np * eulerianField.numberComponents, &eulerianFieldAtParticles) >> checkError;
 
-    // interpolate
-    DMInterpolationEvaluate(interpolant, eulerianFieldDm, locEulerianField, eulerianFieldAtParticles) >> checkError;
+    // Determine the discretization of the field
+    PetscObject discretization;
+    PetscClassId discretizationId;
+    DMGetField(eulerianFieldDm, 0, nullptr, &discretization) >> checkError;
+    PetscObjectGetClassId(discretization, &discretizationId) >> checkError;
+
+    if (discretizationId == PETSCFV_CLASSID) {
+        // finite volume fields are constant in each cell so the value is gathered from the located cell
+        const PetscScalar* locEulerianFieldArray;
+        PetscScalar* valueArray;
+        VecGetArrayRead(locEulerianField, &locEulerianFieldArray) >> checkError;
+        VecGetArrayWrite(eulerianFieldAtParticles, &valueArray) >> checkError;
+        auto gatherCellValues = [&](std::size_t start, std::size_t end, std::size_t) {
+            for (auto p = (PetscInt)start; p < (PetscInt)end; ++p) {
+                const PetscScalar* cellValues;
+                DMPlexPointLocalRead(eulerianFieldDm, interpolant->cells[p], locEulerianFieldArray, &cellValues) >> checkError;
+                PetscArraycpy(valueArray + p * eulerianField.numberComponents, cellValues, eulerianField.numberComponents) >> checkError;
+            }
+        };
+        // the gather calls petsc, so it is only threaded when petsc can be called from the helper threads
+        if (utilities::KokkosUtilities::PetscThreadSafe()) {
+            utilities::KokkosUtilities::ParallelForChunks(np, gatherCellValues);
+        } else {
+            gatherCellValues(0, np, 0);
+        }
+        VecRestoreArrayWrite(eulerianFieldAtParticles, &valueArray) >> checkError;
+        VecRestoreArrayRead(locEulerianField, &locEulerianFieldArray) >> checkError;
+    } else {
+        // interpolate with the already located cells
+        DMInterpolationSetDof(interpolant, eulerianField.numberComponents) >> checkError;
+        DMInterpolationEvaluate(interpolant, eulerianFieldDm, locEulerianField, eulerianFieldAtParticles) >> checkError;
+    }
 
     // Now cleanup
-    DMInterpolationDestroy(&interpolant) >> checkError;
     subDomain->RestoreFieldLocalVector(eulerianField, &eulerianFieldIs, &locEulerianField, &eulerianFieldDm) >> checkError;
 
     // Get the raw array from the vec
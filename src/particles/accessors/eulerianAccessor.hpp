@@ -26,11 +26,20 @@ class EulerianAccessor : public Accessor<const PetscReal> {
     //! the number of particles in this domain
     const PetscInt np;
 
+    //! the interpolant stores the cell containing each particle and is shared by every field requested from this accessor
+    DMInterpolationInfo interpolant = nullptr;
+
+    /**
+     * Locate the particles in the mesh once, the located cells are reused for each field
+     */
+    void SetUpInterpolant();
+
    public:
     EulerianAccessor(bool cachePointData, std::shared_ptr<ablate::domain::SubDomain> subDomain, SwarmAccessor&, PetscReal currentTime);
+    ~EulerianAccessor() override;
 
     /**
-     * Create point data from the rhs field
+     * Create point data from the rhs field.  Finite volume fields are gathered directly from the located cells, other fields are interpolated with the shared interpolant
      * @param fieldName
      * @return
      */
@@ -1,31 +1,53 @@
 #include "particleSolver.hpp"
 #include <petscviewerhdf5.h>
+#include <algorithm>
+#include <map>
 #include <numeric>
+#include <set>
+#include <string>
 #include <utility>
+#include "finiteVolume/compressibleFlowFields.hpp"
 #include "particles/accessors/eulerianAccessor.hpp"
 #include "particles/accessors/rhsAccessor.hpp"
 #include "particles/accessors/swarmAccessor.hpp"
+#include "utilities/kokkosUtilities.hpp"
 #include "utilities/mpiError.hpp"
 #include "utilities/vectorUtilities.hpp"
 
 ablate::particles::ParticleSolver::ParticleSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options, std::vector<FieldDescription> fields,
                                                   std::vector<std::shared_ptr<processes::Process>> processes, std::shared_ptr<initializers::Initializer> initializer,
                                                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization,
-                                                  std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions)
+                                                  std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, int sortInterval, int advanceInterval, bool neighborMigration,
+                                                  int minParcelsPerCell, int maxParcelsPerCell, bool compressOutput)
     : Solver(std::move(solverId), std::move(region), std::move(options)),
       fieldsDescriptions(std::move(std::move(fields))),
       processes(std::move(processes)),
       initializer(std::move(initializer)),
       fieldInitialization(std::move(fieldInitialization)),
-      exactSolutions(std::move(exactSolutions))
-
-{}
+      exactSolutions(std::move(exactSolutions)),
+      sortInterval(sortInterval),
+      advanceInterval(advanceInterval),
+      neighborMigration(neighborMigration),
+      minParcelsPerCell(minParcelsPerCell),
+      maxParcelsPerCell(maxParcelsPerCell),
+      compressOutput(compressOutput)
+
+{
+    if (this->advanceInterval < 1) {
+        throw std::invalid_argument("The ablate::particles::ParticleSolver advanceInterval must be at least 1");
+    }
+    if (this->minParcelsPerCell < 0 || this->maxParcelsPerCell < 0 || (this->maxParcelsPerCell > 0 && this->minParcelsPerCell > this->maxParcelsPerCell)) {
+        throw std::invalid_argument("The ablate::particles::ParticleSolver minParcelsPerCell must be in [0, maxParcelsPerCell]");
+    }
+}
 ablate::particles::ParticleSolver::ParticleSolver(std::string solverId, std::shared_ptr<domain::Region> region, std::shared_ptr<parameters::Parameters> options,
                                                   const std::vector<std::shared_ptr<FieldDescription>> &fields, std::vector<std::shared_ptr<processes::Process>> processes,
                                                   std::shared_ptr<initializers::Initializer> initializer, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization,
-                                                  std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions)
+                                                  std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, int sortInterval, int advanceInterval, bool neighborMigration,
+                                                  int minParcelsPerCell, int maxParcelsPerCell, bool compressOutput)
     : ParticleSolver(std::move(solverId), std::move(region), std::move(options), ablate::utilities::VectorUtilities::Copy(fields), std::move(processes), std::move(initializer),
-                     std::move(fieldInitialization), std::move(exactSolutions)) {}
+                     std::move(fieldInitialization), std::move(exactSolutions), sortInterval, advanceInterval, neighborMigration, minParcelsPerCell,
+                     maxParcelsPerCell, compressOutput) {}
 
 ablate::particles::ParticleSolver::~ParticleSolver() {
     if (swarmDm) {
@@ -72,6 +94,14 @@ void ablate::particles::ParticleSolver::Setup() {
         fieldsDescriptions.emplace_back(ParticleInitialLocation, domain::FieldLocation::AUX, coordComponents);
     }
 
+    // the parcel weight is required to merge and split parcels
+    auto weightField = std::find_if(fieldsDescriptions.begin(), fieldsDescriptions.end(), [](const auto &fieldDescription) { return fieldDescription.name == ParticleWeight; });
+    if (weightField == fieldsDescriptions.end() && (minParcelsPerCell > 0 || maxParcelsPerCell > 0)) {
+        fieldsDescriptions.emplace_back(ParticleWeight, domain::FieldLocation::AUX);
+    } else if (weightField != fieldsDescriptions.end() && weightField->location != domain::FieldLocation::AUX) {
+        throw std::invalid_argument("The " + std::string(ParticleWeight) + " field must be of type domain::FieldLocation::AUX");
+    }
+
     // record the automatic field of coordinates
     auto coordField = FieldDescription{ParticleCoordinates, domain::FieldLocation::SOL, coordComponents};
     fieldsDescriptions.push_back(coordField);
@@ -114,6 +144,25 @@ void ablate::particles::ParticleSolver::Setup() {
     }
 }
 
+void ablate::particles::ParticleSolver::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) {
+    Solver::AccumulateMemoryUsage(memoryUsage);
+    if (!swarmDm) {
+        return;
+    }
+
+    PetscInt localSize;
+    DMSwarmGetLocalSize(swarmDm, &localSize) >> checkError;
+    const auto prefix = GetSolverId() + "::particles::";
+    for (const auto& field : fields) {
+        PetscInt typeSize;
+        PetscDataTypeGetSize(field.dataType, &typeSize) >> checkError;
+        memoryUsage.Add(prefix + field.name, (PetscLogDouble)localSize * field.numberComponents * typeSize);
+    }
+
+    // the swarm also stores the particle id, rank, and cell of each particle
+    memoryUsage.Add(prefix + "swarm", (PetscLogDouble)localSize * (sizeof(PetscInt64) + 2 * sizeof(PetscInt)));
+}
+
 void ablate::particles::ParticleSolver::Initialize() {
     // before setting up the flow finalize the fields
     DMSwarmFinalizeFieldRegister(swarmDm) >> checkError;
@@ -149,6 +198,16 @@ void ablate::particles::ParticleSolver::Initialize() {
         TSSetComputeExactError(particleTs, ComputeParticleError) >> checkError;
     }
 
+    // each particle is a single physical particle unless the weight is initialized
+    if (HasField(ParticleWeight)) {
+        PetscInt np;
+        DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+        PetscReal *weights;
+        DMSwarmGetField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weights) >> checkError;
+        std::fill(weights, weights + np, 1.0);
+        DMSwarmRestoreField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weights) >> checkError;
+    }
+
     // project the initialization field onto each local particle
     for (auto &field : fieldInitialization) {
         this->ProjectFunction(field);
@@ -310,6 +369,25 @@ PetscErrorCode ablate::particles::ParticleSolver::ComputeParticleError(TS partic
     VecAssemblyBegin(errorVec) >> checkError;
     VecAssemblyEnd(errorVec) >> checkError;
 
+    // scale the error of each parcel by its weight relative to the mean weight so the error norm represents the physical particles
+    if (particles->HasField(ParticleWeight)) {
+        const PetscReal *weights;
+        DMSwarmGetField(particles->swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weights) >> checkError;
+        PetscReal localWeight[2] = {std::accumulate(weights, weights + np, 0.0), (PetscReal)np};
+        PetscReal globalWeight[2];
+        MPI_Allreduce(localWeight, globalWeight, 2, MPIU_REAL, MPIU_SUM, PetscObjectComm((PetscObject)particleTS)) >> checkMpiError;
+        const PetscReal meanWeight = globalWeight[1] > 0.0 ? globalWeight[0] / globalWeight[1] : 1.0;
+        PetscScalar *errorArray;
+        VecGetArray(errorVec, &errorArray) >> checkError;
+        for (PetscInt p = 0; p < np; ++p) {
+            for (PetscInt c = 0; c < solutionFieldSize; ++c) {
+                errorArray[p * solutionFieldSize + c] *= weights[p] / meanWeight;
+            }
+        }
+        VecRestoreArray(errorVec, &errorArray) >> checkError;
+        DMSwarmRestoreField(particles->swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weights) >> checkError;
+    }
+
     // restore all the vecs/fields
     PetscSFDestroy(&cellSF) >> checkError;
 
@@ -357,7 +435,220 @@ void ablate::particles::ParticleSolver::ProjectFunction(const std::shared_ptr<ma
     DMSwarmRestoreField(swarmDm, DMSwarmPICField_coor, nullptr, nullptr, (void **)&positionData);
     RestoreField(field, &fieldData);
 }
+std::vector<std::string> ablate::particles::ParticleSolver::GetSwarmFieldNames() const {
+    // sol fields are stored in the PackedSolution aux field
+    std::vector<std::string> swarmFields = {DMSwarmPICField_coor, DMSwarmField_pid, DMSwarmField_rank, DMSwarmPICField_cellid};
+    for (const auto &field : fields) {
+        if (field.location == domain::FieldLocation::AUX) {
+            swarmFields.push_back(field.name);
+        }
+    }
+    return swarmFields;
+}
+
+ablate::particles::ParticleSolver::MigrationType ablate::particles::ParticleSolver::LocateParticles(std::vector<PetscSFNode> &destinations) {
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    DM dm = subDomain->GetDM();
+    PetscMPIInt rank;
+    MPI_Comm_rank(PetscObjectComm((PetscObject)dm), &rank) >> checkMpiError;
+
+    // use the cached cell id as the first guess so that only the particles that left their cell are searched
+    PetscInt *cellIds;
+    DMSwarmGetField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void **)&cellIds) >> checkError;
+    PetscInt pStart, pEnd;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> checkError;
+    PetscSFNode *guessCells;
+    PetscMalloc1(np, &guessCells) >> checkError;
+    for (PetscInt p = 0; p < np; ++p) {
+        guessCells[p].rank = rank;
+        guessCells[p].index = cellIds[p] >= pStart && cellIds[p] < pEnd ? cellIds[p] : DMLOCATEPOINT_POINT_NOT_FOUND;
+    }
+    PetscSF cellSF;
+    PetscSFCreate(PETSC_COMM_SELF, &cellSF) >> checkError;
+    PetscSFSetGraph(cellSF, pEnd, np, nullptr, PETSC_OWN_POINTER, guessCells, PETSC_OWN_POINTER) >> checkError;
+
+    // locate the particles in the local mesh
+    PetscReal *coordinates;
+    DMSwarmGetField(swarmDm, DMSwarmPICField_coor, nullptr, nullptr, (void **)&coordinates) >> checkError;
+    Vec coordinateVec;
+    VecCreateSeqWithArray(PETSC_COMM_SELF, ndims, np * ndims, coordinates, &coordinateVec) >> checkError;
+    DMLocatePoints(dm, coordinateVec, DM_POINTLOCATION_NONE, &cellSF) >> checkError;
+    VecDestroy(&coordinateVec) >> checkError;
+    DMSwarmRestoreField(swarmDm, DMSwarmPICField_coor, nullptr, nullptr, (void **)&coordinates) >> checkError;
+    const PetscSFNode *cells;
+    PetscSFGetGraph(cellSF, nullptr, nullptr, nullptr, &cells) >> checkError;
+
+    // the leaves of the point sf are owned by another rank
+    std::vector<PetscSFNode> pointOwners(pEnd - pStart, PetscSFNode{-1, -1});
+    PetscSF pointSF;
+    DMGetPointSF(dm, &pointSF) >> checkError;
+    PetscInt numberLeaves;
+    const PetscInt *leaves;
+    const PetscSFNode *remotePoints;
+    PetscSFGetGraph(pointSF, nullptr, &numberLeaves, &leaves, &remotePoints) >> checkError;
+    for (PetscInt l = 0; l < PetscMax(numberLeaves, 0); ++l) {
+        pointOwners[(leaves ? leaves[l] : l) - pStart] = remotePoints[l];
+    }
+
+    // update the cell id and record where each particle must be sent
+    auto migration = MigrationType::NONE;
+    destinations.assign(np, PetscSFNode{-1, -1});
+    for (PetscInt p = 0; p < np; ++p) {
+        cellIds[p] = cells[p].index;
+        if (cells[p].index == DMLOCATEPOINT_POINT_NOT_FOUND) {
+            migration = MigrationType::GLOBAL;
+        } else if (pointOwners[cells[p].index - pStart].rank >= 0) {
+            destinations[p] = pointOwners[cells[p].index - pStart];
+            migration = std::max(migration, MigrationType::NEIGHBOR);
+        }
+    }
+    DMSwarmRestoreField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void **)&cellIds) >> checkError;
+    PetscSFDestroy(&cellSF) >> checkError;
+    return migration;
+}
+
+void ablate::particles::ParticleSolver::NeighborMigrate(const std::vector<PetscSFNode> &destinations) {
+    DM dm = subDomain->GetDM();
+    MPI_Comm comm = PetscObjectComm((PetscObject)dm);
+
+    // the neighbor ranks share a point in the point sf
+    PetscSF pointSF;
+    DMGetPointSF(dm, &pointSF) >> checkError;
+    PetscSFSetUp(pointSF) >> checkError;
+    PetscInt numberRootRanks, numberLeafRanks;
+    const PetscMPIInt *rootRanks, *leafRanks;
+    PetscSFGetRootRanks(pointSF, &numberRootRanks, &rootRanks, nullptr, nullptr, nullptr) >> checkError;
+    PetscSFGetLeafRanks(pointSF, &numberLeafRanks, &leafRanks, nullptr, nullptr) >> checkError;
+    std::vector<PetscMPIInt> neighbors(rootRanks, rootRanks + numberRootRanks);
+    neighbors.insert(neighbors.end(), leafRanks, leafRanks + numberLeafRanks);
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    std::map<PetscMPIInt, std::size_t> neighborIndex;
+    for (std::size_t n = 0; n < neighbors.size(); ++n) {
+        neighborIndex[neighbors[n]] = n;
+    }
+
+    // get the size of each particle in bytes
+    const auto swarmFields = GetSwarmFieldNames();
+    std::vector<std::size_t> fieldSizes(swarmFields.size());
+    for (std::size_t f = 0; f < swarmFields.size(); ++f) {
+        PetscInt blockSize;
+        PetscDataType dataType;
+        DMSwarmGetFieldInfo(swarmDm, swarmFields[f].c_str(), &blockSize, &dataType) >> checkError;
+        std::size_t typeSize;
+        PetscDataTypeGetSize(dataType, &typeSize) >> checkError;
+        fieldSizes[f] = blockSize * typeSize;
+    }
+    const std::size_t particleSize = std::accumulate(fieldSizes.begin(), fieldSizes.end(), (std::size_t)0);
+
+    // the sent particles are given the cell on the receiving rank before being packed field by field
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    std::vector<std::vector<PetscInt>> sendParticles(neighbors.size());
+    {
+        PetscInt *cellIds;
+        PetscInt *ranks;
+        DMSwarmGetField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void **)&cellIds) >> checkError;
+        DMSwarmGetField(swarmDm, DMSwarmField_rank, nullptr, nullptr, (void **)&ranks) >> checkError;
+        for (PetscInt p = 0; p < np; ++p) {
+            if (destinations[p].rank >= 0) {
+                sendParticles[neighborIndex.at((PetscMPIInt)destinations[p].rank)].push_back(p);
+                cellIds[p] = destinations[p].index;
+                ranks[p] = destinations[p].rank;
+            }
+        }
+        DMSwarmRestoreField(swarmDm, DMSwarmField_rank, nullptr, nullptr, (void **)&ranks) >> checkError;
+        DMSwarmRestoreField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void **)&cellIds) >> checkError;
+    }
+    std::vector<std::vector<char>> sendBuffers(neighbors.size());
+    for (std::size_t n = 0; n < neighbors.size(); ++n) {
+        sendBuffers[n].resize(sendParticles[n].size() * particleSize);
+    }
+    std::size_t fieldOffset = 0;
+    for (std::size_t f = 0; f < swarmFields.size(); ++f) {
+        char *data;
+        DMSwarmGetField(swarmDm, swarmFields[f].c_str(), nullptr, nullptr, (void **)&data) >> checkError;
+        for (std::size_t n = 0; n < neighbors.size(); ++n) {
+            for (std::size_t i = 0; i < sendParticles[n].size(); ++i) {
+                PetscMemcpy(sendBuffers[n].data() + i * particleSize + fieldOffset, data + sendParticles[n][i] * fieldSizes[f], fieldSizes[f]) >> checkError;
+            }
+        }
+        DMSwarmRestoreField(swarmDm, swarmFields[f].c_str(), nullptr, nullptr, (void **)&data) >> checkError;
+        fieldOffset += fieldSizes[f];
+    }
+
+    // exchange the number of particles with each neighbor
+    std::vector<PetscInt> sendCounts(neighbors.size()), receiveCounts(neighbors.size());
+    for (std::size_t n = 0; n < neighbors.size(); ++n) {
+        sendCounts[n] = (PetscInt)sendParticles[n].size();
+    }
+    std::vector<MPI_Request> requests(2 * neighbors.size());
+    for (std::size_t n = 0; n < neighbors.size(); ++n) {
+        MPI_Irecv(&receiveCounts[n], 1, MPIU_INT, neighbors[n], 0, comm, &requests[2 * n]) >> checkMpiError;
+        MPI_Isend(&sendCounts[n], 1, MPIU_INT, neighbors[n], 0, comm, &requests[2 * n + 1]) >> checkMpiError;
+    }
+    MPI_Waitall((PetscMPIInt)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> checkMpiError;
+
+    // exchange the particles
+    std::vector<std::vector<char>> receiveBuffers(neighbors.size());
+    for (std::size_t n = 0; n < neighbors.size(); ++n) {
+        receiveBuffers[n].resize(receiveCounts[n] * particleSize);
+        MPI_Irecv(receiveBuffers[n].data(), (PetscMPIInt)receiveBuffers[n].size(), MPI_BYTE, neighbors[n], 1, comm, &requests[2 * n]) >> checkMpiError;
+        MPI_Isend(sendBuffers[n].data(), (PetscMPIInt)sendBuffers[n].size(), MPI_BYTE, neighbors[n], 1, comm, &requests[2 * n + 1]) >> checkMpiError;
+    }
+    MPI_Waitall((PetscMPIInt)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> checkMpiError;
+
+    // remove the sent particles from the highest index so that the particles moved into the removed slots are kept
+    std::vector<PetscInt> removeParticles;
+    for (const auto &particles : sendParticles) {
+        removeParticles.insert(removeParticles.end(), particles.begin(), particles.end());
+    }
+    std::sort(removeParticles.rbegin(), removeParticles.rend());
+    for (const auto &p : removeParticles) {
+        DMSwarmRemovePointAtIndex(swarmDm, p) >> checkError;
+    }
+
+    // add and unpack the received particles
+    const PetscInt numberReceived = std::accumulate(receiveCounts.begin(), receiveCounts.end(), (PetscInt)0);
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    DMSwarmAddNPoints(swarmDm, numberReceived) >> checkError;
+    fieldOffset = 0;
+    for (std::size_t f = 0; f < swarmFields.size(); ++f) {
+        char *data;
+        DMSwarmGetField(swarmDm, swarmFields[f].c_str(), nullptr, nullptr, (void **)&data) >> checkError;
+        PetscInt p = np;
+        for (std::size_t n = 0; n < neighbors.size(); ++n) {
+            for (PetscInt i = 0; i < receiveCounts[n]; ++i) {
+                PetscMemcpy(data + (p++) * fieldSizes[f], receiveBuffers[n].data() + i * particleSize + fieldOffset, fieldSizes[f]) >> checkError;
+            }
+        }
+        DMSwarmRestoreField(swarmDm, swarmFields[f].c_str(), nullptr, nullptr, (void **)&data) >> checkError;
+        fieldOffset += fieldSizes[f];
+    }
+}
+
 void ablate::particles::ParticleSolver::SwarmMigrate() {
+    MPI_Comm comm;
+    PetscObjectGetComm((PetscObject)particleTs, &comm) >> checkError;
+
+    // only migrate if a particle on any rank is outside of the locally owned cells
+    std::vector<PetscSFNode> destinations;
+    PetscMPIInt migrationLocal = (PetscMPIInt)LocateParticles(destinations);
+    PetscMPIInt migrationAll = 0;
+    MPI_Allreduce(&migrationLocal, &migrationAll, 1, MPI_INT, MPI_MAX, comm) >> checkMpiError;
+    if (migrationAll == (PetscMPIInt)MigrationType::NONE) {
+        return;
+    }
+
+    // particles that only moved into the overlap can be sent directly to the neighbor that owns the cell
+    if (neighborMigration && migrationAll == (PetscMPIInt)MigrationType::NEIGHBOR) {
+        NeighborMigrate(destinations);
+        dmChanged = true;
+        cellParticleOffsets.clear();
+        return;
+    }
+
     // current number of local/global particles
     PetscInt numberLocal;
     PetscInt numberGlobal;
@@ -379,14 +670,314 @@ void ablate::particles::ParticleSolver::SwarmMigrate() {
 
     // Check to see if any of the ranks changed size after migration
     PetscMPIInt dmChangedLocal = newNumberGlobal != numberGlobal || newNumberLocal != numberLocal;
-    MPI_Comm comm;
-    PetscObjectGetComm((PetscObject)particleTs, &comm) >> checkError;
     PetscMPIInt dmChangedAll = PETSC_FALSE;
     MPI_Allreduce(&dmChangedLocal, &dmChangedAll, 1, MPIU_INT, MPIU_MAX, comm) >> checkMpiError;
     dmChanged = dmChangedAll == PETSC_TRUE;
+
+    // the migration changes the particle order so the cell offsets are no longer valid
+    cellParticleOffsets.clear();
+}
+
+void ablate::particles::ParticleSolver::GroupParticlesByCell(PetscInt cStart, PetscInt cEnd, std::vector<PetscInt> &binOffsets, std::vector<PetscInt> &groupedParticles) const {
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    const PetscInt numberCells = cEnd - cStart;
+
+    // the cell id is updated by the migration, particles without a local cell are placed in the last bin
+    PetscInt *cellIds;
+    DMSwarmGetField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void **)&cellIds) >> checkError;
+    auto cellBin = [cellIds, cStart, cEnd, numberCells](PetscInt p) { return cellIds[p] >= cStart && cellIds[p] < cEnd ? cellIds[p] - cStart : numberCells; };
+
+    // counting sort of the particles by cell
+    binOffsets.assign(numberCells + 2, 0);
+    for (PetscInt p = 0; p < np; ++p) {
+        binOffsets[cellBin(p) + 1]++;
+    }
+    std::partial_sum(binOffsets.begin(), binOffsets.end(), binOffsets.begin());
+    std::vector<PetscInt> nextInBin(binOffsets.begin(), binOffsets.end() - 1);
+    groupedParticles.resize(np);
+    for (PetscInt p = 0; p < np; ++p) {
+        groupedParticles[nextInBin[cellBin(p)]++] = p;
+    }
+    DMSwarmRestoreField(swarmDm, DMSwarmPICField_cellid, nullptr, nullptr, (void **)&cellIds) >> checkError;
+}
+
+void ablate::particles::ParticleSolver::BalanceParcels() {
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(subDomain->GetDM(), 0, &cStart, &cEnd) >> checkError;
+    std::vector<PetscInt> binOffsets;
+    std::vector<PetscInt> groupedParticles;
+    GroupParticlesByCell(cStart, cEnd, binOffsets, groupedParticles);
+
+    // plan the merges (the second particle is merged into the first) and splits in each cell on a copy of the weights
+    std::vector<PetscReal> weights(np);
+    {
+        PetscReal *weightArray;
+        DMSwarmGetField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weightArray) >> checkError;
+        std::copy(weightArray, weightArray + np, weights.begin());
+        DMSwarmRestoreField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weightArray) >> checkError;
+    }
+    std::vector<PetscReal> plannedWeights = weights;
+    std::vector<std::pair<PetscInt, PetscInt>> merges;
+    std::vector<std::pair<PetscInt, PetscReal>> splits;  // the particle to copy and the weight of the copy
+    std::vector<PetscInt> cellParticles;
+    for (PetscInt c = 0; c < cEnd - cStart; ++c) {
+        PetscInt count = binOffsets[c + 1] - binOffsets[c];
+        if (maxParcelsPerCell > 0 && count > maxParcelsPerCell) {
+            // merge the lightest pairs until the cell is within bounds
+            cellParticles.assign(groupedParticles.begin() + binOffsets[c], groupedParticles.begin() + binOffsets[c + 1]);
+            while (count > maxParcelsPerCell) {
+                std::sort(cellParticles.begin(), cellParticles.end(), [&plannedWeights](PetscInt a, PetscInt b) { return plannedWeights[a] < plannedWeights[b]; });
+                const PetscInt numberMerges = PetscMin(count - maxParcelsPerCell, count / 2);
+                for (PetscInt m = 0; m < numberMerges; ++m) {
+                    merges.emplace_back(cellParticles[2 * m], cellParticles[2 * m + 1]);
+                    plannedWeights[cellParticles[2 * m]] += plannedWeights[cellParticles[2 * m + 1]];
+                    cellParticles[2 * m + 1] = -1;
+                }
+                cellParticles.erase(std::remove(cellParticles.begin(), cellParticles.end(), -1), cellParticles.end());
+                count = (PetscInt)cellParticles.size();
+            }
+        } else if (count > 0 && count < minParcelsPerCell) {
+            // split the heaviest parcel in half until the cell is within bounds, the copies share the state of the original parcel
+            std::vector<std::pair<PetscReal, PetscInt>> parcels;
+            for (PetscInt i = binOffsets[c]; i < binOffsets[c + 1]; ++i) {
+                parcels.emplace_back(plannedWeights[groupedParticles[i]], groupedParticles[i]);
+            }
+            std::make_heap(parcels.begin(), parcels.end());
+            while ((PetscInt)parcels.size() < minParcelsPerCell) {
+                std::pop_heap(parcels.begin(), parcels.end());
+                parcels.back().first /= 2.0;
+                parcels.push_back(parcels.back());
+                std::push_heap(parcels.begin(), parcels.end() - 1);
+                std::push_heap(parcels.begin(), parcels.end());
+            }
+
+            // the original parcel keeps the weight of its first copy
+            std::set<PetscInt> updated;
+            for (const auto &[weight, source] : parcels) {
+                if (updated.insert(source).second) {
+                    plannedWeights[source] = weight;
+                } else {
+                    splits.emplace_back(source, weight);
+                }
+            }
+        }
+    }
+
+    // replace the state of each merged parcel with the weighted average, the merges are applied in order so a parcel can be merged more than once
+    const auto swarmFields = GetSwarmFieldNames();
+    if (!merges.empty()) {
+        for (const auto &swarmField : swarmFields) {
+            PetscInt blockSize;
+            PetscDataType dataType;
+            DMSwarmGetFieldInfo(swarmDm, swarmField.c_str(), &blockSize, &dataType) >> checkError;
+            if (dataType != PETSC_REAL || swarmField == ParticleWeight) {
+                continue;
+            }
+            std::vector<PetscReal> mergeWeights = weights;
+            PetscReal *data;
+            DMSwarmGetField(swarmDm, swarmField.c_str(), nullptr, nullptr, (void **)&data) >> checkError;
+            for (const auto &[keep, remove] : merges) {
+                const PetscReal mergedWeight = mergeWeights[keep] + mergeWeights[remove];
+                for (PetscInt b = 0; b < blockSize; ++b) {
+                    data[keep * blockSize + b] = (mergeWeights[keep] * data[keep * blockSize + b] + mergeWeights[remove] * data[remove * blockSize + b]) / mergedWeight;
+                }
+                mergeWeights[keep] = mergedWeight;
+            }
+            DMSwarmRestoreField(swarmDm, swarmField.c_str(), nullptr, nullptr, (void **)&data) >> checkError;
+        }
+    }
+    {
+        PetscReal *weightArray;
+        DMSwarmGetField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weightArray) >> checkError;
+        std::copy(plannedWeights.begin(), plannedWeights.end(), weightArray);
+        DMSwarmRestoreField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weightArray) >> checkError;
+    }
+
+    // the split parcels are given new unique ids after the largest id on any rank.  This is collective because every rank uses the same parcel bounds.
+    PetscInt64 splitPidStart = 0;
+    if (minParcelsPerCell > 0) {
+        MPI_Comm comm = PetscObjectComm((PetscObject)swarmDm);
+        PetscInt64 *pids;
+        DMSwarmGetField(swarmDm, DMSwarmField_pid, nullptr, nullptr, (void **)&pids) >> checkError;
+        PetscInt64 maxPid = np > 0 ? *std::max_element(pids, pids + np) : -1;
+        DMSwarmRestoreField(swarmDm, DMSwarmField_pid, nullptr, nullptr, (void **)&pids) >> checkError;
+        MPI_Allreduce(MPI_IN_PLACE, &maxPid, 1, MPIU_INT64, MPI_MAX, comm) >> checkMpiError;
+
+        PetscMPIInt rank;
+        MPI_Comm_rank(comm, &rank) >> checkMpiError;
+        PetscInt64 numberSplits = (PetscInt64)splits.size();
+        PetscInt64 splitOffset = 0;
+        MPI_Exscan(&numberSplits, &splitOffset, 1, MPIU_INT64, MPI_SUM, comm) >> checkMpiError;
+        splitPidStart = maxPid + 1 + (rank == 0 ? 0 : splitOffset);
+    }
+
+    // copy the split parcels into new particles at the end of the swarm
+    if (!splits.empty()) {
+        DMSwarmAddNPoints(swarmDm, (PetscInt)splits.size()) >> checkError;
+        for (const auto &swarmField : swarmFields) {
+            PetscInt blockSize;
+            PetscDataType dataType;
+            DMSwarmGetFieldInfo(swarmDm, swarmField.c_str(), &blockSize, &dataType) >> checkError;
+            std::size_t typeSize;
+            PetscDataTypeGetSize(dataType, &typeSize) >> checkError;
+            const std::size_t particleSize = blockSize * typeSize;
+            char *data;
+            DMSwarmGetField(swarmDm, swarmField.c_str(), nullptr, nullptr, (void **)&data) >> checkError;
+            for (std::size_t s = 0; s < splits.size(); ++s) {
+                PetscMemcpy(data + (np + s) * particleSize, data + splits[s].first * particleSize, particleSize) >> checkError;
+            }
+            DMSwarmRestoreField(swarmDm, swarmField.c_str(), nullptr, nullptr, (void **)&data) >> checkError;
+        }
+        PetscReal *weightArray;
+        DMSwarmGetField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weightArray) >> checkError;
+        for (std::size_t s = 0; s < splits.size(); ++s) {
+            weightArray[np + s] = splits[s].second;
+        }
+        DMSwarmRestoreField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weightArray) >> checkError;
+        PetscInt64 *pids;
+        DMSwarmGetField(swarmDm, DMSwarmField_pid, nullptr, nullptr, (void **)&pids) >> checkError;
+        for (std::size_t s = 0; s < splits.size(); ++s) {
+            pids[np + s] = splitPidStart + (PetscInt64)s;
+        }
+        DMSwarmRestoreField(swarmDm, DMSwarmField_pid, nullptr, nullptr, (void **)&pids) >> checkError;
+    }
+
+    // remove the merged particles from the highest index
+    std::vector<PetscInt> removeParticles;
+    for (const auto &merge : merges) {
+        removeParticles.push_back(merge.second);
+    }
+    std::sort(removeParticles.rbegin(), removeParticles.rend());
+    for (const auto &p : removeParticles) {
+        DMSwarmRemovePointAtIndex(swarmDm, p) >> checkError;
+    }
+
+    // every rank must reset the particle ts if any rank changed size
+    PetscMPIInt changedLocal = !merges.empty() || !splits.empty();
+    PetscMPIInt changedAll = 0;
+    MPI_Allreduce(&changedLocal, &changedAll, 1, MPI_INT, MPI_MAX, subDomain->GetComm()) >> checkMpiError;
+    if (changedAll) {
+        dmChanged = true;
+        cellParticleOffsets.clear();
+    }
+}
+
+void ablate::particles::ParticleSolver::SortParticlesByCell() {
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(subDomain->GetDM(), 0, &cStart, &cEnd) >> checkError;
+
+    // group the particles by cell, this keeps the current order in each cell
+    std::vector<PetscInt> binOffsets;
+    std::vector<PetscInt> sortedParticles;
+    GroupParticlesByCell(cStart, cEnd, binOffsets, sortedParticles);
+
+    // permute every swarm field
+    const auto swarmFields = GetSwarmFieldNames();
+    std::vector<char> buffer;
+    for (const auto &swarmField : swarmFields) {
+        PetscInt blockSize;
+        PetscDataType dataType;
+        char *data;
+        DMSwarmGetField(swarmDm, swarmField.c_str(), &blockSize, &dataType, (void **)&data) >> checkError;
+        std::size_t typeSize;
+        PetscDataTypeGetSize(dataType, &typeSize) >> checkError;
+        const std::size_t particleSize = blockSize * typeSize;
+
+        buffer.assign(data, data + np * particleSize);
+        for (PetscInt p = 0; p < np; ++p) {
+            PetscMemcpy(data + p * particleSize, buffer.data() + sortedParticles[p] * particleSize, particleSize) >> checkError;
+        }
+        DMSwarmRestoreField(swarmDm, swarmField.c_str(), &blockSize, &dataType, (void **)&data) >> checkError;
+    }
+
+    // store the start of each cell
+    binOffsets.pop_back();
+    cellParticleOffsets = std::move(binOffsets);
+
+    // every rank sorts at the same step so the particle ts can be reset on every rank
+    dmChanged = true;
+}
+
+void ablate::particles::ParticleSolver::DepositEulerianSource(PetscReal time, DM dm, PetscInt eulerFieldId, const std::vector<PetscReal> &cellVolumes, Vec locSourceVec) {
+    PetscInt np;
+    DMSwarmGetLocalSize(swarmDm, &np) >> checkError;
+    const PetscInt sourceSize = ndims + finiteVolume::CompressibleFlowFields::RHOU;
+    std::vector<PetscReal> particleSource(np * sourceSize, 0.0);
+
+    // compute the source of each particle from the current swarm state
+    Vec solutionVector;
+    DMSwarmCreateGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> checkError;
+    {
+        auto cachePointData = processes.size() != 1;
+        accessors::SwarmAccessor swarmAccessor(cachePointData, swarmDm, fieldsMap, solutionVector);
+        accessors::EulerianAccessor eulerianAccessor(cachePointData, subDomain, swarmAccessor, time);
+        for (auto &process : processes) {
+            process->ComputeEulerianSource(time, swarmAccessor, eulerianAccessor, particleSource.data());
+        }
+    }
+    DMSwarmDestroyGlobalVectorFromField(swarmDm, PackedSolution, &solutionVector) >> checkError;
+
+    // each parcel represents weight physical particles
+    if (HasField(ParticleWeight)) {
+        const PetscReal *weights;
+        DMSwarmGetField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weights) >> checkError;
+        for (PetscInt p = 0; p < np; ++p) {
+            for (PetscInt s = 0; s < sourceSize; ++s) {
+                particleSource[p * sourceSize + s] *= weights[p];
+            }
+        }
+        DMSwarmRestoreField(swarmDm, ParticleWeight, nullptr, nullptr, (void **)&weights) >> checkError;
+    }
+
+    // group the particles by cell so that each cell is accumulated by one thread
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> checkError;
+    std::vector<PetscInt> cellOffsets;
+    std::vector<PetscInt> cellParticles;
+    GroupParticlesByCell(cStart, cEnd, cellOffsets, cellParticles);
+
+    // add the source per unit volume to the euler field in each cell
+    PetscScalar *sourceArray;
+    VecGetArray(locSourceVec, &sourceArray) >> checkError;
+    auto depositCellSource = [&](std::size_t start, std::size_t end, std::size_t) {
+        for (std::size_t c = start; c < end; ++c) {
+            if (cellOffsets[c] == cellOffsets[c + 1]) {
+                continue;
+            }
+            PetscScalar *cellSource = nullptr;
+            DMPlexPointLocalFieldRef(dm, cStart + (PetscInt)c, eulerFieldId, sourceArray, &cellSource) >> checkError;
+            if (!cellSource) {
+                continue;
+            }
+            for (PetscInt i = cellOffsets[c]; i < cellOffsets[c + 1]; ++i) {
+                const PetscReal *source = particleSource.data() + cellParticles[i] * sourceSize;
+                for (PetscInt s = 0; s < sourceSize; ++s) {
+                    cellSource[s] += source[s] / cellVolumes[c];
+                }
+            }
+        }
+    };
+    // the deposit calls petsc, so it is only threaded when petsc can be called from the helper threads
+    if (utilities::KokkosUtilities::PetscThreadSafe()) {
+        utilities::KokkosUtilities::ParallelForChunks(cEnd - cStart, depositCellSource);
+    } else {
+        depositCellSource(0, cEnd - cStart, 0);
+    }
+    VecRestoreArray(locSourceVec, &sourceArray) >> checkError;
 }
 
 void ablate::particles::ParticleSolver::MacroStepParticles(TS macroTS) {
+    // the particles may be advanced over several flow steps
+    if (++stepsSinceAdvance < advanceInterval) {
+        return;
+    }
+    stepsSinceAdvance = 0;
+
     // if the dm has changed size (new particles, particles moved between ranks, particles deleted) reset the ts
     if (dmChanged) {
         TSReset(particleTs) >> checkError;
@@ -429,6 +1020,17 @@ void ablate::particles::ParticleSolver::MacroStepParticles(TS macroTS) {
 
     // Migrate any particles that have moved
     SwarmMigrate();
+
+    // keep the number of parcels in each cell within bounds
+    if (minParcelsPerCell > 0 || maxParcelsPerCell > 0) {
+        BalanceParcels();
+    }
+
+    // Periodically store the particles in cell order so the eulerian data is accessed contiguously
+    if (sortInterval > 0 && ++stepsSinceSort >= sortInterval) {
+        SortParticlesByCell();
+        stepsSinceSort = 0;
+    }
 }
 void ablate::particles::ParticleSolver::CoordinatesToSolutionVector() {
     // Get the local number of particles
@@ -569,7 +1171,7 @@ PetscErrorCode ablate::particles::ParticleSolver::ComputeParticleExactSolution(T
     PetscFunctionReturn(0);
 }
 
-static PetscErrorCode DMSequenceViewTimeHDF5(DM dm, PetscViewer viewer) {
+PetscErrorCode ablate::particles::ParticleSolver::DMSequenceViewTimeHDF5(DM dm, PetscViewer viewer) {
     Vec stamp;
     PetscMPIInt rank;
     PetscErrorCode ierr;
@@ -622,7 +1224,14 @@ void ablate::particles::ParticleSolver::Save(PetscViewer viewer, PetscInt steps,
     // if this is an hdf5Viewer
     PetscBool ishdf5;
     PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5) >> checkError;
+    PetscBool viewerCollective = PETSC_FALSE, viewerCompress = PETSC_FALSE;
     if (ishdf5) {
+        // write the particle fields with collective mpi-io and optionally compress the chunked datasets
+        PetscViewerHDF5GetCollective(viewer, &viewerCollective) >> checkError;
+        PetscViewerHDF5GetCompress(viewer, &viewerCompress) >> checkError;
+        PetscViewerHDF5SetCollective(viewer, PETSC_TRUE) >> checkError;
+        PetscViewerHDF5SetCompress(viewer, compressOutput ? PETSC_TRUE : viewerCompress) >> checkError;
+
         PetscBool isInTimestepping;
         PetscViewerHDF5IsTimestepping(viewer, &isInTimestepping) >> checkError;
         if (!isInTimestepping) {
@@ -679,6 +1288,10 @@ void ablate::particles::ParticleSolver::Save(PetscViewer viewer, PetscInt steps,
 
     if (ishdf5) {
         DMSequenceViewTimeHDF5(GetParticleDM(), viewer) >> checkError;
+
+        // restore the viewer settings for the other serializable objects
+        PetscViewerHDF5SetCollective(viewer, viewerCollective) >> checkError;
+        PetscViewerHDF5SetCompress(viewer, viewerCompress) >> checkError;
     }
     PetscFunctionReturnVoid();
 }
@@ -692,7 +1305,11 @@ void ablate::particles::ParticleSolver::Restore(PetscViewer viewer, PetscInt seq
     // There is not a hdf5 specific swarm vec load, so that needs to be in this code
     PetscBool ishdf5;
     PetscObjectTypeCompare((PetscObject)viewer, PETSCVIEWERHDF5, &ishdf5) >> checkError;
+    PetscBool viewerCollective = PETSC_FALSE;
     if (ishdf5) {
+        // read the particle fields with collective mpi-io
+        PetscViewerHDF5GetCollective(viewer, &viewerCollective) >> checkError;
+        PetscViewerHDF5SetCollective(viewer, PETSC_TRUE) >> checkError;
         PetscViewerHDF5PushTimestepping(viewer) >> checkError;
         PetscViewerHDF5SetTimestep(viewer, sequenceNumber) >> checkError;
     }
@@ -774,6 +1391,7 @@ void ablate::particles::ParticleSolver::Restore(PetscViewer viewer, PetscInt seq
     if (ishdf5) {
         PetscViewerHDF5PopGroup(viewer) >> checkError;
         PetscViewerHDF5PopTimestepping(viewer) >> checkError;
+        PetscViewerHDF5SetCollective(viewer, viewerCollective) >> checkError;
     }
 
     // Migrate the particle to the correct rank for the dmPlex
@@ -789,4 +1407,10 @@ REGISTER(ablate::solver::Solver, ablate::particles::ParticleSolver, "Lagrangian
          ARG(std::vector<ablate::particles::processes::Process>, "processes", "the processes used to describe the particle source terms"),
          ARG(ablate::particles::initializers::Initializer, "initializer", "the initial particle setup methods"),
          OPT(std::vector<ablate::mathFunctions::FieldFunction>, "fieldInitialization", "the initial particle fields values"),
-         OPT(std::vector<ablate::mathFunctions::FieldFunction>, "exactSolutions", "particle fields (SOL) exact solutions"));
\ No newline at end of file
+         OPT(std::vector<ablate::mathFunctions::FieldFunction>, "exactSolutions", "particle fields (SOL) exact solutions"),
+         OPT(int, "sortInterval", "reorder the particle storage by owning cell every sortInterval steps so the eulerian data is accessed contiguously (default is 0, never)"),
+         OPT(int, "advanceInterval", "advance the particles every advanceInterval flow steps, for tracer particles that do not need to be updated each flow step (default is 1)"),
+         OPT(bool, "neighborMigration", "send particles that moved into the overlap directly to the neighbor rank instead of the global DMSwarmMigrate (default is false)"),
+         OPT(int, "minParcelsPerCell", "split the heaviest parcels in cells with fewer parcels, the ParticleWeight field is added if needed (default is 0)"),
+         OPT(int, "maxParcelsPerCell", "merge the lightest parcels in cells with more parcels, the ParticleWeight field is added if needed (default is 0)"),
+         OPT(bool, "compressOutput", "compress the chunked hdf5 particle datasets (default is false)"));
\ No newline at end of file
@@ -17,6 +17,8 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
     inline static const char ParticleDensity[] = "ParticleDensity";
     inline static const char PackedSolution[] = "PackedSolution";
     inline static const char ParticleInitialLocation[] = "InitialLocation";
+    //! the number of physical particles represented by each parcel, each particle is a single physical particle if not provided
+    inline static const char ParticleWeight[] = "ParticleWeight";
 
     //! These coordinates are part of the solution vector
     inline static const char ParticleCoordinates[] = "coordinates";
@@ -61,6 +63,34 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
     //! store the exact solution if provided
     const std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions;
 
+    //! reorder the particle storage by owning cell every sortInterval macro steps, 0 disables the reorder
+    const PetscInt sortInterval;
+
+    //! the number of macro steps since the last reorder
+    PetscInt stepsSinceSort = 0;
+
+    //! advance the particles every advanceInterval flow steps
+    const PetscInt advanceInterval;
+
+    //! the number of flow steps since the particles were last advanced
+    PetscInt stepsSinceAdvance = 0;
+
+    //! send particles that moved into the overlap directly to the owning neighbor rank instead of calling DMSwarmMigrate
+    const bool neighborMigration;
+
+    //! split or merge parcels to keep the number of parcels in each cell in [minParcelsPerCell, maxParcelsPerCell], 0 disables the bound
+    const PetscInt minParcelsPerCell;
+    const PetscInt maxParcelsPerCell;
+
+    //! compress the chunked hdf5 particle datasets
+    const bool compressOutput;
+
+    //! the type of migration needed after locating the particles, ordered so that the max over the ranks is the required migration
+    enum class MigrationType : PetscMPIInt { NONE = 0, NEIGHBOR = 1, GLOBAL = 2 };
+
+    //! the offset of the first particle in each local cell (offset by cStart) after the last reorder, particles without a local cell are stored after the last cell
+    std::vector<PetscInt> cellParticleOffsets;
+
    public:
     /**
      * default constructor
@@ -71,10 +101,18 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      * @param initializer
      * @param fieldInitialization
      * @param exactSolutions
+     * @param sortInterval reorder the particle storage by owning cell every sortInterval macro steps, 0 disables the reorder
+     * @param advanceInterval advance the particles every advanceInterval flow steps
+     * @param neighborMigration send particles that moved into the overlap directly to the owning neighbor rank
+     * @param minParcelsPerCell split the heaviest parcels in cells with fewer parcels, 0 disables splitting
+     * @param maxParcelsPerCell merge the lightest parcels in cells with more parcels, 0 disables merging
+     * @param compressOutput compress the chunked hdf5 particle datasets
      */
     ParticleSolver(std::string solverId, std::shared_ptr<domain::Region>, std::shared_ptr<parameters::Parameters> options, std::vector<FieldDescription> fields,
                    std::vector<std::shared_ptr<processes::Process>> processes, std::shared_ptr<initializers::Initializer> initializer,
-                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {});
+                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {},
+                   int sortInterval = 0, int advanceInterval = 1, bool neighborMigration = false, int minParcelsPerCell = 0, int maxParcelsPerCell = 0,
+                   bool compressOutput = false);
 
     /**
      * shared pointer version of the constructor
@@ -85,10 +123,18 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      * @param initializer
      * @param fieldInitialization
      * @param exactSolutions
+     * @param sortInterval reorder the particle storage by owning cell every sortInterval macro steps, 0 disables the reorder
+     * @param advanceInterval advance the particles every advanceInterval flow steps
+     * @param neighborMigration send particles that moved into the overlap directly to the owning neighbor rank
+     * @param minParcelsPerCell split the heaviest parcels in cells with fewer parcels, 0 disables splitting
+     * @param maxParcelsPerCell merge the lightest parcels in cells with more parcels, 0 disables merging
+     * @param compressOutput compress the chunked hdf5 particle datasets
      */
     ParticleSolver(std::string solverId, std::shared_ptr<domain::Region>, std::shared_ptr<parameters::Parameters> options, const std::vector<std::shared_ptr<FieldDescription>>& fields,
                    std::vector<std::shared_ptr<processes::Process>> processes, std::shared_ptr<initializers::Initializer> initializer,
-                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {});
+                   std::vector<std::shared_ptr<mathFunctions::FieldFunction>> fieldInitialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {},
+                   int sortInterval = 0, int advanceInterval = 1, bool neighborMigration = false, int minParcelsPerCell = 0, int maxParcelsPerCell = 0,
+                   bool compressOutput = false);
 
     ~ParticleSolver() override;
 
@@ -98,6 +144,12 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
     /*** Set up mesh dependent initialization, this may be called multiple times if the mesh changes **/
     void Initialize() override;
 
+    /**
+     * Add each particle field in the swarm to the memory usage
+     * @param memoryUsage
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) override;
+
     /**
      * Function to be be called after each flow time step
      */
@@ -115,6 +167,24 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      */
     inline TS GetParticleTS() { return particleTs; }
 
+    /**
+     * The offset of the first particle in each local cell (cell - cStart) after the last reorder.  The particles in a cell are stored contiguously from cellParticleOffsets[c] to
+     * cellParticleOffsets[c + 1].  This is empty if the particles have not been reordered since the last migration.
+     * @return the cell to particle offsets
+     */
+    [[nodiscard]] inline const std::vector<PetscInt>& GetCellParticleOffsets() const { return cellParticleOffsets; }
+
+    /**
+     * Compute the mass, energy, and momentum source of each particle on the flow from the processes and add it per unit volume to the euler field of the local vector.  The particles are
+     * grouped by cell so that the cells are accumulated concurrently without conflicts, the ghost cell contributions are summed by the local to global ADD of the flow rhs.
+     * @param time the flow time
+     * @param dm the flow dm, this must share the mesh with the particle cell dm
+     * @param eulerFieldId the euler field in the dm
+     * @param cellVolumes the volume of each cell offset by cStart
+     * @param locSourceVec the local vector that the source is added to
+     */
+    void DepositEulerianSource(PetscReal time, DM dm, PetscInt eulerFieldId, const std::vector<PetscReal>& cellVolumes, Vec locSourceVec);
+
     /**
      * Helper function useful for tests
      * @param particleTS
@@ -146,6 +216,13 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      */
     void Restore(PetscViewer viewer, PetscInt steps, PetscReal time) override;
 
+    /**
+     * Write the time of the current dm output sequence number to the hdf5 viewer, this matches the petsc internal function used for the plex output
+     * @param dm
+     * @param viewer
+     */
+    static PetscErrorCode DMSequenceViewTimeHDF5(DM dm, PetscViewer viewer);
+
    private:
     /**
      * The register fields adds the field to the swarm
@@ -173,10 +250,50 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
     void ProjectFunction(const std::shared_ptr<mathFunctions::FieldFunction>& fieldFunction, PetscReal time = 0.0);
 
     /**
-     * Migrate the particle between ranks based upon the background mesh
+     * Migrate the particle between ranks based upon the background mesh.  The migration is skipped if every particle is still in a locally owned cell.
      */
     void SwarmMigrate();
 
+    /**
+     * Locate the local particles in the background mesh and update the cell id.  The current cell id is used as the first guess so only the particles that left their cell are searched.
+     * @param destinations the owning rank and cell on that rank for each particle in a cell owned by another rank, the rank is -1 for particles that stay on this rank
+     * @return the migration needed on this rank
+     */
+    MigrationType LocateParticles(std::vector<PetscSFNode>& destinations);
+
+    /**
+     * Send the particles in overlap cells to the neighbor rank that owns the cell.  Only the ranks that share points in the point sf communicate.  This must be called on every rank.
+     * @param destinations the owning rank and cell on that rank from LocateParticles
+     */
+    void NeighborMigrate(const std::vector<PetscSFNode>& destinations);
+
+    /**
+     * The name of every field stored in the swarm, the sol fields are stored in the PackedSolution
+     */
+    [[nodiscard]] std::vector<std::string> GetSwarmFieldNames() const;
+
+    /**
+     * Merge the lightest parcels in cells with more than maxParcelsPerCell parcels and split the heaviest parcels in cells with fewer than minParcelsPerCell parcels.  Merged parcels take the
+     * weighted average of every real field and the sum of the weights, split parcels are copies that share the weight and are given a new unique id.  This must be called on every rank
+     * after the migration.
+     */
+    void BalanceParcels();
+
+    /**
+     * Reorder the particle storage so that the particles in each cell are contiguous and build the cellParticleOffsets
+     */
+    void SortParticlesByCell();
+
+    /**
+     * Group the local particles by cell with a stable counting sort.  The particles in cell c are groupedParticles[binOffsets[c - cStart]] to groupedParticles[binOffsets[c - cStart + 1]],
+     * particles without a cell in [cStart, cEnd) are placed in the last bin
+     * @param cStart
+     * @param cEnd
+     * @param binOffsets the start of each bin (cEnd - cStart + 2 values)
+     * @param groupedParticles the particle indices ordered by cell
+     */
+    void GroupParticlesByCell(PetscInt cStart, PetscInt cEnd, std::vector<PetscInt>& binOffsets, std::vector<PetscInt>& groupedParticles) const;
+
     /**
      * map the coordinates to the solution vector
      */
@@ -240,6 +357,16 @@ class ParticleSolver : public solver::Solver, public io::Serializable {
      */
     [[nodiscard]] const Field& GetField(const std::string& fieldName) const { return fieldsMap.at(fieldName); }
 
+    /**
+     * Check if the field exists in the particle solver
+     */
+    [[nodiscard]] inline bool HasField(const std::string& fieldName) const { return fieldsMap.count(fieldName) > 0; }
+
+    /**
+     * Get all fields in the particle solver
+     */
+    [[nodiscard]] inline const std::vector<Field>& GetFields() const { return fields; }
+
     /**
      * computes the particle rhs for the particle TS
      * @param ts
@@ -10,6 +10,33 @@ class DragModel {
     virtual void ComputeDragForce(const PetscInt dim, const PetscReal *partVel, const PetscReal *flowVel, const PetscReal muF, const PetscReal rhoF, const PetscReal partDiam,
                                   PetscReal *dragForce) = 0;
 
+    /**
+     * Computes the drag force for np particles stored as struct-of-arrays.  The vector quantities are stored component major (partVel[n * np + p]) so that each loop over the particles
+     * is contiguous and can be vectorized.  The default implementation calls ComputeDragForce for each particle.
+     * @param dim the number of dimensions
+     * @param np the number of particles
+     * @param partVel the particle velocity (dim * np)
+     * @param flowVel the flow velocity at each particle (dim * np)
+     * @param muF the flow viscosity at each particle (np)
+     * @param rhoF the flow density at each particle (np)
+     * @param partDiam the particle diameter (np)
+     * @param dragForce the computed drag force (dim * np)
+     */
+    virtual void ComputeDragForces(const PetscInt dim, const PetscInt np, const PetscReal *partVel, const PetscReal *flowVel, const PetscReal *muF, const PetscReal *rhoF,
+                                   const PetscReal *partDiam, PetscReal *dragForce) {
+        PetscReal partVelP[3], flowVelP[3], dragForceP[3];
+        for (PetscInt p = 0; p < np; p++) {
+            for (PetscInt n = 0; n < dim; n++) {
+                partVelP[n] = partVel[n * np + p];
+                flowVelP[n] = flowVel[n * np + p];
+            }
+            ComputeDragForce(dim, partVelP, flowVelP, muF[p], rhoF[p], partDiam[p], dragForceP);
+            for (PetscInt n = 0; n < dim; n++) {
+                dragForce[n * np + p] = dragForceP[n];
+            }
+        }
+    }
+
     virtual ~DragModel() = default;
 };
 
@@ -19,5 +19,18 @@ void ablate::particles::processes::drag::Linear::ComputeDragForce(const PetscInt
     }
 };
 
+void ablate::particles::processes::drag::Linear::ComputeDragForces(const PetscInt dim, const PetscInt np, const PetscReal *__restrict partVel, const PetscReal *__restrict flowVel,
+                                                                   const PetscReal *__restrict muF, const PetscReal *, const PetscReal *__restrict partDiam, PetscReal *__restrict dragForce) {
+    // each component is a contiguous loop over the particles
+    for (PetscInt n = 0; n < dim; n++) {
+        const PetscReal *__restrict partVelN = partVel + n * np;
+        const PetscReal *__restrict flowVelN = flowVel + n * np;
+        PetscReal *__restrict dragForceN = dragForce + n * np;
+        for (PetscInt p = 0; p < np; p++) {
+            dragForceN[p] = -3.0 * PETSC_PI * partDiam[p] * muF[p] * (partVelN[p] - flowVelN[p]);
+        }
+    }
+}
+
 #include "registrar.hpp"
 REGISTER_WITHOUT_ARGUMENTS(ablate::particles::processes::drag::DragModel, ablate::particles::processes::drag::Linear, "Computes drag according to Stokes' law.");
\ No newline at end of file
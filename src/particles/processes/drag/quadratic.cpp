@@ -29,6 +29,26 @@ void ablate::particles::processes::drag::Quadratic::ComputeDragForce(const Petsc
     }
 };
 
+void ablate::particles::processes::drag::Quadratic::ComputeDragForces(const PetscInt dim, const PetscInt np, const PetscReal *__restrict partVel, const PetscReal *__restrict flowVel,
+                                                                      const PetscReal *, const PetscReal *__restrict rhoF, const PetscReal *__restrict partDiam, PetscReal *__restrict dragForce) {
+    // store the relative velocity in the drag force
+    for (PetscInt i = 0; i < dim * np; i++) {
+        dragForce[i] = partVel[i] - flowVel[i];
+    }
+
+    // scale each component by the prefactor and the magnitude of the relative velocity
+    for (PetscInt p = 0; p < np; p++) {
+        PetscReal relVelSqr = 0.0;
+        for (PetscInt n = 0; n < dim; n++) {
+            relVelSqr += PetscSqr(dragForce[n * np + p]);
+        }
+        const PetscReal dragForcePrefactor = -0.42 * (PETSC_PI / 8.0) * partDiam[p] * partDiam[p] * rhoF[p] * PetscSqrtReal(relVelSqr);
+        for (PetscInt n = 0; n < dim; n++) {
+            dragForce[n * np + p] *= dragForcePrefactor;
+        }
+    }
+}
+
 #include "registrar.hpp"
 REGISTER_WITHOUT_ARGUMENTS(ablate::particles::processes::drag::DragModel, ablate::particles::processes::drag::Quadratic,
                            "Computes drag according to a high Reynolds number drag model for solid spheres.");
\ No newline at end of file
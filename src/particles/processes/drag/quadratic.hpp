@@ -8,6 +8,12 @@ namespace ablate::particles::processes::drag {
 class Quadratic : public DragModel {
    public:
     void ComputeDragForce(const PetscInt dim, const PetscReal *partVel, const PetscReal *flowVel, const PetscReal muF, const PetscReal rhoF, const PetscReal partDiam, PetscReal *dragForce) override;
+
+    /**
+     * Computes the drag force for np particles stored as struct-of-arrays
+     */
+    void ComputeDragForces(const PetscInt dim, const PetscInt np, const PetscReal *partVel, const PetscReal *flowVel, const PetscReal *muF, const PetscReal *rhoF, const PetscReal *partDiam,
+                           PetscReal *dragForce) override;
 };
 
 }  // namespace ablate::particles::processes::drag
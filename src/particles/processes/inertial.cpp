@@ -1,19 +1,51 @@
 #include "inertial.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
 #include "particles/particleSolver.hpp"
-ablate::particles::processes::Inertial::Inertial(std::shared_ptr<parameters::Parameters> parameters, const std::string& eulerianVelocityFieldIn)
+#include "utilities/kokkosUtilities.hpp"
+ablate::particles::processes::Inertial::Inertial(std::shared_ptr<parameters::Parameters> parameters, const std::string& eulerianVelocityFieldIn, std::shared_ptr<drag::DragModel> dragModel)
     : fluidDensity(parameters->GetExpect<PetscReal>("fluidDensity")),
       fluidViscosity(parameters->GetExpect<PetscReal>("fluidViscosity")),
       gravityField(parameters->GetExpect<std::array<PetscReal, 3>>("gravityField")),
-      eulerianVelocityField(eulerianVelocityFieldIn.empty() ? "velocity" : eulerianVelocityFieldIn)
+      eulerianVelocityField(eulerianVelocityFieldIn.empty() ? "velocity" : eulerianVelocityFieldIn),
+      dragModel(std::move(dragModel))
 
 {}
+PetscReal ablate::particles::processes::Inertial::ComputeDragRate(PetscInt dim, const PetscReal* fluidVel, const PetscReal* partVel, PetscReal partDiam, PetscReal partDens) const {
+    PetscReal rep = 0.0;
+    for (PetscInt n = 0; n < dim; n++) {
+        rep += fluidDensity * PetscSqr(fluidVel[n] - partVel[n]) * partDiam / fluidViscosity;
+    }
+    // Correction factor to account for finite Rep on Stokes drag (see Schiller-Naumann drag closure)
+    PetscReal corFactor = 1.0 + 0.15 * PetscPowReal(PetscSqrtReal(rep), 0.687);
+    if (rep < 0.1) {
+        corFactor = 1.0;  // returns Stokes drag for low speed particles
+    }
+    const PetscScalar tauP = partDens * PetscSqr(partDiam) / (18.0 * fluidViscosity);  // particle relaxation time
+    return corFactor / tauP;
+}
+
+void ablate::particles::processes::Inertial::ComputeModelDragForces(PetscInt dim, PetscInt start, PetscInt end, const accessors::ConstPointData& fluidVel, const accessors::ConstPointData& partVel,
+                                                                    const accessors::ConstPointData& partDiam, std::vector<PetscReal>& dragForce) const {
+    // pack the particle values component major for the batched drag model
+    const PetscInt np = end - start;
+    std::vector<PetscReal> partVelSoA(dim * np), flowVelSoA(dim * np), muF(np, fluidViscosity), rhoF(np, fluidDensity), diameter(np);
+    for (PetscInt p = 0; p < np; ++p) {
+        for (PetscInt n = 0; n < dim; n++) {
+            partVelSoA[n * np + p] = partVel[start + p][n];
+            flowVelSoA[n * np + p] = fluidVel[start + p][n];
+        }
+        diameter[p] = *partDiam[start + p];
+    }
+    dragForce.resize(dim * np);
+    dragModel->ComputeDragForces(dim, np, partVelSoA.data(), flowVelSoA.data(), muF.data(), rhoF.data(), diameter.data(), dragForce.data());
+}
+
 void ablate::particles::processes::Inertial::ComputeRHS(PetscReal time, ablate::particles::accessors::SwarmAccessor& swarmAccessor, ablate::particles::accessors::RhsAccessor& rhsAccessor,
                                                         ablate::particles::accessors::EulerianAccessor& eulerianAccessor) {
     // Get sizes from the accessors
     const auto dim = eulerianAccessor.GetDimensions();
     const auto np = swarmAccessor.GetNumberParticles();
 
-    PetscScalar muF = fluidViscosity;
     PetscScalar rhoF = fluidDensity;
 
     auto coordinateRhs = rhsAccessor[ablate::particles::ParticleSolver::ParticleCoordinates];
@@ -23,29 +55,76 @@ void ablate::particles::processes::Inertial::ComputeRHS(PetscReal time, ablate::
     auto partVel = swarmAccessor[ablate::particles::ParticleSolver::ParticleVelocity];
     auto partDens = swarmAccessor[ablate::particles::ParticleSolver::ParticleDensity];
 
-    for (PetscInt p = 0; p < np; ++p) {
-        PetscReal rep = 0.0;
-        PetscReal corFactor;
-        PetscScalar tauP;
-
-        for (PetscInt n = 0; n < dim; n++) {
-            rep += rhoF * PetscSqr(fluidVel(p, n) - partVel(p, n)) * partDiam(p) / muF;
+    // each particle only writes to its own rhs, so the particles are split into concurrent chunks on the shared thread pool
+    utilities::KokkosUtilities::ParallelForChunks(np, [&](std::size_t start, std::size_t end, std::size_t) {
+        if (dragModel) {
+            // the drag model computes the force for the whole chunk in a single batch
+            std::vector<PetscReal> dragForce;
+            ComputeModelDragForces(dim, (PetscInt)start, (PetscInt)end, fluidVel, partVel, partDiam, dragForce);
+            const auto chunkSize = (PetscInt)(end - start);
+            for (auto p = (PetscInt)start; p < (PetscInt)end; ++p) {
+                const PetscReal mass = partDens(p) * PETSC_PI * PetscPowRealInt(partDiam(p), 3) / 6.0;
+                for (PetscInt n = 0; n < dim; n++) {
+                    coordinateRhs(p, n) += partVel(p, n);
+                    velocityRhs(p, n) += dragForce[n * chunkSize + (p - (PetscInt)start)] / mass + gravityField[n] * (1.0 - rhoF / partDens(p));
+                }
+            }
+            return;
         }
-        // Correction factor to account for finite Rep on Stokes drag (see Schiller-Naumann drag closure)
-        corFactor = 1.0 + 0.15 * PetscPowReal(PetscSqrtReal(rep), 0.687);
-        if (rep < 0.1) {
-            corFactor = 1.0;  // returns Stokes drag for low speed particles
+        for (auto p = (PetscInt)start; p < (PetscInt)end; ++p) {
+            // Note: this function assumed that the solution vector order is correct
+            const PetscReal dragRate = ComputeDragRate(dim, fluidVel[p], partVel[p], partDiam(p), partDens(p));
+            for (PetscInt n = 0; n < dim; n++) {
+                coordinateRhs(p, n) += partVel(p, n);
+                velocityRhs(p, n) += dragRate * (fluidVel(p, n) - partVel(p, n)) + gravityField[n] * (1.0 - rhoF / partDens(p));
+            }
         }
-        // Note: this function assumed that the solution vector order is correct
-        tauP = partDens(p) * PetscSqr(partDiam(p)) / (18.0 * muF);  // particle relaxation time
-        for (PetscInt n = 0; n < dim; n++) {
-            coordinateRhs(p, n) += partVel(p, n);
-            velocityRhs(p, n) += corFactor * (fluidVel(p, n) - partVel(p, n)) / tauP + gravityField[n] * (1.0 - rhoF / partDens(p));
+    });
+}
+
+void ablate::particles::processes::Inertial::ComputeEulerianSource(PetscReal time, ablate::particles::accessors::SwarmAccessor& swarmAccessor,
+                                                                   ablate::particles::accessors::EulerianAccessor& eulerianAccessor, PetscReal* eulerianSource) {
+    // Get sizes from the accessors
+    const auto dim = eulerianAccessor.GetDimensions();
+    const auto np = swarmAccessor.GetNumberParticles();
+    const auto sourceSize = dim + ablate::finiteVolume::CompressibleFlowFields::RHOU;
+
+    auto fluidVel = eulerianAccessor[eulerianVelocityField];
+    auto partDiam = swarmAccessor[ablate::particles::ParticleSolver::ParticleDiameter];
+    auto partVel = swarmAccessor[ablate::particles::ParticleSolver::ParticleVelocity];
+    auto partDens = swarmAccessor[ablate::particles::ParticleSolver::ParticleDensity];
+
+    utilities::KokkosUtilities::ParallelForChunks(np, [&](std::size_t start, std::size_t end, std::size_t) {
+        if (dragModel) {
+            std::vector<PetscReal> dragForce;
+            ComputeModelDragForces(dim, (PetscInt)start, (PetscInt)end, fluidVel, partVel, partDiam, dragForce);
+            const auto chunkSize = (PetscInt)(end - start);
+            for (auto p = (PetscInt)start; p < (PetscInt)end; ++p) {
+                PetscReal* source = eulerianSource + p * sourceSize;
+                for (PetscInt n = 0; n < dim; n++) {
+                    const PetscReal dragForceN = dragForce[n * chunkSize + (p - (PetscInt)start)];
+                    source[ablate::finiteVolume::CompressibleFlowFields::RHOU + n] -= dragForceN;
+                    source[ablate::finiteVolume::CompressibleFlowFields::RHOE] -= dragForceN * partVel(p, n);
+                }
+            }
+            return;
         }
-    }
+        for (auto p = (PetscInt)start; p < (PetscInt)end; ++p) {
+            // the drag force on the particle is removed from the flow momentum and the work done by the drag is removed from the flow energy
+            const PetscReal mass = partDens(p) * PETSC_PI * PetscPowRealInt(partDiam(p), 3) / 6.0;
+            const PetscReal dragRate = ComputeDragRate(dim, fluidVel[p], partVel[p], partDiam(p), partDens(p));
+            PetscReal* source = eulerianSource + p * sourceSize;
+            for (PetscInt n = 0; n < dim; n++) {
+                const PetscReal dragForce = mass * dragRate * (fluidVel(p, n) - partVel(p, n));
+                source[ablate::finiteVolume::CompressibleFlowFields::RHOU + n] -= dragForce;
+                source[ablate::finiteVolume::CompressibleFlowFields::RHOE] -= dragForce * partVel(p, n);
+            }
+        }
+    });
 }
 
 #include "registrar.hpp"
 REGISTER(ablate::particles::processes::Process, ablate::particles::processes::Inertial, "massless particles that advects with the flow",
          ARG(ablate::parameters::Parameters, "parameters", "fluid parameters for the particles (fluidDensity, fluidViscosity, gravityField)"),
-         OPT(std::string, "eulerianVelocityFieldIn", "optional name of the Eulerian velocity field (defaults to velocity)"));
+         OPT(std::string, "eulerianVelocityFieldIn", "optional name of the Eulerian velocity field (defaults to velocity)"),
+         OPT(ablate::particles::processes::drag::DragModel, "dragModel", "optional drag model used for the particle drag force (defaults to the Schiller-Naumann corrected Stokes drag)"));
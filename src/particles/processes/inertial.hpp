@@ -2,6 +2,9 @@
 #define ABLATELIBRARY_INERTIAL_HPP
 
 #include <array>
+#include <memory>
+#include <vector>
+#include "drag/dragModel.hpp"
 #include "process.hpp"
 
 namespace ablate::particles::processes {
@@ -20,13 +23,35 @@ class Inertial : public Process {
     //! the location of the velocity field
     const std::string eulerianVelocityField;
 
+    //! optional drag model, when not provided the Schiller-Naumann correction to Stokes drag is used
+    const std::shared_ptr<drag::DragModel> dragModel;
+
+    /**
+     * The drag acceleration per unit relative velocity using the Schiller-Naumann correction to Stokes drag
+     * @param dim
+     * @param fluidVel
+     * @param partVel
+     * @param partDiam
+     * @param partDens
+     * @return corFactor/tauP
+     */
+    [[nodiscard]] PetscReal ComputeDragRate(PetscInt dim, const PetscReal* fluidVel, const PetscReal* partVel, PetscReal partDiam, PetscReal partDens) const;
+
+    /**
+     * Computes the drag force on the particles [start, end) with the batched drag model.  The particle values are packed into struct-of-arrays buffers for the model.
+     * @param dragForce the drag force on each particle in the range (dim * (end - start)), component major
+     */
+    void ComputeModelDragForces(PetscInt dim, PetscInt start, PetscInt end, const accessors::ConstPointData& fluidVel, const accessors::ConstPointData& partVel,
+                                const accessors::ConstPointData& partDiam, std::vector<PetscReal>& dragForce) const;
+
    public:
     /**
      * Advects the particles with the flow velocity based upon a drag law
      * @param parameters input parameters for the velocity field
      * @param eulerianVelocityField optional field where eulerian velocity is defined (default "velocity")
+     * @param dragModel optional drag model (default Schiller-Naumann corrected Stokes drag)
      */
-    explicit Inertial(std::shared_ptr<parameters::Parameters> parameters, const std::string& eulerianVelocityField = {});
+    explicit Inertial(std::shared_ptr<parameters::Parameters> parameters, const std::string& eulerianVelocityField = {}, std::shared_ptr<drag::DragModel> dragModel = {});
 
     /**
      * computes the source terms to integrate the particle location with the flow velocity with drag
@@ -36,6 +61,15 @@ class Inertial : public Process {
      * @param eulerianAccessor
      */
     void ComputeRHS(PetscReal time, accessors::SwarmAccessor& swarmAccessor, accessors::RhsAccessor& rhsAccessor, accessors::EulerianAccessor& eulerianAccessor) override;
+
+    /**
+     * computes the momentum and energy that the drag on each particle removes from the flow
+     * @param time
+     * @param swarmAccessor
+     * @param eulerianAccessor
+     * @param eulerianSource
+     */
+    void ComputeEulerianSource(PetscReal time, accessors::SwarmAccessor& swarmAccessor, accessors::EulerianAccessor& eulerianAccessor, PetscReal* eulerianSource) override;
 };
 
 }  // namespace ablate::particles::processes
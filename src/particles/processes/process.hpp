@@ -17,6 +17,17 @@ class Process {
      * @param rhsData
      */
     virtual void ComputeRHS(PetscReal time, accessors::SwarmAccessor& swarmAccessor, accessors::RhsAccessor& rhsAccessor, accessors::EulerianAccessor& eulerianAccessor) = 0;
+
+    /**
+     * optional function to compute the source that each particle applies to the eulerian flow for two-way coupling.  The mass (kg/s), energy (W), and momentum (N) source for each
+     * particle is added to the eulerianSource in the order of the euler field (2 + dim values per particle).  The source is for a single physical particle, the particle solver scales it by the
+     * ParticleWeight of each parcel.
+     * @param time
+     * @param swarmAccessor
+     * @param eulerianAccessor
+     * @param eulerianSource
+     */
+    virtual void ComputeEulerianSource(PetscReal time, accessors::SwarmAccessor& swarmAccessor, accessors::EulerianAccessor& eulerianAccessor, PetscReal* eulerianSource) {}
 };
 
 }  // namespace ablate::particles::processes
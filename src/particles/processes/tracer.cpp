@@ -1,5 +1,6 @@
 #include "tracer.hpp"
 #include "particles/particleSolver.hpp"
+#include "utilities/kokkosUtilities.hpp"
 
 ablate::particles::processes::Tracer::Tracer(const std::string& eulerianVelocityFieldIn) : eulerianVelocityField(eulerianVelocityFieldIn.empty() ? "velocity" : eulerianVelocityFieldIn) {}
 
@@ -8,11 +9,13 @@ void ablate::particles::processes::Tracer::ComputeRHS(PetscReal time, ablate::pa
     auto coordinateRhs = rhsAccessor[ablate::particles::ParticleSolver::ParticleCoordinates];
     auto fluidVelocity = eulerianAccessor[eulerianVelocityField];
 
-    // march over each particle
+    // march over each particle in concurrent chunks, each particle only writes to its own rhs
     const PetscInt np = swarmAccessor.GetNumberParticles();
-    for (PetscInt p = 0; p < np; p++) {
-        coordinateRhs.AddFrom(fluidVelocity[p], p);
-    }
+    utilities::KokkosUtilities::ParallelForChunks(np, [&](std::size_t start, std::size_t end, std::size_t) {
+        for (auto p = (PetscInt)start; p < (PetscInt)end; p++) {
+            coordinateRhs.AddFrom(fluidVelocity[p], p);
+        }
+    });
 }
 
 #include "registrar.hpp"
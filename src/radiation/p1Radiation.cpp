@@ -0,0 +1,363 @@
+#include "p1Radiation.hpp"
+#include <petscdmplex.h>
+#include <stdexcept>
+#include <utility>
+#include "utilities/constants.hpp"
+#include "utilities/petscOptions.hpp"
+
+ablate::radiation::P1Radiation::P1Radiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn,
+                                            const std::shared_ptr<ablate::parameters::Parameters>& options, std::shared_ptr<ablate::monitors::logs::Log> log)
+    : Radiation(solverId, region, 1, std::move(radiationModelIn), std::move(log)) {
+    if (options) {
+        PetscOptionsCreate(&petscOptions) >> checkError;
+        options->Fill(petscOptions);
+    }
+}
+
+ablate::radiation::P1Radiation::~P1Radiation() {
+    if (ksp) KSPDestroy(&ksp) >> checkError;
+    if (matrix) MatDestroy(&matrix) >> checkError;
+    if (rhs) VecDestroy(&rhs) >> checkError;
+    if (incidentRadiation) VecDestroy(&incidentRadiation) >> checkError;
+    if (originIncidentRadiation) VecDestroy(&originIncidentRadiation) >> checkError;
+    if (originScatter) VecScatterDestroy(&originScatter) >> checkError;
+    if (petscOptions) {
+        ablate::utilities::PetscOptionsDestroyAndCheck("ablate::radiation::P1Radiation", &petscOptions);
+    }
+}
+
+void ablate::radiation::P1Radiation::Setup(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) {
+    dim = subDomain.GetDimensions();
+    absorptivityFunction = radiationModel->GetRadiationPropertiesTemperatureFunction(eos::radiationProperties::RadiationProperty::Absorptivity, subDomain.GetFields());
+    if (log) {
+        log->Initialize(subDomain.GetComm());
+    }
+
+    DMPlexComputeGeometryFVM(subDomain.GetDM(), &cellGeomVec, &faceGeomVec) >> checkError;  //!< Get the geometry vectors
+    IndexOrigins(cellRange);
+}
+
+void ablate::radiation::P1Radiation::Initialize(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) {
+    StartEvent("P1Radiation::Initialize");
+    DM dm = subDomain.GetDM();
+    PetscInt cellEnd;
+    DMPlexGetHeightStratum(dm, 0, &cellStart, &cellEnd) >> checkError;
+
+    /** The cells in the radiation region exclude the boundary ghost cells */
+    DMLabel ghostLabel;
+    DMGetLabel(dm, "ghost", &ghostLabel) >> checkError;
+    auto inRadiationRegion = [&](PetscInt cell) {
+        if (cell < cellStart || cell >= cellEnd) {
+            return false;
+        }
+        PetscInt ghost = -1;
+        if (ghostLabel) DMLabelGetValue(ghostLabel, cell, &ghost) >> checkError;
+        return ghost < 0 && subDomain.InRegion(cell) && region->InRegion(region, dm, cell);
+    };
+
+    /** Every cell in the mesh gets a row so that the global numbering from the plex can be used, the cells that are not owned are negative */
+    IS cellNumberingIs;
+    const PetscInt* cellNumbering;
+    DMPlexCreateCellNumbering(dm, PETSC_FALSE, &cellNumberingIs) >> checkError;
+    ISGetIndices(cellNumberingIs, &cellNumbering) >> checkError;
+    auto globalRow = [&](PetscInt cell) {
+        const PetscInt number = cellNumbering[cell - cellStart];
+        return number < 0 ? -(number + 1) : number;
+    };
+
+    DM cellDM, faceDM;
+    const PetscScalar *cellGeomArray, *faceGeomArray;
+    VecGetDM(cellGeomVec, &cellDM) >> checkError;
+    VecGetDM(faceGeomVec, &faceDM) >> checkError;
+    VecGetArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+    auto distance = [this](const PetscReal* a, const PetscReal* b) {
+        PetscReal sum = 0.0;
+        for (PetscInt d = 0; d < dim; d++) {
+            sum += (a[d] - b[d]) * (a[d] - b[d]);
+        }
+        return PetscSqrtReal(sum);
+    };
+
+    /** Store the connectivity of the owned cells in the radiation region */
+    PetscInt numberRows = 0;
+    PetscInt maxFaces = 0;
+    p1Cells.clear();
+    p1Faces.clear();
+    inactiveRows.clear();
+    localCells.clear();
+    for (PetscInt c = cellStart; c < cellEnd; ++c) {
+        const bool active = inRadiationRegion(c);
+        if (active) {
+            localCells.push_back(c);
+        }
+        if (cellNumbering[c - cellStart] < 0) {
+            continue;
+        }
+        numberRows++;
+        if (!active) {
+            inactiveRows.push_back(globalRow(c));
+            continue;
+        }
+
+        PetscFVCellGeom* cellGeom;
+        DMPlexPointLocalRead(cellDM, c, cellGeomArray, &cellGeom) >> checkError;
+        p1Cells.push_back(P1Cell{.cell = c, .row = globalRow(c), .volume = cellGeom->volume});
+
+        PetscInt numberFaces;
+        const PetscInt* cellFaces;
+        DMPlexGetConeSize(dm, c, &numberFaces) >> checkError;
+        DMPlexGetCone(dm, c, &cellFaces) >> checkError;
+        maxFaces = PetscMax(maxFaces, numberFaces);
+        for (PetscInt f = 0; f < numberFaces; f++) {
+            PetscFVFaceGeom* faceGeom;
+            DMPlexPointLocalRead(faceDM, cellFaces[f], faceGeomArray, &faceGeom) >> checkError;
+
+            PetscInt numberNeighbors;
+            const PetscInt* neighbors;
+            DMPlexGetSupportSize(dm, cellFaces[f], &numberNeighbors) >> checkError;
+            DMPlexGetSupport(dm, cellFaces[f], &neighbors) >> checkError;
+            PetscInt neighbor = -1;
+            for (PetscInt n = 0; n < numberNeighbors; n++) {
+                if (neighbors[n] != c && inRadiationRegion(neighbors[n])) {
+                    neighbor = neighbors[n];
+                }
+            }
+
+            P1Face p1Face{.p1Cell = (PetscInt)p1Cells.size() - 1, .neighbor = neighbor, .neighborRow = -1, .area = 0.0, .distance = 0.0};
+            PetscReal zero[3] = {0.0, 0.0, 0.0};
+            p1Face.area = distance(faceGeom->normal, zero);  //!< The face normal is scaled by the area
+            if (neighbor >= 0) {
+                PetscFVCellGeom* neighborGeom;
+                DMPlexPointLocalRead(cellDM, neighbor, cellGeomArray, &neighborGeom) >> checkError;
+                p1Face.neighborRow = globalRow(neighbor);
+                p1Face.distance = distance(neighborGeom->centroid, cellGeom->centroid);
+            } else {
+                p1Face.distance = distance(faceGeom->centroid, cellGeom->centroid);
+            }
+            p1Faces.push_back(p1Face);
+        }
+    }
+    absorptivity.assign(cellEnd - cellStart, 0.0);
+    temperature.assign(cellEnd - cellStart, 0.0);
+
+    /** Each volume origin uses its own cell, each face origin uses the attached cell in the radiation region and loses energy through the other cell */
+    const auto numberOrigins = (PetscInt)origin.size();
+    originSourceCells.assign(numberOrigins, -1);
+    originLossCells.assign(numberOrigins, -1);
+    originDistances.assign(numberOrigins, 0.0);
+    originValues.assign(numberOrigins, -1);
+    std::vector<PetscInt> originRows;
+    for (PetscInt o = 0; o < numberOrigins; ++o) {
+        const PetscInt iCell = originCells[o];
+        if (iCell >= cellStart && iCell < cellEnd) {
+            originSourceCells[o] = inRadiationRegion(iCell) ? iCell : -1;
+            originLossCells[o] = iCell;
+        } else {
+            PetscInt numberNeighbors;
+            const PetscInt* neighbors;
+            DMPlexGetSupportSize(dm, iCell, &numberNeighbors) >> checkError;
+            DMPlexGetSupport(dm, iCell, &neighbors) >> checkError;
+            for (PetscInt n = 0; n < numberNeighbors; n++) {
+                if (inRadiationRegion(neighbors[n])) {
+                    originSourceCells[o] = neighbors[n];
+                } else {
+                    originLossCells[o] = neighbors[n];
+                }
+            }
+            if (originSourceCells[o] < 0) {
+                throw std::runtime_error("ablate::radiation::P1Radiation cannot locate a cell in the radiation region for the face " + std::to_string(iCell));
+            }
+            originLossCells[o] = originLossCells[o] < 0 ? originSourceCells[o] : originLossCells[o];
+
+            PetscFVFaceGeom* faceGeom;
+            PetscFVCellGeom* cellGeom;
+            DMPlexPointLocalRead(faceDM, iCell, faceGeomArray, &faceGeom) >> checkError;
+            DMPlexPointLocalRead(cellDM, originSourceCells[o], cellGeomArray, &cellGeom) >> checkError;
+            originDistances[o] = distance(faceGeom->centroid, cellGeom->centroid);
+        }
+        if (originSourceCells[o] >= 0) {
+            originValues[o] = (PetscInt)originRows.size();
+            originRows.push_back(globalRow(originSourceCells[o]));
+        }
+    }
+    VecRestoreArrayRead(cellGeomVec, &cellGeomArray) >> checkError;
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+    ISRestoreIndices(cellNumberingIs, &cellNumbering) >> checkError;
+    ISDestroy(&cellNumberingIs) >> checkError;
+
+    /** The matrix is symmetric positive definite so conjugate gradients is used by default, the previous solution is used as the initial guess */
+    MatCreateAIJ(subDomain.GetComm(), numberRows, numberRows, PETSC_DETERMINE, PETSC_DETERMINE, maxFaces + 1, nullptr, maxFaces, nullptr, &matrix) >> checkError;
+    MatSetOption(matrix, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE) >> checkError;
+    MatCreateVecs(matrix, &incidentRadiation, &rhs) >> checkError;
+    VecZeroEntries(incidentRadiation) >> checkError;
+
+    KSPCreate(subDomain.GetComm(), &ksp) >> checkError;
+    PetscObjectSetOptions((PetscObject)ksp, petscOptions) >> checkError;
+    KSPSetType(ksp, KSPCG) >> checkError;
+    KSPSetOperators(ksp, matrix, matrix) >> checkError;
+    KSPSetInitialGuessNonzero(ksp, PETSC_TRUE) >> checkError;
+    KSPSetFromOptions(ksp) >> checkError;
+
+    /** Gather the incident radiation of the origin cells, these may be owned by another rank */
+    IS originIs;
+    ISCreateGeneral(PETSC_COMM_SELF, (PetscInt)originRows.size(), originRows.data(), PETSC_COPY_VALUES, &originIs) >> checkError;
+    VecCreateSeq(PETSC_COMM_SELF, (PetscInt)originRows.size(), &originIncidentRadiation) >> checkError;
+    VecScatterCreate(incidentRadiation, originIs, originIncidentRadiation, nullptr, &originScatter) >> checkError;
+    ISDestroy(&originIs) >> checkError;
+
+    if (log) {
+        PetscInt globalRows;
+        VecGetSize(incidentRadiation, &globalRows) >> checkError;
+        log->Printf("P1 radiation initialized with %" PetscInt_FMT " rows\n", globalRows);
+    }
+    EndEvent();
+}
+
+bool ablate::radiation::P1Radiation::GetCellProperties(DM solDm, const PetscScalar* solArray, DM auxDm, const PetscScalar* auxArray, const ablate::domain::Field& temperatureField,
+                                                       PetscInt cell, PetscReal& kappa, PetscReal& cellTemperature) const {
+    const PetscScalar* sol = nullptr;
+    const PetscScalar* temperaturePointer = nullptr;
+    DMPlexPointLocalRead(solDm, cell, solArray, &sol) >> checkError;
+    if (sol) {
+        DMPlexPointLocalFieldRead(auxDm, cell, temperatureField.id, auxArray, &temperaturePointer) >> checkError;
+    }
+    if (!sol || !temperaturePointer) {
+        return false;
+    }
+    cellTemperature = *temperaturePointer;
+    absorptivityFunction.function(sol, cellTemperature, &kappa, absorptivityFunction.context.get()) >> checkError;
+    return true;
+}
+
+void ablate::radiation::P1Radiation::EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec) {
+    StartEvent("P1Radiation::EvaluateGains");
+    const PetscScalar* solArray;
+    DM solDm;
+    VecGetDM(solVec, &solDm) >> checkError;
+    VecGetArrayRead(solVec, &solArray) >> checkError;
+
+    const PetscScalar* auxArray;
+    DM auxDm;
+    VecGetDM(auxVec, &auxDm) >> checkError;
+    VecGetArrayRead(auxVec, &auxArray) >> checkError;
+
+    /** Compute the properties once for every local cell so that the faces can use the neighboring values */
+    for (const auto& cell : localCells) {
+        PetscReal kappa = 0.0;
+        PetscReal cellTemperature = 0.0;
+        if (!GetCellProperties(solDm, solArray, auxDm, auxArray, temperatureField, cell, kappa, cellTemperature)) {
+            kappa = 0.0;
+            cellTemperature = 0.0;
+        }
+        absorptivity[cell - cellStart] = kappa;
+        temperature[cell - cellStart] = cellTemperature;
+    }
+    auto blackBody = [](PetscReal cellTemperature) { return 4.0 * ablate::utilities::Constants::sbc * PetscPowRealInt(cellTemperature, 4); };
+
+    /** Assemble -div(1/(3 kappa) grad(G)) + kappa G = 4 kappa sigma T^4 with a two point flux */
+    MatZeroEntries(matrix) >> checkError;
+    VecZeroEntries(rhs) >> checkError;
+    for (const auto& p1Cell : p1Cells) {
+        const PetscReal kappa = absorptivity[p1Cell.cell - cellStart];
+        MatSetValue(matrix, p1Cell.row, p1Cell.row, kappa * p1Cell.volume, ADD_VALUES) >> checkError;
+        VecSetValue(rhs, p1Cell.row, kappa * blackBody(temperature[p1Cell.cell - cellStart]) * p1Cell.volume, ADD_VALUES) >> checkError;
+    }
+    for (const auto& p1Face : p1Faces) {
+        const auto& p1Cell = p1Cells[p1Face.p1Cell];
+        const PetscReal kappa = absorptivity[p1Cell.cell - cellStart];
+        if (p1Face.neighbor >= 0) {
+            const PetscReal faceKappa = PetscMax(0.5 * (kappa + absorptivity[p1Face.neighbor - cellStart]), MINIMUM_ABSORPTIVITY);
+            const PetscReal coefficient = p1Face.area / (3.0 * faceKappa * p1Face.distance);
+            MatSetValue(matrix, p1Cell.row, p1Cell.row, coefficient, ADD_VALUES) >> checkError;
+            MatSetValue(matrix, p1Cell.row, p1Face.neighborRow, -coefficient, ADD_VALUES) >> checkError;
+        } else {
+            /** The Marshak condition for a black wall at the temperature of the cell adds a resistance of two in series with the half cell */
+            const PetscReal coefficient = p1Face.area / (3.0 * PetscMax(kappa, MINIMUM_ABSORPTIVITY) * p1Face.distance + 2.0);
+            MatSetValue(matrix, p1Cell.row, p1Cell.row, coefficient, ADD_VALUES) >> checkError;
+            VecSetValue(rhs, p1Cell.row, coefficient * blackBody(temperature[p1Cell.cell - cellStart]), ADD_VALUES) >> checkError;
+        }
+    }
+    for (const auto& row : inactiveRows) {
+        MatSetValue(matrix, row, row, 1.0, ADD_VALUES) >> checkError;
+    }
+    MatAssemblyBegin(matrix, MAT_FINAL_ASSEMBLY) >> checkError;
+    MatAssemblyEnd(matrix, MAT_FINAL_ASSEMBLY) >> checkError;
+    VecAssemblyBegin(rhs) >> checkError;
+    VecAssemblyEnd(rhs) >> checkError;
+
+    KSPSolve(ksp, rhs, incidentRadiation) >> checkError;
+    if (log) {
+        PetscInt iterations;
+        KSPGetIterationNumber(ksp, &iterations) >> checkError;
+        log->Printf("P1 radiation solved in %" PetscInt_FMT " iterations\n", iterations);
+    }
+
+    /** Volume origins receive the irradiation G, face origins receive the incident flux G/4 + q.n/2 from the Marshak condition at the face */
+    VecScatterBegin(originScatter, incidentRadiation, originIncidentRadiation, INSERT_VALUES, SCATTER_FORWARD) >> checkError;
+    VecScatterEnd(originScatter, incidentRadiation, originIncidentRadiation, INSERT_VALUES, SCATTER_FORWARD) >> checkError;
+    const PetscScalar* originIncidentRadiationArray;
+    VecGetArrayRead(originIncidentRadiation, &originIncidentRadiationArray) >> checkError;
+    for (std::size_t o = 0; o < origin.size(); ++o) {
+        origin[o].intensity = 0.0;
+        if (originValues[o] < 0) {
+            continue;
+        }
+        const PetscReal cellIncidentRadiation = originIncidentRadiationArray[originValues[o]];
+        if (originDistances[o] == 0.0) {
+            origin[o].intensity = cellIncidentRadiation;
+        } else {
+            const PetscReal cellTemperature = temperature[originSourceCells[o] - cellStart];
+            const PetscReal conductance = 1.0 / (3.0 * PetscMax(absorptivity[originSourceCells[o] - cellStart], MINIMUM_ABSORPTIVITY) * originDistances[o]);
+            const PetscReal faceIncidentRadiation = (conductance * cellIncidentRadiation + 0.5 * blackBody(cellTemperature)) / (conductance + 0.5);
+            origin[o].intensity = 0.5 * faceIncidentRadiation - 0.25 * blackBody(cellTemperature);
+        }
+    }
+    VecRestoreArrayRead(originIncidentRadiation, &originIncidentRadiationArray) >> checkError;
+
+    VecRestoreArrayRead(solVec, &solArray) >> checkError;
+    VecRestoreArrayRead(auxVec, &auxArray) >> checkError;
+    EndEvent();
+}
+
+void ablate::radiation::P1Radiation::Solve(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec) {
+    StartEvent("P1Radiation::Solve");
+    const PetscScalar* solArray;
+    DM solDm;
+    VecGetDM(solVec, &solDm) >> checkError;
+    VecGetArrayRead(solVec, &solArray) >> checkError;
+
+    const PetscScalar* auxArray;
+    DM auxDm;
+    VecGetDM(auxVec, &auxDm) >> checkError;
+    VecGetArrayRead(auxVec, &auxArray) >> checkError;
+
+    /** The losses follow the ray tracing solvers, volume origins use the absorptivity of the cell and face origins use half of the black body losses of the boundary cell */
+    for (std::size_t o = 0; o < origin.size(); ++o) {
+        origin[o].net = 0.0;
+        if (originSourceCells[o] < 0) {
+            continue;
+        }
+        PetscReal kappa = 1.0;
+        PetscReal lossTemperature = 0.0;
+        if (GetCellProperties(solDm, solArray, auxDm, auxArray, temperatureField, originLossCells[o], kappa, lossTemperature)) {
+            PetscReal losses = 4 * ablate::utilities::Constants::sbc * PetscPowRealInt(lossTemperature, 4);
+            if (originDistances[o] != 0.0) {
+                kappa = 1.0;
+                losses *= 0.5;
+            }
+            origin[o].net = -kappa * (losses - origin[o].intensity);
+        }
+    }
+
+    VecRestoreArrayRead(solVec, &solArray) >> checkError;
+    VecRestoreArrayRead(auxVec, &auxArray) >> checkError;
+    EndEvent();
+}
+
+#include "registrar.hpp"
+REGISTER(ablate::radiation::Radiation, ablate::radiation::P1Radiation, "the P1 approximation of radiative heat transfer solved over the mesh with a PETSc KSP",
+         ARG(std::string, "id", "the name of the flow field"), ARG(ablate::domain::Region, "region", "the region to apply this solver."),
+         ARG(ablate::eos::radiationProperties::RadiationModel, "properties", "the radiation properties model"),
+         OPT(ablate::parameters::Parameters, "options", "the PETSc options for the linear solve (such as ksp_type and pc_type)"),
+         OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
@@ -0,0 +1,98 @@
+#ifndef ABLATELIBRARY_P1RADIATION_HPP
+#define ABLATELIBRARY_P1RADIATION_HPP
+
+#include <petscksp.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "parameters/parameters.hpp"
+#include "radiation.hpp"
+
+namespace ablate::radiation {
+
+/**
+ * The P1 (spherical harmonics) approximation of the radiative transfer equation.  Instead of tracing rays the incident radiation G is found from the elliptic equation
+ *      -div(1/(3 kappa) grad(G)) + kappa G = 4 kappa sigma T^4
+ * with a Marshak condition at the edge of the radiation region.  The equation is discretized with a two point flux over the cells of the mesh and solved with a PETSc KSP, so the cost and
+ * communication scale with the number of cells instead of the number of cells times rays.  Volume origins are given the irradiation G and face origins are given the incident flux from the
+ * Marshak condition so that this solver can replace the ray tracing solvers in the VolumeRadiation and Sublimation.
+ */
+class P1Radiation : public Radiation {
+   private:
+    //! an optional petscOptions that is used for the linear solve
+    PetscOptions petscOptions = nullptr;
+
+    //! the linear system for the incident radiation with one row for every cell in the mesh
+    Mat matrix = nullptr;
+    Vec rhs = nullptr;
+    Vec incidentRadiation = nullptr;
+    KSP ksp = nullptr;
+
+    //! a locally owned cell in the radiation region
+    struct P1Cell {
+        PetscInt cell;
+        PetscInt row;
+        PetscReal volume;
+    };
+
+    //! a face of a locally owned cell, the neighbor is -1 if the face is on the edge of the radiation region
+    struct P1Face {
+        PetscInt p1Cell;
+        PetscInt neighbor;
+        PetscInt neighborRow;
+        PetscReal area;
+        PetscReal distance;
+    };
+
+    std::vector<P1Cell> p1Cells;         //!< The locally owned cells in the radiation region
+    std::vector<P1Face> p1Faces;         //!< The faces of the locally owned cells
+    std::vector<PetscInt> inactiveRows;  //!< The locally owned rows outside of the radiation region, these are set to zero
+
+    PetscInt cellStart = 0;               //!< The first cell in the mesh
+    std::vector<PetscInt> localCells;     //!< Every local cell (owned or not) in the radiation region, the properties are evaluated for these cells
+    std::vector<PetscReal> absorptivity;  //!< The absorptivity of each cell offset by the cellStart
+    std::vector<PetscReal> temperature;   //!< The temperature of each cell offset by the cellStart
+
+    std::vector<PetscInt> originSourceCells;  //!< The cell in the radiation region used to compute each origin, -1 if there is none
+    std::vector<PetscInt> originLossCells;    //!< The cell used for the losses of each origin
+    std::vector<PetscReal> originDistances;   //!< The distance from the source cell to a face origin, zero for volume origins
+    std::vector<PetscInt> originValues;       //!< The index of each origin into the originIncidentRadiation, -1 if there is none
+    Vec originIncidentRadiation = nullptr;    //!< The incident radiation of the origin source cells gathered from the incidentRadiation
+    VecScatter originScatter = nullptr;       //!< The scatter from the incidentRadiation to the originIncidentRadiation
+
+    //! the absorptivity is limited so that the diffusion coefficient stays finite in transparent cells
+    static constexpr PetscReal MINIMUM_ABSORPTIVITY = 1.0E-6;
+
+    /**
+     * Get the absorptivity and temperature for a cell, returns false if the cell does not have a solution or temperature
+     */
+    bool GetCellProperties(DM solDm, const PetscScalar* solArray, DM auxDm, const PetscScalar* auxArray, const ablate::domain::Field& temperatureField, PetscInt cell, PetscReal& kappa,
+                           PetscReal& cellTemperature) const;
+
+   public:
+    /**
+     * @param solverId the id for this solver
+     * @param region the radiation region
+     * @param radiationModelIn the radiation properties model
+     * @param options the PETSc options used for the linear solve
+     * @param log where to record the log
+     */
+    P1Radiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn,
+                const std::shared_ptr<ablate::parameters::Parameters>& options = {}, std::shared_ptr<ablate::monitors::logs::Log> log = {});
+    ~P1Radiation() override;
+
+    /** Set up the properties and geometry, no search particles are needed */
+    void Setup(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) override;
+
+    /** Build the cell connectivity, the linear system, and the map from the origins to the cells */
+    void Initialize(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) override;
+
+    /** Assemble and solve for the incident radiation and update the origin intensities */
+    void EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec) override;
+
+    /** Compute the net radiation of each origin from the intensity and the losses */
+    void Solve(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec) override;
+};
+
+}  // namespace ablate::radiation
+#endif  // ABLATELIBRARY_P1RADIATION_HPP
@@ -3,14 +3,35 @@
 #include <petscdm.h>
 #include <petscdmswarm.h>
 #include <petscsf.h>
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <typeinfo>
 #include <utility>
+#include "environment/runEnvironment.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "finiteVolume/finiteVolumeSolver.hpp"
 #include "utilities/constants.hpp"
+#include "utilities/kokkosUtilities.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/stringUtilities.hpp"
 
 ablate::radiation::Radiation::Radiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, const PetscInt raynumber,
-                                        std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log)
-    : solverId((std::basic_string<char> &&) solverId), region(region), radiationModel(std::move(radiationModelIn)), log(std::move(log)) {
+                                        std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log, bool batchProperties,
+                                        bool cacheRays, PetscInt rayBudget, PetscReal updateTolerance, PetscReal segmentBalanceTolerance)
+    : batchProperties(batchProperties),
+      cacheRays(cacheRays),
+      rayBudget(rayBudget),
+      updateTolerance(updateTolerance),
+      segmentBalanceTolerance(segmentBalanceTolerance),
+      solverId((std::basic_string<char> &&) solverId),
+      region(region),
+      radiationModel(std::move(radiationModelIn)),
+      log(std::move(log)) {
     nTheta = raynumber;    //!< The number of angles to solve with, given by user input
     nPhi = 2 * raynumber;  //!< The number of angles to solve with, given by user input
 }
@@ -19,6 +40,9 @@ ablate::radiation::Radiation::~Radiation() {
     if (radsolve) DMDestroy(&radsolve) >> checkError;  //!< Destroy the radiation particle swarm
     if (faceGeomVec) VecDestroy(&faceGeomVec) >> checkError;
     if (cellGeomVec) VecDestroy(&cellGeomVec) >> checkError;
+    if (carrierSF) PetscSFDestroy(&carrierSF) >> checkError;
+    if (propertySF) PetscSFDestroy(&propertySF) >> checkError;
+    if (carrierType != MPI_DATATYPE_NULL) MPI_Type_free(&carrierType) >> checkMpiError;
 }
 
 /** allows initialization after the subdomain and dm is established */
@@ -31,6 +55,13 @@ void ablate::radiation::Radiation::Setup(const solver::Range& cellRange, ablate:
      * Initialize the log if provided
      */
     absorptivityFunction = radiationModel->GetRadiationPropertiesTemperatureFunction(eos::radiationProperties::RadiationProperty::Absorptivity, subDomain.GetFields());
+    if (UseCellProperties()) {
+        absorptivityBatchFunction = radiationModel->GetRadiationPropertiesTemperatureBatchFunction(eos::radiationProperties::RadiationProperty::Absorptivity, subDomain.GetFields());
+        solutionStride = 0;
+        for (const auto& field : subDomain.GetFields()) {
+            solutionStride += field.numberComponents;
+        }
+    }
 
     if (log) {
         log->Initialize(subDomain.GetComm());
@@ -54,12 +85,22 @@ void ablate::radiation::Radiation::Setup(const solver::Range& cellRange, ablate:
     MPI_Comm_rank(subDomain.GetComm(), &rank);      //!< Get the origin rank of the current process. The particle belongs to this rank. The rank only needs to be read once.
     MPI_Comm_size(subDomain.GetComm(), &numRanks);  //!< Get the number of ranks in the simulation.
 
+    /** Select the rays of each origin and their quadrature weights so that only the selected rays are searched */
+    DMPlexComputeGeometryFVM(subDomain.GetDM(), &cellGeomVec, &faceGeomVec) >> checkError;  //!< Get the geometry vectors
+    IndexOrigins(cellRange);
+    DM faceDM;
+    const PetscScalar* faceGeomArray;
+    VecGetDM(faceGeomVec, &faceDM) >> checkError;
+    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+    SelectRays(faceDM, faceGeomArray);
+    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
+
     /** Declare some local variables */
     double theta;  //!< represents the actual current angle (inclination)
     double phi;    //!< represents the actual current angle (rotation)
 
     /** Setup the particles and their associated fields including: origin domain/ ray identifier / # domains crossed, and coordinates. Instantiate ray particles for each local cell only. */
-    PetscInt npoints = (cellRange.end - cellRange.start) * nTheta * nPhi;  //!< Number of points to insert into the particle field. One particle for each ray.
+    auto npoints = (PetscInt)std::count_if(rayWeights.begin(), rayWeights.end(), [](const auto& weight) { return weight > 0; });  //!< Number of points to insert, one for each selected ray.
 
     /** Create the DMSwarm */
     DMCreate(subDomain.GetComm(), &radsearch) >> checkError;
@@ -86,6 +127,7 @@ void ablate::radiation::Radiation::Setup(const solver::Range& cellRange, ablate:
     DMSwarmRegisterUserStructField(radsolve, "identifier", sizeof(Identifier)) >> checkError;  //!< A field to store the ray identifier [origin][iCell][ntheta][nphi][ndomain]
     DMSwarmRegisterUserStructField(radsolve, "carrier", sizeof(Carrier)) >> checkError;        //!< A struct to carry information about the ray segment that the particle is communicating from
     DMSwarmRegisterUserStructField(radsolve, "access", sizeof(Identifier)) >> checkError;      //!< A struct to carry information about the ray segment that the particle is communicating from
+    DMSwarmRegisterPetscDatatypeField(radsolve, "source", 2, PETSC_INT) >> checkError;         //!< The rank and index of the root carrier used to build the star forest
     DMSwarmFinalizeFieldRegister(radsolve) >> checkError;                                      //!< Initialize the fields that have been defined
 
     /** Set initial local sizes of the DMSwarm with a buffer length of zero */
@@ -116,6 +158,11 @@ void ablate::radiation::Radiation::Setup(const solver::Range& cellRange, ablate:
          */
         for (PetscInt ntheta = 0; ntheta < nTheta; ntheta++) {
             for (PetscInt nphi = 0; nphi < nPhi; nphi++) {
+                /** Rays that were merged into a neighboring direction or do not contribute are not searched */
+                if (rayWeights[RayIndex(c - cellRange.start, ntheta, nphi)] <= 0) {
+                    continue;
+                }
+
                 /** Get the initial direction of the search particle from the angle number that it was initialized with */
                 theta = (((double)ntheta + 0.5) / (double)nTheta) * ablate::utilities::Constants::pi;  //!< Theta angle of the ray
                 phi = ((double)nphi / (double)nPhi) * 2.0 * ablate::utilities::Constants::pi;          //!<  Phi angle of the ray
@@ -167,8 +214,7 @@ void ablate::radiation::Radiation::Initialize(const solver::Range& cellRange, ab
     DM faceDM;
     const PetscScalar* faceGeomArray;
 
-    DMPlexComputeGeometryFVM(subDomain.GetDM(), &cellGeomVec, &faceGeomVec) >> checkError;  //!< Get the geometry vectors
-    VecGetDM(faceGeomVec, &faceDM) >> checkError;
+    VecGetDM(faceGeomVec, &faceDM) >> checkError;  //!< The geometry vectors are computed during the setup
     VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
 
     /** Declare some information associated with the field declarations */
@@ -186,8 +232,16 @@ void ablate::radiation::Radiation::Initialize(const solver::Range& cellRange, ab
     PetscInt npoints = 0;
     DMSwarmGetLocalSize(radsearch, &npoints) >> checkError;  //!< Recalculate the number of particles that are in the domain
     DMSwarmGetSize(radsearch, &nglobalpoints) >> checkError;
-    PetscInt stepcount = 0;       //!< Count the number of steps that the particles have taken
-    while (nglobalpoints != 0) {  //!< WHILE THERE ARE PARTICLES IN ANY DOMAIN
+    PetscInt stepcount = 0;  //!< Count the number of steps that the particles have taken
+    std::vector<PetscInt> removedParticles;
+
+    /** The search can be skipped entirely if the ray geometry was cached for this mesh and ray count */
+    const bool cached = cacheRays && ReadRayCache(cellRange, subDomain);
+    if (cached && log) {
+        log->Printf("Loaded the ray geometry from the cache\n");
+    }
+
+    while (!cached && nglobalpoints != 0) {  //!< WHILE THERE ARE PARTICLES IN ANY DOMAIN
         /** Use the ParticleStep function to calculate the path lengths of the rays through each cell so that they can be stored.
          * This function also sets up the solve particle infrastructure.
          * */
@@ -216,19 +270,7 @@ void ablate::radiation::Radiation::Initialize(const solver::Range& cellRange, ab
              * If the domain is 1D and the x-direction of the particle is zero then delete the particle here
              * */
             if ((!(region->InRegion(region, subDomain.GetDM(), index[ipart]))) || ((dim == 1) && (abs(virtualcoord[ipart].xdir) < 0.0000001))) {
-                DMSwarmRestoreField(radsearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> checkError;
-                DMSwarmRestoreField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
-                DMSwarmRestoreField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-                DMSwarmRestoreField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
-
-                DMSwarmRemovePointAtIndex(radsearch, ipart);  //!< Delete the particle!
-                DMSwarmGetLocalSize(radsearch, &npoints);
-
-                DMSwarmGetField(radsearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> checkError;
-                DMSwarmGetField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
-                DMSwarmGetField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-                DMSwarmGetField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
-                ipart--;  //!< Check the point replacing the one that was deleted
+                removedParticles.push_back(ipart);  //!< Delete the particle after the loop so that the fields do not need to be restored for each removal
             } else {
                 /** Step 4: Push the particle virtual coordinates to the intersection that was found in the previous step.
                  * This ensures that the next calculated path length will start from the boundary of the adjacent cell.
@@ -253,6 +295,7 @@ void ablate::radiation::Radiation::Initialize(const solver::Range& cellRange, ab
         DMSwarmRestoreField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
         DMSwarmRestoreField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
         DMSwarmRestoreField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
+        RemoveParticles(radsearch, removedParticles);
 
         if (log) log->Printf("Migrate ...");
 
@@ -267,6 +310,18 @@ void ablate::radiation::Radiation::Initialize(const solver::Range& cellRange, ab
         }
         stepcount++;
     }
+
+    /** Now that all of the ray segments are known, build the dense storage used during the solve */
+    if (!cached) {
+        IndexRays(cellRange, subDomain.GetComm());
+        if (cacheRays) {
+            WriteRayCache(cellRange, subDomain);
+        }
+    }
+
+    /** The cache stores the segments on the rank that found them, so they are redistributed after the search or the read */
+    BalanceSegments(subDomain.GetComm());
+
     /** Cleanup */
     DMDestroy(&radsearch) >> checkError;
     VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
@@ -310,7 +365,13 @@ void ablate::radiation::Radiation::Solve(Vec solVec, ablate::domain::Field tempe
 
     if (log) log->Printf("x           y           z           G           L           T\n");  //!< Line labelling the log outputs for readability
 
-    for (auto& [iCell, o] : origin) {  //!< Iterate through the cells that are stored in the origin
+    for (std::size_t o = 0; o < origin.size(); ++o) {  //!< Iterate through the cells that are stored in the origin
+        /** Skip any origin that does not have ray segments */
+        if (rayOffsets[RayIndex((PetscInt)o, 0, 0)] == rayOffsets[RayIndex((PetscInt)o + 1, 0, 0)]) {
+            continue;
+        }
+        const PetscInt iCell = originCells[o];
+
         /** Gets the temperature from the cell index specified */
         /** In the case of a surface implementation, the temperature for the losses will be the temperature of the boundary cell that the face is attached to.
          * In the case of a volume implementation, the temperature of the losses will be the temperature of the volumetric origin cell.
@@ -327,10 +388,10 @@ void ablate::radiation::Radiation::Solve(Vec solVec, ablate::domain::Field tempe
             if (log) {
                 PetscReal centroid[3];
                 DMPlexComputeCellGeometryFVM(solDm, index, nullptr, centroid, nullptr) >> checkError;  //!< Reads the cell location from the current cell
-                printf("%f %f %f %f %f %f\n", centroid[0], centroid[1], centroid[2], origin[iCell].intensity, losses, *temperature);
+                printf("%f %f %f %f %f %f\n", centroid[0], centroid[1], centroid[2], origin[o].intensity, losses, *temperature);
             }
         }
-        origin[iCell].net = -kappa * (losses - origin[iCell].intensity);
+        origin[o].net = -kappa * (losses - origin[o].intensity);
     }
 
     /** Cleanup */
@@ -380,6 +441,47 @@ PetscInt ablate::radiation::Radiation::GetLossCell(PetscInt iCell, PetscReal& lo
 
 void ablate::radiation::Radiation::GetFuelEmissivity(double& kappa) {}
 
+void ablate::radiation::Radiation::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const {
+    // the segments are stored densely after the search, any segments still in the search map are counted as well
+    const auto segmentName = prefix + "radiation::segments";
+    memoryUsage.Add(segmentName, segments);
+    for (const auto& segment : segments) {
+        memoryUsage.Add(segmentName, segment.cells);
+        memoryUsage.Add(segmentName, segment.h);
+        memoryUsage.Add(segmentName, segment.propertyIndex);
+    }
+    for (const auto& [key, segment] : rays) {
+        memoryUsage.Add(segmentName, (PetscLogDouble)(key.capacity() + sizeof(Segment)));
+        memoryUsage.Add(segmentName, segment.cells);
+        memoryUsage.Add(segmentName, segment.h);
+        memoryUsage.Add(segmentName, segment.propertyIndex);
+    }
+
+    const auto originName = prefix + "radiation::origins";
+    memoryUsage.Add(originName, origin);
+    memoryUsage.Add(originName, originCells);
+    memoryUsage.Add(originName, originIndex);
+    memoryUsage.Add(originName, rayOffsets);
+    memoryUsage.Add(originName, rayWeights);
+    memoryUsage.Add(originName, handler);
+
+    const auto carrierName = prefix + "radiation::carriers";
+    memoryUsage.Add(carrierName, carriers);
+    memoryUsage.Add(carrierName, carrierSegments);
+
+    const auto propertyName = prefix + "radiation::cellProperties";
+    memoryUsage.Add(propertyName, propertyCells);
+    memoryUsage.Add(propertyName, propertyBatchCells);
+    memoryUsage.Add(propertyName, propertyConserved);
+    memoryUsage.Add(propertyName, propertyTemperature);
+    memoryUsage.Add(propertyName, propertyBatchAbsorptivity);
+    memoryUsage.Add(propertyName, propertyAbsorptivity);
+    memoryUsage.Add(propertyName, propertyIntensity);
+    memoryUsage.Add(propertyName, propertyReferenceAbsorptivity);
+    memoryUsage.Add(propertyName, propertyReferenceIntensity);
+    memoryUsage.Add(propertyName, propertyChanged);
+}
+
 PetscReal ablate::radiation::Radiation::SurfaceComponent(DM faceDM, const PetscScalar* faceGeomArray, PetscInt iCell, PetscInt nphi, PetscInt ntheta) { return 1.0; }
 
 void ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDomain, DM faceDM, const PetscScalar* faceGeomArray) { /** Check that the particle is in a valid region */
@@ -390,8 +492,6 @@ void ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDo
     DMSwarmGetLocalSize(radsearch, &npoints) >> checkError;
     DMSwarmGetSize(radsearch, &nglobalpoints) >> checkError;
 
-    PetscFVFaceGeom* faceGeom;
-
     PetscInt* index;
     PetscMPIInt rank = 0;
     MPI_Comm_rank(subDomain.GetComm(), &rank);
@@ -409,10 +509,12 @@ void ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDo
     DMSwarmGetField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
     DMSwarmGetField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
 
+    std::vector<char> valid(npoints, 0);  //!< Store if each particle is in a valid region so that the path lengths can be computed concurrently
     for (PetscInt ipart = 0; ipart < npoints; ipart++) {
         /** Check that the particle is in a valid region */
         //!< Compare against the field with the DMLocatePoints output instead of the output itself. This might be a little memory inefficient.
         if (index[ipart] >= 0 && subDomain.InRegion(index[ipart])) {
+            valid[ipart] = 1;
             /** If this local rank has never seen this search particle before, then it needs to add a new ray segment to local memory
              * Hash the identifier into a key value that can be used in the map
              * We should only iterate the identifier of the search particle (/ add a solver particle) if the point is valid in the domain and is being used
@@ -450,50 +552,724 @@ void ablate::radiation::Radiation::ParticleStep(ablate::domain::SubDomain& subDo
             /** Step 1: Register the current cell index in the rays vector. The physical coordinates that have been set in the previous step / loop will be immediately registered.
              * */
             rays[Key(&identifier[ipart])].cells.push_back(index[ipart]);
+        }
+    }
 
-            /** Step 2: Acquire the intersection of the particle search line with the segment or face. In the case if a two dimensional mesh, the virtual coordinate in the z direction will
-             * need to be solved for because the three dimensional line will not have a literal intersection with the segment of the cell. The third coordinate can be solved for in this case.
-             * Here we are figuring out what distance the ray spends inside the cell that it has just registered.
-             * */
-            /** March over each face on this cell in order to check them for the one which intersects this ray next */
-            PetscInt numberFaces;
-            const PetscInt* cellFaces;
-            DMPlexGetConeSize(subDomain.GetDM(), index[ipart], &numberFaces) >> checkError;
-            DMPlexGetCone(subDomain.GetDM(), index[ipart], &cellFaces) >> checkError;  //!< Get the face geometry associated with the current cell
-            PetscReal path;
-
-            /** Check every face for intersection with the segment.
-             * The segment with the shortest path length for intersection will be the one that physically intercepts with the cell face and not with the nonphysical plane beyond the face.
-             * */
-            for (PetscInt f = 0; f < numberFaces; f++) {
-                PetscInt face = cellFaces[f];
-                DMPlexPointLocalRead(faceDM, face, faceGeomArray, &faceGeom) >> checkError;  //!< Reads the cell location from the current cell
+    /** Step 2: Acquire the intersection of the particle search line with the segment or face. This only depends upon the particle and its cell so the particles are marched concurrently. */
+    auto computeCellPaths = [&](std::size_t start, std::size_t end, std::size_t) {
+        for (auto ipart = (PetscInt)start; ipart < (PetscInt)end; ipart++) {
+            if (valid[ipart]) {
+                ComputeCellPath(subDomain.GetDM(), faceDM, faceGeomArray, ipart, index[ipart], virtualcoord);
+            } else {
+                virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? minCellRadius : virtualcoord[ipart].hhere;
+            }
+        }
+    };
+    /** The cell path reads the mesh cones with petsc, so it is only threaded when petsc can be called from the helper threads */
+    if (ablate::utilities::KokkosUtilities::PetscThreadSafe()) {
+        ablate::utilities::KokkosUtilities::ParallelForChunks(npoints, computeCellPaths);
+    } else {
+        computeCellPaths(0, npoints, 0);
+    }
 
-                /** Get the intersection of the direction vector with the cell face
-                 * Use the plane equation and ray segment equation in order to get the face intersection with the shortest path length
-                 * This will be the next position of the search particle
-                 * */
-                path = FaceIntersect(ipart, virtualcoord, faceGeom);  //!< Use plane intersection equation by getting the centroid and normal vector of the face
+    /** Add the space steps of the particles that were registered in this step */
+    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
+        if (valid[ipart]) {
+            rays[Key(&identifier[ipart])].h.push_back(virtualcoord[ipart].hhere);  //!< Add this space step if the current index is being added.
+        }
+    }
+    DMSwarmRestoreField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
+    DMSwarmRestoreField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
+    DMSwarmRestoreField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
+}
 
-                /** Step 3: Take this path if it is shorter than the previous one, getting the shortest path.
-                 * The path should never be zero if the forwardIntersect check is functioning properly.
-                 * */
-                if (path > 0) {
-                    virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? (path * 1.1) : virtualcoord[ipart].hhere;  //!< Dumb check to ensure that the path length is always updated
-                    if (virtualcoord[ipart].hhere > path) {
-                        virtualcoord[ipart].hhere = path;  //!> Get the shortest path length of all of the faces. The point must be in the direction that the ray is travelling in order to be valid.
+void ablate::radiation::Radiation::ComputeCellPath(DM dm, DM faceDM, const PetscScalar* faceGeomArray, PetscInt ipart, PetscInt cell, Virtualcoord* virtualcoord) const {
+    /** Step 2: Acquire the intersection of the particle search line with the segment or face. In the case if a two dimensional mesh, the virtual coordinate in the z direction will
+     * need to be solved for because the three dimensional line will not have a literal intersection with the segment of the cell. The third coordinate can be solved for in this case.
+     * Here we are figuring out what distance the ray spends inside the cell that it has just registered.
+     * */
+    /** March over each face on this cell in order to check them for the one which intersects this ray next */
+    PetscInt numberFaces;
+    const PetscInt* cellFaces;
+    PetscFVFaceGeom* faceGeom;
+    DMPlexGetConeSize(dm, cell, &numberFaces) >> checkError;
+    DMPlexGetCone(dm, cell, &cellFaces) >> checkError;  //!< Get the face geometry associated with the current cell
+    PetscReal path;
+
+    /** Check every face for intersection with the segment.
+     * The segment with the shortest path length for intersection will be the one that physically intercepts with the cell face and not with the nonphysical plane beyond the face.
+     * */
+    for (PetscInt f = 0; f < numberFaces; f++) {
+        PetscInt face = cellFaces[f];
+        DMPlexPointLocalRead(faceDM, face, faceGeomArray, &faceGeom) >> checkError;  //!< Reads the cell location from the current cell
+
+        /** Get the intersection of the direction vector with the cell face
+         * Use the plane equation and ray segment equation in order to get the face intersection with the shortest path length
+         * This will be the next position of the search particle
+         * */
+        path = FaceIntersect(ipart, virtualcoord, faceGeom);  //!< Use plane intersection equation by getting the centroid and normal vector of the face
+
+        /** Step 3: Take this path if it is shorter than the previous one, getting the shortest path.
+         * The path should never be zero if the forwardIntersect check is functioning properly.
+         * */
+        if (path > 0) {
+            virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? (path * 1.1) : virtualcoord[ipart].hhere;  //!< Dumb check to ensure that the path length is always updated
+            if (virtualcoord[ipart].hhere > path) {
+                virtualcoord[ipart].hhere = path;  //!> Get the shortest path length of all of the faces. The point must be in the direction that the ray is travelling in order to be valid.
+            }
+        }
+    }
+    virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? minCellRadius : virtualcoord[ipart].hhere;
+}
+
+void ablate::radiation::Radiation::RemoveParticles(DM swarm, std::vector<PetscInt>& indices) {
+    /** Removing a point moves the last point into its place, so removing from the back keeps the remaining indices valid */
+    std::sort(indices.begin(), indices.end(), std::greater<>());
+    for (const auto& index : indices) {
+        DMSwarmRemovePointAtIndex(swarm, index) >> checkError;
+    }
+    indices.clear();
+}
+
+void ablate::radiation::Radiation::IndexOrigins(const solver::Range& cellRange) {
+    /** Each cell in the range is an origin, build the map from the point to the local origin index */
+    const PetscInt numberOrigins = cellRange.end - cellRange.start;
+    origin.assign(numberOrigins, Origin{});
+    originCells.resize(numberOrigins);
+    PetscInt originPointEnd = 0;
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt iCell = cellRange.points ? cellRange.points[c] : c;
+        originCells[c - cellRange.start] = iCell;
+        originPointStart = (c == cellRange.start) ? iCell : PetscMin(originPointStart, iCell);
+        originPointEnd = (c == cellRange.start) ? iCell + 1 : PetscMax(originPointEnd, iCell + 1);
+    }
+    originIndex.assign(originPointEnd - originPointStart, -1);
+    for (PetscInt o = 0; o < numberOrigins; ++o) {
+        originIndex[originCells[o] - originPointStart] = o;
+    }
+}
+
+PetscReal ablate::radiation::Radiation::RayWeight(DM faceDM, const PetscScalar* faceGeomArray, PetscInt iCell, PetscInt ntheta, PetscInt nphi) {
+    const PetscReal dTheta = ablate::utilities::Constants::pi / (nTheta);
+    const PetscReal dPhi = (2 * ablate::utilities::Constants::pi) / (nPhi);
+    PetscReal theta;
+    if (dim != 1) {
+        theta = (((double)ntheta + 0.5) / (double)nTheta) * ablate::utilities::Constants::pi;  //!< This is a fine method of determining theta because it is in the original domain
+    } else {
+        theta = (((double)nphi) / (double)nPhi) * 2 * ablate::utilities::Constants::pi;
+    }
+    PetscReal ldotn = SurfaceComponent(faceDM, faceGeomArray, iCell, nphi, ntheta);  //!< If surface, get the perpendicular component here and multiply the result by it
+    return abs(sin(theta)) * dTheta * dPhi * ldotn;
+}
+
+void ablate::radiation::Radiation::SelectRays(DM faceDM, const PetscScalar* faceGeomArray) {
+    const PetscInt raysPerOrigin = nTheta * nPhi;
+    rayWeights.assign(origin.size() * raysPerOrigin, 0.0);
+
+    /** A block of neighboring directions (ntheta, nphi) that is represented by a single ray carrying the quadrature weight of the whole block */
+    struct RayBlock {
+        PetscInt thetaStart;
+        PetscInt thetaEnd;
+        PetscInt phiStart;
+        PetscInt phiEnd;
+        PetscReal weight = 0;
+    };
+    auto compareBlocks = [](const RayBlock& a, const RayBlock& b) { return a.weight < b.weight; };
+
+    std::vector<PetscReal> directionWeights(raysPerOrigin);
+    for (std::size_t o = 0; o < origin.size(); ++o) {
+        for (PetscInt ntheta = 0; ntheta < nTheta; ntheta++) {
+            for (PetscInt nphi = 0; nphi < nPhi; nphi++) {
+                directionWeights[ntheta * nPhi + nphi] = RayWeight(faceDM, faceGeomArray, originCells[o], ntheta, nphi);
+            }
+        }
+
+        /** Without a budget every contributing direction is searched */
+        const PetscInt rayStart = RayIndex((PetscInt)o, 0, 0);
+        if (rayBudget <= 0 || rayBudget >= raysPerOrigin) {
+            std::copy(directionWeights.begin(), directionWeights.end(), rayWeights.begin() + rayStart);
+            continue;
+        }
+
+        /** Start from the finest uniform tiling of the directions that fits within the budget */
+        auto weighBlock = [&](RayBlock& block) {
+            block.weight = 0;
+            for (PetscInt ntheta = block.thetaStart; ntheta < block.thetaEnd; ntheta++) {
+                for (PetscInt nphi = block.phiStart; nphi < block.phiEnd; nphi++) {
+                    block.weight += directionWeights[ntheta * nPhi + nphi];
+                }
+            }
+        };
+        PetscInt blockSize = 1;
+        while (((nTheta + blockSize - 1) / blockSize) * ((nPhi + blockSize - 1) / blockSize) > rayBudget) {
+            blockSize *= 2;
+        }
+        std::priority_queue<RayBlock, std::vector<RayBlock>, decltype(compareBlocks)> candidates(compareBlocks);
+        for (PetscInt ntheta = 0; ntheta < nTheta; ntheta += blockSize) {
+            for (PetscInt nphi = 0; nphi < nPhi; nphi += blockSize) {
+                RayBlock block{.thetaStart = ntheta, .thetaEnd = PetscMin(ntheta + blockSize, nTheta), .phiStart = nphi, .phiEnd = PetscMin(nphi + blockSize, nPhi)};
+                weighBlock(block);
+                if (block.weight > 0) {
+                    candidates.push(block);
+                }
+            }
+        }
+
+        /** Refine the blocks that carry the most weight while the budget allows, the directions with little or no contribution stay merged */
+        auto numberBlocks = (PetscInt)candidates.size();
+        std::vector<RayBlock> selected;
+        std::vector<RayBlock> children;
+        while (!candidates.empty()) {
+            const auto block = candidates.top();
+            candidates.pop();
+
+            const PetscInt thetaMid = (block.thetaStart + block.thetaEnd) / 2;
+            const PetscInt phiMid = (block.phiStart + block.phiEnd) / 2;
+            children.clear();
+            for (const auto& [thetaStart, thetaEnd] : {std::pair{block.thetaStart, thetaMid}, std::pair{thetaMid, block.thetaEnd}}) {
+                for (const auto& [phiStart, phiEnd] : {std::pair{block.phiStart, phiMid}, std::pair{phiMid, block.phiEnd}}) {
+                    RayBlock child{.thetaStart = thetaStart, .thetaEnd = thetaEnd, .phiStart = phiStart, .phiEnd = phiEnd};
+                    if (thetaStart < thetaEnd && phiStart < phiEnd) {
+                        weighBlock(child);
+                        if (child.weight > 0) {
+                            children.push_back(child);
+                        }
                     }
                 }
             }
-            virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? minCellRadius : virtualcoord[ipart].hhere;
-            rays[Key(&identifier[ipart])].h.push_back(virtualcoord[ipart].hhere);  //!< Add this space step if the current index is being added.
+
+            const bool splittable = (block.thetaEnd - block.thetaStart) > 1 || (block.phiEnd - block.phiStart) > 1;
+            if (splittable && numberBlocks - 1 + (PetscInt)children.size() <= rayBudget) {
+                numberBlocks += (PetscInt)children.size() - 1;
+                for (const auto& child : children) {
+                    candidates.push(child);
+                }
+            } else {
+                selected.push_back(block);
+            }
+        }
+
+        /** Each block is searched with the direction at its center, or the largest contributing direction if the center does not contribute */
+        for (const auto& block : selected) {
+            PetscInt direction = ((block.thetaStart + block.thetaEnd) / 2) * nPhi + (block.phiStart + block.phiEnd) / 2;
+            if (directionWeights[direction] <= 0) {
+                for (PetscInt ntheta = block.thetaStart; ntheta < block.thetaEnd; ntheta++) {
+                    for (PetscInt nphi = block.phiStart; nphi < block.phiEnd; nphi++) {
+                        direction = directionWeights[ntheta * nPhi + nphi] > directionWeights[direction] ? ntheta * nPhi + nphi : direction;
+                    }
+                }
+            }
+            rayWeights[rayStart + direction] = block.weight;
+        }
+    }
+}
+
+void ablate::radiation::Radiation::IndexCellProperties() {
+    /** Map each segment cell to the unique local cells so that the properties can be computed once per cell */
+    if (!UseCellProperties()) {
+        return;
+    }
+    std::map<PetscInt, PetscInt> propertyKeys;
+    for (auto& segment : segments) {
+        segment.propertyIndex.resize(segment.cells.size());
+        for (std::size_t n = 0; n < segment.cells.size(); ++n) {
+            auto propertyKey = propertyKeys.emplace(segment.cells[n], (PetscInt)propertyKeys.size()).first;
+            segment.propertyIndex[n] = propertyKey->second;
+        }
+    }
+    propertyCells.resize(propertyKeys.size());
+    for (const auto& [cell, p] : propertyKeys) {
+        propertyCells[p] = cell;
+    }
+    propertyBatchCells.resize(propertyCells.size());
+    propertyConserved.resize(propertyCells.size() * solutionStride);
+    propertyTemperature.resize(propertyCells.size());
+    propertyBatchAbsorptivity.resize(propertyCells.size());
+    propertyAbsorptivity.resize(propertyCells.size());
+    propertyIntensity.resize(propertyCells.size());
+
+    /** The reference values start undefined so that every segment is integrated in the first evaluation */
+    propertyReferenceAbsorptivity.assign(propertyCells.size(), std::numeric_limits<PetscReal>::quiet_NaN());
+    propertyReferenceIntensity.assign(propertyCells.size(), std::numeric_limits<PetscReal>::quiet_NaN());
+    propertyChanged.assign(propertyCells.size(), 1);
+}
+
+void ablate::radiation::Radiation::IndexRays(const solver::Range& cellRange, MPI_Comm comm) {
+    PetscMPIInt rank = 0;
+    MPI_Comm_rank(comm, &rank);
+    const PetscInt numberOrigins = (PetscInt)origin.size();
+
+    /** Move the ray segments into the dense array */
+    std::map<std::string, PetscInt> segmentKeys;
+    segments.clear();
+    segments.reserve(rays.size());
+    for (auto& [key, segment] : rays) {
+        segmentKeys[key] = (PetscInt)segments.size();
+        segments.push_back(std::move(segment));
+    }
+    rays.clear();
+    presence.clear();
+
+    IndexCellProperties();
+
+    /** Each solve particle becomes a root carrier drawing from the segment of its access identifier. The particles record their root so that it can be found at the origin. */
+    PetscInt npoints;
+    PetscInt* rankid;
+    PetscInt* source;               //!< Pointer to the root (rank, index) of each solve particle
+    struct Identifier* identifier;  //!< Pointer to the ray identifier information
+    struct Identifier* access;      //!< Pointer to the ray identifier information
+    DMSwarmGetLocalSize(radsolve, &npoints) >> checkError;
+    DMSwarmGetField(radsolve, "DMSwarm_rank", nullptr, nullptr, (void**)&rankid) >> checkError;
+    DMSwarmGetField(radsolve, "source", nullptr, nullptr, (void**)&source) >> checkError;
+    DMSwarmGetField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
+    DMSwarmGetField(radsolve, "access", nullptr, nullptr, (void**)&access) >> checkError;
+    carrierSegments.resize(npoints);
+    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
+        auto segmentKey = segmentKeys.find(Key(&access[ipart]));
+        carrierSegments[ipart] = segmentKey == segmentKeys.end() ? -1 : segmentKey->second;
+        source[2 * ipart] = rank;
+        source[2 * ipart + 1] = ipart;
+        rankid[ipart] = identifier[ipart].origin;
+    }
+    carriers.assign(npoints, Carrier{});
+    DMSwarmRestoreField(radsolve, "DMSwarm_rank", nullptr, nullptr, (void**)&rankid) >> checkError;
+    DMSwarmRestoreField(radsolve, "source", nullptr, nullptr, (void**)&source) >> checkError;
+    DMSwarmRestoreField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
+    DMSwarmRestoreField(radsolve, "access", nullptr, nullptr, (void**)&access) >> checkError;
+
+    /** Send the solve particles to their origins once. This is the only migration, the topology of the rays does not change after the initialization. */
+    DMSwarmMigrate(radsolve, PETSC_FALSE) >> checkError;
+    DMSwarmGetLocalSize(radsolve, &npoints) >> checkError;
+    DMSwarmGetField(radsolve, "source", nullptr, nullptr, (void**)&source) >> checkError;
+    DMSwarmGetField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
+
+    /** The offsets store the number of segments in each ray until the inclusive scan below */
+    rayOffsets.assign(numberOrigins * nTheta * nPhi + 1, 0);
+    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
+        if (identifier[ipart].origin == rank) {
+            const PetscInt o = OriginIndex(identifier[ipart].iCell);
+            if (o >= 0) {
+                auto& count = rayOffsets[RayIndex(o, identifier[ipart].ntheta, identifier[ipart].nphi) + 1];
+                count = PetscMax(count, identifier[ipart].nsegment);
+            }
+        }
+    }
+    for (std::size_t r = 1; r < rayOffsets.size(); ++r) {
+        rayOffsets[r] += rayOffsets[r - 1];
+    }
+    handler.assign(rayOffsets.back(), Carrier{});
+
+    /** Each handler entry is a leaf pointing to the root carrier of its ray segment. Entries without a root keep an empty carrier. */
+    std::vector<PetscInt> leaves;
+    std::vector<PetscSFNode> remotes;
+    std::vector<bool> filled(handler.size(), false);
+    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
+        if (identifier[ipart].origin == rank && identifier[ipart].nsegment > 0) {
+            const PetscInt o = OriginIndex(identifier[ipart].iCell);
+            if (o >= 0) {
+                const PetscInt h = rayOffsets[RayIndex(o, identifier[ipart].ntheta, identifier[ipart].nphi)] + identifier[ipart].nsegment - 1;
+                if (!filled[h]) {
+                    filled[h] = true;
+                    leaves.push_back(h);
+                    remotes.push_back(PetscSFNode{.rank = source[2 * ipart], .index = source[2 * ipart + 1]});
+                }
+            }
+        }
+    }
+    DMSwarmRestoreField(radsolve, "source", nullptr, nullptr, (void**)&source) >> checkError;
+    DMSwarmRestoreField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
+
+    CreateCarrierCommunication(comm, leaves, remotes);
+}
+
+void ablate::radiation::Radiation::CreateCarrierCommunication(MPI_Comm comm, const std::vector<PetscInt>& leaves, const std::vector<PetscSFNode>& remotes) {
+    PetscSFDestroy(&carrierSF) >> checkError;
+    PetscSFCreate(comm, &carrierSF) >> checkError;
+    PetscSFSetGraph(carrierSF, (PetscInt)carriers.size(), (PetscInt)leaves.size(), leaves.data(), PETSC_COPY_VALUES, remotes.data(), PETSC_COPY_VALUES) >> checkError;
+    PetscSFSetUp(carrierSF) >> checkError;
+    if (carrierType == MPI_DATATYPE_NULL) {
+        MPI_Type_contiguous(sizeof(Carrier) / sizeof(PetscReal), MPIU_REAL, &carrierType) >> checkMpiError;
+        MPI_Type_commit(&carrierType) >> checkMpiError;
+    }
+
+    /** The solve particles are no longer needed */
+    if (radsolve) DMDestroy(&radsolve) >> checkError;
+}
+
+void ablate::radiation::Radiation::BalanceSegments(MPI_Comm comm) {
+    if (segmentBalanceTolerance <= 0 || numRanks == 1) {
+        return;
+    }
+    PetscMPIInt rank = 0;
+    MPI_Comm_rank(comm, &rank) >> checkMpiError;
+
+    /** The cost of each segment is estimated by the number of cells that it integrates */
+    PetscReal localCost = 0.0;
+    for (const auto& segment : segments) {
+        localCost += (PetscReal)segment.propertyIndex.size();
+    }
+    std::vector<PetscReal> rankCost(numRanks);
+    MPI_Allgather(&localCost, 1, MPIU_REAL, rankCost.data(), 1, MPIU_REAL, comm) >> checkMpiError;
+
+    /** Only redistribute if the most expensive rank is sufficiently above the average */
+    const PetscReal averageCost = std::accumulate(rankCost.begin(), rankCost.end(), 0.0) / numRanks;
+    const PetscReal maximumCost = *std::max_element(rankCost.begin(), rankCost.end());
+    if (maximumCost <= averageCost * (1.0 + segmentBalanceTolerance)) {
+        return;
+    }
+
+    /** Pair the ranks above the average with the ranks below it.  Every rank computes the same plan, so only the moved segments need to be communicated.
+     * The exported segments are taken from the end of the segments array so the kept segments do not need to be renumbered.
+     * */
+    struct SegmentExchange {
+        PetscMPIInt rank;
+        PetscInt start;
+        PetscInt count;
+    };
+    std::vector<SegmentExchange> exportedSegments;
+    std::vector<SegmentExchange> importedSegments;
+    std::vector<PetscReal> surplus(numRanks);
+    for (PetscMPIInt r = 0; r < numRanks; r++) {
+        surplus[r] = rankCost[r] - averageCost;
+    }
+    auto numberKept = (PetscInt)segments.size();
+    for (PetscMPIInt sender = 0, receiver = 0;;) {
+        while (sender < numRanks && surplus[sender] <= 0.0) {
+            sender++;
+        }
+        while (receiver < numRanks && surplus[receiver] >= 0.0) {
+            receiver++;
+        }
+        if (sender == numRanks || receiver == numRanks) {
+            break;
+        }
+        const PetscReal transferCost = PetscMin(surplus[sender], -surplus[receiver]);
+        surplus[sender] -= transferCost;
+        surplus[receiver] += transferCost;
+
+        if (sender == rank) {
+            PetscReal shippedCost = 0.0;
+            const PetscInt end = numberKept;
+            while (numberKept > 0 && shippedCost + 0.5 * (PetscReal)segments[numberKept - 1].propertyIndex.size() < transferCost) {
+                shippedCost += (PetscReal)segments[--numberKept].propertyIndex.size();
+            }
+            exportedSegments.push_back(SegmentExchange{.rank = receiver, .start = numberKept, .count = end - numberKept});
+        } else if (receiver == rank) {
+            importedSegments.push_back(SegmentExchange{.rank = sender, .start = 0, .count = 0});
+        }
+    }
+
+    /** The carriers of the exported segments move with them, the kept carriers are compacted */
+    std::vector<PetscInt> segmentExport(segments.size(), -1);
+    for (std::size_t e = 0; e < exportedSegments.size(); e++) {
+        std::fill(segmentExport.begin() + exportedSegments[e].start, segmentExport.begin() + exportedSegments[e].start + exportedSegments[e].count, (PetscInt)e);
+    }
+    std::vector<std::vector<PetscInt>> exportedCarriers(exportedSegments.size());
+    std::vector<PetscSFNode> carrierRoots(carriers.size());
+    std::vector<PetscInt> keptCarrierSegments;
+    for (std::size_t c = 0; c < carriers.size(); c++) {
+        if (carrierSegments[c] >= 0 && segmentExport[carrierSegments[c]] >= 0) {
+            exportedCarriers[segmentExport[carrierSegments[c]]].push_back((PetscInt)c);
         } else {
-            virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? minCellRadius : virtualcoord[ipart].hhere;
+            carrierRoots[c] = PetscSFNode{.rank = rank, .index = (PetscInt)keptCarrierSegments.size()};
+            keptCarrierSegments.push_back(carrierSegments[c]);
         }
     }
-    DMSwarmRestoreField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-    DMSwarmRestoreField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
-    DMSwarmRestoreField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
+
+    /** Share the size of each transfer, (segments, cells, carriers) */
+    std::vector<MPI_Request> requests;
+    std::vector<std::array<PetscInt, 3>> exportCounts(exportedSegments.size());
+    std::vector<std::array<PetscInt, 3>> importCounts(importedSegments.size());
+    for (std::size_t e = 0; e < exportedSegments.size(); e++) {
+        PetscInt numberCells = 0;
+        for (PetscInt s = exportedSegments[e].start; s < exportedSegments[e].start + exportedSegments[e].count; s++) {
+            numberCells += (PetscInt)segments[s].propertyIndex.size();
+        }
+        exportCounts[e] = {exportedSegments[e].count, numberCells, (PetscInt)exportedCarriers[e].size()};
+        MPI_Isend(exportCounts[e].data(), 3, MPIU_INT, exportedSegments[e].rank, 0, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    for (std::size_t i = 0; i < importedSegments.size(); i++) {
+        MPI_Irecv(importCounts[i].data(), 3, MPIU_INT, importedSegments[i].rank, 0, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    MPI_Waitall((PetscMPIInt)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> checkMpiError;
+    requests.clear();
+
+    /** The imported segments and carriers are appended after the local ones, the receiver returns the first carrier index so the sender can locate its moved carriers */
+    std::vector<PetscInt> importCarrierStart(importedSegments.size());
+    std::vector<PetscInt> exportCarrierStart(exportedSegments.size());
+    auto numberSegments = (PetscInt)segments.size();
+    auto numberCarriers = (PetscInt)carriers.size();
+    for (std::size_t i = 0; i < importedSegments.size(); i++) {
+        importedSegments[i].start = numberSegments;
+        importedSegments[i].count = importCounts[i][0];
+        importCarrierStart[i] = numberCarriers;
+        numberSegments += importCounts[i][0];
+        numberCarriers += importCounts[i][2];
+        MPI_Isend(&importCarrierStart[i], 1, MPIU_INT, importedSegments[i].rank, 1, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    for (std::size_t e = 0; e < exportedSegments.size(); e++) {
+        MPI_Irecv(&exportCarrierStart[e], 1, MPIU_INT, exportedSegments[e].rank, 1, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    MPI_Waitall((PetscMPIInt)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> checkMpiError;
+    requests.clear();
+
+    /** Each segment is shipped as its number of cells, the property index of each cell, and the space steps. Each carrier is shipped as its segment relative to the first shipped segment. */
+    std::vector<std::vector<PetscInt>> exportIndexBuffers(exportedSegments.size());
+    std::vector<std::vector<PetscReal>> exportStepBuffers(exportedSegments.size());
+    std::vector<std::vector<PetscInt>> importIndexBuffers(importedSegments.size());
+    std::vector<std::vector<PetscReal>> importStepBuffers(importedSegments.size());
+    for (std::size_t e = 0; e < exportedSegments.size(); e++) {
+        auto& indexBuffer = exportIndexBuffers[e];
+        auto& stepBuffer = exportStepBuffers[e];
+        for (PetscInt s = exportedSegments[e].start; s < exportedSegments[e].start + exportedSegments[e].count; s++) {
+            indexBuffer.push_back((PetscInt)segments[s].propertyIndex.size());
+        }
+        for (PetscInt s = exportedSegments[e].start; s < exportedSegments[e].start + exportedSegments[e].count; s++) {
+            indexBuffer.insert(indexBuffer.end(), segments[s].propertyIndex.begin(), segments[s].propertyIndex.end());
+            stepBuffer.insert(stepBuffer.end(), segments[s].h.begin(), segments[s].h.end());
+        }
+        for (std::size_t k = 0; k < exportedCarriers[e].size(); k++) {
+            const PetscInt c = exportedCarriers[e][k];
+            indexBuffer.push_back(carrierSegments[c] - exportedSegments[e].start);
+            carrierRoots[c] = PetscSFNode{.rank = exportedSegments[e].rank, .index = exportCarrierStart[e] + (PetscInt)k};
+        }
+        MPI_Isend(indexBuffer.data(), (PetscMPIInt)indexBuffer.size(), MPIU_INT, exportedSegments[e].rank, 2, comm, &requests.emplace_back()) >> checkMpiError;
+        MPI_Isend(stepBuffer.data(), (PetscMPIInt)stepBuffer.size(), MPIU_REAL, exportedSegments[e].rank, 3, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    for (std::size_t i = 0; i < importedSegments.size(); i++) {
+        importIndexBuffers[i].resize(importCounts[i][0] + importCounts[i][1] + importCounts[i][2]);
+        importStepBuffers[i].resize(importCounts[i][1]);
+        MPI_Irecv(importIndexBuffers[i].data(), (PetscMPIInt)importIndexBuffers[i].size(), MPIU_INT, importedSegments[i].rank, 2, comm, &requests.emplace_back()) >> checkMpiError;
+        MPI_Irecv(importStepBuffers[i].data(), (PetscMPIInt)importStepBuffers[i].size(), MPIU_REAL, importedSegments[i].rank, 3, comm, &requests.emplace_back()) >> checkMpiError;
+    }
+    MPI_Waitall((PetscMPIInt)requests.size(), requests.data(), MPI_STATUSES_IGNORE) >> checkMpiError;
+
+    /** Tell the origins where each carrier is now computed so the carrier star forest can be rebuilt */
+    std::vector<PetscSFNode> handlerRoots(handler.size());
+    PetscSFBcastBegin(carrierSF, MPIU_2INT, carrierRoots.data(), handlerRoots.data(), MPI_REPLACE) >> checkError;
+    PetscSFBcastEnd(carrierSF, MPIU_2INT, carrierRoots.data(), handlerRoots.data(), MPI_REPLACE) >> checkError;
+    PetscInt numberLeaves;
+    const PetscInt* localLeaves;
+    PetscSFGetGraph(carrierSF, nullptr, &numberLeaves, &localLeaves, nullptr) >> checkError;
+    std::vector<PetscInt> leaves(numberLeaves);
+    std::vector<PetscSFNode> remotes(numberLeaves);
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        leaves[l] = localLeaves ? localLeaves[l] : l;
+        remotes[l] = handlerRoots[leaves[l]];
+    }
+
+    /** Drop the exported segments and carriers */
+    segments.resize(numberKept);
+    carrierSegments = std::move(keptCarrierSegments);
+
+    /** Append the imported segments. Their cells are not local, so each cell property is read from the property arrays of the sender after the local cells. */
+    std::map<std::pair<PetscInt, PetscInt>, PetscInt> remotePropertyKeys;
+    std::vector<PetscSFNode> remoteProperties;
+    const auto numberLocalProperties = (PetscInt)propertyCells.size();
+    for (std::size_t i = 0; i < importedSegments.size(); i++) {
+        const auto& indexBuffer = importIndexBuffers[i];
+        const auto& stepBuffer = importStepBuffers[i];
+        const auto segmentStart = (PetscInt)segments.size();
+        PetscInt cellOffset = 0;
+        for (PetscInt s = 0; s < importCounts[i][0]; s++) {
+            const PetscInt numberCells = indexBuffer[s];
+            auto& segment = segments.emplace_back();
+            segment.h.assign(stepBuffer.begin() + cellOffset, stepBuffer.begin() + cellOffset + numberCells);
+            segment.propertyIndex.resize(numberCells);
+            for (PetscInt n = 0; n < numberCells; n++) {
+                const PetscInt senderIndex = indexBuffer[importCounts[i][0] + cellOffset + n];
+                auto remoteKey = remotePropertyKeys.emplace(std::make_pair((PetscInt)importedSegments[i].rank, senderIndex), numberLocalProperties + (PetscInt)remoteProperties.size());
+                if (remoteKey.second) {
+                    remoteProperties.push_back(PetscSFNode{.rank = importedSegments[i].rank, .index = senderIndex});
+                }
+                segment.propertyIndex[n] = remoteKey.first->second;
+            }
+            cellOffset += numberCells;
+        }
+        for (PetscInt k = 0; k < importCounts[i][2]; k++) {
+            carrierSegments.push_back(segmentStart + indexBuffer[importCounts[i][0] + importCounts[i][1] + k]);
+        }
+    }
+
+    /** The property arrays hold the local cells followed by the remote cells */
+    const std::size_t numberProperties = propertyCells.size() + remoteProperties.size();
+    propertyAbsorptivity.resize(numberProperties);
+    propertyIntensity.resize(numberProperties);
+    propertyReferenceAbsorptivity.assign(numberProperties, std::numeric_limits<PetscReal>::quiet_NaN());
+    propertyReferenceIntensity.assign(numberProperties, std::numeric_limits<PetscReal>::quiet_NaN());
+    propertyChanged.assign(numberProperties, 1);
+    PetscSFDestroy(&propertySF) >> checkError;
+    PetscSFCreate(comm, &propertySF) >> checkError;
+    PetscSFSetGraph(propertySF, numberLocalProperties, (PetscInt)remoteProperties.size(), nullptr, PETSC_COPY_VALUES, remoteProperties.data(), PETSC_COPY_VALUES) >> checkError;
+    PetscSFSetUp(propertySF) >> checkError;
+
+    /** Rebuild the carrier communication with the new roots */
+    carriers.assign(carrierSegments.size(), Carrier{});
+    CreateCarrierCommunication(comm, leaves, remotes);
+
+    if (log) {
+        localCost = 0.0;
+        for (const auto& segment : segments) {
+            localCost += (PetscReal)segment.propertyIndex.size();
+        }
+        PetscReal balancedCost = 0.0;
+        MPI_Allreduce(&localCost, &balancedCost, 1, MPIU_REAL, MPIU_MAX, comm) >> checkMpiError;
+        log->Printf("Balanced the ray segments, the maximum rank cost changed from %g to %g (average %g)\n", (double)maximumCost, (double)balancedCost, (double)averageCost);
+    }
+}
+
+std::filesystem::path ablate::radiation::Radiation::GetRayCachePath(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) const {
+    PetscMPIInt rank = 0;
+    MPI_Comm_rank(subDomain.GetComm(), &rank) >> checkMpiError;
+
+    /** The key includes the ray count, the partition, the origins, and the local mesh coordinates */
+    std::string keyData = typeid(*this).name();
+    auto append = [&keyData](const void* data, std::size_t size) { keyData.append((const char*)data, size); };
+    append(&numRanks, sizeof(numRanks));
+    append(&rank, sizeof(rank));
+    append(&nTheta, sizeof(nTheta));
+    append(&nPhi, sizeof(nPhi));
+    append(&dim, sizeof(dim));
+    append(&rayBudget, sizeof(rayBudget));
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt iCell = cellRange.points ? cellRange.points[c] : c;
+        append(&iCell, sizeof(iCell));
+    }
+    Vec coordinates;
+    PetscInt coordinatesSize;
+    const PetscScalar* coordinatesArray;
+    DMGetCoordinatesLocal(subDomain.GetDM(), &coordinates) >> checkError;
+    VecGetLocalSize(coordinates, &coordinatesSize) >> checkError;
+    VecGetArrayRead(coordinates, &coordinatesArray) >> checkError;
+    append(coordinatesArray, coordinatesSize * sizeof(PetscScalar));
+    VecRestoreArrayRead(coordinates, &coordinatesArray) >> checkError;
+
+    const auto key = utilities::StringUtilities::Hash(keyData);
+    return environment::RunEnvironment::Get().GetOutputDirectory() / "radiationRayCache" / (key + "." + std::to_string(rank) + ".bin");
+}
+
+bool ablate::radiation::Radiation::ReadRayCache(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) {
+    std::vector<PetscInt> leaves;
+    std::vector<PetscSFNode> remotes;
+    PetscMPIInt loaded = 0;
+    if (std::ifstream file(GetRayCachePath(cellRange, subDomain), std::ios::binary); file) {
+        auto readVector = [&file](auto& vector) {
+            std::size_t size = 0;
+            file.read((char*)&size, sizeof(size));
+            if (file) {
+                vector.resize(size);
+                file.read((char*)vector.data(), (std::streamsize)(size * sizeof(vector[0])));
+            }
+        };
+
+        PetscInt version = 0;
+        std::size_t numberSegments = 0;
+        file.read((char*)&version, sizeof(version));
+        file.read((char*)&numberSegments, sizeof(numberSegments));
+        if (file && version == RAY_CACHE_VERSION) {
+            segments.resize(numberSegments);
+            for (auto& segment : segments) {
+                readVector(segment.cells);
+                readVector(segment.h);
+            }
+            readVector(carrierSegments);
+            readVector(rayOffsets);
+            readVector(leaves);
+            readVector(remotes);
+
+            /** Check that the cache matches this setup */
+            loaded = file && rayOffsets.size() == origin.size() * nTheta * nPhi + 1 && leaves.size() == remotes.size() &&
+                     std::all_of(leaves.begin(), leaves.end(), [this](const auto& leaf) { return leaf >= 0 && leaf < rayOffsets.back(); });
+        }
+    }
+
+    /** Every rank must skip the search or the search must be run everywhere */
+    PetscMPIInt allLoaded = 0;
+    MPI_Allreduce(&loaded, &allLoaded, 1, MPI_INT, MPI_MIN, subDomain.GetComm()) >> checkMpiError;
+    if (!allLoaded) {
+        segments.clear();
+        carrierSegments.clear();
+        rayOffsets.clear();
+        return false;
+    }
+
+    IndexCellProperties();
+    handler.assign(rayOffsets.back(), Carrier{});
+    carriers.assign(carrierSegments.size(), Carrier{});
+    CreateCarrierCommunication(subDomain.GetComm(), leaves, remotes);
+    return true;
+}
+
+void ablate::radiation::Radiation::WriteRayCache(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) const {
+    const auto path = GetRayCachePath(cellRange, subDomain);
+    std::error_code errorCode;
+    std::filesystem::create_directories(path.parent_path(), errorCode);
+
+    /** Get the communication graph back from the star forest */
+    PetscInt numberRoots, numberLeaves;
+    const PetscInt* localLeaves;
+    const PetscSFNode* remoteLeaves;
+    PetscSFGetGraph(carrierSF, &numberRoots, &numberLeaves, &localLeaves, &remoteLeaves) >> checkError;
+    std::vector<PetscInt> leaves(numberLeaves);
+    for (PetscInt l = 0; l < numberLeaves; ++l) {
+        leaves[l] = localLeaves ? localLeaves[l] : l;
+    }
+    std::vector<PetscSFNode> remotes(remoteLeaves, remoteLeaves + numberLeaves);
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        if (log) {
+            log->Printf("Unable to write the ray cache to %s\n", path.c_str());
+        }
+        return;
+    }
+    auto writeVector = [&file](const auto& vector) {
+        std::size_t size = vector.size();
+        file.write((const char*)&size, sizeof(size));
+        file.write((const char*)vector.data(), (std::streamsize)(size * sizeof(vector[0])));
+    };
+
+    const PetscInt version = RAY_CACHE_VERSION;
+    const std::size_t numberSegments = segments.size();
+    file.write((const char*)&version, sizeof(version));
+    file.write((const char*)&numberSegments, sizeof(numberSegments));
+    for (const auto& segment : segments) {
+        writeVector(segment.cells);
+        writeVector(segment.h);
+    }
+    writeVector(carrierSegments);
+    writeVector(rayOffsets);
+    writeVector(leaves);
+    writeVector(remotes);
+}
+
+void ablate::radiation::Radiation::EvaluateCellProperties(DM solDm, const PetscScalar* solArray, DM auxDm, const PetscScalar* auxArray, const ablate::domain::Field& temperatureField) {
+    /** Gather the cells that have a solution and temperature into the batch */
+    PetscInt batchSize = 0;
+    for (std::size_t p = 0; p < propertyCells.size(); ++p) {
+        const PetscScalar* sol = nullptr;
+        const PetscScalar* temperature = nullptr;
+        propertyAbsorptivity[p] = 0.0;
+        propertyIntensity[p] = 0.0;
+        DMPlexPointLocalRead(solDm, propertyCells[p], solArray, &sol) >> checkError;
+        if (sol) {
+            DMPlexPointLocalFieldRead(auxDm, propertyCells[p], temperatureField.id, auxArray, &temperature) >> checkError;
+        }
+        if (sol && temperature) {
+            std::copy(sol, sol + solutionStride, propertyConserved.begin() + batchSize * solutionStride);
+            propertyTemperature[batchSize] = *temperature;
+            propertyBatchCells[batchSize++] = (PetscInt)p;
+        }
+    }
+
+    /** Compute the absorptivity for the entire batch and scatter the properties back to the cells */
+    absorptivityBatchFunction.function(
+        batchSize, propertyConserved.data(), solutionStride, propertyTemperature.data(), 1, propertyBatchAbsorptivity.data(), 1, absorptivityBatchFunction.context.get()) >>
+        checkError;
+    for (PetscInt b = 0; b < batchSize; ++b) {
+        propertyAbsorptivity[propertyBatchCells[b]] = propertyBatchAbsorptivity[b];
+        propertyIntensity[propertyBatchCells[b]] = FlameIntensity(1, propertyTemperature[b]);
+    }
 }
 
 void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec) {
@@ -510,38 +1286,13 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
     VecGetDM(auxVec, &auxDm);
     VecGetArrayRead(auxVec, &auxArray);
 
-    DM faceDM;
-    const PetscScalar* faceGeomArray;
-    VecGetDM(faceGeomVec, &faceDM) >> checkError;
-    VecGetArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
-
     /** Declare the basic information*/
     PetscReal* sol = nullptr;          //!< The solution value at any given location
     PetscReal* temperature = nullptr;  //!< The temperature at any given location
-    PetscReal dTheta = ablate::utilities::Constants::pi / (nTheta);
-    PetscReal dPhi = (2 * ablate::utilities::Constants::pi) / (nPhi);
-    double kappa = 1;  //!< Absorptivity coefficient, property of each cell
-    double theta;
+    double kappa = 1;                  //!< Absorptivity coefficient, property of each cell
 
     auto absorptivityFunctionContext = absorptivityFunction.context.get();  //!< Get access to the absorption function
 
-    /** Declare some information associated with the field declarations */
-    struct Carrier* carrier;        //!< Pointer to the ray carrier information
-    struct Identifier* identifier;  //!< Pointer to the ray identifier information
-    struct Identifier* access;      //!< Pointer to the ray identifier information
-
-    /** Get the current rank associated with this process */
-    PetscMPIInt rank;
-    MPI_Comm_rank(MPI_COMM_WORLD, &rank);  //!< Get the origin rank of the current process. The particle belongs to this rank. The rank only needs to be read once.
-
-    /** Get all of the ray information from the particle
-     * Get the ntheta and nphi from the particle that is currently being looked at. This will be used to identify its ray and calculate its direction. */
-    PetscInt npoints;
-    DMSwarmGetLocalSize(radsolve, &npoints);  //!< Recalculate the number of particles that are in the domain
-    DMSwarmGetField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-    DMSwarmGetField(radsolve, "carrier", nullptr, nullptr, (void**)&carrier) >> checkError;
-    DMSwarmGetField(radsolve, "access", nullptr, nullptr, (void**)&access) >> checkError;
-
     /** ********************************************************************************************************************************
      * Iterate over the particles that are present in the domain
      * The cells that are in the domain at this point should represent the solve cells attached to the ray segments. They will be transported after local calculation and the non-native ones will
@@ -549,47 +1300,100 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
      * First the particles should be zeroed in case they are carrying information from the last time step.
      * Then the entire solve sequence can be run through. This will require that the particles are iterated through twice.
      *
-     * We can iterate through the map here instead of the particles. That will probably be faster.
+     * We can iterate through the segments here instead of the particles. That will probably be faster.
      * Only certain particles will have identifiers associated with the ray segments, so iterating through the particles will not work.
      */
-    for (auto& [id, segment] : rays) {  //!< Iterate through the particles in the space to zero their information.
-        segment.Ij = 0;                 //!< Zero the intensity of the segment
-        segment.Krad = 1;               //!< Zero the total absorption for this domain
-        segment.I0 = 0;                 //!< Zero the initial intensity of the ray segment
-    }
     /** Now that the particle information has been zeroed, the solve can begin.
-     * The ray segment map will need to be iterated though instead of the carrier particles. This is because the carrier particles will have redundant segments or no matching segments.
-     * We don't want to resolve any segments unnecessarily, so the map can be iterated through instead.
+     * The ray segments will need to be iterated though instead of the carrier particles. This is because the carrier particles will have redundant segments or no matching segments.
+     * We don't want to resolve any segments unnecessarily, so the segments can be iterated through instead.
      * Don't touch the carrier particles.
      */
-    for (auto& [id, segment] : rays) {  //!< Iterate over the particles present in the domain. How to isolate the particles in this domain and iterate over them? If there are no
-                                        //!< particles then pass out of initialization.
-        /** Each ray is born here. They begin at the far field temperature.
-            Initial ray intensity should be set based on which boundary it is coming from.
-            Set the initial ray intensity to the wall temperature, etc.
-         */
-        /** For each domain in the ray (The rays vector will have an added index, splitting every x points) */
-        PetscInt numPoints = static_cast<PetscInt>(segment.cells.size());
+    if (UseCellProperties()) {
+        /** Compute the properties once per cell, the segment integration is then a gather and scan over the property arrays.
+         * Cells without a solution or temperature have zero absorptivity and intensity so they do not change the segment.
+         * */
+        EvaluateCellProperties(solDm, solArray, auxDm, auxArray, temperatureField);
+
+        /** The segments moved to this rank by the balancing read the properties of their cells from the rank that owns the cells */
+        if (propertySF) {
+            const auto numberLocalProperties = (PetscInt)propertyCells.size();
+            PetscSFBcastBegin(propertySF, MPIU_REAL, propertyAbsorptivity.data(), propertyAbsorptivity.data() + numberLocalProperties, MPI_REPLACE) >> checkError;
+            PetscSFBcastBegin(propertySF, MPIU_REAL, propertyIntensity.data(), propertyIntensity.data() + numberLocalProperties, MPI_REPLACE) >> checkError;
+            PetscSFBcastEnd(propertySF, MPIU_REAL, propertyAbsorptivity.data(), propertyAbsorptivity.data() + numberLocalProperties, MPI_REPLACE) >> checkError;
+            PetscSFBcastEnd(propertySF, MPIU_REAL, propertyIntensity.data(), propertyIntensity.data() + numberLocalProperties, MPI_REPLACE) >> checkError;
+        }
 
-        if (numPoints > 0) {
+        /** With an update tolerance only the cells that changed since they were last integrated are marked, the other cells keep their reference values */
+        if (updateTolerance > 0) {
+            auto changed = [this](PetscReal value, PetscReal reference) { return !(PetscAbsReal(value - reference) <= updateTolerance * PetscAbsReal(reference)); };
+            for (std::size_t p = 0; p < propertyAbsorptivity.size(); ++p) {
+                propertyChanged[p] = changed(propertyAbsorptivity[p], propertyReferenceAbsorptivity[p]) || changed(propertyIntensity[p], propertyReferenceIntensity[p]);
+                if (propertyChanged[p]) {
+                    propertyReferenceAbsorptivity[p] = propertyAbsorptivity[p];
+                    propertyReferenceIntensity[p] = propertyIntensity[p];
+                }
+            }
+        }
+
+        PetscInt numberIntegrated = 0;
+        for (auto& segment : segments) {
+            const auto numPoints = static_cast<PetscInt>(segment.propertyIndex.size());  //!< Segments moved from another rank do not store their cells
+
+            /** Reuse the previous contribution of the segment if none of its cells changed */
+            if (updateTolerance > 0 && std::none_of(segment.propertyIndex.begin(), segment.propertyIndex.end(), [this](const auto& p) { return propertyChanged[p]; })) {
+                continue;
+            }
+            numberIntegrated++;
+            segment.Ij = 0;    //!< Zero the intensity of the segment
+            segment.Krad = 1;  //!< Zero the total absorption for this domain
+            segment.I0 = 0;    //!< Zero the initial intensity of the ray segment
             for (PetscInt n = 0; n < numPoints; n++) {
-                /** Go through every cell point that is stored within the ray >> FROM THE BOUNDARY TO THE SOURCE
-                    Define the absorptivity and temperature in this section
-                    For ABLATE implementation, get temperature based on this function
-                    Get the array that lives inside the vector
-                    Gets the temperature from the cell index specified
-                */
-                DMPlexPointLocalRead(solDm, segment.cells[n], solArray, &sol);
-                if (sol) {
-                    DMPlexPointLocalFieldRead(auxDm, segment.cells[n], temperatureField.id, auxArray, &temperature);
-                    if (temperature) { /** Input absorptivity (kappa) values from model here. */
-                        absorptivityFunction.function(sol, *temperature, &kappa, absorptivityFunctionContext);
-                        segment.Ij += FlameIntensity(1 - exp(-kappa * segment.h[n]), *temperature) * segment.Krad;
-                        segment.Krad *= exp(-kappa * segment.h[n]);  //!< Compute the total absorption for this domain
-
-                        if (n ==
-                            (numPoints - 1)) { /** If this is the beginning of the ray, set this as the initial intensity. (The segment intensities will be filtered through during the origin run) */
-                            segment.I0 = FlameIntensity(1, *temperature);  //!< Set the initial intensity of the ray segment
+                const PetscInt p = segment.propertyIndex[n];
+                const PetscReal transmissivity = PetscExpReal(-propertyAbsorptivity[p] * segment.h[n]);
+                segment.Ij += (1 - transmissivity) * propertyIntensity[p] * segment.Krad;
+                segment.Krad *= transmissivity;  //!< Compute the total absorption for this domain
+            }
+            if (numPoints > 0) {
+                segment.I0 = propertyIntensity[segment.propertyIndex[numPoints - 1]];  //!< Set the initial intensity of the ray segment from the beginning of the ray
+            }
+        }
+        if (log && updateTolerance > 0) {
+            log->Printf("Integrated %" PetscInt_FMT " of %" PetscInt_FMT " local ray segments\n", numberIntegrated, (PetscInt)segments.size());
+        }
+    } else {
+        for (auto& segment : segments) {  //!< Iterate through the particles in the space to zero their information.
+            segment.Ij = 0;               //!< Zero the intensity of the segment
+            segment.Krad = 1;             //!< Zero the total absorption for this domain
+            segment.I0 = 0;               //!< Zero the initial intensity of the ray segment
+        }
+        for (auto& segment : segments) {  //!< Iterate over the ray segments present in the domain.
+            /** Each ray is born here. They begin at the far field temperature.
+                Initial ray intensity should be set based on which boundary it is coming from.
+                Set the initial ray intensity to the wall temperature, etc.
+             */
+            /** For each domain in the ray (The rays vector will have an added index, splitting every x points) */
+            PetscInt numPoints = static_cast<PetscInt>(segment.cells.size());
+
+            if (numPoints > 0) {
+                for (PetscInt n = 0; n < numPoints; n++) {
+                    /** Go through every cell point that is stored within the ray >> FROM THE BOUNDARY TO THE SOURCE
+                        Define the absorptivity and temperature in this section
+                        For ABLATE implementation, get temperature based on this function
+                        Get the array that lives inside the vector
+                        Gets the temperature from the cell index specified
+                    */
+                    DMPlexPointLocalRead(solDm, segment.cells[n], solArray, &sol);
+                    if (sol) {
+                        DMPlexPointLocalFieldRead(auxDm, segment.cells[n], temperatureField.id, auxArray, &temperature);
+                        if (temperature) { /** Input absorptivity (kappa) values from model here. */
+                            absorptivityFunction.function(sol, *temperature, &kappa, absorptivityFunctionContext);
+                            segment.Ij += FlameIntensity(1 - exp(-kappa * segment.h[n]), *temperature) * segment.Krad;
+                            segment.Krad *= exp(-kappa * segment.h[n]);  //!< Compute the total absorption for this domain
+
+                            /** If this is the beginning of the ray, set this as the initial intensity. (The segment intensities will be filtered through during the origin run) */
+                            if (n == (numPoints - 1)) {
+                                segment.I0 = FlameIntensity(1, *temperature);  //!< Set the initial intensity of the ray segment
+                            }
                         }
                     }
                 }
@@ -597,147 +1401,69 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
         }
     }
 
-    //!< In a second loop, get carrier particles and set their values equal to the values of the carriers of the access identifiers
+    //!< In a second loop, set the root carriers equal to the values of the segments of their access identifiers
     //!< This avoids solving any redundant rays, and also avoids changing the logic too much.
-    //!< Here we actually want to iterate through all particles.
-    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
-        carrier[ipart].Ij = rays[Key(&access[ipart])].Ij;
-        carrier[ipart].Krad = rays[Key(&access[ipart])].Krad;
-        carrier[ipart].I0 = rays[Key(&access[ipart])].I0;
+    for (std::size_t c = 0; c < carriers.size(); ++c) {
+        if (carrierSegments[c] < 0) {
+            carriers[c] = Carrier{};
+        } else {
+            const auto& segment = segments[carrierSegments[c]];
+            carriers[c].Ij = segment.Ij;
+            carriers[c].Krad = segment.Krad;
+            carriers[c].I0 = segment.I0;
+        }
     }
 
-    /** Restore the fields associated with the particles after all of the particles have been stepped */
-    DMSwarmRestoreField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-    DMSwarmRestoreField(radsolve, "carrier", nullptr, nullptr, (void**)&carrier) >> checkError;
-    DMSwarmRestoreField(radsolve, "access", nullptr, nullptr, (void**)&access) >> checkError;
-
     /** ********************************************************************************************************************************
-     * Now the carrier has all of the information from the rays that are needed to compute the final ray intensity. Therefore, we will perform the migration.
-     * Then, all of the carrier particles will be looped through and the local Origins associated with each cell will be updated
+     * Now the carriers have all of the information from the rays that are needed to compute the final ray intensity.
+     * The precomputed star forest moves them directly into the handler of their origins.
      * */
-    PetscInt* rankid;
-    DMSwarmGetField(radsolve, "DMSwarm_rank", nullptr, nullptr, (void**)&rankid) >> checkError;
-    DMSwarmGetField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
-        rankid[ipart] = identifier[ipart].origin;
-    }
-    DMSwarmRestoreField(radsolve, "DMSwarm_rank", nullptr, nullptr, (void**)&rankid) >> checkError;
-    DMSwarmRestoreField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-
-    DMSwarmMigrate(radsolve, PETSC_FALSE);  //!< After iterating through all of the particles, perform a migration to the origin ranks. This will move the particles.
+    PetscSFBcastBegin(carrierSF, carrierType, carriers.data(), handler.data(), MPI_REPLACE) >> checkError;
+    PetscSFBcastEnd(carrierSF, carrierType, carriers.data(), handler.data(), MPI_REPLACE) >> checkError;
 
     /** ********************************************************************************************************************************
-     * Now iterate through all of the particles in order to perform the information transfer */
-    DMSwarmGetLocalSize(radsolve, &npoints);                                                       //!< Recalculate the number of particles that are in the domain
-    DMSwarmGetField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;  //!< Field information is needed in order to read data from the incoming particles.
-    DMSwarmGetField(radsolve, "carrier", nullptr, nullptr, (void**)&carrier) >> checkError;
+     * Now sweep through all of the rays in order to compute the final ray intensities */
 
-    /** Iterate through the particles and offload the information to their associated origin cell struct. */
-    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
-        if (identifier[ipart].origin == rank) {
-            origin[identifier[ipart].iCell].handler[Key(&identifier[ipart])].Krad = carrier[ipart].Krad;
-            origin[identifier[ipart].iCell].handler[Key(&identifier[ipart])].Ij = carrier[ipart].Ij;
-            origin[identifier[ipart].iCell].handler[Key(&identifier[ipart])].I0 = carrier[ipart].I0;
-        }
-    }
-
-    /** ********************************************************************************************************************************
-     * Now iterate through all of the ray identifiers in order to compute the final ray intensities */
-
-    for (auto& [iCell, o] : origin) {  //!< Iterate through the cells that are stored in the origin
-
-        origin[iCell].intensity = 0;  //!< Make sure to zero the intensity of every cell before beginning to calculate the intensity for this time step.
+    for (std::size_t o = 0; o < origin.size(); ++o) {  //!< Iterate through the cells that are stored in the origin
+        origin[o].intensity = 0;  //!< Make sure to zero the intensity of every cell before beginning to calculate the intensity for this time step.
 
         /** for every angle theta
          * for every angle phi
          */
         for (PetscInt ntheta = 0; ntheta < nTheta; ntheta++) {
             for (PetscInt nphi = 0; nphi < nPhi; nphi++) {
-                /** Now that we are iterating over every ray identifier in this local domain, we can get all of the particles that are associated with this ray.
-                 * We will need to sort the rays in order of domain segment. We need to start at the end of the ray and go towards the beginning of the ray. */
-                Identifier loopid = {.origin = rank, .iCell = iCell, .ntheta = ntheta, .nphi = nphi, .nsegment = 1};  //!< Instantiate an identifier associated with this loop location.
-
-                /** Get the maximum nsegment by looping through all of the particles and searching for it.*/
-                bool pointfound = true;
-                PetscInt oldsegment = loopid.nsegment;
-                while (pointfound) {
-                    /** Starting at the first possible segment for this ID
-                     * //                             If it exists, increase the segment number that is being checked for.
-                     * Also, set the maximum segment that is available for this ray to the segment that is currently being checked.
-                     * */
-                    if (origin[iCell].handler.count(Key(&loopid)) > 0) {
-                        loopid.nsegment++;
-                    }
-                    pointfound = oldsegment != loopid.nsegment;  //!< If no point was found during the whole for loop, then we must have stumbled on the last segment in this ray.
-                    oldsegment = loopid.nsegment;                //!< Set the old segment
-                }
-
-                /** Now that we have found the maximum segment in the domain, we can iterate from the last segment to the beginning segment of this ray identifier */
-                /** Iterate over the particles that are present in the domain
-                 * The particles present at this point should represent the migrated particles carrying ray information in order to perform the final solve.
-                 * The I0 (beginning ray intensity) will also need to be found before the ray is added.
+                /** The carriers of this ray are stored in order of domain segment.
+                 * The I0 (beginning ray intensity) comes from the last segment in the ray.
                  * The source and absorption must be set to zero at the beginning of each new ray.
                  * */
-                origin[iCell].Kradd = 1;       //!< This must be reset at the beginning of each new ray.
-                origin[iCell].Isource = 0;     //!< This must be reset at the beginning of each new ray.
-                loopid.nsegment--;             //!< Decrement the segment identifier to the last known segment that was found.
-                oldsegment = loopid.nsegment;  //!< Set the old segment to be the head of the ray
-                origin[iCell].I0 = 0;          //!< For the last segment in the domain, take that as the black body intensity of the far field.
-
-                loopid.nsegment = 0;
-                while (loopid.nsegment <= oldsegment) {  //!< Need to go through all of the ray segments until the origin of the ray is reached
-
-                    origin[iCell].I0 = (oldsegment == loopid.nsegment) ? origin[iCell].handler[Key(&loopid)].I0 : origin[iCell].I0;  //!< Set I0 if it is the last segment in the ray
+                const PetscInt ray = RayIndex((PetscInt)o, ntheta, nphi);
+                if (rayWeights[ray] <= 0) {  //!< Skip the directions that were not selected
+                    continue;
+                }
+                origin[o].Kradd = 1;                                                                                     //!< This must be reset at the beginning of each new ray.
+                origin[o].Isource = 0;                                                                                   //!< This must be reset at the beginning of each new ray.
+                origin[o].I0 = (rayOffsets[ray + 1] > rayOffsets[ray]) ? handler[rayOffsets[ray + 1] - 1].I0 : 0;  //!< Take the last segment in the ray as the black body intensity of the far field.
 
+                for (PetscInt h = rayOffsets[ray]; h < rayOffsets[ray + 1]; ++h) {  //!< Need to go through all of the ray segments until the origin of the ray is reached
                     /** Global ray computation happens here, grabbing values from the transported particles.
                      * The rays end here, their intensity is added to the total intensity of the cell.
                      * Gives the partial impact of the ray on the total sphere.
                      * The sin(theta) is a result of the polar coordinate discretization.
                      * In the parallel form at the end of each ray, the absorption of the initial ray and the absorption of the black body source are computed individually at the end.
                      * */
-                    origin[iCell].Isource += origin[iCell].handler[Key(&loopid)].Ij * origin[iCell].Kradd;  //!< Add the black body radiation transmitted through the domain to the source term
-                    origin[iCell].Kradd *= origin[iCell].handler[Key(&loopid)].Krad;                        //!< Add the absorption for this domain to the total absorption of the ray
-                    loopid.nsegment++;                                                                      //!< Decrement the segment number to move to the next closer segment in the ray.
+                    origin[o].Isource += handler[h].Ij * origin[o].Kradd;  //!< Add the black body radiation transmitted through the domain to the source term
+                    origin[o].Kradd *= handler[h].Krad;                    //!< Add the absorption for this domain to the total absorption of the ray
                 }
 
-                if (dim != 1) {
-                    theta = (((double)ntheta + 0.5) / (double)nTheta) * ablate::utilities::Constants::pi;  //!< This is a fine method of determining theta because it is in the original domain
-                } else {
-                    theta = (((double)nphi) / (double)nPhi) * 2 * ablate::utilities::Constants::pi;
-                }
-                PetscReal ldotn = SurfaceComponent(faceDM, faceGeomArray, iCell, nphi, ntheta);  //!< If surface, get the perpendicular component here and multiply the result by it
-
-                origin[iCell].intensity += ((origin[iCell].I0 * origin[iCell].Kradd) + origin[iCell].Isource) * abs(sin(theta)) * dTheta * dPhi * ldotn;  //!< Final ray calculation
+                /** The quadrature weight includes the sin(theta) of the polar discretization and the surface component */
+                origin[o].intensity += ((origin[o].I0 * origin[o].Kradd) + origin[o].Isource) * rayWeights[ray];  //!< Final ray calculation
             }
         }
     }
 
-    /** ********************************************************************************************************************************
-     * Need to delete all of the particles that were transported to different domains so that the process can be repeated in the next step. */
-
-    /** Delete all of the particles that were transported to their origin domains -> Delete if the particle has travelled to get here and isn't native */
-    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
-        if (identifier[ipart].origin == rank && identifier[ipart].nsegment != 1) {
-            DMSwarmRestoreField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;  //!< Need to restore the field access before deleting a point
-            DMSwarmRestoreField(radsolve, "carrier", nullptr, nullptr, (void**)&carrier) >> checkError;
-
-            DMSwarmRemovePointAtIndex(radsolve, ipart);  //!< Delete the particle!
-
-            DMSwarmGetLocalSize(radsolve, &npoints);                                                       //!< Need to recalculate the number of particles that are in the domain again
-            DMSwarmGetField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;  //!< Get the field back
-            DMSwarmGetField(radsolve, "carrier", nullptr, nullptr, (void**)&carrier) >> checkError;
-            ipart--;  //!< Check the point replacing the one that was deleted
-        }
-    }
-
-    /** Restore the fields associated with the particles after all of the particles have been stepped. */
-    DMSwarmRestoreField(radsolve, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-    DMSwarmRestoreField(radsolve, "carrier", nullptr, nullptr, (void**)&carrier) >> checkError;
-
     /** Cleanup */
     VecRestoreArrayRead(solVec, &solArray);
     VecRestoreArrayRead(auxVec, &auxArray);
-    VecRestoreArrayRead(faceGeomVec, &faceGeomArray) >> checkError;
     EndEvent();
 }
 
@@ -745,4 +1471,9 @@ void ablate::radiation::Radiation::EvaluateGains(Vec solVec, ablate::domain::Fie
 REGISTER_DEFAULT(ablate::radiation::Radiation, ablate::radiation::Radiation, "A solver for radiative heat transfer in participating media", ARG(std::string, "id", "the name of the flow field"),
                  ARG(ablate::domain::Region, "region", "the region to apply this solver."), ARG(int, "rays", "number of rays used by the solver"),
                  ARG(ablate::eos::radiationProperties::RadiationModel, "properties", "the radiation properties model"),
-                 OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
+                 OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"),
+                 OPT(bool, "batchProperties", "compute the absorptivity and black body intensity once per cell in a batch before integrating the ray segments (default is false)"),
+                 OPT(bool, "cacheRays", "store the ray geometry in the output directory keyed by the mesh and ray count so restarts can skip the ray search (default is false)"),
+                 OPT(int, "rayBudget", "the maximum number of rays searched from each origin, the directions with the least contribution are merged (default is every direction)"),
+                 OPT(double, "updateTolerance", "only integrate the ray segments crossing cells whose properties changed by more than this relative tolerance (default is 0, always integrate)"),
+                 OPT(double, "segmentBalanceTolerance", "redistribute the ray segments when the most loaded rank exceeds the average cost by this fraction (default is 0, never redistribute)"));
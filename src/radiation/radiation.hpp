@@ -1,8 +1,13 @@
 #ifndef ABLATELIBRARY_RADIATION_HPP
 #define ABLATELIBRARY_RADIATION_HPP
 
+#include <filesystem>
+#include <map>
 #include <memory>
+#include <petscsf.h>
 #include <set>
+#include <string>
+#include <vector>
 #include "eos/radiationProperties/radiationProperties.hpp"
 #include "finiteVolume/finiteVolumeSolver.hpp"
 #include "io/interval/interval.hpp"
@@ -22,9 +27,15 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
      * @param region the boundary cell region
      * @param rayNumber
      * @param options other options
+     * @param batchProperties compute the absorptivity and black body intensity once per cell in a batch before integrating the ray segments
+     * @param cacheRays store the ray geometry in the output directory so that restarts with the same mesh and ray count can skip the search
+     * @param rayBudget the maximum number of rays searched from each origin, zero searches every direction
+     * @param updateTolerance only integrate the segments crossing cells whose properties changed by more than this relative tolerance since they were last integrated, zero always integrates
+     * @param segmentBalanceTolerance redistribute the ray segments after the search when the most loaded rank exceeds the average cost by more than this fraction, zero never redistributes
      */
     Radiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, const PetscInt raynumber, std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn,
-              std::shared_ptr<ablate::monitors::logs::Log> = {});
+              std::shared_ptr<ablate::monitors::logs::Log> = {}, bool batchProperties = false, bool cacheRays = false, PetscInt rayBudget = 0,
+              PetscReal updateTolerance = 0, PetscReal segmentBalanceTolerance = 0);
 
     virtual ~Radiation();
 
@@ -37,44 +48,45 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     };
 
     /** Each origin cell will need to retain local information given to it by the ray segments in order to compute the final intenisty.
-     * This information will be owned by cell index and stored in a map of local cell indices.
+     * This information is stored by local origin index (the position of the cell in the range used to initialize the rays).
+     * The carriers for each ray are stored in the flat handler array.
      * */
     struct Origin {
-        PetscReal I0 = 0;                        //!< Determing the initial ray intensity by grabbing the head cell of the furthest ray? There will need to be additional setup for this.
-        PetscReal Isource = 0;                   //!< Value that will be contributed to by every ray segment.
-        PetscReal Kradd = 1;                     //!< Value that will be contributed to by every ray segment.
-        PetscReal intensity = 0;                 //!< The irradiation value that will be contributed to by every ray. This is updated every (pre-step && interval) gain evaluation.
-        PetscReal net = 0;                       //!< The net radiation value including the losses. This is updated every pre-stage solve.
-        std::map<std::string, Carrier> handler;  //!< Stores local carrier information
+        PetscReal I0 = 0;         //!< Determing the initial ray intensity by grabbing the head cell of the furthest ray? There will need to be additional setup for this.
+        PetscReal Isource = 0;    //!< Value that will be contributed to by every ray segment.
+        PetscReal Kradd = 1;      //!< Value that will be contributed to by every ray segment.
+        PetscReal intensity = 0;  //!< The irradiation value that will be contributed to by every ray. This is updated every (pre-step && interval) gain evaluation.
+        PetscReal net = 0;        //!< The net radiation value including the losses. This is updated every pre-stage solve.
     };
 
-    std::map<PetscInt, Origin> origin;
+    std::vector<Origin> origin;            //!< The origins stored by local origin index
     std::map<std::string, bool> presence;  //!< Map to track the local presence of search particles during the initialization
 
     /** Returns the black body intensity for a given temperature and emissivity */
     static PetscReal FlameIntensity(PetscReal epsilon, PetscReal temperature);
 
     /** SubDomain Register and Setup **/
-    void Setup(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain);
+    virtual void Setup(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain);
 
     /**
      * @param cellRange The range of cells for which rays are initialized
      */
     virtual void Initialize(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain);
 
-    inline PetscReal GetIntensity(PetscInt iCell) {  //!< Function to give other classes access to the intensity
-        return origin[iCell].net;
+    inline PetscReal GetIntensity(PetscInt iCell) const {  //!< Function to give other classes access to the intensity
+        const PetscInt o = OriginIndex(iCell);
+        return o < 0 ? 0.0 : origin[o].net;
     }
 
     /// Class Methods
     /** The solve function evaluates the net radiation source term. However, the net radiation value must be updated by each solver individually.
      * The solve updates every value except for the radiative gains from the domain. This avoids doing the must computationally expensive part of the solve at every stage.
      * */
-    void Solve(Vec solVec, ablate::domain::Field temperatureField, Vec aux);
+    virtual void Solve(Vec solVec, ablate::domain::Field temperatureField, Vec aux);
 
     /** Evaluates the ray intensity from the domain to update the effects of irradiation. Does not impact the solution unless the solve function is called again.
      * */
-    void EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec);
+    virtual void EvaluateGains(Vec solVec, ablate::domain::Field temperatureField, Vec auxVec);
 
     /** Determines the next location of the search particles during the initialization
      * */
@@ -87,6 +99,12 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
     virtual PetscInt GetLossCell(PetscInt iCell, PetscReal& losses, DM solDm, DM pPDm);  //!< Get the index of the cell which the losses should be calculated from
     virtual void GetFuelEmissivity(double& kappa);
 
+    /** Add the ray segments, origins, carriers, and cell properties to the memory usage
+     * @param memoryUsage
+     * @param prefix prepended to each entry name
+     * */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage, const std::string& prefix) const;
+
    protected:
     DM radsolve{};   //!< DM associated with the radiation particles
     DM radsearch{};  //!< DM which the search particles occupy
@@ -103,6 +121,7 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
         PetscReal Ij = 0;             //!< Black body source for the segment. Make sure that this is reset every solve after the value has been transported.
         PetscReal Krad = 1;           //!< Absorption for the segment. Make sure that this is reset every solve after the value has been transported.
         PetscReal I0 = 0;
+        std::vector<PetscInt> propertyIndex;  //!< The index of each cell into the cell property arrays, only used with batch properties
     };
 
     /** Identifiers are carrying by both the search and solve particles in order to associate them with their origins and ray segments
@@ -146,6 +165,77 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
      * */
     void UpdateCoordinates(PetscInt ipart, Virtualcoord* virtualcoord, PetscReal* coord, PetscReal adv) const;
 
+    /** Build the dense ray storage and communication plan after the search has completed.
+     * The local ray segments are moved into the segments array and each solve particle becomes a root carrier drawing from the segment of its access identifier.
+     * The solve particles are sent to their origins once to count the segments in each ray and build the star forest from the root carriers to the origin handler.
+     * The solve particles are destroyed afterwards because the ray topology does not change.
+     * @param cellRange the range of origin cells
+     * @param comm the comm for the subdomain
+     * */
+    void IndexRays(const solver::Range& cellRange, MPI_Comm comm);
+
+    /** Build the origin arrays and point to origin map from the range of origin cells */
+    void IndexOrigins(const solver::Range& cellRange);
+
+    /** Returns the quadrature weight of the direction (ntheta, nphi) at an origin including the sin(theta) of the polar discretization and the surface component */
+    PetscReal RayWeight(DM faceDM, const PetscScalar* faceGeomArray, PetscInt iCell, PetscInt ntheta, PetscInt nphi);
+
+    /** Select the rays searched from each origin and store their quadrature weights in rayWeights.
+     * With a ray budget the directions are tiled into blocks and the blocks carrying the most weight are refined until the budget is reached.
+     * Each block is searched with a single ray carrying the weight of the whole block. Directions without any contribution (such as behind a surface) are never searched.
+     * */
+    void SelectRays(DM faceDM, const PetscScalar* faceGeomArray);
+
+    /** Build the unique cells crossed by the local segments when using batch properties or change driven updates */
+    void IndexCellProperties();
+
+    /** Create the star forest from the root carriers to the leaf handler entries and destroy the solve particles
+     * @param comm the comm for the subdomain
+     * @param leaves the handler index of each leaf
+     * @param remotes the root (rank, index) of each leaf
+     * */
+    void CreateCarrierCommunication(MPI_Comm comm, const std::vector<PetscInt>& leaves, const std::vector<PetscSFNode>& remotes);
+
+    /** Move ray segments from the ranks integrating the most cells to the ranks integrating the fewest after the search.
+     * Every rank computes the same transfer plan from the gathered costs, only the moved segments are communicated.
+     * The moved segments keep reading the cell properties from their original rank through the propertySF and the carrier star forest is rebuilt with the new roots.
+     * Must be called by every rank.
+     * @param comm the comm for the subdomain
+     * */
+    void BalanceSegments(MPI_Comm comm);
+
+    /** Compute the shortest forward path of a search particle through its cell and store it in the hhere of the virtual coordinate.
+     * This only reads the mesh so it can be called concurrently for different particles.
+     * */
+    void ComputeCellPath(DM dm, DM faceDM, const PetscScalar* faceGeomArray, PetscInt ipart, PetscInt cell, Virtualcoord* virtualcoord) const;
+
+    /** Remove a batch of particles from a swarm. The fields of the swarm must be restored before calling.
+     * @param swarm the swarm to remove the particles from
+     * @param indices the indices of the particles to remove, this is cleared after the particles are removed
+     * */
+    static void RemoveParticles(DM swarm, std::vector<PetscInt>& indices);
+
+    /** The version of the ray cache file, this must be incremented if the format changes */
+    static constexpr PetscInt RAY_CACHE_VERSION = 1;
+
+    /** Returns the path to the ray cache for this rank, keyed by the ray count, partition, origins, and local mesh coordinates */
+    [[nodiscard]] std::filesystem::path GetRayCachePath(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) const;
+
+    /** Try to load the ray geometry and communication graph from the cache. Must be called by every rank, returns true only if every rank loaded the cache. */
+    bool ReadRayCache(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain);
+
+    /** Write the ray geometry and communication graph for this rank to the cache */
+    void WriteRayCache(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) const;
+
+    /** Returns the local origin index for a cell or face, or -1 if the point is not a local origin */
+    [[nodiscard]] inline PetscInt OriginIndex(PetscInt iCell) const {
+        const PetscInt offset = iCell - originPointStart;
+        return (offset < 0 || offset >= (PetscInt)originIndex.size()) ? -1 : originIndex[offset];
+    }
+
+    /** Returns the index of the ray (origin, ntheta, nphi) into the rayOffsets */
+    [[nodiscard]] inline PetscInt RayIndex(PetscInt o, PetscInt ntheta, PetscInt nphi) const { return (o * nTheta + ntheta) * nPhi + nphi; }
+
     /** Create a unique identifier from an array of integers.
      * This is done using the nested Cantor pairing function
      * The ray segment will always be accessed by a particle carrying an identifier so it does not need to be inverted.
@@ -159,6 +249,47 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
 
     eos::ThermodynamicTemperatureFunction absorptivityFunction;
 
+    /** Batch property evaluation
+     * When enabled the absorptivity and black body intensity are computed once for every cell crossed by a local segment so the segment integration is a gather over the arrays.
+     * */
+    const bool batchProperties;
+
+    //! store the ray geometry so that restarts can skip the ray search
+    const bool cacheRays;
+
+    //! the maximum number of rays searched from each origin, zero searches every direction
+    const PetscInt rayBudget;
+
+    /** Change driven updates
+     * When positive the absorptivity and black body intensity of each cell are compared against the values used when the cell was last integrated.
+     * Only the segments crossing a cell that changed by more than the relative tolerance are integrated, the other segments reuse their previous contribution.
+     * */
+    const PetscReal updateTolerance;
+
+    //! redistribute the ray segments when the most loaded rank exceeds the average cost by more than this fraction
+    const PetscReal segmentBalanceTolerance;
+
+    //! the cell properties are needed for batched evaluation, change driven updates, and balanced segments
+    [[nodiscard]] inline bool UseCellProperties() const { return batchProperties || updateTolerance > 0 || segmentBalanceTolerance > 0; }
+
+    eos::ThermodynamicTemperatureBatchFunction absorptivityBatchFunction;
+    PetscInt solutionStride = 0;                           //!< The number of solution components per cell
+    std::vector<PetscInt> propertyCells;                   //!< The unique local cells crossed by the segments, the properties of remote cells are stored after these
+    std::vector<PetscInt> propertyBatchCells;              //!< The position in propertyCells of each cell in the batch (cells with a solution and temperature)
+    std::vector<PetscReal> propertyConserved;              //!< The conserved values of each cell in the batch
+    std::vector<PetscReal> propertyTemperature;            //!< The temperature of each cell in the batch
+    std::vector<PetscReal> propertyBatchAbsorptivity;      //!< The absorptivity of each cell in the batch
+    std::vector<PetscReal> propertyAbsorptivity;           //!< The absorptivity of each cell in propertyCells, zero if the cell was not in the batch
+    std::vector<PetscReal> propertyIntensity;              //!< The black body intensity of each cell in propertyCells, zero if the cell was not in the batch
+    std::vector<PetscReal> propertyReferenceAbsorptivity;  //!< The absorptivity of each cell when it was last integrated
+    std::vector<PetscReal> propertyReferenceIntensity;     //!< The black body intensity of each cell when it was last integrated
+    std::vector<char> propertyChanged;                     //!< If each cell changed beyond the update tolerance in this evaluation
+    PetscSF propertySF = nullptr;                          //!< The star forest from the local cell properties to the remote cells of the segments moved to other ranks
+
+    /** Compute the absorptivity and black body intensity for each cell in propertyCells
+     * */
+    void EvaluateCellProperties(DM solDm, const PetscScalar* solArray, DM auxDm, const PetscScalar* auxArray, const ablate::domain::Field& temperatureField);
+
     PetscMPIInt numRanks = 0;  //!< The number of the ranks that the simulation contains. This will be used to support global indexing.
 
     /// Class inputs and Variables
@@ -171,7 +302,23 @@ class Radiation : protected utilities::Loggable<Radiation> {  //!< Cell solver p
      * Store a log used to output the required information
      */
 
-    std::map<std::string, Segment> rays;
+    std::map<std::string, Segment> rays;  //!< The ray segments built during the search, these are moved into the segments array at the end of the initialization
+
+    /** Dense ray storage computed at the end of the initialization
+     * The carriers for ray r (origin, ntheta, nphi) are stored in handler[rayOffsets[r]] to handler[rayOffsets[r + 1]] ordered by nsegment starting at one.
+     * */
+    std::vector<Segment> segments;                 //!< The local ray segments
+    std::vector<PetscInt> originCells;             //!< The cell (or face) of each origin
+    std::vector<PetscInt> originIndex;             //!< Map from the point (offset by the originPointStart) to the local origin index, -1 if the point is not an origin
+    PetscInt originPointStart = 0;                 //!< The smallest origin point
+    std::vector<PetscInt> rayOffsets;              //!< The offset of each ray into the handler, the size is origin.size() * nTheta * nPhi + 1
+    std::vector<PetscReal> rayWeights;             //!< The quadrature weight of each ray (origin, ntheta, nphi), zero if the ray is not searched
+    std::vector<Carrier> handler;                  //!< Stores local carrier information for each ray segment
+    std::vector<Carrier> carriers;                 //!< The root carriers sent from the local ray segments to their origins each evaluation
+    std::vector<PetscInt> carrierSegments;         //!< The local segment index of each root carrier, -1 if the carrier does not have a segment
+    PetscSF carrierSF = nullptr;                   //!< The star forest from the root carriers to the leaf handler entries
+    MPI_Datatype carrierType = MPI_DATATYPE_NULL;  //!< The mpi type for a carrier
+
     std::basic_string<char>&& solverId;
     const std::shared_ptr<domain::Region> region;
     const std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModel;
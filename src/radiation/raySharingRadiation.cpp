@@ -1,8 +1,11 @@
 #include "raySharingRadiation.hpp"
+#include <vector>
+#include "utilities/kokkosUtilities.hpp"
 
 ablate::radiation::RaySharingRadiation::RaySharingRadiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, const PetscInt raynumber,
-                                                            std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log)
-    : Radiation(solverId, region, raynumber, radiationModelIn, log) {
+                                                            std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log,
+                                                            bool batchProperties, bool cacheRays, PetscInt rayBudget, PetscReal updateTolerance, PetscReal segmentBalanceTolerance)
+    : Radiation(solverId, region, raynumber, radiationModelIn, log, batchProperties, cacheRays, rayBudget, updateTolerance, segmentBalanceTolerance) {
     nTheta = raynumber;    //!< The number of angles to solve with, given by user input
     nPhi = 2 * raynumber;  //!< The number of angles to solve with, given by user input
 }
@@ -21,8 +24,6 @@ void ablate::radiation::RaySharingRadiation::ParticleStep(ablate::domain::SubDom
     DMSwarmGetLocalSize(radsearch, &npoints) >> checkError;
     DMSwarmGetSize(radsearch, &nglobalpoints) >> checkError;
 
-    PetscFVFaceGeom* faceGeom;
-
     PetscInt* index;
     PetscMPIInt rank = 0;
     MPI_Comm_rank(subDomain.GetComm(), &rank);
@@ -40,8 +41,10 @@ void ablate::radiation::RaySharingRadiation::ParticleStep(ablate::domain::SubDom
     DMSwarmGetField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
     DMSwarmGetField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
 
+    std::vector<char> valid(npoints, 0);  //!< Store if each particle is in a valid region so that the path lengths can be computed concurrently
     for (PetscInt ipart = 0; ipart < npoints; ipart++) {
         if (index[ipart] >= 0 && subDomain.InRegion(index[ipart])) {
+            valid[ipart] = 1;
             /** If this local rank has never seen this search particle before, then it needs to add a new ray segment to local memory
              * Hash the identifier into a key value that can be used in the ma
              * We should only iterate the identifier of the search particle (/ add a solver particle) if the point is valid in the domain and is being used
@@ -104,45 +107,24 @@ void ablate::radiation::RaySharingRadiation::ParticleStep(ablate::domain::SubDom
             /** Step 1: Register the current cell index in the rays vector. The physical coordinates that have been set in the previous step / loop will be immediately registered.
              * */
             if (identifier[ipart].nsegment == 1) rays[Key(&identifier[ipart])].cells.push_back(index[ipart]);
+        }
+    }
 
-            /** Step 2: Acquire the intersection of the particle search line with the segment or face. In the case if a two dimensional mesh, the virtual coordinate in the z direction will
-             * need to be solved for because the three dimensional line will not have a literal intersection with the segment of the cell. The third coordinate can be solved for in this case.
-             * Here we are figuring out what distance the ray spends inside the cell that it has just registered.
-             * */
-            /** March over each face on this cell in order to check them for the one which intersects this ray next */
-            PetscInt numberFaces;
-            const PetscInt* cellFaces;
-            DMPlexGetConeSize(subDomain.GetDM(), index[ipart], &numberFaces) >> checkError;
-            DMPlexGetCone(subDomain.GetDM(), index[ipart], &cellFaces) >> checkError;  //!< Get the face geometry associated with the current cell
-            PetscReal path;
-
-            /** Check every face for intersection with the segment.
-             * The segment with the shortest path length for intersection will be the one that physically intercepts with the cell face and not with the nonphysical plane beyond the face.
-             * */
-            for (PetscInt f = 0; f < numberFaces; f++) {
-                PetscInt face = cellFaces[f];
-                DMPlexPointLocalRead(faceDM, face, faceGeomArray, &faceGeom) >> checkError;  //!< Reads the cell location from the current cell
-
-                /** Get the intersection of the direction vector with the cell face
-                 * Use the plane equation and ray segment equation in order to get the face intersection with the shortest path length
-                 * This will be the next position of the search particle
-                 * */
-                path = FaceIntersect(ipart, virtualcoord, faceGeom);  //!< Use plane intersection equation by getting the centroid and normal vector of the face
-
-                /** Step 3: Take this path if it is shorter than the previous one, getting the shortest path.
-                 * The path should never be zero if the forwardIntersect check is functioning properly.
-                 * */
-                if (path > 0) {
-                    virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? (path * 1.1) : virtualcoord[ipart].hhere;  //!< Dumb check to ensure that the path length is always updated
-                    if (virtualcoord[ipart].hhere > path) {
-                        virtualcoord[ipart].hhere = path;  //!> Get the shortest path length of all of the faces. The point must be in the direction that the ray is travelling in order to be valid.
-                    }
-                }
+    /** Step 2: Acquire the intersection of the particle search line with the segment or face. This only depends upon the particle and its cell so the particles are marched concurrently. */
+    ablate::utilities::KokkosUtilities::ParallelForChunks(npoints, [&](std::size_t start, std::size_t end, std::size_t chunk) {
+        for (auto ipart = (PetscInt)start; ipart < (PetscInt)end; ipart++) {
+            if (valid[ipart]) {
+                ComputeCellPath(subDomain.GetDM(), faceDM, faceGeomArray, ipart, index[ipart], virtualcoord);
+            } else {
+                virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? minCellRadius : virtualcoord[ipart].hhere;
             }
-            virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? minCellRadius : virtualcoord[ipart].hhere;
-            if (identifier[ipart].nsegment == 1) rays[Key(&identifier[ipart])].h.push_back(virtualcoord[ipart].hhere);  //!< Add this space step if the current index is being added.
-        } else {
-            virtualcoord[ipart].hhere = (virtualcoord[ipart].hhere == 0) ? minCellRadius : virtualcoord[ipart].hhere;
+        }
+    });
+
+    /** Add the space steps of the particles that were registered in this step */
+    for (PetscInt ipart = 0; ipart < npoints; ipart++) {
+        if (valid[ipart] && identifier[ipart].nsegment == 1) {
+            rays[Key(&identifier[ipart])].h.push_back(virtualcoord[ipart].hhere);  //!< Add this space step if the current index is being added.
         }
     }
     DMSwarmRestoreField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
@@ -153,4 +135,9 @@ void ablate::radiation::RaySharingRadiation::ParticleStep(ablate::domain::SubDom
 #include "registrar.hpp"
 REGISTER(ablate::radiation::Radiation, ablate::radiation::RaySharingRadiation, "A solver for radiative heat transfer in participating media", ARG(std::string, "id", "the name of the flow field"),
          ARG(ablate::domain::Region, "region", "the region to apply this solver."), ARG(int, "rays", "number of rays used by the solver"),
-         ARG(ablate::eos::radiationProperties::RadiationModel, "properties", "the radiation properties model"), OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
\ No newline at end of file
+         ARG(ablate::eos::radiationProperties::RadiationModel, "properties", "the radiation properties model"), OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"),
+         OPT(bool, "batchProperties", "compute the absorptivity and black body intensity once per cell in a batch before integrating the ray segments (default is false)"),
+         OPT(bool, "cacheRays", "store the ray geometry in the output directory keyed by the mesh and ray count so restarts can skip the ray search (default is false)"),
+         OPT(int, "rayBudget", "the maximum number of rays searched from each origin, the directions with the least contribution are merged (default is every direction)"),
+         OPT(double, "updateTolerance", "only integrate the ray segments crossing cells whose properties changed by more than this relative tolerance (default is 0, always integrate)"),
+         OPT(double, "segmentBalanceTolerance", "redistribute the ray segments when the most loaded rank exceeds the average cost by this fraction (default is 0, never redistribute)"));
\ No newline at end of file
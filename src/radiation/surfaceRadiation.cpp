@@ -1,8 +1,10 @@
 #include "surfaceRadiation.hpp"
+#include <vector>
 
 ablate::radiation::SurfaceRadiation::SurfaceRadiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, const PetscInt raynumber,
-                                                      std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log)
-    : Radiation(solverId, region, raynumber, radiationModelIn, log) {
+                                                      std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn, std::shared_ptr<ablate::monitors::logs::Log> log,
+                                                      bool batchProperties, bool cacheRays, PetscInt rayBudget, PetscReal updateTolerance, PetscReal segmentBalanceTolerance)
+    : Radiation(solverId, region, raynumber, radiationModelIn, log, batchProperties, cacheRays, rayBudget, updateTolerance, segmentBalanceTolerance) {
     nTheta = raynumber;    //!< The number of angles to solve with, given by user input
     nPhi = 2 * raynumber;  //!< The number of angles to solve with, given by user input
 }
@@ -32,22 +34,11 @@ void ablate::radiation::SurfaceRadiation::Initialize(const solver::Range& cellRa
     MPI_Comm_rank(subDomain.GetComm(), &rank);
 
     /**  */
+    std::vector<PetscInt> removedParticles;
     for (PetscInt ipart = 0; ipart < npoints; ipart++) {
         //!< If the particles that were just created are sitting in the boundary cell of the face that they belong to, delete them
         if (!(region->InRegion(region, subDomain.GetDM(), index[ipart]))) {  //!< If the particle location index and boundary cell index are the same, then they should be deleted
-            DMSwarmRestoreField(radsearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> checkError;
-            DMSwarmRestoreField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
-            DMSwarmRestoreField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-            DMSwarmRestoreField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
-
-            DMSwarmRemovePointAtIndex(radsearch, ipart);  //!< Delete the particle!
-            DMSwarmGetLocalSize(radsearch, &npoints);
-
-            DMSwarmGetField(radsearch, DMSwarmPICField_coor, nullptr, nullptr, (void**)&coord) >> checkError;
-            DMSwarmGetField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
-            DMSwarmGetField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
-            DMSwarmGetField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
-            ipart--;  //!< Check the point replacing the one that was deleted
+            removedParticles.push_back(ipart);
         }
     }
 
@@ -56,6 +47,7 @@ void ablate::radiation::SurfaceRadiation::Initialize(const solver::Range& cellRa
     DMSwarmRestoreField(radsearch, DMSwarmPICField_cellid, nullptr, nullptr, (void**)&index) >> checkError;
     DMSwarmRestoreField(radsearch, "identifier", nullptr, nullptr, (void**)&identifier) >> checkError;
     DMSwarmRestoreField(radsearch, "virtual coord", nullptr, nullptr, (void**)&virtualcoord) >> checkError;
+    RemoveParticles(radsearch, removedParticles);
 
     EndEvent();
     ablate::radiation::Radiation::Initialize(cellRange, subDomain);
@@ -74,7 +66,17 @@ PetscReal ablate::radiation::SurfaceRadiation::SurfaceComponent(DM faceDM, const
     PetscReal phi = ((double)nphi / (double)nPhi) * 2.0 * ablate::utilities::Constants::pi;
     PetscReal thetalocal = (((double)ntheta + 0.5) / (double)nTheta) * ablate::utilities::Constants::pi;
     PetscReal ldotn = abs(((sin(thetalocal) * cos(phi)) * faceNormx) + ((sin(thetalocal) * sin(phi)) * faceNormy) + (cos(thetalocal) * faceNormz));
-    return ldotn;
+
+    /** The rays pointing into the boundary cell are removed before the search so they do not contribute */
+    PetscReal losses;
+    PetscReal boundaryCentroid[3] = {0.0, 0.0, 0.0};
+    DMPlexComputeCellGeometryFVM(faceDM, GetLossCell(iCell, losses, faceDM, faceDM), nullptr, boundaryCentroid, nullptr) >> checkError;
+    PetscReal towardsBoundary = 0.0;
+    const PetscReal direction[3] = {sin(thetalocal) * cos(phi), sin(thetalocal) * sin(phi), cos(thetalocal)};
+    for (PetscInt d = 0; d < dim; d++) {
+        towardsBoundary += direction[d] * (boundaryCentroid[d] - faceGeom->centroid[d]);
+    }
+    return (towardsBoundary > 0) ? 0.0 : ldotn;
 }
 
 PetscInt ablate::radiation::SurfaceRadiation::GetLossCell(PetscInt iCell, PetscReal& losses, DM faceDm, DM cellDm) {
@@ -100,4 +102,9 @@ void ablate::radiation::SurfaceRadiation::GetFuelEmissivity(double& kappa) { kap
 #include "registrar.hpp"
 REGISTER(ablate::radiation::Radiation, ablate::radiation::SurfaceRadiation, "A solver for radiative heat transfer in participating media", ARG(std::string, "id", "the name of the flow field"),
          ARG(ablate::domain::Region, "region", "the region to apply this solver."), ARG(int, "rays", "number of rays used by the solver"),
-         ARG(ablate::eos::radiationProperties::RadiationModel, "properties", "the radiation properties model"), OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"));
\ No newline at end of file
+         ARG(ablate::eos::radiationProperties::RadiationModel, "properties", "the radiation properties model"), OPT(ablate::monitors::logs::Log, "log", "where to record log (default is stdout)"),
+         OPT(bool, "batchProperties", "compute the absorptivity and black body intensity once per cell in a batch before integrating the ray segments (default is false)"),
+         OPT(bool, "cacheRays", "store the ray geometry in the output directory keyed by the mesh and ray count so restarts can skip the ray search (default is false)"),
+         OPT(int, "rayBudget", "the maximum number of rays searched from each origin, the directions with the least contribution are merged (default is every direction)"),
+         OPT(double, "updateTolerance", "only integrate the ray segments crossing cells whose properties changed by more than this relative tolerance (default is 0, always integrate)"),
+         OPT(double, "segmentBalanceTolerance", "redistribute the ray segments when the most loaded rank exceeds the average cost by this fraction (default is 0, never redistribute)"));
\ No newline at end of file
@@ -9,7 +9,8 @@ namespace ablate::radiation {
 class SurfaceRadiation : public ablate::radiation::Radiation {
    public:
     SurfaceRadiation(const std::string& solverId, const std::shared_ptr<domain::Region>& region, const PetscInt raynumber, std::shared_ptr<eos::radiationProperties::RadiationModel> radiationModelIn,
-                     std::shared_ptr<ablate::monitors::logs::Log> = {});
+                     std::shared_ptr<ablate::monitors::logs::Log> = {}, bool batchProperties = false, bool cacheRays = false, PetscInt rayBudget = 0,
+                     PetscReal updateTolerance = 0, PetscReal segmentBalanceTolerance = 0);
     ~SurfaceRadiation();
 
     void Initialize(const solver::Range& cellRange, ablate::domain::SubDomain& subDomain) override;
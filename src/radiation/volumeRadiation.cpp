@@ -31,6 +31,11 @@ void ablate::radiation::VolumeRadiation::Setup() {
 
 void ablate::radiation::VolumeRadiation::Register(std::shared_ptr<ablate::domain::SubDomain> subDomain) { ablate::solver::Solver::Register(subDomain); }
 
+void ablate::radiation::VolumeRadiation::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) {
+    CellSolver::AccumulateMemoryUsage(memoryUsage);
+    radiation->AccumulateMemoryUsage(memoryUsage, GetSolverId() + "::");
+}
+
 void ablate::radiation::VolumeRadiation::Initialize() {
     radiation->Initialize(radiationCellRange.GetRange(), GetSubDomain());  //!< Get the range of cells that the solver occupies in order for the radiation solver to give energy to the finite volume
 }
@@ -20,10 +20,21 @@ class VolumeRadiation : public solver::CellSolver, public solver::RHSFunction {
      */
     PetscErrorCode ComputeRHSFunction(PetscReal time, Vec locXVec, Vec locFVec) override;
 
+    /**
+     * The rays are traced in the PreRHSFunction so the rhs only adds the local intensity
+     * @return
+     */
+    [[nodiscard]] bool ConcurrentRHSFunction() const override { return true; }
+
     void Initialize() override;
     void Setup() override;
     void Register(std::shared_ptr<ablate::domain::SubDomain> subDomain) override;
 
+    /**
+     * Add the radiation rays to the memory usage
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) override;
+
     /**
      *
      * @param solverId the id for this solver
@@ -118,4 +118,60 @@ void ablate::solver::CellSolver::UpdateAuxFields(PetscReal time, Vec locXVec, Ve
 void ablate::solver::CellSolver::Setup() {
     // Compute the dm geometry
     DMPlexComputeGeometryFVM(subDomain->GetDM(), &cellGeomVec, &faceGeomVec) >> checkError;
-}
\ No newline at end of file
+}
+
+void ablate::solver::CellSolver::AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) {
+    Solver::AccumulateMemoryUsage(memoryUsage);
+    memoryUsage.Add(GetSolverId() + "::geometry", utilities::MemoryUsage::VecBytes(cellGeomVec) + utilities::MemoryUsage::VecBytes(faceGeomVec));
+}
+
+PetscErrorCode ablate::solver::CellSolver::AddTimeDerivative(Vec locX_t, Vec locF) const {
+    PetscFunctionBeginUser;
+    // only the owned cells are added because the local vector is added to the global residual
+    PetscSection section, globalSection;
+    PetscCall(DMGetLocalSection(subDomain->GetDM(), &section));
+    PetscCall(DMGetGlobalSection(subDomain->GetDM(), &globalSection));
+    const PetscScalar* xTArray;
+    PetscScalar* fArray;
+    PetscCall(VecGetArrayRead(locX_t, &xTArray));
+    PetscCall(VecGetArray(locF, &fArray));
+
+    Range cellRange;
+    GetCellRange(cellRange);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+        PetscInt globalDof, dof, offset;
+        PetscCall(PetscSectionGetDof(globalSection, cell, &globalDof));
+        if (globalDof <= 0) {
+            continue;
+        }
+        PetscCall(PetscSectionGetDof(section, cell, &dof));
+        PetscCall(PetscSectionGetOffset(section, cell, &offset));
+        for (PetscInt d = 0; d < dof; ++d) {
+            fArray[offset + d] += xTArray[offset + d];
+        }
+    }
+    RestoreRange(cellRange);
+    PetscCall(VecRestoreArray(locF, &fArray));
+    PetscCall(VecRestoreArrayRead(locX_t, &xTArray));
+    PetscFunctionReturn(0);
+}
+
+PetscErrorCode ablate::solver::CellSolver::AddTimeDerivativeShift(PetscReal X_tShift, Mat JacP) const {
+    PetscFunctionBeginUser;
+    PetscSection globalSection;
+    PetscCall(DMGetGlobalSection(subDomain->GetDM(), &globalSection));
+    Range cellRange;
+    GetCellRange(cellRange);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+        PetscInt globalDof, globalOffset;
+        PetscCall(PetscSectionGetDof(globalSection, cell, &globalDof));
+        PetscCall(PetscSectionGetOffset(globalSection, cell, &globalOffset));
+        for (PetscInt d = 0; d < globalDof; ++d) {
+            PetscCall(MatSetValue(JacP, globalOffset + d, globalOffset + d, X_tShift, ADD_VALUES));
+        }
+    }
+    RestoreRange(cellRange);
+    PetscFunctionReturn(0);
+}
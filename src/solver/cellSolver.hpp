@@ -33,6 +33,22 @@ class CellSolver : public solver::Solver {
     //! Vector used to describe the entire face geom of the dm.  This is constant and does not depend upon region.
     Vec faceGeomVec = nullptr;
 
+    /**
+     * Add the time derivative X_t of every cell owned by this rank in the solver region to the local implicit residual.  Each implicit solver adds the X_t for its own cells.
+     * @param locX_t
+     * @param locF
+     * @return
+     */
+    PetscErrorCode AddTimeDerivative(Vec locX_t, Vec locF) const;
+
+    /**
+     * Add the X_tShift to the diagonal of the implicit jacobian for every cell owned by this rank in the solver region
+     * @param X_tShift
+     * @param JacP
+     * @return
+     */
+    PetscErrorCode AddTimeDerivativeShift(PetscReal X_tShift, Mat JacP) const;
+
    public:
     explicit CellSolver(std::string solverId, std::shared_ptr<domain::Region> = {}, std::shared_ptr<parameters::Parameters> options = nullptr);
     ~CellSolver() override;
@@ -59,6 +75,11 @@ class CellSolver : public solver::Solver {
      * Setup the subdomain cell solver vectors
      */
     void Setup() override;
+
+    /**
+     * Add the cell and face geometry to the memory usage
+     */
+    void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage) override;
 };
 }  // namespace ablate::solver
 
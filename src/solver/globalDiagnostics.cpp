@@ -0,0 +1,108 @@
+#include "globalDiagnostics.hpp"
+#include <algorithm>
+#include <utility>
+#include "solver.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+
+void ablate::solver::GlobalDiagnostics::Register(std::size_t numberSum, std::size_t numberMax, std::size_t numberMin, BeginFunction beginFunction, ResultFunction resultFunction) {
+    diagnostics.push_back(Diagnostic{
+        .numberSum = numberSum, .numberMax = numberMax, .numberMin = numberMin, .beginFunction = std::move(beginFunction), .resultFunction = std::move(resultFunction)});
+}
+
+void ablate::solver::GlobalDiagnostics::PackedReduction(void* in, void* inOut, int* length, MPI_Datatype*) {
+    auto inValues = (const PetscReal*)in;
+    auto inOutValues = (PetscReal*)inOut;
+
+    // the first value is the number of summed values, the remaining values are maximums
+    const auto numberSum = (int)inValues[0];
+    for (int i = 1; i <= numberSum; i++) {
+        inOutValues[i] += inValues[i];
+    }
+    for (int i = numberSum + 1; i < *length; i++) {
+        inOutValues[i] = PetscMax(inOutValues[i], inValues[i]);
+    }
+}
+
+void ablate::solver::GlobalDiagnostics::Compute(TS ts, Solver& solver) const {
+    if (diagnostics.empty()) {
+        return;
+    }
+
+    // size up the local values for each diagnostic
+    std::size_t numberSum = 0, numberMax = 0, numberMin = 0;
+    for (const auto& diagnostic : diagnostics) {
+        numberSum += diagnostic.numberSum;
+        numberMax += diagnostic.numberMax;
+        numberMin += diagnostic.numberMin;
+    }
+    std::vector<PetscReal> sumValues(numberSum, 0.0);
+    std::vector<PetscReal> maxValues(numberMax, PETSC_MIN_REAL);
+    std::vector<PetscReal> minValues(numberMin, PETSC_MAX_REAL);
+
+    // set up the cell function for each diagnostic
+    std::vector<GlobalDiagnostics::CellFunction> cellFunctions;
+    for (const auto& diagnostic : diagnostics) {
+        cellFunctions.push_back(diagnostic.beginFunction(solver));
+    }
+
+    // march over each cell once for all diagnostics
+    auto dm = solver.GetSubDomain().GetDM();
+    Vec globalSolution = solver.GetSubDomain().GetSolutionVector();
+    const PetscScalar* solutionArray;
+    VecGetArrayRead(globalSolution, &solutionArray) >> checkError;
+
+    Range cellRange;
+    solver.GetCellRange(cellRange);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+
+        // only the cells owned by this rank are in the global vector
+        const PetscScalar* conserved = nullptr;
+        DMPlexPointGlobalRead(dm, cell, solutionArray, &conserved) >> checkError;
+        if (!conserved) {
+            continue;
+        }
+
+        std::size_t sumOffset = 0, maxOffset = 0, minOffset = 0;
+        for (std::size_t d = 0; d < diagnostics.size(); d++) {
+            cellFunctions[d](cell, conserved, sumValues.data() + sumOffset, maxValues.data() + maxOffset, minValues.data() + minOffset);
+            sumOffset += diagnostics[d].numberSum;
+            maxOffset += diagnostics[d].numberMax;
+            minOffset += diagnostics[d].numberMin;
+        }
+    }
+    solver.RestoreRange(cellRange);
+    VecRestoreArrayRead(globalSolution, &solutionArray) >> checkError;
+
+    // pack all values into a single reduction, the minimums are negated so they can be reduced as maximums
+    std::vector<PetscReal> packedValues;
+    packedValues.reserve(1 + numberSum + numberMax + numberMin);
+    packedValues.push_back((PetscReal)numberSum);
+    packedValues.insert(packedValues.end(), sumValues.begin(), sumValues.end());
+    packedValues.insert(packedValues.end(), maxValues.begin(), maxValues.end());
+    for (const auto& minValue : minValues) {
+        packedValues.push_back(-minValue);
+    }
+
+    MPI_Op packedOp;
+    MPI_Op_create(PackedReduction, 1, &packedOp) >> checkMpiError;
+    MPI_Allreduce(MPI_IN_PLACE, packedValues.data(), (PetscMPIInt)packedValues.size(), MPIU_REAL, packedOp, solver.GetSubDomain().GetComm()) >> checkMpiError;
+    MPI_Op_free(&packedOp) >> checkMpiError;
+
+    // unpack the global values
+    std::copy_n(packedValues.begin() + 1, numberSum, sumValues.begin());
+    std::copy_n(packedValues.begin() + 1 + (std::ptrdiff_t)numberSum, numberMax, maxValues.begin());
+    for (std::size_t i = 0; i < numberMin; i++) {
+        minValues[i] = -packedValues[1 + numberSum + numberMax + i];
+    }
+
+    // pass each diagnostic its values
+    std::size_t sumOffset = 0, maxOffset = 0, minOffset = 0;
+    for (const auto& diagnostic : diagnostics) {
+        diagnostic.resultFunction(ts, sumValues.data() + sumOffset, maxValues.data() + maxOffset, minValues.data() + minOffset);
+        sumOffset += diagnostic.numberSum;
+        maxOffset += diagnostic.numberMax;
+        minOffset += diagnostic.numberMin;
+    }
+}
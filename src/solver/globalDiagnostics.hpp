@@ -0,0 +1,75 @@
+#ifndef ABLATELIBRARY_GLOBALDIAGNOSTICS_HPP
+#define ABLATELIBRARY_GLOBALDIAGNOSTICS_HPP
+
+#include <petsc.h>
+#include <functional>
+#include <vector>
+
+namespace ablate::solver {
+
+// forward declare the Solver
+class Solver;
+
+/**
+ * Computes the domain sums, maxima, and minima requested by any number of diagnostics (i.e. the pressure gradient scaling and buoyancy reference values) in a
+ * single pass over the cells of a solver and a single packed reduction.  Each diagnostic is given its own slice of the sum, max, and min values.
+ */
+class GlobalDiagnostics {
+   public:
+    /**
+     * Add the contribution of a single cell owned by this rank to the local sum, max, and min values of a diagnostic
+     */
+    using CellFunction = std::function<void(PetscInt cell, const PetscScalar* conserved, PetscReal sum[], PetscReal max[], PetscReal min[])>;
+
+    /**
+     * Called at the start of each pass to set up the cell function for this pass
+     */
+    using BeginFunction = std::function<CellFunction(Solver& solver)>;
+
+    /**
+     * Receives the global sum, max, and min values of a diagnostic
+     */
+    using ResultFunction = std::function<void(TS ts, const PetscReal sum[], const PetscReal max[], const PetscReal min[])>;
+
+   private:
+    struct Diagnostic {
+        std::size_t numberSum;
+        std::size_t numberMax;
+        std::size_t numberMin;
+        BeginFunction beginFunction;
+        ResultFunction resultFunction;
+    };
+
+    //! the registered diagnostics in the order they were registered
+    std::vector<Diagnostic> diagnostics;
+
+    /**
+     * The mpi reduction for the packed values [numberSum, sum..., max..., -min...]
+     */
+    static void PackedReduction(void* in, void* inOut, int* length, MPI_Datatype* datatype);
+
+   public:
+    /**
+     * Register a diagnostic computed in the shared pass
+     * @param numberSum the number of summed values
+     * @param numberMax the number of maximum values
+     * @param numberMin the number of minimum values
+     * @param beginFunction returns the function used to add each cell's contribution
+     * @param resultFunction receives the global values
+     */
+    void Register(std::size_t numberSum, std::size_t numberMax, std::size_t numberMin, BeginFunction beginFunction, ResultFunction resultFunction);
+
+    /**
+     * Compute every registered diagnostic over the cells of the solver
+     * @param ts
+     * @param solver
+     */
+    void Compute(TS ts, Solver& solver) const;
+
+    /**
+     * @return true if no diagnostics are registered
+     */
+    [[nodiscard]] bool Empty() const { return diagnostics.empty(); }
+};
+}  // namespace ablate::solver
+#endif  // ABLATELIBRARY_GLOBALDIAGNOSTICS_HPP
@@ -7,6 +7,12 @@ class IFunction {
    public:
     virtual PetscErrorCode ComputeIFunction(PetscReal time, Vec locX, Vec locX_t, Vec locF) = 0;
     virtual PetscErrorCode ComputeIJacobian(PetscReal time, Vec locX, Vec locX_t, PetscReal X_tShift, Mat Jac, Mat JacP) = 0;
+
+    /**
+     * Solvers that only contribute implicit terms when configured (e.g. implicit processes) report if they were configured.  The ts implicit function is only used if at least one solver
+     * is configured, in which case every IFunction solver is called and must add the X_t terms for its own cells.  The jacobian is zeroed and assembled by the TimeStepper.
+     */
+    [[nodiscard]] virtual bool HasIFunction() const { return true; }
 };
 
 }  // namespace ablate::solver
@@ -16,6 +16,16 @@ class RHSFunction {
      */
     virtual PetscErrorCode ComputeRHSFunction(PetscReal time, Vec locX, Vec F) = 0;
 
+    /**
+     * Optionally called while the ghost exchange of locX is in flight, before the boundary and PreRHSFunction calls.  Only the values of cells owned by
+     * this rank are valid in locX.  Any contribution added here must be skipped by the following ComputeRHSFunction call.
+     * @param time
+     * @param locX
+     * @param F
+     * @return
+     */
+    virtual PetscErrorCode ComputeInteriorRHSFunction(PetscReal time, Vec locX, Vec F) { return 0; };
+
     /**
      * Called before the RHS function for all solvers
      * @param time
@@ -23,6 +33,21 @@ class RHSFunction {
      * @return
      */
     virtual PetscErrorCode PreRHSFunction(TS ts, PetscReal time, bool initialStage, Vec locX) { return 0; };
+
+    /**
+     * Called after the contributions of all solvers have been summed into the global F
+     * @param time
+     * @param F
+     * @return
+     */
+    virtual PetscErrorCode PostRHSFunction(PetscReal time, Vec F) { return 0; };
+
+    /**
+     * Solvers that return true must only add to F in ComputeRHSFunction, make no collective calls, and only modify their own state so that the rhs function
+     * can be computed on a helper thread into a private F while the other solvers run.
+     * @return true if ComputeRHSFunction can run concurrently with the other rhs functions
+     */
+    [[nodiscard]] virtual bool ConcurrentRHSFunction() const { return false; }
 };
 
 }  // namespace ablate::solver
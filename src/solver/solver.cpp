@@ -21,9 +21,40 @@ ablate::solver::Solver::~Solver() {
 
 void ablate::solver::Solver::Register(std::shared_ptr<ablate::domain::SubDomain> subDomainIn) { subDomain = std::move(subDomainIn); }
 
-void ablate::solver::Solver::PreStage(TS ts, PetscReal stagetime) {
-    for (auto &function : preStageFunctions) {
-        function(ts, *this, stagetime);
+void ablate::solver::Solver::AccumulateMemoryUsage(utilities::MemoryUsage &memoryUsage) {
+    memoryUsage.Add("dm", utilities::MemoryUsage::DMBytes(subDomain->GetDM()));
+
+    // the solution is stored in the global vector and the local work vectors, the aux only in the local vector
+    for (const auto &location : {domain::FieldLocation::SOL, domain::FieldLocation::AUX}) {
+        DM fieldDm = location == domain::FieldLocation::SOL ? subDomain->GetDM() : subDomain->GetAuxDM();
+        if (!fieldDm) {
+            continue;
+        }
+        PetscSection localSection, globalSection;
+        DMGetLocalSection(fieldDm, &localSection) >> checkError;
+        DMGetGlobalSection(fieldDm, &globalSection) >> checkError;
+        if (location == domain::FieldLocation::AUX) {
+            memoryUsage.Add("auxDm", utilities::MemoryUsage::SectionBytes(localSection));
+        }
+        for (const auto &field : subDomain->GetFields(location)) {
+            PetscSection localFieldSection, globalFieldSection;
+            PetscInt localSize, globalSize = 0;
+            PetscSectionGetField(localSection, field.id, &localFieldSection) >> checkError;
+            PetscSectionGetStorageSize(localFieldSection, &localSize) >> checkError;
+            if (location == domain::FieldLocation::SOL) {
+                PetscSectionGetField(globalSection, field.id, &globalFieldSection) >> checkError;
+                PetscSectionGetStorageSize(globalFieldSection, &globalSize) >> checkError;
+            }
+            memoryUsage.Add((location == domain::FieldLocation::SOL ? "field::" : "auxField::") + field.name, (PetscLogDouble)(localSize + globalSize) * sizeof(PetscScalar));
+        }
+    }
+}
+
+void ablate::solver::Solver::PreStage(TS ts, PetscReal stagetime, bool firstStage) {
+    for (auto &[function, dependence] : preStageFunctions) {
+        if (firstStage || dependence == PreStageDependence::stage) {
+            function(ts, *this, stagetime);
+        }
     }
 }
 void ablate::solver::Solver::PreStep(TS ts) {
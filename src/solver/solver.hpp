@@ -6,19 +6,28 @@
 #include <functional>
 #include <parameters/parameters.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 #include "io/serializable.hpp"
 #include "range.hpp"
+#include "utilities/memoryUsage.hpp"
 
 namespace ablate::solver {
 
 class TimeStepper;
 
 class Solver {
+   public:
+    /**
+     * Describes what a pre stage function depends upon.  Step functions depend only upon the state at the start of the step and are only called in the
+     * first stage of each step (or attempted step), stage functions are called in every stage.
+     */
+    enum class PreStageDependence { step, stage };
+
    private:
     // pre and post step functions for the flow
     std::vector<std::function<void(TS ts, Solver&)>> preStepFunctions;
-    std::vector<std::function<void(TS ts, Solver&, PetscReal)>> preStageFunctions;
+    std::vector<std::pair<std::function<void(TS ts, Solver&, PetscReal)>, PreStageDependence>> preStageFunctions;
     std::vector<std::function<void(TS ts, Solver&)>> postStepFunctions;
     std::vector<std::function<void(TS ts, Solver&)>> postEvaluateFunctions;
 
@@ -54,6 +63,13 @@ class Solver {
     /*** Set up mesh dependent initialization, this may be called multiple times if the mesh changes **/
     virtual void Initialize() = 0;
 
+    /**
+     * Add the bytes owned by this solver to the memory usage.  The default adds the dm, sections, and the solution and aux fields of the subDomain, solvers
+     * holding their own caches should call this and then add their caches.
+     * @param memoryUsage
+     */
+    virtual void AccumulateMemoryUsage(utilities::MemoryUsage& memoryUsage);
+
     /** string id for this solver **/
     [[nodiscard]] inline const std::string& GetSolverId() const { return solverId; }
 
@@ -76,7 +92,7 @@ class Solver {
     [[nodiscard]] inline std::shared_ptr<domain::Region> GetRegion() const noexcept { return region; }
 
     // Support for timestepping calls
-    void PreStage(TS ts, PetscReal stagetime);
+    void PreStage(TS ts, PetscReal stagetime, bool firstStage = true);
     void PreStep(TS ts);
     void PostStep(TS ts);
     void PostEvaluate(TS ts);
@@ -89,9 +105,12 @@ class Solver {
 
     /**
      * Adds function to be called before each flow stage
-     * @param preStep
+     * @param preStage
+     * @param dependence if step, the function is only called in the first stage of each step
      */
-    inline void RegisterPreStage(const std::function<void(TS ts, Solver&, PetscReal)>& preStage) { this->preStageFunctions.push_back(preStage); }
+    inline void RegisterPreStage(const std::function<void(TS ts, Solver&, PetscReal)>& preStage, PreStageDependence dependence = PreStageDependence::stage) {
+        this->preStageFunctions.emplace_back(preStage, dependence);
+    }
 
     /**
      * Adds function to be called after each flow step
@@ -0,0 +1,47 @@
+#include "tiledRange.hpp"
+#include <algorithm>
+#include <unordered_map>
+#include "utilities/petscError.hpp"
+
+ablate::solver::TiledRange::TiledRange(DM dm, const Range& cellRange, const Range& faceRange, PetscInt cellsPerTile) {
+    cellsPerTile = PetscMax(cellsPerTile, 1);
+    const PetscInt numberCells = cellRange.end - cellRange.start;
+    const auto numberTiles = (std::size_t)PetscMax((numberCells + cellsPerTile - 1) / cellsPerTile, 1);
+    tileCells.resize(numberTiles);
+    tileFaces.resize(numberTiles);
+
+    // split the cells in range order, recording the tile of each cell
+    std::unordered_map<PetscInt, std::size_t> cellTile;
+    cellTile.reserve(numberCells);
+    for (PetscInt c = cellRange.start; c < cellRange.end; ++c) {
+        const PetscInt cell = cellRange.points ? cellRange.points[c] : c;
+        const auto tile = (std::size_t)((c - cellRange.start) / cellsPerTile);
+        tileCells[tile].push_back(cell);
+        cellTile[cell] = tile;
+    }
+
+    // each face goes to the first tile of its supporting cells, faces without a tiled cell go to the first tile so none are dropped
+    for (PetscInt f = faceRange.start; f < faceRange.end; ++f) {
+        const PetscInt face = faceRange.points ? faceRange.points[f] : f;
+        PetscInt supportSize;
+        const PetscInt* support;
+        DMPlexGetSupportSize(dm, face, &supportSize) >> checkError;
+        DMPlexGetSupport(dm, face, &support) >> checkError;
+
+        std::size_t tile = numberTiles;
+        for (PetscInt s = 0; s < supportSize; ++s) {
+            if (auto location = cellTile.find(support[s]); location != cellTile.end()) {
+                tile = std::min(tile, location->second);
+            }
+        }
+        tileFaces[tile < numberTiles ? tile : 0].push_back(face);
+    }
+
+    // the ranges point into the tile vectors, which are no longer modified
+    cellRanges.resize(numberTiles);
+    faceRanges.resize(numberTiles);
+    for (std::size_t t = 0; t < numberTiles; ++t) {
+        cellRanges[t] = Range{.is = nullptr, .start = 0, .end = (PetscInt)tileCells[t].size(), .points = tileCells[t].data()};
+        faceRanges[t] = Range{.is = nullptr, .start = 0, .end = (PetscInt)tileFaces[t].size(), .points = tileFaces[t].data()};
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef ABLATELIBRARY_TILEDRANGE_HPP
+#define ABLATELIBRARY_TILEDRANGE_HPP
+#include <vector>
+#include "petsc.h"
+#include "range.hpp"
+
+namespace ablate::solver {
+
+/**
+ * Splits a cell range into blocks of consecutive cells, each with the faces of the face range adjacent to its cells.  Each face is assigned to exactly one tile
+ * (the first tile containing one of its supporting cells), so a per-tile pass over the faces visits every face once.  Several per-cell/per-face stages can then
+ * be run tile by tile while the cell data is still in cache instead of each stage streaming the entire mesh.
+ */
+class TiledRange {
+   private:
+    //! the cell and face points in each tile
+    std::vector<std::vector<PetscInt>> tileCells;
+    std::vector<std::vector<PetscInt>> tileFaces;
+
+    //! the range objects pointing into the tile points
+    std::vector<Range> cellRanges;
+    std::vector<Range> faceRanges;
+
+   public:
+    /**
+     * Build the tiles
+     * @param dm the dm the ranges were taken from
+     * @param cellRange the cells to tile, the order of the range is preserved
+     * @param faceRange the faces to assign to the tiles
+     * @param cellsPerTile the number of cells in each tile
+     */
+    TiledRange(DM dm, const Range& cellRange, const Range& faceRange, PetscInt cellsPerTile);
+
+    /**
+     * @return the number of tiles
+     */
+    [[nodiscard]] inline std::size_t GetNumberTiles() const { return cellRanges.size(); }
+
+    /**
+     * @return the cells in the tile
+     */
+    [[nodiscard]] inline const Range& GetCellRange(std::size_t tile) const { return cellRanges[tile]; }
+
+    /**
+     * @return the faces assigned to the tile
+     */
+    [[nodiscard]] inline const Range& GetFaceRange(std::size_t tile) const { return faceRanges[tile]; }
+};
+}  // namespace ablate::solver
+#endif  // ABLATELIBRARY_TILEDRANGE_HPP
@@ -1,27 +1,44 @@
 #include "timeStepper.hpp"
 #include <petscdm.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include "io/interval/collectiveInterval.hpp"
+#include "mathFunctions/ensembleFunction.hpp"
 #include "utilities/mpiUtilities.hpp"
 #include "utilities/petscError.hpp"
 #include "utilities/petscOptions.hpp"
+#include "utilities/petscUtilities.hpp"
 
 ablate::solver::TimeStepper::TimeStepper(std::shared_ptr<ablate::domain::Domain> domain, std::shared_ptr<ablate::parameters::Parameters> arguments, std::shared_ptr<io::Serializer> serializer,
                                          std::vector<std::shared_ptr<mathFunctions::FieldFunction>> initialization, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions,
                                          std::vector<std::shared_ptr<mathFunctions::FieldFunction>> absoluteTolerances, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> relativeTolerances,
-                                         bool verboseSourceCheck)
-    : ablate::solver::TimeStepper::TimeStepper("", domain, arguments, serializer, initialization, exactSolutions, absoluteTolerances, relativeTolerances, verboseSourceCheck) {}
+                                         bool verboseSourceCheck, bool persistentRHSVectors, std::map<std::string, std::shared_ptr<io::interval::Interval>> rhsIntervals,
+                                         int nonFiniteCheckInterval, bool concurrentRHSFunctions, int ensembleSize)
+    : ablate::solver::TimeStepper::TimeStepper("", domain, arguments, serializer, initialization, exactSolutions, absoluteTolerances, relativeTolerances, verboseSourceCheck,
+                                               persistentRHSVectors, std::move(rhsIntervals), nonFiniteCheckInterval, concurrentRHSFunctions, ensembleSize) {}
 
 ablate::solver::TimeStepper::TimeStepper(std::string nameIn, std::shared_ptr<ablate::domain::Domain> domain, std::shared_ptr<ablate::parameters::Parameters> arguments,
                                          std::shared_ptr<ablate::io::Serializer> serializerIn, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> initializations,
                                          std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> absoluteTolerances,
-                                         std::vector<std::shared_ptr<mathFunctions::FieldFunction>> relativeTolerances, bool verboseSourceCheck)
+                                         std::vector<std::shared_ptr<mathFunctions::FieldFunction>> relativeTolerances, bool verboseSourceCheck, bool persistentRHSVectors,
+                                         std::map<std::string, std::shared_ptr<io::interval::Interval>> rhsIntervals, int nonFiniteCheckInterval,
+                                         bool concurrentRHSFunctions, int ensembleSize)
     : name(nameIn.empty() ? "timeStepper" : nameIn),
       domain(domain),
       serializer(serializerIn),
       verboseSourceCheck(verboseSourceCheck),
+      persistentRHSVectors(persistentRHSVectors),
       initializations(initializations),
       exactSolutions(exactSolutions),
       absoluteTolerances(absoluteTolerances),
-      relativeTolerances(relativeTolerances) {
+      relativeTolerances(relativeTolerances),
+      rhsIntervals(std::move(rhsIntervals)),
+      nonFiniteCheckInterval(nonFiniteCheckInterval),
+      concurrentRHSFunctions(concurrentRHSFunctions),
+      ensembleSize(ensembleSize) {
     // create an instance of the ts
     TSCreate(PETSC_COMM_WORLD, &ts) >> checkError;
 
@@ -42,6 +59,9 @@ ablate::solver::TimeStepper::TimeStepper(std::string nameIn, std::shared_ptr<abl
     // Set this as the context
     TSSetApplicationContext(ts, this) >> checkError;
 
+    // agree on the collective intervals before any other monitor checks them
+    TSMonitorSet(ts, TSSynchronizeIntervalsFunction, nullptr, NULL) >> checkError;
+
     // register the serializer with the ts
     if (serializer) {
         TSMonitorSet(ts, serializer->GetSerializeFunction(), serializer->GetContext(), NULL) >> checkError;
@@ -54,12 +74,33 @@ ablate::solver::TimeStepper::TimeStepper(std::string nameIn, std::shared_ptr<abl
     TSSetPostEvaluate(ts, TSPostEvaluateFunction) >> checkError;
 }
 
-ablate::solver::TimeStepper::~TimeStepper() { TSDestroy(&ts) >> checkError; }
+ablate::solver::TimeStepper::~TimeStepper() {
+    if (persistentLocX) {
+        VecDestroy(&persistentLocX) >> checkError;
+        VecDestroy(&persistentLocF) >> checkError;
+    }
+    for (auto& multirate : multirateRHSFunctionSolvers) {
+        if (multirate.locF) {
+            VecDestroy(&multirate.locF) >> checkError;
+        }
+    }
+    for (auto& locF : concurrentLocF) {
+        if (locF) {
+            VecDestroy(&locF) >> checkError;
+        }
+    }
+    TSDestroy(&ts) >> checkError;
+}
 
 void ablate::solver::TimeStepper::Initialize() {
     StartEvent((this->name + "::Initialize").c_str());
     if (!initialized) {
-        domain->InitializeSubDomains(solvers, initializations, exactSolutions);
+        // when resuming from a checkpoint the solution is restored when the subDomains are registered with the serializer, so skip projecting the initial conditions
+        if (serializer && serializer->Resumed()) {
+            domain->InitializeSubDomains(solvers, {}, exactSolutions);
+        } else {
+            domain->InitializeSubDomains(solvers, initializations, exactSolutions);
+        }
         TSSetDM(ts, domain->GetDM()) >> checkError;
         initialized = true;
 
@@ -67,9 +108,30 @@ void ablate::solver::TimeStepper::Initialize() {
         if (!boundaryFunctionSolvers.empty()) {
             DMTSSetBoundaryLocal(domain->GetDM(), SolverComputeBoundaryFunctionLocal, this) >> checkError;
         }
-        if (!rhsFunctionSolvers.empty()) {
+        // make sure that every multirate interval was used
+        for (const auto& rhsInterval : rhsIntervals) {
+            const auto& solverId = rhsInterval.first;
+            if (std::none_of(solvers.begin(), solvers.end(), [&solverId](const auto& solver) { return solver->GetSolverId() == solverId && std::dynamic_pointer_cast<RHSFunction>(solver); })) {
+                throw std::invalid_argument("The rhsIntervals solver id " + solverId + " does not match any solver with a rhs function in " + name);
+            }
+        }
+        if (!rhsFunctionSolvers.empty() || !multirateRHSFunctionSolvers.empty()) {
             DMTSSetRHSFunction(domain->GetDM(), SolverComputeRHSFunction, this) >> checkError;
         }
+        // the concurrent rhs functions call petsc from the helper threads
+        if (concurrentRHSFunctions) {
+#if defined(PETSC_HAVE_THREADSAFETY)
+            int provided;
+            MPI_Query_thread(&provided);
+            threadedRHSFunctions = provided == MPI_THREAD_MULTIPLE;
+#endif
+            concurrentLocF.resize(rhsFunctionSolvers.size(), nullptr);
+        }
+        // only use the implicit function when at least one solver was configured with implicit terms so explicit ts types can still be used.  Every implicit solver adds the X_t
+        // of its own cells so all are kept once any solver is implicit.
+        if (std::none_of(iFunctionSolvers.begin(), iFunctionSolvers.end(), [](const auto& solver) { return solver->HasIFunction(); })) {
+            iFunctionSolvers.clear();
+        }
         if (!iFunctionSolvers.empty()) {
             DMTSSetIFunctionLocal(domain->GetDM(), SolverComputeIFunctionLocal, this) >> checkError;
             DMTSSetIJacobianLocal(domain->GetDM(), SolverComputeIJacobianLocal, this) >> checkError;
@@ -85,33 +147,9 @@ void ablate::solver::TimeStepper::Initialize() {
         }
 
         if (serializer) {
-            // Register any subdomain with the serializer
-            for (auto& subDomain : domain->GetSerializableSubDomains()) {
-                if (auto subDomainPtr = subDomain.lock()) {
-                    if (subDomainPtr->Serialize()) {
-                        serializer->Register(subDomain);
-                    }
-                }
-            }
-
-            // Register the solver with the serializer
-            for (auto& solver : solvers) {
-                auto serializable = std::dynamic_pointer_cast<io::Serializable>(solver);
-                if (serializable && serializable->Serialize()) {
-                    serializer->Register(serializable);
-                }
-            }
-
-            // register any monitors with the seralizer
-            for (const auto& monitorPerSolver : monitors) {
-                for (const auto& monitor : monitorPerSolver.second) {
-                    auto serializable = std::dynamic_pointer_cast<io::Serializable>(monitor);
-                    if (serializable && serializable->Serialize()) {
-                        serializer->Register(serializable);
-                    }
-                }
-            }
+            RegisterSerializables();
         }
+
         // Get the solution vector
         Vec solutionVec = domain->GetSolutionVector();
 
@@ -121,6 +159,71 @@ void ablate::solver::TimeStepper::Initialize() {
     }
     EndEvent();
 }
+
+void ablate::solver::TimeStepper::RegisterSerializables() {
+    // Register any subdomain with the serializer
+    for (auto& subDomain : domain->GetSerializableSubDomains()) {
+        if (auto subDomainPtr = subDomain.lock()) {
+            if (subDomainPtr->Serialize()) {
+                serializer->Register(subDomain);
+            }
+        }
+    }
+
+    // Register the solver with the serializer
+    for (auto& solver : solvers) {
+        auto serializable = std::dynamic_pointer_cast<io::Serializable>(solver);
+        if (serializable && serializable->Serialize()) {
+            serializer->Register(serializable);
+        }
+    }
+
+    // register any monitors with the seralizer
+    for (const auto& monitorPerSolver : monitors) {
+        for (const auto& monitor : monitorPerSolver.second) {
+            auto serializable = std::dynamic_pointer_cast<io::Serializable>(monitor);
+            if (serializable && serializable->Serialize()) {
+                serializer->Register(serializable);
+            }
+        }
+    }
+}
+
+void ablate::solver::TimeStepper::Reconfigure(std::shared_ptr<io::Serializer> serializerIn, std::map<std::string, std::vector<std::shared_ptr<monitors::Monitor>>> monitorsIn) {
+    if (!initialized) {
+        throw std::runtime_error("The TimeStepper " + name + " must be initialized before it can be reconfigured");
+    }
+
+    // remove the old serializer and monitors (including any set from the options) from the ts
+    TSMonitorCancel(ts) >> checkError;
+    serializer = std::move(serializerIn);
+    monitors.clear();
+    TSMonitorSet(ts, TSSynchronizeIntervalsFunction, nullptr, NULL) >> checkError;
+
+    if (serializer) {
+        TSMonitorSet(ts, serializer->GetSerializeFunction(), serializer->GetContext(), NULL) >> checkError;
+    }
+
+    // register the new monitors with the existing solvers
+    for (auto& [solverId, solverMonitors] : monitorsIn) {
+        auto solver = std::find_if(solvers.begin(), solvers.end(), [&solverId = solverId](const auto& solver) { return solver->GetSolverId() == solverId; });
+        if (solver == solvers.end()) {
+            throw std::invalid_argument("The monitor solver id " + solverId + " does not match any solver in " + name);
+        }
+        for (auto& monitor : solverMonitors) {
+            monitor->Register(*solver);
+            if (auto monitorFunction = monitor->GetPetscFunction()) {
+                TSMonitorSet(ts, monitorFunction, monitor->GetContext(), NULL) >> checkError;
+            }
+        }
+        monitors[solverId] = solverMonitors;
+    }
+
+    if (serializer) {
+        RegisterSerializables();
+    }
+}
+
 void ablate::solver::TimeStepper::Solve() {
     if (solvers.empty()) {
         return;
@@ -172,9 +275,55 @@ void ablate::solver::TimeStepper::Solve() {
     // create a log event
     auto logEvent = RegisterEvent((this->name + "::Solve").c_str());
     PetscLogEventSetDof(logEvent, 0, dof) >> checkError;
-    PetscLogEventBegin(logEvent, 0, 0, 0, 0);
-    TSSolve(ts, solutionVec) >> checkError;
-    PetscLogEventEnd(logEvent, 0, 0, 0, 0);
+
+    if (ensembleSize <= 0) {
+        PetscLogEventBegin(logEvent, 0, 0, 0, 0);
+        TSSolve(ts, solutionVec) >> checkError;
+        PetscLogEventEnd(logEvent, 0, 0, 0, 0);
+        return;
+    }
+
+    // each ensemble member reuses the mesh, solver setup, and initialization and is solved from its own initial conditions
+    if (serializer && ensembleSize > 1) {
+        throw std::invalid_argument("The TimeStepper " + name + " cannot use a serializer in ensemble mode, use monitors to record each member");
+    }
+    PetscReal initialTime, initialTimeStep;
+    PetscInt initialStep;
+    TSGetTime(ts, &initialTime) >> checkError;
+    TSGetStepNumber(ts, &initialStep) >> checkError;
+    TSGetTimeStep(ts, &initialTimeStep) >> checkError;
+    for (int member = 0; member < ensembleSize; ++member) {
+        PetscPrintf(PetscObjectComm((PetscObject)ts), "%s ensemble member %d of %d\n", name.c_str(), member + 1, ensembleSize) >> checkError;
+        mathFunctions::EnsembleFunction::SetActiveMember(member);
+        if (member > 0) {
+            ResetEnsembleMember(initialTime, initialStep, initialTimeStep);
+        }
+        PetscLogEventBegin(logEvent, 0, 0, 0, 0);
+        TSSolve(ts, solutionVec) >> checkError;
+        PetscLogEventEnd(logEvent, 0, 0, 0, 0);
+    }
+    mathFunctions::EnsembleFunction::SetActiveMember(0);
+}
+
+void ablate::solver::TimeStepper::ResetEnsembleMember(PetscReal initialTime, PetscInt initialStep, PetscReal initialTimeStep) {
+    TSSetTime(ts, initialTime) >> checkError;
+    TSSetStepNumber(ts, initialStep) >> checkError;
+    TSSetTimeStep(ts, initialTimeStep) >> checkError;
+
+    // set all values to nan so any point not set by the member initialization is caught by the check
+    Vec solutionVec = domain->GetSolutionVector();
+    if (!initializations.empty()) {
+        VecSet(solutionVec, NAN) >> checkError;
+        domain->ProjectFieldFunctions(initializations, solutionVec, initialTime);
+        if (domain->CheckFieldValues()) {
+            throw std::runtime_error("Field values at points in the domain were not initialized for the ensemble member.");
+        }
+    }
+
+    // force every held contribution to be recomputed for the new member
+    for (auto& multirate : multirateRHSFunctionSolvers) {
+        multirate.update = true;
+    }
 }
 
 double ablate::solver::TimeStepper::GetTime() const {
@@ -203,7 +352,17 @@ void ablate::solver::TimeStepper::Register(std::shared_ptr<ablate::solver::Solve
         iFunctionSolvers.push_back(interface);
     }
     if (auto interface = std::dynamic_pointer_cast<RHSFunction>(solver)) {
-        rhsFunctionSolvers.push_back(interface);
+        // register the per solver events once so each rhs function can be timed separately
+        RHSFunctionEvents events{.preRHSFunction = RegisterEvent(("SolverComputeRHSFunction::PreRHSFunction::" + solver->GetSolverId()).c_str()),
+                                 .computeRHSFunction = RegisterEvent(("SolverComputeRHSFunction::ComputeRHSFunction::" + solver->GetSolverId()).c_str())};
+
+        // solvers with their own interval are held between updates
+        if (auto interval = rhsIntervals.find(solver->GetSolverId()); interval != rhsIntervals.end()) {
+            multirateRHSFunctionSolvers.push_back(MultirateRHSFunction{.solver = interface, .interval = interval->second, .events = events});
+        } else {
+            rhsFunctionSolvers.push_back(interface);
+            rhsFunctionEvents.push_back(events);
+        }
     }
     if (auto interface = std::dynamic_pointer_cast<BoundaryFunction>(solver)) {
         boundaryFunctionSolvers.push_back(interface);
@@ -216,6 +375,17 @@ PetscErrorCode ablate::solver::TimeStepper::TSPreStepFunction(TS ts) {
     PetscErrorCode ierr = TSGetApplicationContext(ts, &timeStepper);
     CHKERRQ(ierr);
 
+    // check if any of the multirate rhs functions should be recomputed in this step
+    if (!timeStepper->multirateRHSFunctionSolvers.empty()) {
+        PetscInt step;
+        PetscReal time;
+        PetscCall(TSGetStepNumber(ts, &step));
+        PetscCall(TSGetTime(ts, &time));
+        for (auto& multirate : timeStepper->multirateRHSFunctionSolvers) {
+            multirate.update = multirate.update || multirate.interval->Check(PetscObjectComm((PetscObject)ts), step, time);
+        }
+    }
+
     for (auto& solver : timeStepper->solvers) {
         try {
             solver->PreStep(ts);
@@ -238,11 +408,13 @@ PetscErrorCode ablate::solver::TimeStepper::TSPreStageFunction(TS ts, PetscReal
     ablate::solver::TimeStepper* timeStepper;
     PetscCall(TSGetApplicationContext(ts, &timeStepper));
     // Set to try if time == stagetime
-    timeStepper->runInitialStep = timeStepper->runInitialStep || (time == stagetime);
+    const bool firstStage = time == stagetime;
+    timeStepper->runInitialStep = timeStepper->runInitialStep || firstStage;
 
+    // step dependent pre stage functions are skipped after the first stage
     for (const auto& solver : timeStepper->solvers) {
         try {
-            solver->PreStage(ts, stagetime);
+            solver->PreStage(ts, stagetime, firstStage);
         } catch (std::exception& exp) {
             SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exp.what());
         }
@@ -251,6 +423,16 @@ PetscErrorCode ablate::solver::TimeStepper::TSPreStageFunction(TS ts, PetscReal
     PetscFunctionReturn(0);
 }
 
+PetscErrorCode ablate::solver::TimeStepper::TSSynchronizeIntervalsFunction(TS ts, PetscInt steps, PetscReal time, Vec, void*) {
+    PetscFunctionBeginUser;
+    try {
+        io::interval::CollectiveInterval::Synchronize(PetscObjectComm((PetscObject)ts), steps, time);
+    } catch (std::exception& exp) {
+        SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exp.what());
+    }
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::solver::TimeStepper::TSPostStepFunction(TS ts) {
     PetscFunctionBeginUser;
     ablate::solver::TimeStepper* timeStepper;
@@ -311,26 +493,157 @@ PetscErrorCode ablate::solver::TimeStepper::SolverComputeIJacobianLocal(DM, Pets
     PetscFunctionBeginUser;
     PetscErrorCode ierr;
     auto timeStepper = (ablate::solver::TimeStepper*)timeStepperCtx;
+
+    // each solver adds its contribution to the matrix, so zero and assemble once for all solvers
+    PetscCall(MatZeroEntries(JacP));
     for (auto& solver : timeStepper->iFunctionSolvers) {
         ierr = solver->ComputeIJacobian(time, locX, locX_t, X_tShift, Jac, JacP);
         CHKERRQ(ierr);
     }
+    PetscCall(MatAssemblyBegin(JacP, MAT_FINAL_ASSEMBLY));
+    PetscCall(MatAssemblyEnd(JacP, MAT_FINAL_ASSEMBLY));
+    if (Jac != JacP) {
+        PetscCall(MatAssemblyBegin(Jac, MAT_FINAL_ASSEMBLY));
+        PetscCall(MatAssemblyEnd(Jac, MAT_FINAL_ASSEMBLY));
+    }
 
     PetscFunctionReturn(0);
 }
+PetscErrorCode ablate::solver::TimeStepper::ComputeRHSFunctions(PetscReal time, Vec locX, Vec locF) {
+    PetscFunctionBeginUser;
+    // the loggable events are registered on first use, so helper threads are only used once every rhs function has been computed in place
+    const bool threaded = threadedRHSFunctions && concurrentEventsRegistered;
+    auto runConcurrently = [this, threaded](std::size_t s) { return threaded && rhsFunctionSolvers[s]->ConcurrentRHSFunction(); };
+
+    // prepare the private local rhs for each concurrent rhs function before any helper thread is started
+    DM dm;
+    PetscCall(VecGetDM(locF, &dm));
+    for (std::size_t s = 0; s < rhsFunctionSolvers.size(); ++s) {
+        if (!runConcurrently(s)) {
+            continue;
+        }
+        // (re)create the private vector if the dm has changed
+        DM concurrentDm = nullptr;
+        if (concurrentLocF[s]) {
+            PetscCall(VecGetDM(concurrentLocF[s], &concurrentDm));
+        }
+        if (concurrentDm != dm) {
+            PetscCall(VecDestroy(&concurrentLocF[s]));
+            PetscCall(DMCreateLocalVector(dm, &concurrentLocF[s]));
+            PetscCall(utilities::PetscUtilities::FirstTouch(concurrentLocF[s]));
+        }
+        PetscCall(VecZeroEntries(concurrentLocF[s]));
+    }
+
+    // compute the remaining rhs functions in place.  The error is held until every helper thread is joined.
+    auto computeInPlace = [&]() -> PetscErrorCode {
+        PetscFunctionBeginUser;
+        for (std::size_t s = 0; s < rhsFunctionSolvers.size(); ++s) {
+            if (runConcurrently(s)) {
+                continue;
+            }
+            PetscCall(PetscLogEventBegin(rhsFunctionEvents[s].computeRHSFunction, 0, 0, 0, 0));
+            PetscCall(rhsFunctionSolvers[s]->ComputeRHSFunction(time, locX, locF));
+            PetscCall(PetscLogEventEnd(rhsFunctionEvents[s].computeRHSFunction, 0, 0, 0, 0));
+        }
+        PetscFunctionReturn(0);
+    };
+
+    std::vector<PetscErrorCode> workerErrors(rhsFunctionSolvers.size(), 0);
+    std::vector<std::string> workerExceptions(rhsFunctionSolvers.size());
+    PetscErrorCode inPlaceError;
+    {
+        // every helper thread is joined when leaving this scope, including when an exception is thrown
+        std::vector<std::thread> workers;
+        struct JoinWorkers {
+            std::vector<std::thread>& workers;
+            ~JoinWorkers() {
+                for (auto& worker : workers) {
+                    if (worker.joinable()) {
+                        worker.join();
+                    }
+                }
+            }
+        } joinWorkers{workers};
+
+        // start each concurrent rhs function on its own helper thread with a private local rhs
+        for (std::size_t s = 0; s < rhsFunctionSolvers.size(); ++s) {
+            if (!runConcurrently(s)) {
+                continue;
+            }
+            workers.emplace_back([this, s, time, locX, &workerErrors, &workerExceptions]() {
+                try {
+                    workerErrors[s] = rhsFunctionSolvers[s]->ComputeRHSFunction(time, locX, concurrentLocF[s]);
+                } catch (std::exception& exception) {
+                    workerErrors[s] = PETSC_ERR_LIB;
+                    workerExceptions[s] = exception.what();
+                }
+            });
+        }
+
+        inPlaceError = computeInPlace();
+    }
+    PetscCall(inPlaceError);
+
+    // merge the private contributions in solver order so the sum does not depend on the thread timing
+    for (std::size_t s = 0; s < rhsFunctionSolvers.size(); ++s) {
+        if (runConcurrently(s)) {
+            if (!workerExceptions[s].empty()) {
+                SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", workerExceptions[s].c_str());
+            }
+            PetscCall(workerErrors[s]);
+            PetscCall(VecAXPY(locF, 1.0, concurrentLocF[s]));
+        }
+    }
+    concurrentEventsRegistered = true;
+    PetscFunctionReturn(0);
+}
+
 PetscErrorCode ablate::solver::TimeStepper::SolverComputeRHSFunction(TS ts, PetscReal time, Vec X, Vec F, void* timeStepperCtx) {
     PetscFunctionBeginUser;
     auto timeStepper = (ablate::solver::TimeStepper*)timeStepperCtx;
 
-    timeStepper->StartEvent("SolverComputeRHSFunction::DMGlobalToLocal");
+    timeStepper->StartEvent("SolverComputeRHSFunction::DMGlobalToLocalBegin");
     DM dm = timeStepper->domain->GetDM();
     Vec locX, locF;
-    DMGetLocalVector(dm, &locX);
-    DMGetLocalVector(dm, &locF);
-    VecZeroEntries(locX);
+    if (timeStepper->persistentRHSVectors) {
+        // (re)create the vectors if the dm has changed.  Entries not set by the ghost exchange are only zeroed here and are then set by the boundary functions.
+        DM persistentDm = nullptr;
+        if (timeStepper->persistentLocX) {
+            PetscCall(VecGetDM(timeStepper->persistentLocX, &persistentDm));
+        }
+        if (persistentDm != dm) {
+            PetscCall(VecDestroy(&timeStepper->persistentLocX));
+            PetscCall(VecDestroy(&timeStepper->persistentLocF));
+            PetscCall(DMCreateLocalVector(dm, &timeStepper->persistentLocX));
+            PetscCall(DMCreateLocalVector(dm, &timeStepper->persistentLocF));
+            PetscCall(utilities::PetscUtilities::FirstTouch(timeStepper->persistentLocX));
+            PetscCall(utilities::PetscUtilities::FirstTouch(timeStepper->persistentLocF));
+            PetscCall(VecZeroEntries(timeStepper->persistentLocX));
+        }
+        locX = timeStepper->persistentLocX;
+        locF = timeStepper->persistentLocF;
+    } else {
+        DMGetLocalVector(dm, &locX);
+        DMGetLocalVector(dm, &locF);
+        VecZeroEntries(locX);
+    }
+
+    // Zero out the temp locF array
+    VecZeroEntries(locF);
 
     // Fill the ghost nodes (and all others).  Note the boundary/local field is swapped from the petsc version
     DMGlobalToLocalBegin(dm, X, INSERT_VALUES, locX);
+    timeStepper->EndEvent();
+
+    // The owned values are copied in the begin call, so compute anything that only depends upon owned cells while the ghost exchange is in flight
+    timeStepper->StartEvent("SolverComputeRHSFunction::ComputeInteriorRHSFunction");
+    for (auto& solver : timeStepper->rhsFunctionSolvers) {
+        PetscCall(solver->ComputeInteriorRHSFunction(time, locX, locF));
+    }
+    timeStepper->EndEvent();
+
+    timeStepper->StartEvent("SolverComputeRHSFunction::DMGlobalToLocalEnd");
     DMGlobalToLocalEnd(dm, X, INSERT_VALUES, locX);
     timeStepper->EndEvent();
 
@@ -339,40 +652,111 @@ PetscErrorCode ablate::solver::TimeStepper::SolverComputeRHSFunction(TS ts, Pets
     PetscCall(SolverComputeBoundaryFunctionLocal(dm, time, locX, nullptr, timeStepperCtx));
     timeStepper->EndEvent();
 
+    // the multirate rhs functions are only recomputed at the first stage of a step that requested an update (or if never computed)
+    for (auto& multirate : timeStepper->multirateRHSFunctionSolvers) {
+        DM multirateDm = nullptr;
+        if (multirate.locF) {
+            PetscCall(VecGetDM(multirate.locF, &multirateDm));
+        }
+        if (multirateDm != dm) {
+            PetscCall(VecDestroy(&multirate.locF));
+            PetscCall(DMCreateLocalVector(dm, &multirate.locF));
+            PetscCall(utilities::PetscUtilities::FirstTouch(multirate.locF));
+            multirate.update = true;
+            multirate.recompute = true;
+        } else {
+            multirate.recompute = multirate.update && timeStepper->runInitialStep;
+        }
+    }
+
     // Call each of the provided pre RHS functions
     timeStepper->StartEvent("SolverComputeRHSFunction::PreRHSFunction");
-    for (auto& solver : timeStepper->rhsFunctionSolvers) {
-        PetscCall(solver->PreRHSFunction(ts, time, timeStepper->runInitialStep, locX));
+    for (std::size_t s = 0; s < timeStepper->rhsFunctionSolvers.size(); ++s) {
+        PetscCall(PetscLogEventBegin(timeStepper->rhsFunctionEvents[s].preRHSFunction, 0, 0, 0, 0));
+        PetscCall(timeStepper->rhsFunctionSolvers[s]->PreRHSFunction(ts, time, timeStepper->runInitialStep, locX));
+        PetscCall(PetscLogEventEnd(timeStepper->rhsFunctionEvents[s].preRHSFunction, 0, 0, 0, 0));
+    }
+    for (auto& multirate : timeStepper->multirateRHSFunctionSolvers) {
+        if (multirate.recompute) {
+            PetscCall(PetscLogEventBegin(multirate.events.preRHSFunction, 0, 0, 0, 0));
+            PetscCall(multirate.solver->PreRHSFunction(ts, time, timeStepper->runInitialStep, locX));
+            PetscCall(PetscLogEventEnd(multirate.events.preRHSFunction, 0, 0, 0, 0));
+        }
     }
     timeStepper->EndEvent();
 
     // Reset the timeStepper->runInitialStep
     timeStepper->runInitialStep = false;
-
-    // Zero out the temp locF array
-    VecZeroEntries(locF);
     CHKMEMQ;
 
     // Call each of the provided RHS functions
     timeStepper->StartEvent("SolverComputeRHSFunction::ComputeRHSFunction");
-    for (auto& solver : timeStepper->rhsFunctionSolvers) {
-        PetscCall(solver->ComputeRHSFunction(time, locX, locF));
-    }
+    PetscCall(timeStepper->ComputeRHSFunctions(time, locX, locF));
     CHKMEMQ;
     timeStepper->EndEvent();
 
+    // add the held contribution from each multirate rhs function
+    timeStepper->StartEvent("SolverComputeRHSFunction::MultirateRHSFunction");
+    for (auto& multirate : timeStepper->multirateRHSFunctionSolvers) {
+        if (multirate.recompute) {
+            PetscCall(VecZeroEntries(multirate.locF));
+            PetscCall(PetscLogEventBegin(multirate.events.computeRHSFunction, 0, 0, 0, 0));
+            PetscCall(multirate.solver->ComputeRHSFunction(time, locX, multirate.locF));
+            PetscCall(PetscLogEventEnd(multirate.events.computeRHSFunction, 0, 0, 0, 0));
+            multirate.update = false;
+            multirate.recompute = false;
+        }
+        PetscCall(VecAXPY(locF, 1.0, multirate.locF));
+    }
+    timeStepper->EndEvent();
+
     timeStepper->StartEvent("SolverComputeRHSFunction::DMLocalToGlobalEnd");
     VecZeroEntries(F);
     DMLocalToGlobalBegin(dm, locF, ADD_VALUES, F);
+
+    // scan the local rhs and the solution for nan/inf while the rhs communication is in flight
+    const bool checkNonFinite = timeStepper->nonFiniteCheckInterval > 0 && timeStepper->rhsEvaluationCount++ % timeStepper->nonFiniteCheckInterval == 0;
+    PetscBool nonFinite = PETSC_FALSE;
+    if (checkNonFinite) {
+        PetscBool nonFiniteRhs, nonFiniteSolution;
+        PetscCall(utilities::PetscUtilities::HasNonFiniteValue(locF, &nonFiniteRhs));
+        PetscCall(utilities::PetscUtilities::HasNonFiniteValue(X, &nonFiniteSolution));
+        nonFinite = (PetscBool)(nonFiniteRhs || nonFiniteSolution);
+    }
     DMLocalToGlobalEnd(dm, locF, ADD_VALUES, F);
-    DMRestoreLocalVector(dm, &locX);
-    DMRestoreLocalVector(dm, &locF);
+    if (!timeStepper->persistentRHSVectors) {
+        DMRestoreLocalVector(dm, &locX);
+        DMRestoreLocalVector(dm, &locF);
+    }
+    timeStepper->EndEvent();
+
+    // Allow each solver to modify the summed global rhs
+    timeStepper->StartEvent("SolverComputeRHSFunction::PostRHSFunction");
+    for (auto& solver : timeStepper->rhsFunctionSolvers) {
+        PetscCall(solver->PostRHSFunction(time, F));
+    }
+    for (auto& multirate : timeStepper->multirateRHSFunctionSolvers) {
+        PetscCall(multirate.solver->PostRHSFunction(time, F));
+    }
     timeStepper->EndEvent();
 
     if (timeStepper->verboseSourceCheck) {
         timeStepper->StartEvent("SolverComputeRHSFunction::CheckFieldValues");
         timeStepper->domain->CheckFieldValues(F);
         timeStepper->EndEvent();
+    } else if (checkNonFinite) {
+        // a single reduction, the slow point by point localization is only done if a nan/inf was found
+        PetscCall(MPIU_Allreduce(MPI_IN_PLACE, &nonFinite, 1, MPIU_BOOL, MPI_LOR, PetscObjectComm((PetscObject)ts)));
+        if (nonFinite) {
+            timeStepper->StartEvent("SolverComputeRHSFunction::CheckFieldValues");
+            try {
+                timeStepper->domain->CheckFieldValues(F);
+            } catch (std::exception& exception) {
+                SETERRQ(PETSC_COMM_SELF, PETSC_ERR_LIB, "%s", exception.what());
+            }
+            timeStepper->EndEvent();
+            SETERRQ(PetscObjectComm((PetscObject)ts), PETSC_ERR_FP, "Nan/Inf detected in the solution or rhs at time %g", (double)time);
+        }
     }
 
     PetscFunctionReturn(0);
@@ -386,4 +770,16 @@ REGISTER_DEFAULT(ablate::solver::TimeStepper, ablate::solver::TimeStepper, "the
                  OPT(std::vector<ablate::mathFunctions::FieldFunction>, "exactSolution", "optional exact solutions that can be used for error calculations"),
                  OPT(std::vector<ablate::mathFunctions::FieldFunction>, "absoluteTolerances", "optional absolute tolerances for a field"),
                  OPT(std::vector<ablate::mathFunctions::FieldFunction>, "relativeTolerances", "optional relative tolerances for a field"),
-                 OPT(bool, "verboseSourceCheck", "does a slow nan/inf for solvers that use rhs evaluation. This is slow and should only be used for debug."));
+                 OPT(bool, "verboseSourceCheck", "does a slow nan/inf for solvers that use rhs evaluation. This is slow and should only be used for debug."),
+                 OPT(bool, "persistentRHSVectors", "keeps the local rhs vectors between evaluations and skips zeroing the local solution before each ghost exchange (default is false)"),
+                 OPT(std::map<std::string TMP_COMMA ablate::io::interval::Interval>, "rhsIntervals",
+                     "optional map of solver ids to the interval at which the solver rhs is recomputed.  Between updates the rhs contribution is held across stages and steps (multirate)"),
+                 OPT(int, "nonFiniteCheckInterval",
+                     "checks the solution and rhs for nan/inf every n rhs evaluations with a fast vectorized scan and a single reduction, the failed points are only "
+                     "located and reported if a nan/inf is found so it can be left on in production (default is 0, off)"),
+                 OPT(bool, "concurrentRHSFunctions",
+                     "computes the rhs functions that support it (boundary and volume radiation solvers) on helper threads into private vectors while the flow rhs is computed, "
+                     "requires a thread safe petsc and MPI_THREAD_MULTIPLE, otherwise every rhs function is computed in place (default is false)"),
+                 OPT(int, "ensembleSize",
+                     "solves this number of ensemble members one after another reusing the mesh, solver setup, and initialization.  Each member starts from the initial "
+                     "conditions at the initial time and EnsembleFunctions select the member values (default is 0, off)"));
@@ -10,6 +10,7 @@
 #include "boundaryFunction.hpp"
 #include "domain/domain.hpp"
 #include "iFunction.hpp"
+#include "io/interval/interval.hpp"
 #include "monitors/monitor.hpp"
 #include "rhsFunction.hpp"
 #include "solver.hpp"
@@ -25,8 +26,8 @@ class TimeStepper : public std::enable_shared_from_this<TimeStepper>, private ut
     // Hold a const value of the domain
     const std::shared_ptr<ablate::domain::Domain> domain;
 
-    // Store a pointer to the Serializer
-    const std::shared_ptr<io::Serializer> serializer;
+    // Store a pointer to the Serializer, this may be replaced when reconfigured
+    std::shared_ptr<io::Serializer> serializer;
 
     // Hold a list of solvers
     std::vector<std::shared_ptr<ablate::solver::Solver>> solvers;
@@ -40,6 +41,13 @@ class TimeStepper : public std::enable_shared_from_this<TimeStepper>, private ut
     // If true, uses a slow nan/inf check at each source term for each evaluation
     const bool verboseSourceCheck;
 
+    // If true, the local rhs vectors are kept between evaluations and the local solution is not zeroed before each ghost exchange
+    const bool persistentRHSVectors;
+
+    // the local solution/rhs vectors kept between evaluations when persistentRHSVectors is set
+    Vec persistentLocX = nullptr;
+    Vec persistentLocF = nullptr;
+
     // Static calls to be passed to the Petsc TS
     /**
      * The TSPreStepFunction is used to call both th PreStep (once) and PreStage (as need calls).
@@ -52,11 +60,89 @@ class TimeStepper : public std::enable_shared_from_this<TimeStepper>, private ut
     static PetscErrorCode TSPostStepFunction(TS ts);
     static PetscErrorCode TSPostEvaluateFunction(TS ts);
 
+    /**
+     * The first TS monitor, agrees on every collective interval for this step with a single broadcast before the serializer and monitors check them
+     */
+    static PetscErrorCode TSSynchronizeIntervalsFunction(TS ts, PetscInt steps, PetscReal time, Vec u, void *ctx);
+
+    /**
+     * Registers the subDomains, solvers, and monitors with the current serializer
+     */
+    void RegisterSerializables();
+
     // store a list of functions for each evaluation type
     std::vector<std::shared_ptr<IFunction>> iFunctionSolvers;
     std::vector<std::shared_ptr<RHSFunction>> rhsFunctionSolvers;
+
+    //! the per solver log events for each rhs function, named with the solver id
+    struct RHSFunctionEvents {
+        PetscLogEvent preRHSFunction;
+        PetscLogEvent computeRHSFunction;
+    };
+    std::vector<RHSFunctionEvents> rhsFunctionEvents;
     std::vector<std::shared_ptr<BoundaryFunction>> boundaryFunctionSolvers;
 
+    /**
+     * A rhs function that is only recomputed at the first stage of a step on its own interval.  Between updates the contribution is held (frozen) and added
+     * to every rhs evaluation, allowing slow physics to be computed at a lower rate than the flow.
+     */
+    struct MultirateRHSFunction {
+        std::shared_ptr<RHSFunction> solver;
+        std::shared_ptr<io::interval::Interval> interval;
+        //! the held local rhs contribution
+        Vec locF = nullptr;
+        //! true if the interval requested an update for the current step
+        bool update = true;
+        //! true if the contribution is recomputed in the current rhs evaluation
+        bool recompute = false;
+        //! the per solver log events
+        RHSFunctionEvents events = {};
+    };
+
+    // the interval for each multirate solver id and the resulting rhs functions
+    const std::map<std::string, std::shared_ptr<io::interval::Interval>> rhsIntervals;
+
+    std::vector<MultirateRHSFunction> multirateRHSFunctionSolvers;
+
+    //! check the solution and rhs for nan/inf every nonFiniteCheckInterval rhs evaluations, zero disables the check
+    const int nonFiniteCheckInterval;
+
+    //! the number of rhs evaluations used to schedule the nan/inf check
+    PetscInt rhsEvaluationCount = 0;
+
+    //! if true, the rhs functions that can run concurrently are computed on helper threads while the remaining rhs functions are computed in place
+    const bool concurrentRHSFunctions;
+
+    //! true if the concurrent rhs functions are run on helper threads (requires a thread safe petsc and MPI_THREAD_MULTIPLE)
+    bool threadedRHSFunctions = false;
+
+    //! the private local rhs vector for each rhs function run on a helper thread, merged into the shared local rhs in solver order
+    std::vector<Vec> concurrentLocF;
+
+    //! the first rhs evaluation is always computed in place so every event is registered before any helper thread starts
+    bool concurrentEventsRegistered = false;
+
+    //! the number of ensemble members solved with this setup, zero disables the ensemble mode
+    const int ensembleSize;
+
+    /**
+     * Resets the ts to the initial time and step and projects the initial conditions of the active ensemble member
+     * @param initialTime
+     * @param initialStep
+     * @param initialTimeStep
+     */
+    void ResetEnsembleMember(PetscReal initialTime, PetscInt initialStep, PetscReal initialTimeStep);
+
+    /**
+     * Computes the rhs function of every (non multirate) solver.  When threaded, each concurrent rhs function is computed on its own helper thread into a
+     * private local vector while the remaining rhs functions are computed in place, then the private vectors are added to locF.
+     * @param time
+     * @param locX
+     * @param locF
+     * @return
+     */
+    PetscErrorCode ComputeRHSFunctions(PetscReal time, Vec locX, Vec locF);
+
     // support for function residual/jacobian evaluation
     static PetscErrorCode SolverComputeBoundaryFunctionLocal(DM dm, PetscReal time, Vec locX, Vec locX_t, void *timeStepperCtx);
     static PetscErrorCode SolverComputeIFunctionLocal(DM dm, PetscReal time, Vec locX, Vec locX_t, Vec locF, void *timeStepperCtx);
@@ -86,11 +172,17 @@ class TimeStepper : public std::enable_shared_from_this<TimeStepper>, private ut
      * @param absoluteTolerances
      * @param relativeTolerances
      * @param verboseSourceCheck
+     * @param persistentRHSVectors
+     * @param rhsIntervals optional map of solver ids to the interval at which the solver rhs is recomputed
+     * @param nonFiniteCheckInterval check the solution and rhs for nan/inf every n rhs evaluations
+     * @param concurrentRHSFunctions compute the rhs functions that can run concurrently on helper threads
+     * @param ensembleSize the number of ensemble members to solve one after another with the same setup
      */
     TimeStepper(std::string name, std::shared_ptr<ablate::domain::Domain> domain, std::shared_ptr<ablate::parameters::Parameters> arguments = {}, std::shared_ptr<io::Serializer> serializer = {},
                 std::vector<std::shared_ptr<mathFunctions::FieldFunction>> initialization = {}, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {},
                 std::vector<std::shared_ptr<mathFunctions::FieldFunction>> absoluteTolerances = {}, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> relativeTolerances = {},
-                bool verboseSourceCheck = {});
+                bool verboseSourceCheck = {}, bool persistentRHSVectors = {}, std::map<std::string, std::shared_ptr<io::interval::Interval>> rhsIntervals = {},
+                int nonFiniteCheckInterval = {}, bool concurrentRHSFunctions = {}, int ensembleSize = {});
 
     /**
      * primary constructor for timestepper without an unqiue name
@@ -103,11 +195,17 @@ class TimeStepper : public std::enable_shared_from_this<TimeStepper>, private ut
      * @param absoluteTolerances
      * @param relativeTolerances
      * @param verboseSourceCheck
+     * @param persistentRHSVectors
+     * @param rhsIntervals optional map of solver ids to the interval at which the solver rhs is recomputed
+     * @param nonFiniteCheckInterval check the solution and rhs for nan/inf every n rhs evaluations
+     * @param concurrentRHSFunctions compute the rhs functions that can run concurrently on helper threads
+     * @param ensembleSize the number of ensemble members to solve one after another with the same setup
      */
     TimeStepper(std::shared_ptr<ablate::domain::Domain> domain, std::shared_ptr<ablate::parameters::Parameters> arguments = {}, std::shared_ptr<io::Serializer> serializer = {},
                 std::vector<std::shared_ptr<mathFunctions::FieldFunction>> initialization = {}, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> exactSolutions = {},
                 std::vector<std::shared_ptr<mathFunctions::FieldFunction>> absoluteTolerances = {}, std::vector<std::shared_ptr<mathFunctions::FieldFunction>> relativeTolerances = {},
-                bool verboseSourceCheck = {});
+                bool verboseSourceCheck = {}, bool persistentRHSVectors = {}, std::map<std::string, std::shared_ptr<io::interval::Interval>> rhsIntervals = {},
+                int nonFiniteCheckInterval = {}, bool concurrentRHSFunctions = {}, int ensembleSize = {});
 
     ~TimeStepper();
 
@@ -125,6 +223,14 @@ class TimeStepper : public std::enable_shared_from_this<TimeStepper>, private ut
 
     void Register(std::shared_ptr<ablate::solver::Solver> solver, std::vector<std::shared_ptr<monitors::Monitor>> = {});
 
+    /**
+     * Replaces the serializer and monitors of an initialized time stepper in place, keeping the domain, solvers, and solution.  This allows a run to be continued
+     * with new output without re-reading the mesh or re-initializing the solvers.  Solve can be called again after the ts options (e.g. final time) are updated.
+     * @param serializer the new serializer (may be null)
+     * @param monitors the new monitors for each solver id
+     */
+    void Reconfigure(std::shared_ptr<io::Serializer> serializer, std::map<std::string, std::vector<std::shared_ptr<monitors::Monitor>>> monitors = {});
+
     double GetTime() const;
 
     const std::string &GetName() const { return name; }
@@ -1,11 +1,75 @@
 #include "kokkosUtilities.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <exception>
+#include <petscsys.h>
+#include <vector>
 #include "environment/runEnvironment.hpp"
 
+namespace {
+//! the chunk being executed by this thread in ParallelForChunks
+thread_local std::size_t currentChunk = 0;
+}  // namespace
+
 void ablate::utilities::KokkosUtilities::Initialize() {
     if (!Kokkos::is_initialized()) {
-        Kokkos::initialize(*ablate::environment::RunEnvironment::GetArgCount(), *ablate::environment::RunEnvironment::GetArgs());
+        // a configured thread pool replaces the kokkos command line thread count
+        const auto& threadConfiguration = ablate::environment::RunEnvironment::ConfigureThreads();
+        if (threadConfiguration.threadsPerRank > 0) {
+            Kokkos::initialize(Kokkos::InitializationSettings().set_num_threads(threadConfiguration.threadsPerRank));
+        } else {
+            Kokkos::initialize(*ablate::environment::RunEnvironment::GetArgCount(), *ablate::environment::RunEnvironment::GetArgs());
+        }
 
         ablate::environment::RunEnvironment::RegisterCleanUpFunction("ablate::utilities::KokkosUtilities::Initialize", []() { Kokkos::finalize(); });
     }
 }
+
+std::size_t ablate::utilities::KokkosUtilities::GetHostConcurrency() {
+    Initialize();
+    return (std::size_t)std::max(Kokkos::DefaultHostExecutionSpace().concurrency(), 1);
+}
+
+void ablate::utilities::KokkosUtilities::ParallelForChunks(std::size_t size, const std::function<void(std::size_t, std::size_t, std::size_t)>& function) {
+    if (size == 0) {
+        return;
+    }
+
+    // split the range into contiguous chunks
+    const std::size_t chunks = std::min(GetHostConcurrency(), size);
+    const std::size_t chunkSize = (size + chunks - 1) / chunks;
+
+    // exceptions cannot leave the parallel region, so store them for each chunk
+    std::vector<std::exception_ptr> exceptions(chunks);
+
+    Kokkos::parallel_for(
+        "KokkosUtilities::ParallelForChunks", Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(0, chunks), [&](const std::size_t chunk) {
+            const std::size_t previousChunk = currentChunk;
+            currentChunk = chunk;
+            try {
+                const std::size_t start = chunk * chunkSize;
+                const std::size_t end = std::min(start + chunkSize, size);
+                function(start, end, chunk);
+            } catch (...) {
+                exceptions[chunk] = std::current_exception();
+            }
+            currentChunk = previousChunk;
+        });
+    Kokkos::fence();
+
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+std::size_t ablate::utilities::KokkosUtilities::GetCurrentChunk() { return currentChunk; }
+
+bool ablate::utilities::KokkosUtilities::PetscThreadSafe() {
+#if defined(PETSC_USE_DEBUG) && !defined(PETSC_HAVE_THREADSAFETY)
+    return false;
+#else
+    return true;
+#endif
+}
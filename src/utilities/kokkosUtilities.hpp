@@ -1,6 +1,9 @@
 #ifndef ABLATELIBRARY_KOKKOSUTILITIES_HPP
 #define ABLATELIBRARY_KOKKOSUTILITIES_HPP
 
+#include <cstddef>
+#include <functional>
+
 namespace ablate::utilities {
 
 class KokkosUtilities {
@@ -10,6 +13,33 @@ class KokkosUtilities {
      */
     static void Initialize();
 
+    /**
+     * The number of concurrent threads available in the kokkos host execution space
+     * @return
+     */
+    static std::size_t GetHostConcurrency();
+
+    /**
+     * Splits [0, size) into at most GetHostConcurrency() contiguous chunks and executes each chunk concurrently in the Kokkos host execution space.
+     * Exceptions cannot leave the parallel region, so the first exception thrown by any chunk is rethrown after all chunks complete.
+     * @param size the number of items
+     * @param function called with the [start, end) of the chunk and the chunk id
+     */
+    static void ParallelForChunks(std::size_t size, const std::function<void(std::size_t start, std::size_t end, std::size_t chunk)>& function);
+
+    /**
+     * The id of the ParallelForChunks chunk being executed by the calling thread.  The chunks are statically scheduled, so this is a stable index for the thread.
+     * @return the chunk id, or zero outside of ParallelForChunks
+     */
+    static std::size_t GetCurrentChunk();
+
+    /**
+     * Debug builds of PETSc without thread safety push every PETSc call (and PetscFunctionBeginUser) onto a single global stack, so PETSc can only be called
+     * from inside of ParallelForChunks when this returns true
+     * @return
+     */
+    static bool PetscThreadSafe();
+
    private:
     KokkosUtilities() = delete;
 };
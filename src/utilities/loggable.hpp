@@ -1,17 +1,49 @@
 #ifndef ABLATELIBRARY_LOGGABLE_HPP
 #define ABLATELIBRARY_LOGGABLE_HPP
 #include <petsc.h>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include "demangler.hpp"
 #include "petscError.hpp"
 
 namespace ablate::utilities {
+
+/**
+ * Keeps track of the name of every event registered by any Loggable so that the event performance can be reported at the end of a run
+ */
+class LoggableEvents {
+   public:
+    struct Event {
+        //! the demangled name of the class that registered the event
+        std::string className;
+        //! the petsc event name
+        std::string eventName;
+    };
+
+   private:
+    inline static std::vector<Event> events;
+
+   public:
+    static void Add(std::string className, std::string eventName) { events.push_back(Event{.className = std::move(className), .eventName = std::move(eventName)}); }
+
+    //! the events registered on this rank in the order they were registered
+    static const std::vector<Event>& Get() { return events; }
+};
+
 template <class T>
 class Loggable {
    private:
     inline static PetscClassId petscClassId = 0;
 
-    // Store a single depth active event
-    PetscLogEvent activeEvent = PETSC_DECIDE;
+    // the stack of active events, so events can be nested
+    std::vector<PetscLogEvent> activeEvents;
+
+    // the events registered by name for this class so that each is only registered once.  The transparent comparator allows lookup without a string copy
+    inline static std::map<std::string, PetscLogEvent, std::less<>> events;
 
    protected:
     Loggable() {
@@ -24,28 +56,54 @@ class Loggable {
     inline const PetscClassId& GetPetscClassId() const { return petscClassId; }
 
     inline PetscLogEvent RegisterEvent(const char* eventName) {
-        PetscLogEvent eventId;
-        PetscLogEventRegister(eventName, petscClassId, &eventId) >> checkError;
-        return eventId;
+        auto event = events.find(std::string_view(eventName));
+        if (event == events.end()) {
+            PetscLogEvent eventId;
+            PetscLogEventRegister(eventName, petscClassId, &eventId) >> checkError;
+            event = events.emplace(eventName, eventId).first;
+            LoggableEvents::Add(utilities::Demangler::Demangle(typeid(T).name()), eventName);
+        }
+        return event->second;
     }
 
     inline void StartEvent(const char* eventName) {
-        if (activeEvent == PETSC_DECIDE) {
-            PetscLogEventRegister(eventName, petscClassId, &activeEvent) >> checkError;
-            PetscLogEventBegin(activeEvent, 0, 0, 0, 0) >> checkError;
-        } else {
-            throw std::runtime_error("Cannot Start Event, an event is already active.");
-        }
+        activeEvents.push_back(RegisterEvent(eventName));
+        PetscLogEventBegin(activeEvents.back(), 0, 0, 0, 0) >> checkError;
     }
 
+    /**
+     * End the most recently started event
+     */
     inline void EndEvent() {
-        if (activeEvent > 0) {
-            PetscLogEventEnd(activeEvent, 0, 0, 0, 0);
-            activeEvent = PETSC_DECIDE;
+        if (!activeEvents.empty()) {
+            PetscLogEventEnd(activeEvents.back(), 0, 0, 0, 0);
+            activeEvents.pop_back();
         } else {
             throw std::runtime_error("Cannot End Event.  No active event.");
         }
     }
+
+    /**
+     * Logs an event for the lifetime of the object, i.e. auto scopedEvent = ScopeEvent("Name");
+     */
+    class ScopedEvent {
+       private:
+        const PetscLogEvent event;
+
+       public:
+        explicit ScopedEvent(PetscLogEvent event) : event(event) { PetscLogEventBegin(event, 0, 0, 0, 0) >> checkError; }
+        ~ScopedEvent() { PetscLogEventEnd(event, 0, 0, 0, 0); }
+
+        ScopedEvent(const ScopedEvent&) = delete;
+        ScopedEvent& operator=(const ScopedEvent&) = delete;
+    };
+
+    /**
+     * Start an event that ends when the returned object goes out of scope.  This is independent of the StartEvent/EndEvent stack.
+     * @param eventName
+     * @return
+     */
+    inline ScopedEvent ScopeEvent(const char* eventName) { return ScopedEvent(RegisterEvent(eventName)); }
 };
 };  // namespace ablate::utilities
 
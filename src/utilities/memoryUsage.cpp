@@ -0,0 +1,84 @@
+#include "memoryUsage.hpp"
+#include <algorithm>
+#include "petscError.hpp"
+
+void ablate::utilities::MemoryUsage::Add(const std::string& name, PetscLogDouble bytes) {
+    auto entry = std::find_if(entries.begin(), entries.end(), [&name](const auto& entry) { return entry.first == name; });
+    if (entry != entries.end()) {
+        entry->second += bytes;
+    } else {
+        entries.emplace_back(name, bytes);
+    }
+}
+
+PetscLogDouble ablate::utilities::MemoryUsage::VecBytes(Vec vec) {
+    if (!vec) {
+        return 0.0;
+    }
+    PetscInt localSize;
+    VecGetLocalSize(vec, &localSize) >> checkError;
+    return (PetscLogDouble)localSize * sizeof(PetscScalar);
+}
+
+PetscLogDouble ablate::utilities::MemoryUsage::SectionBytes(PetscSection section) {
+    if (!section) {
+        return 0.0;
+    }
+    PetscInt pStart, pEnd, numberFields;
+    PetscSectionGetChart(section, &pStart, &pEnd) >> checkError;
+    PetscSectionGetNumFields(section, &numberFields) >> checkError;
+
+    // each point stores a dof and offset for the section and each of its fields
+    return (PetscLogDouble)(pEnd - pStart) * 2 * sizeof(PetscInt) * (numberFields + 1);
+}
+
+PetscLogDouble ablate::utilities::MemoryUsage::DMBytes(DM dm) {
+    if (!dm) {
+        return 0.0;
+    }
+    PetscLogDouble bytes = 0.0;
+
+    // the plex topology stores the cone, cone orientation, and support of each point
+    PetscBool isPlex;
+    PetscObjectTypeCompare((PetscObject)dm, DMPLEX, &isPlex) >> checkError;
+    if (isPlex) {
+        PetscSection coneSection, supportSection;
+        PetscInt coneSize, supportSize;
+        DMPlexGetConeSection(dm, &coneSection) >> checkError;
+        DMPlexGetSupportSection(dm, &supportSection) >> checkError;
+        PetscSectionGetStorageSize(coneSection, &coneSize) >> checkError;
+        PetscSectionGetStorageSize(supportSection, &supportSize) >> checkError;
+        bytes += (PetscLogDouble)(2 * coneSize + supportSize) * sizeof(PetscInt) + SectionBytes(coneSection) + SectionBytes(supportSection);
+    }
+
+    Vec coordinates;
+    DMGetCoordinatesLocal(dm, &coordinates) >> checkError;
+    bytes += VecBytes(coordinates);
+
+    PetscSection localSection, globalSection;
+    DMGetLocalSection(dm, &localSection) >> checkError;
+    DMGetGlobalSection(dm, &globalSection) >> checkError;
+    bytes += SectionBytes(localSection) + SectionBytes(globalSection);
+    return bytes;
+}
+
+PetscLogDouble ablate::utilities::MemoryUsage::DMDataBytes(DM dm) {
+    if (!dm) {
+        return 0.0;
+    }
+    PetscSection localSection, globalSection;
+    PetscInt localSize, globalSize;
+    DMGetLocalSection(dm, &localSection) >> checkError;
+    DMGetGlobalSection(dm, &globalSection) >> checkError;
+    PetscSectionGetStorageSize(localSection, &localSize) >> checkError;
+    PetscSectionGetStorageSize(globalSection, &globalSize) >> checkError;
+    return SectionBytes(localSection) + SectionBytes(globalSection) + (PetscLogDouble)(localSize + globalSize) * sizeof(PetscScalar);
+}
+
+PetscLogDouble ablate::utilities::MemoryUsage::GetTotal() const {
+    PetscLogDouble total = 0.0;
+    for (const auto& [name, bytes] : entries) {
+        total += bytes;
+    }
+    return total;
+}
@@ -0,0 +1,87 @@
+#ifndef ABLATELIBRARY_MEMORYUSAGE_HPP
+#define ABLATELIBRARY_MEMORYUSAGE_HPP
+
+#include <petsc.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ablate::utilities {
+
+/**
+ * Accumulates the bytes owned by each subsystem (dm, fields, interpolant caches, chemistry views, radiation segments, particles) on this rank.  Entries
+ * are kept in the order they are added so the same entries line up on every rank when they are reduced.
+ */
+class MemoryUsage {
+   private:
+    //! the named entries in the order they were added
+    std::vector<std::pair<std::string, PetscLogDouble>> entries;
+
+   public:
+    /**
+     * Add bytes to an entry, entries with the same name are summed
+     * @param name
+     * @param bytes
+     */
+    void Add(const std::string& name, PetscLogDouble bytes);
+
+    /**
+     * Add the capacity of a std::vector to an entry
+     */
+    template <class T>
+    void Add(const std::string& name, const std::vector<T>& values) {
+        Add(name, (PetscLogDouble)(values.capacity() * sizeof(T)));
+    }
+
+    /**
+     * Add the capacity of a nested std::vector to an entry
+     */
+    template <class T>
+    void Add(const std::string& name, const std::vector<std::vector<T>>& values) {
+        PetscLogDouble bytes = (PetscLogDouble)(values.capacity() * sizeof(std::vector<T>));
+        for (const auto& value : values) {
+            bytes += (PetscLogDouble)(value.capacity() * sizeof(T));
+        }
+        Add(name, bytes);
+    }
+
+    /**
+     * Add the span of a Kokkos view (host or device) to an entry
+     */
+    template <class View>
+    void AddView(const std::string& name, const View& view) {
+        Add(name, (PetscLogDouble)(view.span() * sizeof(typename View::value_type)));
+    }
+
+    /**
+     * @return the local bytes in a vec (0 if the vec is null)
+     */
+    static PetscLogDouble VecBytes(Vec vec);
+
+    /**
+     * @return the bytes used to store the section (dof and offsets for each point and field)
+     */
+    static PetscLogDouble SectionBytes(PetscSection section);
+
+    /**
+     * @return the bytes used by the plex topology (cones, orientations, supports), the coordinates, and the local and global sections
+     */
+    static PetscLogDouble DMBytes(DM dm);
+
+    /**
+     * @return the bytes of the local and global sections of a dm that shares its topology (i.e. a gradient dm) and one local and global vector
+     */
+    static PetscLogDouble DMDataBytes(DM dm);
+
+    /**
+     * @return the entries on this rank
+     */
+    [[nodiscard]] const std::vector<std::pair<std::string, PetscLogDouble>>& GetEntries() const { return entries; }
+
+    /**
+     * @return the total bytes on this rank
+     */
+    [[nodiscard]] PetscLogDouble GetTotal() const;
+};
+}  // namespace ablate::utilities
+#endif  // ABLATELIBRARY_MEMORYUSAGE_HPP
@@ -1,13 +1,118 @@
 #include "petscUtilities.hpp"
+#include <algorithm>
+#include <cstdint>
 #include "environment/runEnvironment.hpp"
+#include "kokkosUtilities.hpp"
 #include "petscError.hpp"
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 void ablate::utilities::PetscUtilities::Initialize(const char help[]) {
+    // partition the cores before petsc or any thread pool reads the thread limits
+    ablate::environment::RunEnvironment::ConfigureThreads();
+
     PetscInitialize(ablate::environment::RunEnvironment::GetArgCount(), ablate::environment::RunEnvironment::GetArgs(), nullptr, help) >> checkError;
 
     // register the cleanup
     ablate::environment::RunEnvironment::RegisterCleanUpFunction("ablate::utilities::PetscUtilities::Initialize", []() { PetscFinalize() >> checkError; });
 }
+bool ablate::utilities::PetscUtilities::IsHostVec(Vec vec) {
+    PetscBool hostVec;
+    PetscObjectTypeCompareAny((PetscObject)vec, &hostVec, VECSEQ, VECMPI, VECSTANDARD, "") >> checkError;
+    return hostVec;
+}
+
+PetscErrorCode ablate::utilities::PetscUtilities::FirstTouch(Vec vec) {
+    PetscFunctionBeginUser;
+    PetscBool numaFirstTouch = PETSC_FALSE, hugePages = PETSC_FALSE;
+    PetscCall(PetscOptionsGetBool(nullptr, nullptr, "--numaFirstTouch", &numaFirstTouch, nullptr));
+    PetscCall(PetscOptionsGetBool(nullptr, nullptr, "--hugePages", &hugePages, nullptr));
+    if (!numaFirstTouch && !hugePages) {
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+    // only the host vec types own an array that can be replaced
+    PetscInt size;
+    PetscCall(VecGetLocalSize(vec, &size));
+    if (!IsHostVec(vec) || size == 0) {
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+    // the new storage is not touched until it is copied into below
+    PetscScalar* storage;
+    PetscCall(PetscMalloc1(size, &storage));
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (hugePages) {
+        // only the whole pages inside the storage can be advised
+        const auto pageSize = (std::uintptr_t)sysconf(_SC_PAGESIZE);
+        const auto begin = ((std::uintptr_t)storage + pageSize - 1) / pageSize * pageSize;
+        const auto end = (std::uintptr_t)(storage + size) / pageSize * pageSize;
+        if (end > begin) {
+            madvise((void*)begin, end - begin, MADV_HUGEPAGE);
+        }
+    }
+#endif
+
+    // copy the current values, each thread touches the pages of the chunk it will later compute
+    const PetscScalar* array;
+    PetscCall(VecGetArrayRead(vec, &array));
+    if (numaFirstTouch) {
+        KokkosUtilities::ParallelForChunks((std::size_t)size, [array, storage](std::size_t start, std::size_t end, std::size_t) { std::copy(array + start, array + end, storage + start); });
+    } else {
+        std::copy(array, array + size, storage);
+    }
+    PetscCall(VecRestoreArrayRead(vec, &array));
+
+    // the vec takes ownership of the storage and frees the original
+    PetscCall(VecReplaceArray(vec, storage));
+    PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode ablate::utilities::PetscUtilities::HasNonFiniteValue(Vec vec, PetscBool* nonFinite) {
+    PetscFunctionBeginUser;
+    // the norm of a nan/inf is not finite, so a device resident vec is checked on the device without a copy to the host
+    if (!IsHostVec(vec)) {
+        Vec localVec;
+        PetscReal norm;
+        PetscCall(VecCreateLocalVector(vec, &localVec));
+        PetscCall(VecGetLocalVectorRead(vec, localVec));
+        PetscCall(VecNorm(localVec, NORM_1, &norm));
+        PetscCall(VecRestoreLocalVectorRead(vec, localVec));
+        PetscCall(VecDestroy(&localVec));
+        *nonFinite = PetscIsInfOrNanReal(norm) ? PETSC_TRUE : PETSC_FALSE;
+        PetscFunctionReturn(PETSC_SUCCESS);
+    }
+
+    PetscInt size;
+    const PetscScalar* array;
+    PetscCall(VecGetLocalSize(vec, &size));
+    PetscCall(VecGetArrayRead(vec, &array));
+
+    // nan and inf times zero is nan, so a sum of the products flags any non finite value without a branch in the loop.  Independent partial sums let
+    // the compiler vectorize the loop without reordering a single floating point sum.
+    constexpr PetscInt lanes = 8;
+    PetscReal partial[lanes] = {0.0};
+    const PetscInt blockedSize = size - size % lanes;
+    for (PetscInt i = 0; i < blockedSize; i += lanes) {
+        for (PetscInt l = 0; l < lanes; ++l) {
+            partial[l] += PetscRealPart(array[i + l]) * 0.0;
+        }
+    }
+    PetscReal check = 0.0;
+    for (PetscInt i = blockedSize; i < size; ++i) {
+        check += PetscRealPart(array[i]) * 0.0;
+    }
+    for (PetscInt l = 0; l < lanes; ++l) {
+        check += partial[l];
+    }
+    *nonFinite = PetscIsInfOrNanReal(check) ? PETSC_TRUE : PETSC_FALSE;
+
+    PetscCall(VecRestoreArrayRead(vec, &array));
+    PetscFunctionReturn(0);
+}
+
 namespace ablate::utilities {
 
 std::istream& operator>>(std::istream& is, PetscDataType& v) {
@@ -11,6 +11,29 @@ class PetscUtilities {
      */
     static void Initialize(const char[] = nullptr);
 
+    /**
+     * Checks the local values of a vec for nan/inf with a single branch free pass that the compiler can vectorize.  No reduction is done so the result can
+     * be combined with other checks before a single reduction.  Device resident vecs are checked on the device with the local 1-norm.
+     * @param vec
+     * @param nonFinite set to true if any local value is nan/inf
+     */
+    static PetscErrorCode HasNonFiniteValue(Vec vec, PetscBool* nonFinite);
+
+    /**
+     * @param vec
+     * @return true if the vec is a host (seq/mpi) vec, false for device resident vec types (i.e. VECKOKKOS)
+     */
+    static bool IsHostVec(Vec vec);
+
+    /**
+     * Replaces the storage of a host (seq/mpi) vec with memory first touched by the Kokkos host threads in the same contiguous chunks used by
+     * KokkosUtilities::ParallelForChunks, so on multi-socket nodes each thread's part of the vec is placed in its own NUMA domain.  Enabled with the
+     * --numaFirstTouch command line option, --hugePages additionally requests transparent huge pages for the new storage.  The values are preserved and the
+     * vec is unchanged if neither option is set.
+     * @param vec
+     */
+    static PetscErrorCode FirstTouch(Vec vec);
+
    private:
     PetscUtilities() = delete;
 };
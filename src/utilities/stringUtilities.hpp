@@ -1,6 +1,9 @@
 #ifndef ABLATELIBRARY_STRINGUTILITIES_HPP
 #define ABLATELIBRARY_STRINGUTILITIES_HPP
 #include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
 #include <string>
 #include <string_view>
 
@@ -63,6 +66,22 @@ class StringUtilities {
      */
     static bool StartsWith(std::string_view str, std::string_view prefix) { return str.size() >= prefix.size() && 0 == str.compare(0, prefix.size(), prefix); }
 
+    /**
+     * 64 bit FNV-1a hash of the string as a 16 character hex string.  Unlike std::hash the value does not depend upon the compiler or standard library, so it
+     * can be used to name cache files shared between builds and hosts.
+     * @param str
+     * @return
+     */
+    static inline std::string Hash(std::string_view str) {
+        std::uint64_t hash = 1469598103934665603ULL;
+        for (const auto c : str) {
+            hash = (hash ^ (unsigned char)c) * 1099511628211ULL;
+        }
+        std::stringstream hashStream;
+        hashStream << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return hashStream.str();
+    }
+
    private:
     StringUtilities() = delete;
 };
@@ -0,0 +1,246 @@
+#include <petsc.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+#include "benchmarkUtilities.hpp"
+#include "boundarySolver/boundarySolver.hpp"
+#include "boundarySolver/lodi/openBoundary.hpp"
+#include "boundarySolver/physics/sublimation.hpp"
+#include "domain/boxMesh.hpp"
+#include "domain/modifiers/distributeWithGhostCells.hpp"
+#include "domain/modifiers/ghostBoundaryCells.hpp"
+#include "domain/modifiers/tagMeshBoundaryFaces.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/perfectGas.hpp"
+#include "eos/transport/constant.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "finiteVolume/fieldFunctions/compressibleFlowState.hpp"
+#include "finiteVolume/fieldFunctions/densityMassFractions.hpp"
+#include "finiteVolume/fieldFunctions/euler.hpp"
+#include "finiteVolume/fieldFunctions/massFractions.hpp"
+#include "mathFunctions/constantValue.hpp"
+#include "mathFunctions/fieldFunction.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+#include "solver/timeStepper.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+#include "utilities/petscUtilities.hpp"
+
+/**
+ * Standalone benchmark for the boundary solver.  A box mesh is built with ghost boundary cells on every boundary face.  The boundary cells on the lower and upper x faces use a lodi
+ * OpenBoundary and the remaining boundary cells use a Sublimation process.  The Setup, Initialize, PreRHSFunction, and ComputeRHSFunction of each boundary solver are timed separately on
+ * every rank.  The minimum, maximum, and mean time over the ranks are written as json so that the results can be tracked for regressions.
+ *
+ * options:
+ *  -benchmark_faces 20,20 the number of faces in each direction, the number of values sets the dimension (default 20,20)
+ *  -benchmark_iterations 10 the number of PreRHSFunction and ComputeRHSFunction calls (default 10)
+ *  -benchmark_merge_faces merge the faces of each boundary cell (default false)
+ *  -benchmark_output results.json the json output file (default is stdout)
+ */
+
+namespace {
+
+/**
+ * A boundary solver that records the time spent in Setup and Initialize, these are called by the domain so they cannot be timed directly
+ */
+class TimedBoundarySolver : public ablate::boundarySolver::BoundarySolver {
+   public:
+    double setupTime = 0.0;
+    double initializeTime = 0.0;
+
+    TimedBoundarySolver(std::string solverId, std::shared_ptr<ablate::domain::Region> region, std::shared_ptr<ablate::domain::Region> fieldBoundary,
+                        std::vector<std::shared_ptr<ablate::boundarySolver::BoundaryProcess>> boundaryProcesses, bool mergeFaces)
+        : BoundarySolver(std::move(solverId), std::move(region), std::move(fieldBoundary), std::move(boundaryProcesses), nullptr, mergeFaces) {}
+
+    void Setup() override {
+        MPI_Barrier(GetSubDomain().GetComm()) >> ablate::checkMpiError;
+        const double start = MPI_Wtime();
+        BoundarySolver::Setup();
+        setupTime = MPI_Wtime() - start;
+    }
+
+    void Initialize() override {
+        MPI_Barrier(GetSubDomain().GetComm()) >> ablate::checkMpiError;
+        const double start = MPI_Wtime();
+        BoundarySolver::Initialize();
+        initializeTime = MPI_Wtime() - start;
+    }
+};
+
+/**
+ * Split the ghost boundary cells into the open boundary cells (lower and upper x faces) and the sublimation cells (every other face)
+ */
+class LabelBoundaryCells : public ablate::domain::modifiers::Modifier {
+   private:
+    const std::string openLabelName;
+    const std::string sublimationLabelName;
+    const PetscReal lowerX;
+    const PetscReal upperX;
+    const PetscReal tolerance;
+
+   public:
+    LabelBoundaryCells(std::string openLabelName, std::string sublimationLabelName, PetscReal lowerX, PetscReal upperX, PetscReal tolerance)
+        : openLabelName(std::move(openLabelName)), sublimationLabelName(std::move(sublimationLabelName)), lowerX(lowerX), upperX(upperX), tolerance(tolerance) {}
+
+    void Modify(DM& dm) override {
+        DMCreateLabel(dm, openLabelName.c_str()) >> ablate::checkError;
+        DMCreateLabel(dm, sublimationLabelName.c_str()) >> ablate::checkError;
+
+        // each ghost cell is only connected to its boundary face
+        PetscInt gStart, gEnd;
+        DMPlexGetGhostCellStratum(dm, &gStart, &gEnd) >> ablate::checkError;
+        for (PetscInt c = gStart; c < gEnd; ++c) {
+            const PetscInt* cone;
+            DMPlexGetCone(dm, c, &cone) >> ablate::checkError;
+            PetscReal centroid[3];
+            DMPlexComputeCellGeometryFVM(dm, cone[0], nullptr, centroid, nullptr) >> ablate::checkError;
+
+            const bool open = PetscAbsReal(centroid[0] - lowerX) < tolerance || PetscAbsReal(centroid[0] - upperX) < tolerance;
+            DMSetLabelValue(dm, open ? openLabelName.c_str() : sublimationLabelName.c_str(), c, 1) >> ablate::checkError;
+        }
+    }
+
+    [[nodiscard]] std::string ToString() const override { return "LabelBoundaryCells"; }
+};
+
+}  // namespace
+
+int main(int argc, char** args) {
+    // initialize petsc and mpi
+    ablate::environment::RunEnvironment::Initialize(&argc, &args);
+    ablate::utilities::PetscUtilities::Initialize();
+
+    {
+        // read the benchmark options
+        PetscInt faces[3] = {20, 20, 20};
+        PetscInt dim = 3;
+        PetscBool facesSet = PETSC_FALSE;
+        PetscOptionsGetIntArray(nullptr, nullptr, "-benchmark_faces", faces, &dim, &facesSet) >> ablate::checkError;
+        dim = facesSet ? dim : 2;
+        PetscInt iterations = 10;
+        PetscOptionsGetInt(nullptr, nullptr, "-benchmark_iterations", &iterations, nullptr) >> ablate::checkError;
+        PetscBool mergeFaces = PETSC_FALSE;
+        PetscOptionsGetBool(nullptr, nullptr, "-benchmark_merge_faces", &mergeFaces, nullptr) >> ablate::checkError;
+        char outputFile[PETSC_MAX_PATH_LEN] = "";
+        PetscBool outputSet = PETSC_FALSE;
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_output", outputFile, PETSC_MAX_PATH_LEN, &outputSet) >> ablate::checkError;
+        if (dim < 2 || dim > 3 || iterations < 1) {
+            throw std::invalid_argument("The -benchmark_faces must have 2 or 3 values and -benchmark_iterations must be positive");
+        }
+
+        // the boundary faces are tagged and a ghost cell is added to each one
+        auto boundaryFaceRegion = std::make_shared<ablate::domain::Region>("boundaryFaces");
+        auto openBoundaryRegion = std::make_shared<ablate::domain::Region>("openBoundaryCells");
+        auto sublimationRegion = std::make_shared<ablate::domain::Region>("sublimationCells");
+        const PetscReal lower = 0.0;
+        const PetscReal upper = 1.0;
+        auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}, {"Rgas", "287.0"}}),
+                                                             std::vector<std::string>{"N2", "H2O"});
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptors = {std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)};
+        auto domain = std::make_shared<ablate::domain::BoxMesh>(
+            "benchmarkMesh",
+            fieldDescriptors,
+            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{
+                std::make_shared<ablate::domain::modifiers::DistributeWithGhostCells>(),
+                std::make_shared<ablate::domain::modifiers::TagMeshBoundaryFaces>(boundaryFaceRegion),
+                std::make_shared<ablate::domain::modifiers::GhostBoundaryCells>(boundaryFaceRegion->GetName()),
+                std::make_shared<LabelBoundaryCells>(openBoundaryRegion->GetName(), sublimationRegion->GetName(), lower, upper, 0.5 * (upper - lower) / (PetscReal)faces[0])},
+            std::vector<int>(faces, faces + dim),
+            std::vector<double>(dim, lower),
+            std::vector<double>(dim, upper),
+            std::vector<std::string>(dim, "NONE"),
+            false);
+
+        // the flow is initialized to a uniform state
+        auto massFractions = std::make_shared<ablate::finiteVolume::fieldFunctions::MassFractions>(
+            eos,
+            std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>>{
+                std::make_shared<ablate::mathFunctions::FieldFunction>("N2", std::make_shared<ablate::mathFunctions::ConstantValue>(0.8)),
+                std::make_shared<ablate::mathFunctions::FieldFunction>("H2O", std::make_shared<ablate::mathFunctions::ConstantValue>(0.2))});
+        auto flowState = std::make_shared<ablate::finiteVolume::fieldFunctions::CompressibleFlowState>(eos,
+                                                                                                         std::make_shared<ablate::mathFunctions::ConstantValue>(300.0),
+                                                                                                         std::make_shared<ablate::mathFunctions::ConstantValue>(101325.0),
+                                                                                                         ablate::mathFunctions::Create(dim == 2 ? "10.0, 0.0" : "10.0, 0.0, 0.0"),
+                                                                                                         massFractions);
+        std::vector<std::shared_ptr<ablate::mathFunctions::FieldFunction>> initialization = {std::make_shared<ablate::finiteVolume::fieldFunctions::Euler>(flowState),
+                                                                                             std::make_shared<ablate::finiteVolume::fieldFunctions::DensityMassFractions>(flowState)};
+
+        // create a boundary solver for each process
+        auto transportModel = std::make_shared<ablate::eos::transport::Constant>(0.2, 0.1, 1E-4);
+        auto sublimationSolver = std::make_shared<TimedBoundarySolver>(
+            "sublimation",
+            sublimationRegion,
+            boundaryFaceRegion,
+            std::vector<std::shared_ptr<ablate::boundarySolver::BoundaryProcess>>{std::make_shared<ablate::boundarySolver::physics::Sublimation>(1E6, transportModel, eos, massFractions)},
+            mergeFaces);
+        auto openBoundarySolver = std::make_shared<TimedBoundarySolver>(
+            "openBoundary",
+            openBoundaryRegion,
+            boundaryFaceRegion,
+            std::vector<std::shared_ptr<ablate::boundarySolver::BoundaryProcess>>{std::make_shared<ablate::boundarySolver::lodi::OpenBoundary>(eos, 0.0, 101325.0, 1.0)},
+            mergeFaces);
+        std::vector<std::shared_ptr<TimedBoundarySolver>> boundarySolvers = {sublimationSolver, openBoundarySolver};
+
+        // the time stepper is only used to set up the subdomains and provide the ts
+        ablate::solver::TimeStepper timeStepper("benchmark", domain, ablate::parameters::MapParameters::Create({{"ts_max_steps", "0"}}), {}, initialization);
+        for (auto& boundarySolver : boundarySolvers) {
+            timeStepper.Register(boundarySolver);
+        }
+        timeStepper.Initialize();
+        const MPI_Comm comm = PetscObjectComm((PetscObject)domain->GetDM());
+
+        // fill the local solution vector once, the same state is used for every call
+        DM dm = domain->GetDM();
+        Vec locX, locF;
+        DMGetLocalVector(dm, &locX) >> ablate::checkError;
+        DMGetLocalVector(dm, &locF) >> ablate::checkError;
+        DMGlobalToLocal(dm, domain->GetSolutionVector(), INSERT_VALUES, locX) >> ablate::checkError;
+
+        // time each phase of each boundary solver
+        nlohmann::json solverResults;
+        for (auto& boundarySolver : boundarySolvers) {
+            double preRHSFunctionTime = 0.0;
+            double computeRHSFunctionTime = 0.0;
+            for (PetscInt i = 0; i < iterations; ++i) {
+                preRHSFunctionTime += testingResources::BenchmarkUtilities::TimePhase(comm, [&]() { boundarySolver->PreRHSFunction(timeStepper.GetTS(), 0.0, i == 0, locX) >> ablate::checkError; });
+                VecZeroEntries(locF) >> ablate::checkError;
+                computeRHSFunctionTime += testingResources::BenchmarkUtilities::TimePhase(comm, [&]() { boundarySolver->ComputeRHSFunction(0.0, locX, locF) >> ablate::checkError; });
+            }
+
+            PetscInt localFaces = (PetscInt)boundarySolver->GetBoundaryGeometry().size();
+            PetscInt globalFaces = 0;
+            MPI_Allreduce(&localFaces, &globalFaces, 1, MPIU_INT, MPI_SUM, comm) >> ablate::checkMpiError;
+
+            solverResults[boundarySolver->GetSolverId()] = {{"faces", globalFaces},
+                                                            {"phases",
+                                                             {{"setup", testingResources::BenchmarkUtilities::PhaseStatistics(comm, boundarySolver->setupTime, 1)},
+                                                              {"initialize", testingResources::BenchmarkUtilities::PhaseStatistics(comm, boundarySolver->initializeTime, 1)},
+                                                              {"preRHSFunction", testingResources::BenchmarkUtilities::PhaseStatistics(comm, preRHSFunctionTime, iterations)},
+                                                              {"computeRHSFunction", testingResources::BenchmarkUtilities::PhaseStatistics(comm, computeRHSFunctionTime, iterations)}}}};
+        }
+        DMRestoreLocalVector(dm, &locX) >> ablate::checkError;
+        DMRestoreLocalVector(dm, &locF) >> ablate::checkError;
+
+        // gather the problem size
+        PetscInt globalCells = 1;
+        for (PetscInt d = 0; d < dim; ++d) {
+            globalCells *= faces[d];
+        }
+        PetscMPIInt size;
+        MPI_Comm_size(comm, &size) >> ablate::checkMpiError;
+
+        nlohmann::json results = {{"benchmark", "boundarySolver"},
+                                  {"ranks", size},
+                                  {"dimensions", dim},
+                                  {"faces", std::vector<PetscInt>(faces, faces + dim)},
+                                  {"cells", globalCells},
+                                  {"mergeFaces", (bool)mergeFaces},
+                                  {"solvers", solverResults}};
+        testingResources::BenchmarkUtilities::WriteResults(comm, results, outputSet ? outputFile : "");
+    }
+
+    ablate::environment::RunEnvironment::Finalize();
+    return 0;
+}
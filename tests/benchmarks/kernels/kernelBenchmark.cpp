@@ -0,0 +1,312 @@
+#include <petsc.h>
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "benchmarkUtilities.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/perfectGas.hpp"
+#include "eos/stiffenedGas.hpp"
+#include "eos/tChem.hpp"
+#include "finiteVolume/fluxCalculator/adaptiveFlux.hpp"
+#include "finiteVolume/fluxCalculator/ausm.hpp"
+#include "finiteVolume/fluxCalculator/ausmpUp.hpp"
+#include "finiteVolume/fluxCalculator/averageFlux.hpp"
+#include "finiteVolume/fluxCalculator/hllcStiff.hpp"
+#include "finiteVolume/fluxCalculator/offFlux.hpp"
+#include "finiteVolume/fluxCalculator/rieman.hpp"
+#include "finiteVolume/fluxCalculator/riemann2Gas.hpp"
+#include "finiteVolume/fluxCalculator/riemannStiff.hpp"
+#include "mathFunctions/constantValue.hpp"
+#include "mathFunctions/formula.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "mathFunctions/geom/surface.hpp"
+#include "mathFunctions/linearTable.hpp"
+#include "parameters/mapParameters.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+#include "utilities/petscUtilities.hpp"
+
+/**
+ * Standalone micro benchmark for the hot kernels: math function evaluation (Formula, LinearTable, Surface), the equation of state thermodynamic functions
+ * (PerfectGas, StiffenedGas, TChem), and every flux calculator.  Each kernel is evaluated over a set of points and the time per point is written as json.
+ * When a baseline (a previous json output) is provided, any kernel slower than the baseline by more than the tolerance is reported and the benchmark returns
+ * a non zero exit code so that it can be used to catch regressions in CI.
+ *
+ * options:
+ *  -benchmark_points 10000 the number of points evaluated by each kernel call (default 10000)
+ *  -benchmark_iterations 10 the number of timed calls of each kernel (default 10)
+ *  -benchmark_kernels formula,ausm only run the kernels whose name contains one of the values (default all)
+ *  -benchmark_surface path/to/geometry.stp the geometry used for the surface kernel (default the surface kernel is skipped)
+ *  -benchmark_tchem path/to/mechanism.yaml the mechanism used for the tChem kernels (default the tChem kernels are skipped)
+ *  -benchmark_baseline baseline.json the json output from a previous run to compare against (default no comparison)
+ *  -benchmark_tolerance 0.25 the allowed relative increase in the mean time per point over the baseline (default 0.25)
+ *  -benchmark_output results.json the json output file (default is stdout)
+ */
+
+namespace {
+
+/**
+ * A named kernel that evaluates every point once per call
+ */
+struct Kernel {
+    std::string name;
+    std::function<void()> function;
+};
+
+/**
+ * Add the scalar and batch thermodynamic function kernels for each property of the eos.  The conserved values are computed from the temperature and
+ * pressure at each point.
+ */
+void AddEosKernels(std::vector<Kernel>& kernels, const std::string& name, const std::shared_ptr<ablate::eos::EOS>& eos, PetscInt numberPoints) {
+    // the fields are stored as euler followed by densityYi
+    const auto numberSpecies = (PetscInt)eos->GetSpeciesVariables().size();
+    std::vector<ablate::domain::Field> fields = {ablate::domain::Field{.name = "euler", .numberComponents = 5, .offset = 0}};
+    if (numberSpecies) {
+        fields.push_back(ablate::domain::Field{.name = "densityYi", .numberComponents = numberSpecies, .offset = 5});
+    }
+    const PetscInt stride = 5 + numberSpecies;
+
+    // fill the conserved values with a range of states, each species has the same mass fraction
+    auto conserved = std::make_shared<std::vector<PetscReal>>(numberPoints * stride);
+    auto temperature = std::make_shared<std::vector<PetscReal>>(numberPoints);
+    auto eulerFunction = eos->GetFieldFunctionFunction("euler", ablate::eos::ThermodynamicProperty::Temperature, ablate::eos::ThermodynamicProperty::Pressure);
+    auto densityYiFunction =
+        numberSpecies ? eos->GetFieldFunctionFunction("densityYi", ablate::eos::ThermodynamicProperty::Temperature, ablate::eos::ThermodynamicProperty::Pressure) : ablate::eos::FieldFunction{};
+    std::vector<PetscReal> yi(numberSpecies, numberSpecies ? 1.0 / (PetscReal)numberSpecies : 0.0);
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        const PetscReal pointTemperature = 300.0 + 1500.0 * (PetscReal)p / (PetscReal)numberPoints;
+        const PetscReal velocity[3] = {10.0, -5.0, 2.0};
+        (*temperature)[p] = pointTemperature;
+        eulerFunction(pointTemperature, 101325.0, 3, velocity, yi.data(), conserved->data() + p * stride);
+        if (numberSpecies) {
+            densityYiFunction(pointTemperature, 101325.0, 3, velocity, yi.data(), conserved->data() + p * stride + 5);
+        }
+    }
+
+    const std::vector<std::pair<std::string, ablate::eos::ThermodynamicProperty>> properties = {{"Temperature", ablate::eos::ThermodynamicProperty::Temperature},
+                                                                                                {"Pressure", ablate::eos::ThermodynamicProperty::Pressure},
+                                                                                                {"SpeedOfSound", ablate::eos::ThermodynamicProperty::SpeedOfSound},
+                                                                                                {"InternalSensibleEnergy", ablate::eos::ThermodynamicProperty::InternalSensibleEnergy},
+                                                                                                {"SpecificHeatConstantPressure", ablate::eos::ThermodynamicProperty::SpecificHeatConstantPressure}};
+    auto property = std::make_shared<std::vector<PetscReal>>(numberPoints);
+    for (const auto& [propertyName, thermodynamicProperty] : properties) {
+        auto function = eos->GetThermodynamicFunction(thermodynamicProperty, fields);
+        kernels.push_back(Kernel{name + propertyName, [function, conserved, property, numberPoints, stride]() {
+                                     for (PetscInt p = 0; p < numberPoints; ++p) {
+                                         function.function(conserved->data() + p * stride, property->data() + p, function.context.get()) >> ablate::checkError;
+                                     }
+                                 }});
+
+        auto batchFunction = eos->GetThermodynamicBatchFunction(thermodynamicProperty, fields);
+        kernels.push_back(Kernel{name + propertyName + "Batch", [batchFunction, conserved, property, numberPoints, stride]() {
+                                     batchFunction.function(numberPoints, conserved->data(), stride, property->data(), 1, batchFunction.context.get()) >> ablate::checkError;
+                                 }});
+
+        // the temperature functions reuse a known temperature
+        if (thermodynamicProperty != ablate::eos::ThermodynamicProperty::Temperature) {
+            auto temperatureFunction = eos->GetThermodynamicTemperatureFunction(thermodynamicProperty, fields);
+            kernels.push_back(Kernel{name + propertyName + "FromTemperature", [temperatureFunction, conserved, temperature, property, numberPoints, stride]() {
+                                         for (PetscInt p = 0; p < numberPoints; ++p) {
+                                             temperatureFunction.function(conserved->data() + p * stride, (*temperature)[p], property->data() + p, temperatureFunction.context.get()) >>
+                                                 ablate::checkError;
+                                         }
+                                     }});
+        }
+    }
+}
+
+/**
+ * Add the kernel for a flux calculator.  The left and right states cover subsonic and supersonic flow in both directions.
+ */
+void AddFluxKernels(std::vector<Kernel>& kernels, const std::string& name, const std::shared_ptr<ablate::finiteVolume::fluxCalculator::FluxCalculator>& fluxCalculator,
+                    PetscInt numberPoints) {
+    struct States {
+        std::vector<PetscReal> uL, aL, rhoL, pL, uR, aR, rhoR, pR, massFlux, p12;
+    };
+    auto states = std::make_shared<States>();
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        const PetscReal fraction = (PetscReal)p / (PetscReal)numberPoints;
+        states->uL.push_back(-600.0 + 1200.0 * fraction);
+        states->aL.push_back(347.0);
+        states->rhoL.push_back(1.2 + 0.5 * fraction);
+        states->pL.push_back(101325.0 * (1.0 + fraction));
+        states->uR.push_back(600.0 - 1200.0 * fraction);
+        states->aR.push_back(330.0);
+        states->rhoR.push_back(1.0);
+        states->pR.push_back(101325.0);
+    }
+    states->massFlux.resize(numberPoints);
+    states->p12.resize(numberPoints);
+
+    auto function = fluxCalculator->GetFluxCalculatorFunction();
+    auto context = fluxCalculator->GetFluxCalculatorContext();
+    kernels.push_back(Kernel{name, [function, context, states, numberPoints]() {
+                                 auto& s = *states;
+                                 for (PetscInt p = 0; p < numberPoints; ++p) {
+                                     function(context, s.uL[p], s.aL[p], s.rhoL[p], s.pL[p], s.uR[p], s.aR[p], s.rhoR[p], s.pR[p], &s.massFlux[p], &s.p12[p]);
+                                 }
+                             }});
+}
+
+/**
+ * Add the point by point and batch kernels for a math function
+ */
+void AddMathFunctionKernels(std::vector<Kernel>& kernels, const std::string& name, const std::shared_ptr<ablate::mathFunctions::MathFunction>& function, PetscInt numberPoints) {
+    auto xyz = std::make_shared<std::vector<PetscReal>>(numberPoints * 3);
+    for (PetscInt p = 0; p < numberPoints; ++p) {
+        const PetscReal fraction = (PetscReal)p / (PetscReal)numberPoints;
+        (*xyz)[p * 3 + 0] = fraction;
+        (*xyz)[p * 3 + 1] = 1.0 - fraction;
+        (*xyz)[p * 3 + 2] = 0.5 * fraction;
+    }
+    auto result = std::make_shared<std::vector<PetscReal>>(numberPoints);
+
+    kernels.push_back(Kernel{name, [function, xyz, result, numberPoints]() {
+                                 for (PetscInt p = 0; p < numberPoints; ++p) {
+                                     (*result)[p] = function->Eval(xyz->data() + p * 3, 3, 0.1);
+                                 }
+                             }});
+    kernels.push_back(Kernel{name + "Batch", [function, xyz, result, numberPoints]() { function->EvalBatch(xyz->data(), numberPoints, 3, 0.1, result->data(), 1, 1); }});
+}
+
+}  // namespace
+
+int main(int argc, char** args) {
+    // initialize petsc and mpi
+    ablate::environment::RunEnvironment::Initialize(&argc, &args);
+    ablate::utilities::PetscUtilities::Initialize();
+
+    int exitCode = 0;
+    {
+        // read the benchmark options
+        PetscInt numberPoints = 10000;
+        PetscOptionsGetInt(nullptr, nullptr, "-benchmark_points", &numberPoints, nullptr) >> ablate::checkError;
+        PetscInt iterations = 10;
+        PetscOptionsGetInt(nullptr, nullptr, "-benchmark_iterations", &iterations, nullptr) >> ablate::checkError;
+        char kernelFilter[PETSC_MAX_PATH_LEN] = "";
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_kernels", kernelFilter, PETSC_MAX_PATH_LEN, nullptr) >> ablate::checkError;
+        char surfaceFile[PETSC_MAX_PATH_LEN] = "";
+        PetscBool surfaceSet = PETSC_FALSE;
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_surface", surfaceFile, PETSC_MAX_PATH_LEN, &surfaceSet) >> ablate::checkError;
+        char tChemFile[PETSC_MAX_PATH_LEN] = "";
+        PetscBool tChemSet = PETSC_FALSE;
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_tchem", tChemFile, PETSC_MAX_PATH_LEN, &tChemSet) >> ablate::checkError;
+        char baselineFile[PETSC_MAX_PATH_LEN] = "";
+        PetscBool baselineSet = PETSC_FALSE;
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_baseline", baselineFile, PETSC_MAX_PATH_LEN, &baselineSet) >> ablate::checkError;
+        PetscReal tolerance = 0.25;
+        PetscOptionsGetReal(nullptr, nullptr, "-benchmark_tolerance", &tolerance, nullptr) >> ablate::checkError;
+        char outputFile[PETSC_MAX_PATH_LEN] = "";
+        PetscBool outputSet = PETSC_FALSE;
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_output", outputFile, PETSC_MAX_PATH_LEN, &outputSet) >> ablate::checkError;
+        if (numberPoints < 1 || iterations < 1) {
+            throw std::invalid_argument("The -benchmark_points and -benchmark_iterations must be positive");
+        }
+
+        // build the list of kernels
+        std::vector<Kernel> kernels;
+        const std::map<std::string, std::shared_ptr<ablate::mathFunctions::MathFunction>> nestedFunctions = {{"a", ablate::mathFunctions::Create("x*x")}};
+        AddMathFunctionKernels(kernels, "formula", std::make_shared<ablate::mathFunctions::Formula>("x*y + sin(z)*t + a", nestedFunctions), numberPoints);
+
+        std::stringstream tableStream;
+        tableStream << "x,value\n";
+        for (int i = 0; i <= 1000; ++i) {
+            tableStream << i / 1000.0 << "," << i * i << "\n";
+        }
+        AddMathFunctionKernels(
+            kernels, "linearTable", std::make_shared<ablate::mathFunctions::LinearTable>(tableStream, "x", std::vector<std::string>{"value"}, ablate::mathFunctions::Create("x")), numberPoints);
+
+        if (surfaceSet) {
+            AddMathFunctionKernels(kernels,
+                                   "surface",
+                                   std::make_shared<ablate::mathFunctions::geom::Surface>(
+                                       surfaceFile, std::make_shared<ablate::mathFunctions::ConstantValue>(1.0), std::make_shared<ablate::mathFunctions::ConstantValue>(0.0)),
+                                   numberPoints);
+        }
+
+        auto perfectGas = std::make_shared<ablate::eos::PerfectGas>(ablate::parameters::MapParameters::Create({{"gamma", "1.4"}, {"Rgas", "287.0"}}));
+        auto stiffenedGas = std::make_shared<ablate::eos::StiffenedGas>(ablate::parameters::MapParameters::Create({{"gamma", "1.932"}, {"Cp", "8095.08"}, {"p0", "1.1645e9"}}));
+        AddEosKernels(kernels, "perfectGas", perfectGas, numberPoints);
+        AddEosKernels(kernels, "stiffenedGas", stiffenedGas, numberPoints);
+        if (tChemSet) {
+            AddEosKernels(kernels, "tChem", std::make_shared<ablate::eos::TChem>(tChemFile), numberPoints);
+        }
+
+        using namespace ablate::finiteVolume::fluxCalculator;
+        AddFluxKernels(kernels, "ausm", std::make_shared<Ausm>(), numberPoints);
+        AddFluxKernels(kernels, "ausmpUp", std::make_shared<AusmpUp>(0.0), numberPoints);
+        AddFluxKernels(kernels, "averageFlux", std::make_shared<AverageFlux>(), numberPoints);
+        AddFluxKernels(kernels, "offFlux", std::make_shared<OffFlux>(), numberPoints);
+        AddFluxKernels(kernels, "rieman", std::make_shared<Rieman>(perfectGas), numberPoints);
+        AddFluxKernels(kernels, "riemann2Gas", std::make_shared<Riemann2Gas>(perfectGas, perfectGas), numberPoints);
+        AddFluxKernels(kernels, "riemannStiff", std::make_shared<RiemannStiff>(perfectGas, perfectGas), numberPoints);
+        AddFluxKernels(kernels, "hllcStiff", std::make_shared<HllcStiff>(perfectGas, perfectGas), numberPoints);
+        AddFluxKernels(kernels, "adaptiveFlux", std::make_shared<AdaptiveFlux>(std::make_shared<Ausm>(), std::make_shared<Rieman>(perfectGas), 2.0), numberPoints);
+
+        // only run the requested kernels
+        std::vector<std::string> filters;
+        std::stringstream filterStream(kernelFilter);
+        for (std::string filter; std::getline(filterStream, filter, ',');) {
+            if (!filter.empty()) {
+                filters.push_back(filter);
+            }
+        }
+
+        // time each kernel after a single warm up call
+        const MPI_Comm comm = PETSC_COMM_WORLD;
+        nlohmann::json kernelResults;
+        for (const auto& kernel : kernels) {
+            if (!filters.empty() && std::none_of(filters.begin(), filters.end(), [&kernel](const auto& filter) { return kernel.name.find(filter) != std::string::npos; })) {
+                continue;
+            }
+            kernel.function();
+            double kernelTime = 0.0;
+            for (PetscInt i = 0; i < iterations; ++i) {
+                kernelTime += testingResources::BenchmarkUtilities::TimePhase(comm, kernel.function);
+            }
+            kernelResults[kernel.name] = testingResources::BenchmarkUtilities::PhaseStatistics(comm, kernelTime, iterations, numberPoints);
+        }
+
+        PetscMPIInt rank, size;
+        MPI_Comm_rank(comm, &rank) >> ablate::checkMpiError;
+        MPI_Comm_size(comm, &size) >> ablate::checkMpiError;
+        nlohmann::json results = {{"benchmark", "kernels"}, {"ranks", size}, {"points", numberPoints}, {"iterations", iterations}, {"kernels", kernelResults}};
+
+        // compare the mean time per point against the baseline
+        if (baselineSet) {
+            std::ifstream baselineStream(baselineFile);
+            if (!baselineStream) {
+                throw std::invalid_argument("Cannot open the -benchmark_baseline " + std::string(baselineFile));
+            }
+            const auto baseline = nlohmann::json::parse(baselineStream);
+            nlohmann::json regressions = nlohmann::json::object();
+            for (const auto& [kernelName, kernelResult] : kernelResults.items()) {
+                if (!baseline.contains("kernels") || !baseline["kernels"].contains(kernelName)) {
+                    continue;
+                }
+                const double baselineMean = baseline["kernels"][kernelName]["mean"];
+                const double mean = kernelResult["mean"];
+                if (mean > baselineMean * (1.0 + tolerance)) {
+                    regressions[kernelName] = {{"baseline", baselineMean}, {"mean", mean}, {"ratio", mean / baselineMean}};
+                }
+            }
+            results["tolerance"] = tolerance;
+            results["regressions"] = regressions;
+            exitCode = regressions.empty() ? 0 : 1;
+        }
+
+        testingResources::BenchmarkUtilities::WriteResults(comm, results, outputSet ? outputFile : "");
+        if (rank == 0 && exitCode) {
+            std::cerr << "Kernel performance regressions over the baseline: " << results["regressions"].dump(4) << std::endl;
+        }
+    }
+
+    ablate::environment::RunEnvironment::Finalize();
+    return exitCode;
+}
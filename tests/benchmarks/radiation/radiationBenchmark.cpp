@@ -0,0 +1,217 @@
+#include <petsc.h>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+#include "benchmarkUtilities.hpp"
+#include "domain/boxMesh.hpp"
+#include "environment/runEnvironment.hpp"
+#include "eos/perfectGas.hpp"
+#include "eos/radiationProperties/constant.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "mathFunctions/constantValue.hpp"
+#include "mathFunctions/fieldFunction.hpp"
+#include "mathFunctions/functionFactory.hpp"
+#include "parameters/mapParameters.hpp"
+#include "radiation/p1Radiation.hpp"
+#include "radiation/radiation.hpp"
+#include "radiation/raySharingRadiation.hpp"
+#include "radiation/surfaceRadiation.hpp"
+#include "solver/cellSolver.hpp"
+#include "solver/dynamicRange.hpp"
+#include "solver/timeStepper.hpp"
+#include "utilities/mpiError.hpp"
+#include "utilities/petscError.hpp"
+#include "utilities/petscUtilities.hpp"
+
+/**
+ * Standalone benchmark for the radiation solvers.  A box mesh is built and the Setup, Initialize, EvaluateGains, and Solve of the selected radiation solver are timed separately on every
+ * rank.  The minimum, maximum, and mean time over the ranks are written as json so that the results can be tracked for regressions and strong/weak scaling.
+ *
+ * options:
+ *  -benchmark_solver radiation|raySharing|surface|p1 (default radiation)
+ *  -benchmark_faces 20,20 the number of faces in each direction, the number of values sets the dimension (default 20,20)
+ *  -benchmark_rays 10 the number of rays (default 10)
+ *  -benchmark_iterations 5 the number of EvaluateGains and Solve calls (default 5)
+ *  -benchmark_absorptivity 1.0 the constant absorptivity (default 1.0)
+ *  -benchmark_temperature "1000 + 1000*exp(-10*(x*x + y*y + z*z))" the temperature field (default is a hot core)
+ *  -benchmark_batch_properties compute the cell properties in a batch (default false)
+ *  -benchmark_output results.json the json output file (default is stdout)
+ */
+
+namespace {
+
+/**
+ * An empty cell solver used to build the subdomain and fields used by the radiation solver
+ */
+class BenchmarkSolver : public ablate::solver::CellSolver {
+   public:
+    explicit BenchmarkSolver(std::string solverId) : CellSolver(std::move(solverId)) {}
+    void Initialize() override {}
+};
+
+/**
+ * Label every cell that is not in the first layer of cells in x so that the faces between the first and second layer can be used as surface origins
+ */
+void CreateSurfaceRegion(DM dm, const std::string& labelName, PetscReal lowerX, PetscReal dx) {
+    DMCreateLabel(dm, labelName.c_str()) >> ablate::checkError;
+    PetscInt cStart, cEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> ablate::checkError;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscReal centroid[3];
+        DMPlexComputeCellGeometryFVM(dm, c, nullptr, centroid, nullptr) >> ablate::checkError;
+        if (centroid[0] > lowerX + dx) {
+            DMSetLabelValue(dm, labelName.c_str(), c, 1) >> ablate::checkError;
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** args) {
+    // initialize petsc and mpi
+    ablate::environment::RunEnvironment::Initialize(&argc, &args);
+    ablate::utilities::PetscUtilities::Initialize();
+
+    {
+        // read the benchmark options
+        char solverType[PETSC_MAX_PATH_LEN] = "radiation";
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_solver", solverType, PETSC_MAX_PATH_LEN, nullptr) >> ablate::checkError;
+        PetscInt faces[3] = {20, 20, 20};
+        PetscInt dim = 3;
+        PetscBool facesSet = PETSC_FALSE;
+        PetscOptionsGetIntArray(nullptr, nullptr, "-benchmark_faces", faces, &dim, &facesSet) >> ablate::checkError;
+        dim = facesSet ? dim : 2;
+        PetscInt rays = 10;
+        PetscOptionsGetInt(nullptr, nullptr, "-benchmark_rays", &rays, nullptr) >> ablate::checkError;
+        PetscInt iterations = 5;
+        PetscOptionsGetInt(nullptr, nullptr, "-benchmark_iterations", &iterations, nullptr) >> ablate::checkError;
+        PetscReal absorptivity = 1.0;
+        PetscOptionsGetReal(nullptr, nullptr, "-benchmark_absorptivity", &absorptivity, nullptr) >> ablate::checkError;
+        char temperatureExpression[PETSC_MAX_PATH_LEN] = "1000 + 1000*exp(-10*(x*x + y*y + z*z))";
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_temperature", temperatureExpression, PETSC_MAX_PATH_LEN, nullptr) >> ablate::checkError;
+        PetscBool batchProperties = PETSC_FALSE;
+        PetscOptionsGetBool(nullptr, nullptr, "-benchmark_batch_properties", &batchProperties, nullptr) >> ablate::checkError;
+        char outputFile[PETSC_MAX_PATH_LEN] = "";
+        PetscBool outputSet = PETSC_FALSE;
+        PetscOptionsGetString(nullptr, nullptr, "-benchmark_output", outputFile, PETSC_MAX_PATH_LEN, &outputSet) >> ablate::checkError;
+        const std::string solver(solverType);
+        if (dim < 1 || dim > 3 || iterations < 1) {
+            throw std::invalid_argument("The -benchmark_faces must have 1 to 3 values and -benchmark_iterations must be positive");
+        }
+
+        // build the mesh with the fields required for the radiation solver
+        auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+        std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>> fieldDescriptors = {std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)};
+        auto domain = std::make_shared<ablate::domain::BoxMesh>("benchmarkMesh",
+                                                                fieldDescriptors,
+                                                                std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                                std::vector<int>(faces, faces + dim),
+                                                                std::vector<double>(dim, -0.5),
+                                                                std::vector<double>(dim, 0.5),
+                                                                std::vector<std::string>{},
+                                                                false,
+                                                                ablate::parameters::MapParameters::Create({{"dm_plex_hash_location", "true"}}));
+
+        // the time stepper is only used to set up the subdomain
+        auto initialConditionEuler = std::make_shared<ablate::mathFunctions::FieldFunction>("euler", std::make_shared<ablate::mathFunctions::ConstantValue>(0.0));
+        ablate::solver::TimeStepper timeStepper("benchmark", domain, ablate::parameters::MapParameters::Create({{"ts_max_steps", "0"}}), {}, {initialConditionEuler});
+        auto benchmarkSolver = std::make_shared<BenchmarkSolver>("benchmarkSolver");
+        timeStepper.Register(benchmarkSolver);
+        timeStepper.Initialize();
+        auto& subDomain = benchmarkSolver->GetSubDomain();
+        const MPI_Comm comm = subDomain.GetComm();
+
+        // set the temperature field
+        auto temperatureFunction = std::make_shared<ablate::mathFunctions::FieldFunction>(ablate::finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD,
+                                                                                          ablate::mathFunctions::Create(std::string(temperatureExpression)));
+        subDomain.ProjectFieldFunctionsToLocalVector({temperatureFunction}, subDomain.GetAuxVector());
+
+        // the surface solver uses the faces between the first and second layer of cells as origins
+        std::shared_ptr<ablate::domain::Region> region = ablate::domain::Region::ENTIREDOMAIN;
+        ablate::solver::Range cellRange;
+        ablate::solver::DynamicRange faceRange;
+        if (solver == "surface") {
+            const std::string regionName = "benchmarkRadiationRegion";
+            CreateSurfaceRegion(subDomain.GetDM(), regionName, -0.5, 1.0 / (PetscReal)faces[0]);
+            region = std::make_shared<ablate::domain::Region>(regionName);
+
+            PetscInt fStart, fEnd;
+            DMPlexGetHeightStratum(subDomain.GetDM(), 1, &fStart, &fEnd) >> ablate::checkError;
+            for (PetscInt f = fStart; f < fEnd; ++f) {
+                PetscInt supportSize, globalStart, globalEnd;
+                const PetscInt* support;
+                DMPlexGetSupportSize(subDomain.GetDM(), f, &supportSize) >> ablate::checkError;
+                DMPlexGetSupport(subDomain.GetDM(), f, &support) >> ablate::checkError;
+                DMPlexGetPointGlobal(subDomain.GetDM(), f, &globalStart, &globalEnd) >> ablate::checkError;
+                if (supportSize == 2 && globalStart >= 0 &&
+                    ablate::domain::Region::InRegion(region, subDomain.GetDM(), support[0]) != ablate::domain::Region::InRegion(region, subDomain.GetDM(), support[1])) {
+                    faceRange.Add(f);
+                }
+            }
+        } else {
+            benchmarkSolver->GetCellRange(cellRange);
+        }
+        const auto& originRange = solver == "surface" ? faceRange.GetRange() : cellRange;
+
+        // create the radiation solver
+        auto radiationProperties = std::make_shared<ablate::eos::radiationProperties::Constant>(absorptivity);
+        std::shared_ptr<ablate::radiation::Radiation> radiation;
+        if (solver == "radiation") {
+            radiation = std::make_shared<ablate::radiation::Radiation>("benchmarkRadiation", region, rays, radiationProperties, nullptr, batchProperties);
+        } else if (solver == "raySharing") {
+            radiation = std::make_shared<ablate::radiation::RaySharingRadiation>("benchmarkRadiation", region, rays, radiationProperties, nullptr, batchProperties);
+        } else if (solver == "surface") {
+            radiation = std::make_shared<ablate::radiation::SurfaceRadiation>("benchmarkRadiation", region, rays, radiationProperties, nullptr, batchProperties);
+        } else if (solver == "p1") {
+            radiation = std::make_shared<ablate::radiation::P1Radiation>("benchmarkRadiation", region, radiationProperties);
+        } else {
+            throw std::invalid_argument("Unknown -benchmark_solver " + solver + ", expected radiation, raySharing, surface, or p1");
+        }
+
+        // time each phase
+        const auto temperatureField = subDomain.GetField(ablate::finiteVolume::CompressibleFlowFields::TEMPERATURE_FIELD);
+        const double setupTime = testingResources::BenchmarkUtilities::TimePhase(comm, [&]() { radiation->Setup(originRange, subDomain); });
+        const double initializeTime = testingResources::BenchmarkUtilities::TimePhase(comm, [&]() { radiation->Initialize(originRange, subDomain); });
+        double evaluateGainsTime = 0.0;
+        double solveTime = 0.0;
+        for (PetscInt i = 0; i < iterations; ++i) {
+            evaluateGainsTime += testingResources::BenchmarkUtilities::TimePhase(comm, [&]() { radiation->EvaluateGains(subDomain.GetSolutionVector(), temperatureField, subDomain.GetAuxVector()); });
+            solveTime += testingResources::BenchmarkUtilities::TimePhase(comm, [&]() { radiation->Solve(subDomain.GetSolutionVector(), temperatureField, subDomain.GetAuxVector()); });
+        }
+
+        // gather the problem size
+        PetscInt localOrigins = originRange.end - originRange.start;
+        PetscInt globalOrigins = 0;
+        MPI_Allreduce(&localOrigins, &globalOrigins, 1, MPIU_INT, MPI_SUM, comm) >> ablate::checkMpiError;
+        PetscInt globalCells = 1;
+        for (PetscInt d = 0; d < dim; ++d) {
+            globalCells *= faces[d];
+        }
+        PetscMPIInt size;
+        MPI_Comm_size(comm, &size) >> ablate::checkMpiError;
+
+        nlohmann::json results = {{"benchmark", "radiation"},
+                                  {"solver", solver},
+                                  {"ranks", size},
+                                  {"dimensions", dim},
+                                  {"faces", std::vector<PetscInt>(faces, faces + dim)},
+                                  {"cells", globalCells},
+                                  {"origins", globalOrigins},
+                                  {"rays", rays},
+                                  {"batchProperties", (bool)batchProperties},
+                                  {"phases",
+                                   {{"setup", testingResources::BenchmarkUtilities::PhaseStatistics(comm, setupTime, 1)},
+                                    {"initialize", testingResources::BenchmarkUtilities::PhaseStatistics(comm, initializeTime, 1)},
+                                    {"evaluateGains", testingResources::BenchmarkUtilities::PhaseStatistics(comm, evaluateGainsTime, iterations)},
+                                    {"solve", testingResources::BenchmarkUtilities::PhaseStatistics(comm, solveTime, iterations)}}}};
+        testingResources::BenchmarkUtilities::WriteResults(comm, results, outputSet ? outputFile : "");
+
+        if (solver != "surface") {
+            benchmarkSolver->RestoreRange(cellRange);
+        }
+    }
+
+    ablate::environment::RunEnvironment::Finalize();
+    return 0;
+}
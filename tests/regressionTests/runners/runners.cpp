@@ -1,4 +1,5 @@
 #include "runners.hpp"
+#include <fstream>
 #include "environment/runEnvironment.hpp"
 #include "utilities/petscUtilities.hpp"
 
@@ -50,4 +51,74 @@ TEST_P(RegressionTestsSpecifier, ShouldRun) {
         ablate::environment::RunEnvironment::Finalize();
         exit(0);
     EndWithMPI
-}
\ No newline at end of file
+}
+
+TEST_P(PerformanceRegressionTestsSpecifier, ShouldMeetThroughputBaseline) {
+    StartWithMPI
+        // initialize petsc and mpi
+        if (!PETSC_USE_LOG) {
+            FAIL() << "Performance regression testing requires PETSC_LOG";
+        }
+        ablate::environment::RunEnvironment::Initialize(argc, argv);
+        ablate::utilities::PetscUtilities::Initialize("Performance Regression Level Testing");
+        PetscLogDefaultBegin() >> testErrorChecker;
+        {
+            int rank;
+            MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+
+            // precompute the resultDirectory directory so we can remove it if it here
+            std::filesystem::path resultDirectory = BuildResultDirectory();
+            auto testName = TestName();
+
+            // get the file
+            std::filesystem::path inputPath = GetParam().mpiTestParameter.testName;
+
+            // Setup the run environment
+            ablate::parameters::MapParameters runEnvironmentParameters(std::map<std::string, std::string>{{"directory", resultDirectory}, {"tagDirectory", "false"}, {"title", testName}});
+            ablate::environment::RunEnvironment::Setup(runEnvironmentParameters, inputPath);
+
+            {
+                // load a yaml file with the mesh size overrides
+                std::shared_ptr<cppParser::Factory> parser = std::make_shared<cppParser::YamlParser>(inputPath, GetParam().overrides);
+
+                // run with the parser
+                ablate::Builder::Run(parser);
+            }
+
+            // the number of steps and the time spent stepping is recorded by the petsc TSStep event, the slowest rank sets the throughput
+            PetscLogEvent stepEvent;
+            PetscLogEventGetId("TSStep", &stepEvent) >> testErrorChecker;
+            PetscEventPerfInfo stepInfo;
+            PetscLogEventGetPerfInfo(PETSC_DETERMINE, stepEvent, &stepInfo) >> testErrorChecker;
+            PetscLogDouble stepTime;
+            MPI_Allreduce(&stepInfo.time, &stepTime, 1, MPIU_PETSCLOGDOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+
+            if (rank == 0) {
+                const auto steps = (PetscLogDouble)stepInfo.count;
+                const PetscLogDouble cellsPerSecond = stepTime > 0.0 ? (PetscLogDouble)GetParam().cells * steps / stepTime : 0.0;
+                std::cout << "PerformanceRegression:" << std::endl;
+                std::cout << "\ttimeSteps: " << stepInfo.count << std::endl;
+                std::cout << "\twallTimePerStep: " << (steps > 0 ? stepTime / steps : 0.0) << std::endl;
+                std::cout << "\tcellsPerSecond: " << cellsPerSecond << std::endl;
+
+                // compare against or record the baseline
+                std::filesystem::path baselineFile = GetParam().baselineFile;
+                if (std::filesystem::exists(baselineFile)) {
+                    std::ifstream baselineStream(baselineFile);
+                    PetscLogDouble baselineCellsPerSecond = 0.0;
+                    baselineStream >> baselineCellsPerSecond;
+                    std::cout << "\tbaselineCellsPerSecond: " << baselineCellsPerSecond << std::endl;
+                    std::cout << "\tbaseline: " << (cellsPerSecond >= baselineCellsPerSecond * (1.0 - GetParam().tolerance) ? "within" : "below") << std::endl;
+                } else {
+                    std::filesystem::create_directories(baselineFile.parent_path());
+                    std::ofstream baselineStream(baselineFile);
+                    baselineStream << cellsPerSecond << std::endl;
+                    std::cout << "\tbaselineCellsPerSecond: " << cellsPerSecond << std::endl;
+                    std::cout << "\tbaseline: recorded" << std::endl;
+                }
+            }
+        }
+        ablate::environment::RunEnvironment::Finalize();
+        exit(0);
+    EndWithMPI
+}
@@ -16,4 +16,29 @@
  */
 class RegressionTestsSpecifier : public testingResources::MpiTestParamFixture {};
 
+/**
+ * Runs an input for a fixed number of steps and compares the cell throughput (cells*steps/sec) against a stored baseline.  If the baseline file does not exist
+ * the measured throughput is recorded as the new baseline.
+ */
+struct PerformanceRegressionTestsParameters {
+    testingResources::MpiTestParameter mpiTestParameter;
+
+    //! overrides applied to the input, i.e. the mesh refinement
+    std::map<std::string, std::string> overrides;
+
+    //! the total number of cells in the mesh used to compute the throughput
+    PetscInt cells;
+
+    //! the file holding the baseline cells per second
+    std::string baselineFile;
+
+    //! the allowed fractional drop in throughput from the baseline
+    double tolerance = 0.2;
+};
+
+class PerformanceRegressionTestsSpecifier : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<PerformanceRegressionTestsParameters> {
+   public:
+    void SetUp() override { SetMpiParameters(GetParam().mpiTestParameter); }
+};
+
 #endif  // ABLATELIBRARY_RUNNERS_HPP
@@ -9,3 +9,42 @@ INSTANTIATE_TEST_SUITE_P(
         .testName = "inputs/exampleRegressionTest/exampleRegressionTest.yaml", .nproc = 1, .expectedOutputFile = "outputs/exampleRegressionTest/expectedOutput.txt", .arguments = ""}),
 
     [](const testing::TestParamInfo<MpiTestParameter>& info) { return info.param.getTestName(); });
+
+
+// the baselines are recorded on the first run, copy them from the build outputs/performance/baselines directory to track a reference machine
+INSTANTIATE_TEST_SUITE_P(
+    PerformanceRegression, PerformanceRegressionTestsSpecifier,
+    testing::Values(
+        (PerformanceRegressionTestsParameters){.mpiTestParameter = {.testName = "inputs/performance/compressibleFlowVortex.yaml", .nproc = 1, .expectedOutputFile = "outputs/performance/throughput.txt", .arguments = ""},
+                                               .overrides = {{"timestepper::domain::options::dm_refine", "2"}},
+                                               .cells = 576,
+                                               .baselineFile = "outputs/performance/baselines/compressibleFlowVortex_refine2_1.txt"},
+        (PerformanceRegressionTestsParameters){.mpiTestParameter = {.testName = "inputs/performance/compressibleFlowVortex.yaml", .nproc = 2, .expectedOutputFile = "outputs/performance/throughput.txt", .arguments = ""},
+                                               .overrides = {{"timestepper::domain::options::dm_refine", "2"}},
+                                               .cells = 576,
+                                               .baselineFile = "outputs/performance/baselines/compressibleFlowVortex_refine2_2.txt"},
+        (PerformanceRegressionTestsParameters){.mpiTestParameter = {.testName = "inputs/performance/compressibleFlowVortex.yaml", .nproc = 1, .expectedOutputFile = "outputs/performance/throughput.txt", .arguments = ""},
+                                               .overrides = {{"timestepper::domain::options::dm_refine", "4"}},
+                                               .cells = 9216,
+                                               .baselineFile = "outputs/performance/baselines/compressibleFlowVortex_refine4_1.txt"},
+        (PerformanceRegressionTestsParameters){.mpiTestParameter = {.testName = "inputs/performance/compressibleFlowVortex.yaml", .nproc = 2, .expectedOutputFile = "outputs/performance/throughput.txt", .arguments = ""},
+                                               .overrides = {{"timestepper::domain::options::dm_refine", "4"}},
+                                               .cells = 9216,
+                                               .baselineFile = "outputs/performance/baselines/compressibleFlowVortex_refine4_2.txt"},
+        (PerformanceRegressionTestsParameters){.mpiTestParameter = {.testName = "inputs/performance/twoGasAdvectingDiscontinuity.yaml", .nproc = 1, .expectedOutputFile = "outputs/performance/throughput.txt", .arguments = ""},
+                                               .overrides = {{"timestepper::domain::options::dm_refine", "6"}},
+                                               .cells = 640,
+                                               .baselineFile = "outputs/performance/baselines/twoGasAdvectingDiscontinuity_refine6_1.txt"},
+        (PerformanceRegressionTestsParameters){.mpiTestParameter = {.testName = "inputs/performance/twoGasAdvectingDiscontinuity.yaml", .nproc = 2, .expectedOutputFile = "outputs/performance/throughput.txt", .arguments = ""},
+                                               .overrides = {{"timestepper::domain::options::dm_refine", "6"}},
+                                               .cells = 640,
+                                               .baselineFile = "outputs/performance/baselines/twoGasAdvectingDiscontinuity_refine6_2.txt"},
+        (PerformanceRegressionTestsParameters){.mpiTestParameter = {.testName = "inputs/performance/twoGasAdvectingDiscontinuity.yaml", .nproc = 1, .expectedOutputFile = "outputs/performance/throughput.txt", .arguments = ""},
+                                               .overrides = {{"timestepper::domain::options::dm_refine", "10"}},
+                                               .cells = 10240,
+                                               .baselineFile = "outputs/performance/baselines/twoGasAdvectingDiscontinuity_refine10_1.txt"},
+        (PerformanceRegressionTestsParameters){.mpiTestParameter = {.testName = "inputs/performance/twoGasAdvectingDiscontinuity.yaml", .nproc = 2, .expectedOutputFile = "outputs/performance/throughput.txt", .arguments = ""},
+                                               .overrides = {{"timestepper::domain::options::dm_refine", "10"}},
+                                               .cells = 10240,
+                                               .baselineFile = "outputs/performance/baselines/twoGasAdvectingDiscontinuity_refine10_2.txt"}),
+    [](const testing::TestParamInfo<PerformanceRegressionTestsParameters>& info) { return std::filesystem::path(info.param.baselineFile).stem().string(); });
@@ -0,0 +1,34 @@
+#include "benchmarkUtilities.hpp"
+#include <fstream>
+#include <iostream>
+
+nlohmann::json testingResources::BenchmarkUtilities::PhaseStatistics(MPI_Comm comm, double localTime, PetscInt calls) {
+    PetscMPIInt size;
+    MPI_Comm_size(comm, &size) >> ablate::checkMpiError;
+    double minimum, maximum, sum;
+    MPI_Allreduce(&localTime, &minimum, 1, MPI_DOUBLE, MPI_MIN, comm) >> ablate::checkMpiError;
+    MPI_Allreduce(&localTime, &maximum, 1, MPI_DOUBLE, MPI_MAX, comm) >> ablate::checkMpiError;
+    MPI_Allreduce(&localTime, &sum, 1, MPI_DOUBLE, MPI_SUM, comm) >> ablate::checkMpiError;
+    return nlohmann::json{{"calls", calls}, {"min", minimum / calls}, {"max", maximum / calls}, {"mean", sum / (size * calls)}};
+}
+
+nlohmann::json testingResources::BenchmarkUtilities::PhaseStatistics(MPI_Comm comm, double localTime, PetscInt calls, PetscInt points) {
+    // the per call statistics are divided by the number of points so the time is reported per point
+    auto statistics = PhaseStatistics(comm, localTime / (double)points, calls);
+    statistics["points"] = points;
+    return statistics;
+}
+
+void testingResources::BenchmarkUtilities::WriteResults(MPI_Comm comm, const nlohmann::json& results, const std::string& outputFile) {
+    PetscMPIInt rank;
+    MPI_Comm_rank(comm, &rank) >> ablate::checkMpiError;
+    if (rank != 0) {
+        return;
+    }
+    if (!outputFile.empty()) {
+        std::ofstream outputStream(outputFile);
+        outputStream << results.dump(4) << std::endl;
+    } else {
+        std::cout << results.dump(4) << std::endl;
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef ABLATELIBRARY_BENCHMARKUTILITIES_HPP
+#define ABLATELIBRARY_BENCHMARKUTILITIES_HPP
+
+#include <petsc.h>
+#include <nlohmann/json.hpp>
+#include <string>
+#include "utilities/mpiError.hpp"
+
+namespace testingResources {
+
+/**
+ * The timing and json output shared by the standalone benchmarks
+ */
+class BenchmarkUtilities {
+   public:
+    /**
+     * Time a single phase on this rank, the ranks are synchronized before the phase starts
+     */
+    template <class Function>
+    static double TimePhase(MPI_Comm comm, Function function) {
+        MPI_Barrier(comm) >> ablate::checkMpiError;
+        const double start = MPI_Wtime();
+        function();
+        return MPI_Wtime() - start;
+    }
+
+    /**
+     * Reduce the time on each rank to the min, max, and mean time per call over the ranks
+     */
+    static nlohmann::json PhaseStatistics(MPI_Comm comm, double localTime, PetscInt calls);
+
+    /**
+     * Reduce the time on each rank to the min, max, and mean time per point over the ranks
+     */
+    static nlohmann::json PhaseStatistics(MPI_Comm comm, double localTime, PetscInt calls, PetscInt points);
+
+    /**
+     * Write the results from the first rank to the output file, or stdout if the output file is empty
+     */
+    static void WriteResults(MPI_Comm comm, const nlohmann::json& results, const std::string& outputFile);
+
+   private:
+    BenchmarkUtilities() = delete;
+};
+
+}  // namespace testingResources
+
+#endif  // ABLATELIBRARY_BENCHMARKUTILITIES_HPP
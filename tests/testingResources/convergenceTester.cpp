@@ -1,5 +1,9 @@
 #include "convergenceTester.hpp"
+#include <algorithm>
+#include <environment/runEnvironment.hpp>
 #include <monitors/logs/stdOut.hpp>
+#include <numeric>
+#include <utilities/mpiError.hpp>
 #include "PetscTestErrorChecker.hpp"
 testingResources::ConvergenceTester::ConvergenceTester(std::string name, std::shared_ptr<ablate::monitors::logs::Log> logIn)
     : name(name), log(logIn ? logIn : std::make_shared<ablate::monitors::logs::StdOut>()) {}
@@ -49,3 +53,123 @@ bool testingResources::ConvergenceTester::CompareConvergenceRate(const std::vect
     }
     return passed;
 }
+
+std::vector<PetscInt> testingResources::ConvergenceTester::SplitLevels(const std::vector<PetscReal>& levelCosts) {
+    // mpi must be initialized to split the comm before petsc is initialized
+    int mpiInitialized;
+    MPI_Initialized(&mpiInitialized) >> checkMpiError;
+    if (!mpiInitialized) {
+        MPI_Init(nullptr, nullptr) >> checkMpiError;
+    }
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank) >> checkMpiError;
+    MPI_Comm_size(MPI_COMM_WORLD, &size) >> checkMpiError;
+
+    // assign each level to a group of ranks
+    const auto numberLevels = (int)levelCosts.size();
+    std::vector<int> levelGroup(numberLevels);
+    std::vector<int> groupRanks;
+    if (size >= numberLevels) {
+        // one group per level with the ranks divided in proportion to the cost, every level has at least one rank
+        const PetscReal totalCost = std::accumulate(levelCosts.begin(), levelCosts.end(), 0.0);
+        groupRanks.resize(numberLevels);
+        int assignedRanks = 0;
+        for (int l = 0; l < numberLevels; ++l) {
+            levelGroup[l] = l;
+            groupRanks[l] = std::max(1, (int)PetscFloorReal(size * levelCosts[l] / totalCost));
+            assignedRanks += groupRanks[l];
+        }
+
+        // any remaining ranks go to the most expensive level, and any extra ranks are taken from the largest groups
+        const auto mostExpensive = std::distance(levelCosts.begin(), std::max_element(levelCosts.begin(), levelCosts.end()));
+        for (; assignedRanks < size; ++assignedRanks) {
+            groupRanks[mostExpensive]++;
+        }
+        for (; assignedRanks > size; --assignedRanks) {
+            (*std::max_element(groupRanks.begin(), groupRanks.end()))--;
+        }
+    } else {
+        // each rank is a group, the most expensive levels are assigned first to the least loaded rank
+        groupRanks.assign(size, 1);
+        std::vector<PetscReal> groupCost(size, 0.0);
+        std::vector<int> levelOrder(numberLevels);
+        std::iota(levelOrder.begin(), levelOrder.end(), 0);
+        std::stable_sort(levelOrder.begin(), levelOrder.end(), [&levelCosts](int a, int b) { return levelCosts[a] > levelCosts[b]; });
+        for (auto l : levelOrder) {
+            const auto group = (int)std::distance(groupCost.begin(), std::min_element(groupCost.begin(), groupCost.end()));
+            levelGroup[l] = group;
+            groupCost[group] += levelCosts[l];
+        }
+    }
+
+    // the groups are contiguous blocks of ranks
+    int group = 0;
+    for (int groupEnd = groupRanks[0]; rank >= groupEnd; groupEnd += groupRanks[group]) {
+        ++group;
+    }
+
+    // every petsc object created by the test uses the sub comm
+    MPI_Comm subComm;
+    MPI_Comm_split(MPI_COMM_WORLD, group, rank, &subComm) >> checkMpiError;
+    PETSC_COMM_WORLD = subComm;
+
+    // petsc only finalizes mpi if it initialized it, so the sub comm and mpi are cleaned up after petsc
+    ablate::environment::RunEnvironment::RegisterCleanUpFunction("testingResources::ConvergenceTester::SplitLevels", [subComm, mpiInitialized]() mutable {
+        MPI_Comm_free(&subComm) >> checkMpiError;
+        if (!mpiInitialized) {
+            MPI_Finalize() >> checkMpiError;
+        }
+    });
+
+    std::vector<PetscInt> levels;
+    for (int l = 0; l < numberLevels; ++l) {
+        if (levelGroup[l] == group) {
+            levels.push_back(l);
+        }
+    }
+    return levels;
+}
+
+void testingResources::ConvergenceTester::Gather() {
+    // only the first rank of each sub comm contributes its records
+    int subRank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &subRank) >> checkMpiError;
+    int numberErrors = (int)errorHistory.size();
+    MPI_Allreduce(MPI_IN_PLACE, &numberErrors, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD) >> checkMpiError;
+    const int recordSize = 1 + numberErrors;
+
+    // each record is the log10 of h followed by the log10 of each error
+    std::vector<PetscReal> localRecords;
+    if (subRank == 0) {
+        for (std::size_t r = 0; r < hHistory.size(); r++) {
+            localRecords.push_back(hHistory[r]);
+            for (const auto& error : errorHistory) {
+                localRecords.push_back(error[r]);
+            }
+        }
+    }
+
+    int size;
+    MPI_Comm_size(MPI_COMM_WORLD, &size) >> checkMpiError;
+    int localCount = (int)localRecords.size();
+    std::vector<int> counts(size), displacements(size, 0);
+    MPI_Allgather(&localCount, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD) >> checkMpiError;
+    std::partial_sum(counts.begin(), counts.end() - 1, displacements.begin() + 1);
+    std::vector<PetscReal> records(displacements.back() + counts.back());
+    MPI_Allgatherv(localRecords.data(), localCount, MPIU_REAL, records.data(), counts.data(), displacements.data(), MPIU_REAL, MPI_COMM_WORLD) >> checkMpiError;
+
+    // order the records from the coarsest to the finest level
+    const std::size_t numberRecords = records.size() / recordSize;
+    std::vector<std::size_t> recordOrder(numberRecords);
+    std::iota(recordOrder.begin(), recordOrder.end(), 0);
+    std::sort(recordOrder.begin(), recordOrder.end(), [&records, recordSize](std::size_t a, std::size_t b) { return records[a * recordSize] > records[b * recordSize]; });
+
+    hHistory.clear();
+    errorHistory.assign(numberErrors, {});
+    for (auto r : recordOrder) {
+        hHistory.push_back(records[r * recordSize]);
+        for (int b = 0; b < numberErrors; b++) {
+            errorHistory[b].push_back(records[r * recordSize + 1 + b]);
+        }
+    }
+}
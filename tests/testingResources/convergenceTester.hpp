@@ -21,6 +21,21 @@ class ConvergenceTester {
     void Record(PetscReal h, const std::vector<PetscReal>& error);
 
     bool CompareConvergenceRate(const std::vector<PetscReal>& expectedConvergenceRate, std::string& message);
+
+    /**
+     * Splits MPI_COMM_WORLD so the refinement levels can be run concurrently.  Must be called before PETSc is initialized because PETSC_COMM_WORLD is set to the
+     * sub comm, so every object created by the test only uses the ranks assigned to its levels.  The ranks are divided in proportion to the cost of each level.
+     * When there are fewer ranks than levels each rank runs a set of levels balanced by cost.
+     * @param levelCosts the relative cost of each level (i.e. the number of cells)
+     * @return the levels to run on this rank in increasing order
+     */
+    static std::vector<PetscInt> SplitLevels(const std::vector<PetscReal>& levelCosts);
+
+    /**
+     * Gathers the records from every sub comm so each rank has the history of every level, ordered from the coarsest to the finest level.  Must be called by every
+     * rank in MPI_COMM_WORLD after recording the levels from SplitLevels.
+     */
+    void Gather();
 };
 
 }  // namespace testingResources
@@ -0,0 +1,39 @@
+#include <vector>
+#include "boundarySolver/distributionOperator.hpp"
+#include "gtest/gtest.h"
+
+TEST(DistributionOperatorTests, ShouldAddWeightedBlocksToEachRow) {
+    // arrange
+    // two faces with a block size of two, face 0 is distributed to offsets 0 and 4, face 1 to offsets 4 and 6
+    ablate::boundarySolver::DistributionOperator distributionOperator({{.rowOffset = 4, .columnOffset = 0, .weight = 0.25},
+                                                                       {.rowOffset = 0, .columnOffset = 0, .weight = 0.75},
+                                                                       {.rowOffset = 4, .columnOffset = 2, .weight = 0.5},
+                                                                       {.rowOffset = 6, .columnOffset = 2, .weight = 2.0}});
+    const std::vector<PetscScalar> input = {1.0, 2.0, 3.0, 4.0};
+    std::vector<PetscScalar> output = {1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+    // act
+    distributionOperator.Apply(input.data(), output.data(), 2);
+
+    // assert
+    ASSERT_EQ(3, distributionOperator.GetNumberRows());
+    ASSERT_EQ(4, distributionOperator.GetNumberEntries());
+    const std::vector<PetscScalar> expected = {1.75, 2.5, 0.0, 0.0, 1.75, 2.5, 6.0, 8.0};
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        ASSERT_DOUBLE_EQ(expected[i], output[i]) << "at index " << i;
+    }
+}
+
+TEST(DistributionOperatorTests, ShouldDoNothingWhenEmpty) {
+    // arrange
+    ablate::boundarySolver::DistributionOperator distributionOperator;
+    std::vector<PetscScalar> output = {1.0, 2.0};
+
+    // act
+    distributionOperator.Apply(nullptr, output.data(), 2);
+
+    // assert
+    ASSERT_EQ(0, distributionOperator.GetNumberRows());
+    ASSERT_DOUBLE_EQ(1.0, output[0]);
+    ASSERT_DOUBLE_EQ(2.0, output[1]);
+}
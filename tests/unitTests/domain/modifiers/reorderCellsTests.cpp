@@ -0,0 +1,162 @@
+#include <petsc.h>
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "PetscTestFixture.hpp"
+#include "domain/modifiers/reorderCells.hpp"
+#include "gtest/gtest.h"
+
+namespace ablateTesting::domain::modifier {
+
+/**
+ * Compute the centroid of the vertices in the closure of the point, this is independent of the point numbering
+ */
+static std::array<PetscReal, 3> PointCentroid(DM dm, PetscInt point, const testingResources::PetscTestErrorChecker& errorChecker) {
+    PetscInt dim;
+    DM coordinateDm;
+    PetscSection coordinateSection;
+    Vec coordinates;
+    DMGetCoordinateDim(dm, &dim) >> errorChecker;
+    DMGetCoordinateDM(dm, &coordinateDm) >> errorChecker;
+    DMGetLocalSection(coordinateDm, &coordinateSection) >> errorChecker;
+    DMGetCoordinatesLocal(dm, &coordinates) >> errorChecker;
+
+    PetscInt closureSize;
+    PetscScalar* closure = nullptr;
+    DMPlexVecGetClosure(dm, coordinateSection, coordinates, point, &closureSize, &closure) >> errorChecker;
+    std::array<PetscReal, 3> centroid = {0.0, 0.0, 0.0};
+    const PetscInt numberVertices = closureSize / dim;
+    for (PetscInt v = 0; v < numberVertices; ++v) {
+        for (PetscInt d = 0; d < dim; ++d) {
+            centroid[d] += PetscRealPart(closure[v * dim + d]) / numberVertices;
+        }
+    }
+    DMPlexVecRestoreClosure(dm, coordinateSection, coordinates, point, &closureSize, &closure) >> errorChecker;
+    return centroid;
+}
+
+/**
+ * Describe each label stratum by the sorted centroids of its points so that the labels can be compared between numberings
+ */
+static std::map<std::string, std::map<PetscInt, std::vector<std::array<PetscReal, 3>>>> DescribeLabels(DM dm, const testingResources::PetscTestErrorChecker& errorChecker) {
+    std::map<std::string, std::map<PetscInt, std::vector<std::array<PetscReal, 3>>>> description;
+    PetscInt numberLabels;
+    DMGetNumLabels(dm, &numberLabels) >> errorChecker;
+    for (PetscInt l = 0; l < numberLabels; ++l) {
+        const char* labelName;
+        DMLabel label;
+        DMGetLabelName(dm, l, &labelName) >> errorChecker;
+        DMGetLabelByNum(dm, l, &label) >> errorChecker;
+
+        IS valueIS;
+        const PetscInt* values;
+        PetscInt numberValues;
+        DMLabelGetValueIS(label, &valueIS) >> errorChecker;
+        ISGetLocalSize(valueIS, &numberValues) >> errorChecker;
+        ISGetIndices(valueIS, &values) >> errorChecker;
+        for (PetscInt v = 0; v < numberValues; ++v) {
+            auto& centroids = description[labelName][values[v]];
+            IS pointIS;
+            DMLabelGetStratumIS(label, values[v], &pointIS) >> errorChecker;
+            if (pointIS) {
+                const PetscInt* points;
+                PetscInt numberPoints;
+                ISGetLocalSize(pointIS, &numberPoints) >> errorChecker;
+                ISGetIndices(pointIS, &points) >> errorChecker;
+                for (PetscInt p = 0; p < numberPoints; ++p) {
+                    centroids.push_back(PointCentroid(dm, points[p], errorChecker));
+                }
+                ISRestoreIndices(pointIS, &points) >> errorChecker;
+                ISDestroy(&pointIS) >> errorChecker;
+            }
+            std::sort(centroids.begin(), centroids.end());
+        }
+        ISRestoreIndices(valueIS, &values) >> errorChecker;
+        ISDestroy(&valueIS) >> errorChecker;
+    }
+    return description;
+}
+
+class ReorderCellsTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<ablate::domain::modifiers::ReorderCells::Ordering> {};
+
+TEST_P(ReorderCellsTestFixture, ShouldPermuteCellsAndPreserveLabelsAndPointSF) {
+    // arrange
+    DM dm;
+    PetscInt faces[2] = {5, 3};
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, PETSC_FALSE, faces, nullptr, nullptr, nullptr, PETSC_TRUE, &dm) >> errorChecker;
+    PetscInt cStart, cEnd, pStart, pEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+    DMPlexGetChart(dm, &pStart, &pEnd) >> errorChecker;
+    std::vector<std::array<PetscReal, 3>> cellCentroids;
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        cellCentroids.push_back(PointCentroid(dm, c, errorChecker));
+    }
+    std::sort(cellCentroids.begin(), cellCentroids.end());
+    const auto labels = DescribeLabels(dm, errorChecker);
+    PetscSF pointSF;
+    PetscInt numberRoots, numberLeaves;
+    DMGetPointSF(dm, &pointSF) >> errorChecker;
+    PetscSFGetGraph(pointSF, &numberRoots, &numberLeaves, nullptr, nullptr) >> errorChecker;
+
+    ablate::domain::modifiers::ReorderCells reorderCells(GetParam());
+
+    // act
+    reorderCells.Modify(dm);
+
+    // assert
+    PetscInt newCStart, newCEnd, newPStart, newPEnd;
+    DMPlexGetHeightStratum(dm, 0, &newCStart, &newCEnd) >> errorChecker;
+    DMPlexGetChart(dm, &newPStart, &newPEnd) >> errorChecker;
+    ASSERT_EQ(cStart, newCStart);
+    ASSERT_EQ(cEnd, newCEnd);
+    ASSERT_EQ(pStart, newPStart);
+    ASSERT_EQ(pEnd, newPEnd);
+    DMPlexCheckSymmetry(dm) >> errorChecker;
+    DMPlexCheckSkeleton(dm, 0) >> errorChecker;
+
+    // every cell is still present, only the numbering changed
+    std::vector<std::array<PetscReal, 3>> newCellCentroids;
+    for (PetscInt c = newCStart; c < newCEnd; ++c) {
+        newCellCentroids.push_back(PointCentroid(dm, c, errorChecker));
+    }
+    std::sort(newCellCentroids.begin(), newCellCentroids.end());
+    ASSERT_EQ(cellCentroids, newCellCentroids);
+
+    // the labels follow the permuted points
+    ASSERT_EQ(labels, DescribeLabels(dm, errorChecker));
+
+    // the point sf keeps the same graph size
+    PetscInt newNumberRoots, newNumberLeaves;
+    DMGetPointSF(dm, &pointSF) >> errorChecker;
+    PetscSFGetGraph(pointSF, &newNumberRoots, &newNumberLeaves, nullptr, nullptr) >> errorChecker;
+    ASSERT_EQ(numberRoots, newNumberRoots);
+    ASSERT_EQ(numberLeaves, newNumberLeaves);
+
+    DMDestroy(&dm) >> errorChecker;
+}
+
+TEST_P(ReorderCellsTestFixture, ShouldThrowWhenGhostCellsArePresent) {
+    // arrange
+    DM dm, ghostDm;
+    PetscInt faces[2] = {3, 3};
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, PETSC_FALSE, faces, nullptr, nullptr, nullptr, PETSC_TRUE, &dm) >> errorChecker;
+    DMPlexConstructGhostCells(dm, nullptr, nullptr, &ghostDm) >> errorChecker;
+    DMDestroy(&dm) >> errorChecker;
+
+    ablate::domain::modifiers::ReorderCells reorderCells(GetParam());
+
+    // act/assert
+    ASSERT_THROW(reorderCells.Modify(ghostDm), std::invalid_argument);
+    DMDestroy(&ghostDm) >> errorChecker;
+}
+
+INSTANTIATE_TEST_SUITE_P(ReorderCellsTests, ReorderCellsTestFixture,
+                         testing::Values(ablate::domain::modifiers::ReorderCells::Ordering::RCM, ablate::domain::modifiers::ReorderCells::Ordering::HILBERT),
+                         [](const testing::TestParamInfo<ablate::domain::modifiers::ReorderCells::Ordering>& info) {
+                             return info.param == ablate::domain::modifiers::ReorderCells::Ordering::RCM ? "rcm" : "hilbert";
+                         });
+
+}  // namespace ablateTesting::domain::modifier
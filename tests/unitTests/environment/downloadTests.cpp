@@ -43,4 +43,31 @@ TEST_F(DownloadTestsFixture, ShouldDownloadAndRelocateFile) {
     // cleanup
     fs::remove(computedFilePath);
     fs::remove_all(outputDir);
-}
\ No newline at end of file
+}
+TEST_F(DownloadTestsFixture, ShouldUseCachedFileWithoutDownloading) {
+    // arrange
+    fs::path outputDir = fs::temp_directory_path() / "outputDirCacheTemp";
+    std::filesystem::create_directories(outputDir);
+    testingResources::TestRunEnvironment testRunEnvironment(outputDir);
+
+    // place the file in the cache for a url that cannot be downloaded
+    const std::string url = "https://ablate.invalid/cachedFile.txt";
+    auto cachePath = ablate::environment::Download::GetCachePath(url);
+    std::filesystem::create_directories(cachePath.parent_path());
+    std::ofstream(cachePath) << "cached contents";
+
+    ablate::environment::Download fileLocator(url);
+
+    // act
+    auto computedFilePath = fileLocator.Locate();
+
+    // assert
+    ASSERT_EQ(outputDir / "cachedFile.txt", computedFilePath);
+    std::ifstream computedFile(computedFilePath);
+    std::string contents((std::istreambuf_iterator<char>(computedFile)), std::istreambuf_iterator<char>());
+    ASSERT_EQ("cached contents", contents);
+
+    // cleanup
+    fs::remove_all(cachePath.parent_path());
+    fs::remove_all(outputDir);
+}
@@ -256,6 +256,48 @@ TEST_P(ChemTabModelTestFixture, ShouldComputeCorrectProgressVariables) {
     }
 }
 
+/*******************************************************************************************************
+ * Tests for the batch Progress Variables/Mass Fractions computed for all test targets at once
+ */
+TEST_P(ChemTabModelTestFixture, ShouldComputeCorrectProgressVariablesAndMassFractionsInBatch) {
+    ONLY_WITH_TENSORFLOW_CHECK;
+
+    // arrange
+    ablate::eos::ChemTab chemTabModel(GetParam().modelPath);
+    const auto numberSpecies = chemTabModel.GetSpecies().size();
+    const auto numberProgressVariables = chemTabModel.GetProgressVariables().size();
+
+    // pack each test target as a point
+    std::vector<double> inputMassFractions, expectedProgressVariables, inputProgressVariables, expectedMassFractions;
+    for (const auto& testTarget : testTargets) {
+        auto append = [&testTarget](std::vector<double>& values, const std::string& name) {
+            auto targetValues = testTarget[name].as<std::vector<double>>();
+            values.insert(values.end(), targetValues.begin(), targetValues.end());
+        };
+        append(inputMassFractions, "input_mass_fractions");
+        append(expectedProgressVariables, "output_cpvs");
+        append(inputProgressVariables, "input_cpvs");
+        append(expectedMassFractions, "output_mass_fractions");
+    }
+    const std::size_t numberPoints = testTargets.size();
+    ASSERT_EQ(numberPoints * numberSpecies, inputMassFractions.size());
+    ASSERT_EQ(numberPoints * numberProgressVariables, inputProgressVariables.size());
+
+    // act
+    std::vector<PetscReal> actualProgressVariables(numberPoints * numberProgressVariables);
+    chemTabModel.ComputeProgressVariables(numberPoints, inputMassFractions.data(), actualProgressVariables.data());
+    std::vector<PetscReal> actualMassFractions(numberPoints * numberSpecies);
+    chemTabModel.ComputeMassFractions(numberPoints, inputProgressVariables.data(), actualMassFractions.data());
+
+    // assert
+    for (std::size_t r = 0; r < actualProgressVariables.size(); r++) {
+        assert_float_close(expectedProgressVariables[r], actualProgressVariables[r]) << "The progress variable [" << r << "] is incorrect";
+    }
+    for (std::size_t r = 0; r < actualMassFractions.size(); r++) {
+        assert_float_close(expectedMassFractions[r], actualMassFractions[r]) << "The mass fraction [" << r << "] is incorrect";
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(ChemTabTests, ChemTabModelTestFixture,
                          testing::Values((ChemTabModelTestParameters){.modelPath = "inputs/eos/chemTabTestModel_1", .testTargetFile = "inputs/eos/chemTabTestModel_1/testTargets.yaml"}));
 
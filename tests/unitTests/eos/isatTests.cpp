@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <map>
+#include <memory>
+#include "PetscTestFixture.hpp"
+#include "domain/boxMesh.hpp"
+#include "eos/isat.hpp"
+#include "eos/tChem.hpp"
+#include "finiteVolume/compressibleFlowFields.hpp"
+#include "gtest/gtest.h"
+#include "solver/dynamicRange.hpp"
+
+struct ISATTestParameters {
+    std::filesystem::path mechFile;
+    PetscReal dt;
+    std::vector<PetscReal> inputEulerValues;
+    std::map<std::string, PetscReal> inputDensityYiValues;
+};
+
+class ISATTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<ISATTestParameters> {};
+
+/**
+ * helper function to compute the chemistry source for the single cell domain
+ */
+static std::vector<PetscReal> ComputeSource(const std::shared_ptr<ablate::domain::BoxMesh>& domain, ablate::eos::ChemistryModel::SourceCalculator& sourceCalculator, PetscReal dt) {
+    ablate::solver::DynamicRange range;
+    range.Add(0);
+
+    Vec computedF;
+    DMGetLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
+    VecZeroEntries(computedF) >> ablate::checkError;
+    sourceCalculator.ComputeSource(range.GetRange(), 0.0, dt, domain->GetSolutionVector());
+    sourceCalculator.AddSource(range.GetRange(), domain->GetSolutionVector(), computedF);
+
+    PetscInt size;
+    VecGetLocalSize(computedF, &size) >> ablate::checkError;
+    const PetscScalar* sourceArray;
+    VecGetArrayRead(computedF, &sourceArray) >> ablate::checkError;
+    std::vector<PetscReal> source(sourceArray, sourceArray + size);
+    VecRestoreArrayRead(computedF, &sourceArray) >> ablate::checkError;
+    DMRestoreLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
+    return source;
+}
+
+TEST_P(ISATTestFixture, ShouldRetrieveRepeatedStates) {
+    // ARRANGE
+    const auto& params = GetParam();
+    auto tChem = std::make_shared<ablate::eos::TChem>(params.mechFile);
+    auto eos = std::make_shared<ablate::eos::ISAT>(tChem);
+
+    // create a zeroD domain for testing
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("zeroD",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{1},
+                                                            std::vector<double>{0.0},
+                                                            std::vector<double>{1.0});
+    domain->InitializeSubDomains();
+
+    // set the initial state
+    PetscScalar* solution;
+    VecGetArray(domain->GetSolutionVector(), &solution) >> ablate::checkError;
+    PetscScalar* eulerField = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("euler").id, solution, &eulerField) >> ablate::checkError;
+    for (std::size_t i = 0; i < params.inputEulerValues.size(); i++) {
+        eulerField[i] = params.inputEulerValues[i];
+    }
+    PetscScalar* densityYiField = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("densityYi").id, solution, &densityYiField) >> ablate::checkError;
+    const auto& species = eos->GetSpeciesVariables();
+    for (const auto& [name, value] : params.inputDensityYiValues) {
+        densityYiField[std::distance(species.begin(), std::find(species.begin(), species.end(), name))] = value;
+    }
+    VecRestoreArray(domain->GetSolutionVector(), &solution) >> ablate::checkError;
+
+    ablate::solver::DynamicRange range;
+    range.Add(0);
+    auto sourceCalculator = eos->CreateSourceCalculator(domain->GetFields(), range.GetRange());
+    auto isatSourceCalculator = std::dynamic_pointer_cast<ablate::eos::ISAT::ISATSourceCalculator>(sourceCalculator);
+    ASSERT_TRUE(isatSourceCalculator);
+    auto directSourceCalculator = tChem->CreateSourceCalculator(domain->GetFields(), range.GetRange());
+
+    // ACT
+    auto firstSource = ComputeSource(domain, *sourceCalculator, params.dt);
+    auto secondSource = ComputeSource(domain, *sourceCalculator, params.dt);
+    auto directSource = ComputeSource(domain, *directSourceCalculator, params.dt);
+
+    // ASSERT
+    ASSERT_EQ(isatSourceCalculator->GetNumberQueries(), 2);
+    ASSERT_EQ(isatSourceCalculator->GetNumberHits(), 1) << "The repeated state should be retrieved from the table";
+    ASSERT_EQ(isatSourceCalculator->GetNumberRecords(), 1u);
+    for (std::size_t i = 0; i < directSource.size(); i++) {
+        ASSERT_DOUBLE_EQ(firstSource[i], directSource[i]) << "The table miss should match the direct source at index " << i;
+        ASSERT_DOUBLE_EQ(secondSource[i], directSource[i]) << "The retrieved source should match the direct source at index " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ISATTests, ISATTestFixture,
+                         testing::Values((ISATTestParameters){.mechFile = "inputs/eos/gri30.yaml",
+                                                              .dt = 1.0E-5,
+                                                              .inputEulerValues = {0.280629, 214342., 0.},
+                                                              .inputDensityYiValues = {{"CH4", 0.015335}, {"O2", 0.0615735}, {"N2", 0.20372}}}));
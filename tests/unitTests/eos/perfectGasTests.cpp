@@ -85,6 +85,27 @@ TEST_P(PGThermodynamicPropertyTestFixture, ShouldComputeProperty) {
     for (std::size_t c = 0; c < params.expectedValue.size(); c++) {
         ASSERT_NEAR(computedProperty[c], params.expectedValue[c], 1E-6) << " for temperature function ";
     }
+
+    // act/assert check for the batch function over several copies of the conserved values
+    const PetscInt numberPoints = 3;
+    std::vector<PetscReal> batchConservedValues;
+    for (PetscInt i = 0; i < numberPoints; i++) {
+        batchConservedValues.insert(batchConservedValues.end(), params.conservedValues.begin(), params.conservedValues.end());
+    }
+    auto thermodynamicBatchFunction = eos->GetThermodynamicBatchFunction(params.thermodynamicProperty, params.fields);
+    computedProperty = std::vector<PetscReal>(params.expectedValue.size() * numberPoints, NAN);
+    ierr = thermodynamicBatchFunction.function(numberPoints,
+                                               batchConservedValues.data(),
+                                               (PetscInt)params.conservedValues.size(),
+                                               computedProperty.data(),
+                                               (PetscInt)params.expectedValue.size(),
+                                               thermodynamicBatchFunction.context.get());
+    ASSERT_EQ(ierr, 0);
+    for (PetscInt i = 0; i < numberPoints; i++) {
+        for (std::size_t c = 0; c < params.expectedValue.size(); c++) {
+            ASSERT_NEAR(computedProperty[i * params.expectedValue.size() + c], params.expectedValue[c], 1E-6) << " for batch function point " << i;
+        }
+    }
 }
 
 INSTANTIATE_TEST_SUITE_P(PerfectGasEOSTests, PGThermodynamicPropertyTestFixture,
@@ -45,6 +45,27 @@ TEST_P(RadiationSumTestFixture, ShouldComputeCorrectValueForGetRadiationProperti
     }
 }
 
+TEST_P(RadiationSumTestFixture, ShouldComputeCorrectValueForGetRadiationPropertiesTemperatureBatchFunction) {
+    // arrange
+    auto inputModels = GetParam().getInputModels();
+    auto sumModel = std::make_shared<ablate::eos::radiationProperties::Sum>(inputModels);
+    const std::vector<PetscReal> temperature = {300, 1000, 2000};
+
+    for (const auto& [property, expectedValue] : GetParam().expectedParameters) {
+        // act
+        auto testFunction = sumModel->GetRadiationPropertiesTemperatureBatchFunction(property, {});
+
+        std::vector<PetscReal> computeValues(2 * temperature.size(), NAN);
+        testFunction.function((PetscInt)temperature.size(), nullptr, 0, temperature.data(), 1, computeValues.data(), 2, testFunction.context.get());
+
+        // assert
+        for (std::size_t i = 0; i < temperature.size(); i++) {
+            ASSERT_DOUBLE_EQ(expectedValue, computeValues[2 * i]) << "should be correct for " << property << " at point " << i;
+            ASSERT_TRUE(std::isnan(computeValues[2 * i + 1])) << "should not write outside of the property stride";
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     RadiationSumTests, RadiationSumTestFixture,
     testing::Values(
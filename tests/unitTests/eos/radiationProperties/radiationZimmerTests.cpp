@@ -40,6 +40,43 @@ TEST_P(ZimmerTestFixture, ShouldProduceExpectedValuesForField) {
     ASSERT_NEAR(ZimmerTestFixture::GetParam().expectedAbsorptivity, computedAbsorptivity, 1E-5);  //!< Comparing the values between the expected and the computed absorptivity
 }
 
+TEST_P(ZimmerTestFixture, ShouldProduceExpectedValuesForBatch) {
+    // ARRANGE
+    std::shared_ptr<ablateTesting::eos::MockEOS> eos = std::make_shared<ablateTesting::eos::MockEOS>();
+    EXPECT_CALL(*eos, GetThermodynamicTemperatureFunction(ablate::eos::ThermodynamicProperty::Density, testing::_))
+        .Times(::testing::Exactly(1))
+        .WillOnce(::testing::Return(ablateTesting::eos::MockEOS::CreateMockThermodynamicTemperatureFunction(
+            [](const PetscReal conserved[], PetscReal temperature, PetscReal* property) { *property = ZimmerTestFixture::GetParam().densityIn; })));
+
+    auto zimmerModel = std::make_shared<ablate::eos::radiationProperties::Zimmer>(eos);
+    auto absorptivityFunction = zimmerModel->GetRadiationPropertiesTemperatureBatchFunction(ablate::eos::radiationProperties::RadiationProperty::Absorptivity, ZimmerTestFixture::GetParam().fields);
+
+    /** Repeat the conserved values so that each point in the batch should produce the same absorptivity */
+    const std::size_t numberPoints = 3;
+    const auto& pointConserved = ZimmerTestFixture::GetParam().conservedValues;
+    std::vector<PetscReal> conserved;
+    for (std::size_t p = 0; p < numberPoints; p++) {
+        conserved.insert(conserved.end(), pointConserved.begin(), pointConserved.end());
+    }
+    std::vector<PetscReal> temperature(numberPoints, ZimmerTestFixture::GetParam().temperatureIn);
+
+    // ACT
+    std::vector<PetscReal> computedAbsorptivity(numberPoints, NAN);
+    absorptivityFunction.function((PetscInt)numberPoints,
+                                  conserved.data(),
+                                  (PetscInt)pointConserved.size(),
+                                  temperature.data(),
+                                  1,
+                                  computedAbsorptivity.data(),
+                                  1,
+                                  absorptivityFunction.context.get());
+
+    // ASSERT
+    for (const auto& absorptivity : computedAbsorptivity) {
+        ASSERT_NEAR(ZimmerTestFixture::GetParam().expectedAbsorptivity, absorptivity, 1E-5);
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(RadationZimmerTests, ZimmerTestFixture,
                          testing::Values(/** A test with all valid species for the Zimmer model */
                                          (ZimmerTestParameters){.fields = {ablate::domain::Field{.name = "euler", .numberComponents = 5, .offset = 0},
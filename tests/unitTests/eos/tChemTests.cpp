@@ -4,6 +4,7 @@
 #include "eos/tChem.hpp"
 #include "finiteVolume/compressibleFlowFields.hpp"
 #include "gtest/gtest.h"
+#include "parameters/mapParameters.hpp"
 #include "solver/dynamicRange.hpp"
 
 /*
@@ -207,6 +208,64 @@ TEST_P(TCThermodynamicPropertyTestFixture, ShouldComputeProperty) {
                     << ") should be small";
             }
         }
+
+        // act/assert check for the batch function over several copies of the conserved values
+        const PetscInt numberPoints = 3;
+        std::vector<PetscReal> batchConservedValues;
+        for (PetscInt i = 0; i < numberPoints; i++) {
+            batchConservedValues.insert(batchConservedValues.end(), conservedValues.begin(), conservedValues.end());
+        }
+        auto thermodynamicBatchFunction = eos->GetThermodynamicBatchFunction(thermodynamicProperty, params.fields);
+        computedProperty = std::vector<PetscReal>(expectedValue.size() * numberPoints, NAN);
+        ierr = thermodynamicBatchFunction.function(
+            numberPoints, batchConservedValues.data(), (PetscInt)conservedValues.size(), computedProperty.data(), (PetscInt)expectedValue.size(), thermodynamicBatchFunction.context.get());
+
+        ASSERT_EQ(ierr, 0);
+        for (PetscInt i = 0; i < numberPoints; i++) {
+            for (std::size_t c = 0; c < expectedValue.size(); c++) {
+                const auto computedValue = computedProperty[i * expectedValue.size() + c];
+                if (expectedValue[c] == 0) {
+                    ASSERT_LT(expectedValue[c], params.errorTolerance) << "The value for the batch function of " << to_string(thermodynamicProperty) << " (" << expectedValue[c] << " vs "
+                                                                       << computedValue << ") should be near zero";
+                } else {
+                    ASSERT_LT(PetscAbs((expectedValue[c] - computedValue) / (expectedValue[c] + 1E-30)), params.errorTolerance)
+                        << "The percent difference for the batch function of " << to_string(thermodynamicProperty) << " (" << expectedValue[c] << " vs " << computedValue << ") should be small";
+                }
+            }
+        }
+    }
+}
+
+TEST_P(TCThermodynamicPropertyTestFixture, ShouldComputeTemperatureWithThermoTable) {
+    // arrange
+    std::shared_ptr<ablate::eos::EOS> eos =
+        std::make_shared<ablate::eos::TChem>(GetParam().mechFile, GetParam().thermoFile, nullptr, ablate::parameters::MapParameters::Create({{"thermoTableDeltaTemperature", "1.0"}}));
+
+    // get the test params
+    const auto& params = GetParam();
+
+    // combine and build the total conserved values
+    auto conservedValuesSize = std::accumulate(params.fields.begin(), params.fields.end(), 0, [](int a, const ablate::domain::Field& field) { return a + field.numberComponents; });
+    std::vector<PetscReal> conservedValues(conservedValuesSize + 10, 0.0); /* 10 provides some extra buffer for placement testing*/
+    std::copy(params.conservedEulerValues.begin(), params.conservedEulerValues.end(), conservedValues.begin() + std::find_if(params.fields.begin(), params.fields.end(), [](const auto& field) {
+                                                                                                                    return field.name == "euler";
+                                                                                                                })->offset);
+    FillDensityMassFraction(*std::find_if(params.fields.begin(), params.fields.end(), [](const auto& field) { return field.name == "densityYi"; }),
+                            eos->GetSpecies(),
+                            params.yiMap,
+                            params.conservedEulerValues[0],
+                            conservedValues);
+
+    // act
+    auto temperatureFunction = eos->GetThermodynamicFunction(ablate::eos::ThermodynamicProperty::Temperature, params.fields);
+    PetscReal computedTemperature;
+    PetscErrorCode ierr = temperatureFunction.function(conservedValues.data(), &computedTemperature, temperatureFunction.context.get());
+
+    // assert
+    ASSERT_EQ(ierr, 0);
+    if (params.expectedTemperature) {
+        ASSERT_LT(PetscAbs(computedTemperature - params.expectedTemperature.value()) / params.expectedTemperature.value(), 1E-5)
+            << "The percent difference for computed temperature (" << params.expectedTemperature.value() << " vs " << computedTemperature << ") should be small";
     }
 }
 
@@ -1017,6 +1076,223 @@ TEST_P(TCComputeSourceTestFixture, ShouldComputeCorrectSource) {
     }
     VecRestoreArray(computedF, &sourceArray) >> ablate::checkError;
 
+    // the integrated cell should record its cost
+    std::vector<PetscReal> cellCost(ablate::eos::ChemistryModel::SourceCalculator::CELL_COST_SIZE, -1.0);
+    ASSERT_TRUE(sourceTermCalculator->GetCellCost(range.GetRange(), cellCost.data()));
+    ASSERT_GE(cellCost[ablate::eos::ChemistryModel::SourceCalculator::CELL_COST_WALL_TIME], 0.0);
+    ASSERT_GE(cellCost[ablate::eos::ChemistryModel::SourceCalculator::CELL_COST_SUBSTEPS], 1.0) << "The integrated cell should take at least one substep";
+    ASSERT_EQ(cellCost[ablate::eos::ChemistryModel::SourceCalculator::CELL_COST_FAILURES], 0.0) << "The integration should not fail";
+
+    // a second evaluation of the same state should be seeded with the previously computed temperature and not require any temperature iterations
+    auto tChemSourceCalculator = std::dynamic_pointer_cast<ablate::eos::tChem::SourceCalculator>(sourceTermCalculator);
+    ASSERT_TRUE(tChemSourceCalculator);
+    const auto coldStartIterations = tChemSourceCalculator->GetTemperatureIterations();
+    sourceTermCalculator->ComputeSource(range.GetRange(), 0.0, GetParam().dt, domain->GetSolutionVector());
+    ASSERT_EQ(tChemSourceCalculator->GetTemperatureIterations(), coldStartIterations) << "The warm started temperature should not require any iterations";
+
+    DMRestoreLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
+}
+
+TEST_P(TCComputeSourceTestFixture, ShouldSkipCellsBelowThresholdTemperature) {
+    // ARRANGE
+    auto eos = std::make_shared<ablate::eos::TChem>(
+        GetParam().mechFile, GetParam().thermoFile, nullptr, ablate::parameters::MapParameters::Create({{"thresholdTemperature", "1.0E5"}, {"frozenTolerance", "1.0E-12"}}));
+
+    // create a zeroD domain for testing
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("zeroD",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{1},
+                                                            std::vector<double>{0.0},
+                                                            std::vector<double>{1.0});
+    domain->InitializeSubDomains();
+
+    // copy over the initial euler and densityYi values
+    PetscScalar* solution;
+    VecGetArray(domain->GetSolutionVector(), &solution) >> ablate::checkError;
+    PetscScalar* eulerField = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("euler").id, solution, &eulerField) >> ablate::checkError;
+    for (std::size_t i = 0; i < GetParam().inputEulerValues.size(); i++) {
+        eulerField[i] = GetParam().inputEulerValues[i];
+    }
+    PetscScalar* densityYiField = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("densityYi").id, solution, &densityYiField) >> ablate::checkError;
+    for (std::size_t i = 0; i < GetParam().inputDensityYiValues.size(); i++) {
+        densityYiField[i] = GetParam().inputDensityYiValues[i];
+    }
+    VecRestoreArray(domain->GetSolutionVector(), &solution) >> ablate::checkError;
+
+    Vec computedF;
+    DMGetLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
+    VecZeroEntries(computedF) >> ablate::checkError;
+
+    // ACT
+    ablate::solver::DynamicRange range;
+    range.Add(0);
+    auto sourceTermCalculator = eos->CreateSourceCalculator(domain->GetFields(), range.GetRange());
+    sourceTermCalculator->ComputeSource(range.GetRange(), 0.0, GetParam().dt, domain->GetSolutionVector());
+    sourceTermCalculator->AddSource(range.GetRange(), domain->GetSolutionVector(), computedF);
+
+    // ASSERT
+    auto tChemSourceCalculator = std::dynamic_pointer_cast<ablate::eos::tChem::SourceCalculator>(sourceTermCalculator);
+    ASSERT_TRUE(tChemSourceCalculator);
+    ASSERT_EQ(tChemSourceCalculator->GetNumberActiveCells(), 0u) << "The cell is below the threshold temperature and should not be integrated";
+
+    PetscReal sourceNorm;
+    VecNorm(computedF, NORM_INFINITY, &sourceNorm) >> ablate::checkError;
+    ASSERT_EQ(sourceNorm, 0.0) << "Inactive cells should not produce a source";
+
+    DMRestoreLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
+}
+
+TEST_P(TCComputeSourceTestFixture, ShouldComputeSimilarSourceWithDynamicAdaptiveChemistry) {
+    // the reduced mechanisms can only be created from yaml mechanism files
+    if (GetParam().mechFile.extension() != ".yaml") {
+        return;
+    }
+
+    // ARRANGE
+    auto eos = std::make_shared<ablate::eos::TChem>(GetParam().mechFile,
+                                                    GetParam().thermoFile,
+                                                    nullptr,
+                                                    ablate::parameters::MapParameters::Create({{"dacTolerance", "1.0E-3"}, {"fuelSpecies", "CH4"}, {"oxidizerSpecies", "O2"}}));
+
+    // create a zeroD domain for testing
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("zeroD",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{1},
+                                                            std::vector<double>{0.0},
+                                                            std::vector<double>{1.0});
+    domain->InitializeSubDomains();
+
+    // copy over the initial euler and densityYi values
+    PetscScalar* solution;
+    VecGetArray(domain->GetSolutionVector(), &solution) >> ablate::checkError;
+    PetscScalar* eulerField = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("euler").id, solution, &eulerField) >> ablate::checkError;
+    for (std::size_t i = 0; i < GetParam().inputEulerValues.size(); i++) {
+        eulerField[i] = GetParam().inputEulerValues[i];
+    }
+    PetscScalar* densityYiField = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("densityYi").id, solution, &densityYiField) >> ablate::checkError;
+    for (std::size_t i = 0; i < GetParam().inputDensityYiValues.size(); i++) {
+        densityYiField[i] = GetParam().inputDensityYiValues[i];
+    }
+    VecRestoreArray(domain->GetSolutionVector(), &solution) >> ablate::checkError;
+
+    Vec computedF;
+    DMGetLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
+    VecZeroEntries(computedF) >> ablate::checkError;
+
+    // ACT
+    ablate::solver::DynamicRange range;
+    range.Add(0);
+    auto sourceTermCalculator = eos->CreateSourceCalculator(domain->GetFields(), range.GetRange());
+    sourceTermCalculator->ComputeSource(range.GetRange(), 0.0, GetParam().dt, domain->GetSolutionVector());
+    sourceTermCalculator->AddSource(range.GetRange(), domain->GetSolutionVector(), computedF);
+
+    // ASSERT
+    auto tChemSourceCalculator = std::dynamic_pointer_cast<ablate::eos::tChem::SourceCalculator>(sourceTermCalculator);
+    ASSERT_TRUE(tChemSourceCalculator);
+    ASSERT_TRUE(tChemSourceCalculator->GetDynamicAdaptiveChemistry());
+    ASSERT_LE(tChemSourceCalculator->GetDynamicAdaptiveChemistry()->GetNumberReducedModels(), 1u);
+
+    // the reduced mechanism should reproduce the energy source from the full mechanism
+    PetscScalar* sourceArray;
+    VecGetArray(computedF, &sourceArray) >> ablate::checkError;
+    PetscScalar* eulerSource = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("euler").id, sourceArray, &eulerSource) >> ablate::checkError;
+    const auto expectedEnergySource = GetParam().expectedEulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOE];
+    ASSERT_LT(PetscAbs((eulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOE] - expectedEnergySource) / expectedEnergySource), 5.0E-2)
+        << "The energy source (" << eulerSource[ablate::finiteVolume::CompressibleFlowFields::RHOE] << " vs " << expectedEnergySource << ") should be close to the full mechanism";
+    VecRestoreArray(computedF, &sourceArray) >> ablate::checkError;
+
+    DMRestoreLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
+}
+
+TEST_P(TCComputeSourceTestFixture, ShouldComputeConservativeImplicitSourceAndJacobian) {
+    // ARRANGE
+    auto eos = std::make_shared<ablate::eos::TChem>(GetParam().mechFile, GetParam().thermoFile);
+
+    // create a zeroD domain for testing
+    auto domain = std::make_shared<ablate::domain::BoxMesh>("zeroD",
+                                                            std::vector<std::shared_ptr<ablate::domain::FieldDescriptor>>{std::make_shared<ablate::finiteVolume::CompressibleFlowFields>(eos)},
+                                                            std::vector<std::shared_ptr<ablate::domain::modifiers::Modifier>>{},
+                                                            std::vector<int>{1},
+                                                            std::vector<double>{0.0},
+                                                            std::vector<double>{1.0});
+    domain->InitializeSubDomains();
+
+    // copy over the initial euler and densityYi values
+    PetscScalar* solution;
+    VecGetArray(domain->GetSolutionVector(), &solution) >> ablate::checkError;
+    PetscScalar* eulerField = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("euler").id, solution, &eulerField) >> ablate::checkError;
+    for (std::size_t i = 0; i < GetParam().inputEulerValues.size(); i++) {
+        eulerField[i] = GetParam().inputEulerValues[i];
+    }
+    PetscScalar* densityYiField = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("densityYi").id, solution, &densityYiField) >> ablate::checkError;
+    for (std::size_t i = 0; i < GetParam().inputDensityYiValues.size(); i++) {
+        densityYiField[i] = GetParam().inputDensityYiValues[i];
+    }
+    VecRestoreArray(domain->GetSolutionVector(), &solution) >> ablate::checkError;
+
+    Vec computedF;
+    DMGetLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
+    VecZeroEntries(computedF) >> ablate::checkError;
+    Mat jacobian;
+    DMCreateMatrix(domain->GetDM(), &jacobian) >> ablate::checkError;
+
+    // ACT
+    ablate::solver::DynamicRange range;
+    range.Add(0);
+    auto sourceTermCalculator = eos->CreateSourceCalculator(domain->GetFields(), range.GetRange());
+    sourceTermCalculator->AddImplicitSource(range.GetRange(), domain->GetSolutionVector(), 1.0, computedF);
+    sourceTermCalculator->AddImplicitJacobian(range.GetRange(), domain->GetSolutionVector(), 1.0, jacobian);
+    MatAssemblyBegin(jacobian, MAT_FINAL_ASSEMBLY) >> ablate::checkError;
+    MatAssemblyEnd(jacobian, MAT_FINAL_ASSEMBLY) >> ablate::checkError;
+
+    // ASSERT
+    const auto numberSpecies = (PetscInt)eos->GetSpeciesVariables().size();
+
+    // the reactions should not create mass
+    PetscScalar* sourceArray;
+    VecGetArray(computedF, &sourceArray) >> ablate::checkError;
+    PetscScalar* densityYiSource = nullptr;
+    DMPlexPointLocalFieldRef(domain->GetDM(), 0, domain->GetField("densityYi").id, sourceArray, &densityYiSource) >> ablate::checkError;
+    PetscReal massSource = 0.0;
+    PetscReal maximumSource = 0.0;
+    for (PetscInt s = 0; s < numberSpecies; s++) {
+        massSource += densityYiSource[s];
+        maximumSource = PetscMax(maximumSource, PetscAbs(densityYiSource[s]));
+    }
+    ASSERT_GT(maximumSource, 0.0) << "The implicit source should be non zero";
+    ASSERT_LT(PetscAbs(massSource) / maximumSource, 1.0E-6) << "The implicit species source should conserve mass";
+    VecRestoreArray(computedF, &sourceArray) >> ablate::checkError;
+
+    // each column of the species jacobian should also conserve mass
+    PetscSection globalSection;
+    DMGetGlobalSection(domain->GetDM(), &globalSection) >> ablate::checkError;
+    PetscInt eulerOffset, densityYiOffset;
+    PetscSectionGetFieldOffset(globalSection, 0, domain->GetField("euler").id, &eulerOffset) >> ablate::checkError;
+    PetscSectionGetFieldOffset(globalSection, 0, domain->GetField("densityYi").id, &densityYiOffset) >> ablate::checkError;
+    std::vector<PetscInt> rows(numberSpecies);
+    std::iota(rows.begin(), rows.end(), densityYiOffset);
+    const PetscInt energyColumn = eulerOffset + ablate::finiteVolume::CompressibleFlowFields::RHOE;
+    std::vector<PetscScalar> energyColumnValues(numberSpecies);
+    MatGetValues(jacobian, numberSpecies, rows.data(), 1, &energyColumn, energyColumnValues.data()) >> ablate::checkError;
+    PetscReal energyColumnSum = 0.0;
+    PetscReal energyColumnMaximum = 0.0;
+    for (const auto& value : energyColumnValues) {
+        energyColumnSum += value;
+        energyColumnMaximum = PetscMax(energyColumnMaximum, PetscAbs(value));
+    }
+    ASSERT_GT(energyColumnMaximum, 0.0) << "The species source should depend upon the energy";
+    ASSERT_LT(PetscAbs(energyColumnSum) / energyColumnMaximum, 1.0E-4) << "The energy column of the species jacobian should conserve mass";
+
+    MatDestroy(&jacobian) >> ablate::checkError;
     DMRestoreLocalVector(domain->GetDM(), &computedF) >> ablate::checkError;
 }
 
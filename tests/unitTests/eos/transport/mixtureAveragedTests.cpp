@@ -0,0 +1,69 @@
+#include <map>
+#include <vector>
+#include "PetscTestFixture.hpp"
+#include "eos/tChem.hpp"
+#include "eos/transport/mixtureAveraged.hpp"
+#include "gtest/gtest.h"
+
+struct MixtureAveragedTransportTestParameters {
+    std::filesystem::path mechFile;
+    PetscReal temperature;
+    PetscReal density;
+    std::map<std::string, PetscReal> yiMap;
+
+    PetscReal expectedConductivity;
+    PetscReal expectedViscosity;
+    std::map<std::string, PetscReal> expectedSpeciesDiffusivity;
+    PetscReal errorTolerance = 1E-2;
+};
+
+class MixtureAveragedTransportTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<MixtureAveragedTransportTestParameters> {};
+
+TEST_P(MixtureAveragedTransportTestFixture, ShouldComputeCorrectTransportProperties) {
+    // ARRANGE
+    const auto& params = GetParam();
+    auto eos = std::make_shared<ablate::eos::TChem>(params.mechFile);
+    const auto& species = eos->GetSpeciesVariables();
+    std::vector<ablate::domain::Field> fields = {ablate::domain::Field{.name = "euler", .numberComponents = 3, .offset = 0},
+                                                 ablate::domain::Field{.name = "densityYi", .numberComponents = (PetscInt)species.size(), .offset = 3}};
+
+    // set the conserved state, the energy is not needed when the temperature is provided
+    std::vector<PetscReal> conserved(3 + species.size(), 0.0);
+    conserved[0] = params.density;
+    for (const auto& [name, yi] : params.yiMap) {
+        conserved[3 + std::distance(species.begin(), std::find(species.begin(), species.end(), name))] = params.density * yi;
+    }
+
+    auto transportModel = std::make_shared<ablate::eos::transport::MixtureAveraged>(eos);
+    auto conductivityFunction = transportModel->GetTransportTemperatureFunction(ablate::eos::transport::TransportProperty::Conductivity, fields);
+    auto viscosityFunction = transportModel->GetTransportTemperatureFunction(ablate::eos::transport::TransportProperty::Viscosity, fields);
+    auto speciesDiffusivityFunction = transportModel->GetSpeciesDiffusivityTemperatureFunction(fields);
+
+    // ACT
+    PetscReal computedK = NAN;
+    PetscReal computedMu = NAN;
+    std::vector<PetscReal> computedDiffusivity(species.size(), NAN);
+    ASSERT_EQ(conductivityFunction.function(conserved.data(), params.temperature, &computedK, conductivityFunction.context.get()), 0);
+    ASSERT_EQ(viscosityFunction.function(conserved.data(), params.temperature, &computedMu, viscosityFunction.context.get()), 0);
+    ASSERT_EQ(speciesDiffusivityFunction.function(conserved.data(), params.temperature, computedDiffusivity.data(), speciesDiffusivityFunction.context.get()), 0);
+
+    // ASSERT
+    ASSERT_LT(PetscAbs((params.expectedConductivity - computedK) / params.expectedConductivity), params.errorTolerance)
+        << "The conductivity (" << params.expectedConductivity << " vs " << computedK << ") should be close";
+    ASSERT_LT(PetscAbs((params.expectedViscosity - computedMu) / params.expectedViscosity), params.errorTolerance)
+        << "The viscosity (" << params.expectedViscosity << " vs " << computedMu << ") should be close";
+    for (const auto& [name, expectedDiffusivity] : params.expectedSpeciesDiffusivity) {
+        const auto computed = computedDiffusivity[std::distance(species.begin(), std::find(species.begin(), species.end(), name))];
+        ASSERT_LT(PetscAbs((expectedDiffusivity - computed) / expectedDiffusivity), params.errorTolerance)
+            << "The diffusivity of " << name << " (" << expectedDiffusivity << " vs " << computed << ") should be close";
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(MixtureAveragedTests, MixtureAveragedTransportTestFixture,
+                         testing::Values((MixtureAveragedTransportTestParameters){.mechFile = "inputs/eos/gri30.yaml",
+                                                                                  .temperature = 300.0,
+                                                                                  .density = 1.1719843,
+                                                                                  .yiMap = {{"O2", 0.233}, {"N2", 0.767}},
+                                                                                  .expectedConductivity = 0.025536,
+                                                                                  .expectedViscosity = 1.86205E-5,
+                                                                                  .expectedSpeciesDiffusivity = {{"O2", 2.02612E-5}, {"N2", 2.31426E-5}}}));
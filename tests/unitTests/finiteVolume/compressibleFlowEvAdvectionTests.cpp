@@ -1,6 +1,7 @@
 #include <petsc.h>
 #include <cmath>
 #include <memory>
+#include <numeric>
 #include <vector>
 #include "MpiTestFixture.hpp"
 #include "PetscTestErrorChecker.hpp"
@@ -33,6 +34,7 @@ struct CompressibleFlowEvAdvectionTestParameters {
     std::shared_ptr<mathFunctions::MathFunction> densityEvExact;
     std::vector<PetscReal> expectedL2Convergence;
     std::vector<PetscReal> expectedLInfConvergence;
+    bool concurrentLevels = false;
 };
 
 class CompressibleFlowEvAdvectionFixture : public testingResources::MpiTestFixture, public ::testing::WithParamInterface<CompressibleFlowEvAdvectionTestParameters> {
@@ -44,15 +46,26 @@ TEST_P(CompressibleFlowEvAdvectionFixture, ShouldConvergeToExactSolution) {
     StartWithMPI
         // initialize petsc and mpi
         ablate::environment::RunEnvironment::Initialize(argc, argv);
-        ablate::utilities::PetscUtilities::Initialize();
 
         PetscInt initialNx = GetParam().initialNx;
 
+        // optionally run the levels concurrently on sub comms sized by the number of cells in each level
+        std::vector<PetscInt> levels(GetParam().levels);
+        std::iota(levels.begin(), levels.end(), 0);
+        if (GetParam().concurrentLevels) {
+            std::vector<PetscReal> levelCosts;
+            for (auto l : levels) {
+                levelCosts.push_back(PetscSqr((PetscReal)(initialNx * PetscPowRealInt(2, l))));
+            }
+            levels = testingResources::ConvergenceTester::SplitLevels(levelCosts);
+        }
+        ablate::utilities::PetscUtilities::Initialize();
+
         testingResources::ConvergenceTester l2History("l2");
         testingResources::ConvergenceTester lInfHistory("lInf");
 
         // March over each level
-        for (PetscInt l = 0; l < GetParam().levels; l++) {
+        for (auto l : levels) {
             // Create a mesh
             PetscInt nx1D = initialNx * PetscPowRealInt(2, l);
 
@@ -117,6 +130,10 @@ TEST_P(CompressibleFlowEvAdvectionFixture, ShouldConvergeToExactSolution) {
             l2History.Record(h, l2Norm);
             lInfHistory.Record(h, lInfNorm);
         }
+        if (GetParam().concurrentLevels) {
+            l2History.Gather();
+            lInfHistory.Gather();
+        }
 
         std::string l2Message;
         if (!l2History.CompareConvergenceRate(GetParam().expectedL2Convergence, l2Message)) {
@@ -154,6 +171,17 @@ INSTANTIATE_TEST_SUITE_P(
                                                                 .eulerExact = ablate::mathFunctions::Create("2.0, 500000, 8.0, 0.0"),
                                                                 .densityEvExact = ablate::mathFunctions::Create("2*.2*(1 + sin(2*_pi*(x-4*t)/.01))/2, 2*.3*(1 + sin(2*_pi*(x-4*t)/.01))/2"),
                                                                 .expectedL2Convergence = {NAN, NAN, NAN, NAN, 1, 1},
-                                                                .expectedLInfConvergence = {NAN, NAN, NAN, NAN, 1, 1}}),
+                                                                .expectedLInfConvergence = {NAN, NAN, NAN, NAN, 1, 1}},
+                    (CompressibleFlowEvAdvectionTestParameters){.mpiTestParameter = {.testName = "concurrent ev advection",
+                                                                                     .nproc = 3,
+                                                                                     .arguments = "-dm_plex_separate_marker -dm_distribute -ts_adapt_type none "
+                                                                                                  "-ts_max_steps 50 -ts_dt 5e-05  "},
+                                                                .initialNx = 5,
+                                                                .levels = 4,
+                                                                .eulerExact = ablate::mathFunctions::Create("2.0, 500000, 8.0, 0.0"),
+                                                                .densityEvExact = ablate::mathFunctions::Create("2*.2*(1 + sin(2*_pi*(x-4*t)/.01))/2, 2*.3*(1 + sin(2*_pi*(x-4*t)/.01))/2"),
+                                                                .expectedL2Convergence = {NAN, NAN, NAN, NAN, 1, 1},
+                                                                .expectedLInfConvergence = {NAN, NAN, NAN, NAN, 1, 1},
+                                                                .concurrentLevels = true}),
     [](const testing::TestParamInfo<CompressibleFlowEvAdvectionTestParameters> &info) { return info.param.mpiTestParameter.getTestName(); });
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
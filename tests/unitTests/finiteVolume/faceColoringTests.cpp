@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include "PetscTestFixture.hpp"
+#include "finiteVolume/faceColoring.hpp"
+#include "gtest/gtest.h"
+
+struct FaceColoringParameters {
+    std::vector<PetscInt> leftCells;
+    std::vector<PetscInt> rightCells;
+};
+
+class FaceColoringTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<FaceColoringParameters> {};
+
+TEST_P(FaceColoringTestFixture, ShouldVisitEachFaceOnceWithoutSharedCells) {
+    // arrange
+    const auto& params = GetParam();
+    ablate::finiteVolume::FaceColoring faceColoring(params.leftCells, params.rightCells);
+
+    // act
+    std::mutex visitMutex;
+    std::vector<std::size_t> visits(params.leftCells.size(), 0);
+    std::vector<std::size_t> visitColors;
+    faceColoring.ForEach([&](std::size_t index, std::size_t) {
+        std::lock_guard<std::mutex> lock(visitMutex);
+        visits[index]++;
+        visitColors.push_back(faceColoring.GetColor(index));
+    });
+
+    // assert
+    for (std::size_t i = 0; i < visits.size(); i++) {
+        ASSERT_EQ(1, visits[i]) << "face " << i << " should be visited exactly once";
+    }
+    ASSERT_LE(faceColoring.GetNumberColors(), params.leftCells.size());
+
+    // the colors are executed in turn, so the visited colors should never decrease
+    for (std::size_t v = 1; v < visitColors.size(); v++) {
+        ASSERT_LE(visitColors[v - 1], visitColors[v]) << "the colors should be visited in order";
+    }
+
+    // no two faces of the same color may share a left/right cell
+    for (std::size_t i = 0; i < params.leftCells.size(); i++) {
+        ASSERT_LT(faceColoring.GetColor(i), faceColoring.GetNumberColors());
+        for (std::size_t j = i + 1; j < params.leftCells.size(); j++) {
+            if (faceColoring.GetColor(i) != faceColoring.GetColor(j)) {
+                continue;
+            }
+            std::set<PetscInt> cellsI = {params.leftCells[i], params.rightCells[i]};
+            ASSERT_FALSE(cellsI.count(params.leftCells[j]) || cellsI.count(params.rightCells[j])) << "faces " << i << " and " << j << " share a cell but have the same color";
+        }
+    }
+}
+
+TEST_P(FaceColoringTestFixture, ShouldRethrowExceptionsFromFunction) {
+    // arrange
+    const auto& params = GetParam();
+    ablate::finiteVolume::FaceColoring faceColoring(params.leftCells, params.rightCells);
+
+    // act/assert
+    if (params.leftCells.empty()) {
+        ASSERT_NO_THROW(faceColoring.ForEach([](std::size_t, std::size_t) { throw std::runtime_error("should not be called"); }));
+    } else {
+        ASSERT_THROW(faceColoring.ForEach([](std::size_t, std::size_t) { throw std::runtime_error("expected error"); }), std::runtime_error);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(FaceColoringTests, FaceColoringTestFixture,
+                         testing::Values(
+                             // a one-dimensional chain of cells
+                             (FaceColoringParameters){.leftCells = {0, 1, 2, 3, 4, 5}, .rightCells = {1, 2, 3, 4, 5, 6}},
+                             // a two by two grid of cells with ghost cells
+                             (FaceColoringParameters){.leftCells = {0, 2, 0, 1, 0, 1, 2, 3, 0, 2, 1, 3}, .rightCells = {1, 3, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}},
+                             // no faces
+                             (FaceColoringParameters){.leftCells = {}, .rightCells = {}}));
+
+class FaceColoringStencilTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(FaceColoringStencilTestFixture, ShouldSeparateFacesSharingAnyStencilPoint) {
+    // arrange
+    const std::vector<std::vector<PetscInt>> facePoints = {{0, 10, 11}, {1, 11, 12}, {2, 13}, {3, 13, 10}, {4}};
+
+    // act
+    ablate::finiteVolume::FaceColoring faceColoring(facePoints);
+    std::vector<std::size_t> visits(facePoints.size(), 0);
+    faceColoring.ForEach([&visits](std::size_t index, std::size_t) { visits[index]++; });
+
+    // assert
+    for (std::size_t i = 0; i < visits.size(); i++) {
+        ASSERT_EQ(1, visits[i]) << "face " << i << " should be visited exactly once";
+    }
+    for (std::size_t i = 0; i < facePoints.size(); i++) {
+        for (std::size_t j = i + 1; j < facePoints.size(); j++) {
+            if (faceColoring.GetColor(i) != faceColoring.GetColor(j)) {
+                continue;
+            }
+            for (const auto point : facePoints[i]) {
+                ASSERT_EQ(facePoints[j].end(), std::find(facePoints[j].begin(), facePoints[j].end(), point)) << "faces " << i << " and " << j << " share a point but have the same color";
+            }
+        }
+    }
+    // faces 0/1, 0/3, and 2/3 share a stencil point so exactly two colors are required
+    ASSERT_EQ(2, faceColoring.GetNumberColors());
+}
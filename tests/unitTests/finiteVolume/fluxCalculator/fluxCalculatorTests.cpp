@@ -2,9 +2,11 @@
 #include <vector>
 #include "eos/perfectGas.hpp"
 #include "eos/stiffenedGas.hpp"
+#include "finiteVolume/fluxCalculator/adaptiveFlux.hpp"
 #include "finiteVolume/fluxCalculator/ausm.hpp"
 #include "finiteVolume/fluxCalculator/ausmpUp.hpp"
 #include "finiteVolume/fluxCalculator/averageFlux.hpp"
+#include "finiteVolume/fluxCalculator/hllcStiff.hpp"
 #include "finiteVolume/fluxCalculator/offFlux.hpp"
 #include "finiteVolume/fluxCalculator/rieman.hpp"
 #include "finiteVolume/fluxCalculator/riemann2Gas.hpp"
@@ -224,6 +226,41 @@ INSTANTIATE_TEST_SUITE_P(
             .expectedInterfacePressure = {0.30313018, 0.00189387, 460.893787, 46.095, 460.894},  // pressure at x=0
             .expectedDirection = {LEFT, RIGHT, LEFT, RIGHT, LEFT}                                // Upwind direction based on velocity at x = 0
         },
+        // HllcStiff flux testing, same gamma L/R
+        (FluxCalculatorTestParameters){
+            .testName = "HllcStiffFlux",
+            .fluxCalculator = std::make_shared<ablate::finiteVolume::fluxCalculator::HllcStiff>(
+                std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}})),
+                std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}))),
+            .uL = {10.0, -10.0, 5.0, -3.0, 500.0},
+            .aL = {374.16573867739413, 374.16573867739413, 343.8204473267988, 374.16573867739413, 374.16573867739413},
+            .rhoL = {1.0, 1.0, 1.2, 1.0, 1.0},
+            .pL = {100000.0, 100000.0, 101325.0, 100000.0, 100000.0},
+            .uR = {10.0, -10.0, 2.0, -1.0, 500.0},
+            .aR = {374.16573867739413, 374.16573867739413, 356.7530340063379, 366.9695718539436, 374.16573867739413},
+            .rhoR = {1.0, 1.0, 1.1, 1.05, 1.0},
+            .pR = {100000.0, 100000.0, 100000.0, 101000.0, 100000.0},
+            .expectedMassFlux = {10.0, -10.0, 6.211989511741534, -3.428802323149849, 500.0},
+            .expectedInterfacePressure = {100000.0, 100000.0, 101247.62271127467, 100106.8544722026, 100000.0},
+            .expectedDirection = {LEFT, RIGHT, LEFT, RIGHT, LEFT}},
+        // HllcStiff flux testing, every face exceeds the pressure ratio so the exact solution is used
+        (FluxCalculatorTestParameters){
+            .testName = "HllcStiffFluxWithExactFallback",
+            .fluxCalculator = std::make_shared<ablate::finiteVolume::fluxCalculator::HllcStiff>(
+                std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}})),
+                std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}})),
+                2.0),
+            .uL = {0.0, 0.0, 0.0, 19.5975},
+            .aL = {1.18321596, 37.4165739, 0.1183216, 10.3708995},
+            .rhoL = {1.0, 1.0, 1.0, 5.99924},
+            .pL = {1.0, 1000.0, 0.01, 460.894},
+            .uR = {0.0, 0.0, 0.0, -6.19633},
+            .aR = {1.05830052, 0.1183216, 11.8321596, 3.28163145},
+            .rhoR = {0.125, 1.0, 1.0, 5.99242},
+            .pR = {0.1, 0.01, 100.0, 46.0950},
+            .expectedMassFlux = {0.39539107, 11.2697554, -3.56358518796, 117.5701},
+            .expectedInterfacePressure = {0.30313018, 460.893787, 46.095, 460.894},
+            .expectedDirection = {LEFT, LEFT, RIGHT, LEFT}},
         // RiemannStiff flux testing, gamma 1.4 L/ gamma 1.667 R
         (FluxCalculatorTestParameters){
             .testName = "RiemannStiffFluxT2",
@@ -402,3 +439,58 @@ INSTANTIATE_TEST_SUITE_P(
 
         }),
     [](const testing::TestParamInfo<FluxCalculatorTestParameters>& info) { return info.param.testName; });
+
+TEST(AdaptiveFluxTests, ShouldSelectFluxCalculatorWithPressureJumpSensor) {
+    // arrange
+    auto defaultFluxCalculator = std::make_shared<ablate::finiteVolume::fluxCalculator::Ausm>();
+    auto shockFluxCalculator = std::make_shared<ablate::finiteVolume::fluxCalculator::AusmpUp>(0.0);
+    ablate::finiteVolume::fluxCalculator::AdaptiveFlux adaptiveFlux(defaultFluxCalculator, shockFluxCalculator, 0.1);
+
+    // the first face is smooth, the second has a pressure jump larger than the threshold
+    std::vector<PetscReal> uL = {10.0, 0.0}, aL = {374.0, 374.0}, rhoL = {1.0, 1.0}, pL = {100000.0, 100000.0};
+    std::vector<PetscReal> uR = {10.0, 0.0}, aR = {374.0, 374.0}, rhoR = {1.0, 1.0}, pR = {101000.0, 200000.0};
+    std::vector<FluxCalculator*> expectedFluxCalculators = {defaultFluxCalculator.get(), shockFluxCalculator.get()};
+
+    for (std::size_t i = 0; i < uL.size(); i++) {
+        PetscReal expectedMassFlux, expectedP12;
+        auto expectedDirection = expectedFluxCalculators[i]->GetFluxCalculatorFunction()(
+            expectedFluxCalculators[i]->GetFluxCalculatorContext(), uL[i], aL[i], rhoL[i], pL[i], uR[i], aR[i], rhoR[i], pR[i], &expectedMassFlux, &expectedP12);
+
+        // act
+        PetscReal massFlux, p12;
+        auto direction =
+            adaptiveFlux.GetFluxCalculatorFunction()(adaptiveFlux.GetFluxCalculatorContext(), uL[i], aL[i], rhoL[i], pL[i], uR[i], aR[i], rhoR[i], pR[i], &massFlux, &p12);
+
+        // assert
+        EXPECT_EQ(expectedDirection, direction);
+        EXPECT_DOUBLE_EQ(expectedMassFlux, massFlux);
+        EXPECT_DOUBLE_EQ(expectedP12, p12);
+    }
+    EXPECT_EQ(1, adaptiveFlux.GetDefaultCount());
+    EXPECT_EQ(1, adaptiveFlux.GetShockCount());
+}
+
+TEST(HllcStiffTests, ShouldAllowNullInterfacePressureWithExactFallback) {
+    // arrange
+    auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>(std::map<std::string, std::string>{{"gamma", "1.4"}}));
+    ablate::finiteVolume::fluxCalculator::HllcStiff hllcStiff(eos, eos, 2.0);
+    auto function = hllcStiff.GetFluxCalculatorFunction();
+    auto context = hllcStiff.GetFluxCalculatorContext();
+
+    // the first face uses the hllc kernel, the second exceeds the pressure ratio and uses the exact solution
+    std::vector<PetscReal> uL = {5.0, 0.0}, aL = {343.8204473267988, 1.18321596}, rhoL = {1.2, 1.0}, pL = {101325.0, 1.0};
+    std::vector<PetscReal> uR = {2.0, 0.0}, aR = {356.7530340063379, 1.05830052}, rhoR = {1.1, 0.125}, pR = {100000.0, 0.1};
+
+    for (std::size_t i = 0; i < uL.size(); i++) {
+        PetscReal expectedMassFlux, expectedP12;
+        auto expectedDirection = function(context, uL[i], aL[i], rhoL[i], pL[i], uR[i], aR[i], rhoR[i], pR[i], &expectedMassFlux, &expectedP12);
+
+        // act
+        PetscReal massFlux;
+        auto direction = function(context, uL[i], aL[i], rhoL[i], pL[i], uR[i], aR[i], rhoR[i], pR[i], &massFlux, nullptr);
+
+        // assert
+        EXPECT_EQ(expectedDirection, direction);
+        EXPECT_DOUBLE_EQ(expectedMassFlux, massFlux);
+    }
+}
@@ -49,6 +49,33 @@ TEST_P(NavierStokesTransportFluxTestFixture, ShouldComputeCorrectFlux) {
     }
 }
 
+TEST_P(NavierStokesTransportFluxTestFixture, ShouldComputeCorrectFluxWithInlinedPerfectGas) {
+    // arrange
+    const auto &params = GetParam();
+
+    // the perfect gas thermodynamics are computed in the flux without the eos functions
+    auto eos = std::make_shared<ablate::eos::PerfectGas>(std::make_shared<ablate::parameters::MapParameters>());
+    ablate::finiteVolume::processes::NavierStokesTransport::AdvectionData eulerFlowData;
+    eulerFlowData.cfl = NAN;
+    eulerFlowData.fluxCalculatorFunction = params.fluxCalculator->GetFluxCalculatorFunction();
+    eulerFlowData.advectionEos = ablate::finiteVolume::processes::NavierStokesTransport::AdvectionEos::PerfectGas;
+    eulerFlowData.gamma = eos->GetSpecificHeatRatio();
+
+    // setup a fake PetscFVFaceGeom
+    PetscFVFaceGeom faceGeom{};
+    std::copy(std::begin(params.area), std::end(params.area), faceGeom.normal);
+
+    // act
+    std::vector<PetscReal> computedFlux(params.expectedFlux.size());
+    PetscInt uOff[1] = {0};
+    ablate::finiteVolume::processes::NavierStokesTransport::AdvectionFlux(params.area.size(), &faceGeom, uOff, &params.xLeft[0], &params.xRight[0], NULL, NULL, NULL, &computedFlux[0], &eulerFlowData);
+
+    // assert
+    for (std::size_t i = 0; i < params.expectedFlux.size(); i++) {
+        ASSERT_NEAR(computedFlux[i], params.expectedFlux[i], 1E-3);
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(EulerTransportTests, NavierStokesTransportFluxTestFixture,
                          testing::Values((NavierStokesTransportFluxTestParameters){.fluxCalculator = std::make_shared<ablate::finiteVolume::fluxCalculator::Ausm>(),
                                                                                    .area = {1},
@@ -107,6 +107,106 @@ TEST_P(TwoPhaseEulerAdvectionTestDecodeStateFixture, ShouldDecodeState) {
     ASSERT_NEAR(alpha, params.expectedAlpha, 1E-6);
 }
 
+TEST_P(TwoPhaseEulerAdvectionTestDecodeStateFixture, ShouldDecodeStateFromCache) {
+    // arrange
+    auto eosGas = GetParam().eosGas;
+    auto eosLiquid = GetParam().eosLiquid;
+
+    // get the test params
+    const auto& params = GetParam();
+
+    // Prepare outputs
+    PetscReal density;
+    PetscReal densityG;
+    PetscReal densityL;
+    PetscReal normalVelocity;
+    std::vector<PetscReal> velocity(3);
+    PetscReal internalEnergy;
+    PetscReal internalEnergyG;
+    PetscReal internalEnergyL;
+    PetscReal soundSpeedG;
+    PetscReal soundSpeedL;
+    PetscReal MG;
+    PetscReal ML;
+    PetscReal pressure;
+    PetscReal temperature;
+    PetscReal alpha;
+
+    // compute offsets
+    PetscInt uOff[3] = {3 + params.dim /*alpha*/, 2 + params.dim /*rho1alpha1*/, 0 /*euler*/};
+
+    // Create a caching two phase decoder
+    auto decoder = finiteVolume::processes::TwoPhaseEulerAdvection::CreateCachedTwoPhaseDecoder(params.dim, eosGas, eosLiquid, 1);
+
+    // act
+    // decode with the cell center norm to fill the cache, then again with the face normal
+    const PetscReal cellNorm[3] = {1.0, 1.0, 1.0};
+    for (const PetscReal* normal : {cellNorm, &params.normalIn[0]}) {
+        decoder->DecodeTwoPhaseEulerState(params.dim,
+                                          uOff,
+                                          params.conservedValuesIn.data(),
+                                          normal,
+                                          &density,
+                                          &densityG,
+                                          &densityL,
+                                          &normalVelocity,
+                                          &velocity[0],
+                                          &internalEnergy,
+                                          &internalEnergyG,
+                                          &internalEnergyL,
+                                          &soundSpeedG,
+                                          &soundSpeedL,
+                                          &MG,
+                                          &ML,
+                                          &pressure,
+                                          &temperature,
+                                          &alpha);
+    }
+
+    // assert
+    ASSERT_NEAR(density, params.expectedDensity, 1E-6);
+    ASSERT_NEAR(densityG, params.expectedDensityG, 1E-6);
+    ASSERT_NEAR(densityL, params.expectedDensityL, 1E-6);
+    ASSERT_NEAR(normalVelocity, params.expectedNormalVelocity, 1E-6);
+    ASSERT_NEAR(velocity[0], params.expectedVelocity[0], 1E-6);
+    ASSERT_NEAR(velocity[1], params.expectedVelocity[1], 1E-6);
+    ASSERT_NEAR(velocity[2], params.expectedVelocity[2], 1E-6);
+    ASSERT_NEAR(internalEnergy, params.expectedInternalEnergy, 1E-6);
+    ASSERT_NEAR(internalEnergyG, params.expectedInternalEnergyG, params.expectedInternalEnergyG * 1E-6);
+    ASSERT_NEAR(internalEnergyL, params.expectedInternalEnergyL, params.expectedInternalEnergyL * 1E-6);
+    ASSERT_NEAR(soundSpeedG, params.expectedSoundSpeedG, 1E-6);
+    ASSERT_NEAR(soundSpeedL, params.expectedSoundSpeedL, 1E-6);
+    ASSERT_NEAR(MG, params.expectedMG, 1E-6);
+    ASSERT_NEAR(ML, params.expectedML, 1E-6);
+    ASSERT_NEAR(pressure, params.expectedPressure, 1E-2);
+    ASSERT_NEAR(alpha, params.expectedAlpha, 1E-6);
+}
+
+TEST_P(TwoPhaseEulerAdvectionTestDecodeStateFixture, ShouldMatchSnesPressureEquilibrium) {
+    // arrange
+    const auto& params = GetParam();
+    PetscInt uOff[3] = {3 + params.dim /*alpha*/, 2 + params.dim /*rho1alpha1*/, 0 /*euler*/};
+
+    // decode with the default and the snes validation decoder, values are {density, densityG, densityL, normalVelocity, internalEnergy, internalEnergyG, internalEnergyL, aG, aL, MG, ML,
+    // p, T, alpha}
+    std::vector<std::vector<PetscReal>> results;
+    for (bool snesPressureEquilibrium : {false, true}) {
+        auto decoder = finiteVolume::processes::TwoPhaseEulerAdvection::CreateTwoPhaseDecoder(params.dim, params.eosGas, params.eosLiquid, snesPressureEquilibrium);
+        std::vector<PetscReal> r(14);
+        PetscReal velocity[3];
+
+        // act
+        decoder->DecodeTwoPhaseEulerState(
+            params.dim, uOff, params.conservedValuesIn.data(), &params.normalIn[0], &r[0], &r[1], &r[2], &r[3], velocity, &r[4], &r[5], &r[6], &r[7], &r[8], &r[9], &r[10], &r[11], &r[12], &r[13]);
+        results.push_back(r);
+    }
+
+    // assert
+    for (std::size_t i = 0; i < results[0].size(); i++) {
+        ASSERT_NEAR(results[0][i], results[1][i], PetscMax(1E-6, PetscAbs(results[1][i]) * 1E-6)) << "for value " << i;
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     TwoPhaseEulerAdvectionTests, TwoPhaseEulerAdvectionTestDecodeStateFixture,
     testing::Values(
@@ -307,3 +407,21 @@ INSTANTIATE_TEST_SUITE_P(
                                                           .expectedPressure = 100000.0,
                                                           .expectedAlpha = 0.0}),
     [](const testing::TestParamInfo<TwoPhaseEulerAdvectionTestDecodeStateParameters>& info) { return std::to_string(info.index); });
+
+TEST(TwoPhaseEulerAdvectionTests, ShouldSharpenThincFaceValue) {
+    // a uniform state is not reconstructed
+    ASSERT_DOUBLE_EQ(finiteVolume::processes::TwoPhaseEulerAdvection::ThincFaceValue(0.5, 0.5, 3.5), 0.5);
+
+    for (PetscReal alpha : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+        // the face value is bounded and moves towards the downwind state
+        const auto increasing = finiteVolume::processes::TwoPhaseEulerAdvection::ThincFaceValue(alpha, 1.0, 3.5);
+        const auto decreasing = finiteVolume::processes::TwoPhaseEulerAdvection::ThincFaceValue(alpha, 0.0, 3.5);
+        ASSERT_GT(increasing, alpha) << "for alpha " << alpha;
+        ASSERT_LE(increasing, 1.0) << "for alpha " << alpha;
+        ASSERT_LT(decreasing, alpha) << "for alpha " << alpha;
+        ASSERT_GE(decreasing, 0.0) << "for alpha " << alpha;
+
+        // the reconstruction is symmetric about one half
+        ASSERT_NEAR(increasing, 1.0 - finiteVolume::processes::TwoPhaseEulerAdvection::ThincFaceValue(1.0 - alpha, 0.0, 3.5), 1E-12) << "for alpha " << alpha;
+    }
+}
@@ -0,0 +1,46 @@
+#include <chrono>
+#include "PetscTestFixture.hpp"
+#include "gtest/gtest.h"
+#include "io/checkpointDeadline.hpp"
+
+namespace ablateTesting::io {
+
+class CheckpointDeadlineTestFixture : public testingResources::PetscTestFixture {};
+
+TEST_F(CheckpointDeadlineTestFixture, ShouldReachDeadlineWhenRemainingTimeIsLessThanEstimatedCheckpoint) {
+    // arrange
+    auto currentTime = std::chrono::system_clock::time_point(std::chrono::seconds(1000));
+    ablate::io::CheckpointDeadline deadline(100.0, 2.0, [&currentTime]() { return currentTime; });
+
+    // act/assert
+    ASSERT_TRUE(deadline.Active());
+    ASSERT_FALSE(deadline.Check(MPI_COMM_SELF));
+
+    // each step takes 10 seconds, the remaining 90, 80, and 70 seconds are more than 2 x (10 + 20)
+    deadline.RecordCheckpoint(20.0);
+    for (int step = 0; step < 3; ++step) {
+        currentTime += std::chrono::seconds(10);
+        ASSERT_FALSE(deadline.Check(MPI_COMM_SELF));
+    }
+
+    // the remaining 60 seconds reaches the deadline
+    currentTime += std::chrono::seconds(10);
+    ASSERT_TRUE(deadline.Check(MPI_COMM_SELF));
+}
+
+TEST_F(CheckpointDeadlineTestFixture, ShouldKeepLongestCheckpoint) {
+    // arrange
+    auto currentTime = std::chrono::system_clock::time_point(std::chrono::seconds(1000));
+    ablate::io::CheckpointDeadline deadline(100.0, 1.0, [&currentTime]() { return currentTime; });
+
+    // act
+    deadline.RecordCheckpoint(98.5);
+    deadline.RecordCheckpoint(5.0);
+
+    // assert, the second check includes the one second step
+    ASSERT_FALSE(deadline.Check(MPI_COMM_SELF));
+    currentTime += std::chrono::seconds(1);
+    ASSERT_TRUE(deadline.Check(MPI_COMM_SELF));
+}
+
+}  // namespace ablateTesting::io
@@ -0,0 +1,56 @@
+#include <memory>
+#include "gtest/gtest.h"
+#include "mathFunctions/constantValue.hpp"
+#include "mathFunctions/ensembleFunction.hpp"
+
+namespace ablateTesting::mathFunctions {
+
+TEST(EnsembleFunctionTests, ShouldEvalTheActiveMember) {
+    // arrange
+    auto function = ablate::mathFunctions::EnsembleFunction(
+        {std::make_shared<ablate::mathFunctions::ConstantValue>(1.0), std::make_shared<ablate::mathFunctions::ConstantValue>(2.0)});
+
+    // act/assert
+    ablate::mathFunctions::EnsembleFunction::SetActiveMember(0);
+    ASSERT_DOUBLE_EQ(1.0, function.Eval(1.0, 2.0, 3.0, 4.0));
+    ablate::mathFunctions::EnsembleFunction::SetActiveMember(1);
+    ASSERT_DOUBLE_EQ(2.0, function.Eval(1.0, 2.0, 3.0, 4.0));
+
+    // cleanup
+    ablate::mathFunctions::EnsembleFunction::SetActiveMember(0);
+}
+
+TEST(EnsembleFunctionTests, ShouldProvidePetscFunctionForTheActiveMember) {
+    // arrange
+    auto function = ablate::mathFunctions::EnsembleFunction({std::make_shared<ablate::mathFunctions::ConstantValue>(std::vector<double>{10, 6.0}),
+                                                             std::make_shared<ablate::mathFunctions::ConstantValue>(std::vector<double>{3.0, 4.0})});
+    ablate::mathFunctions::EnsembleFunction::SetActiveMember(1);
+
+    auto context = function.GetContext();
+    auto functionPointer = function.GetPetscFunction();
+
+    const PetscReal x[3] = {1.0, 2.0, 3.0};
+    PetscScalar result[2] = {0.0, 0.0};
+
+    // act
+    auto errorCode = functionPointer(3, 4.0, x, 2, result, context);
+    ablate::mathFunctions::EnsembleFunction::SetActiveMember(0);
+
+    // assert
+    ASSERT_EQ(0, errorCode);
+    ASSERT_DOUBLE_EQ(3.0, result[0]);
+    ASSERT_DOUBLE_EQ(4.0, result[1]);
+}
+
+TEST(EnsembleFunctionTests, ShouldThrowWhenTheActiveMemberDoesNotExist) {
+    // arrange
+    auto function = ablate::mathFunctions::EnsembleFunction({std::make_shared<ablate::mathFunctions::ConstantValue>(1.0)});
+    ablate::mathFunctions::EnsembleFunction::SetActiveMember(1);
+
+    // act/assert
+    ASSERT_THROW(function.Eval(1.0, 2.0, 3.0, 4.0), std::out_of_range);
+
+    // cleanup
+    ablate::mathFunctions::EnsembleFunction::SetActiveMember(0);
+}
+}  // namespace ablateTesting::mathFunctions
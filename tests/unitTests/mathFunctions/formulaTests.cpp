@@ -1,6 +1,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <thread>
 #include "gtest/gtest.h"
 #include "mathFunctions/formula.hpp"
 #include "mathFunctions/functionFactory.hpp"
@@ -162,6 +163,51 @@ INSTANTIATE_TEST_SUITE_P(FormulaTests, FormulaTestsVectorFixture,
                                          (FormulaTestsVectorParameters){
                                              .formula = "0+CC, y+CC, t+AA", .constants = ablate::parameters::MapParameters::Create({{"CC", "3"}, {"AA", "1.5"}}), .expectedResult = {3, 5, 5.5}}));
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(FormulaTests, ShouldReportTimeInvariance) {
+    // arrange
+    auto spaceFunction = ablate::mathFunctions::Create("x*y");
+    auto timeFunction = ablate::mathFunctions::Create("x*t");
+
+    // act/assert
+    ASSERT_TRUE(ablate::mathFunctions::Formula("x+y+z").IsTimeInvariant());
+    ASSERT_FALSE(ablate::mathFunctions::Formula("x+y+t").IsTimeInvariant());
+    ASSERT_FALSE(ablate::mathFunctions::Formula("x*pRand(0, 100)").IsTimeInvariant());
+    ASSERT_TRUE(ablate::mathFunctions::Formula("2*a + z", {{"a", spaceFunction}}).IsTimeInvariant());
+    ASSERT_FALSE(ablate::mathFunctions::Formula("2*a + z", {{"a", timeFunction}}).IsTimeInvariant());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+TEST(FormulaTests, ShouldEvaluateFromMultipleThreads) {
+    // arrange
+    auto formula = ablate::mathFunctions::Formula("x*y + a*t", {{"a", ablate::mathFunctions::Create("z + 1")}});
+    const std::size_t numberThreads = 4;
+    const std::size_t numberPoints = 2000;
+    std::vector<std::vector<double>> results(numberThreads);
+
+    // act
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < numberThreads; ++t) {
+        threads.emplace_back([&formula, &results, t]() {
+            for (std::size_t p = 0; p < numberPoints; ++p) {
+                const double xyz[3] = {(double)p, (double)t, 2.0};
+                results[t].push_back(formula.Eval(xyz, 3, 0.5 * (double)t));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // assert
+    for (std::size_t t = 0; t < numberThreads; ++t) {
+        ASSERT_EQ(results[t].size(), numberPoints);
+        for (std::size_t p = 0; p < numberPoints; ++p) {
+            ASSERT_DOUBLE_EQ(results[t][p], (double)p * (double)t + 3.0 * 0.5 * (double)t) << " for thread " << t << " and point " << p;
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 TEST(FormulaTests, ShouldProduceDeterministicPsueduRandomNumber) {
     // arrange
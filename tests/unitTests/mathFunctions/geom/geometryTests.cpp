@@ -55,6 +55,27 @@ TEST_P(GeometryTestScalarFixture, ShouldComputeCorrectAnswerFromCoord) {
     }
 }
 
+TEST_P(GeometryTestScalarFixture, ShouldComputeCorrectAnswerForBatch) {
+    // arrange
+    const auto& param = GetParam();
+    auto function = param.createGeom();
+    const auto ndims = param.expectedResults.front().xyz.size();
+    std::vector<double> xyz;
+    for (const auto& expectedResult : param.expectedResults) {
+        ASSERT_EQ(ndims, expectedResult.xyz.size());
+        xyz.insert(xyz.end(), expectedResult.xyz.begin(), expectedResult.xyz.end());
+    }
+    std::vector<double> result(param.expectedResults.size());
+
+    // act
+    function->EvalBatch(xyz.data(), param.expectedResults.size(), (int)ndims, NAN, result.data(), 1, 1);
+
+    // assert
+    for (std::size_t p = 0; p < param.expectedResults.size(); p++) {
+        ASSERT_DOUBLE_EQ(param.expectedResults[p].value, result[p]) << " for point " << p;
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     GeometryTests, GeometryTestScalarFixture,
     testing::Values(
@@ -114,6 +135,8 @@ INSTANTIATE_TEST_SUITE_P(
                                        .expectedResults = {{.xyz = {-1.5, -2.0000001, 2}, .value = 0}}},
         (GeometryTestScalarParameters){.createGeom = []() { return std::make_shared<Surface>("inputs/mathFunctions/geom/testShape_m.step"); },
                                        .expectedResults = {{.xyz = {0.0, 0.0, 0.0}, .value = 1}}},
+        (GeometryTestScalarParameters){.createGeom = []() { return std::make_shared<Surface>("inputs/mathFunctions/geom/testShape_m.step", nullptr, nullptr, 0, 16); },
+                                       .expectedResults = {{.xyz = {0.0, 0.0, 0.0}, .value = 1}, {.xyz = {0.0, 0.041, 0.0}, .value = 0}, {.xyz = {0.005, 0.035, 0.005}, .value = 1}}},
         (GeometryTestScalarParameters){.createGeom = []() { return std::make_shared<Surface>("inputs/mathFunctions/geom/testShape_m.step"); },
                                        .expectedResults = {{.xyz = {0.0, 0.041, 0.0}, /**41 mm should be outside ***/
                                                             .value = 0}}},
@@ -64,6 +64,28 @@ TEST(LinearInterpolatorTests, ShouldThrowErrorForMissingYColumn) {
     ASSERT_THROW(ablate::mathFunctions::LinearTable(csvFileStream, "x", {"z", "y"}, ablate::mathFunctions::Create(ToXFunction)), std::invalid_argument);
 }
 
+TEST(LinearTableTests, ShouldInterpolateUniformlySpacedTable) {
+    // arrange
+    std::string csvFileString =
+        "x, y\n"
+        "0.0, 1.0\n"
+        "0.5, 2.0\n"
+        "1.0, 4.0\n"
+        "1.5, 0.0\n";
+    std::istringstream csvFileStream(csvFileString);
+    ablate::mathFunctions::LinearTable interpolator(csvFileStream, "x", {"y"}, ablate::mathFunctions::Create(ToXFunction));
+
+    // act
+    // assert
+    ASSERT_DOUBLE_EQ(1.0, interpolator.Eval(-1.0, 0.0, 0.0, 0.0));
+    ASSERT_DOUBLE_EQ(1.5, interpolator.Eval(0.25, 0.0, 0.0, 0.0));
+    ASSERT_DOUBLE_EQ(2.0, interpolator.Eval(0.5, 0.0, 0.0, 0.0));
+    ASSERT_DOUBLE_EQ(3.0, interpolator.Eval(0.75, 0.0, 0.0, 0.0));
+    ASSERT_DOUBLE_EQ(2.0, interpolator.Eval(1.25, 0.0, 0.0, 0.0));
+    ASSERT_DOUBLE_EQ(0.0, interpolator.Eval(1.5, 0.0, 0.0, 0.0));
+    ASSERT_DOUBLE_EQ(0.0, interpolator.Eval(3.0, 0.0, 0.0, 0.0));
+}
+
 struct LinearTableTestParameters {
     std::vector<std::string> yColumns;
     std::vector<PetscReal> xyz;
@@ -172,6 +194,31 @@ TEST_P(LinearTableTestFixture, ShouldInterpolateValueUsingPetscFunction) {
     }
 }
 
+TEST_P(LinearTableTestFixture, ShouldInterpolateValueUsingBatchSignature) {
+    // arrange
+    std::istringstream csvFileStream(csvFileString);
+
+    ablate::mathFunctions::LinearTable linearInterpolator(csvFileStream, "x", GetParam().yColumns, GetParam().xCoordFunction);
+    const std::size_t numberResults = GetParam().expectedValues.size();
+
+    // repeat the same point so each copy in the batch is checked
+    std::vector<double> xyz;
+    for (std::size_t p = 0; p < 3; p++) {
+        xyz.insert(xyz.end(), GetParam().xyz.begin(), GetParam().xyz.end());
+    }
+    std::vector<double> result(3 * numberResults);
+
+    // act
+    linearInterpolator.EvalBatch(xyz.data(), 3, GetParam().xyz.size(), GetParam().time, result.data(), numberResults, numberResults);
+
+    // assert
+    for (std::size_t p = 0; p < 3; p++) {
+        for (std::size_t i = 0; i < numberResults; i++) {
+            ASSERT_DOUBLE_EQ(GetParam().expectedValues[i], result[p * numberResults + i]);
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(LinearTableTests, LinearTableTestFixture,
                          testing::Values(
                              (LinearTableTestParameters){
@@ -0,0 +1,90 @@
+#include <fstream>
+#include <memory>
+#include "gtest/gtest.h"
+#include "mathFunctions/functionFactory.hpp"
+#include "mathFunctions/multiLinearTable.hpp"
+#include "temporaryPath.hpp"
+
+namespace ablateTesting::mathFunctions {
+
+/**
+ * write a 2D table (a in [0, 1] and b in [-1, 1]) holding the bilinear functions 1 + 2a + 3b + 4ab and a - b, which are exactly interpolated
+ */
+static void WriteBilinearTable(const std::filesystem::path& path) {
+    const std::vector<std::size_t> sizes = {3, 5};
+    std::vector<double> values;
+    for (std::size_t j = 0; j < sizes[1]; j++) {
+        for (std::size_t i = 0; i < sizes[0]; i++) {
+            const double a = 0.5 * (double)i;
+            const double b = -1.0 + 0.5 * (double)j;
+            values.push_back(1 + 2 * a + 3 * b + 4 * a * b);
+            values.push_back(a - b);
+        }
+    }
+    ablate::mathFunctions::MultiLinearTable::Write(path, sizes, {0.0, -1.0}, {1.0, 1.0}, 2, values);
+}
+
+TEST(MultiLinearTableTests, ShouldInterpolateInsideTheGrid) {
+    // arrange
+    testingResources::TemporaryPath tablePath;
+    WriteBilinearTable(tablePath.GetPath());
+    ablate::mathFunctions::MultiLinearTable table(tablePath.GetPath(), ablate::mathFunctions::Create("x, t"));
+
+    // act
+    std::vector<double> result(2);
+    table.Eval(0.3, 7.0, 8.0, 0.45, result);
+
+    // assert
+    ASSERT_NEAR(1 + 2 * 0.3 + 3 * 0.45 + 4 * 0.3 * 0.45, result[0], 1E-12);
+    ASSERT_NEAR(0.3 - 0.45, result[1], 1E-12);
+    ASSERT_NEAR(1 + 2 * 0.3 + 3 * 0.45 + 4 * 0.3 * 0.45, table.Eval(0.3, 7.0, 8.0, 0.45), 1E-12);
+}
+
+TEST(MultiLinearTableTests, ShouldBoundToTheGrid) {
+    // arrange
+    testingResources::TemporaryPath tablePath;
+    WriteBilinearTable(tablePath.GetPath());
+    ablate::mathFunctions::MultiLinearTable table(tablePath.GetPath(), ablate::mathFunctions::Create("x, t"));
+
+    // act
+    const double xyz[1] = {-2.0};
+
+    // assert
+    ASSERT_DOUBLE_EQ(1 + 3 * 1.0, table.Eval(xyz, 1, 10.0));
+    ASSERT_DOUBLE_EQ(1 + 2 * 1.0 + 3 * -1.0 + 4 * 1.0 * -1.0, table.Eval(5.0, 0.0, 0.0, -3.0));
+}
+
+TEST(MultiLinearTableTests, ShouldInterpolateBatch) {
+    // arrange
+    testingResources::TemporaryPath tablePath;
+    WriteBilinearTable(tablePath.GetPath());
+    ablate::mathFunctions::MultiLinearTable table(tablePath.GetPath(), ablate::mathFunctions::Create("x, y"));
+    const std::vector<double> xyz = {0.1, -0.9, 0.5, 0.0, 0.99, 0.75};
+    std::vector<double> result(9, -1.0);
+
+    // act
+    table.EvalBatch(xyz.data(), 3, 2, 0.0, result.data(), 2, 3);
+
+    // assert
+    for (std::size_t p = 0; p < 3; p++) {
+        const double a = xyz[2 * p];
+        const double b = xyz[2 * p + 1];
+        ASSERT_NEAR(1 + 2 * a + 3 * b + 4 * a * b, result[3 * p], 1E-12);
+        ASSERT_NEAR(a - b, result[3 * p + 1], 1E-12);
+        ASSERT_DOUBLE_EQ(-1.0, result[3 * p + 2]) << "the stride should not be written";
+    }
+}
+
+TEST(MultiLinearTableTests, ShouldThrowForInvalidFile) {
+    // arrange
+    testingResources::TemporaryPath tablePath;
+    {
+        std::ofstream invalidFile(tablePath.GetPath());
+        invalidFile << "x,y\n1,2\n";
+    }
+
+    // act/assert
+    ASSERT_THROW(ablate::mathFunctions::MultiLinearTable(tablePath.GetPath(), ablate::mathFunctions::Create("x")), std::invalid_argument);
+}
+
+}  // namespace ablateTesting::mathFunctions
@@ -52,6 +52,37 @@ TEST(SimpleFormulaTests, ShouldEvalToScalarFromCoord) {
     ASSERT_DOUBLE_EQ(0.0, function.Eval(array3, 3, -5));
 }
 
+TEST(SimpleFormulaTests, ShouldEvalScalarBatch) {
+    // arrange
+    auto function = ablate::mathFunctions::SimpleFormula("x+y*z+t");
+    const double points[6] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+    double result[3] = {0.0, 0.0, 0.0};
+
+    // act
+    function.EvalBatch(points, 3, 2, 1.0, result, 1, 1);
+
+    // assert
+    ASSERT_DOUBLE_EQ(2.0, result[0]);
+    ASSERT_DOUBLE_EQ(4.0, result[1]);
+    ASSERT_DOUBLE_EQ(6.0, result[2]);
+}
+
+TEST(SimpleFormulaTests, ShouldEvalVectorBatch) {
+    // arrange
+    auto function = ablate::mathFunctions::SimpleFormula("x+y+z+t,x*y*z");
+    const double points[6] = {1.0, 2.0, 3.0, 2.0, 2.0, 3.0};
+    double result[4] = {0.0, 0.0, 0.0, 0.0};
+
+    // act
+    function.EvalBatch(points, 2, 3, 4.0, result, 2, 2);
+
+    // assert
+    ASSERT_DOUBLE_EQ(10.0, result[0]);
+    ASSERT_DOUBLE_EQ(6.0, result[1]);
+    ASSERT_DOUBLE_EQ(11.0, result[2]);
+    ASSERT_DOUBLE_EQ(12.0, result[3]);
+}
+
 TEST(SimpleFormulaTests, ShouldEvalToVectorFromXYZ) {
     // arrange
     auto function = ablate::mathFunctions::SimpleFormula("x+y+z+t,x*y*z,t");
@@ -44,6 +44,31 @@ TEST_P(MixtureFractionCalculatorFixture, ShouldComputeMixtureFraction) {
     }
 }
 
+TEST_P(MixtureFractionCalculatorFixture, ShouldComputeMixtureFractionFromDensityYi) {
+    // arrange
+    auto eos = GetParam().createEOS();
+    ablate::monitors::MixtureFractionCalculator mixtureFractionCalculator(eos, GetParam().massFractionsFuel, GetParam().massFractionsOxidizer, GetParam().trackingElements);
+    const double density = 1.7;
+
+    // test each case
+    for (const auto& [inputMassFractions, expectedValue] : GetParam().parameters) {
+        // build a densityYi vector
+        std::vector<double> densityYi(eos->GetSpecies().size());
+        for (const auto& [species, yi] : inputMassFractions) {
+            auto location = std::find(eos->GetSpecies().begin(), eos->GetSpecies().end(), species);
+            if (location != eos->GetSpecies().end()) {
+                auto i = std::distance(eos->GetSpecies().begin(), location);
+                densityYi[i] = density * yi;
+            }
+        }
+        // act
+        auto zMix = mixtureFractionCalculator.CalculateFromDensityYi(densityYi.data(), density);
+
+        // assert
+        ASSERT_NEAR(expectedValue, zMix, 1E-6);
+    }
+}
+
 TEST_P(MixtureFractionCalculatorFixture, ShouldComputeMixtureFractionUsingFieldFunction) {
     // arrange
     auto eos = GetParam().createEOS();
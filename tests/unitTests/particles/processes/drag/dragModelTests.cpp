@@ -33,6 +33,34 @@ TEST_P(DragModelTestFixture, ShouldComputeCorrectDragForce) {
     }
 }
 
+TEST_P(DragModelTestFixture, ShouldComputeCorrectDragForceForBatch) {
+    // arrange
+    const auto& param = GetParam();
+    auto dragModel = param.createDragModel();
+    const PetscInt dim = (PetscInt)param.expectedDragForce.size();
+    const PetscInt np = 3;
+
+    // copy the parameters for each particle into struct-of-arrays
+    std::vector<PetscReal> partVel(dim * np), flowVel(dim * np), muF(np, param.muF), rhoF(np, param.rhoF), partDiam(np, param.partDiam);
+    for (PetscInt n = 0; n < dim; n++) {
+        for (PetscInt p = 0; p < np; p++) {
+            partVel[n * np + p] = param.partVel[n];
+            flowVel[n * np + p] = param.flowVel[n];
+        }
+    }
+    std::vector<PetscReal> computedDragForce(dim * np);
+
+    // act
+    dragModel->ComputeDragForces(dim, np, partVel.data(), flowVel.data(), muF.data(), rhoF.data(), partDiam.data(), computedDragForce.data());
+
+    // assert
+    for (PetscInt n = 0; n < dim; n++) {
+        for (PetscInt p = 0; p < np; p++) {
+            ASSERT_DOUBLE_EQ(param.expectedDragForce[n], computedDragForce[n * np + p]);
+        }
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(DragModelTests, DragModelTestFixture,
                          testing::Values((DragModelTestParameters){.createDragModel = []() { return std::make_shared<ablate::particles::processes::drag::Quadratic>(); },
                                                                    .partVel = {100.0},
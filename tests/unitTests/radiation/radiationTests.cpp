@@ -307,6 +307,39 @@ INSTANTIATE_TEST_SUITE_P(
                                                   [](std::shared_ptr<ablate::eos::radiationProperties::RadiationModel> radiationModelIn) {
                                                       return std::make_shared<ablate::radiation::Radiation>("radiationBase", ablate::domain::Region::ENTIREDOMAIN, 15, radiationModelIn, nullptr);
                                                   }},
+                    (RadiationTestParameters){.mpiTestParameter = {.testName = "1D uniform temperature batch properties", .nproc = 1},
+                                              .meshFaces = {3, 20},
+                                              .meshStart = {-0.5, -0.0105},
+                                              .meshEnd = {0.5, 0.0105},
+                                              .temperatureField = ablate::mathFunctions::Create("y < 0 ? (-6.349E6*y*y + 2000.0) : (-1.179E7*y*y + 2000.0)"),
+                                              .expectedResult = ablate::mathFunctions::Create("x + y"),
+                                              .radiationFactory =
+                                                  [](std::shared_ptr<ablate::eos::radiationProperties::RadiationModel> radiationModelIn) {
+                                                      return std::make_shared<ablate::radiation::Radiation>(
+                                                          "radiationBaseBatch", ablate::domain::Region::ENTIREDOMAIN, 15, radiationModelIn, nullptr, true);
+                                                  }},
+                    (RadiationTestParameters){.mpiTestParameter = {.testName = "1D uniform temperature ray budget", .nproc = 1},
+                                              .meshFaces = {3, 20},
+                                              .meshStart = {-0.5, -0.0105},
+                                              .meshEnd = {0.5, 0.0105},
+                                              .temperatureField = ablate::mathFunctions::Create("y < 0 ? (-6.349E6*y*y + 2000.0) : (-1.179E7*y*y + 2000.0)"),
+                                              .expectedResult = ablate::mathFunctions::Create("x + y"),
+                                              .radiationFactory =
+                                                  [](std::shared_ptr<ablate::eos::radiationProperties::RadiationModel> radiationModelIn) {
+                                                      return std::make_shared<ablate::radiation::Radiation>(
+                                                          "radiationBaseBudget", ablate::domain::Region::ENTIREDOMAIN, 15, radiationModelIn, nullptr, false, false, 200);
+                                                  }},
+                    (RadiationTestParameters){.mpiTestParameter = {.testName = "1D uniform temperature update tolerance", .nproc = 1},
+                                              .meshFaces = {3, 20},
+                                              .meshStart = {-0.5, -0.0105},
+                                              .meshEnd = {0.5, 0.0105},
+                                              .temperatureField = ablate::mathFunctions::Create("y < 0 ? (-6.349E6*y*y + 2000.0) : (-1.179E7*y*y + 2000.0)"),
+                                              .expectedResult = ablate::mathFunctions::Create("x + y"),
+                                              .radiationFactory =
+                                                  [](std::shared_ptr<ablate::eos::radiationProperties::RadiationModel> radiationModelIn) {
+                                                      return std::make_shared<ablate::radiation::Radiation>(
+                                                          "radiationBaseUpdate", ablate::domain::Region::ENTIREDOMAIN, 15, radiationModelIn, nullptr, false, false, 0, 1.0E-3);
+                                                  }},
                     (RadiationTestParameters){.mpiTestParameter = {.testName = "1D uniform temperature 2 proc.", .nproc = 2},
                                               .meshFaces = {3, 20},
                                               .meshStart = {-0.5, -0.0105},
@@ -327,5 +360,16 @@ INSTANTIATE_TEST_SUITE_P(
                                                   [](std::shared_ptr<ablate::eos::radiationProperties::RadiationModel> radiationModelIn) {
                                                       return std::make_shared<ablate::radiation::RaySharingRadiation>(
                                                           "radiationBaseSharing", ablate::domain::Region::ENTIREDOMAIN, 15, radiationModelIn, nullptr);
+                                                  }},
+                    (RadiationTestParameters){.mpiTestParameter = {.testName = "1D uniform temperature 2 proc. sharing balanced", .nproc = 2},
+                                              .meshFaces = {3, 20},
+                                              .meshStart = {-0.5, -0.0105},
+                                              .meshEnd = {0.5, 0.0105},
+                                              .temperatureField = ablate::mathFunctions::Create("y < 0 ? (-6.349E6*y*y + 2000.0) : (-1.179E7*y*y + 2000.0)"),
+                                              .expectedResult = ablate::mathFunctions::Create("x + y"),
+                                              .radiationFactory =
+                                                  [](std::shared_ptr<ablate::eos::radiationProperties::RadiationModel> radiationModelIn) {
+                                                      return std::make_shared<ablate::radiation::RaySharingRadiation>(
+                                                          "radiationBaseSharingBalanced", ablate::domain::Region::ENTIREDOMAIN, 15, radiationModelIn, nullptr, false, false, 0, 0, 1.0E-3);
                                                   }}),
     [](const testing::TestParamInfo<RadiationTestParameters>& info) { return info.param.mpiTestParameter.getTestName(); });
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <petsc.h>
+#include <algorithm>
+#include <map>
+#include "PetscTestFixture.hpp"
+#include "gtest/gtest.h"
+#include "solver/tiledRange.hpp"
+
+namespace ablateTesting::solver {
+
+class TiledRangeTestFixture : public testingResources::PetscTestFixture, public ::testing::WithParamInterface<PetscInt> {};
+
+TEST_P(TiledRangeTestFixture, ShouldAssignEachCellAndFaceToOneTile) {
+    // arrange
+    DM dm;
+    PetscInt faces[2] = {3, 4};
+    DMPlexCreateBoxMesh(PETSC_COMM_SELF, 2, PETSC_FALSE, faces, nullptr, nullptr, nullptr, PETSC_TRUE, &dm) >> errorChecker;
+    PetscInt cStart, cEnd, fStart, fEnd;
+    DMPlexGetHeightStratum(dm, 0, &cStart, &cEnd) >> errorChecker;
+    DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd) >> errorChecker;
+    ablate::solver::Range cellRange{.start = cStart, .end = cEnd};
+    ablate::solver::Range faceRange{.start = fStart, .end = fEnd};
+
+    // act
+    ablate::solver::TiledRange tiledRange(dm, cellRange, faceRange, GetParam());
+
+    // assert
+    ASSERT_EQ((std::size_t)((cEnd - cStart + GetParam() - 1) / GetParam()), tiledRange.GetNumberTiles());
+    std::map<PetscInt, std::size_t> cellTile;
+    PetscInt expectedCell = cStart;
+    for (std::size_t t = 0; t < tiledRange.GetNumberTiles(); ++t) {
+        const auto& tileCells = tiledRange.GetCellRange(t);
+        ASSERT_LE(tileCells.end - tileCells.start, GetParam());
+        for (PetscInt c = tileCells.start; c < tileCells.end; ++c) {
+            // the cells keep the range order
+            ASSERT_EQ(expectedCell++, tileCells.points[c]);
+            cellTile[tileCells.points[c]] = t;
+        }
+    }
+    ASSERT_EQ(cEnd, expectedCell);
+
+    std::vector<PetscInt> visitedFaces;
+    for (std::size_t t = 0; t < tiledRange.GetNumberTiles(); ++t) {
+        const auto& tileFaces = tiledRange.GetFaceRange(t);
+        for (PetscInt f = tileFaces.start; f < tileFaces.end; ++f) {
+            const PetscInt face = tileFaces.points[f];
+            visitedFaces.push_back(face);
+
+            // the face is in the first tile of its supporting cells
+            PetscInt supportSize;
+            const PetscInt* support;
+            DMPlexGetSupportSize(dm, face, &supportSize) >> errorChecker;
+            DMPlexGetSupport(dm, face, &support) >> errorChecker;
+            std::size_t expectedTile = tiledRange.GetNumberTiles();
+            for (PetscInt s = 0; s < supportSize; ++s) {
+                expectedTile = std::min(expectedTile, cellTile.at(support[s]));
+            }
+            ASSERT_EQ(expectedTile, t) << "face " << face << " should be in the first tile of its cells";
+        }
+    }
+    std::sort(visitedFaces.begin(), visitedFaces.end());
+    ASSERT_EQ((std::size_t)(fEnd - fStart), visitedFaces.size());
+    for (PetscInt f = fStart; f < fEnd; ++f) {
+        ASSERT_EQ(f, visitedFaces[f - fStart]) << "each face should be visited once";
+    }
+
+    DMDestroy(&dm) >> errorChecker;
+}
+
+INSTANTIATE_TEST_SUITE_P(TiledRangeTests, TiledRangeTestFixture, testing::Values(1, 5, 12, 100));
+}  // namespace ablateTesting::solver
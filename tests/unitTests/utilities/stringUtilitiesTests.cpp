@@ -87,3 +87,19 @@ TEST_P(StringPostfixTestFixture, ShouldDetermineEndsWith) {
 INSTANTIATE_TEST_SUITE_P(StringUtilititiesTests, StringPostfixTestFixture,
                          testing::Values(std::make_tuple("CO2Yi", "Yi", true), std::make_tuple("CO2YI", "Yi", false), std::make_tuple("YiCO2", "Yi", false), std::make_tuple("", "Yi", false),
                                          std::make_tuple("CO2 Yi", "Yi", true), std::make_tuple("CO2Yi ", "Yi", false), std::make_tuple("CO2 Yi ", "Yi ", true)));
+
+class StringHashTestFixture : public ::testing::TestWithParam<std::tuple<std::string, std::string>> {};
+
+TEST_P(StringHashTestFixture, ShouldComputeStableHash) {
+    // arrange
+    std::string inputString = std::get<0>(GetParam());
+
+    // act
+    auto hash = ablate::utilities::StringUtilities::Hash(inputString);
+
+    // assert
+    ASSERT_EQ(hash, std::get<1>(GetParam()));
+}
+
+INSTANTIATE_TEST_SUITE_P(StringUtilititiesTests, StringHashTestFixture,
+                         testing::Values(std::make_tuple("", "cbf29ce484222325"), std::make_tuple("a", "af63dc4c8601ec8c"), std::make_tuple("foobar", "85944171f73967e8")));